@@ -174,6 +174,17 @@ namespace testspr {
 			// sprout::to_hash, sprout::hash
 			TESTSPR_BOTH_ASSERT(sprout::to_hash(arr1) == sprout::hash<decltype(arr1)>()(arr1));
 			TESTSPR_BOTH_ASSERT(sprout::to_hash(arr1) != sprout::to_hash(sprout::array<int, 10>{{}}));
+			TESTSPR_ASSERT(sprout::to_hash(arr1) == std::hash<std::decay<decltype(arr1)>::type>()(arr1));
+			{
+				// arrays of bytes hash their bytes
+				SPROUT_STATIC_CONSTEXPR auto bytes = sprout::array<unsigned char, 5>{{1, 2, 3, 4, 5}};
+				SPROUT_STATIC_CONSTEXPR auto chars = sprout::array<char, 5>{{1, 2, 3, 4, 5}};
+				TESTSPR_BOTH_ASSERT(sprout::to_hash(bytes) == sprout::hash_bytes(bytes));
+				TESTSPR_BOTH_ASSERT(sprout::to_hash(bytes) == sprout::to_hash(chars));
+				TESTSPR_BOTH_ASSERT(sprout::to_hash(bytes) != sprout::to_hash(sprout::array<unsigned char, 5>{{1, 2, 3, 4, 6}}));
+				TESTSPR_ASSERT(sprout::to_hash(bytes) == std::hash<std::decay<decltype(bytes)>::type>()(bytes));
+				TESTSPR_ASSERT(sprout::to_hash(bytes) == sprout::hash_memory(bytes.data(), bytes.size()));
+			}
 		}
 	}
 }	// namespace testspr
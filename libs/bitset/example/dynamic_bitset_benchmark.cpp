@@ -0,0 +1,93 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+//
+// count, AND and find_next over a dynamic_bitset of a million bits, against a
+// loop over its words. Build with -O2, and with -mavx2 for the 256-bit kernels:
+//
+//	g++ -std=c++11 -O2 -mavx2 -I. libs/bitset/example/dynamic_bitset_benchmark.cpp
+//
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <vector>
+#include <sprout/bitset.hpp>
+#include <sprout/bit/popcount.hpp>
+#include <sprout/bit/ctz.hpp>
+
+namespace {
+	typedef sprout::dynamic_bitset<> bitset_type;
+	typedef bitset_type::word_type word_type;
+	SPROUT_STATIC_CONSTEXPR std::size_t size = 1 << 20;
+	SPROUT_STATIC_CONSTEXPR std::size_t repeat = 200;
+
+	template<typename F>
+	std::size_t run(char const* name, F f) {
+		std::size_t result = 0;
+		std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+		for (std::size_t i = 0; i != repeat; ++i) {
+			result += f();
+		}
+		std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+		std::cout << name << "\t" << elapsed.count() / repeat * 1e6 << " us" << std::endl;
+		return result;
+	}
+}	// anonymous-namespace
+
+int main() {
+	std::mt19937_64 gen(1);
+	bitset_type a(size);
+	bitset_type b(size);
+	bitset_type sparse(size);
+	for (std::size_t i = 0; i != size; ++i) {
+		a[i] = gen() % 2 != 0;
+		b[i] = gen() % 2 != 0;
+		sparse[i] = gen() % 4096 == 0;
+	}
+	std::vector<word_type> wa(a.data(), a.data() + a.num_words());
+	std::vector<word_type> wb(b.data(), b.data() + b.num_words());
+	std::vector<word_type> ws(sparse.data(), sparse.data() + sparse.num_words());
+	std::size_t const bits = sizeof(word_type) * 8;
+
+	std::size_t check = 0;
+	check += run("count (kernel)", [&] { return a.count(); });
+	check -= run("count (words)", [&] {
+		std::size_t n = 0;
+		for (std::size_t i = 0; i != wa.size(); ++i) {
+			n += sprout::popcount(wa[i]);
+		}
+		return n;
+	});
+	bitset_type r(size);
+	std::vector<word_type> wr(wa.size());
+	check += run("and (kernel)", [&] { r = a; r &= b; return r.num_words(); });
+	check -= run("and (words)", [&] {
+		for (std::size_t i = 0; i != wa.size(); ++i) {
+			wr[i] = wa[i] & wb[i];
+		}
+		return wr.size();
+	});
+	check += run("find_next (kernel)", [&] {
+		std::size_t n = 0;
+		for (std::size_t i = sparse.find_first(); i != sparse.size(); i = sparse.find_next(i)) {
+			++n;
+		}
+		return n;
+	});
+	check -= run("find_next (words)", [&] {
+		std::size_t n = 0;
+		for (std::size_t i = 0; i != ws.size(); ++i) {
+			for (word_type w = ws[i]; w != 0; w &= w - 1) {
+				n += (i * bits + sprout::ctz(w)) < size;
+			}
+		}
+		return n;
+	});
+	check += run("select (kernel)", [&] { return a.select(a.count() / 2); });
+	std::cout << "check " << check << std::endl;
+}
@@ -0,0 +1,169 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_LIBS_BITSET_TEST_DYNAMIC_BITSET_CPP
+#define SPROUT_LIBS_BITSET_TEST_DYNAMIC_BITSET_CPP
+
+#include <sstream>
+#include <string>
+#include <vector>
+#include <sprout/bitset.hpp>
+#include <testspr/tools.hpp>
+
+namespace testspr {
+	static void dynamic_bitset_test() {
+		using namespace sprout;
+		{
+			typedef sprout::dynamic_bitset<> bitset_t;
+
+			// a pattern long enough for the vector kernels and their tails
+			std::size_t const n = 4000 + 37;
+			bitset_t a(n);
+			bitset_t b(n);
+			std::vector<bool> ra(n);
+			std::vector<bool> rb(n);
+			for (std::size_t i = 0; i != n; ++i) {
+				ra[i] = i % 7 == 0 || i % 61 == 3;
+				rb[i] = i % 3 == 0;
+				a[i] = ra[i];
+				b[i] = rb[i];
+			}
+			std::size_t count = 0;
+			for (std::size_t i = 0; i != n; ++i) {
+				count += ra[i];
+			}
+
+			// size, count
+			TESTSPR_ASSERT(a.size() == n);
+			TESTSPR_ASSERT(a.count() == count);
+			TESTSPR_ASSERT(a.any());
+			TESTSPR_ASSERT(!a.all());
+			TESTSPR_ASSERT(bitset_t(n).none());
+			TESTSPR_ASSERT(bitset_t(n).set().all());
+			TESTSPR_ASSERT(bitset_t(n).set().count() == n);
+
+			// operator&, operator|, operator^, operator-
+			{
+				bitset_t const x = a & b;
+				bitset_t const o = a | b;
+				bitset_t const e = a ^ b;
+				bitset_t const d = a - b;
+				bool ok = true;
+				for (std::size_t i = 0; i != n; ++i) {
+					ok = ok
+						&& x[i] == (ra[i] && rb[i])
+						&& o[i] == (ra[i] || rb[i])
+						&& e[i] == (ra[i] != rb[i])
+						&& d[i] == (ra[i] && !rb[i])
+						;
+				}
+				TESTSPR_ASSERT(ok);
+				TESTSPR_ASSERT(x.count() + e.count() == o.count());
+			}
+
+			// find_first, find_next
+			{
+				std::size_t found = 0;
+				bool ok = true;
+				for (std::size_t i = a.find_first(); i != a.size(); i = a.find_next(i)) {
+					ok = ok && ra[i];
+					++found;
+				}
+				TESTSPR_ASSERT(ok);
+				TESTSPR_ASSERT(found == count);
+				TESTSPR_ASSERT(a.find_first() == 0);
+				TESTSPR_ASSERT(a.find_next(0) == 3);
+				TESTSPR_ASSERT(bitset_t(n).find_first() == n);
+			}
+
+			// rank, select
+			{
+				bool ok = true;
+				std::size_t k = 0;
+				for (std::size_t i = 0; i != n; ++i) {
+					ok = ok && a.rank(i) == k;
+					if (ra[i]) {
+						ok = ok && a.select(k) == i;
+						++k;
+					}
+				}
+				TESTSPR_ASSERT(ok);
+				TESTSPR_ASSERT(a.rank(n) == count);
+				TESTSPR_ASSERT(a.select(count) == n);
+			}
+
+			// operator<<, operator>>, operator~
+			{
+				bitset_t const l = a << 100;
+				bitset_t const r = a >> 65;
+				bool ok = true;
+				for (std::size_t i = 0; i != n; ++i) {
+					ok = ok
+						&& l[i] == (i >= 100 && ra[i - 100])
+						&& r[i] == (i + 65 < n && ra[i + 65])
+						;
+				}
+				TESTSPR_ASSERT(ok);
+				TESTSPR_ASSERT((~a).count() == n - count);
+				TESTSPR_ASSERT((a << n).none());
+			}
+
+			// resize, push_back
+			{
+				bitset_t bits(3, 0x5);
+				bits.resize(70, true);
+				TESTSPR_ASSERT(bits.count() == 69);
+				bits.push_back(false);
+				TESTSPR_ASSERT(bits.size() == 71);
+				TESTSPR_ASSERT(!bits[70]);
+				bits.resize(2);
+				TESTSPR_ASSERT(bits.count() == 1);
+			}
+
+			// to_string, operator<<
+			{
+				bitset_t const bits(std::string("1101"));
+				TESTSPR_ASSERT(bits.size() == 4);
+				TESTSPR_ASSERT(bits.to_string() == "1101");
+				std::ostringstream os;
+				os << bits;
+				TESTSPR_ASSERT(os.str() == "1101");
+			}
+		}
+		{
+			// sprout::bitset takes the same kernels at runtime from eight words on
+			typedef sprout::bitset<1000> bitset_t;
+			bitset_t a;
+			bitset_t b;
+			for (std::size_t i = 0; i != a.size(); ++i) {
+				a[i] = i % 5 == 0;
+				b[i] = i % 2 == 0;
+			}
+			TESTSPR_ASSERT(a.count() == 200);
+			TESTSPR_ASSERT((a & b).count() == 100);
+			TESTSPR_ASSERT((a | b).count() == 600);
+			TESTSPR_ASSERT((a ^ b).count() == 500);
+			TESTSPR_ASSERT(a.find_first() == 0);
+			TESTSPR_ASSERT(a.find_next(0) == 5);
+			TESTSPR_ASSERT(a.find_next(995) == 1000);
+			a &= b;
+			TESTSPR_ASSERT(a.count() == 100);
+
+			SPROUT_STATIC_CONSTEXPR auto bits = bitset_t(0xF0);
+			TESTSPR_BOTH_ASSERT(bits.count() == 4);
+			TESTSPR_BOTH_ASSERT(bits.find_first() == 4);
+			TESTSPR_BOTH_ASSERT(bits.find_next(7) == 1000);
+		}
+	}
+}	// namespace testspr
+
+#ifndef TESTSPR_CPP_INCLUDE
+#	define TESTSPR_TEST_FUNCTION testspr::dynamic_bitset_test
+#	include <testspr/include_main.hpp>
+#endif
+
+#endif	// #ifndef SPROUT_LIBS_BITSET_TEST_DYNAMIC_BITSET_CPP
@@ -0,0 +1,139 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_LIBS_BITSET_TEST_ROARING_BITMAP_CPP
+#define SPROUT_LIBS_BITSET_TEST_ROARING_BITMAP_CPP
+
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <sprout/bitset.hpp>
+#include <testspr/tools.hpp>
+
+namespace testspr {
+	static void roaring_bitmap_test() {
+		using namespace sprout;
+		{
+			// a sparse chunk (array), a dense one (bitmap) and a range (runs)
+			std::vector<std::uint32_t> va;
+			std::vector<std::uint32_t> vb;
+			for (std::uint32_t i = 0; i != 3000; ++i) {
+				va.push_back(i * 7);
+				vb.push_back(i * 11);
+			}
+			for (std::uint32_t i = 0; i != 20000; ++i) {
+				va.push_back(0x30000 + i * 3);
+				vb.push_back(0x30000 + i * 2);
+			}
+			sprout::roaring_bitmap a(va.begin(), va.end());
+			sprout::roaring_bitmap b(vb.begin(), vb.end());
+			a.add_range(0x70000, 0x90000);
+			b.add_range(0x80000, 0xA0000);
+			for (std::uint32_t x = 0x70000; x != 0x90000; ++x) {
+				va.push_back(x);
+			}
+			for (std::uint32_t x = 0x80000; x != 0xA0000; ++x) {
+				vb.push_back(x);
+			}
+			std::sort(vb.begin(), vb.end());
+
+			// cardinality, contains, minimum, maximum
+			TESTSPR_ASSERT(a.cardinality() == va.size());
+			TESTSPR_ASSERT(a.contains(7 * 2999));
+			TESTSPR_ASSERT(!a.contains(7 * 2999 + 1));
+			TESTSPR_ASSERT(a.contains(0x30000 + 3 * 19999));
+			TESTSPR_ASSERT(a.contains(0x8FFFF));
+			TESTSPR_ASSERT(!a.contains(0x90000));
+			TESTSPR_ASSERT(a.minimum() == 0);
+			TESTSPR_ASSERT(a.maximum() == 0x8FFFF);
+			TESTSPR_ASSERT(a.to_vector() == va);
+
+			// operator|, operator&, operator-
+			{
+				std::vector<std::uint32_t> u;
+				std::vector<std::uint32_t> i;
+				std::vector<std::uint32_t> d;
+				std::set_union(va.begin(), va.end(), vb.begin(), vb.end(), std::back_inserter(u));
+				std::set_intersection(va.begin(), va.end(), vb.begin(), vb.end(), std::back_inserter(i));
+				std::set_difference(va.begin(), va.end(), vb.begin(), vb.end(), std::back_inserter(d));
+				TESTSPR_ASSERT((a | b).to_vector() == u);
+				TESTSPR_ASSERT((a & b).to_vector() == i);
+				TESTSPR_ASSERT((a - b).to_vector() == d);
+				TESTSPR_ASSERT((a & b).cardinality() == i.size());
+			}
+
+			// add, remove
+			{
+				sprout::roaring_bitmap bits(a);
+				TESTSPR_ASSERT(!bits.add(7));
+				TESTSPR_ASSERT(bits.add(8));
+				TESTSPR_ASSERT(bits.remove(8));
+				TESTSPR_ASSERT(!bits.remove(8));
+				TESTSPR_ASSERT(bits.remove(0x80000));
+				TESTSPR_ASSERT(!bits.contains(0x80000));
+				TESTSPR_ASSERT(bits.cardinality() == va.size() - 1);
+			}
+
+			// run_optimize
+			{
+				sprout::roaring_bitmap bits(a);
+				TESTSPR_ASSERT(bits.run_optimize());
+				TESTSPR_ASSERT(bits == a);
+				TESTSPR_ASSERT(bits.serialized_size() < a.serialized_size() + 16);
+			}
+
+			// serialize, roaring_view
+			{
+				std::vector<unsigned char> const bytes = a.serialize();
+				TESTSPR_ASSERT(bytes.size() == a.serialized_size());
+				sprout::roaring_view const view(bytes.data(), bytes.size());
+				TESTSPR_ASSERT(view.cardinality() == a.cardinality());
+				TESTSPR_ASSERT(view.containers() == a.containers());
+				bool ok = true;
+				for (std::uint32_t x = 0; x != 0xA0000; x += 5) {
+					ok = ok && view.contains(x) == a.contains(x);
+				}
+				TESTSPR_ASSERT(ok);
+				TESTSPR_ASSERT(sprout::roaring_bitmap(view) == a);
+
+				bool thrown = false;
+				try {
+					sprout::roaring_view const truncated(bytes.data(), bytes.size() - 1);
+					TESTSPR_ASSERT(truncated.empty());
+				} catch (std::invalid_argument const&) {
+					thrown = true;
+				}
+				TESTSPR_ASSERT(thrown);
+			}
+			{
+				// run containers, fewer than four: no offset header
+				sprout::roaring_bitmap bits;
+				bits.add_range(10, 100000);
+				bits.add(200000);
+				std::vector<unsigned char> const bytes = bits.serialize();
+				TESTSPR_ASSERT(bytes[0] == 0x3B && bytes[1] == 0x30);
+				sprout::roaring_view const view(bytes.data(), bytes.size());
+				TESTSPR_ASSERT(view.cardinality() == 99991);
+				TESTSPR_ASSERT(view.contains(99999));
+				TESTSPR_ASSERT(!view.contains(100000));
+				TESTSPR_ASSERT(view.contains(200000));
+				std::vector<std::uint32_t> values;
+				view.for_each([&](std::uint32_t x) { values.push_back(x); });
+				TESTSPR_ASSERT(values == bits.to_vector());
+			}
+		}
+	}
+}	// namespace testspr
+
+#ifndef TESTSPR_CPP_INCLUDE
+#	define TESTSPR_TEST_FUNCTION testspr::roaring_bitmap_test
+#	include <testspr/include_main.hpp>
+#endif
+
+#endif	// #ifndef SPROUT_LIBS_BITSET_TEST_ROARING_BITMAP_CPP
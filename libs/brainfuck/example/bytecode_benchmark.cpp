@@ -0,0 +1,81 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+//
+// Time of running the programs in example/brainfuck with the source
+// interpreter (exec_range) and with compiled bytecode (compile_range + exec):
+//
+//	g++ -std=c++14 -O2 -I. libs/brainfuck/example/bytecode_benchmark.cpp
+//	ulimit -s unlimited && ./a.out
+//
+// The source interpreter recurses once per executed step, so fizzBuzz.bf
+// needs the larger stack.
+//
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <sprout/brainfuck.hpp>
+#include <sprout/string.hpp>
+#include <sprout/algorithm/equal.hpp>
+
+namespace {
+	template<typename F>
+	double time(F f) {
+		std::size_t const repeat = 200;
+		std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+		for (std::size_t i = 0; i != repeat; ++i) {
+			f();
+		}
+		std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+		return elapsed.count() / repeat * 1e6;
+	}
+
+	template<std::size_t BufferSize, std::size_t OutputSize, typename Source, typename Input>
+	void bench(char const* name, Source const& source, Input const& input) {
+		typedef sprout::string<OutputSize> output_type;
+		output_type interpreted, compiled;
+		double const interpreter = time([&] {
+			interpreted = sprout::brainfuck::exec_range<BufferSize>(source, sprout::pit<output_type>(), input);
+		});
+		double const bytecode = time([&] {
+			compiled = sprout::brainfuck::exec<BufferSize>(
+				sprout::brainfuck::compile_range<sprout::container_traits<Source>::static_size>(source),
+				sprout::pit<output_type>(), sprout::begin(input), sprout::end(input)
+				);
+		});
+		std::cout
+			<< name << "\n"
+			<< "\tinterpreter\t" << interpreter << " us\n"
+			<< "\tbytecode\t" << bytecode << " us\n"
+			<< "\tcheck " << (interpreted == compiled ? "same output" : "DIFFERENT OUTPUT") << std::endl
+			;
+	}
+}	// anonymous-namespace
+
+int main() {
+	bench<32, 16>(
+		"hello.bf",
+		sprout::to_string(
+#include "../../../example/brainfuck/hello.bf"
+			),
+		""
+		);
+	bench<32, 1024>(
+		"self.bf",
+		sprout::to_string(
+#include "../../../example/brainfuck/self.bf"
+			),
+		"bf"
+		);
+	bench<32, 512>(
+		"fizzBuzz.bf",
+		sprout::to_string(
+#include "../../../example/brainfuck/fizzBuzz.bf"
+			),
+		""
+		);
+}
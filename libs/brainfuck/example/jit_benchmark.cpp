@@ -0,0 +1,150 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+//
+// Time of running bottles.bf and quine.bf with the bytecode interpreter, with
+// optimized bytecode, and as native code JIT-compiled into an mmap'ed page.
+// The AOT image from make_elf is also written out, run and checked.
+//
+//	g++ -std=c++14 -O2 -I. libs/brainfuck/example/jit_benchmark.cpp
+//
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <sprout/brainfuck.hpp>
+#include <sprout/string.hpp>
+#if defined(__linux__) && defined(__x86_64__)
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#endif
+
+#if defined(__linux__) && defined(__x86_64__)
+namespace {
+	template<typename F>
+	double time(F f) {
+		std::size_t const repeat = 200;
+		std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+		for (std::size_t i = 0; i != repeat; ++i) {
+			f();
+		}
+		std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+		return elapsed.count() / repeat * 1e6;
+	}
+
+	std::string* jit_output = 0;
+	int jit_put(int c) {
+		jit_output->push_back(static_cast<char>(c));
+		return c;
+	}
+	int jit_get() {
+		return EOF;
+	}
+
+	//
+	// jit
+	//
+	class jit {
+	private:
+		typedef void (*function_type)(unsigned char*, void* const*);
+	private:
+		void* page_;
+		std::size_t size_;
+	public:
+		template<typename Binary>
+		explicit jit(Binary const& bin)
+			: page_(::mmap(0, bin.size(), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0))
+			, size_(bin.size())
+		{
+			std::memcpy(page_, &*bin.begin(), bin.size());
+			::mprotect(page_, size_, PROT_READ | PROT_EXEC);
+		}
+		~jit() {
+			::munmap(page_, size_);
+		}
+		std::string operator()() const {
+			static unsigned char tape[65536];
+			void* const io[] = { reinterpret_cast<void*>(&jit_put), reinterpret_cast<void*>(&jit_get) };
+			std::string output;
+			jit_output = &output;
+			std::memset(tape, 0, sizeof(tape));
+			reinterpret_cast<function_type>(page_)(tape, io);
+			return output;
+		}
+	};
+
+	std::string run_elf(char const* name) {
+		std::string output;
+		if (FILE* p = ::popen(name, "r")) {
+			for (int c; (c = std::fgetc(p)) != EOF; ) {
+				output.push_back(static_cast<char>(c));
+			}
+			::pclose(p);
+		}
+		return output;
+	}
+
+	template<std::size_t N, typename Source>
+	void bench(char const* name, Source const& source) {
+		sprout::brainfuck::bytecode<N> const code = sprout::brainfuck::compile_range<N>(source);
+		sprout::brainfuck::bytecode<N> const optimized = sprout::brainfuck::optimize(code);
+		std::string interpreted, optimized_interpreted, native;
+		double const bytecode = time([&] {
+			interpreted.clear();
+			sprout::brainfuck::exec_copy<1024>(code, std::back_inserter(interpreted));
+		});
+		double const optimized_bytecode = time([&] {
+			optimized_interpreted.clear();
+			sprout::brainfuck::exec_copy<1024>(optimized, std::back_inserter(optimized_interpreted));
+		});
+		::jit const f(sprout::brainfuck::x86_64::assemble<N * 16>(optimized));
+		double const jitted = time([&] {
+			native = f();
+		});
+		std::string const elf_name = std::string("./") + name + ".elf";
+		{
+			auto const elf = sprout::brainfuck::x86_64::make_elf<N * 16>(optimized);
+			std::ofstream ofs(elf_name.c_str(), std::ios::binary);
+			ofs.write(reinterpret_cast<char const*>(&*elf.begin()), elf.size());
+		}
+		::chmod(elf_name.c_str(), 0755);
+		std::string const& expected = interpreted;
+		std::cout
+			<< name << " (" << code.size() << " -> " << optimized.size() << " instructions)\n"
+			<< "\tbytecode\t" << bytecode << " us\n"
+			<< "\toptimized\t" << optimized_bytecode << " us\n"
+			<< "\tjit\t\t" << jitted << " us\n"
+			<< "\tcheck optimized " << (optimized_interpreted == interpreted ? "same output" : "DIFFERENT OUTPUT") << "\n"
+			<< "\tcheck jit " << (native == expected ? "same output" : "DIFFERENT OUTPUT") << "\n"
+			<< "\tcheck elf " << (run_elf(elf_name.c_str()) == expected ? "same output" : "DIFFERENT OUTPUT") << std::endl
+			;
+	}
+}	// anonymous-namespace
+
+int main() {
+	bench<4096>(
+		"bottles.bf",
+		sprout::to_string(
+#include "../../../example/brainfuck/bottles.bf"
+			)
+		);
+	bench<1024>(
+		"quine.bf",
+		sprout::to_string(
+#include "../../../example/brainfuck/quine.bf"
+			)
+		);
+}
+#else
+int main() {
+	std::cout << "requires Linux on x86-64" << std::endl;
+}
+#endif
@@ -0,0 +1,164 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_LIBS_BRAINFUCK_TEST_BYTECODE_CPP
+#define SPROUT_LIBS_BRAINFUCK_TEST_BYTECODE_CPP
+
+#include <stdexcept>
+#include <sprout/brainfuck.hpp>
+#include <sprout/string.hpp>
+#include <sprout/algorithm/equal.hpp>
+#include <testspr/tools.hpp>
+
+namespace testspr {
+	static void bytecode_test() {
+		using namespace sprout;
+		typedef sprout::brainfuck::opcode opcode;
+		typedef sprout::brainfuck::instruction instruction;
+		{
+			// run-length folding
+			auto code = sprout::brainfuck::compile_range<16>(sprout::to_string("+++++>>>--<+-."));
+			TESTSPR_ASSERT(code.size() == 5);
+			TESTSPR_ASSERT(code[0] == (instruction{opcode::add, 5}));
+			TESTSPR_ASSERT(code[1] == (instruction{opcode::move, 3}));
+			TESTSPR_ASSERT(code[2] == (instruction{opcode::add, -2}));
+			TESTSPR_ASSERT(code[3] == (instruction{opcode::move, -1}));
+			TESTSPR_ASSERT(code[4] == (instruction{opcode::output, 0}));
+		}
+		{
+			// clear-loops and jump table
+			auto code = sprout::brainfuck::compile_range<16>(sprout::to_string("+[-]>[+]++[>[-<+>]<-]"));
+			TESTSPR_ASSERT(code.size() == 16);
+			TESTSPR_ASSERT(code[1] == (instruction{opcode::clear, 0}));
+			TESTSPR_ASSERT(code[3] == (instruction{opcode::clear, 0}));
+			TESTSPR_ASSERT(code[5] == (instruction{opcode::jump_zero, 15}));
+			TESTSPR_ASSERT(code[7] == (instruction{opcode::jump_zero, 12}));
+			TESTSPR_ASSERT(code[12] == (instruction{opcode::jump_nonzero, 7}));
+			TESTSPR_ASSERT(code[15] == (instruction{opcode::jump_nonzero, 5}));
+		}
+		{
+			// same output as the source interpreter
+			auto hello = sprout::to_string(
+#include "../../../example/brainfuck/hello.bf"
+				);
+			auto code = sprout::brainfuck::compile_range<64>(hello);
+			auto result = sprout::brainfuck::exec(code, sprout::pit<sprout::string<32> >());
+			TESTSPR_ASSERT(sprout::equal(result.begin(), result.begin() + 14, "Hello, world!"));
+			TESTSPR_ASSERT(result == sprout::brainfuck::exec_range(hello, sprout::pit<sprout::string<32> >()));
+		}
+#ifndef SPROUT_CONFIG_DISABLE_CXX14_CONSTEXPR
+		{
+			// constant expression
+			SPROUT_STATIC_CONSTEXPR auto code = sprout::brainfuck::compile_range<64>(sprout::to_string(
+#include "../../../example/brainfuck/hello.bf"
+				));
+			SPROUT_STATIC_CONSTEXPR auto result = sprout::brainfuck::exec(code, sprout::pit<sprout::string<32> >());
+			TESTSPR_BOTH_ASSERT(code.size() == 40);
+			TESTSPR_BOTH_ASSERT(sprout::equal(result.begin(), result.begin() + 14, "Hello, world!"));
+		}
+#endif
+		{
+			// multiply loops and scans
+			auto code = sprout::brainfuck::optimize(sprout::brainfuck::compile_range<32>(sprout::to_string(
+				"+++++[->++>>---<<<]>[<]++[>+<+]>[>]"
+				)));
+			TESTSPR_ASSERT(code.size() == 11);
+			TESTSPR_ASSERT(code[1] == (instruction{opcode::mul_add, 2, 1}));
+			TESTSPR_ASSERT(code[2] == (instruction{opcode::mul_add, -3, 3}));
+			TESTSPR_ASSERT(code[3] == (instruction{opcode::clear, 0}));
+			TESTSPR_ASSERT(code[5] == (instruction{opcode::scan, -1}));
+			TESTSPR_ASSERT(code[7] == (instruction{opcode::mul_add, -1, 1}));
+			TESTSPR_ASSERT(code[8] == (instruction{opcode::clear, 0}));
+			TESTSPR_ASSERT(code[10] == (instruction{opcode::scan, 1}));
+			auto nested = sprout::brainfuck::optimize(sprout::brainfuck::compile_range<16>(sprout::to_string("++[>[-<+>]<-]")));
+			TESTSPR_ASSERT(nested.size() == 8);
+			TESTSPR_ASSERT(nested[1] == (instruction{opcode::jump_zero, 7}));
+			TESTSPR_ASSERT(nested[3] == (instruction{opcode::mul_add, 1, -1}));
+			TESTSPR_ASSERT(nested[7] == (instruction{opcode::jump_nonzero, 1}));
+		}
+		{
+			// a multiply loop on a zero cell touches nothing, here not even the cell left of the tape
+			auto code = sprout::brainfuck::compile_range<32>(sprout::to_string("[-<+>]++++++++[->++++++++<]>+."));
+			auto optimized = sprout::brainfuck::optimize(code);
+			TESTSPR_ASSERT(optimized[0] == (instruction{opcode::mul_add, 1, -1}));
+			auto result = sprout::brainfuck::exec(optimized, sprout::pit<sprout::string<4> >());
+			TESTSPR_ASSERT(result == sprout::brainfuck::exec(code, sprout::pit<sprout::string<4> >()));
+			TESTSPR_ASSERT(result[0] == 'A' && result.size() == 4);
+		}
+		{
+			// optimized bytecode runs the same
+			auto fizz_buzz = sprout::to_string(
+#include "../../../example/brainfuck/fizzBuzz.bf"
+				);
+			auto code = sprout::brainfuck::compile_range<512>(fizz_buzz);
+			auto optimized = sprout::brainfuck::optimize(code);
+			TESTSPR_ASSERT(optimized.size() < code.size());
+			TESTSPR_ASSERT(
+				sprout::brainfuck::exec(optimized, sprout::pit<sprout::string<512> >())
+					== sprout::brainfuck::exec(code, sprout::pit<sprout::string<512> >())
+				);
+		}
+		{
+			// input
+			auto code = sprout::brainfuck::compile_range<16>(sprout::to_string(",[.,]"));
+			auto result = sprout::brainfuck::exec(code, sprout::pit<sprout::string<8> >(), sprout::begin("echo"), sprout::end("echo"));
+			TESTSPR_ASSERT(sprout::equal(result.begin(), result.begin() + 5, "echo"));
+		}
+		{
+			// output through an iterator
+			auto code = sprout::brainfuck::compile_range<16>(sprout::to_string(",[.,]"));
+			char result[8] = {};
+			char* last = sprout::brainfuck::exec_copy(code, result, sprout::begin("echo"), sprout::end("echo"));
+			TESTSPR_ASSERT(last == result + 4);
+			TESTSPR_ASSERT(sprout::equal(result, result + 5, "echo"));
+		}
+		{
+			// dialects
+			auto ook = sprout::brainfuck::ook::compile_range<16>(sprout::to_string(
+				"Ook. Ook. Ook. Ook. Ook. Ook. Ook! Ook. Ook. Ook? Ook! Ook."
+				));
+			TESTSPR_ASSERT(ook.size() == 4);
+			TESTSPR_ASSERT(ook[0] == (instruction{opcode::add, 3}));
+			TESTSPR_ASSERT(ook[2] == (instruction{opcode::move, 1}));
+			auto misa = sprout::brainfuck::misa::compile_range<16>(sprout::to_string("+++[-]."));
+			TESTSPR_ASSERT(misa.size() == 3);
+			TESTSPR_ASSERT(misa[1] == (instruction{opcode::clear, 0}));
+		}
+		{
+			// errors
+			int thrown = 0;
+			try {
+				sprout::brainfuck::compile_range<16>(sprout::to_string("[[]"));
+			} catch (std::invalid_argument const&) {
+				++thrown;
+			}
+			try {
+				sprout::brainfuck::compile_range<16>(sprout::to_string("[]]"));
+			} catch (std::invalid_argument const&) {
+				++thrown;
+			}
+			try {
+				sprout::brainfuck::compile_range<2>(sprout::to_string("+>+"));
+			} catch (std::length_error const&) {
+				++thrown;
+			}
+			try {
+				sprout::brainfuck::exec<4>(sprout::brainfuck::compile_range<4>(sprout::to_string("<")));
+			} catch (std::out_of_range const&) {
+				++thrown;
+			}
+			TESTSPR_ASSERT(thrown == 4);
+		}
+	}
+}	// namespace testspr
+
+#ifndef TESTSPR_CPP_INCLUDE
+#	define TESTSPR_TEST_FUNCTION testspr::bytecode_test
+#	include <testspr/include_main.hpp>
+#endif
+
+#endif	// #ifndef SPROUT_LIBS_BRAINFUCK_TEST_BYTECODE_CPP
@@ -0,0 +1,101 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_LIBS_BRAINFUCK_TEST_X86_64_CPP
+#define SPROUT_LIBS_BRAINFUCK_TEST_X86_64_CPP
+
+#include <stdexcept>
+#include <sprout/brainfuck.hpp>
+#include <sprout/string.hpp>
+#include <sprout/algorithm/equal.hpp>
+#include <testspr/tools.hpp>
+
+namespace testspr {
+	static void x86_64_test() {
+		using namespace sprout;
+		{
+			// every opcode, with both jumps patched
+			auto code = sprout::brainfuck::optimize(sprout::brainfuck::compile_range<16>(sprout::to_string("++[->+++<]>[.-]")));
+			auto bin = sprout::brainfuck::x86_64::assemble<128>(code);
+			unsigned char const expected[] = {
+				0x53, 0x41, 0x54, 0x55, 0x48, 0x89, 0xfb, 0x49, 0x89, 0xf4,
+				0x80, 0x03, 0x02,
+				0x80, 0x3b, 0x00, 0x74, 0x0f,
+				0x0f, 0xb6, 0x03, 0x69, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x83, 0x01, 0x00, 0x00, 0x00,
+				0xc6, 0x03, 0x00,
+				0x48, 0x81, 0xc3, 0x01, 0x00, 0x00, 0x00,
+				0x80, 0x3b, 0x00, 0x0f, 0x84, 0x13, 0x00, 0x00, 0x00,
+				0x0f, 0xb6, 0x3b, 0x41, 0xff, 0x14, 0x24,
+				0x80, 0x03, 0xff,
+				0x80, 0x3b, 0x00, 0x0f, 0x85, 0xed, 0xff, 0xff, 0xff,
+				0x5d, 0x41, 0x5c, 0x5b, 0xc3
+			};
+			TESTSPR_ASSERT(bin.size() == sizeof(expected));
+			TESTSPR_ASSERT(sprout::equal(bin.begin(), bin.end(), expected));
+		}
+		{
+			// a multiply loop on a zero cell jumps over its add
+			auto code = sprout::brainfuck::optimize(sprout::brainfuck::compile_range<32>(sprout::to_string("[-<+>]++++++++[->++++++++<]>+.")));
+			auto bin = sprout::brainfuck::x86_64::assemble<128>(code);
+			unsigned char const guarded[] = {
+				0x80, 0x3b, 0x00, 0x74, 0x09,
+				0x0f, 0xb6, 0x03, 0x00, 0x83, 0xff, 0xff, 0xff, 0xff
+			};
+			TESTSPR_ASSERT(sprout::equal(guarded, guarded + sizeof(guarded), bin.begin() + 10));
+		}
+		{
+			// nested loops
+			auto bin = sprout::brainfuck::x86_64::assemble<128>(
+				sprout::brainfuck::compile_range<16>(sprout::to_string("[>[.]<.]"))
+				);
+			TESTSPR_ASSERT(bin.size() == 10 + 9 + 7 + 9 + 7 + 9 + 7 + 7 + 9 + 5);
+			// outer je skips to the end, outer jne returns after the outer je
+			TESTSPR_ASSERT(bin[15] == 0x37 && bin[70] == 0xc9);
+			// inner je and jne
+			TESTSPR_ASSERT(bin[31] == 0x10 && bin[47] == 0xf0);
+		}
+		{
+			// static executable
+			auto elf = sprout::brainfuck::x86_64::make_elf<1024>(
+				sprout::brainfuck::compile_range<64>(sprout::to_string(
+#include "../../../example/brainfuck/hello.bf"
+				)));
+			auto body = sprout::brainfuck::x86_64::assemble<1024>(
+				sprout::brainfuck::compile_range<64>(sprout::to_string(
+#include "../../../example/brainfuck/hello.bf"
+				)));
+			unsigned char const ident[] = { 0x7f, 'E', 'L', 'F', 2, 1, 1 };
+			TESTSPR_ASSERT(sprout::equal(ident, ident + sizeof(ident), elf.begin()));
+			TESTSPR_ASSERT(elf[18] == 0x3e);
+			// entry point right after the headers
+			TESTSPR_ASSERT(elf[24] == 0xb0 && elf[25] == 0x00 && elf[26] == 0x40 && elf[27] == 0x00);
+			// the program follows the runtime stubs and is called from _start
+			TESTSPR_ASSERT(elf.size() == 264 + body.size());
+			TESTSPR_ASSERT(sprout::equal(body.begin(), body.end(), elf.begin() + 264));
+			TESTSPR_ASSERT(elf[186] == 0xe8 && elf[187] == 73);
+			// p_filesz of the text segment
+			TESTSPR_ASSERT(elf[64 + 32] == (elf.size() & 0xff) && elf[64 + 33] == (elf.size() >> 8));
+		}
+		{
+			// errors
+			int thrown = 0;
+			try {
+				sprout::brainfuck::x86_64::assemble<16>(sprout::brainfuck::compile_range<16>(sprout::to_string("+>+>+")));
+			} catch (std::length_error const&) {
+				++thrown;
+			}
+			TESTSPR_ASSERT(thrown == 1);
+		}
+	}
+}	// namespace testspr
+
+#ifndef TESTSPR_CPP_INCLUDE
+#	define TESTSPR_TEST_FUNCTION testspr::x86_64_test
+#	include <testspr/include_main.hpp>
+#endif
+
+#endif	// #ifndef SPROUT_LIBS_BRAINFUCK_TEST_X86_64_CPP
@@ -0,0 +1,89 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+//
+// Formatting throughput for doubles and floats:
+//   - sprout::to_chars (shortest round trip)
+//   - sprout::float_to_string_shortest
+//   - sprout::float_to_string (fixed six places, not round trip)
+//   - snprintf("%.17g") (round trip, not shortest)
+//
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+#include <chrono>
+#include <iostream>
+#include <sprout/charconv.hpp>
+#include <sprout/string.hpp>
+
+namespace {
+	template<typename FloatType>
+	std::vector<FloatType> make_values(std::size_t n) {
+		std::mt19937_64 rng(42);
+		std::uniform_real_distribution<double> mantissa(1, 10);
+		std::uniform_int_distribution<int> exponent(-20, 20);
+		std::vector<FloatType> values;
+		for (std::size_t i = 0; i != n; ++i) {
+			values.push_back(static_cast<FloatType>(mantissa(rng) * std::pow(10.0, exponent(rng))));
+		}
+		return values;
+	}
+
+	template<typename FloatType, typename Format>
+	void measure(char const* name, std::vector<FloatType> const& values, Format format) {
+		char buf[512];
+		std::size_t bytes = 0;
+		std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+		for (std::size_t i = 0; i != values.size(); ++i) {
+			bytes += format(buf, buf + sizeof(buf), values[i]);
+		}
+		std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+		std::cout << "  " << name << ": " << elapsed.count() * 1e9 / values.size() << " ns/value, "
+			<< values.size() / elapsed.count() / 1e6 << " M values/s (" << bytes / values.size() << " chars)" << std::endl;
+	}
+
+	struct to_chars_format {
+		template<typename FloatType>
+		std::size_t operator()(char* first, char* last, FloatType val) const {
+			return static_cast<std::size_t>(sprout::to_chars(first, last, val).ptr - first);
+		}
+	};
+	struct shortest_string_format {
+		template<typename FloatType>
+		std::size_t operator()(char*, char*, FloatType val) const {
+			return sprout::float_to_string_shortest<char>(val).size();
+		}
+	};
+	struct fixed_string_format {
+		template<typename FloatType>
+		std::size_t operator()(char*, char*, FloatType val) const {
+			return sprout::float_to_string<char>(val).size();
+		}
+	};
+	struct snprintf_format {
+		template<typename FloatType>
+		std::size_t operator()(char* first, char* last, FloatType val) const {
+			return static_cast<std::size_t>(std::snprintf(first, last - first, "%.*g", std::numeric_limits<FloatType>::max_digits10, static_cast<double>(val)));
+		}
+	};
+
+	template<typename FloatType>
+	void run(char const* type_name, std::size_t n) {
+		std::vector<FloatType> const values = make_values<FloatType>(n);
+		std::cout << type_name << " (" << n << " values):" << std::endl;
+		measure("sprout::to_chars", values, to_chars_format());
+		measure("sprout::float_to_string_shortest", values, shortest_string_format());
+		measure("sprout::float_to_string", values, fixed_string_format());
+		measure("snprintf %.17g/%.9g", values, snprintf_format());
+	}
+}	// anonymous-namespace
+
+int main() {
+	run<double>("double", 1000000);
+	run<float>("float", 1000000);
+}
@@ -0,0 +1,105 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+//
+// Parsing throughput for shortest round-trip doubles and for integers:
+//   - sprout::from_chars (correctly rounded)
+//   - sprout::str_to_float (dispatches to the same parser at runtime)
+//   - std::strtod
+//   - sprout::str_to_int against std::strtoll
+//
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <iostream>
+#include <sprout/charconv.hpp>
+#include <sprout/cstdlib.hpp>
+
+namespace {
+	std::vector<std::string> make_float_strings(std::size_t n) {
+		std::mt19937_64 rng(42);
+		std::uniform_real_distribution<double> mantissa(1, 10);
+		std::uniform_int_distribution<int> exponent(-20, 20);
+		std::vector<std::string> strings;
+		char buf[32];
+		for (std::size_t i = 0; i != n; ++i) {
+			double const val = mantissa(rng) * std::pow(10.0, exponent(rng));
+			strings.push_back(std::string(buf, sprout::to_chars(buf, buf + sizeof(buf), val).ptr));
+		}
+		return strings;
+	}
+	std::vector<std::string> make_int_strings(std::size_t n) {
+		std::mt19937_64 rng(42);
+		std::vector<std::string> strings;
+		for (std::size_t i = 0; i != n; ++i) {
+			long long const val = static_cast<long long>(rng() >> (rng() % 63));
+			strings.push_back(std::to_string(i % 2 ? -val : val));
+		}
+		return strings;
+	}
+
+	template<typename Parse>
+	void measure(char const* name, std::vector<std::string> const& strings, Parse parse) {
+		std::size_t bytes = 0;
+		for (std::size_t i = 0; i != strings.size(); ++i) {
+			bytes += strings[i].size();
+		}
+		double sum = 0;
+		std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+		for (std::size_t i = 0; i != strings.size(); ++i) {
+			sum += parse(strings[i]);
+		}
+		std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+		std::cout << "  " << name << ": " << elapsed.count() * 1e9 / strings.size() << " ns/value, "
+			<< bytes / elapsed.count() / 1e6 << " MB/s (checksum " << sum << ")" << std::endl;
+	}
+
+	struct from_chars_parse {
+		double operator()(std::string const& s) const {
+			double val = 0;
+			sprout::from_chars(s.data(), s.data() + s.size(), val);
+			return val;
+		}
+	};
+	struct str_to_float_parse {
+		double operator()(std::string const& s) const {
+			return sprout::str_to_float<double>(s.c_str());
+		}
+	};
+	struct strtod_parse {
+		double operator()(std::string const& s) const {
+			return std::strtod(s.c_str(), 0);
+		}
+	};
+	struct str_to_int_parse {
+		double operator()(std::string const& s) const {
+			return static_cast<double>(sprout::str_to_int<long long>(s.c_str()));
+		}
+	};
+	struct strtoll_parse {
+		double operator()(std::string const& s) const {
+			return static_cast<double>(std::strtoll(s.c_str(), 0, 10));
+		}
+	};
+}	// anonymous-namespace
+
+int main() {
+	std::size_t const n = 1000000;
+	std::vector<std::string> const floats = make_float_strings(n);
+	std::cout << "double (" << n << " shortest round-trip strings):" << std::endl;
+	measure("sprout::from_chars", floats, from_chars_parse());
+	measure("sprout::str_to_float", floats, str_to_float_parse());
+	measure("std::strtod", floats, strtod_parse());
+	std::vector<std::string> const ints = make_int_strings(n);
+	std::cout << "long long (" << n << " strings):" << std::endl;
+	measure("sprout::str_to_int", ints, str_to_int_parse());
+	measure("std::strtoll", ints, strtoll_parse());
+}
@@ -0,0 +1,90 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+//
+// Formatting throughput for 32-bit and 64-bit integers of mixed lengths:
+//   - sprout::to_chars (two digits per division, into a caller buffer)
+//   - sprout::int_to_string (the same digits into a basic_string)
+//   - digit by digit, as int_to_string evaluates in C++11 constant expressions
+//   - snprintf
+//
+#include <cstdio>
+#include <random>
+#include <vector>
+#include <chrono>
+#include <iostream>
+#include <sprout/charconv.hpp>
+#include <sprout/string.hpp>
+
+namespace {
+	template<typename IntType>
+	std::vector<IntType> make_values(std::size_t n) {
+		std::mt19937_64 rng(42);
+		std::vector<IntType> values;
+		for (std::size_t i = 0; i != n; ++i) {
+			// uniform in the number of bits, so that every length is common
+			IntType const val = static_cast<IntType>(rng() >> (rng() % 64));
+			values.push_back(i % 2 ? static_cast<IntType>(0 - val) : val);
+		}
+		return values;
+	}
+
+	template<typename IntType, typename Format>
+	void measure(char const* name, std::vector<IntType> const& values, Format format) {
+		char buf[64];
+		std::size_t bytes = 0;
+		std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+		for (std::size_t i = 0; i != values.size(); ++i) {
+			bytes += format(buf, buf + sizeof(buf), values[i]);
+		}
+		std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+		std::cout << "  " << name << ": " << elapsed.count() * 1e9 / values.size() << " ns/value, "
+			<< values.size() / elapsed.count() / 1e6 << " M values/s (" << bytes / values.size() << " chars)" << std::endl;
+	}
+
+	struct to_chars_format {
+		template<typename IntType>
+		std::size_t operator()(char* first, char* last, IntType val) const {
+			return static_cast<std::size_t>(sprout::to_chars(first, last, val).ptr - first);
+		}
+	};
+	struct int_to_string_format {
+		template<typename IntType>
+		std::size_t operator()(char*, char*, IntType val) const {
+			return sprout::int_to_string<char>(val).size();
+		}
+	};
+	struct by_digit_format {
+		template<typename IntType>
+		std::size_t operator()(char*, char*, IntType val) const {
+			return sprout::detail::int_to_string_by_digit<char, 10>(val).size();
+		}
+	};
+	struct snprintf_format {
+		std::size_t operator()(char* first, char* last, int val) const {
+			return static_cast<std::size_t>(std::snprintf(first, last - first, "%d", val));
+		}
+		std::size_t operator()(char* first, char* last, long long val) const {
+			return static_cast<std::size_t>(std::snprintf(first, last - first, "%lld", val));
+		}
+	};
+
+	template<typename IntType>
+	void run(char const* type_name, std::size_t n) {
+		std::vector<IntType> const values = make_values<IntType>(n);
+		std::cout << type_name << " (" << n << " values):" << std::endl;
+		measure("sprout::to_chars", values, to_chars_format());
+		measure("sprout::int_to_string", values, int_to_string_format());
+		measure("digit by digit", values, by_digit_format());
+		measure("snprintf", values, snprintf_format());
+	}
+}	// anonymous-namespace
+
+int main() {
+	run<int>("32-bit", 1000000);
+	run<long long>("64-bit", 1000000);
+}
@@ -0,0 +1,178 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_LIBS_CHARCONV_TEST_FROM_CHARS_CPP
+#define SPROUT_LIBS_CHARCONV_TEST_FROM_CHARS_CPP
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <climits>
+#include <limits>
+#include <random>
+#include <string>
+#include <system_error>
+#include <sprout/charconv.hpp>
+#include <sprout/cstdlib.hpp>
+#include <testspr/tools.hpp>
+
+namespace testspr {
+	namespace from_chars_detail {
+		template<typename FloatType>
+		inline bool same_bits(FloatType lhs, FloatType rhs) {
+			return std::memcmp(&lhs, &rhs, sizeof(FloatType)) == 0;
+		}
+		// matches strtod/strtof, including where parsing stops
+		inline bool from_chars_matches(std::string const& s) {
+			double d = 0;
+			sprout::from_chars_result const rd = sprout::from_chars(s.data(), s.data() + s.size(), d);
+			char* end = 0;
+			double const ed = std::strtod(s.c_str(), &end);
+			float f = 0;
+			sprout::from_chars_result const rf = sprout::from_chars(s.data(), s.data() + s.size(), f);
+			float const ef = std::strtof(s.c_str(), 0);
+			return rd.ptr == end
+				&& (rd.ec == std::errc() ? same_bits(d, ed) : rd.ec == std::errc::result_out_of_range && (ed - ed != 0 || ed == 0))
+				&& (rf.ec == std::errc() ? same_bits(f, ef) : rf.ec == std::errc::result_out_of_range && (ef - ef != 0 || ef == 0))
+				;
+		}
+	}	// namespace from_chars_detail
+
+	static void from_chars_test() {
+		using namespace sprout;
+		using testspr::from_chars_detail::same_bits;
+		using testspr::from_chars_detail::from_chars_matches;
+		{
+			char const str[] = "1.5e3xyz";
+			double d = 0;
+			sprout::from_chars_result const r = sprout::from_chars(str, str + sizeof(str) - 1, d);
+			TESTSPR_ASSERT(r.ec == std::errc());
+			TESTSPR_ASSERT(r.ptr == str + 5);
+			TESTSPR_ASSERT(d == 1500);
+		}
+		{
+			// exactly representable, halfway and long inputs
+			TESTSPR_ASSERT(from_chars_matches("0"));
+			TESTSPR_ASSERT(from_chars_matches("-0"));
+			TESTSPR_ASSERT(from_chars_matches("0.1"));
+			TESTSPR_ASSERT(from_chars_matches(".5"));
+			TESTSPR_ASSERT(from_chars_matches("1."));
+			TESTSPR_ASSERT(from_chars_matches("1e"));
+			TESTSPR_ASSERT(from_chars_matches("1e+"));
+			TESTSPR_ASSERT(from_chars_matches("9007199254740993"));
+			TESTSPR_ASSERT(from_chars_matches("9007199254740993.0000000000000000001"));
+			TESTSPR_ASSERT(from_chars_matches("1.7976931348623157e308"));
+			TESTSPR_ASSERT(from_chars_matches("1.7976931348623158e308"));
+			TESTSPR_ASSERT(from_chars_matches("2.2250738585072011e-308"));
+			TESTSPR_ASSERT(from_chars_matches("2.4703282292062327e-324"));
+			TESTSPR_ASSERT(from_chars_matches("2.4703282292062328e-324"));
+			TESTSPR_ASSERT(from_chars_matches("3.4028235677973366e38"));
+			TESTSPR_ASSERT(from_chars_matches("7.0064923216240854e-46"));
+			TESTSPR_ASSERT(from_chars_matches("0.000000000000000000000000000000000000000000000000000001e54"));
+			TESTSPR_ASSERT(from_chars_matches("123456789012345678901234567890e-10"));
+			TESTSPR_ASSERT(from_chars_matches(std::string(800, '9') + "e-500"));
+			TESTSPR_ASSERT(from_chars_matches("1" + std::string(780, '0') + "1e-780"));
+		}
+		{
+			// out of range leaves the value alone
+			double d = 42;
+			std::string const big = "1e400";
+			sprout::from_chars_result const r1 = sprout::from_chars(big.data(), big.data() + big.size(), d);
+			TESTSPR_ASSERT(r1.ec == std::errc::result_out_of_range);
+			TESTSPR_ASSERT(r1.ptr == big.data() + big.size());
+			TESTSPR_ASSERT(d == 42);
+			std::string const small = "-1e-400";
+			sprout::from_chars_result const r2 = sprout::from_chars(small.data(), small.data() + small.size(), d);
+			TESTSPR_ASSERT(r2.ec == std::errc::result_out_of_range);
+			TESTSPR_ASSERT(d == 42);
+		}
+		{
+			// invalid input and special values
+			char const* const invalid[] = {"", "-", "+1", " 1", ".", "e5", "x"};
+			for (std::size_t i = 0; i != sizeof(invalid) / sizeof(invalid[0]); ++i) {
+				double d = 42;
+				sprout::from_chars_result const r = sprout::from_chars(invalid[i], invalid[i] + std::strlen(invalid[i]), d);
+				TESTSPR_ASSERT(r.ec == std::errc::invalid_argument);
+				TESTSPR_ASSERT(r.ptr == invalid[i]);
+				TESTSPR_ASSERT(d == 42);
+			}
+			TESTSPR_ASSERT(from_chars_matches("inf"));
+			TESTSPR_ASSERT(from_chars_matches("-Infinity"));
+			TESTSPR_ASSERT(from_chars_matches("infinit"));
+			double d = 0;
+			std::string const nan = "nan(0x1f)";
+			sprout::from_chars_result const r = sprout::from_chars(nan.data(), nan.data() + nan.size(), d);
+			TESTSPR_ASSERT(r.ec == std::errc());
+			TESTSPR_ASSERT(r.ptr == nan.data() + nan.size());
+			TESTSPR_ASSERT(d != d);
+		}
+		{
+			// random doubles printed at various precisions, and exact halfway points
+			std::mt19937_64 rng(12345);
+			char buf[1024];
+			for (int i = 0; i != 20000; ++i) {
+				std::uint64_t const bits = rng();
+				double val = 0;
+				std::memcpy(&val, &bits, sizeof(val));
+				if (!(val == val) || val - val != 0) {
+					continue;
+				}
+				std::snprintf(buf, sizeof(buf), "%.*g", static_cast<int>(rng() % 19) + 1, val);
+				TESTSPR_ASSERT(from_chars_matches(buf));
+			}
+			for (int i = 0; i != 200; ++i) {
+				double val = 0;
+				std::uint64_t const bits = rng() % UINT64_C(0x7FEFFFFFFFFFFFFF);
+				std::memcpy(&val, &bits, sizeof(val));
+				long double const halfway = (static_cast<long double>(val) + std::nextafter(val, std::numeric_limits<double>::infinity())) / 2;
+				if (std::numeric_limits<long double>::digits > 53) {
+					std::snprintf(buf, sizeof(buf), "%.780Le", halfway);
+					TESTSPR_ASSERT(from_chars_matches(buf));
+				}
+			}
+		}
+		{
+			TESTSPR_ASSERT(same_bits(sprout::str_to_float<double>("  +1.5e-3"), 1.5e-3));
+			TESTSPR_ASSERT(same_bits(sprout::str_to_float<double>("-1e999"), -std::numeric_limits<double>::infinity()));
+			TESTSPR_ASSERT(same_bits(sprout::str_to_float<float>("0.1"), 0.1f));
+			TESTSPR_ASSERT(sprout::str_to_float<double>("+-1") == 0);
+			TESTSPR_ASSERT(sprout::str_to_int<int>("-2147483647") == -2147483647);
+			TESTSPR_ASSERT(sprout::str_to_int<int>("-2147483648") == INT_MIN);
+			TESTSPR_ASSERT(sprout::str_to_int<int>("2147483648") == INT_MAX);
+			TESTSPR_ASSERT(sprout::str_to_int<long long>("  +1234567890123456789x") == 1234567890123456789LL);
+			TESTSPR_ASSERT(sprout::str_to_int<long long>("-9223372036854775808") == LLONG_MIN);
+			TESTSPR_ASSERT(sprout::str_to_int<unsigned long long>("18446744073709551615") == ULLONG_MAX);
+			TESTSPR_ASSERT(sprout::str_to_int<int>("0x1f", 0) == 31);
+		}
+		{
+			SPROUT_STATIC_CONSTEXPR double d = sprout::str_to_float<double>("-2.5E2");
+			TESTSPR_BOTH_ASSERT(d == -250);
+			SPROUT_STATIC_CONSTEXPR double d2 = sprout::str_to_float<double>("1.5e-3");
+			TESTSPR_BOTH_ASSERT(d2 > 0.0014 && d2 < 0.0016);
+			SPROUT_STATIC_CONSTEXPR int i = sprout::str_to_int<int>("-2147483647");
+			TESTSPR_BOTH_ASSERT(i == -2147483647);
+		}
+#ifndef SPROUT_CONFIG_DISABLE_CXX14_CONSTEXPR
+		{
+			SPROUT_STATIC_CONSTEXPR double d1 = sprout::str_to_float<double>("0.1000000000000000055511151231257827021181583404541015625");
+			TESTSPR_BOTH_ASSERT(d1 == 0.1);
+			SPROUT_STATIC_CONSTEXPR double d2 = sprout::str_to_float<double>("4.9406564584124654e-324");
+			TESTSPR_BOTH_ASSERT(d2 == 4.9406564584124654e-324);
+			SPROUT_STATIC_CONSTEXPR float f1 = sprout::str_to_float<float>("3.4028235e38");
+			TESTSPR_BOTH_ASSERT(f1 == 3.4028235e38f);
+		}
+#endif
+	}
+}	// namespace testspr
+
+#ifndef TESTSPR_CPP_INCLUDE
+#	define TESTSPR_TEST_FUNCTION testspr::from_chars_test
+#	include <testspr/include_main.hpp>
+#endif
+
+#endif	// #ifndef SPROUT_LIBS_CHARCONV_TEST_FROM_CHARS_CPP
@@ -0,0 +1,169 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_LIBS_CHARCONV_TEST_TO_CHARS_CPP
+#define SPROUT_LIBS_CHARCONV_TEST_TO_CHARS_CPP
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <climits>
+#include <limits>
+#include <random>
+#include <string>
+#include <system_error>
+#include <sprout/charconv.hpp>
+#include <sprout/string.hpp>
+#include <testspr/tools.hpp>
+
+namespace testspr {
+	namespace to_chars_detail {
+		template<typename T>
+		inline std::string to_chars_string(T val) {
+			char buf[72] = {};
+			sprout::to_chars_result const r = sprout::to_chars(buf, buf + sizeof(buf), val);
+			return r.ec == std::errc() ? std::string(buf, r.ptr) : std::string("(error)");
+		}
+		template<typename IntType>
+		inline std::string to_chars_string(IntType val, int base) {
+			char buf[72] = {};
+			sprout::to_chars_result const r = sprout::to_chars(buf, buf + sizeof(buf), val, base);
+			return r.ec == std::errc() ? std::string(buf, r.ptr) : std::string("(error)");
+		}
+	}	// namespace to_chars_detail
+
+	static void to_chars_test() {
+		using namespace sprout;
+		using testspr::to_chars_detail::to_chars_string;
+		{
+			// shortest digits, %f or %e form whichever is shorter
+			TESTSPR_ASSERT(to_chars_string(0.0) == "0");
+			TESTSPR_ASSERT(to_chars_string(-0.0) == "-0");
+			TESTSPR_ASSERT(to_chars_string(1.0) == "1");
+			TESTSPR_ASSERT(to_chars_string(0.1) == "0.1");
+			TESTSPR_ASSERT(to_chars_string(0.3) == "0.3");
+			TESTSPR_ASSERT(to_chars_string(-123.456) == "-123.456");
+			TESTSPR_ASSERT(to_chars_string(100.0) == "100");
+			TESTSPR_ASSERT(to_chars_string(0.001) == "0.001");
+			TESTSPR_ASSERT(to_chars_string(1e-4) == "1e-04");
+			TESTSPR_ASSERT(to_chars_string(1e15) == "1e+15");
+			TESTSPR_ASSERT(to_chars_string(1e22) == "1e+22");
+			TESTSPR_ASSERT(to_chars_string(1e23) == "1e+23");
+			TESTSPR_ASSERT(to_chars_string(9007199254740992.0) == "9007199254740992");
+			TESTSPR_ASSERT(to_chars_string(5e-324) == "5e-324");
+			TESTSPR_ASSERT(to_chars_string(2.2250738585072014e-308) == "2.2250738585072014e-308");
+			TESTSPR_ASSERT(to_chars_string(std::numeric_limits<double>::max()) == "1.7976931348623157e+308");
+			TESTSPR_ASSERT(to_chars_string(std::numeric_limits<double>::infinity()) == "inf");
+			TESTSPR_ASSERT(to_chars_string(-std::numeric_limits<double>::infinity()) == "-inf");
+			TESTSPR_ASSERT(to_chars_string(std::numeric_limits<double>::quiet_NaN()) == "nan");
+
+			TESTSPR_ASSERT(to_chars_string(0.1f) == "0.1");
+			TESTSPR_ASSERT(to_chars_string(0.3f) == "0.3");
+			TESTSPR_ASSERT(to_chars_string(16777216.0f) == "16777216");
+			TESTSPR_ASSERT(to_chars_string(std::numeric_limits<float>::max()) == "3.4028235e+38");
+			TESTSPR_ASSERT(to_chars_string(std::numeric_limits<float>::denorm_min()) == "1e-45");
+		}
+		{
+			// buffer too small
+			char buf[4] = {'x', 'x', 'x', 'x'};
+			sprout::to_chars_result const r = sprout::to_chars(buf, buf + 4, 0.125);
+			TESTSPR_ASSERT(r.ec == std::errc::value_too_large);
+			TESTSPR_ASSERT(r.ptr == buf + 4);
+			TESTSPR_ASSERT(buf[0] == 'x');
+			sprout::to_chars_result const r2 = sprout::to_chars(buf, buf + 4, 0.25);
+			TESTSPR_ASSERT(r2.ec == std::errc());
+			TESTSPR_ASSERT(r2.ptr == buf + 4);
+		}
+		{
+			// round trip
+			std::mt19937_64 rng(12345);
+			for (int i = 0; i != 20000; ++i) {
+				std::uint64_t const bits = rng();
+				double val = 0;
+				std::memcpy(&val, &bits, sizeof(val));
+				if (!(val == val) || val - val != 0) {
+					continue;
+				}
+				std::string const s = to_chars_string(val);
+				TESTSPR_ASSERT(std::strtod(s.c_str(), 0) == val);
+			}
+			for (int i = 0; i != 20000; ++i) {
+				std::uint32_t const bits = static_cast<std::uint32_t>(rng());
+				float val = 0;
+				std::memcpy(&val, &bits, sizeof(val));
+				if (!(val == val) || val - val != 0) {
+					continue;
+				}
+				std::string const s = to_chars_string(val);
+				TESTSPR_ASSERT(std::strtof(s.c_str(), 0) == val);
+			}
+		}
+		{
+			// integers
+			TESTSPR_ASSERT(to_chars_string(0) == "0");
+			TESTSPR_ASSERT(to_chars_string(-7) == "-7");
+			TESTSPR_ASSERT(to_chars_string(INT_MIN) == "-2147483648");
+			TESTSPR_ASSERT(to_chars_string(LLONG_MIN) == "-9223372036854775808");
+			TESTSPR_ASSERT(to_chars_string(ULLONG_MAX) == "18446744073709551615");
+			TESTSPR_ASSERT(to_chars_string(static_cast<signed char>(-128)) == "-128");
+			TESTSPR_ASSERT(to_chars_string(255, 16) == "ff");
+			TESTSPR_ASSERT(to_chars_string(-255, 2) == "-11111111");
+			TESTSPR_ASSERT(to_chars_string(35u, 36) == "z");
+			char buf[4] = {'x', 'x', 'x', 'x'};
+			sprout::to_chars_result const r = sprout::to_chars(buf, buf + 3, -123);
+			TESTSPR_ASSERT(r.ec == std::errc::value_too_large);
+			TESTSPR_ASSERT(r.ptr == buf + 3);
+			TESTSPR_ASSERT(buf[0] == 'x');
+			sprout::to_chars_result const r2 = sprout::to_chars(buf, buf + 4, -123);
+			TESTSPR_ASSERT(r2.ec == std::errc());
+			TESTSPR_ASSERT(std::string(buf, r2.ptr) == "-123");
+
+			std::mt19937_64 rng(54321);
+			char ref[32] = {};
+			for (int i = 0; i != 20000; ++i) {
+				long long const val = static_cast<long long>(rng() >> (rng() % 64)) * (i % 2 ? -1 : 1);
+				std::snprintf(ref, sizeof(ref), "%lld", val);
+				TESTSPR_ASSERT(to_chars_string(val) == ref);
+				TESTSPR_ASSERT(sprout::to_string(val) == ref);
+				std::snprintf(ref, sizeof(ref), "%d", static_cast<int>(val));
+				TESTSPR_ASSERT(sprout::to_string(static_cast<int>(val)) == ref);
+				std::snprintf(ref, sizeof(ref), "%llx", static_cast<unsigned long long>(val));
+				TESTSPR_ASSERT(to_chars_string(static_cast<unsigned long long>(val), 16) == ref);
+			}
+		}
+		{
+			SPROUT_STATIC_CONSTEXPR auto s1 = sprout::to_string(-1234567);
+			TESTSPR_BOTH_ASSERT(s1 == "-1234567");
+			SPROUT_STATIC_CONSTEXPR auto s2 = sprout::to_string(ULLONG_MAX);
+			TESTSPR_BOTH_ASSERT(s2 == "18446744073709551615");
+			SPROUT_STATIC_CONSTEXPR auto s3 = sprout::int_to_string<char, 16>(-255);
+			TESTSPR_BOTH_ASSERT(s3 == "-ff");
+		}
+		{
+			TESTSPR_ASSERT(sprout::float_to_string_shortest<char>(-2.5e-310) == "-2.5e-310");
+			TESTSPR_ASSERT(sprout::float_to_string_shortest<wchar_t>(0.3f) == L"0.3");
+			TESTSPR_ASSERT((sprout::float_to_string_shortest<char>(1.0).max_size() == sprout::printed_float_shortest_digits<double>::value));
+		}
+#ifndef SPROUT_CONFIG_DISABLE_CXX14_CONSTEXPR
+		{
+			SPROUT_STATIC_CONSTEXPR auto s1 = sprout::float_to_string_shortest<char>(0.1);
+			TESTSPR_BOTH_ASSERT(s1 == "0.1");
+			SPROUT_STATIC_CONSTEXPR auto s2 = sprout::float_to_string_shortest<char>(-1.7976931348623157e308);
+			TESTSPR_BOTH_ASSERT(s2 == "-1.7976931348623157e+308");
+			SPROUT_STATIC_CONSTEXPR auto s3 = sprout::float_to_string_shortest<char>(1e-7f);
+			TESTSPR_BOTH_ASSERT(s3 == "1e-07");
+		}
+#endif
+	}
+}	// namespace testspr
+
+#ifndef TESTSPR_CPP_INCLUDE
+#	define TESTSPR_TEST_FUNCTION testspr::to_chars_test
+#	include <testspr/include_main.hpp>
+#endif
+
+#endif	// #ifndef SPROUT_LIBS_CHARCONV_TEST_TO_CHARS_CPP
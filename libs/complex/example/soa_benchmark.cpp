@@ -0,0 +1,79 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+//
+// Time of a spectral multiply-accumulate (y = x * h + y) and of the magnitude
+// and phase over 4096 bins, on std::vector<sprout::complex<double>> with the
+// scalar operators and on real and imaginary planes with the bulk operations:
+//
+//	g++ -std=c++11 -O2 -mavx2 -mfma -I. libs/complex/example/soa_benchmark.cpp
+//
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <vector>
+#include <sprout/complex.hpp>
+
+namespace {
+	template<typename F>
+	double time(F f) {
+		std::size_t const repeat = 2000;
+		std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+		for (std::size_t i = 0; i != repeat; ++i) {
+			f();
+		}
+		std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+		return elapsed.count() / repeat * 1e6;
+	}
+}	// anonymous-namespace
+
+int main() {
+	typedef sprout::complex<double> complex_type;
+	std::size_t const n = 4096;
+	std::mt19937 gen(1);
+	std::uniform_real_distribution<double> dist(-1, 1);
+
+	std::vector<complex_type> x(n), h(n), y(n);
+	std::vector<double> xr(n), xi(n), hr(n), hi(n), yr(n), yi(n);
+	for (std::size_t i = 0; i != n; ++i) {
+		x[i] = complex_type(xr[i] = dist(gen), xi[i] = dist(gen));
+		h[i] = complex_type(hr[i] = dist(gen), hi[i] = dist(gen));
+	}
+	std::vector<double> mag(n), phase(n);
+	sprout::complex_soa_span<double const> const xs(xr.data(), xi.data(), n);
+	sprout::complex_soa_span<double const> const hs(hr.data(), hi.data(), n);
+	sprout::complex_soa_span<double> const ys(yr.data(), yi.data(), n);
+
+	double const aos_madd = time([&] {
+		for (std::size_t i = 0; i != n; ++i) {
+			y[i] = x[i] * h[i] + y[i];
+		}
+	});
+	double const soa_madd = time([&] {
+		sprout::cmadd(xs, hs, ys, ys);
+	});
+	double const aos_polar = time([&] {
+		for (std::size_t i = 0; i != n; ++i) {
+			mag[i] = sprout::abs(y[i]);
+			phase[i] = sprout::arg(y[i]);
+		}
+	});
+	double const soa_polar = time([&] {
+		sprout::abs(ys, mag.data());
+		sprout::arg(ys, phase.data());
+	});
+	std::cout
+		<< "multiply-accumulate\n"
+		<< "\tcomplex array\t" << aos_madd << " us\n"
+		<< "\tcomplex_soa\t" << soa_madd << " us\n"
+		<< "abs and arg\n"
+		<< "\tcomplex array\t" << aos_polar << " us\n"
+		<< "\tcomplex_soa\t" << soa_polar << " us\n"
+		<< "\tcheck " << y[n / 2].real() - yr[n / 2] + mag[0] + phase[0] << std::endl
+		;
+}
@@ -0,0 +1,150 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_LIBS_COMPLEX_TEST_SOA_CPP
+#define SPROUT_LIBS_COMPLEX_TEST_SOA_CPP
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <sprout/array.hpp>
+#include <sprout/complex.hpp>
+#include <sprout/algorithm/equal.hpp>
+#include <sprout/numeric/accumulate.hpp>
+#include <testspr/tools.hpp>
+
+namespace testspr {
+	static void complex_soa_test() {
+		using namespace sprout;
+		typedef sprout::complex<double> complex_type;
+		{
+			SPROUT_STATIC_CONSTEXPR auto a = sprout::complex_soa<double, 5>{{1, 2, 3, -4, 0}, {4, 5, -6, 0, -2}};
+			SPROUT_STATIC_CONSTEXPR auto aos = sprout::array<complex_type, 5>{{
+				complex_type(1, 4), complex_type(2, 5), complex_type(3, -6), complex_type(-4, 0), complex_type(0, -2)
+				}};
+
+			// view
+			TESTSPR_BOTH_ASSERT(a.size() == 5);
+			TESTSPR_BOTH_ASSERT(a[2] == complex_type(3, -6));
+			TESTSPR_BOTH_ASSERT(a.end() - a.begin() == 5);
+			TESTSPR_BOTH_ASSERT(a.begin()[3] == complex_type(-4, 0));
+			TESTSPR_BOTH_ASSERT(sprout::equal(a.begin(), a.end(), aos.begin()));
+			TESTSPR_BOTH_ASSERT(sprout::accumulate(a.begin(), a.end(), complex_type()) == complex_type(2, 1));
+			TESTSPR_BOTH_ASSERT(sprout::make_complex_soa(aos) == a);
+		}
+		{
+			SPROUT_STATIC_CONSTEXPR auto a = sprout::complex_soa<double, 5>{{1, 2, 3, -4, 0}, {4, 5, -6, 0, -2}};
+			SPROUT_STATIC_CONSTEXPR auto b = sprout::complex_soa<double, 5>{{1, -1, 2, 3, 5}, {0, 1, -2, -1, 1}};
+
+			// cmul, cmadd, conj
+			{
+				SPROUT_STATIC_CONSTEXPR auto result = sprout::cmul(a, b);
+				TESTSPR_BOTH_ASSERT(result[1] == a[1] * b[1]);
+				TESTSPR_BOTH_ASSERT(result[3] == a[3] * b[3]);
+				TESTSPR_ASSERT(sprout::cmul(a, b) == result);
+			}
+			{
+				SPROUT_STATIC_CONSTEXPR auto result = sprout::cmadd(a, b, a);
+				TESTSPR_BOTH_ASSERT(result[2] == a[2] * b[2] + a[2]);
+				TESTSPR_BOTH_ASSERT(result[4] == a[4] * b[4] + a[4]);
+				TESTSPR_ASSERT(sprout::cmadd(a, b, a) == result);
+			}
+			{
+				SPROUT_STATIC_CONSTEXPR auto result = sprout::conj(a);
+				TESTSPR_BOTH_ASSERT(result[0] == complex_type(1, -4));
+				TESTSPR_BOTH_ASSERT(result[2] == complex_type(3, 6));
+				TESTSPR_ASSERT(sprout::conj(a) == result);
+			}
+
+			// norm, abs, arg
+			{
+				SPROUT_STATIC_CONSTEXPR auto result = sprout::norm(a);
+				TESTSPR_BOTH_ASSERT(result[0] == 17);
+				TESTSPR_BOTH_ASSERT(result[3] == 16);
+				TESTSPR_ASSERT(sprout::norm(a) == result);
+			}
+			{
+				SPROUT_STATIC_CONSTEXPR auto result = sprout::abs(a);
+				TESTSPR_BOTH_ASSERT(result[3] == 4);
+				TESTSPR_BOTH_ASSERT(result[4] == 2);
+				TESTSPR_ASSERT(sprout::abs(a) == result);
+			}
+			{
+				SPROUT_STATIC_CONSTEXPR auto result = sprout::arg(a);
+				TESTSPR_BOTH_ASSERT(result[3] == sprout::math::pi<double>());
+				TESTSPR_BOTH_ASSERT(result[4] == -sprout::math::half_pi<double>());
+				sprout::array<double, 5> const runtime = sprout::arg(a);
+				for (std::size_t i = 0; i != 5; ++i) {
+					TESTSPR_ASSERT(std::abs(runtime[i] - std::atan2(a.im[i], a.re[i])) <= 4e-15);
+				}
+			}
+		}
+		{
+			// spans: every block width and the scalar tail, in place
+			std::size_t const n = 37;
+			std::vector<double> ar(n), ai(n), br(n), bi(n), rr(n), ri(n), x(n);
+			for (std::size_t i = 0; i != n; ++i) {
+				ar[i] = static_cast<double>(i % 7) - 3;
+				ai[i] = static_cast<double>(i % 5) - 2;
+				br[i] = static_cast<double>(i % 3) + 1;
+				bi[i] = static_cast<double>(i % 11) - 5;
+			}
+			ar[9] = -0.0;
+			ai[9] = 0.0;
+			ar[10] = std::numeric_limits<double>::infinity();
+			ai[10] = 1.0;
+			sprout::complex_soa_span<double const> const a(ar.data(), ai.data(), n);
+			sprout::complex_soa_span<double const> const b(br.data(), bi.data(), n);
+			sprout::complex_soa_span<double> const r = sprout::make_complex_soa_span(rr.data(), ri.data(), n);
+
+			sprout::cmul(a, b, r);
+			for (std::size_t i = 0; i != n; ++i) {
+				TESTSPR_ASSERT(i == 10 || r[i] == a[i] * b[i]);
+			}
+			sprout::cmadd(a, b, r, r);
+			for (std::size_t i = 0; i != n; ++i) {
+				TESTSPR_ASSERT(i == 10 || r[i] == a[i] * b[i] + a[i] * b[i]);
+			}
+			sprout::conj(r, r);
+			for (std::size_t i = 0; i != n; ++i) {
+				TESTSPR_ASSERT(i == 10 || r[i] == sprout::conj(a[i] * b[i] + a[i] * b[i]));
+			}
+
+			TESTSPR_ASSERT(sprout::norm(a, x.data()) == x.data() + n);
+			for (std::size_t i = 0; i != n; ++i) {
+				TESTSPR_ASSERT(x[i] == ar[i] * ar[i] + ai[i] * ai[i]);
+			}
+			sprout::abs(a, x.data());
+			for (std::size_t i = 0; i != n; ++i) {
+				TESTSPR_ASSERT(x[i] == std::sqrt(ar[i] * ar[i] + ai[i] * ai[i]));
+			}
+			sprout::arg(a, x.data());
+			for (std::size_t i = 0; i != n; ++i) {
+				TESTSPR_ASSERT(std::abs(x[i] - std::atan2(ai[i], ar[i])) <= 4e-15);
+			}
+			TESTSPR_ASSERT(x[9] == sprout::math::pi<double>());
+			TESTSPR_ASSERT(x[10] == 0);
+
+			// in place over the real plane
+			std::vector<double> expected(n);
+			for (std::size_t i = 0; i != n; ++i) {
+				expected[i] = std::atan2(ri[i], rr[i]);
+			}
+			sprout::arg(r, rr.data());
+			for (std::size_t i = 0; i != n; ++i) {
+				TESTSPR_ASSERT(i == 10 || std::abs(rr[i] - expected[i]) <= 4e-15);
+			}
+		}
+	}
+}	// namespace testspr
+
+#ifndef TESTSPR_CPP_INCLUDE
+#	define TESTSPR_TEST_FUNCTION testspr::complex_soa_test
+#	include <testspr/include_main.hpp>
+#endif
+
+#endif	// #ifndef SPROUT_LIBS_COMPLEX_TEST_SOA_CPP
@@ -0,0 +1,73 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+//
+// Time of converting a 4410 sample block from 44.1 kHz to 48 kHz with the
+// 16 tap filter, with the resampled range and with the streaming resampler on
+// float and double, and how many times faster than real time each one runs:
+//
+//	g++ -std=c++11 -O2 -mavx2 -mfma -I. libs/compost/example/resampler_benchmark.cpp
+//
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+#include <sprout/compost/utility.hpp>
+#include <sprout/compost/effects.hpp>
+
+namespace {
+	template<typename F>
+	double time(F f) {
+		std::size_t const repeat = 2000;
+		std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+		for (std::size_t i = 0; i != repeat; ++i) {
+			f();
+		}
+		std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+		return elapsed.count() / repeat * 1e6;
+	}
+}	// anonymous-namespace
+
+int main() {
+	typedef sprout::compost::resample_filter<double, 44100, 48000> filter_type;
+	typedef sprout::compost::resample_filter<float, 44100, 48000> float_filter_type;
+	std::size_t const n = 4410;
+	double const block = n / 44100.0 * 1e6;
+
+	std::vector<double> in(n);
+	std::vector<float> in_float(n);
+	for (std::size_t i = 0; i != n; ++i) {
+		in_float[i] = static_cast<float>(in[i] = std::sin(0.05 * i));
+	}
+	std::size_t const m = sprout::compost::resampler<filter_type>::max_output_size(n);
+	std::vector<double> ref(m), out(m);
+	std::vector<float> out_float(m);
+	sprout::compost::resampler<filter_type> r;
+	sprout::compost::resampler<float_filter_type> r_float;
+
+	double const range = time([&] {
+		auto const resampled = in | sprout::compost::resampled(filter_type());
+		std::vector<double>::iterator result = ref.begin();
+		for (auto it = sprout::begin(resampled); it != sprout::end(resampled); ++it, ++result) {
+			*result = *it;
+		}
+	});
+	double const stream = time([&] {
+		r.process(in.begin(), in.end(), out.begin());
+	});
+	double const stream_float = time([&] {
+		r_float.process(in_float.begin(), in_float.end(), out_float.begin());
+	});
+	std::cout
+		<< n << " samples 44.1 kHz to 48 kHz (" << block << " us)\n"
+		<< "\tresampled\t" << range << " us\t" << block / range << "x real time\n"
+		<< "\tresampler\t" << stream << " us\t" << block / stream << "x real time\n"
+		<< "\tresampler float\t" << stream_float << " us\t" << block / stream_float << "x real time\n"
+		<< "\tcheck " << ref[m / 2] - out[m / 2] + out_float[m / 2] << std::endl
+		;
+}
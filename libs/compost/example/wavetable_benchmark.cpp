@@ -0,0 +1,73 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+//
+// Time of rendering a 64 frame block of 256 sawtooth voices from a 512 entry
+// float table, with wavetable_voice_bank and with one wavetable_value per voice,
+// and the number of such voices one core keeps up with at 48 kHz:
+//
+//	g++ -std=c++11 -O2 -mavx2 -mfma -I. libs/compost/example/wavetable_benchmark.cpp
+//
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+#include <sprout/compost/utility.hpp>
+#include <sprout/compost/waves.hpp>
+
+namespace {
+	template<typename F>
+	double time(F f) {
+		std::size_t const repeat = 2000;
+		std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+		for (std::size_t i = 0; i != repeat; ++i) {
+			f();
+		}
+		std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+		return elapsed.count() / repeat * 1e6;
+	}
+}	// anonymous-namespace
+
+int main() {
+	typedef sprout::compost::wavetable<sprout::compost::sawtooth_shape, float, 512> table_type;
+	typedef sprout::compost::wavetable_voice_bank<table_type, 256> bank_type;
+	typedef sprout::compost::wavetable_value<table_type, sprout::compost::wavetable_linear> value_type;
+	std::size_t const voices = bank_type::voices;
+	std::size_t const frames = 64;
+	double const rate = 48000;
+
+	bank_type bank;
+	std::vector<value_type> values;
+	for (std::size_t v = 0; v != voices; ++v) {
+		float const frequency = static_cast<float>((55 + 7.5 * v) / rate);
+		bank.set(v, frequency, 1.0f / voices);
+		values.push_back(value_type(frequency, 1.0f / voices, 0));
+	}
+	std::vector<float> out(frames), ref(frames);
+	std::size_t offset = 0;
+
+	double const per_value = time([&] {
+		for (std::size_t k = 0; k != frames; ++k) {
+			float sum = 0;
+			for (std::size_t v = 0; v != voices; ++v) {
+				sum += values[v](offset + k);
+			}
+			ref[k] = sum;
+		}
+		offset = (offset + frames) % 48000;
+	});
+	double const per_bank = time([&] {
+		bank.render(out.data(), frames);
+	});
+	double const block = frames / rate * 1e6;
+	std::cout
+		<< voices << " voices, " << frames << " frames (" << block << " us at 48 kHz)\n"
+		<< "\twavetable_value\t" << per_value << " us\t" << voices * block / per_value << " voices per core\n"
+		<< "\tvoice_bank\t" << per_bank << " us\t" << voices * block / per_bank << " voices per core\n"
+		<< "\tcheck " << out[0] + ref[0] << std::endl
+		;
+}
@@ -0,0 +1,107 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_LIBS_COMPOST_TEST_RESAMPLER_CPP
+#define SPROUT_LIBS_COMPOST_TEST_RESAMPLER_CPP
+
+#include <cmath>
+#include <vector>
+#include <sprout/array.hpp>
+#include <sprout/compost/utility.hpp>
+#include <sprout/compost/effects.hpp>
+#include <testspr/tools.hpp>
+
+namespace testspr {
+	namespace resampler_detail {
+		// process in blocks of 1, 2, 3, ... samples and flush
+		template<typename Filter>
+		std::vector<typename Filter::value_type>
+		stream(std::vector<typename Filter::value_type> const& in) {
+			typedef sprout::compost::resampler<Filter> resampler_type;
+			std::vector<typename Filter::value_type> out(resampler_type::max_output_size(in.size()) + Filter::taps);
+			resampler_type r;
+			typename std::vector<typename Filter::value_type>::iterator result = out.begin();
+			for (std::size_t i = 0, block = 1; i != in.size(); i += block, ++block) {
+				block = block < in.size() - i ? block : in.size() - i;
+				result = r.process(in.begin() + i, in.begin() + i + block, result);
+			}
+			out.erase(r.flush(result), out.end());
+			return out;
+		}
+		template<typename Filter>
+		void check(std::size_t n, double dc_tolerance) {
+			typedef typename Filter::value_type value_type;
+			std::vector<value_type> in(n, value_type(1));
+			std::vector<value_type> const out = stream<Filter>(in);
+			auto const range = in | sprout::compost::resampled(Filter());
+
+			// length
+			TESTSPR_ASSERT(Filter::output_size(n) == (n * Filter::out_rate + Filter::in_rate - 1) / Filter::in_rate);
+			TESTSPR_ASSERT(static_cast<std::size_t>(sprout::size(range)) == Filter::output_size(n));
+			TESTSPR_ASSERT(out.size() == Filter::output_size(n));
+
+			// DC gain, away from the edges of the input
+			std::size_t k = 0;
+			for (auto it = sprout::begin(range); it != sprout::end(range); ++it, ++k) {
+				TESTSPR_ASSERT(std::abs(*it - out[k]) < value_type(1e-6));
+				if (k * Filter::in_rate >= Filter::taps * Filter::out_rate && (k + 1) * Filter::in_rate + Filter::taps * Filter::out_rate <= n * Filter::out_rate) {
+					TESTSPR_ASSERT(std::abs(out[k] - 1) < dc_tolerance);
+				}
+			}
+		}
+	}	// namespace resampler_detail
+
+	static void resampler_test() {
+		typedef sprout::compost::resample_filter<double, 48000, 48000, 8> unity_type;
+		{
+			// unity ratio: one phase, the center tap alone
+			TESTSPR_BOTH_ASSERT(unity_type::up == 1 && unity_type::down == 1);
+			TESTSPR_BOTH_ASSERT(unity_type::output_size(5) == 5);
+			TESTSPR_BOTH_ASSERT(unity_type::coefficient(0, 3) > 0.999999 && unity_type::coefficient(0, 3) < 1.000001);
+			for (std::size_t k = 0; k != unity_type::taps; ++k) {
+				TESTSPR_ASSERT(k == 3 || std::abs(unity_type::coefficient(0, k)) < 1e-12);
+			}
+
+			SPROUT_STATIC_CONSTEXPR auto in = sprout::array<double, 5>{{0.5, -1, 0.25, 0.75, -0.125}};
+			SPROUT_STATIC_CONSTEXPR auto range = in | sprout::compost::resampled(unity_type());
+			TESTSPR_BOTH_ASSERT(sprout::size(range) == 5);
+			TESTSPR_BOTH_ASSERT(*sprout::begin(range) > 0.499999 && *sprout::begin(range) < 0.500001);
+			std::size_t k = 0;
+			for (auto it = sprout::begin(range); it != sprout::end(range); ++it, ++k) {
+				TESTSPR_ASSERT(std::abs(*it - in[k]) < 1e-12);
+			}
+
+			std::vector<double> signal(37);
+			for (std::size_t i = 0; i != signal.size(); ++i) {
+				signal[i] = std::sin(0.3 * i) + 0.25;
+			}
+			std::vector<double> const out = resampler_detail::stream<unity_type>(signal);
+			TESTSPR_ASSERT(out.size() == signal.size());
+			for (std::size_t i = 0; i != signal.size(); ++i) {
+				TESTSPR_ASSERT(std::abs(out[i] - signal[i]) < 1e-12);
+			}
+		}
+		{
+			// upsampling and downsampling: lengths, DC gain, streaming equals the range
+			resampler_detail::check<sprout::compost::resample_filter<double, 44100, 48000> >(441, 1e-3);
+			resampler_detail::check<sprout::compost::resample_filter<double, 44100, 48000> >(1000, 1e-3);
+			resampler_detail::check<sprout::compost::resample_filter<float, 44100, 48000> >(441, 1e-3);
+			resampler_detail::check<sprout::compost::resample_filter<double, 22050, 44100> >(101, 1e-3);
+			resampler_detail::check<sprout::compost::resample_filter<double, 48000, 44100> >(480, 1e-3);
+			resampler_detail::check<sprout::compost::resample_filter<double, 48000, 44100> >(1001, 1e-3);
+			resampler_detail::check<sprout::compost::resample_filter<double, 96000, 48000> >(101, 1e-3);
+			resampler_detail::check<sprout::compost::resample_filter<float, 96000, 48000, 32> >(256, 1e-3);
+		}
+	}
+}	// namespace testspr
+
+#ifndef TESTSPR_CPP_INCLUDE
+#	define TESTSPR_TEST_FUNCTION testspr::resampler_test
+#	include <testspr/include_main.hpp>
+#endif
+
+#endif	// #ifndef SPROUT_LIBS_COMPOST_TEST_RESAMPLER_CPP
@@ -0,0 +1,122 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_LIBS_COMPOST_TEST_WAVETABLE_CPP
+#define SPROUT_LIBS_COMPOST_TEST_WAVETABLE_CPP
+
+#include <cmath>
+#include <vector>
+#include <sprout/array.hpp>
+#include <sprout/compost/utility.hpp>
+#include <sprout/compost/waves.hpp>
+#include <testspr/tools.hpp>
+
+namespace testspr {
+	static void wavetable_test() {
+		typedef sprout::compost::wavetable<sprout::compost::sine_shape, double> sine_table;
+		typedef sprout::compost::wavetable<sprout::compost::sawtooth_shape, double, 64> saw_table;
+		typedef sprout::compost::wavetable<sprout::compost::sawtooth_shape, float, 512> saw_float_table;
+		double const pi = 3.14159265358979323846;
+		{
+			// levels: 64, 32, ..., 1 harmonics
+			TESTSPR_BOTH_ASSERT(sine_table::size == 256);
+			TESTSPR_BOTH_ASSERT(sine_table::levels == 7);
+			TESTSPR_BOTH_ASSERT(saw_table::levels == 5);
+			TESTSPR_BOTH_ASSERT(sine_table::table.size() == 7 * 256);
+			std::size_t const& levels = sine_table::levels;
+			TESTSPR_ASSERT(levels == 7);
+
+			// the finest level that does not alias
+			TESTSPR_BOTH_ASSERT(sine_table::level_for(0) == 0);
+			TESTSPR_BOTH_ASSERT(sine_table::level_for(1.0 / 128) == 0);
+			TESTSPR_BOTH_ASSERT(sine_table::level_for(1.0 / 64) == 1);
+			TESTSPR_BOTH_ASSERT(sine_table::level_for(-1.0 / 64) == 1);
+			TESTSPR_BOTH_ASSERT(sine_table::level_for(0.5) == 6);
+			TESTSPR_BOTH_ASSERT(sine_table::level_for(0.9) == 6);
+		}
+		{
+			// lookup: table entries are the truncated Fourier series
+			SPROUT_STATIC_CONSTEXPR double quarter = sine_table::linear_at(0, 0.25);
+			TESTSPR_BOTH_ASSERT(quarter > 0.999999 && quarter < 1.000001);
+			TESTSPR_ASSERT(std::abs(sine_table::cubic_at(3, 0.1) - std::sin(2 * pi * 0.1)) < 1e-4);
+			TESTSPR_ASSERT(std::abs(sine_table::linear_at(6, 1.75) + 1) < 1e-12);
+			for (std::size_t level = 0; level != saw_table::levels; ++level) {
+				for (std::size_t i = 0; i < saw_table::size; i += 5) {
+					double expected = 0;
+					for (std::size_t h = 1; h <= (saw_table::size / 4) >> level; ++h) {
+						expected += (h % 2 ? 2 : -2) / (pi * h) * std::sin(2 * pi * static_cast<double>(h * i % saw_table::size) / saw_table::size);
+					}
+					TESTSPR_ASSERT(std::abs(saw_table::table[level * saw_table::size + i] - expected) < 1e-9);
+					// at the sample points both interpolations return the entry, for any number of cycles
+					double const phase = static_cast<double>(i) / saw_table::size;
+					TESTSPR_ASSERT(std::abs(saw_table::linear_at(level, phase + 3) - saw_table::table[level * saw_table::size + i]) < 1e-9);
+					TESTSPR_ASSERT(std::abs(saw_table::cubic_at(level, phase - 2) - saw_table::table[level * saw_table::size + i]) < 1e-9);
+				}
+			}
+		}
+		{
+			// wavetable_wave plays the table with cubic interpolation
+			SPROUT_STATIC_CONSTEXPR auto wave = sprout::array<double, 16>{{}}
+				| sprout::compost::waves::wavetable_wave(sine_table(), 1.0 / 16, 0.5, 0.25);
+			TESTSPR_BOTH_ASSERT(wave.size() == 16);
+			TESTSPR_BOTH_ASSERT(*wave.begin() == 0.5 * sine_table::cubic_at(0, 0.25));
+			for (std::size_t i = 0; i != 16; ++i) {
+				TESTSPR_ASSERT(std::abs(wave.begin()[i] - 0.5 * std::cos(2 * pi * static_cast<double>(i) / 16)) < 1e-6);
+			}
+		}
+		{
+			// voice_bank: the sum of the voices, stopped voices keep their phase running
+			typedef sprout::compost::wavetable_voice_bank<saw_table, 3> bank_type;
+			std::size_t const frames = 37;
+			bank_type bank;
+			bank.set(0, 0.01, 0.5);
+			bank.set(1, 0.3, 0.25, 1.5);
+			bank.set(2, 0.02, 1);
+			bank.stop(2);
+			TESTSPR_ASSERT(bank.level(0) == 0 && bank.level(1) == 4);
+			TESTSPR_ASSERT(bank.phase(1) == 0.5);
+			std::vector<double> out(frames, 7.0);
+			bank.render(out.data(), frames);
+			for (std::size_t k = 0; k != frames; ++k) {
+				double const expected = 0.5 * saw_table::linear_at(0, 0.01 * k) + 0.25 * saw_table::linear_at(4, 0.5 + 0.3 * k);
+				TESTSPR_ASSERT(std::abs(out[k] - expected) < 1e-12);
+			}
+			TESTSPR_ASSERT(std::abs(bank.phase(0) - 0.37) < 1e-12);
+			TESTSPR_ASSERT(std::abs(bank.phase(2) - 0.74) < 1e-12);
+			// mix adds to what is there
+			std::vector<double> twice(out);
+			bank.set(0, 0.01, 0.5, 0);
+			bank.set(1, 0.3, 0.25, 0.5);
+			bank.mix(twice.data(), frames);
+			for (std::size_t k = 0; k != frames; ++k) {
+				TESTSPR_ASSERT(std::abs(twice[k] - 2 * out[k]) < 1e-12);
+			}
+		}
+		{
+			// the float linear bank (eight frames at a time with AVX2) against the table
+			typedef sprout::compost::wavetable_voice_bank<saw_float_table, 2> bank_type;
+			std::size_t const frames = 29;
+			bank_type bank;
+			bank.set(0, 440.0f / 48000, 0.5f);
+			bank.set(1, 0.1f, 0.25f, 0.75f);
+			std::vector<float> out(frames);
+			bank.render(out.data(), frames);
+			for (std::size_t k = 0; k != frames; ++k) {
+				float const expected = 0.5f * saw_float_table::linear_at(bank.level(0), 440.0f / 48000 * k)
+					+ 0.25f * saw_float_table::linear_at(bank.level(1), 0.75f + 0.1f * k);
+				TESTSPR_ASSERT(std::abs(out[k] - expected) < 1e-4f);
+			}
+		}
+	}
+}	// namespace testspr
+
+#ifndef TESTSPR_CPP_INCLUDE
+#	define TESTSPR_TEST_FUNCTION testspr::wavetable_test
+#	include <testspr/include_main.hpp>
+#endif
+
+#endif	// #ifndef SPROUT_LIBS_COMPOST_TEST_WAVETABLE_CPP
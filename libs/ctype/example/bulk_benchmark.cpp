@@ -0,0 +1,79 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+//
+// Lowercases, counts the whitespace of and checks for printable characters buffers of
+// HTTP header text from 1 KiB to 1 MiB, with the bulk sprout::ascii functions
+// and with per-character loops over sprout::ascii::tolower and the ctypes functors.
+//
+#include <string>
+#include <chrono>
+#include <iostream>
+#include <sprout/ctype/bulk.hpp>
+
+namespace {
+	template<typename F>
+	void measure(char const* name, std::size_t bytes, F f) {
+		std::size_t sink = 0;
+		std::size_t const rounds = (256u << 20) / bytes;
+		std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+		for (std::size_t r = 0; r != rounds; ++r) {
+			sink += f();
+		}
+		std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+		std::cout << "    " << name << ": " << bytes * rounds / elapsed.count() / (1 << 20) << " MiB/s (" << sink / rounds << ")" << std::endl;
+	}
+}	// anonymous-namespace
+
+int main() {
+	std::string source;
+	while (source.size() < (1u << 20)) {
+		source += "Content-Type: Text/HTML; Charset=UTF-8\r\nX-Request-ID: 9F86D081884C7D659A2FEAE0C55AD015\r\n"
+			"Accept-Encoding: GZIP, Deflate, BR\r\nUser-Agent: Mozilla/5.0 (X11; Linux x86_64)\r\n";
+	}
+	for (std::size_t size = 1u << 10; size <= (1u << 20); size <<= 5) {
+		std::string text = source.substr(0, size);
+		// one long line, so that all_of has to look at every byte
+		std::string line = text;
+		for (std::size_t i = 0; i != line.size(); ++i) {
+			line[i] = line[i] == '\r' || line[i] == '\n' ? ' ' : line[i];
+		}
+		std::cout << size << " bytes:" << std::endl;
+		measure("ascii::to_lower         ", size, [&]() {
+			text.assign(source, 0, size);
+			sprout::ascii::to_lower(text);
+			return static_cast<std::size_t>(text[size / 2]);
+		});
+		measure("tolower loop            ", size, [&]() {
+			text.assign(source, 0, size);
+			for (std::size_t i = 0; i != text.size(); ++i) {
+				text[i] = sprout::ascii::tolower(text[i]);
+			}
+			return static_cast<std::size_t>(text[size / 2]);
+		});
+		measure("ascii::count_if(space)  ", size, [&]() {
+			return sprout::ascii::count_if(text, sprout::ctypes::is_space<>());
+		});
+		measure("is_space loop           ", size, [&]() {
+			std::size_t n = 0;
+			for (std::size_t i = 0; i != text.size(); ++i) {
+				n += sprout::ctypes::is_space<>()(text[i]);
+			}
+			return n;
+		});
+		measure("ascii::all_of(print)    ", size, [&]() {
+			return static_cast<std::size_t>(sprout::ascii::all_of(line, sprout::ctypes::is_print<>()));
+		});
+		measure("is_print loop           ", size, [&]() {
+			std::size_t i = 0;
+			while (i != line.size() && sprout::ctypes::is_print<>()(line[i])) {
+				++i;
+			}
+			return static_cast<std::size_t>(i == line.size());
+		});
+	}
+}
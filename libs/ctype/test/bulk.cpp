@@ -0,0 +1,148 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_LIBS_CTYPE_TEST_BULK_CPP
+#define SPROUT_LIBS_CTYPE_TEST_BULK_CPP
+
+#include <string>
+#include <sprout/ctype/bulk.hpp>
+#include <sprout/string.hpp>
+#include <testspr/tools.hpp>
+
+namespace testspr {
+	namespace bulk_detail {
+		// every byte value, repeated past the 32-byte stride at every offset
+		inline std::string all_bytes() {
+			std::string result;
+			for (unsigned r = 0; r != 3; ++r) {
+				for (unsigned c = 0; c != 0x100; ++c) {
+					result += static_cast<char>((c * 37 + r) & 0xFF);
+				}
+			}
+			return result;
+		}
+		template<typename Predicate>
+		inline bool same_as_scalar(std::string const& text, Predicate pred) {
+			for (std::size_t first = 0; first != 40; ++first) {
+				for (std::size_t last = text.size() - 40; last < text.size(); last += 13) {
+					std::string const s = text.substr(first, last - first);
+					std::size_t n = 0;
+					std::size_t in = s.size();
+					std::size_t out = s.size();
+					for (std::size_t i = 0; i != s.size(); ++i) {
+						if (pred(s[i])) {
+							++n;
+							in = in == s.size() ? i : in;
+						} else {
+							out = out == s.size() ? i : out;
+						}
+					}
+					if (sprout::ascii::count_if(s, pred) != n
+						|| sprout::ascii::any_of(s, pred) != (in != s.size())
+						|| sprout::ascii::none_of(s, pred) != (in == s.size())
+						|| sprout::ascii::all_of(s, pred) != (out == s.size())
+						)
+					{
+						return false;
+					}
+				}
+			}
+			return true;
+		}
+		// a single member or non-member at each position of an otherwise uniform buffer
+		template<typename Predicate>
+		inline bool finds_each_position(char member, char other, Predicate pred) {
+			for (std::size_t i = 0; i != 100; ++i) {
+				std::string s(100, other);
+				s[i] = member;
+				std::string t(100, member);
+				t[i] = other;
+				if (!sprout::ascii::any_of(s, pred) || sprout::ascii::count_if(s, pred) != 1
+					|| sprout::ascii::all_of(t, pred) || sprout::ascii::count_if(t, pred) != 99
+					)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+#ifndef SPROUT_CONFIG_DISABLE_CXX14_CONSTEXPR
+		template<std::size_t N>
+		inline SPROUT_CXX14_CONSTEXPR sprout::basic_string<char, N> lowered(sprout::basic_string<char, N> s) {
+			sprout::ascii::to_lower(s);
+			return s;
+		}
+#endif
+	}	// namespace bulk_detail
+
+	static void bulk_test() {
+		using namespace sprout;
+		using testspr::bulk_detail::same_as_scalar;
+		using testspr::bulk_detail::finds_each_position;
+		{
+			std::string const text = testspr::bulk_detail::all_bytes();
+			TESTSPR_ASSERT(same_as_scalar(text, sprout::ctypes::is_alnum<>()));
+			TESTSPR_ASSERT(same_as_scalar(text, sprout::ctypes::is_alpha<>()));
+			TESTSPR_ASSERT(same_as_scalar(text, sprout::ctypes::is_blank<>()));
+			TESTSPR_ASSERT(same_as_scalar(text, sprout::ctypes::is_cntrl<>()));
+			TESTSPR_ASSERT(same_as_scalar(text, sprout::ctypes::is_digit<>()));
+			TESTSPR_ASSERT(same_as_scalar(text, sprout::ctypes::is_graph<>()));
+			TESTSPR_ASSERT(same_as_scalar(text, sprout::ctypes::is_lower<>()));
+			TESTSPR_ASSERT(same_as_scalar(text, sprout::ctypes::is_print<>()));
+			TESTSPR_ASSERT(same_as_scalar(text, sprout::ctypes::is_punct<>()));
+			TESTSPR_ASSERT(same_as_scalar(text, sprout::ctypes::is_space<>()));
+			TESTSPR_ASSERT(same_as_scalar(text, sprout::ctypes::is_upper<>()));
+			TESTSPR_ASSERT(same_as_scalar(text, sprout::ctypes::is_xdigit<char>()));
+		}
+		{
+			TESTSPR_ASSERT(finds_each_position(' ', 'x', sprout::ctypes::is_space<>()));
+			TESTSPR_ASSERT(finds_each_position('Q', '-', sprout::ctypes::is_alnum<>()));
+			TESTSPR_ASSERT(finds_each_position('\x7F', '\x80', sprout::ctypes::is_cntrl<>()));
+			// counters are flushed before they wrap
+			std::string const spaces(300 * 32 + 5, ' ');
+			TESTSPR_ASSERT(sprout::ascii::count_if(spaces, sprout::ctypes::is_space<>()) == spaces.size());
+			TESTSPR_ASSERT(sprout::ascii::all_of(spaces, sprout::ctypes::is_blank<>()));
+			TESTSPR_ASSERT(sprout::ascii::all_of(std::string(), sprout::ctypes::is_digit<>()));
+			TESTSPR_ASSERT(sprout::ascii::none_of(std::string(), sprout::ctypes::is_digit<>()));
+		}
+		{
+			std::string const text = testspr::bulk_detail::all_bytes();
+			std::string lower = text;
+			std::string upper = text;
+			sprout::ascii::to_lower(lower);
+			sprout::ascii::to_upper(upper);
+			bool ok = true;
+			for (std::size_t i = 0; i != text.size(); ++i) {
+				ok = ok && lower[i] == sprout::ascii::tolower(text[i]) && upper[i] == sprout::ascii::toupper(text[i]);
+			}
+			TESTSPR_ASSERT(ok);
+
+			std::string header("Content-Type: Text/HTML; Charset=UTF-8");
+			sprout::ascii::to_lower(header);
+			TESTSPR_ASSERT(header == "content-type: text/html; charset=utf-8");
+			std::wstring wide(L"Accept-Encoding");
+			sprout::ascii::to_upper(wide);
+			TESTSPR_ASSERT(wide == L"ACCEPT-ENCODING");
+		}
+#ifndef SPROUT_CONFIG_DISABLE_CXX14_CONSTEXPR
+		{
+			SPROUT_STATIC_CONSTEXPR auto s = sprout::to_string("Host: Example.COM");
+			TESTSPR_BOTH_ASSERT(sprout::ascii::count_if(s, sprout::ctypes::is_upper<>()) == 5);
+			TESTSPR_BOTH_ASSERT(sprout::ascii::any_of(s, sprout::ctypes::is_space<>()));
+			TESTSPR_BOTH_ASSERT(!sprout::ascii::all_of(s, sprout::ctypes::is_alnum<>()));
+			TESTSPR_BOTH_ASSERT(testspr::bulk_detail::lowered(s) == "host: example.com");
+		}
+#endif
+	}
+}	// namespace testspr
+
+#ifndef TESTSPR_CPP_INCLUDE
+#	define TESTSPR_TEST_FUNCTION testspr::bulk_test
+#	include <testspr/include_main.hpp>
+#endif
+
+#endif	// #ifndef SPROUT_LIBS_CTYPE_TEST_BULK_CPP
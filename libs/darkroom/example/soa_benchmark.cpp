@@ -0,0 +1,96 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+//
+// Time of rotating 4096 points by one quaternion and of normalizing them and
+// taking their dot and cross products, on std::vector of coordinate tuples with
+// q * v * conj(q) and the scalar functions and on x, y and z planes with the
+// bulk operations:
+//
+//	g++ -std=c++11 -O2 -mavx2 -mfma -I. libs/darkroom/example/soa_benchmark.cpp
+//
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <vector>
+#include <sprout/math/quaternion.hpp>
+#include <sprout/darkroom/coords.hpp>
+
+namespace {
+	template<typename F>
+	double time(F f) {
+		std::size_t const repeat = 2000;
+		std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+		for (std::size_t i = 0; i != repeat; ++i) {
+			f();
+		}
+		std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+		return elapsed.count() / repeat * 1e6;
+	}
+}	// anonymous-namespace
+
+int main() {
+	namespace coords = sprout::darkroom::coords;
+	typedef sprout::math::quaternion<double> quaternion_type;
+	typedef coords::vector3d_t vector_type;
+	std::size_t const n = 4096;
+	std::mt19937 gen(1);
+	std::uniform_real_distribution<double> dist(-1, 1);
+
+	std::vector<vector_type> v(n), u(n), r(n);
+	std::vector<double> vx(n), vy(n), vz(n), ux(n), uy(n), uz(n), rx(n), ry(n), rz(n);
+	for (std::size_t i = 0; i != n; ++i) {
+		v[i] = coords::vector3d(vx[i] = dist(gen), vy[i] = dist(gen), vz[i] = dist(gen));
+		u[i] = coords::vector3d(ux[i] = dist(gen), uy[i] = dist(gen), uz[i] = dist(gen));
+	}
+	std::vector<double> d(n), ds(n);
+	quaternion_type const q = quaternion_type(1, 2, -2, 4) / 5.0;
+	coords::vec3_soa_span<double const> const vs(vx.data(), vy.data(), vz.data(), n);
+	coords::vec3_soa_span<double const> const us(ux.data(), uy.data(), uz.data(), n);
+	coords::vec3_soa_span<double> const rs(rx.data(), ry.data(), rz.data(), n);
+
+	double const aos_rotate = time([&] {
+		for (std::size_t i = 0; i != n; ++i) {
+			quaternion_type const p = q * quaternion_type(0, coords::x(v[i]), coords::y(v[i]), coords::z(v[i])) * sprout::math::conj(q);
+			r[i] = coords::vector3d(p.R_component_2(), p.R_component_3(), p.R_component_4());
+		}
+	});
+	double const soa_rotate = time([&] {
+		coords::rotate(q, vs, rs);
+	});
+	double const aos_normalize = time([&] {
+		for (std::size_t i = 0; i != n; ++i) {
+			r[i] = coords::normalize(v[i]);
+		}
+	});
+	double const soa_normalize = time([&] {
+		coords::normalize(vs, rs);
+	});
+	double const aos_products = time([&] {
+		for (std::size_t i = 0; i != n; ++i) {
+			d[i] = coords::dot(v[i], u[i]);
+			r[i] = coords::cross(v[i], u[i]);
+		}
+	});
+	double const soa_products = time([&] {
+		coords::dot(vs, us, ds.data());
+		coords::cross(vs, us, rs);
+	});
+	std::cout
+		<< "rotate\n"
+		<< "\ttuple array\t" << aos_rotate << " us\n"
+		<< "\tvec3_soa\t" << soa_rotate << " us\n"
+		<< "normalize\n"
+		<< "\ttuple array\t" << aos_normalize << " us\n"
+		<< "\tvec3_soa\t" << soa_normalize << " us\n"
+		<< "dot and cross\n"
+		<< "\ttuple array\t" << aos_products << " us\n"
+		<< "\tvec3_soa\t" << soa_products << " us\n"
+		<< "\tcheck " << coords::x(r[n / 2]) - rx[n / 2] + d[0] - ds[0] << std::endl
+		;
+}
@@ -0,0 +1,194 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_LIBS_DARKROOM_TEST_SOA_CPP
+#define SPROUT_LIBS_DARKROOM_TEST_SOA_CPP
+
+#include <cmath>
+#include <vector>
+#include <sprout/array.hpp>
+#include <sprout/math/quaternion.hpp>
+#include <sprout/darkroom/coords.hpp>
+#include <sprout/darkroom.hpp>
+#include <sprout/darkroom/cameras.hpp>
+#include <testspr/tools.hpp>
+
+namespace testspr {
+	namespace vec3_soa_detail {
+		// a camera and a tracer with only the per-pixel interface
+		template<typename Camera>
+		struct pixel_camera {
+		public:
+			typedef typename Camera::ray_type ray_type;
+		public:
+			Camera camera;
+		public:
+			template<typename Unit2D>
+			SPROUT_CONSTEXPR ray_type operator()(Unit2D const& x, Unit2D const& y, Unit2D const& width, Unit2D const& height) const {
+				return camera(x, y, width, height);
+			}
+		};
+		template<typename Tracer>
+		struct pixel_tracer {
+		public:
+			typedef typename Tracer::color_type color_type;
+		public:
+			Tracer tracer;
+		public:
+			template<typename Renderer, typename Camera, typename Objects, typename Lights, typename Unit2D>
+			SPROUT_CONSTEXPR color_type operator()(
+				Renderer const& renderer, Camera const& camera, Objects const& objs, Lights const& lights,
+				Unit2D const& x, Unit2D const& y, Unit2D const& width, Unit2D const& height,
+				std::size_t depth_max
+				) const
+			{
+				return tracer(renderer, camera, objs, lights, x, y, width, height, depth_max);
+			}
+		};
+	}	// namespace vec3_soa_detail
+
+	static void vec3_soa_test() {
+		using namespace sprout;
+		namespace coords = sprout::darkroom::coords;
+		typedef sprout::math::quaternion<double> quaternion_type;
+		{
+			SPROUT_STATIC_CONSTEXPR auto a = coords::vec3_soa<double, 5>{{1, 0, 0, 3, 1}, {0, 1, 0, 4, 2}, {0, 0, 1, 0, 3}};
+			SPROUT_STATIC_CONSTEXPR auto b = coords::vec3_soa<double, 5>{{0, 0, 1, 1, -1}, {1, 0, 0, 1, 0}, {0, 1, 0, 1, 2}};
+
+			// view
+			TESTSPR_BOTH_ASSERT(a.size() == 5);
+			TESTSPR_BOTH_ASSERT(a[3] == coords::vector3d(3, 4, 0));
+			TESTSPR_BOTH_ASSERT(coords::make_vec3_soa(sprout::array<coords::vector3d_t, 2>{{coords::vector3d(1, 2, 3), coords::vector3d(4, 5, 6)}})[1]
+				== coords::vector3d(4, 5, 6)
+				);
+
+			// dot, cross
+			{
+				SPROUT_STATIC_CONSTEXPR auto result = coords::dot(a, b);
+				TESTSPR_BOTH_ASSERT(result[3] == 7);
+				TESTSPR_BOTH_ASSERT(result[4] == 5);
+				TESTSPR_ASSERT(coords::dot(a, b) == result);
+			}
+			{
+				SPROUT_STATIC_CONSTEXPR auto result = coords::cross(a, b);
+				TESTSPR_BOTH_ASSERT(result[0] == coords::vector3d(0, 0, 1));
+				TESTSPR_BOTH_ASSERT(result[2] == coords::vector3d(0, 1, 0));
+				TESTSPR_BOTH_ASSERT(result[4] == coords::cross(a[4], b[4]));
+				TESTSPR_ASSERT(coords::cross(a, b) == result);
+			}
+			// normalize
+			{
+				SPROUT_STATIC_CONSTEXPR auto result = coords::normalize(a);
+				TESTSPR_BOTH_ASSERT(result[3] == coords::vector3d(0.6, 0.8, 0));
+				TESTSPR_BOTH_ASSERT(result[4] == coords::normalize(a[4]));
+				TESTSPR_ASSERT(coords::normalize(a) == result);
+			}
+			// rotate: a quarter turn about z
+			{
+				SPROUT_STATIC_CONSTEXPR auto q = quaternion_type(0, 0, 0, 1);
+				SPROUT_STATIC_CONSTEXPR auto result = coords::rotate(q, a);
+				TESTSPR_BOTH_ASSERT(result[3] == coords::vector3d(-3, -4, 0));
+				TESTSPR_BOTH_ASSERT(result[4] == coords::vector3d(-1, -2, 3));
+				TESTSPR_ASSERT(coords::rotate(q, a) == result);
+				coords::vec3_soa<double, 5> const quarter = coords::rotate(quaternion_type(std::sqrt(0.5), 0, 0, std::sqrt(0.5)), a);
+				TESTSPR_ASSERT(std::abs(quarter.x[0]) <= 1e-14 && std::abs(quarter.y[0] - 1) <= 1e-14 && quarter.z[0] == 0);
+				TESTSPR_ASSERT(std::abs(quarter.x[3] + 4) <= 1e-14 && std::abs(quarter.y[3] - 3) <= 1e-14);
+			}
+		}
+		{
+			// spans: every block width and the scalar tail, in place
+			std::size_t const n = 37;
+			std::vector<double> x(n), y(n), z(n), rx(n), ry(n), rz(n), d(n);
+			for (std::size_t i = 0; i != n; ++i) {
+				x[i] = static_cast<double>(i % 7) - 3;
+				y[i] = static_cast<double>(i % 5) - 2;
+				z[i] = static_cast<double>(i % 3) + 1;
+			}
+			coords::vec3_soa_span<double const> const a(x.data(), y.data(), z.data(), n);
+			coords::vec3_soa_span<double> const r(rx.data(), ry.data(), rz.data(), n);
+
+			TESTSPR_ASSERT(coords::dot(a, a, d.data()) == d.data() + n);
+			for (std::size_t i = 0; i != n; ++i) {
+				TESTSPR_ASSERT(d[i] == coords::length_sq(a[i]));
+			}
+			coords::cross(a, coords::vec3_soa_span<double const>(z.data(), x.data(), y.data(), n), r);
+			for (std::size_t i = 0; i != n; ++i) {
+				TESTSPR_ASSERT(r[i] == coords::cross(a[i], coords::vector3d(z[i], x[i], y[i])));
+			}
+			coords::normalize(a, r);
+			for (std::size_t i = 0; i != n; ++i) {
+				TESTSPR_ASSERT(std::abs(rx[i] - coords::x(coords::normalize(a[i]))) <= 1e-15);
+				TESTSPR_ASSERT(std::abs(rz[i] - coords::z(coords::normalize(a[i]))) <= 1e-15);
+			}
+			// the rotation by q composed with its inverse is the identity
+			quaternion_type const q = quaternion_type(1, 2, -2, 4) / 5.0;
+			coords::rotate(q, a, r);
+			for (std::size_t i = 0; i != n; ++i) {
+				TESTSPR_ASSERT(std::abs(coords::length_sq(r[i]) - coords::length_sq(a[i])) <= 1e-12);
+			}
+			coords::rotate(sprout::math::conj(q), r, r);
+			for (std::size_t i = 0; i != n; ++i) {
+				TESTSPR_ASSERT(std::abs(rx[i] - x[i]) <= 1e-14 && std::abs(ry[i] - y[i]) <= 1e-14 && std::abs(rz[i] - z[i]) <= 1e-14);
+			}
+		}
+		{
+			// a scanline of camera rays in one batch
+			SPROUT_STATIC_CONSTEXPR auto camera = sprout::darkroom::cameras::make_simple_camera(0.8);
+			SPROUT_STATIC_CONSTEXPR auto rays = sprout::darkroom::cameras::calculate_scanline<6>(camera, 3, 5, 16, 12);
+			TESTSPR_BOTH_ASSERT(rays[0] == camera(3, 5, 16, 12));
+			TESTSPR_BOTH_ASSERT(rays[5] == camera(8, 5, 16, 12));
+
+			std::vector<double> x(16), y(16), z(16);
+			camera.directions(0, 5, 16, 12, coords::vec3_soa_span<double>(x.data(), y.data(), z.data(), 16));
+			for (std::size_t i = 0; i != 16; ++i) {
+				auto const expected = sprout::tuples::get<1>(camera(i, std::size_t(5), std::size_t(16), std::size_t(12)));
+				TESTSPR_ASSERT(std::abs(x[i] - coords::x(expected)) <= 1e-15);
+				TESTSPR_ASSERT(std::abs(y[i] - coords::y(expected)) <= 1e-15);
+				TESTSPR_ASSERT(std::abs(z[i] - coords::z(expected)) <= 1e-15);
+			}
+		}
+		{
+			// cameras without scanline and tracers without trace render per pixel
+			using namespace sprout::darkroom;
+			typedef pixels::color_pixels<6, 4>::type image_type;
+			SPROUT_STATIC_CONSTEXPR auto object = objects::make_object_list(
+				objects::make_sphere(
+					coords::vector3d(0.0, 0.0, 4.0),
+					1.5,
+					materials::make_uniform_material_image(colors::rgb_f(0.0, 0.0, 1.0), 0.2)
+					)
+				);
+			SPROUT_STATIC_CONSTEXPR auto light = lights::make_light_list(
+				lights::make_point_light(coords::vector3d(-3.0, 5.0, 0.0), colors::rgb_f(7.0, 7.0, 7.0))
+				);
+			SPROUT_STATIC_CONSTEXPR auto renderer = renderers::make_whitted_style(
+				renderers::make_uniform_color(colors::rgb_f(0.0, 0.0, 0.0))
+				);
+			SPROUT_STATIC_CONSTEXPR auto camera = cameras::make_simple_camera(0.8);
+			SPROUT_STATIC_CONSTEXPR auto raytracer = tracers::make_raytracer();
+			SPROUT_STATIC_CONSTEXPR testspr::vec3_soa_detail::pixel_camera<decltype(camera)> user_camera = {camera};
+			SPROUT_STATIC_CONSTEXPR testspr::vec3_soa_detail::pixel_tracer<decltype(raytracer)> user_tracer = {raytracer};
+
+			SPROUT_STATIC_CONSTEXPR auto rays = cameras::calculate_scanline<6>(user_camera, 0, 2, 6, 4);
+			SPROUT_STATIC_CONSTEXPR auto batch_rays = cameras::calculate_scanline<6>(camera, 0, 2, 6, 4);
+			TESTSPR_BOTH_ASSERT(rays == batch_rays);
+			TESTSPR_ASSERT(cameras::calculate_scanline<6>(user_camera, 0, 2, 6, 4) == rays);
+
+			SPROUT_STATIC_CONSTEXPR auto image = pixels::generate<image_type>(raytracer, renderer, camera, object, light);
+			TESTSPR_BOTH_ASSERT(pixels::generate<image_type>(user_tracer, renderer, camera, object, light) == image);
+			TESTSPR_BOTH_ASSERT(pixels::generate<image_type>(raytracer, renderer, user_camera, object, light) == image);
+			TESTSPR_BOTH_ASSERT(pixels::generate<image_type>(user_tracer, renderer, user_camera, object, light) == image);
+		}
+	}
+}	// namespace testspr
+
+#ifndef TESTSPR_CPP_INCLUDE
+#	define TESTSPR_TEST_FUNCTION testspr::vec3_soa_test
+#	include <testspr/include_main.hpp>
+#endif
+
+#endif	// #ifndef SPROUT_LIBS_DARKROOM_TEST_SOA_CPP
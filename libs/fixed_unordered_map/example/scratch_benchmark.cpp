@@ -0,0 +1,51 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+//
+// Per-request scratch map workload: build a map of a few dozen entries,
+// query it, throw it away. Compares sprout::fixed_unordered_map with
+// std::unordered_map, whose node allocations dominate at this size.
+//
+#include <chrono>
+#include <iostream>
+#include <unordered_map>
+#include <sprout/fixed_unordered_map.hpp>
+
+namespace {
+	static std::size_t const requests = 200000;
+	static unsigned const entries = 48;
+
+	template<typename Map>
+	unsigned request(unsigned seed) {
+		Map m;
+		for (unsigned i = 0; i != entries; ++i) {
+			m[(seed + i) * 2654435761u] += i;
+		}
+		unsigned hits = 0;
+		for (unsigned i = 0; i != entries * 2; ++i) {
+			hits += static_cast<unsigned>(m.count((seed + i) * 2654435761u));
+		}
+		return hits;
+	}
+
+	template<typename Map>
+	void measure(char const* name) {
+		unsigned sink = 0;
+		std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+		for (std::size_t r = 0; r != requests; ++r) {
+			sink += request<Map>(static_cast<unsigned>(r));
+		}
+		std::chrono::duration<double, std::nano> const elapsed = std::chrono::steady_clock::now() - start;
+		std::cout << name << ": " << elapsed.count() / requests << " ns/request (" << sink << ")" << std::endl;
+	}
+}	// anonymous-namespace
+
+int main() {
+	measure<sprout::fixed_unordered_map<unsigned, unsigned, 64> >("fixed_unordered_map");
+	measure<std::unordered_map<unsigned, unsigned> >("std::unordered_map ");
+	return 0;
+}
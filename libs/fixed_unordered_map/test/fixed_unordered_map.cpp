@@ -0,0 +1,139 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_LIBS_FIXED_UNORDERED_MAP_TEST_FIXED_UNORDERED_MAP_CPP
+#define SPROUT_LIBS_FIXED_UNORDERED_MAP_TEST_FIXED_UNORDERED_MAP_CPP
+
+#include <map>
+#include <stdexcept>
+#include <sprout/fixed_unordered_map.hpp>
+#include <sprout/string.hpp>
+#include <testspr/tools.hpp>
+
+namespace testspr {
+#ifndef SPROUT_CONFIG_DISABLE_CXX14_CONSTEXPR
+	namespace fixed_unordered_map_detail {
+		inline SPROUT_CXX14_CONSTEXPR int squares_sum() {
+			sprout::fixed_unordered_map<int, int, 40> m;
+			for (int i = 0; i != 40; ++i) {
+				m[i * 17] = i * i;
+			}
+			for (int i = 0; i != 40; i += 2) {
+				m.erase(i * 17);
+			}
+			int sum = 0;
+			for (int i = 0; i != 40; ++i) {
+				sum += m.contains(i * 17) ? m.at(i * 17) : 0;
+			}
+			return sum;
+		}
+	}	// namespace fixed_unordered_map_detail
+#endif
+
+	static void fixed_unordered_map_test() {
+		using namespace sprout;
+		{
+			typedef sprout::fixed_unordered_map<int, int, 100> map_type;
+			TESTSPR_BOTH_ASSERT((map_type::static_capacity == 100));
+			TESTSPR_BOTH_ASSERT((map_type::slot_count == 128));
+			TESTSPR_BOTH_ASSERT((sprout::fixed_unordered_map<int, int, 14>::slot_count == 16));
+			TESTSPR_BOTH_ASSERT((sprout::fixed_unordered_map<int, int, 15>::slot_count == 32));
+
+			map_type m;
+			TESTSPR_ASSERT(m.empty());
+			TESTSPR_ASSERT(m.begin() == m.end());
+			for (int i = 0; i != 100; ++i) {
+				TESTSPR_ASSERT(m.insert(sprout::pair<int, int>(i, i * 2)).second);
+			}
+			TESTSPR_ASSERT(m.size() == 100);
+			TESTSPR_ASSERT(!m.insert(sprout::pair<int, int>(7, 0)).second);
+			TESTSPR_ASSERT(m.at(7) == 14);
+			TESTSPR_ASSERT(m.find(100) == m.end());
+			{
+				bool thrown = false;
+				try {
+					m.insert(sprout::pair<int, int>(100, 0));
+				} catch (std::length_error const&) {
+					thrown = true;
+				}
+				TESTSPR_ASSERT(thrown);
+			}
+			{
+				bool thrown = false;
+				try {
+					m.at(-1);
+				} catch (std::out_of_range const&) {
+					thrown = true;
+				}
+				TESTSPR_ASSERT(thrown);
+			}
+			{
+				int n = 0;
+				long sum = 0;
+				for (map_type::const_iterator it = m.begin(); it != m.end(); ++it) {
+					++n;
+					sum += it->second;
+				}
+				TESTSPR_ASSERT(n == 100);
+				TESTSPR_ASSERT(sum == 9900);
+			}
+			TESTSPR_ASSERT(m.erase(50) == 1);
+			TESTSPR_ASSERT(m.erase(50) == 0);
+			TESTSPR_ASSERT(!m.contains(50));
+			TESTSPR_ASSERT(m.insert_or_assign(3, -3).second == false);
+			TESTSPR_ASSERT(m[3] == -3);
+			m.erase(m.find(3));
+			TESTSPR_ASSERT(m.count(3) == 0);
+			TESTSPR_ASSERT(m.size() == 98);
+			m.clear();
+			TESTSPR_ASSERT(m.empty());
+			TESTSPR_ASSERT(!m.contains(1));
+		}
+		{
+			// churn at full load against std::map, which exercises tombstone purging
+			sprout::fixed_unordered_map<unsigned, unsigned, 200> m;
+			std::map<unsigned, unsigned> ref;
+			unsigned x = 12345;
+			bool ok = true;
+			for (int i = 0; i != 20000; ++i) {
+				x = x * 1103515245u + 12345u;
+				unsigned const k = (x >> 8) % 400;
+				if (ref.size() == 200 || (x & 1)) {
+					ok = ok && m.erase(k) == ref.erase(k);
+				} else {
+					m[k] = i;
+					ref[k] = i;
+				}
+				ok = ok && m.size() == ref.size();
+			}
+			for (std::map<unsigned, unsigned>::const_iterator it = ref.begin(); it != ref.end(); ++it) {
+				ok = ok && m.at(it->first) == it->second;
+			}
+			TESTSPR_ASSERT(ok);
+		}
+		{
+			sprout::fixed_unordered_map<sprout::string<8>, int, 8> m;
+			m[sprout::to_string("one")] = 1;
+			m[sprout::to_string("two")] = 2;
+			TESTSPR_ASSERT(m.at(sprout::to_string("two")) == 2);
+			TESTSPR_ASSERT(!m.contains(sprout::to_string("three")));
+		}
+#ifndef SPROUT_CONFIG_DISABLE_CXX14_CONSTEXPR
+		{
+			SPROUT_STATIC_CONSTEXPR int sum = testspr::fixed_unordered_map_detail::squares_sum();
+			TESTSPR_BOTH_ASSERT(sum == 10660);
+		}
+#endif
+	}
+}	// namespace testspr
+
+#ifndef TESTSPR_CPP_INCLUDE
+#	define TESTSPR_TEST_FUNCTION testspr::fixed_unordered_map_test
+#	include <testspr/include_main.hpp>
+#endif
+
+#endif	// #ifndef SPROUT_LIBS_FIXED_UNORDERED_MAP_TEST_FIXED_UNORDERED_MAP_CPP
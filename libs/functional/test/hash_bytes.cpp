@@ -0,0 +1,83 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_LIBS_FUNCTIONAL_TEST_HASH_BYTES_CPP
+#define SPROUT_LIBS_FUNCTIONAL_TEST_HASH_BYTES_CPP
+
+#include <functional>
+#include <vector>
+#include <sprout/functional/hash.hpp>
+#include <sprout/functional/hash/hash_bytes.hpp>
+#include <sprout/iterator/counting_iterator.hpp>
+#include <sprout/uuid.hpp>
+#include <testspr/tools.hpp>
+
+namespace testspr {
+	static void hash_bytes_test() {
+		using namespace sprout;
+		{
+			// constant evaluation equals the runtime path, in every length class;
+			// 8192 elements are 1023 stripes, deeper than a linear recursion may go
+			SPROUT_STATIC_CONSTEXPR std::size_t h0 = sprout::hash_bytes(
+				sprout::counting_iterator<unsigned char>(0), sprout::counting_iterator<unsigned char>(0)
+				);
+			SPROUT_STATIC_CONSTEXPR std::size_t h3 = sprout::hash_bytes(
+				sprout::counting_iterator<unsigned char>(0), sprout::counting_iterator<unsigned char>(3)
+				);
+			SPROUT_STATIC_CONSTEXPR std::size_t h100 = sprout::hash_bytes(
+				7, sprout::counting_iterator<unsigned char>(0), sprout::counting_iterator<unsigned char>(100)
+				);
+			SPROUT_STATIC_CONSTEXPR std::size_t h8192 = sprout::hash_bytes(
+				sprout::counting_iterator<unsigned>(0), sprout::counting_iterator<unsigned>(8192)
+				);
+			std::vector<unsigned char> bytes(256);
+			std::vector<unsigned> words(8192);
+			for (std::size_t i = 0; i != bytes.size(); ++i) {
+				bytes[i] = static_cast<unsigned char>(i);
+			}
+			for (std::size_t i = 0; i != words.size(); ++i) {
+				words[i] = static_cast<unsigned>(i);
+			}
+			TESTSPR_ASSERT(h0 == sprout::hash_memory(bytes.data(), 0));
+			TESTSPR_ASSERT(h3 == sprout::hash_memory(bytes.data(), 3));
+			TESTSPR_ASSERT(h100 == sprout::hash_memory(bytes.data(), 100, 7));
+			TESTSPR_ASSERT(h8192 == sprout::hash_elements(words.data(), words.size()));
+			TESTSPR_ASSERT(h8192 != sprout::hash_elements(words.data(), words.size() - 1));
+
+			// the same comparison, called at runtime, over every length up to 256 and some seeds
+			for (std::size_t n = 0; n <= bytes.size(); ++n) {
+				for (std::size_t seed = 0; seed != 3; ++seed) {
+					TESTSPR_ASSERT(sprout::hash_bytes(seed, bytes.data(), bytes.data() + n) == sprout::hash_memory(bytes.data(), n, seed));
+				}
+			}
+			for (std::size_t n = 0; n <= 300; n += 13) {
+				TESTSPR_ASSERT(sprout::hash_bytes(words.data(), words.data() + n) == sprout::hash_elements(words.data(), n));
+			}
+		}
+		{
+			// uuid
+			SPROUT_STATIC_CONSTEXPR auto id1 = sprout::uuids::uuid{{
+				0x6b, 0xa7, 0xb8, 0x10, 0x9d, 0xad, 0x11, 0xd1, 0x80, 0xb4, 0x00, 0xc0, 0x4f, 0xd4, 0x30, 0xc8
+				}};
+			SPROUT_STATIC_CONSTEXPR auto id2 = sprout::uuids::uuid{{
+				0x6b, 0xa7, 0xb8, 0x11, 0x9d, 0xad, 0x11, 0xd1, 0x80, 0xb4, 0x00, 0xc0, 0x4f, 0xd4, 0x30, 0xc8
+				}};
+			TESTSPR_BOTH_ASSERT(sprout::to_hash(id1) == sprout::hash<sprout::uuids::uuid>()(id1));
+			TESTSPR_BOTH_ASSERT(sprout::to_hash(id1) == sprout::hash_bytes(id1));
+			TESTSPR_BOTH_ASSERT(sprout::to_hash(id1) != sprout::to_hash(id2));
+			TESTSPR_ASSERT(std::hash<sprout::uuids::uuid>()(id1) == sprout::to_hash(id1));
+			TESTSPR_ASSERT(std::hash<sprout::uuids::uuid>()(id2) == sprout::to_hash(id2));
+		}
+	}
+}	// namespace testspr
+
+#ifndef TESTSPR_CPP_INCLUDE
+#	define TESTSPR_TEST_FUNCTION testspr::hash_bytes_test
+#	include <testspr/include_main.hpp>
+#endif
+
+#endif	// #ifndef SPROUT_LIBS_FUNCTIONAL_TEST_HASH_BYTES_CPP
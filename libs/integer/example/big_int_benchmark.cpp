@@ -0,0 +1,87 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+//
+// Throughput of addition, multiplication, division and decimal conversion on
+// sprout::big_int and sprout::dynamic_big_int at 256, 1024 and 4096 bits.
+// Multiplication takes two half width operands so the product is exact, and
+// division divides a full width value by a half width one:
+//
+//	g++ -std=c++14 -O2 -mbmi2 -I. libs/integer/example/big_int_benchmark.cpp
+//
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <sprout/integer.hpp>
+
+namespace {
+	template<typename F>
+	double ops(F f) {
+		std::size_t const repeat = 20000;
+		std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+		for (std::size_t i = 0; i != repeat; ++i) {
+			f();
+		}
+		std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+		return repeat / elapsed.count();
+	}
+
+	template<typename Int>
+	Int random_value(std::mt19937_64& gen, std::size_t limbs) {
+		Int result = 0;
+		for (std::size_t i = 0; i != limbs; ++i) {
+			result <<= 64;
+			result += Int(static_cast<unsigned long long>(gen() >> (i == 0 ? 2 : 0)));
+		}
+		return result;
+	}
+
+	template<typename Int>
+	void bench(char const* name, std::size_t bits) {
+		std::mt19937_64 gen(bits);
+		std::size_t const limbs = bits / 64;
+		Int const a = random_value<Int>(gen, limbs);
+		Int const b = random_value<Int>(gen, limbs);
+		Int const ha = random_value<Int>(gen, limbs / 2);
+		Int const hb = random_value<Int>(gen, limbs / 2);
+		Int r = 0;
+		std::size_t len = 0;
+
+		double const add = ops([&] {
+			r = a + b;
+		});
+		double const mul = ops([&] {
+			r = ha * hb;
+		});
+		double const div = ops([&] {
+			r = a / hb;
+		});
+		double const str = ops([&] {
+			len += sprout::to_string(a).size();
+		});
+		std::cout
+			<< name << '<' << bits << ">\n"
+			<< "\tadd\t" << add << " op/s\n"
+			<< "\tmul\t" << mul << " op/s\n"
+			<< "\tdiv\t" << div << " op/s\n"
+			<< "\tto_string\t" << str << " op/s\n"
+			<< "\tcheck " << (r.is_zero() ? 0 : 1) + len % 7 << '\n'
+			;
+	}
+}	// anonymous-namespace
+
+int main() {
+	bench<sprout::big_int<256> >("big_int", 256);
+	bench<sprout::big_int<1024> >("big_int", 1024);
+	bench<sprout::big_int<4096> >("big_int", 4096);
+	bench<sprout::dynamic_big_int>("dynamic_big_int", 256);
+	bench<sprout::dynamic_big_int>("dynamic_big_int", 1024);
+	bench<sprout::dynamic_big_int>("dynamic_big_int", 4096);
+	std::cout.flush();
+}
@@ -0,0 +1,214 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_LIBS_INTEGER_TEST_BIG_INT_CPP
+#define SPROUT_LIBS_INTEGER_TEST_BIG_INT_CPP
+
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <sprout/integer.hpp>
+#include <sprout/rational.hpp>
+#include <sprout/string.hpp>
+#include <testspr/tools.hpp>
+
+namespace testspr {
+	namespace big_int_detail {
+#ifndef SPROUT_CONFIG_DISABLE_CXX14_CONSTEXPR
+		template<std::size_t Bits>
+		inline SPROUT_CXX14_CONSTEXPR sprout::big_int<Bits> factorial(int n) {
+			sprout::big_int<Bits> result = 1;
+			for (int i = 2; i <= n; ++i) {
+				result *= i;
+			}
+			return result;
+		}
+		inline SPROUT_CXX14_CONSTEXPR bool divmod_identity() {
+			typedef sprout::big_int<512> int_type;
+			int_type const u = factorial<512>(90) - 12345;
+			int_type const v = factorial<512>(33) + 1;
+			return u / v * v + u % v == u
+				&& u % v < v
+				&& (-u) / v == -(u / v)
+				&& (-u) % v == -(u % v)
+				;
+		}
+#endif
+		inline std::uint64_t next(std::uint64_t& x) {
+			x ^= x << 13;
+			x ^= x >> 7;
+			x ^= x << 17;
+			return x;
+		}
+	}	// namespace big_int_detail
+
+	static void big_int_test() {
+		using namespace sprout;
+		{
+			typedef sprout::big_int<128> int_type;
+			TESTSPR_BOTH_ASSERT(int_type::static_size == 2);
+			TESTSPR_ASSERT(int_type(-1).limb(1) == ~std::uint64_t(0));
+			TESTSPR_ASSERT(int_type(-1).is_negative());
+			TESTSPR_ASSERT(!int_type(0).is_negative());
+			TESTSPR_ASSERT(static_cast<long long>(int_type(-42)) == -42);
+
+			// arithmetic carries across limbs
+			int_type x = ~std::uint64_t(0);
+			++x;
+			TESTSPR_ASSERT(x.limb(0) == 0 && x.limb(1) == 1);
+			TESTSPR_ASSERT(x - 1 == int_type(~std::uint64_t(0)));
+			TESTSPR_ASSERT((x << 62) >> 126 == int_type(1));
+			TESTSPR_ASSERT((x << 63) >> 127 == int_type(-1));
+			TESTSPR_ASSERT(int_type(-17) / 5 == -3);
+			TESTSPR_ASSERT(int_type(-17) % 5 == -2);
+			TESTSPR_ASSERT(int_type(-17) >> 1 == -9);
+			TESTSPR_ASSERT((int_type(12) & 10) == 8);
+			TESTSPR_ASSERT((int_type(12) | 3) == 15);
+			TESTSPR_ASSERT((int_type(12) ^ -1) == -13);
+			TESTSPR_ASSERT(int_type(-3) < int_type(2));
+			TESTSPR_ASSERT(x.bit_length() == 65);
+
+			// wraps around like the builtin types
+			TESTSPR_ASSERT(std::numeric_limits<int_type>::max() + 1 == std::numeric_limits<int_type>::min());
+			TESTSPR_ASSERT(std::numeric_limits<int_type>::digits == 127);
+			TESTSPR_ASSERT(std::numeric_limits<int_type>::is_bounded);
+		}
+#ifndef SPROUT_CONFIG_DISABLE_CXX14_CONSTEXPR
+		{
+			// constant evaluation
+			SPROUT_STATIC_CONSTEXPR auto f = testspr::big_int_detail::factorial<256>(50);
+			SPROUT_STATIC_CONSTEXPR auto s = sprout::to_string(f);
+			TESTSPR_BOTH_ASSERT(s == "30414093201713378043612608166064768844377641568960512000000000000");
+			TESTSPR_BOTH_ASSERT(sprout::big_int<256>::from_string("30414093201713378043612608166064768844377641568960512000000000000") == f);
+			TESTSPR_BOTH_ASSERT(f / testspr::big_int_detail::factorial<256>(48) == 2450);
+			TESTSPR_BOTH_ASSERT(testspr::big_int_detail::divmod_identity());
+			TESTSPR_BOTH_ASSERT(sprout::to_string(std::numeric_limits<sprout::big_int<256> >::min())
+				== "-57896044618658097711785492504343953926634992332820282019728792003956564819968"
+				);
+		}
+#endif
+		{
+			// Karatsuba agrees with the schoolbook product
+			std::uint64_t seed = 88172645463325252ull;
+			std::size_t const sizes[] = {1, 7, 23, 24, 25, 48, 61, 64, 97, 150};
+			for (std::size_t i = 0; i != sizeof(sizes) / sizeof(sizes[0]); ++i) {
+				for (std::size_t j = 0; j <= i; ++j) {
+					std::size_t const an = sizes[i];
+					std::size_t const bn = sizes[j];
+					std::vector<std::uint64_t> a(an), b(bn), expected(an + bn), result(an + bn);
+					std::vector<std::uint64_t> scratch(sprout::detail::limbs_mul_scratch_size(bn));
+					for (std::size_t k = 0; k != an; ++k) {
+						a[k] = testspr::big_int_detail::next(seed);
+					}
+					for (std::size_t k = 0; k != bn; ++k) {
+						b[k] = k == 0 ? ~std::uint64_t(0) : testspr::big_int_detail::next(seed);
+					}
+					sprout::detail::limbs_mul_basecase(expected.data(), a.data(), an, b.data(), bn);
+					sprout::detail::limbs_mul(result.data(), a.data(), an, b.data(), bn, scratch.data());
+					TESTSPR_ASSERT(result == expected);
+				}
+			}
+		}
+		{
+			// division on both sides of the Karatsuba threshold
+			typedef sprout::big_int<4096> int_type;
+			std::uint64_t seed = 2463534242ull;
+			for (std::size_t n = 1; n <= 32; n += 5) {
+				int_type u, v;
+				for (std::size_t k = 0; k != 2 * n; ++k) {
+					u = (u << 64) | int_type(testspr::big_int_detail::next(seed));
+				}
+				for (std::size_t k = 0; k != n; ++k) {
+					v = (v << 64) | int_type(testspr::big_int_detail::next(seed) >> (k == 0 ? 1 : 0));
+				}
+				int_type q, r;
+				int_type::divmod(u, v, &q, &r);
+				TESTSPR_ASSERT(q * v + r == u);
+				TESTSPR_ASSERT(!r.is_negative() && r < v);
+				TESTSPR_ASSERT(int_type::from_string(sprout::to_string(u).c_str()) == u);
+			}
+		}
+		{
+			// errors
+			typedef sprout::big_int<64> int_type;
+			bool thrown = false;
+			try {
+				int_type(1) / int_type(0);
+			} catch (std::domain_error const&) {
+				thrown = true;
+			}
+			TESTSPR_ASSERT(thrown);
+			thrown = false;
+			try {
+				int_type::from_string("12a");
+			} catch (std::invalid_argument const&) {
+				thrown = true;
+			}
+			TESTSPR_ASSERT(thrown);
+			thrown = false;
+			try {
+				int_type::from_string("9223372036854775808");
+			} catch (std::out_of_range const&) {
+				thrown = true;
+			}
+			TESTSPR_ASSERT(thrown);
+			TESTSPR_ASSERT(int_type::from_string("-9223372036854775808") == std::numeric_limits<std::int64_t>::min());
+		}
+		{
+			// dynamic_big_int
+			sprout::dynamic_big_int f = 1;
+			for (int i = 2; i <= 100; ++i) {
+				f *= i;
+			}
+			TESTSPR_ASSERT(sprout::to_string(f) == "93326215443944152681699238856266700490715968264381621468592963895217599993229915608941463976156518286253697920827223758251185210916864000000000000000000000000");
+			TESTSPR_ASSERT(sprout::dynamic_big_int::from_string(sprout::to_string(-f).c_str()) == -f);
+			sprout::dynamic_big_int g = 1;
+			for (int i = 2; i <= 98; ++i) {
+				g *= i;
+			}
+			TESTSPR_ASSERT(f / g == 9900);
+			TESTSPR_ASSERT(f % (g + 1) == (g + 1) - 9900);
+			TESTSPR_ASSERT(-f / 7 * 7 == -f);
+			TESTSPR_ASSERT((f >> 97 << 97) == f);
+			TESTSPR_ASSERT(f - f == 0 && (f - f).sign() == 0);
+			TESTSPR_ASSERT(sprout::dynamic_big_int(sprout::big_int<128>(-5)) == -5);
+			TESTSPR_ASSERT(!std::numeric_limits<sprout::dynamic_big_int>::is_bounded);
+
+			std::ostringstream os;
+			os << -sprout::dynamic_big_int(1234567890123456789ll) * 1000;
+			TESTSPR_ASSERT(os.str() == "-1234567890123456789000");
+		}
+		{
+			// rational over big integers stays exact
+			typedef sprout::rational<sprout::big_int<256> > fixed_rational;
+			fixed_rational h(0);
+			for (int i = 1; i <= 30; ++i) {
+				h += fixed_rational(1, i);
+			}
+			TESTSPR_ASSERT(h.numerator() == sprout::big_int<256>::from_string("9304682830147"));
+			TESTSPR_ASSERT(h.denominator() == sprout::big_int<256>::from_string("2329089562800"));
+
+			typedef sprout::rational<sprout::dynamic_big_int> dynamic_rational;
+			dynamic_rational d(0);
+			for (int i = 1; i <= 60; ++i) {
+				d += dynamic_rational(1, i);
+			}
+			TESTSPR_ASSERT(d.numerator() == sprout::dynamic_big_int::from_string("15117092380124150817026911"));
+			TESTSPR_ASSERT(d.denominator() == sprout::dynamic_big_int::from_string("3230237388259077233637600"));
+			TESTSPR_ASSERT(d * dynamic_rational(2) - d == d);
+		}
+	}
+}	// namespace testspr
+
+#ifndef TESTSPR_CPP_INCLUDE
+#	define TESTSPR_TEST_FUNCTION testspr::big_int_test
+#	include <testspr/include_main.hpp>
+#endif
+
+#endif	// #ifndef SPROUT_LIBS_INTEGER_TEST_BIG_INT_CPP
@@ -0,0 +1,119 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+//
+// Throughput and accuracy of the batch functions against a loop over the scalar
+// ones, per function, for a million doubles. Build with -O2, and with -mavx2 for
+// the four-lane kernels:
+//
+//	g++ -std=c++11 -O2 -mavx2 -I. libs/math/example/batch_benchmark.cpp
+//
+// The error column is the largest over the data in units of the last place,
+// against the long double functions of <cmath>.
+//
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <limits>
+#include <vector>
+#include <sprout/math/batch.hpp>
+
+namespace {
+	typedef double* (*batch_function)(double const*, double const*, double*);
+	typedef double (*scalar_function)(double);
+	typedef long double (*exact_function)(long double);
+
+	double* batch_sin(double const* first, double const* last, double* result) {
+		return sprout::math::sin(first, last, result);
+	}
+	double* batch_cos(double const* first, double const* last, double* result) {
+		return sprout::math::cos(first, last, result);
+	}
+	double* batch_exp(double const* first, double const* last, double* result) {
+		return sprout::math::exp(first, last, result);
+	}
+	double* batch_log(double const* first, double const* last, double* result) {
+		return sprout::math::log(first, last, result);
+	}
+	double* batch_sqrt(double const* first, double const* last, double* result) {
+		return sprout::math::sqrt(first, last, result);
+	}
+	double scalar_sin(double x) {
+		return sprout::math::sin(x);
+	}
+	double scalar_cos(double x) {
+		return sprout::math::cos(x);
+	}
+	double scalar_exp(double x) {
+		return sprout::math::exp(x);
+	}
+	double scalar_log(double x) {
+		return sprout::math::log(x);
+	}
+	double scalar_sqrt(double x) {
+		return sprout::math::sqrt(x);
+	}
+	long double exact_sin(long double x) {
+		return std::sin(x);
+	}
+	long double exact_cos(long double x) {
+		return std::cos(x);
+	}
+	long double exact_exp(long double x) {
+		return std::exp(x);
+	}
+	long double exact_log(long double x) {
+		return std::log(x);
+	}
+	long double exact_sqrt(long double x) {
+		return std::sqrt(x);
+	}
+
+	double ulps(double got, long double exact) {
+		double const nearest = static_cast<double>(exact);
+		double const ulp = std::nextafter(std::fabs(nearest), std::numeric_limits<double>::infinity()) - std::fabs(nearest);
+		return static_cast<double>(std::fabs(static_cast<long double>(got) - exact) / ulp);
+	}
+
+	void run(char const* name, batch_function batch, scalar_function scalar, exact_function exact, double lo, double hi) {
+		std::size_t const n = 1 << 20;
+		std::vector<double> x(n);
+		std::vector<double> y(n);
+		for (std::size_t i = 0; i != n; ++i) {
+			x[i] = lo + (hi - lo) * static_cast<double>(i) / n;
+		}
+		std::chrono::steady_clock::time_point const t0 = std::chrono::steady_clock::now();
+		for (std::size_t i = 0; i != n; ++i) {
+			y[i] = scalar(x[i]);
+		}
+		std::chrono::steady_clock::time_point const t1 = std::chrono::steady_clock::now();
+		batch(x.data(), x.data() + n, y.data());
+		std::chrono::steady_clock::time_point const t2 = std::chrono::steady_clock::now();
+		double error = 0;
+		for (std::size_t i = 0; i != n; ++i) {
+			double const e = ulps(y[i], exact(static_cast<long double>(x[i])));
+			error = e > error ? e : error;
+		}
+		std::chrono::duration<double> const loop = t1 - t0;
+		std::chrono::duration<double> const vector = t2 - t1;
+		std::cout
+			<< name << "\t"
+			<< n / loop.count() / 1e6 << " M/s scalar\t"
+			<< n / vector.count() / 1e6 << " M/s batch\t"
+			<< error << " ulp" << std::endl
+			;
+	}
+}	// anonymous-namespace
+
+int main() {
+	run("sin", &batch_sin, &scalar_sin, &exact_sin, -100, 100);
+	run("cos", &batch_cos, &scalar_cos, &exact_cos, -100, 100);
+	run("exp", &batch_exp, &scalar_exp, &exact_exp, -700, 700);
+	run("log", &batch_log, &scalar_log, &exact_log, 1e-6, 1e6);
+	run("sqrt", &batch_sqrt, &scalar_sqrt, &exact_sqrt, 0, 1e6);
+}
@@ -0,0 +1,53 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+//
+// A 64K-entry sine wavetable computed by the sprout::math fallbacks (the builtins are
+// disabled below). With C++14 constexpr the table is a constant expression, so the cost
+// is paid by the compiler; time it with
+//
+//	time g++ -std=c++14 -I. -c libs/math/example/table_benchmark.cpp
+//
+// It takes about 400 of GCC's constexpr operations per entry, within the default
+// -fconstexpr-ops-limit; Clang needs -fconstexpr-steps raised. The same table is also
+// filled at run time for comparison.
+//
+#define SPROUT_CONFIG_DISABLE_BUILTIN_CMATH_FUNCTION
+
+#include <chrono>
+#include <iostream>
+#include <sprout/config.hpp>
+#include <sprout/array.hpp>
+#include <sprout/math/sin.hpp>
+#include <sprout/math/constants.hpp>
+
+namespace {
+	SPROUT_STATIC_CONSTEXPR std::size_t table_size = 65536;
+	typedef sprout::array<double, table_size> table_type;
+
+	// one period
+	SPROUT_CXX14_CONSTEXPR table_type make_table(double amplitude) {
+		table_type result{{}};
+		for (std::size_t i = 0; i != table_size; ++i) {
+			result[i] = amplitude * sprout::math::sin(sprout::math::two_pi<double>() * static_cast<double>(i) / table_size);
+		}
+		return result;
+	}
+}	// anonymous-namespace
+
+int main() {
+#ifndef SPROUT_CONFIG_DISABLE_CXX14_CONSTEXPR
+	SPROUT_STATIC_CONSTEXPR table_type compiled = make_table(1);
+	std::cout << "compile time table: " << compiled[table_size / 4] << std::endl;
+#endif
+	// kept opaque so that the optimizer cannot fold the run time table as well
+	double volatile amplitude = 1;
+	std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+	table_type const computed = make_table(amplitude);
+	std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+	std::cout << "run time table: " << computed[table_size / 4] << " in " << elapsed.count() * 1000 << " ms" << std::endl;
+}
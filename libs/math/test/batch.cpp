@@ -0,0 +1,241 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_LIBS_MATH_TEST_BATCH_CPP
+#define SPROUT_LIBS_MATH_TEST_BATCH_CPP
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <list>
+#include <sprout/math/batch.hpp>
+#include <sprout/math/simd.hpp>
+#include <testspr/tools.hpp>
+
+namespace testspr {
+	namespace batch_detail {
+		// error of got in units of the last place of the T nearest to exact
+		template<typename T>
+		inline double ulps(T got, long double exact) {
+			T const nearest = static_cast<T>(exact);
+			if (!(std::fabs(nearest) < std::numeric_limits<T>::infinity())) {
+				return got == nearest || (got != got && nearest != nearest) ? 0 : std::numeric_limits<double>::infinity();
+			}
+			T const ulp = std::nextafter(std::fabs(nearest), std::numeric_limits<T>::infinity()) - std::fabs(nearest);
+			return static_cast<double>(std::fabs(static_cast<long double>(got) - exact) / ulp);
+		}
+		// the largest error of the batch over n points spread evenly over [lo, hi]
+		template<typename T, typename F, typename G>
+		inline double max_ulps(F f, G exact, T lo, T hi) {
+			std::size_t const n = 20001;
+			std::vector<T> x(n);
+			std::vector<T> y(n);
+			for (std::size_t i = 0; i != n; ++i) {
+				x[i] = lo + (hi - lo) * static_cast<T>(i) / (n - 1);
+			}
+			f(x.data(), x.data() + n, y.data());
+			double result = 0;
+			for (std::size_t i = 0; i != n; ++i) {
+				double const e = ulps(y[i], exact(static_cast<long double>(x[i])));
+				result = e > result ? e : result;
+			}
+			return result;
+		}
+
+		struct batch_sin {
+		public:
+			template<typename T>
+			void operator()(T const* first, T const* last, T* result) const {
+				sprout::math::sin(first, last, result);
+			}
+		};
+		struct batch_cos {
+		public:
+			template<typename T>
+			void operator()(T const* first, T const* last, T* result) const {
+				sprout::math::cos(first, last, result);
+			}
+		};
+		struct batch_exp {
+		public:
+			template<typename T>
+			void operator()(T const* first, T const* last, T* result) const {
+				sprout::math::exp(first, last, result);
+			}
+		};
+		struct batch_log {
+		public:
+			template<typename T>
+			void operator()(T const* first, T const* last, T* result) const {
+				sprout::math::log(first, last, result);
+			}
+		};
+		struct batch_sqrt {
+		public:
+			template<typename T>
+			void operator()(T const* first, T const* last, T* result) const {
+				sprout::math::sqrt(first, last, result);
+			}
+		};
+
+		inline long double exact_sin(long double x) {
+			return std::sin(x);
+		}
+		inline long double exact_cos(long double x) {
+			return std::cos(x);
+		}
+		inline long double exact_exp(long double x) {
+			return std::exp(x);
+		}
+		inline long double exact_log(long double x) {
+			return std::log(x);
+		}
+		inline long double exact_sqrt(long double x) {
+			return std::sqrt(x);
+		}
+
+		// every element against the scalar function
+		template<typename F, typename G>
+		inline bool same_as_scalar(F f, G scalar, std::vector<double> const& x) {
+			std::vector<double> y(x.size());
+			f(x.data(), x.data() + x.size(), y.data());
+			for (std::size_t i = 0; i != x.size(); ++i) {
+				double const expected = scalar(x[i]);
+				if (!(y[i] == expected || (y[i] != y[i] && expected != expected))) {
+					return false;
+				}
+			}
+			return true;
+		}
+		// the same, overwriting the input
+		template<typename F, typename G>
+		inline bool same_as_scalar_in_place(F f, G scalar, std::vector<double> const& x) {
+			std::vector<double> y(x);
+			f(y.data(), y.data() + y.size(), y.data());
+			for (std::size_t i = 0; i != x.size(); ++i) {
+				double const expected = scalar(x[i]);
+				if (!(y[i] == expected || (y[i] != y[i] && expected != expected))) {
+					return false;
+				}
+			}
+			return true;
+		}
+		inline double scalar_sin(double x) {
+			return sprout::math::sin(x);
+		}
+		inline double scalar_cos(double x) {
+			return sprout::math::cos(x);
+		}
+		inline double scalar_exp(double x) {
+			return sprout::math::exp(x);
+		}
+		inline double scalar_log(double x) {
+			return sprout::math::log(x);
+		}
+	}	// namespace batch_detail
+
+	static void batch_test() {
+		using namespace testspr::batch_detail;
+		// the vector kernels
+		{
+			TESTSPR_ASSERT(max_ulps(batch_sin(), &exact_sin, -10.0, 10.0) <= 4);
+			TESTSPR_ASSERT(max_ulps(batch_sin(), &exact_sin, -1e6, 1e6) <= 4);
+			TESTSPR_ASSERT(max_ulps(batch_cos(), &exact_cos, -10.0, 10.0) <= 4);
+			TESTSPR_ASSERT(max_ulps(batch_cos(), &exact_cos, -1e6, 1e6) <= 4);
+			TESTSPR_ASSERT(max_ulps(batch_exp(), &exact_exp, -700.0, 700.0) <= 4);
+			TESTSPR_ASSERT(max_ulps(batch_exp(), &exact_exp, -1.0, 1.0) <= 4);
+			TESTSPR_ASSERT(max_ulps(batch_log(), &exact_log, 1e-300, 1e6) <= 4);
+			TESTSPR_ASSERT(max_ulps(batch_log(), &exact_log, 0.5, 2.0) <= 4);
+			TESTSPR_ASSERT(max_ulps(batch_sqrt(), &exact_sqrt, 0.0, 1e6) <= 0.5);
+		}
+		{
+			TESTSPR_ASSERT(max_ulps(batch_sin(), &exact_sin, -10.0f, 10.0f) <= 4);
+			TESTSPR_ASSERT(max_ulps(batch_cos(), &exact_cos, -10.0f, 10.0f) <= 4);
+			TESTSPR_ASSERT(max_ulps(batch_exp(), &exact_exp, -80.0f, 80.0f) <= 4);
+			TESTSPR_ASSERT(max_ulps(batch_log(), &exact_log, 1e-30f, 1e6f) <= 4);
+			TESTSPR_ASSERT(max_ulps(batch_sqrt(), &exact_sqrt, 0.0f, 1e6f) <= 0.5);
+		}
+		// the lanes left to the scalar functions
+		{
+			double const inf = std::numeric_limits<double>::infinity();
+			std::vector<double> x;
+			x.push_back(std::numeric_limits<double>::quiet_NaN());
+			x.push_back(inf);
+			x.push_back(-inf);
+			x.push_back(0.0);
+			x.push_back(-0.0);
+			x.push_back(1e-320);
+			x.push_back(-1.0);
+			x.push_back(1e22);
+			x.push_back(-3e15);
+			x.push_back(709.5);
+			x.push_back(-745.0);
+			x.push_back(-800.0);
+			x.push_back(1e308);
+			TESTSPR_ASSERT(same_as_scalar(batch_sin(), &scalar_sin, x));
+			TESTSPR_ASSERT(same_as_scalar(batch_cos(), &scalar_cos, x));
+			TESTSPR_ASSERT(same_as_scalar(batch_exp(), &scalar_exp, x));
+			TESTSPR_ASSERT(same_as_scalar(batch_log(), &scalar_log, x));
+			x.push_back(1e300);
+			x.push_back(800.0);
+			x.push_back(0.5);
+			TESTSPR_ASSERT(same_as_scalar_in_place(batch_sin(), &scalar_sin, x));
+			TESTSPR_ASSERT(same_as_scalar_in_place(batch_cos(), &scalar_cos, x));
+			TESTSPR_ASSERT(same_as_scalar_in_place(batch_exp(), &scalar_exp, x));
+			TESTSPR_ASSERT(same_as_scalar_in_place(batch_log(), &scalar_log, x));
+		}
+		// tails, in place and other iterators
+		{
+			double x[7] = {0.5, 1, 1.5, 2, 2.5, 3, 3.5};
+			double* const end = sprout::math::log(x, x + 7, x);
+			TESTSPR_ASSERT(end == x + 7);
+			TESTSPR_ASSERT(ulps(x[6], std::log(3.5L)) <= 4);
+			sprout::math::exp(x, x + 7, x);
+			TESTSPR_ASSERT(ulps(x[0], 0.5L) <= 8 && ulps(x[6], 3.5L) <= 8);
+
+			std::list<double> l(3, 0.0);
+			std::vector<double> y(3);
+			TESTSPR_ASSERT(sprout::math::cos(l.begin(), l.end(), y.begin()) == y.end());
+			TESTSPR_ASSERT(y[0] == 1 && y[2] == 1);
+
+			long double z[3] = {1, 4, 9};
+			sprout::math::sqrt(z, z + 3, z);
+			TESTSPR_ASSERT(z[0] == 1 && z[1] == 2 && z[2] == 3);
+		}
+		// simd
+		{
+			SPROUT_STATIC_CONSTEXPR sprout::math::simd<double, 4> a = {{1, 2, 3, 4}};
+			SPROUT_STATIC_CONSTEXPR sprout::math::simd<double, 4> b = a * 2.0 + a - 1.0;
+			TESTSPR_BOTH_ASSERT(b[0] == 2 && b[3] == 11);
+			TESTSPR_BOTH_ASSERT((-a / a == sprout::math::broadcast<4>(-1.0)));
+			TESTSPR_BOTH_ASSERT((a != b));
+			TESTSPR_BOTH_ASSERT(a.size() == 4);
+
+			SPROUT_STATIC_CONSTEXPR sprout::math::simd<double, 4> s = sprout::math::sqrt(a * a);
+			TESTSPR_BOTH_ASSERT(s == a);
+			SPROUT_STATIC_CONSTEXPR sprout::math::simd<double, 4> e = sprout::math::exp(a);
+			TESTSPR_BOTH_ASSERT(e[1] == sprout::math::exp(2.0));
+
+			// at run time
+			sprout::math::simd<double, 4> r = a;
+			r = sprout::math::sin(r);
+			for (std::size_t i = 0; i != r.size(); ++i) {
+				TESTSPR_ASSERT(ulps(r[i], std::sin(static_cast<long double>(a[i]))) <= 4);
+			}
+			sprout::math::simd<float, 3> f = {{1, 2, 3}};
+			f = sprout::math::log(f);
+			TESTSPR_ASSERT(ulps(f[2], std::log(3.0L)) <= 4);
+		}
+	}
+}	// namespace testspr
+
+#ifndef TESTSPR_CPP_INCLUDE
+#	define TESTSPR_TEST_FUNCTION testspr::batch_test
+#	include <testspr/include_main.hpp>
+#endif
+
+#endif	// #ifndef SPROUT_LIBS_MATH_TEST_BATCH_CPP
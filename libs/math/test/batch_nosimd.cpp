@@ -0,0 +1,14 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+//
+// The batch tests built without the vector kernels, as on targets other than
+// x86. It must come before any Sprout header, so it is not part of testspr/sprout.cpp.
+//
+#define SPROUT_CONFIG_DISABLE_SIMD
+#include <sprout/math.hpp>
+#include "./batch.cpp"
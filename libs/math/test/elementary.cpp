@@ -0,0 +1,151 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_LIBS_MATH_TEST_ELEMENTARY_CPP
+#define SPROUT_LIBS_MATH_TEST_ELEMENTARY_CPP
+
+#include <cmath>
+#include <limits>
+#include <sprout/math/exp.hpp>
+#include <sprout/math/log.hpp>
+#include <sprout/math/sin.hpp>
+#include <sprout/math/cos.hpp>
+#include <sprout/math/tan.hpp>
+#include <sprout/math/atan.hpp>
+#include <sprout/math/pow.hpp>
+#include <testspr/tools.hpp>
+
+namespace testspr {
+	namespace elementary_detail {
+		// error of got in units of the last place of the double nearest to exact
+		inline double ulps(double got, long double exact) {
+			double const nearest = static_cast<double>(exact);
+			double const ulp = std::nextafter(std::fabs(nearest), std::numeric_limits<double>::infinity()) - std::fabs(nearest);
+			return static_cast<double>(std::fabs(static_cast<long double>(got) - exact) / ulp);
+		}
+		// the largest error over points spread evenly (or, with geometric, by ratio) over [lo, hi]
+		template<typename F, typename G>
+		inline double max_ulps(F f, G exact, double lo, double hi, bool geometric = false) {
+			double result = 0;
+			std::size_t const n = 20000;
+			for (std::size_t i = 0; i <= n; ++i) {
+				double const t = static_cast<double>(i) / n;
+				double const x = geometric ? lo * std::pow(hi / lo, t) : lo + (hi - lo) * t;
+				double const e = ulps(f(x), exact(static_cast<long double>(x)));
+				result = e > result ? e : result;
+			}
+			return result;
+		}
+
+		inline double fallback_exp(double x) {
+			return sprout::math::detail::exp_impl(x);
+		}
+		inline double fallback_log(double x) {
+			return sprout::math::detail::log_impl(x);
+		}
+		inline double fallback_sin(double x) {
+			return sprout::math::detail::sin_impl(x);
+		}
+		inline double fallback_cos(double x) {
+			return sprout::math::detail::cos_impl(x);
+		}
+		inline double fallback_tan(double x) {
+			return sprout::math::detail::tan_impl(x);
+		}
+		inline double fallback_atan(double x) {
+			return sprout::math::detail::atan_impl(x);
+		}
+		inline double fallback_pow_3_7(double x) {
+			return sprout::math::detail::pow_impl(x, 3.7);
+		}
+		inline double fallback_pow_1_001(double y) {
+			return sprout::math::detail::pow_impl(1.001, y);
+		}
+
+		inline long double exact_exp(long double x) {
+			return std::exp(x);
+		}
+		inline long double exact_log(long double x) {
+			return std::log(x);
+		}
+		inline long double exact_sin(long double x) {
+			return std::sin(x);
+		}
+		inline long double exact_cos(long double x) {
+			return std::cos(x);
+		}
+		inline long double exact_tan(long double x) {
+			return std::tan(x);
+		}
+		inline long double exact_atan(long double x) {
+			return std::atan(x);
+		}
+		inline long double exact_pow_3_7(long double x) {
+			return std::pow(x, static_cast<long double>(3.7));
+		}
+		inline long double exact_pow_1_001(long double y) {
+			return std::pow(static_cast<long double>(1.001), y);
+		}
+	}	// namespace elementary_detail
+
+	static void elementary_test() {
+		using namespace testspr::elementary_detail;
+		// the fallback implementations, called directly so that the builtins do not hide them
+		{
+			TESTSPR_ASSERT(max_ulps(&fallback_exp, &exact_exp, -745, 709) <= 1);
+			TESTSPR_ASSERT(max_ulps(&fallback_exp, &exact_exp, -1, 1) <= 1);
+			TESTSPR_ASSERT(max_ulps(&fallback_log, &exact_log, 0.5, 2) <= 1);
+			TESTSPR_ASSERT(max_ulps(&fallback_log, &exact_log, 1e-300, 1e300, true) <= 1);
+			TESTSPR_ASSERT(max_ulps(&fallback_log, &exact_log, 1e-320, 1e-308, true) <= 1);
+			TESTSPR_ASSERT(max_ulps(&fallback_atan, &exact_atan, 0, 4) <= 1);
+			TESTSPR_ASSERT(max_ulps(&fallback_atan, &exact_atan, 1e-10, 1e10, true) <= 1);
+			TESTSPR_ASSERT(max_ulps(&fallback_pow_3_7, &exact_pow_3_7, 1e-80, 1e80, true) <= 2);
+			TESTSPR_ASSERT(max_ulps(&fallback_pow_1_001, &exact_pow_1_001, -7e5, 7e5) <= 2);
+		}
+		{
+			TESTSPR_ASSERT(max_ulps(&fallback_sin, &exact_sin, -10, 10) <= 1);
+			TESTSPR_ASSERT(max_ulps(&fallback_cos, &exact_cos, -10, 10) <= 1);
+			TESTSPR_ASSERT(max_ulps(&fallback_tan, &exact_tan, -10, 10) <= 2);
+			// Cody-Waite and Payne-Hanek reduction
+			TESTSPR_ASSERT(max_ulps(&fallback_sin, &exact_sin, 1e3, 1e6, true) <= 1);
+			TESTSPR_ASSERT(max_ulps(&fallback_cos, &exact_cos, 1e6, 1e300, true) <= 1);
+			TESTSPR_ASSERT(max_ulps(&fallback_tan, &exact_tan, 1e6, 1e300, true) <= 2);
+			// the double closest to a multiple of pi/2
+			double const hard = 6381956970095103.0 * std::ldexp(1.0, 797);
+			TESTSPR_ASSERT(ulps(fallback_sin(hard), exact_sin(hard)) <= 1);
+			TESTSPR_ASSERT(ulps(fallback_cos(hard), exact_cos(hard)) <= 1);
+			TESTSPR_ASSERT(ulps(fallback_sin(1e22), exact_sin(1e22)) <= 1);
+		}
+		{
+			TESTSPR_ASSERT(sprout::math::detail::pow_impl(-2.0, 3.0) == -8);
+			TESTSPR_ASSERT(ulps(sprout::math::detail::pow_impl(2.0, 0.5), std::sqrt(2.0L)) <= 1);
+			TESTSPR_ASSERT(fallback_exp(710) == std::numeric_limits<double>::infinity());
+			TESTSPR_ASSERT(fallback_exp(-746) == 0);
+			TESTSPR_ASSERT(fallback_log(1) == 0);
+		}
+		// constant expressions
+		{
+			SPROUT_STATIC_CONSTEXPR double e = sprout::math::detail::exp_impl(0.5);
+			SPROUT_STATIC_CONSTEXPR double l = sprout::math::detail::log_impl(10.0);
+			SPROUT_STATIC_CONSTEXPR double s = sprout::math::detail::sin_impl(1e22);
+			SPROUT_STATIC_CONSTEXPR double c = sprout::math::detail::cos_impl(3.0);
+			SPROUT_STATIC_CONSTEXPR double a = sprout::math::detail::atan_impl(1.0);
+			TESTSPR_BOTH_ASSERT(e == 1.6487212707001282);
+			TESTSPR_BOTH_ASSERT(l == 2.302585092994046);
+			TESTSPR_BOTH_ASSERT(s == -0.8522008497671888);
+			TESTSPR_BOTH_ASSERT(c == -0.9899924966004454);
+			TESTSPR_BOTH_ASSERT(a == 0.7853981633974483);
+		}
+	}
+}	// namespace testspr
+
+#ifndef TESTSPR_CPP_INCLUDE
+#	define TESTSPR_TEST_FUNCTION testspr::elementary_test
+#	include <testspr/include_main.hpp>
+#endif
+
+#endif	// #ifndef SPROUT_LIBS_MATH_TEST_ELEMENTARY_CPP
@@ -0,0 +1,90 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_LIBS_MATH_TEST_QUATERNION_SOA_CPP
+#define SPROUT_LIBS_MATH_TEST_QUATERNION_SOA_CPP
+
+#include <cmath>
+#include <vector>
+#include <sprout/array.hpp>
+#include <sprout/math/quaternion.hpp>
+#include <testspr/tools.hpp>
+
+namespace testspr {
+	static void quat_soa_test() {
+		using namespace sprout;
+		typedef sprout::math::quaternion<double> quaternion_type;
+		{
+			SPROUT_STATIC_CONSTEXPR auto a = sprout::math::quat_soa<double, 4>{{1, 0, 1, -2}, {2, 1, 0, 0}, {3, 0, 0, 1}, {4, 0, 1, 3}};
+			SPROUT_STATIC_CONSTEXPR auto b = sprout::math::quat_soa<double, 4>{{0, 0, 2, 1}, {1, 1, 0, -1}, {0, 1, 1, 2}, {0, 0, 0, 0}};
+			SPROUT_STATIC_CONSTEXPR auto aos = sprout::array<quaternion_type, 4>{{
+				quaternion_type(1, 2, 3, 4), quaternion_type(0, 1, 0, 0), quaternion_type(1, 0, 0, 1), quaternion_type(-2, 0, 1, 3)
+				}};
+
+			// view
+			TESTSPR_BOTH_ASSERT(a.size() == 4);
+			TESTSPR_BOTH_ASSERT(a[0] == quaternion_type(1, 2, 3, 4));
+			TESTSPR_BOTH_ASSERT(a[3] == quaternion_type(-2, 0, 1, 3));
+			TESTSPR_BOTH_ASSERT(sprout::math::make_quat_soa(aos) == a);
+
+			// qmul
+			{
+				SPROUT_STATIC_CONSTEXPR auto result = sprout::math::qmul(a, b);
+				TESTSPR_BOTH_ASSERT(result[0] == a[0] * b[0]);
+				TESTSPR_BOTH_ASSERT(result[1] == quaternion_type(-1, 0, 0, 1));
+				TESTSPR_BOTH_ASSERT(result[3] == a[3] * b[3]);
+				TESTSPR_ASSERT(sprout::math::qmul(a, b) == result);
+			}
+			// normalize
+			{
+				SPROUT_STATIC_CONSTEXPR auto result = sprout::math::normalize(a);
+				TESTSPR_BOTH_ASSERT(result[1] == quaternion_type(0, 1, 0, 0));
+				sprout::math::quat_soa<double, 4> const runtime = sprout::math::normalize(a);
+				for (std::size_t i = 0; i != 4; ++i) {
+					TESTSPR_ASSERT(std::abs(runtime.a[i] * runtime.a[i] + runtime.b[i] * runtime.b[i] + runtime.c[i] * runtime.c[i] + runtime.d[i] * runtime.d[i] - 1) <= 1e-15);
+					TESTSPR_ASSERT(std::abs(runtime.d[i] - result.d[i]) <= 1e-15);
+				}
+			}
+		}
+		{
+			// spans: every block width and the scalar tail, in place
+			std::size_t const n = 37;
+			std::vector<double> a(n), b(n), c(n), d(n), ra(n), rb(n), rc(n), rd(n);
+			for (std::size_t i = 0; i != n; ++i) {
+				a[i] = static_cast<double>(i % 7) - 3;
+				b[i] = static_cast<double>(i % 5) - 2;
+				c[i] = static_cast<double>(i % 3) + 1;
+				d[i] = static_cast<double>(i % 11) - 5;
+			}
+			sprout::math::quat_soa_span<double const> const x(a.data(), b.data(), c.data(), d.data(), n);
+			sprout::math::quat_soa_span<double> const r(ra.data(), rb.data(), rc.data(), rd.data(), n);
+
+			sprout::math::qmul(x, x, r);
+			for (std::size_t i = 0; i != n; ++i) {
+				TESTSPR_ASSERT(r[i] == x[i] * x[i]);
+			}
+			sprout::math::qmul(r, x, r);
+			for (std::size_t i = 0; i != n; ++i) {
+				TESTSPR_ASSERT(r[i] == x[i] * x[i] * x[i]);
+			}
+			sprout::math::normalize(x, r);
+			for (std::size_t i = 0; i != n; ++i) {
+				double const len = std::sqrt(a[i] * a[i] + b[i] * b[i] + c[i] * c[i] + d[i] * d[i]);
+				TESTSPR_ASSERT(std::abs(ra[i] - a[i] / len) <= 1e-15);
+				TESTSPR_ASSERT(std::abs(rd[i] - d[i] / len) <= 1e-15);
+			}
+			TESTSPR_ASSERT(r.subspan(3, 4)[1] == r[4]);
+		}
+	}
+}	// namespace testspr
+
+#ifndef TESTSPR_CPP_INCLUDE
+#	define TESTSPR_TEST_FUNCTION testspr::quat_soa_test
+#	include <testspr/include_main.hpp>
+#endif
+
+#endif	// #ifndef SPROUT_LIBS_MATH_TEST_QUATERNION_SOA_CPP
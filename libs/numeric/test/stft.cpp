@@ -0,0 +1,138 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_LIBS_NUMERIC_TEST_STFT_CPP
+#define SPROUT_LIBS_NUMERIC_TEST_STFT_CPP
+
+#include <cmath>
+#include <vector>
+#include <sprout/array.hpp>
+#include <sprout/complex.hpp>
+#include <sprout/numeric/stft.hpp>
+#include <sprout/numeric/stft/parallel.hpp>
+#include <testspr/tools.hpp>
+
+namespace testspr {
+	namespace stft_detail {
+		template<typename Frames>
+		struct push_frame {
+		public:
+			Frames* frames;
+		public:
+			template<typename Frame>
+			void operator()(Frame const& frame) const {
+				frames->push_back(frame);
+			}
+		};
+		template<typename T, std::size_t N, typename Synthesizer>
+		struct synthesize {
+		public:
+			Synthesizer* synthesizer;
+			std::vector<T>* out;
+		public:
+			void operator()(sprout::array<sprout::complex<T>, N>& frame) const {
+				out->resize(out->size() + synthesizer->hop());
+				synthesizer->process(frame, out->end() - synthesizer->hop());
+			}
+		};
+
+		template<typename T>
+		std::vector<T> signal(std::size_t size) {
+			std::vector<T> result(size);
+			for (std::size_t i = 0; i != size; ++i) {
+				result[i] = static_cast<T>(std::sin(0.37 * i) + 0.5 * std::cos(0.05 * i * i) - 0.25);
+			}
+			return result;
+		}
+
+		// streaming: the output is the input delayed by N - hop samples
+		template<typename T, std::size_t N, typename Window>
+		void streaming_round_trip(std::size_t hop, std::size_t size, T tolerance) {
+			typedef sprout::stft_synthesizer<T, N, Window> synthesizer_type;
+			std::vector<T> const in = signal<T>(size);
+			std::vector<T> padded(in);
+			padded.resize((size + N - 1) / hop * hop);
+			sprout::stft_analyzer<T, N, Window> analyzer(hop);
+			synthesizer_type synthesizer(hop);
+			std::vector<T> out;
+			synthesize<T, N, synthesizer_type> f = {&synthesizer, &out};
+			analyzer.process(padded.begin(), padded.end(), f);
+			TESTSPR_ASSERT(out.size() == padded.size());
+			for (std::size_t i = 0; i != N - hop; ++i) {
+				TESTSPR_ASSERT(std::abs(out[i]) < tolerance);
+			}
+			for (std::size_t i = 0; i != size; ++i) {
+				TESTSPR_ASSERT(std::abs(out[i + N - hop] - in[i]) < tolerance);
+			}
+		}
+
+		// parallel: the frames of the streaming analyzer, and the input back aligned
+		template<typename T, std::size_t N, typename Window>
+		void parallel_round_trip(std::size_t hop, std::size_t size, unsigned threads, T tolerance) {
+			typedef sprout::array<sprout::complex<T>, N> frame_type;
+			std::vector<T> const in = signal<T>(size);
+			std::size_t const count = sprout::stft_frame_count(size, N, hop);
+			std::vector<frame_type> frames(count);
+			TESTSPR_ASSERT((sprout::parallel_stft<T, N, Window>(in.begin(), in.end(), hop, frames.begin(), threads) == frames.end()));
+
+			std::vector<T> padded(in);
+			padded.resize((size + N - 1) / hop * hop);
+			std::vector<frame_type> expected;
+			sprout::stft_analyzer<T, N, Window> analyzer(hop);
+			push_frame<std::vector<frame_type> > f = {&expected};
+			analyzer.process(padded.begin(), padded.end(), f);
+			TESTSPR_ASSERT(expected.size() == count);
+			for (std::size_t j = 0; j != count; ++j) {
+				for (std::size_t k = 0; k != N; ++k) {
+					TESTSPR_ASSERT(sprout::abs(frames[j][k] - expected[j][k]) < tolerance);
+				}
+			}
+
+			std::size_t const length = (count - N / hop + 1) * hop;
+			TESTSPR_ASSERT(length == (size + hop - 1) / hop * hop);
+			std::vector<T> out(length);
+			TESTSPR_ASSERT((sprout::parallel_istft<T, N, Window>(frames.begin(), frames.end(), hop, out.begin(), threads) == out.end()));
+			for (std::size_t i = 0; i != length; ++i) {
+				TESTSPR_ASSERT(std::abs(out[i] - (i < size ? in[i] : T())) < tolerance);
+			}
+		}
+	}	// namespace stft_detail
+
+	static void stft_test() {
+		{
+			// periodic windows
+			TESTSPR_BOTH_ASSERT((sprout::window_table<sprout::hann_window, double, 8>::table[0] == 0));
+			TESTSPR_BOTH_ASSERT((sprout::window_table<sprout::hann_window, double, 8>::table[4] == 1));
+			TESTSPR_BOTH_ASSERT((sprout::window_table<sprout::rectangular_window, double, 8>::table[7] == 1));
+			TESTSPR_ASSERT(sprout::stft_frame_count(100, 64, 16) == 10);
+			TESTSPR_ASSERT(sprout::stft_frame_count(96, 64, 16) == 9);
+		}
+		{
+			// STFT -> ISTFT reconstruction with weighted overlap-add
+			stft_detail::streaming_round_trip<double, 64, sprout::hann_window>(16, 300, 1e-12);
+			stft_detail::streaming_round_trip<double, 64, sprout::hann_window>(32, 301, 1e-12);
+			stft_detail::streaming_round_trip<double, 32, sprout::hamming_window>(8, 257, 1e-12);
+			stft_detail::streaming_round_trip<double, 64, sprout::blackman_window>(16, 200, 1e-12);
+			stft_detail::streaming_round_trip<double, 16, sprout::rectangular_window>(16, 100, 1e-12);
+			stft_detail::streaming_round_trip<float, 64, sprout::hann_window>(16, 300, 1e-5f);
+
+			stft_detail::parallel_round_trip<double, 64, sprout::hann_window>(16, 300, 1, 1e-12);
+			stft_detail::parallel_round_trip<double, 64, sprout::hann_window>(16, 300, 3, 1e-12);
+			stft_detail::parallel_round_trip<double, 64, sprout::hann_window>(32, 320, 4, 1e-12);
+			stft_detail::parallel_round_trip<double, 32, sprout::hamming_window>(8, 257, 2, 1e-12);
+			stft_detail::parallel_round_trip<double, 64, sprout::blackman_window>(16, 33, 5, 1e-12);
+			stft_detail::parallel_round_trip<float, 64, sprout::hann_window>(16, 300, 3, 1e-5f);
+		}
+	}
+}	// namespace testspr
+
+#ifndef TESTSPR_CPP_INCLUDE
+#	define TESTSPR_TEST_FUNCTION testspr::stft_test
+#	include <testspr/include_main.hpp>
+#endif
+
+#endif	// #ifndef SPROUT_LIBS_NUMERIC_TEST_STFT_CPP
@@ -0,0 +1,75 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+//
+// Walks every field of a 64 MiB CSV export with the csv_records/csv_fields
+// and lines/split adaptors, and with a hand-written byte loop for reference.
+//
+#include <string>
+#include <chrono>
+#include <iostream>
+#include <sprout/range/adaptor/string.hpp>
+#include <sprout/utility/string_view.hpp>
+
+namespace {
+	template<typename F>
+	void measure(char const* name, std::size_t bytes, F f) {
+		std::size_t sink = 0;
+		std::size_t const rounds = 4;
+		std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+		for (std::size_t r = 0; r != rounds; ++r) {
+			sink += f();
+		}
+		std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+		std::cout << "  " << name << ": " << bytes * rounds / elapsed.count() / (1 << 20) << " MiB/s (" << sink / rounds << " fields)" << std::endl;
+	}
+}	// anonymous-namespace
+
+int main() {
+	std::string text;
+	for (unsigned i = 0; text.size() < (64u << 20); ++i) {
+		text += std::to_string(i) + ",customer-" + std::to_string(i * 2654435761u % 100000)
+			+ ",\"Street " + std::to_string(i % 977) + ", Springfield\","
+			+ std::to_string(i % 13) + "." + std::to_string(i % 100) + ",2019-01-" + std::to_string(1 + i % 28)
+			+ ",some longer free text column that is mostly filler to make rows realistic\n";
+	}
+	sprout::string_view const csv(text.data(), text.size());
+
+	measure("csv_records | csv_fields", text.size(), [&]() {
+		std::size_t n = 0;
+		for (sprout::string_view const record : csv | sprout::adaptors::csv_records()) {
+			for (sprout::string_view const field : record | sprout::adaptors::csv_fields()) {
+				n += field.size() != 0;
+			}
+		}
+		return n;
+	});
+	measure("lines | split           ", text.size(), [&]() {
+		std::size_t n = 0;
+		for (sprout::string_view const line : csv | sprout::adaptors::lines) {
+			for (sprout::string_view const field : line | sprout::adaptors::split(',')) {
+				n += field.size() != 0;
+			}
+		}
+		return n;
+	});
+	measure("byte loop               ", text.size(), [&]() {
+		std::size_t n = 0;
+		std::size_t length = 0;
+		for (std::size_t i = 0; i != text.size(); ++i) {
+			char const c = text[i];
+			if (c == ',' || c == '\n') {
+				n += length != 0;
+				length = 0;
+			} else {
+				++length;
+			}
+		}
+		return n;
+	});
+	return 0;
+}
@@ -0,0 +1,100 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_LIBS_RANGE_TEST_SPLIT_CPP
+#define SPROUT_LIBS_RANGE_TEST_SPLIT_CPP
+
+#include <string>
+#include <vector>
+#include <sprout/range/adaptor/string.hpp>
+#include <sprout/utility/string_view.hpp>
+#include <sprout/string.hpp>
+#include <testspr/tools.hpp>
+
+namespace testspr {
+	namespace split_detail {
+		template<typename Range>
+		inline std::string joined(Range const& range) {
+			std::string result;
+			for (typename Range::iterator it = range.begin(); it != range.end(); ++it) {
+				result += '[';
+				result.append((*it).data(), (*it).size());
+				result += ']';
+			}
+			return result;
+		}
+#ifndef SPROUT_CONFIG_DISABLE_CXX14_CONSTEXPR
+		inline SPROUT_CXX14_CONSTEXPR std::size_t csv_checksum(sprout::string_view text) {
+			std::size_t result = 0;
+			for (sprout::string_view const record : text | sprout::adaptors::csv_records()) {
+				for (sprout::string_view const field : record | sprout::adaptors::csv_fields()) {
+					result = result * 10 + field.size();
+				}
+			}
+			return result;
+		}
+#endif
+	}	// namespace split_detail
+
+	static void split_test() {
+		using namespace sprout;
+		using testspr::split_detail::joined;
+		{
+			sprout::string_view const s("a,b,,c,");
+			TESTSPR_ASSERT(joined(s | sprout::adaptors::split(',')) == "[a][b][][c][]");
+			TESTSPR_ASSERT(joined(sprout::string_view("") | sprout::adaptors::split(',')) == "");
+			TESTSPR_ASSERT(joined(sprout::string_view(",") | sprout::adaptors::split(',')) == "[][]");
+			TESTSPR_ASSERT(joined(sprout::string_view("a::b:c::") | sprout::adaptors::split("::")) == "[a][b:c][]");
+			TESTSPR_ASSERT((s | sprout::adaptors::split(',')).size() == 5);
+			TESTSPR_ASSERT((*(s | sprout::adaptors::split(',')).begin()).data() == s.data());
+			sprout::string<5> const t = sprout::to_string("x;y;z");
+			TESTSPR_ASSERT(joined(t | sprout::adaptors::split(';')) == "[x][y][z]");
+		}
+		{
+			// separators past the vectorized stride
+			std::string text(100, 'a');
+			text[40] = ',';
+			text[99] = ',';
+			TESTSPR_ASSERT(joined(text | sprout::adaptors::split(',')) == "[" + std::string(40, 'a') + "][" + std::string(58, 'a') + "][]");
+		}
+		{
+			TESTSPR_ASSERT(joined(sprout::string_view("  hello \t world  ") | sprout::adaptors::tokenized(" \t")) == "[hello][world]");
+			TESTSPR_ASSERT(joined(sprout::string_view(" \t ") | sprout::adaptors::tokenized(" \t")) == "");
+			TESTSPR_ASSERT(joined(sprout::string_view("a-b+c*d/e") | sprout::adaptors::tokenized("+-*/")) == "[a][b][c][d][e]");
+			TESTSPR_ASSERT(joined(sprout::string_view("a1b2c3d4e5f") | sprout::adaptors::tokenized("12345")) == "[a][b][c][d][e][f]");
+		}
+		{
+			TESTSPR_ASSERT(joined(sprout::string_view("l1\r\nl2\n\nl4\n") | sprout::adaptors::lines) == "[l1][l2][][l4]");
+			TESTSPR_ASSERT(joined(sprout::string_view("l1\r\nl2") | sprout::adaptors::lines()) == "[l1][l2]");
+			TESTSPR_ASSERT(joined(sprout::string_view("\n") | sprout::adaptors::lines) == "[]");
+		}
+		{
+			std::string const text = "name,\"quoted, comma\",\"say \"\"hi\"\"\"\r\n\"multi\nline\",x,\n;\"a;b\";c";
+			std::vector<std::string> records;
+			for (sprout::string_view const record : text | sprout::adaptors::csv_records()) {
+				records.push_back(std::string(record.data(), record.size()));
+			}
+			TESTSPR_ASSERT(records.size() == 3);
+			TESTSPR_ASSERT(joined(records[0] | sprout::adaptors::csv_fields()) == "[name][quoted, comma][say \"\"hi\"\"]");
+			TESTSPR_ASSERT(joined(records[1] | sprout::adaptors::csv_fields()) == "[multi\nline][x][]");
+			TESTSPR_ASSERT(joined(records[2] | sprout::adaptors::csv_fields(';')) == "[][a;b][c]");
+		}
+#ifndef SPROUT_CONFIG_DISABLE_CXX14_CONSTEXPR
+		{
+			SPROUT_STATIC_CONSTEXPR std::size_t sum = testspr::split_detail::csv_checksum("ab,\"c\nd\",\r\n\"e\"\"f\",g");
+			TESTSPR_BOTH_ASSERT(sum == 23041);
+		}
+#endif
+	}
+}	// namespace testspr
+
+#ifndef TESTSPR_CPP_INCLUDE
+#	define TESTSPR_TEST_FUNCTION testspr::split_test
+#	include <testspr/include_main.hpp>
+#endif
+
+#endif	// #ifndef SPROUT_LIBS_RANGE_TEST_SPLIT_CPP
@@ -0,0 +1,81 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+//
+// Compares sprout::regex with std::regex over a synthetic log: whole-line
+// matches, and a search through a 1 MiB buffer for a pattern with a literal
+// prefix (SIMD prefilter) and one without (DFA only).
+//
+#include <string>
+#include <vector>
+#include <regex>
+#include <chrono>
+#include <iostream>
+#include <sprout/regex.hpp>
+
+namespace {
+	template<typename F>
+	void measure(char const* name, std::size_t bytes, std::size_t rounds, F f) {
+		std::size_t sink = 0;
+		std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+		for (std::size_t r = 0; r != rounds; ++r) {
+			sink += f();
+		}
+		std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+		std::cout << "  " << name << ": " << bytes * rounds / elapsed.count() / (1 << 20) << " MiB/s (" << (sink & 1) << ")" << std::endl;
+	}
+}	// anonymous-namespace
+
+int main() {
+	std::vector<std::string> lines;
+	std::string buffer;
+	for (unsigned i = 0; buffer.size() < (1u << 20); ++i) {
+		std::string const line = std::string(i % 7 == 0 ? "GET" : "POST") + " /api/v" + std::to_string(i % 3)
+			+ "/items/" + std::to_string(i * 2654435761u % 100000) + " HTTP/1.1 " + std::to_string(200 + i % 5) + " " + std::to_string(i % 9000);
+		lines.push_back(line);
+		buffer += line;
+		buffer += '\n';
+	}
+	std::size_t const line_bytes = buffer.size() - lines.size();
+	buffer += "ERROR disk full on /dev/sda1\n";
+
+	static sprout::regex<> const request("(GET|POST) /[a-z0-9/]+ HTTP/1\\.[01] [0-9]{3} [0-9]+");
+	std::regex const std_request("(GET|POST) /[a-z0-9/]+ HTTP/1\\.[01] [0-9]{3} [0-9]+");
+	std::cout << "line match:" << std::endl;
+	measure("sprout::regex", line_bytes, 20, [&]() {
+		std::size_t n = 0;
+		for (std::size_t i = 0; i != lines.size(); ++i) {
+			n += request.match(sprout::string_view(lines[i].data(), lines[i].size()));
+		}
+		return n;
+	});
+	measure("std::regex   ", line_bytes, 2, [&]() {
+		std::size_t n = 0;
+		for (std::size_t i = 0; i != lines.size(); ++i) {
+			n += std::regex_match(lines[i], std_request);
+		}
+		return n;
+	});
+
+	static sprout::regex<> const error("ERROR [a-z ]+ on /dev/[a-z]+[0-9]");
+	static sprout::regex<> const failure("[A-Z]{5} [a-z ]+ on /dev/[a-z]+[0-9]");
+	std::regex const std_error("ERROR [a-z ]+ on /dev/[a-z]+[0-9]");
+	sprout::string_view const text(buffer.data(), buffer.size());
+	std::cout << "search 1 MiB:" << std::endl;
+	measure("sprout::regex (prefix)   ", buffer.size(), 200, [&]() {
+		return error.find(text).first;
+	});
+	measure("sprout::regex (no prefix)", buffer.size(), 50, [&]() {
+		return failure.find(text).first;
+	});
+	measure("std::regex               ", buffer.size(), 1, [&]() {
+		std::smatch m;
+		std::regex_search(buffer, m, std_error);
+		return static_cast<std::size_t>(m.position(0));
+	});
+	return 0;
+}
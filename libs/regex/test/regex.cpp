@@ -0,0 +1,134 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_LIBS_REGEX_TEST_REGEX_CPP
+#define SPROUT_LIBS_REGEX_TEST_REGEX_CPP
+
+#include <stdexcept>
+#include <string>
+#include <sprout/regex.hpp>
+#include <sprout/utility/string_view.hpp>
+#include <testspr/tools.hpp>
+
+namespace testspr {
+	namespace regex_detail {
+		inline bool throws(char const* pattern) {
+			try {
+				sprout::regex<> const re(pattern);
+			} catch (std::invalid_argument const&) {
+				return true;
+			}
+			return false;
+		}
+	}	// namespace regex_detail
+
+	static void regex_test() {
+		using namespace sprout;
+		{
+			sprout::regex<> const re("[A-Za-z_][A-Za-z0-9_]*");
+			TESTSPR_ASSERT(re.match("foo_1"));
+			TESTSPR_ASSERT(re.match("_"));
+			TESTSPR_ASSERT(!re.match(""));
+			TESTSPR_ASSERT(!re.match("1foo"));
+			TESTSPR_ASSERT(!re.match("foo-bar"));
+			TESTSPR_ASSERT(re.search("  foo-bar"));
+			TESTSPR_ASSERT(!re.search("  123 "));
+			TESTSPR_ASSERT(re.find("  foo-bar").first == 2);
+			TESTSPR_ASSERT(re.find("  foo-bar").second == 3);
+			TESTSPR_ASSERT(re.find("  123 ").first == re.npos);
+		}
+		{
+			// operators, counted repetition and escapes
+			TESTSPR_ASSERT(sprout::regex<>("a(b|c)*d").match("abcbcd"));
+			TESTSPR_ASSERT(!sprout::regex<>("a(b|c)*d").match("abcbc"));
+			TESTSPR_ASSERT(sprout::regex<>("colou?r").match("color"));
+			TESTSPR_ASSERT(sprout::regex<>("colou?r").match("colour"));
+			TESTSPR_ASSERT(sprout::regex<>("a+").match("aaa"));
+			TESTSPR_ASSERT(!sprout::regex<>("a+").match(""));
+			TESTSPR_ASSERT(sprout::regex<>("x*").match(""));
+			TESTSPR_ASSERT(sprout::regex<>("a{3}").match("aaa"));
+			TESTSPR_ASSERT(!sprout::regex<>("a{3}").match("aa"));
+			TESTSPR_ASSERT(sprout::regex<>("a{2,}").match("aaaaa"));
+			TESTSPR_ASSERT(sprout::regex<>("(ab){1,2}").match("abab"));
+			TESTSPR_ASSERT(!sprout::regex<>("(ab){1,2}").match("ababab"));
+			TESTSPR_ASSERT(sprout::regex<>("\\d+\\.\\d*").match("3.14"));
+			TESTSPR_ASSERT(!sprout::regex<>("\\d+\\.\\d*").match("3x14"));
+			TESTSPR_ASSERT(sprout::regex<>("\\w+\\s\\W").match("a_1 !"));
+			TESTSPR_ASSERT(sprout::regex<>("[^\\d\\s]+").match("abc"));
+			TESTSPR_ASSERT(!sprout::regex<>("[^\\d\\s]+").match("a c"));
+			TESTSPR_ASSERT(sprout::regex<>("[]a-]+").match("]-a"));
+			TESTSPR_ASSERT(sprout::regex<>("\\x41.\\t").match("AB\t"));
+			TESTSPR_ASSERT(!sprout::regex<>(".").match("\n"));
+			TESTSPR_ASSERT(sprout::regex<>("a||b").match(""));
+			TESTSPR_ASSERT(sprout::regex<>("()").match(""));
+		}
+		{
+			// leftmost, then longest
+			sprout::regex<> const re("(a|ab)(c|bcd)(d*)");
+			TESTSPR_ASSERT(re.find("xabcd").first == 1);
+			TESTSPR_ASSERT(re.find("xabcd").second == 4);
+			TESTSPR_ASSERT(sprout::regex<>("a*b").find("xaaab").first == 1);
+			TESTSPR_ASSERT(sprout::regex<>("(abc)+").find("xxabcabcab").second == 6);
+			TESTSPR_ASSERT(sprout::regex<>("x*").find("yyy").first == 0);
+			TESTSPR_ASSERT(sprout::regex<>("x*").find("yyy").second == 0);
+		}
+		{
+			// literal prefix, long enough input for the vectorized scan
+			sprout::regex<> const re("ERROR [0-9]+:");
+			TESTSPR_ASSERT(re.literal_prefix() == sprout::string_view("ERROR "));
+			std::string text(1000, '.');
+			text += "ERROR x ERRO ERROR 42: ERROR 7:";
+			sprout::string_view const s(text.data(), text.size());
+			TESTSPR_ASSERT(re.search(s));
+			TESTSPR_ASSERT(re.find(s).first == 1013);
+			TESTSPR_ASSERT(re.find(s).second == 9);
+			TESTSPR_ASSERT(!re.search(s.substr(0, 1021)));
+			TESTSPR_ASSERT(sprout::regex<>("a|b").literal_prefix().empty());
+			TESTSPR_ASSERT(sprout::regex<>("abc*").literal_prefix() == sprout::string_view("ab"));
+		}
+		{
+			// errors
+			TESTSPR_ASSERT(testspr::regex_detail::throws("(a"));
+			TESTSPR_ASSERT(testspr::regex_detail::throws("a)"));
+			TESTSPR_ASSERT(testspr::regex_detail::throws("[a"));
+			TESTSPR_ASSERT(testspr::regex_detail::throws("*a"));
+			TESTSPR_ASSERT(testspr::regex_detail::throws("a**"));
+			TESTSPR_ASSERT(testspr::regex_detail::throws("a{2,1}"));
+			TESTSPR_ASSERT(testspr::regex_detail::throws("a{x}"));
+			TESTSPR_ASSERT(testspr::regex_detail::throws("[z-a]"));
+			TESTSPR_ASSERT(testspr::regex_detail::throws("\\q"));
+			TESTSPR_ASSERT(testspr::regex_detail::throws("^a"));
+			bool too_large = false;
+			try {
+				sprout::regex<8> const re("[ab]*a[ab]{4}");
+			} catch (std::length_error const&) {
+				too_large = true;
+			}
+			TESTSPR_ASSERT(too_large);
+		}
+#ifndef SPROUT_CONFIG_DISABLE_CXX14_CONSTEXPR
+		{
+			SPROUT_STATIC_CONSTEXPR auto re = sprout::make_regex("(GET|POST) /[a-z/]+ HTTP/1\\.[01] [0-9]{3}");
+			TESTSPR_BOTH_ASSERT(re.match("GET /index/a HTTP/1.1 200"));
+			TESTSPR_BOTH_ASSERT(!re.match("PUT /index/a HTTP/1.1 200"));
+			TESTSPR_BOTH_ASSERT(re.search("> POST /x HTTP/1.0 404 <"));
+			TESTSPR_BOTH_ASSERT(re.find("> POST /x HTTP/1.0 404 <").first == 2);
+
+			SPROUT_STATIC_CONSTEXPR auto id = sprout::make_regex<16, 8>("[a-z]+[0-9]*");
+			TESTSPR_BOTH_ASSERT(id.match("abc123"));
+			TESTSPR_BOTH_ASSERT(id.state_count() <= 16);
+		}
+#endif
+	}
+}	// namespace testspr
+
+#ifndef TESTSPR_CPP_INCLUDE
+#	define TESTSPR_TEST_FUNCTION testspr::regex_test
+#	include <testspr/include_main.hpp>
+#endif
+
+#endif	// #ifndef SPROUT_LIBS_REGEX_TEST_REGEX_CPP
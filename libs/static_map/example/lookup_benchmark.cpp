@@ -0,0 +1,84 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+//
+// Compares sprout::static_map lookups with a binary search over a sorted
+// array (std::lower_bound) and with a linear scan, for several table sizes.
+//
+#include <vector>
+#include <memory>
+#include <chrono>
+#include <iostream>
+#include <algorithm>
+#include <sprout/static_map.hpp>
+
+namespace {
+	typedef sprout::pair<unsigned, unsigned> entry_type;
+
+	struct key_less {
+		bool operator()(entry_type const& lhs, entry_type const& rhs) const {
+			return lhs.first < rhs.first;
+		}
+		bool operator()(entry_type const& lhs, unsigned rhs) const {
+			return lhs.first < rhs;
+		}
+	};
+
+	template<typename Lookup>
+	void measure(char const* name, std::vector<unsigned> const& queries, Lookup lookup) {
+		std::size_t const rounds = (std::size_t(1) << 24) / queries.size();
+		unsigned sink = 0;
+		std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+		for (std::size_t r = 0; r != rounds; ++r) {
+			for (std::size_t i = 0; i != queries.size(); ++i) {
+				sink += lookup(queries[i]);
+			}
+		}
+		std::chrono::duration<double, std::nano> const elapsed = std::chrono::steady_clock::now() - start;
+		std::cout << "  " << name << ": " << elapsed.count() / (rounds * queries.size()) << " ns/lookup (" << (sink & 1) << ")" << std::endl;
+	}
+
+	template<std::size_t N>
+	void run() {
+		std::vector<entry_type> entries;
+		for (unsigned i = 0; i != N; ++i) {
+			entries.push_back(entry_type(i * 2654435761u, i));
+		}
+		std::vector<unsigned> queries;
+		for (unsigned i = 0; i != 4096; ++i) {
+			queries.push_back(entries[(i * 40503u) % N].first);
+		}
+		std::unique_ptr<sprout::static_map<unsigned, unsigned, N> const> map(
+			new sprout::static_map<unsigned, unsigned, N>(entries.begin(), entries.end())
+			);
+		std::vector<entry_type> sorted(entries);
+		std::sort(sorted.begin(), sorted.end(), key_less());
+
+		std::cout << N << " keys:" << std::endl;
+		measure("static_map ", queries, [&](unsigned k) {
+			return map->find(k)->second;
+		});
+		measure("lower_bound", queries, [&](unsigned k) {
+			return std::lower_bound(sorted.begin(), sorted.end(), k, key_less())->second;
+		});
+		measure("linear scan", queries, [&](unsigned k) {
+			for (std::vector<entry_type>::const_iterator it = entries.begin(); ; ++it) {
+				if (it->first == k) {
+					return it->second;
+				}
+			}
+		});
+	}
+}	// anonymous-namespace
+
+int main() {
+	run<8>();
+	run<64>();
+	run<512>();
+	run<4096>();
+	return 0;
+}
@@ -0,0 +1,122 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_LIBS_STATIC_MAP_TEST_STATIC_MAP_CPP
+#define SPROUT_LIBS_STATIC_MAP_TEST_STATIC_MAP_CPP
+
+#include <stdexcept>
+#include <vector>
+#include <sprout/static_map.hpp>
+#include <sprout/string.hpp>
+#include <sprout/utility/pair.hpp>
+#include <testspr/tools.hpp>
+
+namespace testspr {
+	static void static_map_test() {
+		using namespace sprout;
+		{
+			typedef sprout::pair<sprout::string<8>, int> entry_type;
+			typedef sprout::static_map<sprout::string<8>, int, 6> map_type;
+			map_type const m = map_type(sprout::array<entry_type, 6>{{
+				entry_type(sprout::to_string("alpha"), 1),
+				entry_type(sprout::to_string("beta"), 2),
+				entry_type(sprout::to_string("gamma"), 3),
+				entry_type(sprout::to_string("delta"), 4),
+				entry_type(sprout::to_string("epsilon"), 5),
+				entry_type(sprout::to_string("zeta"), 6)
+				}});
+			TESTSPR_ASSERT(m.size() == 6);
+			TESTSPR_ASSERT(m.at(sprout::to_string("alpha")) == 1);
+			TESTSPR_ASSERT(m.at(sprout::to_string("epsilon")) == 5);
+			TESTSPR_ASSERT(m[sprout::to_string("zeta")] == 6);
+			TESTSPR_ASSERT(m.contains(sprout::to_string("delta")));
+			TESTSPR_ASSERT(!m.contains(sprout::to_string("eta")));
+			TESTSPR_ASSERT(m.count(sprout::to_string("theta")) == 0);
+			TESTSPR_ASSERT(m.find(sprout::to_string("iota")) == m.end());
+			{
+				bool thrown = false;
+				try {
+					m.at(sprout::to_string("kappa"));
+				} catch (std::out_of_range const&) {
+					thrown = true;
+				}
+				TESTSPR_ASSERT(thrown);
+			}
+			{
+				int sum = 0;
+				for (map_type::const_iterator it = m.begin(); it != m.end(); ++it) {
+					sum += it->second;
+				}
+				TESTSPR_ASSERT(sum == 21);
+			}
+		}
+		{
+			// runtime construction from a range
+			std::vector<sprout::pair<int, int> > v;
+			for (int i = 0; i != 500; ++i) {
+				v.push_back(sprout::pair<int, int>(i * 7919, i));
+			}
+			sprout::static_map<int, int, 500> const m(v.begin(), v.end());
+			bool ok = true;
+			for (int i = 0; i != 500; ++i) {
+				ok = ok && m.at(i * 7919) == i;
+			}
+			TESTSPR_ASSERT(ok);
+			TESTSPR_ASSERT(!m.contains(1));
+
+			bool thrown = false;
+			try {
+				sprout::static_map<int, int, 499> const m2(v.begin(), v.end());
+			} catch (std::length_error const&) {
+				thrown = true;
+			}
+			TESTSPR_ASSERT(thrown);
+
+			v.back().first = v.front().first;
+			thrown = false;
+			try {
+				sprout::static_map<int, int, 500> const m3(v.begin(), v.end());
+			} catch (std::invalid_argument const&) {
+				thrown = true;
+			}
+			TESTSPR_ASSERT(thrown);
+		}
+		{
+			int const keys[] = {2, 3, 5, 7, 11, 13, 17, 19};
+			sprout::static_set<int, 8> const s(keys, keys + 8);
+			TESTSPR_ASSERT(s.contains(13));
+			TESTSPR_ASSERT(!s.contains(15));
+			TESTSPR_ASSERT(s.count(2) == 1);
+		}
+#ifndef SPROUT_CONFIG_DISABLE_CXX14_CONSTEXPR
+		{
+			SPROUT_STATIC_CONSTEXPR auto m = sprout::make_static_map<int, char>(
+				sprout::pair<int, char>(10, 'a'),
+				sprout::pair<int, char>(20, 'b'),
+				sprout::pair<int, char>(30, 'c'),
+				sprout::pair<int, char>(40, 'd'),
+				sprout::pair<int, char>(50, 'e')
+				);
+			TESTSPR_BOTH_ASSERT(m.at(10) == 'a');
+			TESTSPR_BOTH_ASSERT(m.at(40) == 'd');
+			TESTSPR_BOTH_ASSERT(m.contains(50));
+			TESTSPR_BOTH_ASSERT(!m.contains(60));
+
+			SPROUT_STATIC_CONSTEXPR auto s = sprout::make_static_set<int>(1, 4, 9, 16, 25, 36);
+			TESTSPR_BOTH_ASSERT(s.contains(16));
+			TESTSPR_BOTH_ASSERT(!s.contains(17));
+		}
+#endif
+	}
+}	// namespace testspr
+
+#ifndef TESTSPR_CPP_INCLUDE
+#	define TESTSPR_TEST_FUNCTION testspr::static_map_test
+#	include <testspr/include_main.hpp>
+#endif
+
+#endif	// #ifndef SPROUT_LIBS_STATIC_MAP_TEST_STATIC_MAP_CPP
@@ -0,0 +1,90 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+//
+// Compares sprout::hash_memory (used by std::hash of sprout strings) with the
+// per-character hash_combine fold of sprout::hash_range:
+//   - collisions over decimal keys and over short keys differing in one byte
+//   - throughput for short, medium and long inputs
+//
+#include <set>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <iostream>
+#include <sprout/functional/hash.hpp>
+
+namespace {
+	struct fold_hash {
+		std::size_t operator()(std::string const& s) const {
+			return sprout::hash_range(s.begin(), s.end());
+		}
+	};
+	struct bytes_hash {
+		std::size_t operator()(std::string const& s) const {
+			return sprout::hash_memory(s.data(), s.size());
+		}
+	};
+
+	template<typename Hash>
+	std::size_t collisions(std::vector<std::string> const& keys, std::size_t bucket_bits) {
+		std::set<std::size_t> full;
+		std::vector<unsigned> buckets(std::size_t(1) << bucket_bits);
+		std::size_t bucket_collisions = 0;
+		for (std::size_t i = 0; i != keys.size(); ++i) {
+			std::size_t const h = Hash()(keys[i]);
+			full.insert(h);
+			bucket_collisions += buckets[h & (buckets.size() - 1)]++ != 0;
+		}
+		std::cout << "  full " << keys.size() - full.size() << ", low " << bucket_bits << " bits " << bucket_collisions;
+		return keys.size() - full.size();
+	}
+
+	template<typename Hash>
+	void throughput(char const* name, std::size_t length) {
+		std::string s(length, 'x');
+		std::size_t const total = std::size_t(1) << 28;
+		std::size_t const iterations = total / length;
+		std::size_t sink = 0;
+		std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+		for (std::size_t i = 0; i != iterations; ++i) {
+			sink += Hash()(s);
+			s[i % length] ^= 1;
+		}
+		std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+		std::cout << "  " << name << " " << length << " bytes: "
+			<< iterations * length / elapsed.count() / (1 << 20) << " MiB/s (" << (sink & 1) << ")" << std::endl;
+	}
+}	// anonymous-namespace
+
+int main() {
+	std::vector<std::string> decimal;
+	for (std::size_t i = 0; i != 1000000; ++i) {
+		decimal.push_back(std::to_string(i));
+	}
+	std::vector<std::string> flipped;
+	for (std::size_t i = 0; i != 64 * 8; ++i) {
+		std::string s(64, '\0');
+		s[i / 8] = static_cast<char>(1 << (i % 8));
+		flipped.push_back(s);
+	}
+
+	std::cout << "decimal keys (1000000):" << std::endl;
+	std::cout << " hash_range"; collisions<fold_hash>(decimal, 20); std::cout << std::endl;
+	std::cout << " hash_memory"; collisions<bytes_hash>(decimal, 20); std::cout << std::endl;
+	std::cout << "single-bit keys (512):" << std::endl;
+	std::cout << " hash_range"; collisions<fold_hash>(flipped, 10); std::cout << std::endl;
+	std::cout << " hash_memory"; collisions<bytes_hash>(flipped, 10); std::cout << std::endl;
+
+	std::cout << "throughput:" << std::endl;
+	std::size_t const lengths[] = {8, 32, 100, 1024, 65536};
+	for (std::size_t i = 0; i != sizeof(lengths) / sizeof(lengths[0]); ++i) {
+		throughput<fold_hash>("hash_range ", lengths[i]);
+		throughput<bytes_hash>("hash_memory", lengths[i]);
+	}
+	return 0;
+}
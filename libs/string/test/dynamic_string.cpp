@@ -0,0 +1,170 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_LIBS_STRING_TEST_DYNAMIC_STRING_CPP
+#define SPROUT_LIBS_STRING_TEST_DYNAMIC_STRING_CPP
+
+#include <sstream>
+#include <climits>
+#include <functional>
+#include <sprout/string.hpp>
+#include <sprout/string/dynamic_string.hpp>
+#include <sprout/string/string_builder.hpp>
+#include <sprout/utility/string_view.hpp>
+#include <testspr/tools.hpp>
+
+namespace testspr {
+	static void dynamic_string_test() {
+		using namespace sprout;
+		{
+			sprout::dynamic_string s;
+			TESTSPR_ASSERT(s.empty());
+			TESTSPR_ASSERT(s.capacity() == sprout::dynamic_string::local_capacity);
+			TESTSPR_ASSERT(*s.c_str() == '\0');
+
+			s = "short";
+			TESTSPR_ASSERT(s == "short");
+			TESTSPR_ASSERT(s.capacity() == sprout::dynamic_string::local_capacity);
+
+			s.append(" and then a much longer tail");
+			TESTSPR_ASSERT(s == "short and then a much longer tail");
+			TESTSPR_ASSERT(s.size() == 33);
+			TESTSPR_ASSERT(s.c_str()[33] == '\0');
+
+			// self append across a reallocation
+			s.append(s.data(), 5);
+			TESTSPR_ASSERT(s == "short and then a much longer tailshort");
+
+			sprout::dynamic_string t(static_cast<sprout::dynamic_string&&>(s));
+			TESTSPR_ASSERT(s.empty());
+			TESTSPR_ASSERT(t.size() == 38);
+			sprout::dynamic_string u(t);
+			TESTSPR_ASSERT(u == t);
+			u.resize(5);
+			TESTSPR_ASSERT(u == "short");
+			TESTSPR_ASSERT(u < t);
+			TESTSPR_ASSERT(t != u);
+			u.swap(t);
+			TESTSPR_ASSERT(t == "short");
+			TESTSPR_ASSERT(u.size() == 38);
+		}
+		{
+			// repeated appends grow the capacity geometrically
+			sprout::dynamic_string s;
+			std::size_t reallocations = 0;
+			for (std::size_t i = 0; i != 2000; ++i) {
+				std::size_t const capacity = s.capacity();
+				s.append("ab", 2);
+				reallocations += s.capacity() != capacity;
+			}
+			TESTSPR_ASSERT(s.size() == 4000);
+			TESTSPR_ASSERT(reallocations <= 10);
+			s.append(s.data(), s.size());
+			TESTSPR_ASSERT(s.size() == 8000 && s[3999] == 'b' && s[4000] == 'a' && s[7999] == 'b');
+		}
+		{
+			// interoperation with basic_string and basic_string_view
+			SPROUT_STATIC_CONSTEXPR auto fixed = sprout::to_string("foobar");
+			sprout::dynamic_string s(fixed);
+			TESTSPR_ASSERT(s == sprout::string_view(fixed));
+			sprout::string_view v = s;
+			TESTSPR_ASSERT(v == sprout::string_view(fixed));
+			s += sprout::string_view("baz");
+			s += fixed;
+			s += '!';
+			TESTSPR_ASSERT(s == "foobarbazfoobar!");
+			TESTSPR_ASSERT(s + "?" == "foobarbazfoobar!?");
+			TESTSPR_ASSERT(sprout::hash_value(sprout::dynamic_string(fixed)) == sprout::to_hash(fixed));
+			TESTSPR_ASSERT(std::hash<sprout::dynamic_string>()(sprout::dynamic_string(fixed)) == sprout::to_hash(fixed));
+
+			std::ostringstream os;
+			os << s;
+			TESTSPR_ASSERT(os.str() == "foobarbazfoobar!");
+		}
+		{
+			// numbers match int_to_string / float_to_string
+			sprout::string_builder b(64);
+			std::size_t const capacity = b.capacity();
+			b << "n=" << 0 << ',' << -42 << ',' << 1234567890u << ',' << LLONG_MIN;
+			TESTSPR_ASSERT(b.view() == "n=0,-42,1234567890,-9223372036854775808");
+			TESTSPR_ASSERT(b.capacity() == capacity);
+			b.clear();
+			b.append_int<16>(255).append(' ').append_int<2>(-5);
+			TESTSPR_ASSERT(b.view() == "ff -101");
+
+			double const values[] = {0.0, -0.5, 1.25, 3.14159265, 123456.789, -1e10, 1e-7, 2.5e20};
+			for (std::size_t i = 0; i != sizeof(values) / sizeof(values[0]); ++i) {
+				b.clear();
+				b << values[i];
+				TESTSPR_ASSERT(b.str() == sprout::string_view(sprout::to_string(values[i])));
+			}
+			b.clear();
+			b.append_float_exp(0.0).append(' ').append_float_exp(-0.5).append(' ').append_float_exp(1.25e-7).append(' ').append_float_exp(9.9999999e99);
+			TESTSPR_ASSERT(b.view() == "0.000000e+00 -5.000000e-01 1.250000e-07 1.000000e+100");
+			double const exp_values[] = {
+				0.0, -0.0, 1.0, -1.0, 0.5, 0.1, 0.01, 1.25e-7, 3.14159265, -2.718281828, 10.0, 99.5, 123456.789,
+				-1e10, 1e100, 1.7976931348623157e308, 2.2250738585072014e-308, 6.02214076e23, -1.602176634e-19,
+				9.9999999e99, 9.9999996, 0.99999999, -0.99999996, 1.0000005, 4.0000045e-3,
+				4.9406564584124654e-324, -1e-310, 2.2250738585072009e-308
+				};
+			for (std::size_t i = 0; i != sizeof(exp_values) / sizeof(exp_values[0]); ++i) {
+				b.clear();
+				b.append_float_exp(exp_values[i]);
+				TESTSPR_ASSERT(b.view() == sprout::string_view(sprout::float_to_string_exp<char>(exp_values[i])));
+			}
+			TESTSPR_BOTH_ASSERT(sprout::float_to_string_exp<char>(1.0) == "1.000000e+00");
+			TESTSPR_BOTH_ASSERT(sprout::float_to_string_exp<char>(-0.0) == "-0.000000e+00");
+			TESTSPR_BOTH_ASSERT(sprout::float_to_string_exp<char>(9.9999996) == "1.000000e+01");
+			TESTSPR_BOTH_ASSERT(sprout::float_to_string_exp<char>(-0.99999996) == "-1.000000e+00");
+			TESTSPR_BOTH_ASSERT(sprout::float_to_string_exp<char>(1.7976931348623157e308) == "1.797693e+308");
+			TESTSPR_BOTH_ASSERT(sprout::float_to_string_exp<char>(4.9406564584124654e-324) == "4.940656e-324");
+			TESTSPR_BOTH_ASSERT(sprout::float_to_string_exp<char>(1e-310) == "1.000000e-310");
+			TESTSPR_BOTH_ASSERT(sprout::float_to_string_exp<char>(1.40129846e-45f) == "1.401298e-45");
+			b.clear();
+			b.append_float_exp(4.9406564584124654e-324).append(' ').append_float_exp(-1e-310).append(' ').append_float_exp(1.40129846e-45f);
+			TESTSPR_ASSERT(b.view() == "4.940656e-324 -1.000000e-310 1.401298e-45");
+
+			// float_exponent10
+			TESTSPR_BOTH_ASSERT(sprout::detail::float_exponent10(0.5) == -1);
+			TESTSPR_BOTH_ASSERT(sprout::detail::float_exponent10(0.1) == -1);
+			TESTSPR_BOTH_ASSERT(sprout::detail::float_exponent10(0.01) == -2);
+			TESTSPR_BOTH_ASSERT(sprout::detail::float_exponent10(0.99999999) == -1);
+			TESTSPR_BOTH_ASSERT(sprout::detail::float_exponent10(1.25e-7) == -7);
+			TESTSPR_BOTH_ASSERT(sprout::detail::float_exponent10(2.2250738585072014e-308) == -308);
+			TESTSPR_BOTH_ASSERT(sprout::detail::float_exponent10(1.0) == 0);
+			TESTSPR_BOTH_ASSERT(sprout::detail::float_exponent10(-1.0) == 0);
+			TESTSPR_BOTH_ASSERT(sprout::detail::float_exponent10(9.99) == 0);
+			TESTSPR_BOTH_ASSERT(sprout::detail::float_exponent10(10.0) == 1);
+			TESTSPR_BOTH_ASSERT(sprout::detail::float_exponent10(-123.0) == 2);
+			TESTSPR_BOTH_ASSERT(sprout::detail::float_exponent10(6.02214076e23) == 23);
+			TESTSPR_BOTH_ASSERT(sprout::detail::float_exponent10(1e100) == 100);
+			TESTSPR_BOTH_ASSERT(sprout::detail::float_exponent10(1.7976931348623157e308) == 308);
+			b.clear();
+			b << 1.0 / 0.0 << ' ' << -1.0 / 0.0;
+			TESTSPR_ASSERT(b.view() == "inf -inf");
+
+			sprout::dynamic_string r = b.release();
+			TESTSPR_ASSERT(r == "inf -inf");
+			TESTSPR_ASSERT(b.empty());
+		}
+		{
+			sprout::wstring_builder b;
+			b << L"x=" << 12 << L' ';
+			TESTSPR_ASSERT(b.view() == L"x=12 ");
+			b.clear();
+			b << 0.25f;
+			TESTSPR_ASSERT(b.str() == sprout::wstring_view(sprout::to_wstring(0.25f)));
+		}
+	}
+}	// namespace testspr
+
+#ifndef TESTSPR_CPP_INCLUDE
+#	define TESTSPR_TEST_FUNCTION testspr::dynamic_string_test
+#	include <testspr/include_main.hpp>
+#endif
+
+#endif	// #ifndef SPROUT_LIBS_STRING_TEST_DYNAMIC_STRING_CPP
@@ -383,6 +383,9 @@ namespace testspr {
 			// sprout::to_hash, sprout::hash
 			TESTSPR_BOTH_ASSERT(sprout::to_hash(str1) == sprout::hash<decltype(str1)>()(str1));
 			TESTSPR_BOTH_ASSERT(sprout::to_hash(str1) != sprout::to_hash(str2));
+			TESTSPR_BOTH_ASSERT(sprout::to_hash(str1) == sprout::hash_bytes(str1));
+			TESTSPR_ASSERT(sprout::to_hash(str1) == std::hash<std::decay<decltype(str1)>::type>()(str1));
+			TESTSPR_ASSERT(sprout::to_hash(str1) == sprout::hash_memory(str1.data(), str1.size()));
 		}
 	}
 }	// namespace testspr
@@ -224,6 +224,16 @@ namespace testspr {
 			// sprout::to_hash, sprout::hash
 			TESTSPR_BOTH_ASSERT(sprout::to_hash(str1) == sprout::hash<decltype(str1)>()(str1));
 			TESTSPR_BOTH_ASSERT(sprout::to_hash(str1) != sprout::to_hash(str2));
+			TESTSPR_BOTH_ASSERT(sprout::to_hash(str1) == sprout::hash_bytes(str1));
+			TESTSPR_BOTH_ASSERT(sprout::to_hash(str1) == sprout::to_hash(sprout::to_string("foobar1234")));
+			TESTSPR_BOTH_ASSERT(sprout::to_hash(str1.substr(0, 6)) == sprout::to_hash(sprout::string_view("foobar")));
+			TESTSPR_ASSERT(sprout::to_hash(str1) == std::hash<std::decay<decltype(str1)>::type>()(str1));
+			TESTSPR_ASSERT(sprout::to_hash(str1) == sprout::hash_memory(str1.data(), str1.size()));
+			{
+				SPROUT_STATIC_CONSTEXPR auto wstr = sprout::wstring_view(L"foobar1234");
+				TESTSPR_BOTH_ASSERT(sprout::to_hash(wstr) == sprout::hash_bytes(wstr));
+				TESTSPR_ASSERT(sprout::to_hash(wstr) == std::hash<sprout::wstring_view>()(wstr));
+			}
 		}
 	}
 }	// namespace testspr
@@ -0,0 +1,70 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+//
+// a * b + c * sin(d) over valarray<double, 1024>, once as a single expression and
+// once the way the operators used to evaluate it, one valarray per operator:
+//
+//	g++ -std=c++11 -O2 -I. libs/valarray/example/expression_benchmark.cpp
+//
+// The traffic column counts the bytes of valarray elements read and written per
+// evaluation: the fused loop reads the four operands and writes the result once;
+// the eager form also writes and reads back three temporaries.
+//
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <sprout/valarray.hpp>
+
+namespace {
+	SPROUT_STATIC_CONSTEXPR std::size_t size = 1024;
+	typedef sprout::valarray<double, size> valarray_type;
+
+	void fused(valarray_type& r, valarray_type const& a, valarray_type const& b, valarray_type const& c, valarray_type const& d) {
+		r = a * b + c * sprout::sin(d);
+	}
+	void eager(valarray_type& r, valarray_type const& a, valarray_type const& b, valarray_type const& c, valarray_type const& d) {
+		valarray_type const t1 = a * b;
+		valarray_type const t2 = sprout::sin(d);
+		valarray_type const t3 = c * t2;
+		r = t1 + t3;
+	}
+
+	template<typename F>
+	double run(char const* name, F f, std::size_t traffic, valarray_type& r, valarray_type const& a, valarray_type const& b, valarray_type const& c, valarray_type const& d) {
+		std::size_t const repeat = 20000;
+		std::chrono::steady_clock::time_point const start = std::chrono::steady_clock::now();
+		for (std::size_t i = 0; i != repeat; ++i) {
+			f(r, a, b, c, d);
+		}
+		std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+		std::cout
+			<< name << "\t"
+			<< elapsed.count() / repeat * 1e6 << " us\t"
+			<< traffic * sizeof(double) * size / 1024 << " KiB traffic" << std::endl
+			;
+		return r.sum();
+	}
+}	// anonymous-namespace
+
+int main() {
+	valarray_type a(0.0, size);
+	valarray_type b(0.0, size);
+	valarray_type c(0.0, size);
+	valarray_type d(0.0, size);
+	for (std::size_t i = 0; i != size; ++i) {
+		a[i] = static_cast<double>(i);
+		b[i] = 1.0 / (i + 1);
+		c[i] = 0.5;
+		d[i] = 0.001 * i;
+	}
+	valarray_type r(size);
+	// fused: 4 reads + 1 write; eager: (2 + 1) + (1 + 1) + (2 + 1) + (2 + 1)
+	double const x = run("fused", &fused, 5, r, a, b, c, d);
+	double const y = run("eager", &eager, 11, r, a, b, c, d);
+	std::cout << "sums: " << x << " " << y << std::endl;
+}
@@ -0,0 +1,156 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_LIBS_VALARRAY_TEST_EXPRESSION_CPP
+#define SPROUT_LIBS_VALARRAY_TEST_EXPRESSION_CPP
+
+#include <sprout/valarray.hpp>
+#include <testspr/tools.hpp>
+
+namespace testspr {
+	static void expression_test() {
+		{
+			SPROUT_STATIC_CONSTEXPR auto a = sprout::make_valarray<double>(1, 2, 3, 4);
+			SPROUT_STATIC_CONSTEXPR auto b = sprout::make_valarray<double>(4, 3, 2, 1);
+
+			// arithmetic
+			{
+				SPROUT_STATIC_CONSTEXPR sprout::valarray<double, 4> r = a * b + 1.0;
+				TESTSPR_BOTH_ASSERT(r.size() == 4);
+				TESTSPR_BOTH_ASSERT(r[0] == 5 && r[1] == 7 && r[2] == 7 && r[3] == 5);
+			}
+			{
+				SPROUT_STATIC_CONSTEXPR sprout::valarray<double, 4> r = 2.0 * a - b / 2.0 + -(a - b);
+				TESTSPR_BOTH_ASSERT(r[0] == 3 && r[3] == 4.5);
+			}
+			{
+				SPROUT_STATIC_CONSTEXPR auto e = a * b;
+				TESTSPR_BOTH_ASSERT(e.size() == 4);
+				TESTSPR_BOTH_ASSERT(e[1] == 6);
+			}
+			// functions
+			{
+				SPROUT_STATIC_CONSTEXPR sprout::valarray<double, 4> r = a * b + sprout::sin(a) * sprout::cos(b);
+				TESTSPR_BOTH_ASSERT(r[2] == 6 + sprout::sin(3.0) * sprout::cos(2.0));
+			}
+			{
+				SPROUT_STATIC_CONSTEXPR sprout::valarray<double, 4> r = sprout::sqrt(a * a) + sprout::pow(a, 2.0) + sprout::atan2(0.0, a);
+				TESTSPR_BOTH_ASSERT(r[3] == 20);
+			}
+			// comparison and logical operators evaluate to valarray<bool, N>
+			{
+				SPROUT_STATIC_CONSTEXPR sprout::valarray<bool, 4> r = a + 1.0 > b || a == 1.0;
+				TESTSPR_BOTH_ASSERT(r[0] && !r[1] && r[2] && r[3]);
+			}
+		}
+		{
+			SPROUT_STATIC_CONSTEXPR auto i = sprout::make_valarray<int>(1, 2, 3);
+			SPROUT_STATIC_CONSTEXPR sprout::valarray<int, 3> r = (i << 2 | 1) % 3 + ~i;
+			TESTSPR_BOTH_ASSERT(r[0] == 0 && r[2] == -3);
+			SPROUT_STATIC_CONSTEXPR auto s = sprout::make_valarray<short>(1, 2, 100);
+			SPROUT_STATIC_CONSTEXPR sprout::valarray<short, 3> t = s * s / short(3);
+			TESTSPR_BOTH_ASSERT(t[2] == 3333);
+		}
+		// assignment, in place
+		{
+			sprout::valarray<double, 4> x(1.0, 3);
+			sprout::valarray<double, 4> const y(2.0, 3);
+			x = x * y + x;
+			TESTSPR_ASSERT(x.size() == 3);
+			TESTSPR_ASSERT(x[0] == 3 && x[2] == 3);
+			x = y;
+			TESTSPR_ASSERT(x[1] == 2);
+		}
+		// subset arrays as operands
+		{
+			sprout::valarray<double, 6> x = sprout::make_valarray<double>(0, 1, 2, 3, 4, 5);
+			sprout::valarray<double, 6> r = x[sprout::slice(1, 3, 2)] * 10.0;
+			TESTSPR_ASSERT(r.size() == 3);
+			TESTSPR_ASSERT(r[0] == 10 && r[1] == 30 && r[2] == 50);
+
+			sprout::valarray<bool, 6> const mask = x > 3.0;
+			r = x[mask] + x[sprout::slice(0, 2, 1)];
+			TESTSPR_ASSERT(r.size() == 2);
+			TESTSPR_ASSERT(r[0] == 4 && r[1] == 6);
+
+			sprout::valarray<std::size_t, 2> const idx = sprout::make_valarray<std::size_t>(5, 0);
+			r = x[idx] - 1.0;
+			TESTSPR_ASSERT(r[0] == 4 && r[1] == -1);
+
+			std::size_t const lengths[] = {2, 2};
+			std::size_t const strides[] = {3, 1};
+			r = x[sprout::gslice<2>(0, sprout::valarray<std::size_t, 2>(lengths, 2), sprout::valarray<std::size_t, 2>(strides, 2))] * 2.0;
+			TESTSPR_ASSERT(r.size() == 4);
+			TESTSPR_ASSERT(r[0] == 0 && r[1] == 2 && r[2] == 6 && r[3] == 8);
+		}
+		// subset arrays assigned from expressions
+		{
+			sprout::valarray<double, 6> x = sprout::make_valarray<double>(1, 2, 3, 4, 5, 6);
+			sprout::valarray<double, 3> const y = sprout::make_valarray<double>(4, 3, 2);
+			x[sprout::slice(0, 3, 2)] = y * y;
+			TESTSPR_ASSERT(x[0] == 16 && x[1] == 2 && x[2] == 9 && x[4] == 4);
+			x[sprout::slice(0, 3, 2)] += x[sprout::slice(1, 3, 2)] * y;
+			TESTSPR_ASSERT(x[0] == 24 && x[2] == 21 && x[4] == 16);
+
+			sprout::valarray<bool, 6> const mask = x > 20.0;
+			x[mask] -= x[sprout::slice(1, 2, 2)] * 2.0;
+			TESTSPR_ASSERT(x[0] == 20 && x[2] == 13 && x[4] == 16);
+
+			sprout::valarray<std::size_t, 2> const idx = sprout::make_valarray<std::size_t>(5, 4);
+			x[idx] = x[sprout::slice(0, 2, 1)] + 1.0;
+			TESTSPR_ASSERT(x[5] == 21 && x[4] == 3);
+			x[idx] *= x[sprout::slice(1, 2, 2)] + 0.0;
+			TESTSPR_ASSERT(x[5] == 42 && x[4] == 12);
+
+			std::size_t const lengths[] = {2};
+			std::size_t const strides[] = {3};
+			x[sprout::gslice<1>(0, sprout::valarray<std::size_t, 1>(lengths, 1), sprout::valarray<std::size_t, 1>(strides, 1))] = x[sprout::slice(4, 2, 1)] - 2.0;
+			TESTSPR_ASSERT(x[0] == 10 && x[3] == 40);
+		}
+		// members of expressions
+		{
+			SPROUT_STATIC_CONSTEXPR auto a = sprout::make_valarray<double>(1, 2, 3, 4);
+			SPROUT_STATIC_CONSTEXPR auto b = sprout::make_valarray<double>(4, 3, 2, 1);
+			TESTSPR_BOTH_ASSERT((a + b).sum() == 20);
+			TESTSPR_BOTH_ASSERT((a * b).min() == 4);
+			TESTSPR_BOTH_ASSERT((a * b).max() == 6);
+			TESTSPR_BOTH_ASSERT((-a).sum() == -10);
+			SPROUT_STATIC_CONSTEXPR sprout::valarray<double, 4> e = (a - b).eval();
+			TESTSPR_BOTH_ASSERT(e.size() == 4 && e[0] == -3);
+			SPROUT_STATIC_CONSTEXPR sprout::valarray<double, 4> f = (a - b).apply(sprout::math::abs<double>);
+			TESTSPR_BOTH_ASSERT(f[0] == 3 && f[3] == 3);
+		}
+		// assignment from an expression reading *this through a subset array
+		{
+			sprout::valarray<double, 4> x = sprout::make_valarray<double>(1, 2, 3, 4);
+			sprout::valarray<std::size_t, 4> const idx = sprout::make_valarray<std::size_t>(3, 2, 1, 0);
+			x = x[idx] + 0.0;
+			TESTSPR_ASSERT(x[0] == 4 && x[1] == 3 && x[2] == 2 && x[3] == 1);
+			x = x * x[idx];
+			TESTSPR_ASSERT(x[0] == 4 && x[1] == 6 && x[2] == 6 && x[3] == 4);
+		}
+#ifndef SPROUT_CONFIG_DISABLE_CXX14_CONSTEXPR
+		{
+			struct f {
+				static SPROUT_CXX14_CONSTEXPR double get() {
+					sprout::valarray<double, 4> x = sprout::make_valarray<double>(1, 2, 3, 4);
+					x = x * x - x[sprout::slice(0, 4, 1)];
+					return x.sum();
+				}
+			};
+			TESTSPR_BOTH_ASSERT(f::get() == 20);
+		}
+#endif
+	}
+}	// namespace testspr
+
+#ifndef TESTSPR_CPP_INCLUDE
+#	define TESTSPR_TEST_FUNCTION testspr::expression_test
+#	include <testspr/include_main.hpp>
+#endif
+
+#endif	// #ifndef SPROUT_LIBS_VALARRAY_TEST_EXPRESSION_CPP
@@ -0,0 +1,71 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+//
+// Packrat parsing of a JSON-like document.
+//
+// Every alternative of `member` starts with `key`, and every alternative of
+// `document` starts with `object`, so the plain parse re-reads each key once
+// per alternative tried. With packrat_parse the memo[] rules are evaluated
+// once per position.
+//
+#include <string>
+#include <chrono>
+#include <iostream>
+#include <sprout/weed.hpp>
+
+int main() {
+	namespace w = sprout::weed;
+
+	static SPROUT_CONSTEXPR auto ws = *w::omit[w::space];
+	static SPROUT_CONSTEXPR auto key = w::memo(1)[w::omit[ws >> '"' >> *w::omit[w::char_ - '"'] >> '"' >> ws]];
+	static SPROUT_CONSTEXPR auto string = w::omit['"' >> *w::omit[w::char_ - '"'] >> '"'];
+	static SPROUT_CONSTEXPR auto number = w::omit[-w::lit('-') >> +w::omit[w::digit]];
+	static SPROUT_CONSTEXPR auto array = w::omit['[' >> ws >> number >> *(ws >> ',' >> ws >> number) >> ws >> ']'];
+	static SPROUT_CONSTEXPR auto member = w::omit[
+		(key >> ':' >> ws >> string)
+		| (key >> ':' >> ws >> number)
+		| (key >> ':' >> ws >> array)
+		| (key >> ':' >> ws >> "true")
+		| (key >> ':' >> ws >> "false")
+		| (key >> ':' >> ws >> "null")
+		];
+	static SPROUT_CONSTEXPR auto object = w::memo(2)[w::omit['{' >> member >> *(',' >> member) >> ws >> '}']];
+	static SPROUT_CONSTEXPR auto document = (object >> ws >> ';') | (object >> ws >> ',') | (object >> ws >> w::eoi);
+
+	std::string source = "{";
+	for (int i = 0; i != 2000; ++i) {
+		source += i ? ", " : " ";
+		switch (i % 6) {
+		case 0: source += "\"name\": \"value\""; break;
+		case 1: source += "\"id\": -12345"; break;
+		case 2: source += "\"list\": [1, 2, 3, 4]"; break;
+		case 3: source += "\"flag\": true"; break;
+		case 4: source += "\"other\": false"; break;
+		default: source += "\"none\": null"; break;
+		}
+	}
+	source += " }";
+
+	typedef std::chrono::steady_clock clock;
+	{
+		clock::time_point const start = clock::now();
+		bool const success = w::parse(source.begin(), source.end(), document).success();
+		std::chrono::duration<double, std::milli> const elapsed = clock::now() - start;
+		std::cout << "parse:         " << success << " " << elapsed.count() << " ms" << std::endl;
+	}
+	{
+		w::memo_table<std::string::iterator> memo(source.begin());
+		clock::time_point const start = clock::now();
+		bool const success = w::packrat_parse(source.begin(), source.end(), document, memo).success();
+		std::chrono::duration<double, std::milli> const elapsed = clock::now() - start;
+		std::cout << "packrat_parse: " << success << " " << elapsed.count() << " ms"
+			<< " (" << memo.size() << " entries, " << memo.arena_size() << " bytes)" << std::endl;
+	}
+
+	return 0;
+}
@@ -0,0 +1,136 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_LIBS_WEED_TEST_COLLECT_CPP
+#define SPROUT_LIBS_WEED_TEST_COLLECT_CPP
+
+#include <string>
+#include <vector>
+#include <sprout/weed.hpp>
+#include <testspr/tools.hpp>
+
+namespace testspr {
+	static void collect_test() {
+		namespace w = sprout::weed;
+		{
+			// characters collect into a string, past any compile-time limit
+			std::string const source(5000, 'a');
+			auto const result = w::parse(source.begin(), source.end(), w::collect[w::char_]);
+			TESTSPR_ASSERT(result.success());
+			TESTSPR_ASSERT(result.current() == source.end());
+			TESTSPR_ASSERT(result.attr() == source);
+		}
+		{
+			// other attributes into a vector; an empty match is an empty container
+			std::string const source = "12,3,45";
+			auto const result = w::parse(source.begin(), source.end(), w::collect[w::int_ >> -w::lit(',')]);
+			TESTSPR_ASSERT(result.success());
+			TESTSPR_ASSERT((result.attr() == std::vector<std::intmax_t>{12, 3, 45}));
+			std::string const none = "x";
+			auto const empty = w::parse(none.begin(), none.end(), w::collect[w::digit]);
+			TESTSPR_ASSERT(empty.success());
+			TESTSPR_ASSERT(empty.current() == none.begin());
+			TESTSPR_ASSERT(empty.attr().empty());
+		}
+		{
+			// collect(n) needs at least n matches
+			std::string const source = "ab1";
+			auto const two = w::parse(source.begin(), source.end(), w::collect(2)[w::alpha]);
+			TESTSPR_ASSERT(two.success());
+			TESTSPR_ASSERT(two.attr() == "ab");
+			TESTSPR_ASSERT(two.current() == source.begin() + 2);
+			auto const three = w::parse(source.begin(), source.end(), w::collect(3)[w::alpha]);
+			TESTSPR_ASSERT(!three.success());
+			TESTSPR_ASSERT(three.current() == source.begin());
+		}
+		{
+			// collect_into appends to the caller's container
+			std::string const source = "abc123";
+			std::string letters = ">";
+			std::vector<std::intmax_t> numbers;
+			auto const result = w::parse(
+				source.begin(), source.end(),
+				w::collect_into(letters)[w::alpha] >> w::collect_into(numbers)[w::int_]
+				);
+			TESTSPR_ASSERT(result.success());
+			TESTSPR_ASSERT(letters == ">abc");
+			TESTSPR_ASSERT((numbers == std::vector<std::intmax_t>{123}));
+			// a failing collect_into(n) leaves the container as it was
+			TESTSPR_ASSERT(!w::parse(source.begin(), source.end(), w::collect_into(letters, 4)[w::alpha]).success());
+			TESTSPR_ASSERT(letters == ">abc");
+		}
+		{
+			// an alternative that backtracks over a successful collect_into
+			std::string const source = "12;";
+			std::string digits;
+			auto const result = w::parse(
+				source.begin(), source.end(),
+				(w::collect_into(digits)[w::digit] >> ',') | (w::collect_into(digits)[w::digit] >> ';')
+				);
+			TESTSPR_ASSERT(result.success());
+			TESTSPR_ASSERT(digits == "12");
+			digits.clear();
+			auto const other = w::parse(
+				source.begin(), source.end(),
+				(w::collect_into(digits)[w::digit] >> ',') | (*w::omit[w::char_] >> w::eoi)
+				);
+			TESTSPR_ASSERT(other.success());
+			TESTSPR_ASSERT(digits.empty());
+			// a failed parse, a negative and a positive lookahead collect nothing
+			digits = "0";
+			TESTSPR_ASSERT(!w::parse(source.begin(), source.end(), w::collect_into(digits)[w::digit] >> ',').success());
+			TESTSPR_ASSERT(!w::parse(source.begin(), source.end(), !w::collect_into(digits)[w::digit]).success());
+			TESTSPR_ASSERT(w::parse(source.begin(), source.end(), &w::collect_into(digits)[w::digit]).success());
+			TESTSPR_ASSERT(!w::parse(source.begin(), source.end(), w::collect_into(digits)[w::digit] - "12").success());
+			TESTSPR_ASSERT(digits == "0");
+			// an outer sequence undoes the inner ones
+			TESTSPR_ASSERT(!w::parse(
+				source.begin(), source.end(),
+				w::collect_into(digits)[w::digit] >> ';' >> w::collect_into(digits)[w::char_] >> w::digit
+				).success());
+			TESTSPR_ASSERT(digits == "0");
+		}
+		{
+			// collect_into inside directives is undone as well
+			std::string const source = "12;";
+			std::string digits;
+			TESTSPR_ASSERT(w::parse(
+				source.begin(), source.end(),
+				(w::omit[w::collect_into(digits)[w::digit]] >> ',') | (w::omit[w::collect_into(digits)[w::digit]] >> ';')
+				).success());
+			TESTSPR_ASSERT(digits == "12");
+			digits.clear();
+			TESTSPR_ASSERT(w::parse(
+				source.begin(), source.end(),
+				(w::lim<4>(w::as_array[w::collect_into(digits)[w::digit] >> w::char_]) >> ',') | (w::omit[w::collect_into(digits)[w::digit]] >> ';')
+				).success());
+			TESTSPR_ASSERT(digits == "12");
+			// an outer collect_into(n) that fails undoes an inner one
+			std::string separators;
+			digits.clear();
+			TESTSPR_ASSERT(!w::parse(
+				source.begin(), source.end(),
+				w::collect_into(separators, 2)[w::collect_into(digits)[w::digit] >> w::char_(';')]
+				).success());
+			TESTSPR_ASSERT(digits.empty() && separators.empty());
+			// memo[] around collect_into is undone and re-evaluated, with and without a memo table
+			auto const rule = w::memo(1)[w::collect_into(digits)[w::digit]];
+			TESTSPR_ASSERT(w::parse(source.begin(), source.end(), (rule >> ',') | (rule >> ';')).success());
+			TESTSPR_ASSERT(digits == "12");
+			digits.clear();
+			TESTSPR_ASSERT(w::packrat_parse(source.begin(), source.end(), (rule >> ',') | (rule >> ';')).success());
+			TESTSPR_ASSERT(digits == "12");
+		}
+	}
+}	// namespace testspr
+
+#ifndef TESTSPR_CPP_INCLUDE
+#	define TESTSPR_TEST_FUNCTION testspr::collect_test
+#	include <testspr/include_main.hpp>
+#endif
+
+#endif	// #ifndef SPROUT_LIBS_WEED_TEST_COLLECT_CPP
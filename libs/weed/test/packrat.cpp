@@ -0,0 +1,134 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_LIBS_WEED_TEST_PACKRAT_CPP
+#define SPROUT_LIBS_WEED_TEST_PACKRAT_CPP
+
+#include <string>
+#include <sprout/array.hpp>
+#include <sprout/string.hpp>
+#include <sprout/weed.hpp>
+#include <testspr/tools.hpp>
+
+namespace testspr {
+	namespace packrat_detail {
+		// unsigned decimal number that counts its evaluations
+		struct counted_uint_p
+			: public sprout::weed::parser_base
+		{
+		public:
+			template<typename Context, typename Iterator>
+			struct attribute
+				: public sprout::identity<std::intmax_t>
+			{};
+			template<typename Context, typename Iterator>
+			struct result
+				: public sprout::identity<sprout::weed::parser_result<Iterator, typename attribute<Context, Iterator>::type> >
+			{};
+		public:
+			std::size_t* count;
+		public:
+			explicit counted_uint_p(std::size_t* count)
+				: count(count)
+			{}
+			template<typename Context, typename Iterator>
+			typename result<Context, Iterator>::type operator()(
+				Iterator first, Iterator last,
+				Context const&
+				) const
+			{
+				typedef typename result<Context, Iterator>::type result_type;
+				++*count;
+				std::intmax_t value = 0;
+				Iterator it = first;
+				for (; it != last && *it >= '0' && *it <= '9'; ++it) {
+					value = value * 10 + (*it - '0');
+				}
+				return it != first ? result_type(true, it, value) : result_type(false, first, 0);
+			}
+		};
+
+		template<typename Parser>
+		void check_same(std::string const& source, Parser const& parser) {
+			auto const plain = sprout::weed::parse(source.begin(), source.end(), parser);
+			auto const packrat = sprout::weed::packrat_parse(source.begin(), source.end(), parser);
+			TESTSPR_ASSERT(packrat.success() == plain.success());
+			TESTSPR_ASSERT(packrat.current() == plain.current());
+			TESTSPR_ASSERT(packrat.attr() == plain.attr());
+		}
+	}	// namespace packrat_detail
+
+	static void packrat_test() {
+		namespace w = sprout::weed;
+		{
+			// same result, position and attribute as parse, on success and on failure
+			SPROUT_STATIC_CONSTEXPR auto key = w::memo(1)[w::int_];
+			SPROUT_STATIC_CONSTEXPR auto pair = (key >> ',' >> key) | (key >> ';' >> w::int_) | (key >> ':' >> key >> '!');
+			char const* const sources[] = {"12,34", "12;-34", "7:8!", "7:8", "12", "", "x,1", "12,34,56"};
+			for (std::size_t i = 0; i != sizeof(sources) / sizeof(sources[0]); ++i) {
+				packrat_detail::check_same(sources[i], pair);
+				packrat_detail::check_same(sources[i], w::memo(2)[pair] >> -w::lit(',') >> w::memo(3)[w::collect[w::memo(1)[w::digit]]]);
+				packrat_detail::check_same(sources[i], w::collect[w::memo(4)[w::alpha | w::digit]]);
+			}
+			// without a memo_table memo[] is a pass-through, also in constant expressions
+			SPROUT_STATIC_CONSTEXPR auto source = sprout::to_string("12;-34");
+			SPROUT_STATIC_CONSTEXPR auto result = w::parse(source.begin(), source.end(), pair);
+			TESTSPR_BOTH_ASSERT(result.success());
+			TESTSPR_BOTH_ASSERT(result.attr()[0] == 12 && result.attr()[1] == -34);
+		}
+		{
+			// a memoized rule is evaluated once per position
+			std::string const source = "12;34";
+			std::size_t count = 0;
+			packrat_detail::counted_uint_p const counted(&count);
+			auto const key = w::memo(1)[counted];
+			auto const pair = (key >> ',' >> key) | (key >> ';' >> key) | (key >> ':' >> key);
+
+			auto const plain = w::parse(source.begin(), source.end(), pair);
+			TESTSPR_ASSERT(plain.success());
+			TESTSPR_ASSERT(count == 3);
+
+			count = 0;
+			w::memo_table<std::string::const_iterator> memo(source.begin());
+			auto const packrat = w::packrat_parse(source.begin(), source.end(), pair, memo);
+			TESTSPR_ASSERT(packrat.success());
+			TESTSPR_ASSERT(packrat.attr()[0] == 12 && packrat.attr()[1] == 34);
+			TESTSPR_ASSERT(count == 2);
+			TESTSPR_ASSERT(memo.size() == 2);
+
+			// a failure is memoized as well
+			std::string const bad = "12!34";
+			count = 0;
+			TESTSPR_ASSERT(!w::parse(bad.begin(), bad.end(), pair).success());
+			TESTSPR_ASSERT(count == 3);
+			count = 0;
+			TESTSPR_ASSERT(!w::packrat_parse(bad.begin(), bad.end(), pair, memo).success());
+			TESTSPR_ASSERT(count == 1);
+			TESTSPR_ASSERT(memo.size() == 1);
+
+			// the table is reset for each parse
+			count = 0;
+			TESTSPR_ASSERT(w::packrat_parse(source, pair, memo).success());
+			TESTSPR_ASSERT(count == 2);
+			TESTSPR_ASSERT(memo.size() == 2);
+
+			// different ids do not share entries
+			count = 0;
+			auto const split = (w::memo(1)[counted] >> ',') | (w::memo(2)[counted] >> ';') | (w::memo(1)[counted] >> ';');
+			TESTSPR_ASSERT(w::packrat_parse(source, split, memo).success());
+			TESTSPR_ASSERT(count == 2);
+			TESTSPR_ASSERT(memo.size() == 2);
+		}
+	}
+}	// namespace testspr
+
+#ifndef TESTSPR_CPP_INCLUDE
+#	define TESTSPR_TEST_FUNCTION testspr::packrat_test
+#	include <testspr/include_main.hpp>
+#endif
+
+#endif	// #ifndef SPROUT_LIBS_WEED_TEST_PACKRAT_CPP
@@ -9,19 +9,43 @@
 #define SPROUT_ARRAY_HASH_HPP
 
 #include <functional>
+#include <type_traits>
 #include <sprout/config.hpp>
 #include <sprout/workaround/std/cstddef.hpp>
 #include <sprout/array/array.hpp>
 #include <sprout/functional/hash.hpp>
+#include <sprout/functional/hash/hash_bytes.hpp>
+#include <sprout/type_traits/integral_constant.hpp>
 
 namespace sprout {
+	namespace detail {
+		template<typename T>
+		struct is_array_hash_bytes
+			: public sprout::bool_constant<
+				std::is_integral<T>::value && sizeof(T) == 1 && !std::is_same<T, bool>::value
+			>
+		{};
+
+		template<typename T, std::size_t N>
+		inline SPROUT_CONSTEXPR std::size_t
+		array_hash_value(sprout::array<T, N> const& v, sprout::true_type) {
+			return sprout::hash_bytes(v);
+		}
+		template<typename T, std::size_t N>
+		inline SPROUT_CONSTEXPR std::size_t
+		array_hash_value(sprout::array<T, N> const& v, sprout::false_type) {
+			return sprout::hash_range(v);
+		}
+	}	// namespace detail
 	//
 	// hash_value
 	//
+	//	Arrays of bytes and characters use hash_bytes; other element types are combined.
+	//
 	template<typename T, std::size_t N>
 	inline SPROUT_CONSTEXPR std::size_t
 	hash_value(sprout::array<T, N> const& v) {
-		return sprout::hash_range(v);
+		return sprout::detail::array_hash_value(v, sprout::detail::is_array_hash_bytes<T>());
 	}
 }	// namespace sprout
 
@@ -36,7 +60,19 @@ namespace std {
 	template<typename T, std::size_t N>
 	struct hash<sprout::array<T, N> >
 		: public sprout::hash<sprout::array<T, N> >
-	{};
+	{
+	private:
+		static std::size_t call(sprout::array<T, N> const& v, sprout::true_type) {
+			return sprout::hash_memory(v.data(), v.size());
+		}
+		static std::size_t call(sprout::array<T, N> const& v, sprout::false_type) {
+			return sprout::to_hash(v);
+		}
+	public:
+		std::size_t operator()(sprout::array<T, N> const& v) const {
+			return call(v, sprout::detail::is_array_hash_bytes<T>());
+		}
+	};
 #if defined(__clang__)
 #	pragma clang diagnostic pop
 #endif
@@ -13,5 +13,7 @@
 #include <sprout/bitset/bitwise.hpp>
 #include <sprout/bitset/io.hpp>
 #include <sprout/bitset/hash.hpp>
+#include <sprout/bitset/dynamic_bitset.hpp>
+#include <sprout/bitset/roaring_bitmap.hpp>
 
 #endif	// #ifndef SPROUT_BITSET_HPP
@@ -34,6 +34,8 @@
 #include <sprout/utility/forward.hpp>
 #include <sprout/utility/move.hpp>
 #include <sprout/bit/operation.hpp>
+#include <sprout/detail/bit_words.hpp>
+#include <sprout/detail/simd.hpp>
 #include <sprout/math/comparisons.hpp>
 #include HDR_FUNCTIONAL_SSCRISK_CEL_OR_SPROUT
 
@@ -123,7 +125,7 @@ namespace sprout {
 				return first == last ? not_found
 					: *first != static_cast<word_type>(0)
 						? i * (CHAR_BIT * sprout::detail::sizeof_<unsigned long>::value) + sprout::ctz(*first)
-					: find_next_impl_2(not_found, first + 1, last)
+					: find_next_impl_2(not_found, first + 1, last, i + 1)
 					;
 			}
 			SPROUT_CONSTEXPR size_type
@@ -224,13 +226,39 @@ namespace sprout {
 						)
 					;
 			}
+			// from eight words on, runtime calls go to sprout/detail/bit_words.hpp
+			static SPROUT_CONSTEXPR bool
+			runtime_words() SPROUT_NOEXCEPT {
+#if defined(SPROUT_DETAIL_HAS_IS_CONSTANT_EVALUATED)
+				return N >= 8 && !__builtin_is_constant_evaluated();
+#else
+				return false;
+#endif
+			}
+			template<typename Op>
+			SPROUT_NON_CONSTEXPR base_bitset<N>
+			transform_words(base_bitset<N> const& x) const SPROUT_NOEXCEPT {
+				base_bitset<N> result;
+				sprout::detail::bit_words_transform<Op>(result.w_, w_, x.w_, N);
+				return result;
+			}
+			static SPROUT_CONSTEXPR size_type
+			found_or(size_type pos, size_type not_found) SPROUT_NOEXCEPT {
+				return pos < N * (CHAR_BIT * sprout::detail::sizeof_<unsigned long>::value) ? pos
+					: not_found
+					;
+			}
 		public:
 			SPROUT_CONSTEXPR base_bitset() SPROUT_NOEXCEPT
 				: w_()
 			{}
 			base_bitset(base_bitset<N> const&) = default;
 			SPROUT_CONSTEXPR base_bitset(unsigned long long val) SPROUT_NOEXCEPT
-				: w_{word_type(val), word_type(val >> (CHAR_BIT * sprout::detail::sizeof_<unsigned long>::value))}
+				: w_{
+					word_type(val),
+					// in two halves: unsigned long may be as wide as unsigned long long
+					word_type((val >> (CHAR_BIT * sprout::detail::sizeof_<unsigned long>::value / 2)) >> (CHAR_BIT * sprout::detail::sizeof_<unsigned long>::value / 2))
+					}
 			{}
 			template<typename... Words>
 			SPROUT_CONSTEXPR base_bitset(sprout::detail::base_bitset_from_words_construct_tag, Words... words)
@@ -281,39 +309,57 @@ namespace sprout {
 
 			SPROUT_CXX14_CONSTEXPR void
 			do_and(base_bitset<N> const& x) SPROUT_NOEXCEPT {
+				if (N >= 8 && !SPROUT_DETAIL_IS_CONSTANT_EVALUATED()) {
+					sprout::detail::bit_words_transform<sprout::detail::bit_words_and>(w_, w_, x.w_, N);
+					return;
+				}
 				for (size_type i = 0; i < N; i++) {
 					w_[i] &= x.w_[i];
 				}
 			}
 			SPROUT_CONSTEXPR base_bitset<N>
 			do_and(base_bitset<N> const& x) const SPROUT_NOEXCEPT {
-				return sprout::fixed::transform(
-					begin(), end(), x.begin(), *this, NS_SSCRISK_CEL_OR_SPROUT::bit_and<word_type>()
-					);
+				return runtime_words() ? transform_words<sprout::detail::bit_words_and>(x)
+					: sprout::fixed::transform(
+						begin(), end(), x.begin(), *this, NS_SSCRISK_CEL_OR_SPROUT::bit_and<word_type>()
+						)
+					;
 			}
 			SPROUT_CXX14_CONSTEXPR void
 			do_or(base_bitset<N> const& x) SPROUT_NOEXCEPT {
+				if (N >= 8 && !SPROUT_DETAIL_IS_CONSTANT_EVALUATED()) {
+					sprout::detail::bit_words_transform<sprout::detail::bit_words_or>(w_, w_, x.w_, N);
+					return;
+				}
 				for (size_type i = 0; i < N; i++) {
 					w_[i] |= x.w_[i];
 				}
 			}
 			SPROUT_CONSTEXPR base_bitset<N>
 			do_or(base_bitset<N> const& x) const SPROUT_NOEXCEPT {
-				return sprout::fixed::transform(
-					begin(), end(), x.begin(), *this, NS_SSCRISK_CEL_OR_SPROUT::bit_or<word_type>()
-					);
+				return runtime_words() ? transform_words<sprout::detail::bit_words_or>(x)
+					: sprout::fixed::transform(
+						begin(), end(), x.begin(), *this, NS_SSCRISK_CEL_OR_SPROUT::bit_or<word_type>()
+						)
+					;
 			}
 			SPROUT_CXX14_CONSTEXPR void
 			do_xor(base_bitset<N> const& x) SPROUT_NOEXCEPT {
+				if (N >= 8 && !SPROUT_DETAIL_IS_CONSTANT_EVALUATED()) {
+					sprout::detail::bit_words_transform<sprout::detail::bit_words_xor>(w_, w_, x.w_, N);
+					return;
+				}
 				for (size_type i = 0; i < N; i++) {
 					w_[i] ^= x.w_[i];
 				}
 			}
 			SPROUT_CONSTEXPR base_bitset<N>
 			do_xor(base_bitset<N> const& x) const SPROUT_NOEXCEPT {
-				return sprout::fixed::transform(
-					begin(), end(), x.begin(), *this, NS_SSCRISK_CEL_OR_SPROUT::bit_xor<word_type>()
-					);
+				return runtime_words() ? transform_words<sprout::detail::bit_words_xor>(x)
+					: sprout::fixed::transform(
+						begin(), end(), x.begin(), *this, NS_SSCRISK_CEL_OR_SPROUT::bit_xor<word_type>()
+						)
+					;
 			}
 			SPROUT_CXX14_CONSTEXPR void
 			do_left_shift(size_type shift) SPROUT_NOEXCEPT {
@@ -421,7 +467,9 @@ namespace sprout {
 			}
 			SPROUT_CONSTEXPR size_type
 			do_count() const SPROUT_NOEXCEPT {
-				return sprout::accumulate(begin(), end(), static_cast<size_type>(0), count_op());
+				return runtime_words() ? sprout::detail::bit_words_count(w_, N)
+					: sprout::accumulate(begin(), end(), static_cast<size_type>(0), count_op())
+					;
 			}
 
 			SPROUT_CONSTEXPR unsigned long
@@ -449,12 +497,15 @@ namespace sprout {
 
 			SPROUT_CONSTEXPR size_type
 			find_first(size_type not_found) const SPROUT_NOEXCEPT {
-				return find_first_impl(not_found, begin(), end());
+				return runtime_words() ? found_or(sprout::detail::bit_words_find_next(w_, N, 0), not_found)
+					: find_first_impl(not_found, begin(), end())
+					;
 			}
 			SPROUT_CONSTEXPR size_type
 			find_next(size_type prev, size_type not_found) const SPROUT_NOEXCEPT {
 				return prev + 1 >= N * (CHAR_BIT * sprout::detail::sizeof_<unsigned long>::value) ? not_found
-					: find_next_impl(prev + 1, not_found, whichword(prev + 1));
+					: runtime_words() ? found_or(sprout::detail::bit_words_find_next(w_, N, prev + 1), not_found)
+					: find_next_impl(prev + 1, not_found, whichword(prev + 1))
 					;
 			}
 
@@ -1389,11 +1440,11 @@ namespace sprout {
 
 		SPROUT_CONSTEXPR size_type
 		find_first() const SPROUT_NOEXCEPT {
-			return this->find_first(N);
+			return base_type::find_first(N);
 		}
 		SPROUT_CONSTEXPR size_type
 		find_next(size_type prev) const SPROUT_NOEXCEPT {
-			return this->find_next(prev, N);
+			return base_type::find_next(prev, N);
 		}
 
 	public:
@@ -0,0 +1,639 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_BITSET_DETAIL_ROARING_CONTAINER_HPP
+#define SPROUT_BITSET_DETAIL_ROARING_CONTAINER_HPP
+
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/bit/ctz.hpp>
+#include <sprout/bit/popcount.hpp>
+#include <sprout/detail/bit_words.hpp>
+
+namespace sprout {
+	namespace detail {
+		//
+		// roaring_container
+		//
+		//	The values of a roaring_bitmap that share their high 16 bits, key, as
+		//	one of:
+		//		array:  values, the sorted low halves; cardinality <= array_max
+		//		bitmap: words, 65536 bits; cardinality > array_max
+		//		run:    values, pairs (start, length - 1) of sorted disjoint runs
+		//	Arrays and bitmaps are switched by cardinality whenever they change;
+		//	runs only come from run_optimize, add_range and run with run operations.
+		//
+		struct roaring_container {
+		public:
+			enum kind_type {
+				array_kind,
+				bitmap_kind,
+				run_kind
+			};
+			enum {
+				array_max = 4096,
+				bitmap_words = 1024
+			};
+		public:
+			std::uint16_t key;
+			kind_type kind;
+			std::uint32_t cardinality;
+			std::vector<std::uint16_t> values;
+			std::vector<std::uint64_t> words;
+		public:
+			explicit roaring_container(std::uint16_t key_ = 0, kind_type kind_ = array_kind)
+				: key(key_), kind(kind_), cardinality(0), values(), words()
+			{}
+		};
+
+		//
+		// roaring_interval
+		//
+		//	A run [first, last] of low halves, in 32 bits so that last + 1 does not wrap.
+		//
+		struct roaring_interval {
+		public:
+			std::uint32_t first;
+			std::uint32_t last;
+		};
+
+		inline void
+		roaring_set_range(std::uint64_t* w, std::uint32_t first, std::uint32_t last) {
+			std::uint32_t const i = first >> 6;
+			std::uint32_t const j = last >> 6;
+			std::uint64_t const head = ~static_cast<std::uint64_t>(0) << (first & 63);
+			std::uint64_t const tail = ~static_cast<std::uint64_t>(0) >> (63 - (last & 63));
+			if (i == j) {
+				w[i] |= head & tail;
+				return;
+			}
+			w[i] |= head;
+			for (std::uint32_t k = i + 1; k != j; ++k) {
+				w[k] = ~static_cast<std::uint64_t>(0);
+			}
+			w[j] |= tail;
+		}
+		inline void
+		roaring_clear_range(std::uint64_t* w, std::uint32_t first, std::uint32_t last) {
+			std::uint32_t const i = first >> 6;
+			std::uint32_t const j = last >> 6;
+			std::uint64_t const head = ~static_cast<std::uint64_t>(0) << (first & 63);
+			std::uint64_t const tail = ~static_cast<std::uint64_t>(0) >> (63 - (last & 63));
+			if (i == j) {
+				w[i] &= ~(head & tail);
+				return;
+			}
+			w[i] &= ~head;
+			for (std::uint32_t k = i + 1; k != j; ++k) {
+				w[k] = 0;
+			}
+			w[j] &= ~tail;
+		}
+
+		//
+		// roaring_intervals
+		// roaring_from_intervals
+		//
+		inline std::vector<sprout::detail::roaring_interval>
+		roaring_intervals(sprout::detail::roaring_container const& c) {
+			std::vector<sprout::detail::roaring_interval> result(c.values.size() / 2);
+			for (std::size_t i = 0; i != result.size(); ++i) {
+				result[i].first = c.values[2 * i];
+				result[i].last = static_cast<std::uint32_t>(c.values[2 * i]) + c.values[2 * i + 1];
+			}
+			return result;
+		}
+		inline sprout::detail::roaring_container
+		roaring_from_intervals(std::uint16_t key, std::vector<sprout::detail::roaring_interval> const& runs) {
+			sprout::detail::roaring_container result(key, sprout::detail::roaring_container::run_kind);
+			result.values.reserve(runs.size() * 2);
+			for (std::size_t i = 0; i != runs.size(); ++i) {
+				result.values.push_back(static_cast<std::uint16_t>(runs[i].first));
+				result.values.push_back(static_cast<std::uint16_t>(runs[i].last - runs[i].first));
+				result.cardinality += runs[i].last - runs[i].first + 1;
+			}
+			return result;
+		}
+
+		//
+		// roaring_for_each
+		//
+		//	Calls f(low) for each value of c in increasing order.
+		//
+		template<typename F>
+		inline void
+		roaring_for_each(sprout::detail::roaring_container const& c, F& f) {
+			switch (c.kind) {
+			case sprout::detail::roaring_container::array_kind:
+				for (std::size_t i = 0; i != c.values.size(); ++i) {
+					f(static_cast<std::uint32_t>(c.values[i]));
+				}
+				break;
+			case sprout::detail::roaring_container::bitmap_kind:
+				for (std::uint32_t i = 0; i != sprout::detail::roaring_container::bitmap_words; ++i) {
+					for (std::uint64_t w = c.words[i]; w != 0; w &= w - 1) {
+						f(i * 64 + static_cast<std::uint32_t>(sprout::ctz(w)));
+					}
+				}
+				break;
+			case sprout::detail::roaring_container::run_kind:
+				for (std::size_t i = 0; i != c.values.size(); i += 2) {
+					std::uint32_t const last = static_cast<std::uint32_t>(c.values[i]) + c.values[i + 1];
+					for (std::uint32_t x = c.values[i]; x <= last; ++x) {
+						f(x);
+					}
+				}
+				break;
+			}
+		}
+
+		//
+		// roaring_contains
+		//
+		inline bool
+		roaring_contains(sprout::detail::roaring_container const& c, std::uint32_t low) {
+			switch (c.kind) {
+			case sprout::detail::roaring_container::array_kind:
+				return std::binary_search(c.values.begin(), c.values.end(), static_cast<std::uint16_t>(low));
+			case sprout::detail::roaring_container::bitmap_kind:
+				return ((c.words[low >> 6] >> (low & 63)) & 1) != 0;
+			case sprout::detail::roaring_container::run_kind:
+				{
+					// the last run starting at or before low
+					std::size_t lo = 0;
+					std::size_t hi = c.values.size() / 2;
+					while (lo != hi) {
+						std::size_t const mid = lo + (hi - lo) / 2;
+						if (c.values[2 * mid] <= low) {
+							lo = mid + 1;
+						} else {
+							hi = mid;
+						}
+					}
+					return lo != 0 && low <= static_cast<std::uint32_t>(c.values[2 * lo - 2]) + c.values[2 * lo - 1];
+				}
+			}
+			return false;
+		}
+
+		//
+		// roaring_to_words
+		// roaring_words_of
+		//
+		//	The 1024 words of c, copied into result, or for words_of its own for a
+		//	bitmap and otherwise built in scratch.
+		//
+		inline void
+		roaring_to_words(sprout::detail::roaring_container const& c, std::vector<std::uint64_t>& result) {
+			switch (c.kind) {
+			case sprout::detail::roaring_container::array_kind:
+				result.assign(sprout::detail::roaring_container::bitmap_words, 0);
+				for (std::size_t i = 0; i != c.values.size(); ++i) {
+					result[c.values[i] >> 6] |= static_cast<std::uint64_t>(1) << (c.values[i] & 63);
+				}
+				break;
+			case sprout::detail::roaring_container::bitmap_kind:
+				result = c.words;
+				break;
+			case sprout::detail::roaring_container::run_kind:
+				result.assign(sprout::detail::roaring_container::bitmap_words, 0);
+				for (std::size_t i = 0; i != c.values.size(); i += 2) {
+					sprout::detail::roaring_set_range(result.data(), c.values[i], static_cast<std::uint32_t>(c.values[i]) + c.values[i + 1]);
+				}
+				break;
+			}
+		}
+		inline std::uint64_t const*
+		roaring_words_of(sprout::detail::roaring_container const& c, std::vector<std::uint64_t>& scratch) {
+			if (c.kind == sprout::detail::roaring_container::bitmap_kind) {
+				return c.words.data();
+			}
+			sprout::detail::roaring_to_words(c, scratch);
+			return scratch.data();
+		}
+
+		//
+		// roaring_from_words
+		// roaring_from_array
+		//
+		//	An array or a bitmap container, whichever the cardinality calls for.
+		//
+		inline sprout::detail::roaring_container
+		roaring_from_words(std::uint16_t key, std::vector<std::uint64_t>& words) {
+			sprout::detail::roaring_container result(key);
+			result.cardinality = static_cast<std::uint32_t>(sprout::detail::bit_words_count(words.data(), words.size()));
+			if (result.cardinality > sprout::detail::roaring_container::array_max) {
+				result.kind = sprout::detail::roaring_container::bitmap_kind;
+				result.words.swap(words);
+				return result;
+			}
+			result.values.reserve(result.cardinality);
+			for (std::uint32_t i = 0; i != sprout::detail::roaring_container::bitmap_words; ++i) {
+				for (std::uint64_t w = words[i]; w != 0; w &= w - 1) {
+					result.values.push_back(static_cast<std::uint16_t>(i * 64 + sprout::ctz(w)));
+				}
+			}
+			return result;
+		}
+		inline sprout::detail::roaring_container
+		roaring_from_array(std::uint16_t key, std::vector<std::uint16_t>& values) {
+			sprout::detail::roaring_container result(key);
+			result.cardinality = static_cast<std::uint32_t>(values.size());
+			if (result.cardinality > sprout::detail::roaring_container::array_max) {
+				result.kind = sprout::detail::roaring_container::bitmap_kind;
+				result.words.assign(sprout::detail::roaring_container::bitmap_words, 0);
+				for (std::size_t i = 0; i != values.size(); ++i) {
+					result.words[values[i] >> 6] |= static_cast<std::uint64_t>(1) << (values[i] & 63);
+				}
+				return result;
+			}
+			result.values.swap(values);
+			return result;
+		}
+		// c as an array or a bitmap, for the updates that do not keep runs
+		inline void
+		roaring_materialize(sprout::detail::roaring_container& c) {
+			if (c.kind == sprout::detail::roaring_container::run_kind) {
+				std::vector<std::uint64_t> words;
+				sprout::detail::roaring_to_words(c, words);
+				c = sprout::detail::roaring_from_words(c.key, words);
+			}
+		}
+
+		//
+		// roaring_add
+		// roaring_remove
+		//
+		//	Return whether c changed.
+		//
+		inline bool
+		roaring_add(sprout::detail::roaring_container& c, std::uint32_t low) {
+			if (c.kind == sprout::detail::roaring_container::run_kind) {
+				if (sprout::detail::roaring_contains(c, low)) {
+					return false;
+				}
+				sprout::detail::roaring_materialize(c);
+			}
+			if (c.kind == sprout::detail::roaring_container::bitmap_kind) {
+				std::uint64_t& w = c.words[low >> 6];
+				std::uint64_t const bit = static_cast<std::uint64_t>(1) << (low & 63);
+				if (w & bit) {
+					return false;
+				}
+				w |= bit;
+				++c.cardinality;
+				return true;
+			}
+			std::vector<std::uint16_t>::iterator const it = std::lower_bound(c.values.begin(), c.values.end(), static_cast<std::uint16_t>(low));
+			if (it != c.values.end() && *it == low) {
+				return false;
+			}
+			c.values.insert(it, static_cast<std::uint16_t>(low));
+			if (++c.cardinality > sprout::detail::roaring_container::array_max) {
+				c = sprout::detail::roaring_from_array(c.key, c.values);
+			}
+			return true;
+		}
+		inline bool
+		roaring_remove(sprout::detail::roaring_container& c, std::uint32_t low) {
+			if (!sprout::detail::roaring_contains(c, low)) {
+				return false;
+			}
+			sprout::detail::roaring_materialize(c);
+			if (c.kind == sprout::detail::roaring_container::bitmap_kind) {
+				c.words[low >> 6] &= ~(static_cast<std::uint64_t>(1) << (low & 63));
+				if (--c.cardinality <= sprout::detail::roaring_container::array_max) {
+					c = sprout::detail::roaring_from_words(c.key, c.words);
+				}
+				return true;
+			}
+			c.values.erase(std::lower_bound(c.values.begin(), c.values.end(), static_cast<std::uint16_t>(low)));
+			--c.cardinality;
+			return true;
+		}
+
+		//
+		// roaring_interval_appender
+		//
+		//	Extends the last run of r by x or starts a new one; x increasing.
+		//
+		struct roaring_interval_appender {
+		public:
+			std::vector<sprout::detail::roaring_interval>& r;
+		public:
+			void operator()(std::uint32_t x) {
+				if (!r.empty() && r.back().last + 1 == x) {
+					r.back().last = x;
+				} else {
+					sprout::detail::roaring_interval const v = {x, x};
+					r.push_back(v);
+				}
+			}
+		};
+
+		//
+		// roaring_count_runs
+		// roaring_run_optimize
+		//
+		//	run_optimize stores c in whichever of the three forms serializes smallest
+		//	and returns whether it is a run container afterwards.
+		//
+		inline std::size_t
+		roaring_count_runs(sprout::detail::roaring_container const& c) {
+			std::size_t result = 0;
+			switch (c.kind) {
+			case sprout::detail::roaring_container::array_kind:
+				for (std::size_t i = 0; i != c.values.size(); ++i) {
+					result += i == 0 || c.values[i] != c.values[i - 1] + 1;
+				}
+				break;
+			case sprout::detail::roaring_container::bitmap_kind:
+				{
+					std::uint64_t carry = 0;
+					for (std::size_t i = 0; i != sprout::detail::roaring_container::bitmap_words; ++i) {
+						std::uint64_t const w = c.words[i];
+						result += sprout::popcount(w & ~((w << 1) | carry));
+						carry = w >> 63;
+					}
+				}
+				break;
+			case sprout::detail::roaring_container::run_kind:
+				result = c.values.size() / 2;
+				break;
+			}
+			return result;
+		}
+		inline bool
+		roaring_run_optimize(sprout::detail::roaring_container& c) {
+			std::size_t const runs = sprout::detail::roaring_count_runs(c);
+			std::size_t const run_size = 2 + 4 * runs;
+			std::size_t const other_size = c.cardinality <= sprout::detail::roaring_container::array_max ? 2 * c.cardinality
+				: 2 * sprout::detail::roaring_container::bitmap_words * 4
+				;
+			if (run_size < other_size) {
+				if (c.kind != sprout::detail::roaring_container::run_kind) {
+					std::vector<sprout::detail::roaring_interval> intervals;
+					intervals.reserve(runs);
+					sprout::detail::roaring_interval_appender f = {intervals};
+					sprout::detail::roaring_for_each(c, f);
+					c = sprout::detail::roaring_from_intervals(c.key, intervals);
+				}
+				return true;
+			}
+			sprout::detail::roaring_materialize(c);
+			return false;
+		}
+
+		//
+		// roaring_and_runs
+		// roaring_or_runs
+		// roaring_andnot_runs
+		//
+		//	Set operations on sorted disjoint runs, by merging.
+		//
+		inline std::vector<sprout::detail::roaring_interval>
+		roaring_and_runs(std::vector<sprout::detail::roaring_interval> const& a, std::vector<sprout::detail::roaring_interval> const& b) {
+			std::vector<sprout::detail::roaring_interval> result;
+			for (std::size_t i = 0, j = 0; i != a.size() && j != b.size(); ) {
+				sprout::detail::roaring_interval const v = {std::max(a[i].first, b[j].first), std::min(a[i].last, b[j].last)};
+				if (v.first <= v.last) {
+					result.push_back(v);
+				}
+				if (a[i].last < b[j].last) {
+					++i;
+				} else {
+					++j;
+				}
+			}
+			return result;
+		}
+		inline std::vector<sprout::detail::roaring_interval>
+		roaring_or_runs(std::vector<sprout::detail::roaring_interval> const& a, std::vector<sprout::detail::roaring_interval> const& b) {
+			std::vector<sprout::detail::roaring_interval> result;
+			result.reserve(a.size() + b.size());
+			for (std::size_t i = 0, j = 0; i != a.size() || j != b.size(); ) {
+				sprout::detail::roaring_interval const v = j == b.size() || (i != a.size() && a[i].first < b[j].first) ? a[i++] : b[j++];
+				if (!result.empty() && v.first <= result.back().last + 1) {
+					result.back().last = std::max(result.back().last, v.last);
+				} else {
+					result.push_back(v);
+				}
+			}
+			return result;
+		}
+		inline std::vector<sprout::detail::roaring_interval>
+		roaring_andnot_runs(std::vector<sprout::detail::roaring_interval> const& a, std::vector<sprout::detail::roaring_interval> const& b) {
+			std::vector<sprout::detail::roaring_interval> result;
+			std::size_t j = 0;
+			for (std::size_t i = 0; i != a.size(); ++i) {
+				std::uint32_t first = a[i].first;
+				for (; j != b.size() && b[j].last < first; ++j)
+					;
+				for (std::size_t k = j; k != b.size() && b[k].first <= a[i].last; ++k) {
+					if (b[k].first > first) {
+						sprout::detail::roaring_interval const v = {first, b[k].first - 1};
+						result.push_back(v);
+					}
+					first = b[k].last + 1;
+					if (first > a[i].last) {
+						break;
+					}
+				}
+				if (first <= a[i].last) {
+					sprout::detail::roaring_interval const v = {first, a[i].last};
+					result.push_back(v);
+				}
+			}
+			return result;
+		}
+
+		//
+		// roaring_filter
+		//
+		//	The values of the array container a that are (Member) or are not in b.
+		//
+		template<bool Member>
+		inline sprout::detail::roaring_container
+		roaring_filter(sprout::detail::roaring_container const& a, sprout::detail::roaring_container const& b) {
+			std::vector<std::uint16_t> values;
+			values.reserve(a.values.size());
+			for (std::size_t i = 0; i != a.values.size(); ++i) {
+				if (sprout::detail::roaring_contains(b, a.values[i]) == Member) {
+					values.push_back(a.values[i]);
+				}
+			}
+			return sprout::detail::roaring_from_array(a.key, values);
+		}
+
+		//
+		// roaring_and
+		// roaring_or
+		// roaring_andnot
+		//
+		//	The containers of a & b, a | b and a & ~b for a.key == b.key:
+		//		array with array:  merged (intersections gallop through the larger)
+		//		array with other:  the array filtered by membership (and, andnot)
+		//		run with run:      merged runs
+		//		otherwise:         word-parallel over bitmaps (bit_words_transform)
+		//	A result may be empty.
+		//
+		inline sprout::detail::roaring_container
+		roaring_and(sprout::detail::roaring_container const& a, sprout::detail::roaring_container const& b) {
+			typedef sprout::detail::roaring_container container;
+			if (a.kind == container::array_kind && b.kind == container::array_kind) {
+				container const& small = a.values.size() <= b.values.size() ? a : b;
+				container const& large = a.values.size() <= b.values.size() ? b : a;
+				std::vector<std::uint16_t> values;
+				if (small.values.size() * 32 < large.values.size()) {
+					std::vector<std::uint16_t>::const_iterator it = large.values.begin();
+					for (std::size_t i = 0; i != small.values.size() && it != large.values.end(); ++i) {
+						it = std::lower_bound(it, large.values.end(), small.values[i]);
+						if (it != large.values.end() && *it == small.values[i]) {
+							values.push_back(small.values[i]);
+						}
+					}
+				} else {
+					// branch-free merge: the comparisons are unpredictable on sparse data
+					values.resize(small.values.size());
+					std::size_t k = 0;
+					for (std::size_t i = 0, j = 0; i != a.values.size() && j != b.values.size(); ) {
+						std::uint16_t const x = a.values[i];
+						std::uint16_t const y = b.values[j];
+						values[k] = x;
+						k += x == y;
+						i += x <= y;
+						j += y <= x;
+					}
+					values.resize(k);
+				}
+				return sprout::detail::roaring_from_array(a.key, values);
+			}
+			if (a.kind == container::array_kind) {
+				return sprout::detail::roaring_filter<true>(a, b);
+			}
+			if (b.kind == container::array_kind) {
+				return sprout::detail::roaring_filter<true>(b, a);
+			}
+			if (a.kind == container::run_kind && b.kind == container::run_kind) {
+				return sprout::detail::roaring_from_intervals(
+					a.key,
+					sprout::detail::roaring_and_runs(sprout::detail::roaring_intervals(a), sprout::detail::roaring_intervals(b))
+					);
+			}
+			std::vector<std::uint64_t> scratch;
+			std::vector<std::uint64_t> words;
+			sprout::detail::roaring_to_words(a, words);
+			sprout::detail::bit_words_transform<sprout::detail::bit_words_and>(
+				words.data(), words.data(), sprout::detail::roaring_words_of(b, scratch), words.size()
+				);
+			return sprout::detail::roaring_from_words(a.key, words);
+		}
+		inline sprout::detail::roaring_container
+		roaring_or(sprout::detail::roaring_container const& a, sprout::detail::roaring_container const& b) {
+			typedef sprout::detail::roaring_container container;
+			if (a.kind == container::array_kind && b.kind == container::array_kind) {
+				std::vector<std::uint16_t> values;
+				values.reserve(a.values.size() + b.values.size());
+				std::set_union(
+					a.values.begin(), a.values.end(), b.values.begin(), b.values.end(),
+					std::back_inserter(values)
+					);
+				return sprout::detail::roaring_from_array(a.key, values);
+			}
+			if (a.kind == container::run_kind && b.kind == container::run_kind) {
+				return sprout::detail::roaring_from_intervals(
+					a.key,
+					sprout::detail::roaring_or_runs(sprout::detail::roaring_intervals(a), sprout::detail::roaring_intervals(b))
+					);
+			}
+			// the bitmap (if any) is copied and the other container added into it
+			container const& base = b.kind == container::bitmap_kind ? b : a;
+			container const& other = b.kind == container::bitmap_kind ? a : b;
+			std::vector<std::uint64_t> words;
+			sprout::detail::roaring_to_words(base, words);
+			switch (other.kind) {
+			case container::array_kind:
+				for (std::size_t i = 0; i != other.values.size(); ++i) {
+					words[other.values[i] >> 6] |= static_cast<std::uint64_t>(1) << (other.values[i] & 63);
+				}
+				break;
+			case container::bitmap_kind:
+				sprout::detail::bit_words_transform<sprout::detail::bit_words_or>(words.data(), words.data(), other.words.data(), words.size());
+				break;
+			case container::run_kind:
+				for (std::size_t i = 0; i != other.values.size(); i += 2) {
+					sprout::detail::roaring_set_range(words.data(), other.values[i], static_cast<std::uint32_t>(other.values[i]) + other.values[i + 1]);
+				}
+				break;
+			}
+			return sprout::detail::roaring_from_words(a.key, words);
+		}
+		inline sprout::detail::roaring_container
+		roaring_andnot(sprout::detail::roaring_container const& a, sprout::detail::roaring_container const& b) {
+			typedef sprout::detail::roaring_container container;
+			if (a.kind == container::array_kind && b.kind == container::array_kind) {
+				std::vector<std::uint16_t> values;
+				values.reserve(a.values.size());
+				std::set_difference(
+					a.values.begin(), a.values.end(), b.values.begin(), b.values.end(),
+					std::back_inserter(values)
+					);
+				return sprout::detail::roaring_from_array(a.key, values);
+			}
+			if (a.kind == container::array_kind) {
+				return sprout::detail::roaring_filter<false>(a, b);
+			}
+			if (a.kind == container::run_kind && b.kind == container::run_kind) {
+				return sprout::detail::roaring_from_intervals(
+					a.key,
+					sprout::detail::roaring_andnot_runs(sprout::detail::roaring_intervals(a), sprout::detail::roaring_intervals(b))
+					);
+			}
+			std::vector<std::uint64_t> words;
+			sprout::detail::roaring_to_words(a, words);
+			switch (b.kind) {
+			case container::array_kind:
+				for (std::size_t i = 0; i != b.values.size(); ++i) {
+					words[b.values[i] >> 6] &= ~(static_cast<std::uint64_t>(1) << (b.values[i] & 63));
+				}
+				break;
+			case container::bitmap_kind:
+				sprout::detail::bit_words_transform<sprout::detail::bit_words_andnot>(words.data(), words.data(), b.words.data(), words.size());
+				break;
+			case container::run_kind:
+				for (std::size_t i = 0; i != b.values.size(); i += 2) {
+					sprout::detail::roaring_clear_range(words.data(), b.values[i], static_cast<std::uint32_t>(b.values[i]) + b.values[i + 1]);
+				}
+				break;
+			}
+			return sprout::detail::roaring_from_words(a.key, words);
+		}
+
+		//
+		// roaring_equal
+		//
+		inline bool
+		roaring_equal(sprout::detail::roaring_container const& a, sprout::detail::roaring_container const& b) {
+			if (a.key != b.key || a.cardinality != b.cardinality) {
+				return false;
+			}
+			if (a.kind == b.kind && a.kind != sprout::detail::roaring_container::bitmap_kind) {
+				return a.values == b.values;
+			}
+			std::vector<std::uint64_t> sa;
+			std::vector<std::uint64_t> sb;
+			std::uint64_t const* const wa = sprout::detail::roaring_words_of(a, sa);
+			return std::equal(wa, wa + sprout::detail::roaring_container::bitmap_words, sprout::detail::roaring_words_of(b, sb));
+		}
+	}	// namespace detail
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_BITSET_DETAIL_ROARING_CONTAINER_HPP
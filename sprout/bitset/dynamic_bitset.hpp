@@ -0,0 +1,468 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_BITSET_DYNAMIC_BITSET_HPP
+#define SPROUT_BITSET_DYNAMIC_BITSET_HPP
+
+#include <climits>
+#include <string>
+#include <vector>
+#include <memory>
+#include <utility>
+#include <algorithm>
+#include <locale>
+#include <ostream>
+#include <stdexcept>
+#include <sprout/config.hpp>
+#include <sprout/assert.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/detail/char_literal.hpp>
+#include <sprout/detail/bit_words.hpp>
+
+namespace sprout {
+	//
+	// dynamic_bitset
+	//
+	//	A bitset whose size is given at runtime. Bit pos is bit pos % W of word
+	//	pos / W, and the bits of the last word past size() are kept zero, so the
+	//	whole-buffer operations (&, |, ^, -, count, find_next, rank, select) run
+	//	over the words with the kernels of sprout/detail/bit_words.hpp.
+	//	Binary operations require operands of the same size.
+	//
+	template<typename Block = unsigned long, typename Allocator = std::allocator<Block> >
+	class dynamic_bitset {
+	public:
+		typedef Block word_type;
+		typedef Allocator allocator_type;
+		typedef std::size_t size_type;
+		typedef bool value_type;
+	private:
+		typedef std::vector<word_type, allocator_type> buffer_type;
+	public:
+		class reference {
+			friend class dynamic_bitset;
+		private:
+			word_type* wp_;
+			word_type mask_;
+		private:
+			reference(word_type* wp, word_type mask) SPROUT_NOEXCEPT
+				: wp_(wp), mask_(mask)
+			{}
+		public:
+			reference&
+			operator=(value_type x) SPROUT_NOEXCEPT {
+				if (x) {
+					*wp_ |= mask_;
+				} else {
+					*wp_ &= ~mask_;
+				}
+				return *this;
+			}
+			reference&
+			operator=(reference const& j) SPROUT_NOEXCEPT {
+				return *this = static_cast<value_type>(j);
+			}
+			value_type
+			operator~() const SPROUT_NOEXCEPT {
+				return (*wp_ & mask_) == 0;
+			}
+			operator value_type() const SPROUT_NOEXCEPT {
+				return (*wp_ & mask_) != 0;
+			}
+			reference&
+			flip() SPROUT_NOEXCEPT {
+				*wp_ ^= mask_;
+				return *this;
+			}
+		};
+	public:
+		static SPROUT_CONSTEXPR size_type
+		whichword(size_type pos) SPROUT_NOEXCEPT {
+			return pos / (CHAR_BIT * sizeof(word_type));
+		}
+		static SPROUT_CONSTEXPR size_type
+		whichbit(size_type pos) SPROUT_NOEXCEPT {
+			return pos % (CHAR_BIT * sizeof(word_type));
+		}
+		static SPROUT_CONSTEXPR word_type
+		maskbit(size_type pos) SPROUT_NOEXCEPT {
+			return static_cast<word_type>(1) << whichbit(pos);
+		}
+		static SPROUT_CONSTEXPR size_type
+		words_for(size_type n) SPROUT_NOEXCEPT {
+			return whichword(n) + (whichbit(n) != 0 ? 1 : 0);
+		}
+	private:
+		buffer_type w_;
+		size_type size_;
+	private:
+		void
+		do_sanitize() SPROUT_NOEXCEPT {
+			if (whichbit(size_) != 0) {
+				w_.back() &= ~(~static_cast<word_type>(0) << whichbit(size_));
+			}
+		}
+		void
+		check_size(dynamic_bitset const& rhs) const SPROUT_NOEXCEPT {
+			SPROUT_ASSERT_MSG(size_ == rhs.size_, "dynamic_bitset: operands of different sizes");
+		}
+		template<typename Op>
+		dynamic_bitset&
+		transform_words(dynamic_bitset const& rhs) SPROUT_NOEXCEPT {
+			check_size(rhs);
+			sprout::detail::bit_words_transform<Op>(w_.data(), w_.data(), rhs.w_.data(), w_.size());
+			return *this;
+		}
+		template<typename Char, typename Traits>
+		void
+		copy_from_ptr(Char const* s, size_type len, size_type pos, size_type n, Char zero, Char one) {
+			size_type const nbits = n < len - pos ? n : len - pos;
+			resize(nbits);
+			reset();
+			for (size_type i = nbits; i > 0; --i) {
+				Char const c = s[pos + nbits - i];
+				if (Traits::eq(c, zero)) {
+				} else if (Traits::eq(c, one)) {
+					w_[whichword(i - 1)] |= maskbit(i - 1);
+				} else {
+					throw std::invalid_argument("dynamic_bitset::copy_from_ptr");
+				}
+			}
+		}
+	public:
+		dynamic_bitset()
+			: w_(), size_(0)
+		{}
+		explicit dynamic_bitset(allocator_type const& alloc)
+			: w_(alloc), size_(0)
+		{}
+		explicit dynamic_bitset(size_type n, unsigned long long val = 0, allocator_type const& alloc = allocator_type())
+			: w_(words_for(n), static_cast<word_type>(0), alloc), size_(n)
+		{
+			for (size_type i = 0; i != w_.size() && val != 0; ++i) {
+				w_[i] = static_cast<word_type>(val);
+				val = CHAR_BIT * sizeof(word_type) < CHAR_BIT * sizeof(unsigned long long) ? val >> (CHAR_BIT * sizeof(word_type) % (CHAR_BIT * sizeof(unsigned long long))) : 0;
+			}
+			do_sanitize();
+		}
+		template<typename Char, typename Traits, typename Alloc>
+		explicit dynamic_bitset(
+			std::basic_string<Char, Traits, Alloc> const& s,
+			size_type position = 0, size_type n = std::basic_string<Char, Traits, Alloc>::npos,
+			Char zero = SPROUT_CHAR_LITERAL('0', Char), Char one = SPROUT_CHAR_LITERAL('1', Char)
+			)
+			: w_(), size_(0)
+		{
+			if (position > s.size()) {
+				throw std::out_of_range("dynamic_bitset::dynamic_bitset initial position not valid");
+			}
+			copy_from_ptr<Char, Traits>(s.data(), s.size(), position, n, zero, one);
+		}
+
+		// size:
+		size_type
+		size() const SPROUT_NOEXCEPT {
+			return size_;
+		}
+		size_type
+		num_words() const SPROUT_NOEXCEPT {
+			return w_.size();
+		}
+		bool
+		empty() const SPROUT_NOEXCEPT {
+			return size_ == 0;
+		}
+		void
+		resize(size_type n, value_type x = false) {
+			size_type const old = size_;
+			w_.resize(words_for(n), x ? ~static_cast<word_type>(0) : static_cast<word_type>(0));
+			size_ = n;
+			if (x && n > old && whichbit(old) != 0) {
+				w_[whichword(old)] |= ~static_cast<word_type>(0) << whichbit(old);
+			}
+			do_sanitize();
+		}
+		void
+		clear() SPROUT_NOEXCEPT {
+			w_.clear();
+			size_ = 0;
+		}
+		void
+		push_back(value_type x) {
+			resize(size_ + 1, x);
+		}
+		void
+		swap(dynamic_bitset& other) SPROUT_NOEXCEPT {
+			w_.swap(other.w_);
+			std::swap(size_, other.size_);
+		}
+		allocator_type
+		get_allocator() const {
+			return w_.get_allocator();
+		}
+
+		// bitset operations:
+		dynamic_bitset&
+		operator&=(dynamic_bitset const& rhs) SPROUT_NOEXCEPT {
+			return transform_words<sprout::detail::bit_words_and>(rhs);
+		}
+		dynamic_bitset&
+		operator|=(dynamic_bitset const& rhs) SPROUT_NOEXCEPT {
+			return transform_words<sprout::detail::bit_words_or>(rhs);
+		}
+		dynamic_bitset&
+		operator^=(dynamic_bitset const& rhs) SPROUT_NOEXCEPT {
+			return transform_words<sprout::detail::bit_words_xor>(rhs);
+		}
+		// set difference: *this & ~rhs
+		dynamic_bitset&
+		operator-=(dynamic_bitset const& rhs) SPROUT_NOEXCEPT {
+			return transform_words<sprout::detail::bit_words_andnot>(rhs);
+		}
+		dynamic_bitset&
+		operator<<=(size_type position) SPROUT_NOEXCEPT {
+			if (position >= size_) {
+				return reset();
+			}
+			if (position != 0) {
+				size_type const n = w_.size();
+				size_type const wshift = whichword(position);
+				size_type const offset = whichbit(position);
+				if (offset == 0) {
+					for (size_type i = n; i > wshift; --i) {
+						w_[i - 1] = w_[i - 1 - wshift];
+					}
+				} else {
+					size_type const sub_offset = CHAR_BIT * sizeof(word_type) - offset;
+					for (size_type i = n - 1; i > wshift; --i) {
+						w_[i] = (w_[i - wshift] << offset) | (w_[i - wshift - 1] >> sub_offset);
+					}
+					w_[wshift] = w_[0] << offset;
+				}
+				std::fill(w_.begin(), w_.begin() + wshift, static_cast<word_type>(0));
+				do_sanitize();
+			}
+			return *this;
+		}
+		dynamic_bitset&
+		operator>>=(size_type position) SPROUT_NOEXCEPT {
+			if (position >= size_) {
+				return reset();
+			}
+			if (position != 0) {
+				size_type const n = w_.size();
+				size_type const wshift = whichword(position);
+				size_type const offset = whichbit(position);
+				size_type const limit = n - wshift - 1;
+				if (offset == 0) {
+					for (size_type i = 0; i <= limit; ++i) {
+						w_[i] = w_[i + wshift];
+					}
+				} else {
+					size_type const sub_offset = CHAR_BIT * sizeof(word_type) - offset;
+					for (size_type i = 0; i < limit; ++i) {
+						w_[i] = (w_[i + wshift] >> offset) | (w_[i + wshift + 1] << sub_offset);
+					}
+					w_[limit] = w_[n - 1] >> offset;
+				}
+				std::fill(w_.begin() + limit + 1, w_.end(), static_cast<word_type>(0));
+			}
+			return *this;
+		}
+		dynamic_bitset
+		operator<<(size_type position) const {
+			return dynamic_bitset(*this) <<= position;
+		}
+		dynamic_bitset
+		operator>>(size_type position) const {
+			return dynamic_bitset(*this) >>= position;
+		}
+		dynamic_bitset
+		operator~() const {
+			return dynamic_bitset(*this).flip();
+		}
+		dynamic_bitset&
+		set() SPROUT_NOEXCEPT {
+			std::fill(w_.begin(), w_.end(), ~static_cast<word_type>(0));
+			do_sanitize();
+			return *this;
+		}
+		dynamic_bitset&
+		set(size_type position, bool val = true) {
+			if (position >= size_) {
+				throw std::out_of_range("dynamic_bitset::set");
+			}
+			(*this)[position] = val;
+			return *this;
+		}
+		dynamic_bitset&
+		reset() SPROUT_NOEXCEPT {
+			std::fill(w_.begin(), w_.end(), static_cast<word_type>(0));
+			return *this;
+		}
+		dynamic_bitset&
+		reset(size_type position) {
+			if (position >= size_) {
+				throw std::out_of_range("dynamic_bitset::reset");
+			}
+			w_[whichword(position)] &= ~maskbit(position);
+			return *this;
+		}
+		dynamic_bitset&
+		flip() SPROUT_NOEXCEPT {
+			for (size_type i = 0; i != w_.size(); ++i) {
+				w_[i] = ~w_[i];
+			}
+			do_sanitize();
+			return *this;
+		}
+		dynamic_bitset&
+		flip(size_type position) {
+			if (position >= size_) {
+				throw std::out_of_range("dynamic_bitset::flip");
+			}
+			w_[whichword(position)] ^= maskbit(position);
+			return *this;
+		}
+
+		// element access:
+		reference
+		operator[](size_type position) {
+			return reference(&w_[whichword(position)], maskbit(position));
+		}
+		value_type
+		operator[](size_type position) const {
+			return (w_[whichword(position)] & maskbit(position)) != 0;
+		}
+		value_type
+		test(size_type position) const {
+			if (position >= size_) {
+				throw std::out_of_range("dynamic_bitset::test");
+			}
+			return (*this)[position];
+		}
+		word_type const*
+		data() const SPROUT_NOEXCEPT {
+			return w_.data();
+		}
+		template<typename Char, typename Traits, typename Alloc>
+		std::basic_string<Char, Traits, Alloc>
+		to_string(Char zero = SPROUT_CHAR_LITERAL('0', Char), Char one = SPROUT_CHAR_LITERAL('1', Char)) const {
+			std::basic_string<Char, Traits, Alloc> result(size_, zero);
+			for (size_type i = size_; i > 0; --i) {
+				if ((*this)[i - 1]) {
+					Traits::assign(result[size_ - i], one);
+				}
+			}
+			return result;
+		}
+		std::string
+		to_string(char zero = '0', char one = '1') const {
+			return to_string<char, std::char_traits<char>, std::allocator<char> >(zero, one);
+		}
+
+		// queries:
+		size_type
+		count() const SPROUT_NOEXCEPT {
+			return sprout::detail::bit_words_count(w_.data(), w_.size());
+		}
+		bool
+		all() const SPROUT_NOEXCEPT {
+			return count() == size_;
+		}
+		bool
+		any() const SPROUT_NOEXCEPT {
+			return find_first() != size_;
+		}
+		bool
+		none() const SPROUT_NOEXCEPT {
+			return !any();
+		}
+		// the first set bit (after prev), or size() if none
+		size_type
+		find_first() const SPROUT_NOEXCEPT {
+			return find_from(0);
+		}
+		size_type
+		find_next(size_type prev) const SPROUT_NOEXCEPT {
+			return prev + 1 >= size_ ? size_ : find_from(prev + 1);
+		}
+		size_type
+		find_from(size_type position) const SPROUT_NOEXCEPT {
+			size_type const result = sprout::detail::bit_words_find_next(w_.data(), w_.size(), position);
+			return result < size_ ? result : size_;
+		}
+		// the number of set bits before position (position <= size())
+		size_type
+		rank(size_type position) const SPROUT_NOEXCEPT {
+			SPROUT_ASSERT_MSG(position <= size_, "dynamic_bitset::rank: position out of range");
+			return sprout::detail::bit_words_rank(w_.data(), position);
+		}
+		// the position of the set bit of rank k, or size() if count() <= k
+		size_type
+		select(size_type k) const SPROUT_NOEXCEPT {
+			size_type const result = sprout::detail::bit_words_select(w_.data(), w_.size(), k);
+			return result < size_ ? result : size_;
+		}
+		bool
+		operator==(dynamic_bitset const& rhs) const SPROUT_NOEXCEPT {
+			return size_ == rhs.size_ && w_ == rhs.w_;
+		}
+		bool
+		operator!=(dynamic_bitset const& rhs) const SPROUT_NOEXCEPT {
+			return !(*this == rhs);
+		}
+	};
+
+	//
+	// operator&
+	// operator|
+	// operator^
+	// operator-
+	//
+	template<typename Block, typename Allocator>
+	inline sprout::dynamic_bitset<Block, Allocator>
+	operator&(sprout::dynamic_bitset<Block, Allocator> const& lhs, sprout::dynamic_bitset<Block, Allocator> const& rhs) {
+		return sprout::dynamic_bitset<Block, Allocator>(lhs) &= rhs;
+	}
+	template<typename Block, typename Allocator>
+	inline sprout::dynamic_bitset<Block, Allocator>
+	operator|(sprout::dynamic_bitset<Block, Allocator> const& lhs, sprout::dynamic_bitset<Block, Allocator> const& rhs) {
+		return sprout::dynamic_bitset<Block, Allocator>(lhs) |= rhs;
+	}
+	template<typename Block, typename Allocator>
+	inline sprout::dynamic_bitset<Block, Allocator>
+	operator^(sprout::dynamic_bitset<Block, Allocator> const& lhs, sprout::dynamic_bitset<Block, Allocator> const& rhs) {
+		return sprout::dynamic_bitset<Block, Allocator>(lhs) ^= rhs;
+	}
+	template<typename Block, typename Allocator>
+	inline sprout::dynamic_bitset<Block, Allocator>
+	operator-(sprout::dynamic_bitset<Block, Allocator> const& lhs, sprout::dynamic_bitset<Block, Allocator> const& rhs) {
+		return sprout::dynamic_bitset<Block, Allocator>(lhs) -= rhs;
+	}
+
+	//
+	// swap
+	//
+	template<typename Block, typename Allocator>
+	inline void
+	swap(sprout::dynamic_bitset<Block, Allocator>& lhs, sprout::dynamic_bitset<Block, Allocator>& rhs) SPROUT_NOEXCEPT {
+		lhs.swap(rhs);
+	}
+
+	//
+	// operator<<
+	//
+	template<typename Char, typename Traits, typename Block, typename Allocator>
+	inline SPROUT_NON_CONSTEXPR std::basic_ostream<Char, Traits>&
+	operator<<(std::basic_ostream<Char, Traits>& lhs, sprout::dynamic_bitset<Block, Allocator> const& rhs) {
+		std::ctype<Char> const& ct = std::use_facet<std::ctype<Char> >(lhs.getloc());
+		return lhs << rhs.template to_string<Char, Traits, std::allocator<Char> >(ct.widen('0'), ct.widen('1'));
+	}
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_BITSET_DYNAMIC_BITSET_HPP
@@ -0,0 +1,705 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_BITSET_ROARING_BITMAP_HPP
+#define SPROUT_BITSET_ROARING_BITMAP_HPP
+
+#include <cstdint>
+#include <vector>
+#include <utility>
+#include <stdexcept>
+#include <sprout/config.hpp>
+#include <sprout/assert.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/bit/clz.hpp>
+#include <sprout/bit/ctz.hpp>
+#include <sprout/utility/move.hpp>
+#include <sprout/bitset/detail/roaring_container.hpp>
+
+namespace sprout {
+	namespace detail {
+		//
+		// roaring serialized format
+		//
+		//	The portable format of the Roaring bitmap libraries, all little-endian:
+		//		cookie   u32 12346, then u32 n                  (no run containers)
+		//		         u16 12347, u16 n - 1, then a bitset of n bits marking the
+		//		         run containers                          (otherwise)
+		//		header   n x (u16 key, u16 cardinality - 1)
+		//		offsets  n x u32 from the start of the data      (unless runs and n < 4)
+		//		body     array:  cardinality x u16
+		//		         bitmap: 1024 x u64
+		//		         run:    u16 runs, then runs x (u16 start, u16 length - 1)
+		//	A container without the run mark is an array up to 4096 values.
+		//
+		enum roaring_serial {
+			roaring_cookie_no_run = 12346,
+			roaring_cookie = 12347,
+			roaring_no_offset_threshold = 4
+		};
+
+		inline std::uint32_t
+		roaring_load16(unsigned char const* p) {
+			return static_cast<std::uint32_t>(p[0]) | static_cast<std::uint32_t>(p[1]) << 8;
+		}
+		inline std::uint32_t
+		roaring_load32(unsigned char const* p) {
+			return roaring_load16(p) | roaring_load16(p + 2) << 16;
+		}
+		inline unsigned char*
+		roaring_store16(unsigned char* p, std::uint32_t x) {
+			p[0] = static_cast<unsigned char>(x);
+			p[1] = static_cast<unsigned char>(x >> 8);
+			return p + 2;
+		}
+		inline unsigned char*
+		roaring_store32(unsigned char* p, std::uint32_t x) {
+			return roaring_store16(roaring_store16(p, x & 0xFFFF), x >> 16);
+		}
+	}	// namespace detail
+
+	//
+	// roaring_view
+	//
+	//	A read-only roaring bitmap over its serialized bytes, e.g. a memory-mapped
+	//	file, queried in place. The constructor checks that the header and every
+	//	container lie within [data, data + size) and throws std::invalid_argument
+	//	otherwise; the bytes must outlive the view.
+	//
+	class roaring_view {
+	public:
+		typedef std::uint32_t value_type;
+		typedef std::size_t size_type;
+	private:
+		typedef sprout::detail::roaring_container container_type;
+	private:
+		unsigned char const* data_;
+		size_type size_;
+		size_type n_;
+		unsigned char const* runs_;
+		unsigned char const* header_;
+		// the start of each container's body
+		std::vector<std::uint32_t> offsets_;
+	private:
+		static void
+		check(bool cond) {
+			if (!cond) {
+				throw std::invalid_argument("roaring_view: malformed data");
+			}
+		}
+	public:
+		roaring_view()
+			: data_(0), size_(0), n_(0), runs_(0), header_(0), offsets_()
+		{}
+		roaring_view(void const* data, size_type size)
+			: data_(static_cast<unsigned char const*>(data)), size_(size), n_(0), runs_(0), header_(0), offsets_()
+		{
+			check(size_ >= 4);
+			std::uint32_t const cookie = sprout::detail::roaring_load32(data_);
+			unsigned char const* p = data_ + 4;
+			if ((cookie & 0xFFFF) == sprout::detail::roaring_cookie) {
+				n_ = (cookie >> 16) + 1;
+				check(size_ - 4 >= (n_ + 7) / 8);
+				runs_ = p;
+				p += (n_ + 7) / 8;
+			} else {
+				check(cookie == sprout::detail::roaring_cookie_no_run && size_ >= 8);
+				n_ = sprout::detail::roaring_load32(p);
+				p += 4;
+			}
+			check(static_cast<size_type>(data_ + size_ - p) / 4 >= n_);
+			header_ = p;
+			p += 4 * n_;
+			offsets_.resize(n_);
+			if (!runs_ || n_ >= sprout::detail::roaring_no_offset_threshold) {
+				check(static_cast<size_type>(data_ + size_ - p) / 4 >= n_);
+				for (size_type i = 0; i != n_; ++i) {
+					offsets_[i] = sprout::detail::roaring_load32(p + 4 * i);
+				}
+			} else {
+				size_type offset = p - data_;
+				for (size_type i = 0; i != n_; ++i) {
+					offsets_[i] = static_cast<std::uint32_t>(offset);
+					check(offset <= size_ && (kind(i) != container_type::run_kind || size_ - offset >= 2));
+					offset += body_size(i);
+				}
+			}
+			for (size_type i = 0; i != n_; ++i) {
+				check(i == 0 || key(i - 1) < key(i));
+				check(offsets_[i] <= size_ && (kind(i) != container_type::run_kind || size_ - offsets_[i] >= 2));
+				check(size_ - offsets_[i] >= body_size(i));
+			}
+		}
+
+		// the number of containers
+		size_type
+		containers() const SPROUT_NOEXCEPT {
+			return n_;
+		}
+		std::uint32_t
+		key(size_type i) const SPROUT_NOEXCEPT {
+			return sprout::detail::roaring_load16(header_ + 4 * i);
+		}
+		size_type
+		cardinality(size_type i) const SPROUT_NOEXCEPT {
+			return sprout::detail::roaring_load16(header_ + 4 * i + 2) + 1;
+		}
+		container_type::kind_type
+		kind(size_type i) const SPROUT_NOEXCEPT {
+			return runs_ && (runs_[i / 8] >> (i % 8) & 1) ? container_type::run_kind
+				: cardinality(i) <= container_type::array_max ? container_type::array_kind
+				: container_type::bitmap_kind
+				;
+		}
+		unsigned char const*
+		body(size_type i) const SPROUT_NOEXCEPT {
+			return data_ + offsets_[i];
+		}
+		size_type
+		body_size(size_type i) const SPROUT_NOEXCEPT {
+			switch (kind(i)) {
+			case container_type::array_kind:
+				return 2 * cardinality(i);
+			case container_type::bitmap_kind:
+				return 8 * container_type::bitmap_words;
+			case container_type::run_kind:
+				return 2 + 4 * sprout::detail::roaring_load16(body(i));
+			}
+			return 0;
+		}
+
+		size_type
+		cardinality() const SPROUT_NOEXCEPT {
+			size_type result = 0;
+			for (size_type i = 0; i != n_; ++i) {
+				result += cardinality(i);
+			}
+			return result;
+		}
+		bool
+		empty() const SPROUT_NOEXCEPT {
+			return n_ == 0;
+		}
+		bool
+		contains(value_type x) const SPROUT_NOEXCEPT {
+			std::uint32_t const high = x >> 16;
+			std::uint32_t const low = x & 0xFFFF;
+			size_type lo = 0;
+			size_type hi = n_;
+			while (lo != hi) {
+				size_type const mid = lo + (hi - lo) / 2;
+				if (key(mid) < high) {
+					lo = mid + 1;
+				} else {
+					hi = mid;
+				}
+			}
+			if (lo == n_ || key(lo) != high) {
+				return false;
+			}
+			unsigned char const* const p = body(lo);
+			switch (kind(lo)) {
+			case container_type::array_kind:
+				{
+					size_type first = 0;
+					size_type last = cardinality(lo);
+					while (first != last) {
+						size_type const mid = first + (last - first) / 2;
+						std::uint32_t const v = sprout::detail::roaring_load16(p + 2 * mid);
+						if (v == low) {
+							return true;
+						}
+						if (v < low) {
+							first = mid + 1;
+						} else {
+							last = mid;
+						}
+					}
+					return false;
+				}
+			case container_type::bitmap_kind:
+				// little-endian words put bit k in byte k / 8
+				return (p[low >> 3] >> (low & 7) & 1) != 0;
+			case container_type::run_kind:
+				{
+					size_type first = 0;
+					size_type last = sprout::detail::roaring_load16(p);
+					while (first != last) {
+						size_type const mid = first + (last - first) / 2;
+						if (sprout::detail::roaring_load16(p + 2 + 4 * mid) <= low) {
+							first = mid + 1;
+						} else {
+							last = mid;
+						}
+					}
+					return first != 0
+						&& low <= sprout::detail::roaring_load16(p + 4 * first - 2) + sprout::detail::roaring_load16(p + 4 * first)
+						;
+				}
+			}
+			return false;
+		}
+		// container i, copied out
+		container_type
+		container(size_type i) const {
+			unsigned char const* const p = body(i);
+			container_type result(static_cast<std::uint16_t>(key(i)), kind(i));
+			result.cardinality = static_cast<std::uint32_t>(cardinality(i));
+			switch (result.kind) {
+			case container_type::array_kind:
+				result.values.resize(result.cardinality);
+				for (size_type k = 0; k != result.values.size(); ++k) {
+					result.values[k] = static_cast<std::uint16_t>(sprout::detail::roaring_load16(p + 2 * k));
+				}
+				break;
+			case container_type::bitmap_kind:
+				result.words.resize(container_type::bitmap_words);
+				for (size_type k = 0; k != result.words.size(); ++k) {
+					result.words[k] = sprout::detail::roaring_load32(p + 8 * k)
+						| static_cast<std::uint64_t>(sprout::detail::roaring_load32(p + 8 * k + 4)) << 32
+						;
+				}
+				break;
+			case container_type::run_kind:
+				result.values.resize(2 * sprout::detail::roaring_load16(p));
+				for (size_type k = 0; k != result.values.size(); ++k) {
+					result.values[k] = static_cast<std::uint16_t>(sprout::detail::roaring_load16(p + 2 + 2 * k));
+				}
+				break;
+			}
+			return result;
+		}
+		template<typename F>
+		void
+		for_each(F f) const {
+			for (size_type i = 0; i != n_; ++i) {
+				std::uint32_t const high = key(i) << 16;
+				unsigned char const* const p = body(i);
+				switch (kind(i)) {
+				case container_type::array_kind:
+					for (size_type k = 0, n = cardinality(i); k != n; ++k) {
+						f(high | sprout::detail::roaring_load16(p + 2 * k));
+					}
+					break;
+				case container_type::bitmap_kind:
+					for (std::uint32_t k = 0; k != 8 * container_type::bitmap_words; ++k) {
+						for (unsigned b = p[k]; b != 0; b &= b - 1) {
+							f(high | (k * 8 + sprout::ctz(b)));
+						}
+					}
+					break;
+				case container_type::run_kind:
+					for (size_type k = 0, n = sprout::detail::roaring_load16(p); k != n; ++k) {
+						std::uint32_t const start = sprout::detail::roaring_load16(p + 2 + 4 * k);
+						std::uint32_t const last = start + sprout::detail::roaring_load16(p + 4 + 4 * k);
+						for (std::uint32_t x = start; x <= last; ++x) {
+							f(high | x);
+						}
+					}
+					break;
+				}
+			}
+		}
+	};
+
+	//
+	// roaring_bitmap
+	//
+	//	A compressed set of 32-bit values: the values are grouped by their high
+	//	16 bits, and each group is stored as a sorted array, a 65536-bit bitmap or
+	//	a list of runs (see sprout/bitset/detail/roaring_container.hpp). Set
+	//	operations merge the groups by key and combine matching containers
+	//	according to their kinds. Runtime only.
+	//
+	class roaring_bitmap {
+	public:
+		typedef std::uint32_t value_type;
+		typedef std::size_t size_type;
+	private:
+		typedef sprout::detail::roaring_container container_type;
+	private:
+		std::vector<container_type> c_;
+	private:
+		// the index of the container with key, or where it would be inserted
+		size_type
+		lower_bound(std::uint32_t key) const SPROUT_NOEXCEPT {
+			size_type lo = 0;
+			size_type hi = c_.size();
+			while (lo != hi) {
+				size_type const mid = lo + (hi - lo) / 2;
+				if (c_[mid].key < key) {
+					lo = mid + 1;
+				} else {
+					hi = mid;
+				}
+			}
+			return lo;
+		}
+		// the containers of keys in both go through op; the others are kept as asked
+		template<typename Op>
+		static roaring_bitmap
+		merge(roaring_bitmap const& lhs, roaring_bitmap const& rhs, Op op, bool keep_lhs, bool keep_rhs) {
+			std::vector<container_type> const& l = lhs.c_;
+			std::vector<container_type> const& r = rhs.c_;
+			roaring_bitmap result;
+			result.c_.reserve((keep_lhs ? l.size() : 0) + (keep_rhs ? r.size() : 0));
+			size_type i = 0;
+			size_type j = 0;
+			while (i != l.size() || j != r.size()) {
+				if (j == r.size() || (i != l.size() && l[i].key < r[j].key)) {
+					if (keep_lhs) {
+						result.c_.push_back(l[i]);
+					}
+					++i;
+				} else if (i == l.size() || r[j].key < l[i].key) {
+					if (keep_rhs) {
+						result.c_.push_back(r[j]);
+					}
+					++j;
+				} else {
+					container_type c = op(l[i], r[j]);
+					if (c.cardinality != 0) {
+						result.c_.push_back(sprout::move(c));
+					}
+					++i;
+					++j;
+				}
+			}
+			return result;
+		}
+		static void
+		serialize_container(unsigned char*& p, container_type const& c) {
+			switch (c.kind) {
+			case container_type::array_kind:
+				for (size_type k = 0; k != c.values.size(); ++k) {
+					p = sprout::detail::roaring_store16(p, c.values[k]);
+				}
+				break;
+			case container_type::bitmap_kind:
+				for (size_type k = 0; k != c.words.size(); ++k) {
+					p = sprout::detail::roaring_store32(p, static_cast<std::uint32_t>(c.words[k]));
+					p = sprout::detail::roaring_store32(p, static_cast<std::uint32_t>(c.words[k] >> 32));
+				}
+				break;
+			case container_type::run_kind:
+				p = sprout::detail::roaring_store16(p, static_cast<std::uint32_t>(c.values.size() / 2));
+				for (size_type k = 0; k != c.values.size(); ++k) {
+					p = sprout::detail::roaring_store16(p, c.values[k]);
+				}
+				break;
+			}
+		}
+		static size_type
+		serialized_body_size(container_type const& c) SPROUT_NOEXCEPT {
+			return c.kind == container_type::array_kind ? 2 * c.values.size()
+				: c.kind == container_type::bitmap_kind ? 8 * c.words.size()
+				: 2 + 2 * c.values.size()
+				;
+		}
+		bool
+		has_runs() const SPROUT_NOEXCEPT {
+			for (size_type i = 0; i != c_.size(); ++i) {
+				if (c_[i].kind == container_type::run_kind) {
+					return true;
+				}
+			}
+			return false;
+		}
+	public:
+		roaring_bitmap()
+			: c_()
+		{}
+		template<typename InputIterator>
+		roaring_bitmap(InputIterator first, InputIterator last)
+			: c_()
+		{
+			for (; first != last; ++first) {
+				add(*first);
+			}
+		}
+		explicit roaring_bitmap(sprout::roaring_view const& view)
+			: c_()
+		{
+			c_.reserve(view.containers());
+			for (size_type i = 0; i != view.containers(); ++i) {
+				c_.push_back(view.container(i));
+			}
+		}
+
+		// modifiers:
+		bool
+		add(value_type x) {
+			std::uint32_t const high = x >> 16;
+			size_type const i = lower_bound(high);
+			if (i == c_.size() || c_[i].key != high) {
+				c_.insert(c_.begin() + i, container_type(static_cast<std::uint16_t>(high)));
+			}
+			return sprout::detail::roaring_add(c_[i], x & 0xFFFF);
+		}
+		// adds [first, last), as runs
+		void
+		add_range(value_type first, std::uint64_t last) {
+			roaring_bitmap range;
+			for (std::uint64_t x = first; x < last; ) {
+				std::uint64_t const end = (x | 0xFFFF) + 1 < last ? (x | 0xFFFF) + 1 : last;
+				std::vector<sprout::detail::roaring_interval> run(1);
+				run[0].first = static_cast<std::uint32_t>(x & 0xFFFF);
+				run[0].last = static_cast<std::uint32_t>((end - 1) & 0xFFFF);
+				range.c_.push_back(sprout::detail::roaring_from_intervals(static_cast<std::uint16_t>(x >> 16), run));
+				x = end;
+			}
+			*this |= range;
+		}
+		bool
+		remove(value_type x) {
+			std::uint32_t const high = x >> 16;
+			size_type const i = lower_bound(high);
+			if (i == c_.size() || c_[i].key != high || !sprout::detail::roaring_remove(c_[i], x & 0xFFFF)) {
+				return false;
+			}
+			if (c_[i].cardinality == 0) {
+				c_.erase(c_.begin() + i);
+			}
+			return true;
+		}
+		void
+		clear() SPROUT_NOEXCEPT {
+			c_.clear();
+		}
+		void
+		swap(roaring_bitmap& other) SPROUT_NOEXCEPT {
+			c_.swap(other.c_);
+		}
+		// stores each container as runs where that is smallest; returns whether any is
+		bool
+		run_optimize() {
+			bool result = false;
+			for (size_type i = 0; i != c_.size(); ++i) {
+				result = sprout::detail::roaring_run_optimize(c_[i]) || result;
+			}
+			return result;
+		}
+
+		// set operations:
+		roaring_bitmap&
+		operator|=(roaring_bitmap const& rhs) {
+			merge(*this, rhs, &sprout::detail::roaring_or, true, true).swap(*this);
+			return *this;
+		}
+		roaring_bitmap&
+		operator&=(roaring_bitmap const& rhs) {
+			merge(*this, rhs, &sprout::detail::roaring_and, false, false).swap(*this);
+			return *this;
+		}
+		// set difference
+		roaring_bitmap&
+		operator-=(roaring_bitmap const& rhs) {
+			merge(*this, rhs, &sprout::detail::roaring_andnot, true, false).swap(*this);
+			return *this;
+		}
+
+		// queries:
+		bool
+		contains(value_type x) const SPROUT_NOEXCEPT {
+			std::uint32_t const high = x >> 16;
+			size_type const i = lower_bound(high);
+			return i != c_.size() && c_[i].key == high && sprout::detail::roaring_contains(c_[i], x & 0xFFFF);
+		}
+		size_type
+		cardinality() const SPROUT_NOEXCEPT {
+			size_type result = 0;
+			for (size_type i = 0; i != c_.size(); ++i) {
+				result += c_[i].cardinality;
+			}
+			return result;
+		}
+		bool
+		empty() const SPROUT_NOEXCEPT {
+			return c_.empty();
+		}
+		// the number of containers
+		size_type
+		containers() const SPROUT_NOEXCEPT {
+			return c_.size();
+		}
+		// the least and the greatest value; the bitmap must not be empty
+		value_type
+		minimum() const SPROUT_NOEXCEPT {
+			SPROUT_ASSERT_MSG(!empty(), "roaring_bitmap::minimum: empty");
+			container_type const& c = c_.front();
+			std::uint32_t low = 0;
+			if (c.kind != container_type::bitmap_kind) {
+				low = c.values.front();
+			} else {
+				size_type k = 0;
+				for (; c.words[k] == 0; ++k)
+					;
+				low = static_cast<std::uint32_t>(k * 64 + sprout::ctz(c.words[k]));
+			}
+			return static_cast<value_type>(c.key) << 16 | low;
+		}
+		value_type
+		maximum() const SPROUT_NOEXCEPT {
+			SPROUT_ASSERT_MSG(!empty(), "roaring_bitmap::maximum: empty");
+			container_type const& c = c_.back();
+			std::uint32_t low = 0;
+			if (c.kind == container_type::array_kind) {
+				low = c.values.back();
+			} else if (c.kind == container_type::run_kind) {
+				low = static_cast<std::uint32_t>(c.values[c.values.size() - 2]) + c.values.back();
+			} else {
+				size_type k = c.words.size() - 1;
+				for (; c.words[k] == 0; --k)
+					;
+				low = static_cast<std::uint32_t>(k * 64 + 63 - sprout::clz(c.words[k]));
+			}
+			return static_cast<value_type>(c.key) << 16 | low;
+		}
+		// calls f(x) for each value x in increasing order
+		template<typename F>
+		void
+		for_each(F f) const {
+			for (size_type i = 0; i != c_.size(); ++i) {
+				struct high_of {
+				public:
+					F& f;
+					std::uint32_t high;
+				public:
+					void operator()(std::uint32_t low) {
+						f(high | low);
+					}
+				} g = {f, static_cast<std::uint32_t>(c_[i].key) << 16};
+				sprout::detail::roaring_for_each(c_[i], g);
+			}
+		}
+		std::vector<value_type>
+		to_vector() const {
+			std::vector<value_type> result;
+			result.reserve(cardinality());
+			for (size_type i = 0; i != c_.size(); ++i) {
+				struct append {
+				public:
+					std::vector<value_type>& r;
+					std::uint32_t high;
+				public:
+					void operator()(std::uint32_t low) {
+						r.push_back(high | low);
+					}
+				} g = {result, static_cast<std::uint32_t>(c_[i].key) << 16};
+				sprout::detail::roaring_for_each(c_[i], g);
+			}
+			return result;
+		}
+		bool
+		operator==(roaring_bitmap const& rhs) const {
+			if (c_.size() != rhs.c_.size()) {
+				return false;
+			}
+			for (size_type i = 0; i != c_.size(); ++i) {
+				if (!sprout::detail::roaring_equal(c_[i], rhs.c_[i])) {
+					return false;
+				}
+			}
+			return true;
+		}
+		bool
+		operator!=(roaring_bitmap const& rhs) const {
+			return !(*this == rhs);
+		}
+
+		// serialization:
+		size_type
+		serialized_size() const SPROUT_NOEXCEPT {
+			bool const runs = has_runs();
+			size_type result = runs ? 4 + (c_.size() + 7) / 8 : 8;
+			result += 4 * c_.size();
+			if (!runs || c_.size() >= sprout::detail::roaring_no_offset_threshold) {
+				result += 4 * c_.size();
+			}
+			for (size_type i = 0; i != c_.size(); ++i) {
+				result += serialized_body_size(c_[i]);
+			}
+			return result;
+		}
+		// writes serialized_size() bytes to out and returns the end
+		unsigned char*
+		serialize(unsigned char* out) const {
+			bool const runs = has_runs();
+			size_type const n = c_.size();
+			unsigned char* p = out;
+			if (runs) {
+				p = sprout::detail::roaring_store32(p, sprout::detail::roaring_cookie | static_cast<std::uint32_t>(n - 1) << 16);
+				for (size_type i = 0; i != (n + 7) / 8; ++i) {
+					unsigned char flags = 0;
+					for (size_type k = i * 8; k != n && k != i * 8 + 8; ++k) {
+						flags |= static_cast<unsigned char>((c_[k].kind == container_type::run_kind) << (k % 8));
+					}
+					*p++ = flags;
+				}
+			} else {
+				p = sprout::detail::roaring_store32(p, sprout::detail::roaring_cookie_no_run);
+				p = sprout::detail::roaring_store32(p, static_cast<std::uint32_t>(n));
+			}
+			for (size_type i = 0; i != n; ++i) {
+				p = sprout::detail::roaring_store16(p, c_[i].key);
+				p = sprout::detail::roaring_store16(p, c_[i].cardinality - 1);
+			}
+			if (!runs || n >= sprout::detail::roaring_no_offset_threshold) {
+				size_type offset = (p - out) + 4 * n;
+				for (size_type i = 0; i != n; ++i) {
+					p = sprout::detail::roaring_store32(p, static_cast<std::uint32_t>(offset));
+					offset += serialized_body_size(c_[i]);
+				}
+			}
+			for (size_type i = 0; i != n; ++i) {
+				serialize_container(p, c_[i]);
+			}
+			return p;
+		}
+		std::vector<unsigned char>
+		serialize() const {
+			std::vector<unsigned char> result(serialized_size());
+			serialize(result.data());
+			return result;
+		}
+
+		friend sprout::roaring_bitmap
+		operator|(sprout::roaring_bitmap const& lhs, sprout::roaring_bitmap const& rhs);
+		friend sprout::roaring_bitmap
+		operator&(sprout::roaring_bitmap const& lhs, sprout::roaring_bitmap const& rhs);
+		friend sprout::roaring_bitmap
+		operator-(sprout::roaring_bitmap const& lhs, sprout::roaring_bitmap const& rhs);
+	};
+
+	//
+	// operator|
+	// operator&
+	// operator-
+	//
+	inline sprout::roaring_bitmap
+	operator|(sprout::roaring_bitmap const& lhs, sprout::roaring_bitmap const& rhs) {
+		return sprout::roaring_bitmap::merge(lhs, rhs, &sprout::detail::roaring_or, true, true);
+	}
+	inline sprout::roaring_bitmap
+	operator&(sprout::roaring_bitmap const& lhs, sprout::roaring_bitmap const& rhs) {
+		return sprout::roaring_bitmap::merge(lhs, rhs, &sprout::detail::roaring_and, false, false);
+	}
+	inline sprout::roaring_bitmap
+	operator-(sprout::roaring_bitmap const& lhs, sprout::roaring_bitmap const& rhs) {
+		return sprout::roaring_bitmap::merge(lhs, rhs, &sprout::detail::roaring_andnot, true, false);
+	}
+
+	//
+	// swap
+	//
+	inline void
+	swap(sprout::roaring_bitmap& lhs, sprout::roaring_bitmap& rhs) SPROUT_NOEXCEPT {
+		lhs.swap(rhs);
+	}
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_BITSET_ROARING_BITMAP_HPP
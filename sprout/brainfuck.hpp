@@ -10,7 +10,9 @@
 
 #include <sprout/config.hpp>
 #include <sprout/brainfuck/brainfuck.hpp>
+#include <sprout/brainfuck/bytecode.hpp>
 #include <sprout/brainfuck/ook.hpp>
 #include <sprout/brainfuck/misa.hpp>
+#include <sprout/brainfuck/x86_64.hpp>
 
 #endif	// #ifndef SPROUT_BRAINFUCK_HPP
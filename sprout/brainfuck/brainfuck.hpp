@@ -98,7 +98,7 @@ namespace sprout {
 							sprout::next(first), last, output, in_first, in_last,
 							sprout::fixed::set(buffer, pos, value_type(buffer.at(pos) + 1)), out_buffer, pos, out_pos
 							)
-					: *first == SPROUT_CHAR_LITERAL('+', value_type)
+					: *first == SPROUT_CHAR_LITERAL('-', value_type)
 						? sprout::brainfuck::detail::exec_impl(
 							sprout::next(first), last, output, in_first, in_last,
 							sprout::fixed::set(buffer, pos, value_type(buffer.at(pos) - 1)), out_buffer, pos, out_pos
@@ -0,0 +1,470 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_BRAINFUCK_BYTECODE_HPP
+#define SPROUT_BRAINFUCK_BYTECODE_HPP
+
+#include <iterator>
+#include <stdexcept>
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/array/array.hpp>
+#include <sprout/pit/pit.hpp>
+#include <sprout/iterator/operation.hpp>
+#include <sprout/iterator/value_iterator.hpp>
+#include <sprout/container/traits.hpp>
+#include <sprout/container/functions.hpp>
+#include <sprout/algorithm/fixed/results.hpp>
+#include <sprout/algorithm/fixed/copy.hpp>
+#include <sprout/detail/char_literal.hpp>
+
+namespace sprout {
+	namespace brainfuck {
+		//
+		// opcode
+		//
+		struct opcode {
+		public:
+			enum type {
+				add,			// *p += arg
+				move,			// p += arg
+				clear,			// *p = 0
+				output,			// put *p
+				input,			// get *p
+				jump_zero,		// if (*p == 0) continue after the jump_nonzero at arg
+				jump_nonzero,	// if (*p != 0) continue after the jump_zero at arg
+				mul_add,		// if (*p != 0) p[offset] += *p * arg
+				scan			// while (*p != 0) p += arg
+			};
+		};
+
+		//
+		// instruction
+		//
+		struct instruction {
+		public:
+			sprout::brainfuck::opcode::type op;
+			int arg;
+			int offset;
+		public:
+			SPROUT_CONSTEXPR instruction()
+				: op(), arg(), offset()
+			{}
+			SPROUT_CONSTEXPR instruction(sprout::brainfuck::opcode::type op, int arg, int offset = 0)
+				: op(op), arg(arg), offset(offset)
+			{}
+		};
+		inline SPROUT_CONSTEXPR bool
+		operator==(sprout::brainfuck::instruction const& lhs, sprout::brainfuck::instruction const& rhs) {
+			return lhs.op == rhs.op && lhs.arg == rhs.arg && lhs.offset == rhs.offset;
+		}
+		inline SPROUT_CONSTEXPR bool
+		operator!=(sprout::brainfuck::instruction const& lhs, sprout::brainfuck::instruction const& rhs) {
+			return !(lhs == rhs);
+		}
+
+		//
+		// bytecode
+		//
+		//	A compiled program of at most N instructions.
+		//
+		template<std::size_t N>
+		class bytecode {
+		private:
+			typedef sprout::array<sprout::brainfuck::instruction, N> array_type;
+		public:
+			typedef sprout::brainfuck::instruction value_type;
+			typedef typename array_type::const_iterator iterator;
+			typedef typename array_type::const_iterator const_iterator;
+			typedef typename array_type::const_reference reference;
+			typedef typename array_type::const_reference const_reference;
+			typedef typename array_type::size_type size_type;
+		public:
+			SPROUT_STATIC_CONSTEXPR size_type static_size = N;
+		private:
+			array_type code_;
+			size_type size_;
+		public:
+			SPROUT_CONSTEXPR bytecode()
+				: code_{{}}, size_()
+			{}
+			SPROUT_CONSTEXPR size_type size() const SPROUT_NOEXCEPT {
+				return size_;
+			}
+			static SPROUT_CONSTEXPR size_type max_size() SPROUT_NOEXCEPT {
+				return static_size;
+			}
+			SPROUT_CONSTEXPR bool empty() const SPROUT_NOEXCEPT {
+				return size_ == 0;
+			}
+			SPROUT_CONSTEXPR const_iterator begin() const SPROUT_NOEXCEPT {
+				return code_.begin();
+			}
+			SPROUT_CONSTEXPR const_iterator end() const SPROUT_NOEXCEPT {
+				return code_.begin() + size_;
+			}
+			SPROUT_CONSTEXPR const_reference operator[](size_type i) const {
+				return code_[i];
+			}
+			SPROUT_CXX14_CONSTEXPR value_type& operator[](size_type i) {
+				return code_[i];
+			}
+			SPROUT_CONSTEXPR const_reference back() const {
+				return code_[size_ - 1];
+			}
+			SPROUT_CXX14_CONSTEXPR value_type& back() {
+				return code_[size_ - 1];
+			}
+			SPROUT_CXX14_CONSTEXPR void push_back(value_type const& x) {
+				if (size_ == N) {
+					throw std::length_error("bytecode out of range");
+				}
+				code_[size_++] = x;
+			}
+			SPROUT_CXX14_CONSTEXPR void pop_back() {
+				--size_;
+			}
+			SPROUT_CXX14_CONSTEXPR void resize(size_type n) {
+				size_ = n;
+			}
+		};
+		template<std::size_t N>
+		SPROUT_CONSTEXPR_OR_CONST typename sprout::brainfuck::bytecode<N>::size_type sprout::brainfuck::bytecode<N>::static_size;
+
+		namespace detail {
+			template<std::size_t N>
+			inline SPROUT_CXX14_CONSTEXPR void
+			fold_instruction(sprout::brainfuck::bytecode<N>& code, sprout::brainfuck::opcode::type op, int arg) {
+				if (!code.empty() && code.back().op == op) {
+					code.back().arg += arg;
+					if (code.back().arg == 0) {
+						code.pop_back();
+					}
+				} else {
+					code.push_back(sprout::brainfuck::instruction(op, arg));
+				}
+			}
+		}	// namespace detail
+
+		//
+		// compile
+		//
+		//	Runs of + - and of > < become one add or move, [-] and [+] become clear,
+		//	and each bracket holds the index of its match. While compiling, an open
+		//	jump_zero holds the index of the enclosing one, so the bracket stack
+		//	takes no extra space.
+		//
+		template<std::size_t N, typename InputIterator>
+		inline SPROUT_CXX14_CONSTEXPR sprout::brainfuck::bytecode<N>
+		compile(InputIterator first, InputIterator last) {
+			typedef typename std::iterator_traits<InputIterator>::value_type value_type;
+			typedef sprout::brainfuck::opcode opcode;
+			sprout::brainfuck::bytecode<N> code;
+			int open = -1;
+			for (; first != last; ++first) {
+				value_type const c = *first;
+				if (c == SPROUT_CHAR_LITERAL('+', value_type)) {
+					sprout::brainfuck::detail::fold_instruction(code, opcode::add, 1);
+				} else if (c == SPROUT_CHAR_LITERAL('-', value_type)) {
+					sprout::brainfuck::detail::fold_instruction(code, opcode::add, -1);
+				} else if (c == SPROUT_CHAR_LITERAL('>', value_type)) {
+					sprout::brainfuck::detail::fold_instruction(code, opcode::move, 1);
+				} else if (c == SPROUT_CHAR_LITERAL('<', value_type)) {
+					sprout::brainfuck::detail::fold_instruction(code, opcode::move, -1);
+				} else if (c == SPROUT_CHAR_LITERAL('.', value_type)) {
+					code.push_back(sprout::brainfuck::instruction(opcode::output, 0));
+				} else if (c == SPROUT_CHAR_LITERAL(',', value_type)) {
+					code.push_back(sprout::brainfuck::instruction(opcode::input, 0));
+				} else if (c == SPROUT_CHAR_LITERAL('[', value_type)) {
+					code.push_back(sprout::brainfuck::instruction(opcode::jump_zero, open));
+					open = static_cast<int>(code.size() - 1);
+				} else if (c == SPROUT_CHAR_LITERAL(']', value_type)) {
+					if (open < 0) {
+						throw std::invalid_argument("unmatched ']'");
+					}
+					int const start = open;
+					open = code[start].arg;
+					if (code.size() == static_cast<std::size_t>(start) + 2
+						&& code.back().op == opcode::add && (code.back().arg == 1 || code.back().arg == -1)
+						)
+					{
+						code.resize(start);
+						code.push_back(sprout::brainfuck::instruction(opcode::clear, 0));
+					} else {
+						code.push_back(sprout::brainfuck::instruction(opcode::jump_nonzero, start));
+						code[start].arg = static_cast<int>(code.size() - 1);
+					}
+				}
+			}
+			if (open >= 0) {
+				throw std::invalid_argument("unmatched '['");
+			}
+			return code;
+		}
+
+		//
+		// compile_range
+		//
+		template<std::size_t N, typename InputRange>
+		inline SPROUT_CXX14_CONSTEXPR sprout::brainfuck::bytecode<N>
+		compile_range(InputRange const& source) {
+			return sprout::brainfuck::compile<N>(sprout::begin(source), sprout::end(source));
+		}
+
+		namespace detail {
+			//
+			// mul_loop_step
+			//
+			//	The step of the loop counter if [first, last) is a multiply loop body, 0 otherwise.
+			//
+			template<std::size_t N>
+			inline SPROUT_CXX14_CONSTEXPR int
+			mul_loop_step(sprout::brainfuck::bytecode<N> const& code, std::size_t first, std::size_t last) {
+				typedef sprout::brainfuck::opcode opcode;
+				int offset = 0;
+				int step = 0;
+				for (; first != last; ++first) {
+					if (code[first].op == opcode::move) {
+						offset += code[first].arg;
+					} else if (code[first].op != opcode::add) {
+						return 0;
+					} else if (offset == 0) {
+						step += code[first].arg;
+					}
+				}
+				return offset == 0 && (step == 1 || step == -1) ? step : 0;
+			}
+		}	// namespace detail
+
+		//
+		// optimize
+		//
+		//	Rewrites loops whose body only adds and moves and returns to the same
+		//	cell, stepping it by one, into mul_add per touched cell and a clear;
+		//	[>] and [<] style loops become scan. mul_add does nothing on a zero
+		//	cell, so the touched cells are only reached when the loop would run.
+		//
+		template<std::size_t N>
+		inline SPROUT_CXX14_CONSTEXPR sprout::brainfuck::bytecode<N>
+		optimize(sprout::brainfuck::bytecode<N> const& code) {
+			typedef sprout::brainfuck::opcode opcode;
+			sprout::brainfuck::bytecode<N> result;
+			int open = -1;
+			for (std::size_t pc = 0, size = code.size(); pc != size; ++pc) {
+				sprout::brainfuck::instruction const& x = code[pc];
+				if (x.op == opcode::jump_zero) {
+					std::size_t const last = static_cast<std::size_t>(x.arg);
+					if (last == pc + 2 && code[pc + 1].op == opcode::move) {
+						result.push_back(sprout::brainfuck::instruction(opcode::scan, code[pc + 1].arg));
+						pc = last;
+					} else if (int const step = sprout::brainfuck::detail::mul_loop_step(code, pc + 1, last)) {
+						// the body runs *p / -step times
+						int const sign = -step;
+						int offset = 0;
+						for (std::size_t i = pc + 1; i != last; ++i) {
+							if (code[i].op == opcode::move) {
+								offset += code[i].arg;
+							} else if (offset != 0) {
+								result.push_back(sprout::brainfuck::instruction(opcode::mul_add, code[i].arg * sign, offset));
+							}
+						}
+						result.push_back(sprout::brainfuck::instruction(opcode::clear, 0));
+						pc = last;
+					} else {
+						result.push_back(sprout::brainfuck::instruction(opcode::jump_zero, open));
+						open = static_cast<int>(result.size() - 1);
+					}
+				} else if (x.op == opcode::jump_nonzero) {
+					int const start = open;
+					open = result[start].arg;
+					result.push_back(sprout::brainfuck::instruction(opcode::jump_nonzero, start));
+					result[start].arg = static_cast<int>(result.size() - 1);
+				} else {
+					result.push_back(x);
+				}
+			}
+			return result;
+		}
+
+		namespace detail {
+			//
+			// bounded_output
+			//
+			template<typename Array>
+			class bounded_output {
+			public:
+				Array& buffer;
+				std::size_t pos;
+			public:
+				explicit SPROUT_CXX14_CONSTEXPR bounded_output(Array& buffer)
+					: buffer(buffer), pos()
+				{}
+				template<typename T>
+				SPROUT_CXX14_CONSTEXPR void operator()(T const& c) {
+					if (pos == buffer.size()) {
+						throw std::out_of_range("output out of range");
+					}
+					buffer[pos++] = c;
+				}
+			};
+			//
+			// iterator_output
+			//
+			template<typename OutputIterator>
+			class iterator_output {
+			public:
+				OutputIterator out;
+			public:
+				explicit SPROUT_CXX14_CONSTEXPR iterator_output(OutputIterator out)
+					: out(out)
+				{}
+				template<typename T>
+				SPROUT_CXX14_CONSTEXPR void operator()(T const& c) {
+					*out = c;
+					++out;
+				}
+			};
+
+			template<std::size_t BufferSize, typename Value, std::size_t N, typename Put, typename InputIterator>
+			inline SPROUT_CXX14_CONSTEXPR void
+			exec_bytecode(
+				sprout::brainfuck::bytecode<N> const& code,
+				Put& put, InputIterator in_first, InputIterator in_last
+				)
+			{
+				typedef Value value_type;
+				typedef sprout::brainfuck::opcode opcode;
+				sprout::array<value_type, BufferSize> buffer{{}};
+				std::size_t pos = 0;
+				for (std::size_t pc = 0, size = code.size(); pc != size; ++pc) {
+					sprout::brainfuck::instruction const& x = code[pc];
+					switch (x.op) {
+					case opcode::add:
+						buffer[pos] = value_type(buffer[pos] + x.arg);
+						break;
+					case opcode::move:
+						pos += x.arg;
+						if (pos >= BufferSize) {
+							throw std::out_of_range("pointer out of range");
+						}
+						break;
+					case opcode::clear:
+						buffer[pos] = value_type();
+						break;
+					case opcode::output:
+						put(buffer[pos]);
+						break;
+					case opcode::input:
+						if (in_first == in_last) {
+							throw std::out_of_range("input out of range");
+						}
+						buffer[pos] = value_type(*in_first);
+						++in_first;
+						break;
+					case opcode::jump_zero:
+						if (buffer[pos] == value_type()) {
+							pc = x.arg;
+						}
+						break;
+					case opcode::jump_nonzero:
+						if (buffer[pos] != value_type()) {
+							pc = x.arg;
+						}
+						break;
+					case opcode::mul_add:
+						if (buffer[pos] == value_type()) {
+							break;
+						}
+						if (pos + x.offset >= BufferSize) {
+							throw std::out_of_range("pointer out of range");
+						}
+						buffer[pos + x.offset] = value_type(buffer[pos + x.offset] + buffer[pos] * x.arg);
+						break;
+					case opcode::scan:
+						while (buffer[pos] != value_type()) {
+							pos += x.arg;
+							if (pos >= BufferSize) {
+								throw std::out_of_range("pointer out of range");
+							}
+						}
+						break;
+					}
+				}
+			}
+		}	// namespace detail
+
+		//
+		// exec
+		//
+		//	Runs compiled bytecode; cells have the value type of Output. Moving the
+		//	pointer out of the BufferSize cells throws std::out_of_range.
+		//
+		template<std::size_t BufferSize = 32, std::size_t N, typename Output, typename InputIteratorInput>
+		inline SPROUT_CXX14_CONSTEXPR typename sprout::fixed::results::algorithm<Output>::type
+		exec(
+			sprout::brainfuck::bytecode<N> const& code,
+			Output const& output, InputIteratorInput in_first, InputIteratorInput in_last
+			)
+		{
+			typedef sprout::container_traits<Output> out_traits;
+			typedef typename out_traits::value_type value_type;
+			typedef sprout::array<value_type, out_traits::static_size> out_buffer_type;
+			out_buffer_type out_buffer{{}};
+			sprout::brainfuck::detail::bounded_output<out_buffer_type> put(out_buffer);
+			sprout::brainfuck::detail::exec_bytecode<BufferSize, value_type>(code, put, in_first, in_last);
+			return sprout::fixed::copy(
+				sprout::begin(out_buffer),
+				sprout::next(sprout::begin(out_buffer), put.pos),
+				output
+				);
+		}
+		template<std::size_t BufferSize = 32, std::size_t N, typename Output>
+		inline SPROUT_CXX14_CONSTEXPR typename sprout::fixed::results::algorithm<Output>::type
+		exec(sprout::brainfuck::bytecode<N> const& code, Output const& output) {
+			typedef typename sprout::container_traits<Output>::value_type value_type;
+			return sprout::brainfuck::exec<BufferSize>(
+				code, output, sprout::value_iterator<value_type>(value_type()), sprout::value_iterator<value_type>()
+				);
+		}
+		template<std::size_t BufferSize = 32, std::size_t N>
+		inline SPROUT_CXX14_CONSTEXPR typename sprout::fixed::results::algorithm<
+			sprout::array<char, BufferSize>
+		>::type
+		exec(sprout::brainfuck::bytecode<N> const& code) {
+			return sprout::brainfuck::exec<BufferSize>(
+				code, sprout::pit<sprout::array<char, BufferSize> >()
+				);
+		}
+
+		//
+		// exec_copy
+		//
+		//	Runs compiled bytecode at runtime size, writing each output cell through
+		//	out instead of building a fixed container; cells have type Value.
+		//
+		template<std::size_t BufferSize = 32, typename Value = char, std::size_t N, typename OutputIterator, typename InputIterator>
+		inline SPROUT_CXX14_CONSTEXPR OutputIterator
+		exec_copy(
+			sprout::brainfuck::bytecode<N> const& code,
+			OutputIterator out, InputIterator in_first, InputIterator in_last
+			)
+		{
+			sprout::brainfuck::detail::iterator_output<OutputIterator> put(out);
+			sprout::brainfuck::detail::exec_bytecode<BufferSize, Value>(code, put, in_first, in_last);
+			return put.out;
+		}
+		template<std::size_t BufferSize = 32, typename Value = char, std::size_t N, typename OutputIterator>
+		inline SPROUT_CXX14_CONSTEXPR OutputIterator
+		exec_copy(sprout::brainfuck::bytecode<N> const& code, OutputIterator out) {
+			return sprout::brainfuck::exec_copy<BufferSize, Value>(
+				code, out, sprout::value_iterator<Value>(Value()), sprout::value_iterator<Value>()
+				);
+		}
+	}	// namespace brainfuck
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_BRAINFUCK_BYTECODE_HPP
@@ -22,6 +22,7 @@
 #include <sprout/weed/parser/string/string.hpp>
 #include <sprout/weed/parser/directive/replace.hpp>
 #include <sprout/weed/operator.hpp>
+#include <sprout/brainfuck/bytecode.hpp>
 #include <sprout/brainfuck/detail/convert.hpp>
 
 namespace sprout {
@@ -61,6 +62,18 @@ namespace sprout {
 					);
 			}
 
+			//
+			// compile_range
+			//
+			template<std::size_t N, typename BidirectionalRangeSource>
+			inline SPROUT_CXX14_CONSTEXPR sprout::brainfuck::bytecode<N>
+			compile_range(BidirectionalRangeSource const& source) {
+				typedef typename sprout::container_construct_traits<BidirectionalRangeSource>::copied_type copied_type;
+				return sprout::brainfuck::compile_range<N>(
+					sprout::brainfuck::misa::to_brainfuck(sprout::begin(source), sprout::end(source), sprout::pit<copied_type>()).first
+					);
+			}
+
 			//
 			// exec_range
 			//
@@ -22,6 +22,7 @@
 #include <sprout/weed/parser/string/string.hpp>
 #include <sprout/weed/parser/directive/replace.hpp>
 #include <sprout/weed/operator.hpp>
+#include <sprout/brainfuck/bytecode.hpp>
 #include <sprout/brainfuck/detail/convert.hpp>
 
 namespace sprout {
@@ -39,19 +40,19 @@ namespace sprout {
 						*sprout::weed::lim<sprout::container_traits<Result>::static_size>(
 							sprout::weed::replace('>')
 								["Ook." >> *sprout::weed::space_ >> "Ook?"]
-							| sprout::weed::replace('>')
+							| sprout::weed::replace('<')
 								["Ook?" >> *sprout::weed::space_ >> "Ook."]
-							| sprout::weed::replace('>')
+							| sprout::weed::replace('+')
 								["Ook." >> *sprout::weed::space_ >> "Ook."]
-							| sprout::weed::replace('>')
+							| sprout::weed::replace('-')
 								["Ook!" >> *sprout::weed::space_ >> "Ook!"]
-							| sprout::weed::replace('>')
+							| sprout::weed::replace('.')
 								["Ook!" >> *sprout::weed::space_ >> "Ook."]
-							| sprout::weed::replace('>')
+							| sprout::weed::replace(',')
 								["Ook." >> *sprout::weed::space_ >> "Ook!"]
-							| sprout::weed::replace('>')
+							| sprout::weed::replace('[')
 								["Ook!" >> *sprout::weed::space_ >> "Ook?"]
-							| sprout::weed::replace('>')
+							| sprout::weed::replace(']')
 								["Ook?" >> *sprout::weed::space_ >> "Ook!"]
 							| sprout::weed::replace(' ')
 								[sprout::weed::char_]
@@ -61,6 +62,18 @@ namespace sprout {
 					);
 			}
 
+			//
+			// compile_range
+			//
+			template<std::size_t N, typename BidirectionalRangeSource>
+			inline SPROUT_CXX14_CONSTEXPR sprout::brainfuck::bytecode<N>
+			compile_range(BidirectionalRangeSource const& source) {
+				typedef typename sprout::container_construct_traits<BidirectionalRangeSource>::copied_type copied_type;
+				return sprout::brainfuck::compile_range<N>(
+					sprout::brainfuck::ook::to_brainfuck(sprout::begin(source), sprout::end(source), sprout::pit<copied_type>()).first
+					);
+			}
+
 			//
 			// exec_range
 			//
@@ -0,0 +1,284 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_BRAINFUCK_X86_64_HPP
+#define SPROUT_BRAINFUCK_X86_64_HPP
+
+#include <cstdint>
+#include <stdexcept>
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/array/array.hpp>
+#include <sprout/sub_array/sub_array.hpp>
+#include <sprout/sub_array/sub.hpp>
+#include <sprout/brainfuck/bytecode.hpp>
+
+namespace sprout {
+	namespace brainfuck {
+		namespace x86_64 {
+			//
+			// elf_base_address
+			// elf_tape_address
+			//
+			SPROUT_STATIC_CONSTEXPR std::uint64_t elf_base_address = 0x00400000;
+			SPROUT_STATIC_CONSTEXPR std::uint64_t elf_tape_address = 0x00600000;
+
+			namespace detail {
+				//
+				// writer
+				//
+				template<std::size_t M>
+				class writer {
+				public:
+					sprout::array<unsigned char, M> bin;
+					std::size_t size;
+				public:
+					SPROUT_CXX14_CONSTEXPR writer()
+						: bin{{}}, size()
+					{}
+					SPROUT_CXX14_CONSTEXPR void put(unsigned char c) {
+						if (size == M) {
+							throw std::length_error("binary out of range");
+						}
+						bin[size++] = c;
+					}
+					template<typename UIntType>
+					SPROUT_CXX14_CONSTEXPR void put_le(UIntType val) {
+						for (std::size_t i = 0; i != sizeof(UIntType); ++i) {
+							put(static_cast<unsigned char>(val >> (8 * i)));
+						}
+					}
+					template<std::size_t K>
+					SPROUT_CXX14_CONSTEXPR void put(unsigned char const(& bytes)[K]) {
+						for (std::size_t i = 0; i != K; ++i) {
+							put(bytes[i]);
+						}
+					}
+					template<typename UIntType>
+					SPROUT_CXX14_CONSTEXPR UIntType get_le(std::size_t at) const {
+						UIntType val = 0;
+						for (std::size_t i = 0; i != sizeof(UIntType); ++i) {
+							val |= static_cast<UIntType>(bin[at + i]) << (8 * i);
+						}
+						return val;
+					}
+					template<typename UIntType>
+					SPROUT_CXX14_CONSTEXPR void patch_le(std::size_t at, UIntType val) {
+						for (std::size_t i = 0; i != sizeof(UIntType); ++i) {
+							bin[at + i] = static_cast<unsigned char>(val >> (8 * i));
+						}
+					}
+					SPROUT_CXX14_CONSTEXPR sprout::sub_array<sprout::array<unsigned char, M> > result() const {
+						return sprout::sub_copy(bin, 0, size);
+					}
+				};
+
+				template<std::size_t M, std::size_t N>
+				inline SPROUT_CXX14_CONSTEXPR void
+				assemble(sprout::brainfuck::x86_64::detail::writer<M>& out, sprout::brainfuck::bytecode<N> const& code) {
+					typedef sprout::brainfuck::opcode opcode;
+					SPROUT_CONSTEXPR unsigned char prologue[] = {
+						0x53,								// push rbx
+						0x41, 0x54,							// push r12
+						0x55,								// push rbp (keeps calls 16-byte aligned)
+						0x48, 0x89, 0xfb,					// mov rbx, rdi
+						0x49, 0x89, 0xf4					// mov r12, rsi
+					};
+					SPROUT_CONSTEXPR unsigned char epilogue[] = {
+						0x5d,								// pop rbp
+						0x41, 0x5c,							// pop r12
+						0x5b,								// pop rbx
+						0xc3								// ret
+					};
+					out.put(prologue);
+					std::size_t open = 0;	// end of the innermost open jump_zero; its rel32 holds the enclosing one
+					for (std::size_t pc = 0, size = code.size(); pc != size; ++pc) {
+						sprout::brainfuck::instruction const& x = code[pc];
+						switch (x.op) {
+						case opcode::add:
+							out.put(0x80); out.put(0x03);							// add byte [rbx], arg
+							out.put(static_cast<unsigned char>(x.arg));
+							break;
+						case opcode::move:
+							out.put(0x48); out.put(0x81); out.put(0xc3);			// add rbx, arg
+							out.put_le(static_cast<std::uint32_t>(x.arg));
+							break;
+						case opcode::clear:
+							out.put(0xc6); out.put(0x03); out.put(0x00);			// mov byte [rbx], 0
+							break;
+						case opcode::output:
+							out.put(0x0f); out.put(0xb6); out.put(0x3b);			// movzx edi, byte [rbx]
+							out.put(0x41); out.put(0xff); out.put(0x14); out.put(0x24);	// call [r12]
+							break;
+						case opcode::input:
+							out.put(0x41); out.put(0xff); out.put(0x54); out.put(0x24); out.put(0x08);	// call [r12+8]
+							out.put(0x88); out.put(0x03);							// mov [rbx], al
+							break;
+						case opcode::jump_zero:
+							out.put(0x80); out.put(0x3b); out.put(0x00);			// cmp byte [rbx], 0
+							out.put(0x0f); out.put(0x84);							// je (after the match)
+							out.put_le(static_cast<std::uint32_t>(open));			// (set address later)
+							open = out.size;
+							break;
+						case opcode::jump_nonzero:
+						{
+							std::size_t const start = open;
+							open = out.template get_le<std::uint32_t>(start - 4);
+							out.put(0x80); out.put(0x3b); out.put(0x00);			// cmp byte [rbx], 0
+							out.put(0x0f); out.put(0x85);							// jne (after the match)
+							out.put_le(static_cast<std::uint32_t>(start - (out.size + 4)));
+							out.patch_le(start - 4, static_cast<std::uint32_t>(out.size - start));
+							break;
+						}
+						case opcode::mul_add:
+							out.put(0x80); out.put(0x3b); out.put(0x00);			// cmp byte [rbx], 0
+							out.put(0x74); out.put(x.arg != 1 && x.arg != -1 ? 0x0f : 0x09);	// je (past the add)
+							out.put(0x0f); out.put(0xb6); out.put(0x03);			// movzx eax, byte [rbx]
+							if (x.arg != 1 && x.arg != -1) {
+								out.put(0x69); out.put(0xc0);						// imul eax, eax, arg
+								out.put_le(static_cast<std::uint32_t>(x.arg));
+							}
+							out.put(x.arg == -1 ? 0x28 : 0x00); out.put(0x83);		// add/sub [rbx+offset], al
+							out.put_le(static_cast<std::uint32_t>(x.offset));
+							break;
+						case opcode::scan:
+							out.put(0x80); out.put(0x3b); out.put(0x00);			// cmp byte [rbx], 0
+							out.put(0x74); out.put(0x09);							// je +9
+							out.put(0x48); out.put(0x81); out.put(0xc3);			// add rbx, arg
+							out.put_le(static_cast<std::uint32_t>(x.arg));
+							out.put(0xeb); out.put(0xf2);							// jmp -14
+							break;
+						}
+					}
+					out.put(epilogue);
+				}
+			}	// namespace detail
+
+			//
+			// assemble
+			//
+			//	Machine code for a System V function void(unsigned char* tape, void* const* io);
+			//	io[0] is called as int(int) for each output and io[1] as int() for each input.
+			//	Cells are bytes and the pointer is not bounds checked.
+			//
+			template<std::size_t M, std::size_t N>
+			inline SPROUT_CXX14_CONSTEXPR sprout::sub_array<sprout::array<unsigned char, M> >
+			assemble(sprout::brainfuck::bytecode<N> const& code) {
+				sprout::brainfuck::x86_64::detail::writer<M> out;
+				sprout::brainfuck::x86_64::detail::assemble(out, code);
+				return out.result();
+			}
+
+			//
+			// make_elf
+			//
+			//	A static Linux x86-64 executable that runs the program on a zeroed tape of
+			//	TapeSize cells, reading stdin and writing stdout with raw syscalls.
+			//
+			template<std::size_t M, std::size_t TapeSize = 65536, std::size_t N>
+			inline SPROUT_CXX14_CONSTEXPR sprout::sub_array<sprout::array<unsigned char, M> >
+			make_elf(sprout::brainfuck::bytecode<N> const& code) {
+				typedef std::uint16_t half;
+				typedef std::uint32_t word;
+				typedef std::uint64_t xword;
+				SPROUT_CONSTEXPR std::size_t headers_size = 64 + 56 * 2;
+				SPROUT_CONSTEXPR std::size_t put_offset = headers_size + 24;
+				SPROUT_CONSTEXPR std::size_t get_offset = put_offset + 23;
+				SPROUT_CONSTEXPR std::size_t table_offset = (get_offset + 18 + 7) / 8 * 8;
+				SPROUT_CONSTEXPR std::size_t code_offset = table_offset + 16;
+				SPROUT_CONSTEXPR unsigned char ident[] = {
+					0x7f, 'E', 'L', 'F', 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0
+				};
+				SPROUT_CONSTEXPR unsigned char put_stub[] = {
+					0x57,								// push rdi
+					0xb8, 0x01, 0x00, 0x00, 0x00,		// mov eax, 1 (write)
+					0xbf, 0x01, 0x00, 0x00, 0x00,		// mov edi, 1
+					0x48, 0x89, 0xe6,					// mov rsi, rsp
+					0xba, 0x01, 0x00, 0x00, 0x00,		// mov edx, 1
+					0x0f, 0x05,							// syscall
+					0x5f,								// pop rdi
+					0xc3								// ret
+				};
+				SPROUT_CONSTEXPR unsigned char get_stub[] = {
+					0x6a, 0xff,							// push -1 (left as is at end of input)
+					0x31, 0xc0,							// xor eax, eax (read)
+					0x31, 0xff,							// xor edi, edi
+					0x48, 0x89, 0xe6,					// mov rsi, rsp
+					0xba, 0x01, 0x00, 0x00, 0x00,		// mov edx, 1
+					0x0f, 0x05,							// syscall
+					0x58,								// pop rax
+					0xc3								// ret
+				};
+				sprout::brainfuck::x86_64::detail::writer<M> out;
+
+				// ELF header
+				out.put(ident);
+				out.put_le(half(2));										// e_type (ET_EXEC)
+				out.put_le(half(0x3e));										// e_machine (EM_X86_64)
+				out.put_le(word(1));										// e_version
+				out.put_le(xword(sprout::brainfuck::x86_64::elf_base_address + headers_size));	// e_entry
+				out.put_le(xword(64));										// e_phoff
+				out.put_le(xword(0));										// e_shoff
+				out.put_le(word(0));										// e_flags
+				out.put_le(half(64));										// e_ehsize
+				out.put_le(half(56));										// e_phentsize
+				out.put_le(half(2));										// e_phnum
+				out.put_le(half(64));										// e_shentsize
+				out.put_le(half(0));										// e_shnum
+				out.put_le(half(0));										// e_shstrndx
+
+				// program headers: the file as R+X text, then the tape as R+W bss
+				out.put_le(word(1));										// p_type (PT_LOAD)
+				out.put_le(word(5));										// p_flags (PF_R | PF_X)
+				out.put_le(xword(0));										// p_offset
+				out.put_le(xword(sprout::brainfuck::x86_64::elf_base_address));	// p_vaddr
+				out.put_le(xword(sprout::brainfuck::x86_64::elf_base_address));	// p_paddr
+				std::size_t const text_size = out.size;
+				out.put_le(xword(0));										// p_filesz (set later)
+				out.put_le(xword(0));										// p_memsz (set later)
+				out.put_le(xword(0x1000));									// p_align
+				out.put_le(word(1));										// p_type (PT_LOAD)
+				out.put_le(word(6));										// p_flags (PF_R | PF_W)
+				out.put_le(xword(0));										// p_offset
+				out.put_le(xword(sprout::brainfuck::x86_64::elf_tape_address));	// p_vaddr
+				out.put_le(xword(sprout::brainfuck::x86_64::elf_tape_address));	// p_paddr
+				out.put_le(xword(0));										// p_filesz
+				out.put_le(xword(TapeSize));								// p_memsz
+				out.put_le(xword(0x1000));									// p_align
+
+				// _start
+				out.put(0xbf);												// mov edi, tape
+				out.put_le(word(sprout::brainfuck::x86_64::elf_tape_address));
+				out.put(0xbe);												// mov esi, table
+				out.put_le(word(sprout::brainfuck::x86_64::elf_base_address + table_offset));
+				out.put(0xe8);												// call program
+				out.put_le(word(code_offset - (out.size + 4)));
+				out.put(0xb8);												// mov eax, 60 (exit)
+				out.put_le(word(60));
+				out.put(0x31); out.put(0xff);								// xor edi, edi
+				out.put(0x0f); out.put(0x05);								// syscall
+
+				// io stubs and table
+				out.put(put_stub);
+				out.put(get_stub);
+				while (out.size != table_offset) {
+					out.put(0xcc);
+				}
+				out.put_le(xword(sprout::brainfuck::x86_64::elf_base_address + put_offset));
+				out.put_le(xword(sprout::brainfuck::x86_64::elf_base_address + get_offset));
+
+				// program
+				sprout::brainfuck::x86_64::detail::assemble(out, code);
+				out.patch_le(text_size, xword(out.size));
+				out.patch_le(text_size + 8, xword(out.size));
+				return out.result();
+			}
+		}	// namespace x86_64
+	}	// namespace brainfuck
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_BRAINFUCK_X86_64_HPP
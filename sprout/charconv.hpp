@@ -0,0 +1,15 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_CHARCONV_HPP
+#define SPROUT_CHARCONV_HPP
+
+#include <sprout/config.hpp>
+#include <sprout/charconv/to_chars.hpp>
+#include <sprout/charconv/from_chars.hpp>
+
+#endif	// #ifndef SPROUT_CHARCONV_HPP
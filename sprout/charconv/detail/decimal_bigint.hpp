@@ -0,0 +1,109 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_CHARCONV_DETAIL_DECIMAL_BIGINT_HPP
+#define SPROUT_CHARCONV_DETAIL_DECIMAL_BIGINT_HPP
+
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/cstdint.hpp>
+
+namespace sprout {
+	namespace detail {
+		//
+		// decimal_bigint
+		//
+		//	Fixed-capacity unsigned integer of 32-bit limbs, least significant
+		//	first. Just enough arithmetic to compare a long decimal with a
+		//	halfway point between two floats exactly.
+		//
+		template<std::size_t Limbs>
+		class decimal_bigint {
+		private:
+			std::uint32_t limbs_[Limbs];
+			std::size_t size_;
+		public:
+			SPROUT_CONSTEXPR decimal_bigint()
+				: limbs_(), size_()
+			{}
+			SPROUT_CXX14_CONSTEXPR explicit decimal_bigint(std::uint64_t val)
+				: limbs_(), size_()
+			{
+				for (; val != 0; val >>= 32) {
+					limbs_[size_++] = static_cast<std::uint32_t>(val);
+				}
+			}
+			SPROUT_CONSTEXPR std::size_t size() const {
+				return size_;
+			}
+			// *this = *this * y + carry
+			SPROUT_CXX14_CONSTEXPR void multiply_add(std::uint32_t y, std::uint32_t carry) {
+				std::uint64_t c = carry;
+				for (std::size_t i = 0; i != size_; ++i) {
+					std::uint64_t const t = static_cast<std::uint64_t>(limbs_[i]) * y + c;
+					limbs_[i] = static_cast<std::uint32_t>(t);
+					c = t >> 32;
+				}
+				if (c != 0) {
+					limbs_[size_++] = static_cast<std::uint32_t>(c);
+				}
+			}
+			SPROUT_CXX14_CONSTEXPR void multiply_pow5(long n) {
+				// 5^13 is the largest power of five in 32 bits
+				for (; n >= 13; n -= 13) {
+					multiply_add(UINT32_C(1220703125), 0);
+				}
+				std::uint32_t p = 1;
+				for (; n > 0; --n) {
+					p *= 5;
+				}
+				multiply_add(p, 0);
+			}
+			SPROUT_CXX14_CONSTEXPR void shift_left(long n) {
+				if (size_ == 0 || n <= 0) {
+					return;
+				}
+				std::size_t const words = static_cast<std::size_t>(n / 32);
+				int const bits = static_cast<int>(n % 32);
+				if (bits != 0) {
+					std::uint32_t carry = 0;
+					for (std::size_t i = 0; i != size_; ++i) {
+						std::uint32_t const t = limbs_[i];
+						limbs_[i] = (t << bits) | carry;
+						carry = t >> (32 - bits);
+					}
+					if (carry != 0) {
+						limbs_[size_++] = carry;
+					}
+				}
+				if (words != 0) {
+					for (std::size_t i = size_; i != 0; --i) {
+						limbs_[i - 1 + words] = limbs_[i - 1];
+					}
+					for (std::size_t i = 0; i != words; ++i) {
+						limbs_[i] = 0;
+					}
+					size_ += words;
+				}
+			}
+			// -1, 0 or 1
+			friend SPROUT_CXX14_CONSTEXPR int compare(decimal_bigint const& lhs, decimal_bigint const& rhs) {
+				if (lhs.size_ != rhs.size_) {
+					return lhs.size_ < rhs.size_ ? -1 : 1;
+				}
+				for (std::size_t i = lhs.size_; i != 0; --i) {
+					if (lhs.limbs_[i - 1] != rhs.limbs_[i - 1]) {
+						return lhs.limbs_[i - 1] < rhs.limbs_[i - 1] ? -1 : 1;
+					}
+				}
+				return 0;
+			}
+		};
+	}	// namespace detail
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_CHARCONV_DETAIL_DECIMAL_BIGINT_HPP
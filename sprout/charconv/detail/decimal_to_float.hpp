@@ -0,0 +1,552 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_CHARCONV_DETAIL_DECIMAL_TO_FLOAT_HPP
+#define SPROUT_CHARCONV_DETAIL_DECIMAL_TO_FLOAT_HPP
+
+#include <cstring>
+#include <system_error>
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/cstdint.hpp>
+#include <sprout/limits.hpp>
+#include <sprout/bit/clz.hpp>
+#include <sprout/detail/char_literal.hpp>
+#include <sprout/detail/simd.hpp>
+#include <sprout/detail/eight_digits.hpp>
+#include <sprout/charconv/from_chars_result.hpp>
+#include <sprout/charconv/detail/umul128.hpp>
+#include <sprout/charconv/detail/shortest_float.hpp>
+#include <sprout/charconv/detail/decimal_bigint.hpp>
+#include <sprout/charconv/detail/decimal_to_float_table.hpp>
+
+namespace sprout {
+	namespace detail {
+		//
+		// decimal_to_float_traits
+		//
+		template<typename FloatType>
+		struct decimal_to_float_traits {
+		private:
+			SPROUT_STATIC_CONSTEXPR bool is_double = sprout::numeric_limits<FloatType>::digits == 53;
+		public:
+			typedef typename sprout::detail::shortest_float_traits<FloatType>::carrier_type carrier_type;
+			typedef sprout::detail::decimal_bigint<is_double ? 128 : 24> bigint_type;
+		public:
+			SPROUT_STATIC_CONSTEXPR int significand_bits = sprout::numeric_limits<FloatType>::digits - 1;
+			SPROUT_STATIC_CONSTEXPR int exponent_bias = sprout::detail::shortest_float_traits<FloatType>::exponent_bias;
+			SPROUT_STATIC_CONSTEXPR int minimum_exponent = 1 - sprout::numeric_limits<FloatType>::max_exponent;
+			SPROUT_STATIC_CONSTEXPR int infinite_power = 2 * sprout::numeric_limits<FloatType>::max_exponent - 1;
+			// below and above these powers of ten every value is zero or infinity
+			SPROUT_STATIC_CONSTEXPR int smallest_power_of_ten = is_double ? -342 : -65;
+			SPROUT_STATIC_CONSTEXPR int largest_power_of_ten = is_double ? 308 : 38;
+			// the only powers of ten for which a product can fall exactly halfway
+			SPROUT_STATIC_CONSTEXPR int min_round_to_even = is_double ? -4 : -17;
+			SPROUT_STATIC_CONSTEXPR int max_round_to_even = is_double ? 23 : 10;
+			SPROUT_STATIC_CONSTEXPR int max_exact_power_of_ten = is_double ? 22 : 10;
+			// significant digits that can matter for a correctly rounded result
+			SPROUT_STATIC_CONSTEXPR int max_digits = is_double ? 769 : 114;
+		};
+		template<typename FloatType>
+		SPROUT_CONSTEXPR_OR_CONST bool sprout::detail::decimal_to_float_traits<FloatType>::is_double;
+		template<typename FloatType>
+		SPROUT_CONSTEXPR_OR_CONST int sprout::detail::decimal_to_float_traits<FloatType>::significand_bits;
+		template<typename FloatType>
+		SPROUT_CONSTEXPR_OR_CONST int sprout::detail::decimal_to_float_traits<FloatType>::exponent_bias;
+		template<typename FloatType>
+		SPROUT_CONSTEXPR_OR_CONST int sprout::detail::decimal_to_float_traits<FloatType>::minimum_exponent;
+		template<typename FloatType>
+		SPROUT_CONSTEXPR_OR_CONST int sprout::detail::decimal_to_float_traits<FloatType>::infinite_power;
+		template<typename FloatType>
+		SPROUT_CONSTEXPR_OR_CONST int sprout::detail::decimal_to_float_traits<FloatType>::smallest_power_of_ten;
+		template<typename FloatType>
+		SPROUT_CONSTEXPR_OR_CONST int sprout::detail::decimal_to_float_traits<FloatType>::largest_power_of_ten;
+		template<typename FloatType>
+		SPROUT_CONSTEXPR_OR_CONST int sprout::detail::decimal_to_float_traits<FloatType>::min_round_to_even;
+		template<typename FloatType>
+		SPROUT_CONSTEXPR_OR_CONST int sprout::detail::decimal_to_float_traits<FloatType>::max_round_to_even;
+		template<typename FloatType>
+		SPROUT_CONSTEXPR_OR_CONST int sprout::detail::decimal_to_float_traits<FloatType>::max_exact_power_of_ten;
+		template<typename FloatType>
+		SPROUT_CONSTEXPR_OR_CONST int sprout::detail::decimal_to_float_traits<FloatType>::max_digits;
+
+		//
+		// decimal_to_float_number
+		//
+		//	A parsed decimal: mantissa * 10^exponent. When more than 19 digits
+		//	were given, mantissa holds only the leading ones and the digit ranges
+		//	are kept for the exact comparison.
+		//
+		template<typename Elem>
+		struct decimal_to_float_number {
+		public:
+			std::uint64_t mantissa;
+			long long exponent;
+			long long exponent_number;
+			Elem const* integer_first;
+			Elem const* integer_last;
+			Elem const* fraction_first;
+			Elem const* fraction_last;
+			Elem const* last;
+			bool negative;
+			bool valid;
+			bool too_many_digits;
+		};
+
+		template<typename Elem>
+		inline SPROUT_CONSTEXPR bool
+		decimal_to_float_is_digit(Elem c) {
+			return c >= SPROUT_CHAR_LITERAL('0', Elem) && c <= SPROUT_CHAR_LITERAL('9', Elem);
+		}
+		template<typename Elem>
+		inline SPROUT_CONSTEXPR unsigned
+		decimal_to_float_digit(Elem c) {
+			return static_cast<unsigned>(c - SPROUT_CHAR_LITERAL('0', Elem));
+		}
+
+		//
+		// decimal_to_float_eight_digits
+		//
+		//	Consumes whole runs of eight digits a word at a time; only plain char
+		//	text at runtime.
+		//
+		template<typename Elem>
+		inline SPROUT_CXX14_CONSTEXPR void
+		decimal_to_float_eight_digits(Elem const*&, Elem const*, std::uint64_t&) {}
+		inline SPROUT_CXX14_CONSTEXPR void
+		decimal_to_float_eight_digits(char const*& p, char const* last, std::uint64_t& i) {
+			if (SPROUT_DETAIL_IS_CONSTANT_EVALUATED()) {
+				return;
+			}
+			for (; last - p >= 8; p += 8) {
+				std::uint64_t const v = sprout::detail::load_eight_digits(p);
+				if (!sprout::detail::is_eight_digits(v)) {
+					return;
+				}
+				i = i * 100000000 + sprout::detail::parse_eight_digits(v);
+			}
+		}
+
+		//
+		// decimal_to_float_parse
+		//
+		//	[-]digits[.digits][(e|E)[+|-]digits], with at least one digit in
+		//	the mantissa. An exponent marker without digits is not consumed.
+		//
+		template<typename Elem>
+		inline SPROUT_CXX14_CONSTEXPR sprout::detail::decimal_to_float_number<Elem>
+		decimal_to_float_parse(Elem const* first, Elem const* last) {
+			sprout::detail::decimal_to_float_number<Elem> n = {0, 0, 0, first, first, first, first, first, false, false, false};
+			Elem const* p = first;
+			if (p != last && *p == SPROUT_CHAR_LITERAL('-', Elem)) {
+				n.negative = true;
+				++p;
+			}
+			std::uint64_t i = 0;
+			n.integer_first = p;
+			sprout::detail::decimal_to_float_eight_digits(p, last, i);
+			for (; p != last && sprout::detail::decimal_to_float_is_digit(*p); ++p) {
+				i = i * 10 + sprout::detail::decimal_to_float_digit(*p);
+			}
+			n.integer_last = p;
+			n.fraction_first = n.fraction_last = p;
+			if (p != last && *p == SPROUT_CHAR_LITERAL('.', Elem)) {
+				++p;
+				n.fraction_first = p;
+				sprout::detail::decimal_to_float_eight_digits(p, last, i);
+				for (; p != last && sprout::detail::decimal_to_float_is_digit(*p); ++p) {
+					i = i * 10 + sprout::detail::decimal_to_float_digit(*p);
+				}
+				n.fraction_last = p;
+			}
+			long long digit_count = (n.integer_last - n.integer_first) + (n.fraction_last - n.fraction_first);
+			if (digit_count == 0) {
+				return n;
+			}
+			n.valid = true;
+			if (p != last && (*p == SPROUT_CHAR_LITERAL('e', Elem) || *p == SPROUT_CHAR_LITERAL('E', Elem))) {
+				Elem const* q = p + 1;
+				bool negative_exponent = false;
+				if (q != last && *q == SPROUT_CHAR_LITERAL('-', Elem)) {
+					negative_exponent = true;
+					++q;
+				} else if (q != last && *q == SPROUT_CHAR_LITERAL('+', Elem)) {
+					++q;
+				}
+				if (q != last && sprout::detail::decimal_to_float_is_digit(*q)) {
+					long long e = 0;
+					for (; q != last && sprout::detail::decimal_to_float_is_digit(*q); ++q) {
+						// far beyond any finite nonzero result; keeps the sums from overflowing
+						if (e < 0x10000000) {
+							e = e * 10 + sprout::detail::decimal_to_float_digit(*q);
+						}
+					}
+					n.exponent_number = negative_exponent ? -e : e;
+					p = q;
+				}
+			}
+			n.last = p;
+			n.mantissa = i;
+			n.exponent = n.exponent_number - (n.fraction_last - n.fraction_first);
+			if (digit_count > 19) {
+				// leading zeros do not count
+				for (Elem const* z = n.integer_first; z != n.fraction_last; ++z) {
+					if (*z == SPROUT_CHAR_LITERAL('0', Elem)) {
+						--digit_count;
+					} else if (*z != SPROUT_CHAR_LITERAL('.', Elem)) {
+						break;
+					}
+				}
+				if (digit_count > 19) {
+					n.too_many_digits = true;
+					std::uint64_t const limit = UINT64_C(1000000000000000000);
+					i = 0;
+					Elem const* q = n.integer_first;
+					for (; i < limit && q != n.integer_last; ++q) {
+						i = i * 10 + sprout::detail::decimal_to_float_digit(*q);
+					}
+					if (i >= limit) {
+						n.exponent = (n.integer_last - q) + n.exponent_number;
+					} else {
+						for (q = n.fraction_first; i < limit && q != n.fraction_last; ++q) {
+							i = i * 10 + sprout::detail::decimal_to_float_digit(*q);
+						}
+						n.exponent = (n.fraction_first - q) + n.exponent_number;
+					}
+					n.mantissa = i;
+				}
+			}
+			return n;
+		}
+
+		//
+		// decimal_to_float_adjusted
+		//
+		//	Biased exponent and explicit significand bits of a result.
+		//
+		struct decimal_to_float_adjusted {
+		public:
+			std::uint64_t mantissa;
+			int power2;
+		};
+
+		//
+		// decimal_to_float_compute
+		//
+		//	Eisel-Lemire: w * 10^q rounded to nearest from a truncated 128-bit
+		//	product with the normalized 5^q.
+		//
+		template<typename FloatType>
+		inline SPROUT_CXX14_CONSTEXPR sprout::detail::decimal_to_float_adjusted
+		decimal_to_float_compute(long long q, std::uint64_t w) {
+			typedef sprout::detail::decimal_to_float_traits<FloatType> traits_type;
+			typedef sprout::detail::decimal_to_float_pow5<> table_type;
+			sprout::detail::decimal_to_float_adjusted answer = {0, 0};
+			if (w == 0 || q < traits_type::smallest_power_of_ten) {
+				return answer;
+			}
+			if (q > traits_type::largest_power_of_ten) {
+				answer.power2 = traits_type::infinite_power;
+				return answer;
+			}
+			int const lz = sprout::clz(w);
+			w <<= lz;
+			std::size_t const index = static_cast<std::size_t>(q - table_type::min_exponent) * 2;
+			sprout::detail::uint128_parts product = sprout::detail::umul128(w, table_type::table[index]);
+			std::uint64_t const precision_mask = ~UINT64_C(0) >> (traits_type::significand_bits + 3);
+			if ((product.hi & precision_mask) == precision_mask) {
+				sprout::detail::uint128_parts const second = sprout::detail::umul128(w, table_type::table[index + 1]);
+				product.lo += second.hi;
+				if (second.hi > product.lo) {
+					++product.hi;
+				}
+			}
+			int const upperbit = static_cast<int>(product.hi >> 63);
+			int const shift = upperbit + 64 - traits_type::significand_bits - 3;
+			answer.mantissa = product.hi >> shift;
+			// floor(log2(10^q)) + 63
+			answer.power2 = sprout::detail::shortest_float_floor_shift((152170 + 65536) * static_cast<int>(q), 16) + 63
+				+ upperbit - lz - traits_type::minimum_exponent
+				;
+			if (answer.power2 <= 0) {
+				if (-answer.power2 + 1 >= 64) {
+					answer.mantissa = 0;
+					answer.power2 = 0;
+					return answer;
+				}
+				answer.mantissa >>= -answer.power2 + 1;
+				answer.mantissa += answer.mantissa & 1;
+				answer.mantissa >>= 1;
+				answer.power2 = answer.mantissa < (UINT64_C(1) << traits_type::significand_bits) ? 0 : 1;
+				return answer;
+			}
+			if (product.lo <= 1 && q >= traits_type::min_round_to_even && q <= traits_type::max_round_to_even
+				&& (answer.mantissa & 3) == 1 && (answer.mantissa << shift) == product.hi
+				)
+			{
+				// exactly halfway: round down to even
+				answer.mantissa &= ~UINT64_C(1);
+			}
+			answer.mantissa += answer.mantissa & 1;
+			answer.mantissa >>= 1;
+			if (answer.mantissa >= (UINT64_C(2) << traits_type::significand_bits)) {
+				answer.mantissa = UINT64_C(1) << traits_type::significand_bits;
+				++answer.power2;
+			}
+			answer.mantissa &= ~(UINT64_C(1) << traits_type::significand_bits);
+			if (answer.power2 >= traits_type::infinite_power) {
+				answer.mantissa = 0;
+				answer.power2 = traits_type::infinite_power;
+			}
+			return answer;
+		}
+
+		template<typename FloatType>
+		inline SPROUT_CONSTEXPR typename sprout::detail::decimal_to_float_traits<FloatType>::carrier_type
+		decimal_to_float_adjusted_bits(sprout::detail::decimal_to_float_adjusted const& am) {
+			typedef sprout::detail::decimal_to_float_traits<FloatType> traits_type;
+			typedef typename traits_type::carrier_type carrier_type;
+			return (static_cast<carrier_type>(am.power2) << traits_type::significand_bits) | static_cast<carrier_type>(am.mantissa);
+		}
+
+		//
+		// decimal_to_float_digit_compare
+		//
+		//	Settles a truncated mantissa: the value lies between bits and the next
+		//	float up, so it is compared exactly with the halfway point between them.
+		//
+		template<typename FloatType, typename Elem>
+		inline SPROUT_CXX14_CONSTEXPR typename sprout::detail::decimal_to_float_traits<FloatType>::carrier_type
+		decimal_to_float_digit_compare(
+			sprout::detail::decimal_to_float_number<Elem> const& n,
+			typename sprout::detail::decimal_to_float_traits<FloatType>::carrier_type bits
+			)
+		{
+			typedef sprout::detail::decimal_to_float_traits<FloatType> traits_type;
+			typedef typename traits_type::carrier_type carrier_type;
+			typedef typename traits_type::bigint_type bigint_type;
+			// the significant digits, cut at max_digits with a sticky digit for the rest
+			bigint_type digits;
+			long long significant = 0;
+			long long taken = 0;
+			bool sticky = false;
+			std::uint32_t chunk = 0;
+			std::uint32_t chunk_scale = 1;
+			for (int part = 0; part != 2; ++part) {
+				Elem const* p = part == 0 ? n.integer_first : n.fraction_first;
+				Elem const* const e = part == 0 ? n.integer_last : n.fraction_last;
+				for (; p != e; ++p) {
+					unsigned const d = sprout::detail::decimal_to_float_digit(*p);
+					if (significant == 0 && d == 0) {
+						continue;
+					}
+					++significant;
+					if (taken == traits_type::max_digits) {
+						sticky = sticky || d != 0;
+						continue;
+					}
+					++taken;
+					chunk = chunk * 10 + d;
+					chunk_scale *= 10;
+					if (chunk_scale == 1000000000) {
+						digits.multiply_add(chunk_scale, chunk);
+						chunk = 0;
+						chunk_scale = 1;
+					}
+				}
+			}
+			digits.multiply_add(chunk_scale, chunk);
+			long long exponent = n.exponent_number - (n.fraction_last - n.fraction_first) + (significant - taken);
+			if (sticky) {
+				digits.multiply_add(10, 1);
+				--exponent;
+			}
+			// halfway = (2m + 1) * 2^(e - 1)
+			int const biased = static_cast<int>(bits >> traits_type::significand_bits);
+			carrier_type m = bits & ((carrier_type(1) << traits_type::significand_bits) - 1);
+			if (biased != 0) {
+				m |= carrier_type(1) << traits_type::significand_bits;
+			}
+			long const e = (biased != 0 ? biased : 1) - traits_type::exponent_bias;
+			long const pow10_up = exponent > 0 ? static_cast<long>(exponent) : 0;
+			long const pow10_down = exponent < 0 ? static_cast<long>(-exponent) : 0;
+			long lhs_shift = pow10_up + (1 - e > 0 ? 1 - e : 0);
+			long rhs_shift = pow10_down + (e - 1 > 0 ? e - 1 : 0);
+			long const common = lhs_shift < rhs_shift ? lhs_shift : rhs_shift;
+			lhs_shift -= common;
+			rhs_shift -= common;
+			bigint_type halfway(static_cast<std::uint64_t>(m) * 2 + 1);
+			digits.multiply_pow5(pow10_up);
+			digits.shift_left(lhs_shift);
+			halfway.multiply_pow5(pow10_down);
+			halfway.shift_left(rhs_shift);
+			int const c = compare(digits, halfway);
+			return bits + (c > 0 || (c == 0 && (m & 1) != 0) ? 1 : 0);
+		}
+
+		//
+		// decimal_to_float_from_bits
+		//
+		template<typename FloatType>
+		inline SPROUT_CXX14_CONSTEXPR FloatType
+		decimal_to_float_from_bits(typename sprout::detail::decimal_to_float_traits<FloatType>::carrier_type bits, bool negative) {
+			typedef sprout::detail::decimal_to_float_traits<FloatType> traits_type;
+			typedef typename traits_type::carrier_type carrier_type;
+			if (!SPROUT_DETAIL_IS_CONSTANT_EVALUATED()) {
+				bits |= static_cast<carrier_type>(negative ? 1 : 0) << (sizeof(carrier_type) * 8 - 1);
+				FloatType result = 0;
+				std::memcpy(&result, &bits, sizeof(result));
+				return result;
+			}
+			int const biased = static_cast<int>(bits >> traits_type::significand_bits);
+			if (biased == traits_type::infinite_power) {
+				return negative ? -sprout::numeric_limits<FloatType>::infinity() : sprout::numeric_limits<FloatType>::infinity();
+			}
+			carrier_type m = bits & ((carrier_type(1) << traits_type::significand_bits) - 1);
+			if (biased != 0) {
+				m |= carrier_type(1) << traits_type::significand_bits;
+			}
+			// every intermediate m * 2^k is representable, so the scaling is exact
+			FloatType x = static_cast<FloatType>(m);
+			for (int e = (biased != 0 ? biased : 1) - traits_type::exponent_bias; e != 0; ) {
+				if (e > 0) {
+					x *= 2;
+					--e;
+				} else {
+					x /= 2;
+					++e;
+				}
+			}
+			return negative ? -x : x;
+		}
+
+		//
+		// decimal_to_float_special
+		//
+		//	inf, infinity, nan and nan(chars), in any case.
+		//
+		template<typename Elem>
+		inline SPROUT_CXX14_CONSTEXPR bool
+		decimal_to_float_match(Elem const* first, Elem const* last, char const* word) {
+			for (; *word; ++word, ++first) {
+				if (first == last) {
+					return false;
+				}
+				Elem c = *first;
+				if (c >= SPROUT_CHAR_LITERAL('A', Elem) && c <= SPROUT_CHAR_LITERAL('Z', Elem)) {
+					c = c - SPROUT_CHAR_LITERAL('A', Elem) + SPROUT_CHAR_LITERAL('a', Elem);
+				}
+				if (c != static_cast<Elem>(*word)) {
+					return false;
+				}
+			}
+			return true;
+		}
+		template<typename FloatType, typename Elem>
+		inline SPROUT_CXX14_CONSTEXPR sprout::basic_from_chars_result<Elem>
+		decimal_to_float_special(Elem const* first, Elem const* last, FloatType& value) {
+			Elem const* p = first;
+			bool const negative = p != last && *p == SPROUT_CHAR_LITERAL('-', Elem);
+			if (negative) {
+				++p;
+			}
+			if (sprout::detail::decimal_to_float_match(p, last, "inf")) {
+				p += 3;
+				if (sprout::detail::decimal_to_float_match(p, last, "inity")) {
+					p += 5;
+				}
+				value = negative ? -sprout::numeric_limits<FloatType>::infinity() : sprout::numeric_limits<FloatType>::infinity();
+				sprout::basic_from_chars_result<Elem> const result = {p, std::errc()};
+				return result;
+			}
+			if (sprout::detail::decimal_to_float_match(p, last, "nan")) {
+				p += 3;
+				if (p != last && *p == SPROUT_CHAR_LITERAL('(', Elem)) {
+					Elem const* q = p + 1;
+					for (; q != last; ++q) {
+						Elem const c = *q;
+						if (!(sprout::detail::decimal_to_float_is_digit(c)
+							|| (c >= SPROUT_CHAR_LITERAL('a', Elem) && c <= SPROUT_CHAR_LITERAL('z', Elem))
+							|| (c >= SPROUT_CHAR_LITERAL('A', Elem) && c <= SPROUT_CHAR_LITERAL('Z', Elem))
+							|| c == SPROUT_CHAR_LITERAL('_', Elem)
+							))
+						{
+							break;
+						}
+					}
+					if (q != last && *q == SPROUT_CHAR_LITERAL(')', Elem)) {
+						p = q + 1;
+					}
+				}
+				value = negative ? -sprout::numeric_limits<FloatType>::quiet_NaN() : sprout::numeric_limits<FloatType>::quiet_NaN();
+				sprout::basic_from_chars_result<Elem> const result = {p, std::errc()};
+				return result;
+			}
+			sprout::basic_from_chars_result<Elem> const result = {first, std::errc::invalid_argument};
+			return result;
+		}
+
+		//
+		// decimal_to_float
+		//
+		//	The correctly rounded value of the decimal at [first, last), with the
+		//	error reporting of from_chars. Small exact cases are one
+		//	floating-point operation; the rest go through Eisel-Lemire, and a
+		//	long mantissa it cannot settle is compared digit by digit. With
+		//	saturate, an out of range value is still stored as infinity or zero.
+		//
+		template<typename FloatType, typename Elem>
+		inline SPROUT_CXX14_CONSTEXPR sprout::basic_from_chars_result<Elem>
+		decimal_to_float(Elem const* first, Elem const* last, FloatType& value, bool saturate = false) {
+			typedef sprout::detail::decimal_to_float_traits<FloatType> traits_type;
+			typedef typename traits_type::carrier_type carrier_type;
+			sprout::detail::decimal_to_float_number<Elem> const n = sprout::detail::decimal_to_float_parse(first, last);
+			if (!n.valid) {
+				return sprout::detail::decimal_to_float_special(first, last, value);
+			}
+			if (!n.too_many_digits
+				&& n.exponent >= -traits_type::max_exact_power_of_ten && n.exponent <= traits_type::max_exact_power_of_ten
+				&& n.mantissa <= (UINT64_C(1) << (traits_type::significand_bits + 1))
+				)
+			{
+				FloatType const pow10 = static_cast<FloatType>(
+					sprout::detail::decimal_to_float_exact_pow10<>::table[static_cast<std::size_t>(n.exponent < 0 ? -n.exponent : n.exponent)]
+					);
+				FloatType const x = n.exponent < 0
+					? static_cast<FloatType>(n.mantissa) / pow10
+					: static_cast<FloatType>(n.mantissa) * pow10
+					;
+				value = n.negative ? -x : x;
+				sprout::basic_from_chars_result<Elem> const result = {n.last, std::errc()};
+				return result;
+			}
+			sprout::detail::decimal_to_float_adjusted const am = sprout::detail::decimal_to_float_compute<FloatType>(n.exponent, n.mantissa);
+			carrier_type bits = sprout::detail::decimal_to_float_adjusted_bits<FloatType>(am);
+			if (n.too_many_digits) {
+				sprout::detail::decimal_to_float_adjusted const am1 = sprout::detail::decimal_to_float_compute<FloatType>(n.exponent, n.mantissa + 1);
+				if (am.mantissa != am1.mantissa || am.power2 != am1.power2) {
+					bits = sprout::detail::decimal_to_float_digit_compare<FloatType>(n, bits);
+				}
+			}
+			if ((bits >> traits_type::significand_bits) == static_cast<carrier_type>(traits_type::infinite_power)
+				|| (bits == 0 && n.mantissa != 0)
+				)
+			{
+				if (saturate) {
+					value = sprout::detail::decimal_to_float_from_bits<FloatType>(bits, n.negative);
+				}
+				sprout::basic_from_chars_result<Elem> const result = {n.last, std::errc::result_out_of_range};
+				return result;
+			}
+			value = sprout::detail::decimal_to_float_from_bits<FloatType>(bits, n.negative);
+			sprout::basic_from_chars_result<Elem> const result = {n.last, std::errc()};
+			return result;
+		}
+	}	// namespace detail
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_CHARCONV_DETAIL_DECIMAL_TO_FLOAT_HPP
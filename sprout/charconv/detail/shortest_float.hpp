@@ -0,0 +1,356 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_CHARCONV_DETAIL_SHORTEST_FLOAT_HPP
+#define SPROUT_CHARCONV_DETAIL_SHORTEST_FLOAT_HPP
+
+#include <cstring>
+#include <type_traits>
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/cstdint.hpp>
+#include <sprout/limits.hpp>
+#include <sprout/type_traits/integral_constant.hpp>
+#include <sprout/math/isinf.hpp>
+#include <sprout/math/isnan.hpp>
+#include <sprout/math/signbit.hpp>
+#include <sprout/detail/char_literal.hpp>
+#include <sprout/detail/char_conversion.hpp>
+#include <sprout/detail/simd.hpp>
+#include <sprout/detail/two_digits.hpp>
+#include <sprout/charconv/detail/umul128.hpp>
+#include <sprout/charconv/detail/shortest_float_table.hpp>
+
+namespace sprout {
+	namespace detail {
+		//
+		// is_shortest_float
+		//
+		//	Types with a binary32 or binary64 layout.
+		//
+		template<typename FloatType>
+		struct is_shortest_float
+			: public sprout::bool_constant<
+				std::is_floating_point<FloatType>::value && sprout::numeric_limits<FloatType>::is_iec559
+				&& (sprout::numeric_limits<FloatType>::digits == 24 || sprout::numeric_limits<FloatType>::digits == 53)
+			>
+		{};
+
+		//
+		// shortest_float_traits
+		//
+		template<typename FloatType>
+		struct shortest_float_traits {
+		public:
+			typedef typename std::conditional<
+				sprout::numeric_limits<FloatType>::digits == 53, std::uint64_t, std::uint32_t
+			>::type carrier_type;
+		public:
+			SPROUT_STATIC_CONSTEXPR int significand_bits = sprout::numeric_limits<FloatType>::digits - 1;
+			SPROUT_STATIC_CONSTEXPR int exponent_bias = sprout::numeric_limits<FloatType>::max_exponent - 1 + significand_bits;
+		};
+		template<typename FloatType>
+		SPROUT_CONSTEXPR_OR_CONST int sprout::detail::shortest_float_traits<FloatType>::significand_bits;
+		template<typename FloatType>
+		SPROUT_CONSTEXPR_OR_CONST int sprout::detail::shortest_float_traits<FloatType>::exponent_bias;
+
+		//
+		// shortest_float_bits
+		//
+		//	The bit pattern of |val| for a finite val. Constant evaluation takes it
+		//	apart arithmetically, since the representation cannot be inspected there.
+		//
+		template<typename FloatType>
+		inline SPROUT_CXX14_CONSTEXPR typename sprout::detail::shortest_float_traits<FloatType>::carrier_type
+		shortest_float_bits(FloatType val) {
+			typedef sprout::detail::shortest_float_traits<FloatType> traits_type;
+			typedef typename traits_type::carrier_type carrier_type;
+			if (!SPROUT_DETAIL_IS_CONSTANT_EVALUATED()) {
+				carrier_type bits = 0;
+				std::memcpy(&bits, &val, sizeof(bits));
+				return bits & ~(carrier_type(1) << (sizeof(carrier_type) * 8 - 1));
+			}
+			FloatType x = val < 0 ? -val : val;
+			if (x == 0) {
+				return 0;
+			}
+			carrier_type const hidden = carrier_type(1) << traits_type::significand_bits;
+			FloatType const lower = static_cast<FloatType>(hidden);
+			int e = 0;
+			while (x >= lower * 2) {
+				x /= 2;
+				++e;
+			}
+			while (x < lower && e > 1 - traits_type::exponent_bias) {
+				x *= 2;
+				--e;
+			}
+			carrier_type const m = static_cast<carrier_type>(x);
+			return m >= hidden
+				? (static_cast<carrier_type>(e + traits_type::exponent_bias) << traits_type::significand_bits) | (m - hidden)
+				: m
+				;
+		}
+
+		//
+		// shortest_float_floor_shift
+		//
+		//	floor(x / 2^n) for any sign of x.
+		//
+		inline SPROUT_CONSTEXPR int
+		shortest_float_floor_shift(int x, int n) {
+			return x >= 0 ? x >> n : ~(~x >> n);
+		}
+		// floor(log2(10^e))
+		inline SPROUT_CONSTEXPR int
+		shortest_float_floor_log2_pow10(int e) {
+			return sprout::detail::shortest_float_floor_shift(e * 1741647, 19);
+		}
+		// floor(log10(2^q)), or floor(log10(3/4 * 2^q))
+		inline SPROUT_CONSTEXPR int
+		shortest_float_floor_log10_pow2(int q, bool three_quarters) {
+			return sprout::detail::shortest_float_floor_shift(q * 1262611 - (three_quarters ? 524031 : 0), 22);
+		}
+
+		//
+		// shortest_float_round_to_odd
+		//
+		//	floor(g(e) * cp / 2^128) (2^64 for float), with the lowest bit set
+		//	when the discarded part is nonzero.
+		//
+		inline SPROUT_CXX14_CONSTEXPR std::uint64_t
+		shortest_float_round_to_odd(double, int e, std::uint64_t cp) {
+			typedef sprout::detail::shortest_float_pow10<> table_type;
+			std::size_t const i = static_cast<std::size_t>(e - table_type::double_min) * 2;
+			sprout::detail::uint128_parts const x = sprout::detail::umul128(table_type::double_table[i + 1], cp);
+			sprout::detail::uint128_parts const y = sprout::detail::umul128(table_type::double_table[i], cp);
+			std::uint64_t const y0 = y.lo + x.hi;
+			std::uint64_t const y1 = y.hi + (y0 < y.lo ? 1 : 0);
+			return y1 | (y0 > 1 ? 1 : 0);
+		}
+		inline SPROUT_CXX14_CONSTEXPR std::uint32_t
+		shortest_float_round_to_odd(float, int e, std::uint32_t cp) {
+			typedef sprout::detail::shortest_float_pow10<> table_type;
+			std::uint64_t const g = table_type::float_table[static_cast<std::size_t>(e - table_type::float_min)];
+			std::uint64_t const b01 = (g & UINT64_C(0xFFFFFFFF)) * cp;
+			std::uint64_t const b11 = (g >> 32) * cp;
+			std::uint64_t const hi = b11 + (b01 >> 32);
+			return static_cast<std::uint32_t>(hi >> 32) | (static_cast<std::uint32_t>(hi) > 1 ? 1 : 0);
+		}
+
+		//
+		// shortest_float_decimal
+		//
+		//	significand * 10^exponent
+		//
+		template<typename UInt>
+		struct shortest_float_decimal {
+		public:
+			UInt significand;
+			int exponent;
+		};
+
+		//
+		// shortest_float_to_decimal
+		//
+		//	Schubfach: the shortest decimal that rounds back to the value, for the
+		//	bits of a finite, nonzero, positive value. Trailing zeros are removed.
+		//
+		template<typename FloatType>
+		inline SPROUT_CXX14_CONSTEXPR sprout::detail::shortest_float_decimal<typename sprout::detail::shortest_float_traits<FloatType>::carrier_type>
+		shortest_float_to_decimal_impl(typename sprout::detail::shortest_float_traits<FloatType>::carrier_type bits) {
+			typedef sprout::detail::shortest_float_traits<FloatType> traits_type;
+			typedef typename traits_type::carrier_type carrier_type;
+			typedef sprout::detail::shortest_float_decimal<carrier_type> result_type;
+			carrier_type const ieee_significand = bits & ((carrier_type(1) << traits_type::significand_bits) - 1);
+			int const ieee_exponent = static_cast<int>(bits >> traits_type::significand_bits);
+			carrier_type c = ieee_significand;
+			int q = 1 - traits_type::exponent_bias;
+			if (ieee_exponent != 0) {
+				c |= carrier_type(1) << traits_type::significand_bits;
+				q = ieee_exponent - traits_type::exponent_bias;
+				// small integers
+				if (0 <= -q && -q <= traits_type::significand_bits && (c & ((carrier_type(1) << -q) - 1)) == 0) {
+					result_type const result = {static_cast<carrier_type>(c >> -q), 0};
+					return result;
+				}
+			}
+			bool const is_even = c % 2 == 0;
+			bool const lower_closer = ieee_significand == 0 && ieee_exponent > 1;
+			carrier_type const cbl = 4 * c - 2 + (lower_closer ? 1 : 0);
+			carrier_type const cb = 4 * c;
+			carrier_type const cbr = 4 * c + 2;
+			int const k = sprout::detail::shortest_float_floor_log10_pow2(q, lower_closer);
+			int const h = q + sprout::detail::shortest_float_floor_log2_pow10(-k) + 1;
+			carrier_type const vbl = sprout::detail::shortest_float_round_to_odd(FloatType(), -k, static_cast<carrier_type>(cbl << h));
+			carrier_type const vb = sprout::detail::shortest_float_round_to_odd(FloatType(), -k, static_cast<carrier_type>(cb << h));
+			carrier_type const vbr = sprout::detail::shortest_float_round_to_odd(FloatType(), -k, static_cast<carrier_type>(cbr << h));
+			carrier_type const lower = vbl + (is_even ? 0 : 1);
+			carrier_type const upper = vbr - (is_even ? 0 : 1);
+			carrier_type const s = vb / 4;
+			if (s >= 10) {
+				// one digit shorter
+				carrier_type const sp = s / 10;
+				bool const up_inside = lower <= 40 * sp;
+				bool const wp_inside = 40 * sp + 40 <= upper;
+				if (up_inside != wp_inside) {
+					result_type const result = {static_cast<carrier_type>(sp + (wp_inside ? 1 : 0)), k + 1};
+					return result;
+				}
+			}
+			bool const u_inside = lower <= 4 * s;
+			bool const w_inside = 4 * s + 4 <= upper;
+			if (u_inside != w_inside) {
+				result_type const result = {static_cast<carrier_type>(s + (w_inside ? 1 : 0)), k};
+				return result;
+			}
+			// both candidates are inside: the closer one, ties to even
+			carrier_type const mid = 4 * s + 2;
+			bool const round_up = vb > mid || (vb == mid && (s & 1) != 0);
+			result_type const result = {static_cast<carrier_type>(s + (round_up ? 1 : 0)), k};
+			return result;
+		}
+		template<typename FloatType>
+		inline SPROUT_CXX14_CONSTEXPR sprout::detail::shortest_float_decimal<typename sprout::detail::shortest_float_traits<FloatType>::carrier_type>
+		shortest_float_to_decimal(typename sprout::detail::shortest_float_traits<FloatType>::carrier_type bits) {
+			sprout::detail::shortest_float_decimal<typename sprout::detail::shortest_float_traits<FloatType>::carrier_type> result
+				= sprout::detail::shortest_float_to_decimal_impl<FloatType>(bits);
+			while (result.significand % 10 == 0) {
+				result.significand /= 10;
+				++result.exponent;
+			}
+			return result;
+		}
+
+		//
+		// shortest_float_format
+		//
+		//	How a value is printed: the printf %f or %e form, whichever is
+		//	shorter (%f on a tie), with the fewest digits that round-trip.
+		//
+		template<typename UInt>
+		struct shortest_float_format {
+		public:
+			UInt significand;
+			int exponent;
+			int digits;
+			int length;
+			int special;	// 0: finite, 1: inf, 2: nan
+			bool negative;
+			bool scientific;
+		};
+
+		template<typename FloatType>
+		inline SPROUT_CXX14_CONSTEXPR sprout::detail::shortest_float_format<typename sprout::detail::shortest_float_traits<FloatType>::carrier_type>
+		shortest_float_prepare(FloatType val) {
+			typedef typename sprout::detail::shortest_float_traits<FloatType>::carrier_type carrier_type;
+			sprout::detail::shortest_float_format<carrier_type> f = {0, 0, 1, 0, 0, sprout::math::signbit(val), false};
+			int const sign = f.negative ? 1 : 0;
+			if (sprout::math::isnan(val) || sprout::math::isinf(val)) {
+				f.special = sprout::math::isnan(val) ? 2 : 1;
+				f.length = sign + 3;
+				return f;
+			}
+			if (val == 0) {
+				f.length = sign + 1;
+				return f;
+			}
+			sprout::detail::shortest_float_decimal<carrier_type> const d
+				= sprout::detail::shortest_float_to_decimal<FloatType>(sprout::detail::shortest_float_bits(val));
+			f.significand = d.significand;
+			f.exponent = d.exponent;
+			for (carrier_type p = 10; f.digits < sprout::numeric_limits<FloatType>::max_digits10 && d.significand >= p; p *= 10) {
+				++f.digits;
+			}
+			int const e10 = f.exponent + f.digits - 1;
+			int const scientific_length = f.digits + (f.digits > 1 ? 1 : 0) + 2 + (e10 >= 100 || e10 <= -100 ? 3 : 2);
+			int const fixed_length = f.exponent >= 0 ? f.digits + f.exponent
+				: e10 >= 0 ? f.digits + 1
+				: f.digits + 1 - e10
+				;
+			f.scientific = scientific_length < fixed_length;
+			f.length = sign + (f.scientific ? scientific_length : fixed_length);
+			return f;
+		}
+
+		//
+		// shortest_float_write_digits
+		//
+		//	Writes the n digits of val, with a decimal point before digit number
+		//	point (none when point == n), and returns the end. The digits are
+		//	produced eight at a time in 32-bit arithmetic, two per division.
+		//
+		template<typename Elem>
+		inline SPROUT_CXX14_CONSTEXPR void
+		shortest_float_write_digits32(Elem* last, std::uint32_t val, int n) {
+			sprout::detail::write_decimal_digits(last, val, n);
+		}
+		template<typename Elem, typename UInt>
+		inline SPROUT_CXX14_CONSTEXPR Elem*
+		shortest_float_write_digits(Elem* out, UInt val, int n, int point) {
+			Elem* const last = out + n + (point < n ? 1 : 0);
+			if (n > 8) {
+				sprout::detail::shortest_float_write_digits32(last, static_cast<std::uint32_t>(val % 100000000), 8);
+				sprout::detail::shortest_float_write_digits32(last - 8, static_cast<std::uint32_t>(val / 100000000), n - 8);
+			} else {
+				sprout::detail::shortest_float_write_digits32(last, static_cast<std::uint32_t>(val), n);
+			}
+			if (point < n) {
+				for (int i = 0; i != point; ++i) {
+					out[i] = out[i + 1];
+				}
+				out[point] = SPROUT_CHAR_LITERAL('.', Elem);
+			}
+			return last;
+		}
+
+		//
+		// shortest_float_write
+		//
+		//	Writes f.length characters and returns the end.
+		//
+		template<typename Elem, typename UInt>
+		inline SPROUT_CXX14_CONSTEXPR Elem*
+		shortest_float_write(Elem* out, sprout::detail::shortest_float_format<UInt> const& f) {
+			if (f.negative) {
+				*out++ = SPROUT_CHAR_LITERAL('-', Elem);
+			}
+			if (f.special != 0) {
+				*out++ = f.special == 1 ? SPROUT_CHAR_LITERAL('i', Elem) : SPROUT_CHAR_LITERAL('n', Elem);
+				*out++ = f.special == 1 ? SPROUT_CHAR_LITERAL('n', Elem) : SPROUT_CHAR_LITERAL('a', Elem);
+				*out++ = f.special == 1 ? SPROUT_CHAR_LITERAL('f', Elem) : SPROUT_CHAR_LITERAL('n', Elem);
+				return out;
+			}
+			int const e10 = f.exponent + f.digits - 1;
+			if (f.scientific) {
+				out = sprout::detail::shortest_float_write_digits(out, f.significand, f.digits, 1 < f.digits ? 1 : f.digits);
+				*out++ = SPROUT_CHAR_LITERAL('e', Elem);
+				*out++ = e10 < 0 ? SPROUT_CHAR_LITERAL('-', Elem) : SPROUT_CHAR_LITERAL('+', Elem);
+				int const a = e10 < 0 ? -e10 : e10;
+				return sprout::detail::shortest_float_write_digits(out, a, a >= 100 ? 3 : 2, a >= 100 ? 3 : 2);
+			}
+			if (f.exponent >= 0) {
+				out = sprout::detail::shortest_float_write_digits(out, f.significand, f.digits, f.digits);
+				for (int i = 0; i != f.exponent; ++i) {
+					*out++ = SPROUT_CHAR_LITERAL('0', Elem);
+				}
+				return out;
+			}
+			if (e10 >= 0) {
+				return sprout::detail::shortest_float_write_digits(out, f.significand, f.digits, e10 + 1);
+			}
+			*out++ = SPROUT_CHAR_LITERAL('0', Elem);
+			*out++ = SPROUT_CHAR_LITERAL('.', Elem);
+			for (int i = -1; i != e10; --i) {
+				*out++ = SPROUT_CHAR_LITERAL('0', Elem);
+			}
+			return sprout::detail::shortest_float_write_digits(out, f.significand, f.digits, f.digits);
+		}
+	}	// namespace detail
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_CHARCONV_DETAIL_SHORTEST_FLOAT_HPP
@@ -0,0 +1,64 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_CHARCONV_DETAIL_UMUL128_HPP
+#define SPROUT_CHARCONV_DETAIL_UMUL128_HPP
+
+#include <sprout/config.hpp>
+#include <sprout/cstdint.hpp>
+
+namespace sprout {
+	namespace detail {
+		//
+		// uint128_parts
+		//
+		struct uint128_parts {
+		public:
+			std::uint64_t hi;
+			std::uint64_t lo;
+		};
+
+		//
+		// umul128
+		//
+		//	Full 64x64 -> 128 bit product.
+		//
+		inline SPROUT_CXX14_CONSTEXPR sprout::detail::uint128_parts
+		umul128(std::uint64_t a, std::uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+			unsigned __int128 const r = static_cast<unsigned __int128>(a) * b;
+			sprout::detail::uint128_parts result = {static_cast<std::uint64_t>(r >> 64), static_cast<std::uint64_t>(r)};
+			return result;
+#else
+			std::uint64_t const a_lo = a & UINT64_C(0xFFFFFFFF);
+			std::uint64_t const a_hi = a >> 32;
+			std::uint64_t const b_lo = b & UINT64_C(0xFFFFFFFF);
+			std::uint64_t const b_hi = b >> 32;
+			std::uint64_t const ll = a_lo * b_lo;
+			std::uint64_t const lh = a_lo * b_hi;
+			std::uint64_t const hl = a_hi * b_lo;
+			std::uint64_t const hh = a_hi * b_hi;
+			std::uint64_t const mid = (ll >> 32) + (lh & UINT64_C(0xFFFFFFFF)) + (hl & UINT64_C(0xFFFFFFFF));
+			sprout::detail::uint128_parts result = {
+				hh + (lh >> 32) + (hl >> 32) + (mid >> 32),
+				(mid << 32) | (ll & UINT64_C(0xFFFFFFFF))
+			};
+			return result;
+#endif
+		}
+
+		//
+		// umul128_upper64
+		//
+		inline SPROUT_CXX14_CONSTEXPR std::uint64_t
+		umul128_upper64(std::uint64_t a, std::uint64_t b) {
+			return sprout::detail::umul128(a, b).hi;
+		}
+	}	// namespace detail
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_CHARCONV_DETAIL_UMUL128_HPP
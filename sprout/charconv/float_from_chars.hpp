@@ -0,0 +1,45 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_CHARCONV_FLOAT_FROM_CHARS_HPP
+#define SPROUT_CHARCONV_FLOAT_FROM_CHARS_HPP
+
+#include <sprout/config.hpp>
+#include <sprout/type_traits/enabler_if.hpp>
+#include <sprout/utility/string_view/string_view.hpp>
+#include <sprout/charconv/from_chars_result.hpp>
+#include <sprout/charconv/detail/shortest_float.hpp>
+#include <sprout/charconv/detail/decimal_to_float.hpp>
+
+namespace sprout {
+	//
+	// from_chars
+	//
+	//	Correctly rounded float or double from decimal text, as std::from_chars
+	//	with chars_format::general: an optional '-', no leading whitespace or
+	//	'+', and inf/infinity/nan in any case. On invalid_argument or
+	//	result_out_of_range the value is left unmodified.
+	//
+	template<
+		typename Elem, typename FloatType,
+		typename sprout::enabler_if<sprout::detail::is_shortest_float<FloatType>::value>::type = sprout::enabler
+	>
+	inline SPROUT_CXX14_CONSTEXPR sprout::basic_from_chars_result<Elem>
+	from_chars(Elem const* first, Elem const* last, FloatType& value) {
+		return sprout::detail::decimal_to_float(first, last, value);
+	}
+	template<
+		typename Elem, typename Traits, typename FloatType,
+		typename sprout::enabler_if<sprout::detail::is_shortest_float<FloatType>::value>::type = sprout::enabler
+	>
+	inline SPROUT_CXX14_CONSTEXPR sprout::basic_from_chars_result<Elem>
+	from_chars(sprout::basic_string_view<Elem, Traits> const& str, FloatType& value) {
+		return sprout::detail::decimal_to_float(str.data(), str.data() + str.size(), value);
+	}
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_CHARCONV_FLOAT_FROM_CHARS_HPP
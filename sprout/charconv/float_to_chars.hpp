@@ -0,0 +1,42 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_CHARCONV_FLOAT_TO_CHARS_HPP
+#define SPROUT_CHARCONV_FLOAT_TO_CHARS_HPP
+
+#include <system_error>
+#include <sprout/config.hpp>
+#include <sprout/type_traits/enabler_if.hpp>
+#include <sprout/charconv/to_chars_result.hpp>
+#include <sprout/charconv/detail/shortest_float.hpp>
+
+namespace sprout {
+	//
+	// to_chars
+	//
+	//	Shortest round-trip form of a float or double, as std::to_chars without
+	//	a format: %f or %e, whichever is shorter. Nothing is written and
+	//	value_too_large is reported when the result does not fit.
+	//
+	template<
+		typename FloatType,
+		typename sprout::enabler_if<sprout::detail::is_shortest_float<FloatType>::value>::type = sprout::enabler
+	>
+	inline SPROUT_CXX14_CONSTEXPR sprout::to_chars_result
+	to_chars(char* first, char* last, FloatType value) {
+		typedef typename sprout::detail::shortest_float_traits<FloatType>::carrier_type carrier_type;
+		sprout::detail::shortest_float_format<carrier_type> const f = sprout::detail::shortest_float_prepare(value);
+		if (last - first < f.length) {
+			sprout::to_chars_result const result = {last, std::errc::value_too_large};
+			return result;
+		}
+		sprout::to_chars_result const result = {sprout::detail::shortest_float_write(first, f), std::errc()};
+		return result;
+	}
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_CHARCONV_FLOAT_TO_CHARS_HPP
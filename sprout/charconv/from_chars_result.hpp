@@ -0,0 +1,28 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_CHARCONV_FROM_CHARS_RESULT_HPP
+#define SPROUT_CHARCONV_FROM_CHARS_RESULT_HPP
+
+#include <system_error>
+#include <sprout/config.hpp>
+
+namespace sprout {
+	//
+	// basic_from_chars_result
+	// from_chars_result
+	//
+	template<typename Elem>
+	struct basic_from_chars_result {
+	public:
+		Elem const* ptr;
+		std::errc ec;
+	};
+	typedef sprout::basic_from_chars_result<char> from_chars_result;
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_CHARCONV_FROM_CHARS_RESULT_HPP
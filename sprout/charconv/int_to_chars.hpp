@@ -0,0 +1,93 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_CHARCONV_INT_TO_CHARS_HPP
+#define SPROUT_CHARCONV_INT_TO_CHARS_HPP
+
+#include <type_traits>
+#include <system_error>
+#include <sprout/config.hpp>
+#include <sprout/type_traits/enabler_if.hpp>
+#include <sprout/type_traits/is_signed.hpp>
+#include <sprout/type_traits/is_unsigned.hpp>
+#include <sprout/detail/char_conversion.hpp>
+#include <sprout/detail/two_digits.hpp>
+#include <sprout/charconv/to_chars_result.hpp>
+
+namespace sprout {
+	namespace detail {
+		template<typename UInt>
+		inline SPROUT_CXX14_CONSTEXPR sprout::to_chars_result
+		unsigned_to_chars(char* first, char* last, UInt value, int base) {
+			int n = 1;
+			if (base == 10) {
+				n = sprout::detail::decimal_digits(value);
+			} else {
+				for (UInt v = value; v >= static_cast<UInt>(base); v /= static_cast<UInt>(base)) {
+					++n;
+				}
+			}
+			if (last - first < n) {
+				sprout::to_chars_result const result = {last, std::errc::value_too_large};
+				return result;
+			}
+			if (base == 10) {
+				sprout::detail::write_decimal_digits(first + n, value, n);
+			} else {
+				for (char* p = first + n; p != first; value /= static_cast<UInt>(base)) {
+					*--p = sprout::detail::int_to_char<char>(static_cast<int>(value % static_cast<UInt>(base)), base);
+				}
+			}
+			sprout::to_chars_result const result = {first + n, std::errc()};
+			return result;
+		}
+	}	// namespace detail
+
+	//
+	// to_chars
+	//
+	//	Integers in base 2 to 36, as std::to_chars: lower-case letters, a '-'
+	//	for negative values and no prefix. Nothing is written and
+	//	value_too_large is reported when the result does not fit.
+	//
+	template<
+		typename IntType,
+		typename sprout::enabler_if<
+			std::is_integral<IntType>::value && !std::is_same<IntType, bool>::value && sprout::is_unsigned<IntType>::value
+		>::type = sprout::enabler
+	>
+	inline SPROUT_CXX14_CONSTEXPR sprout::to_chars_result
+	to_chars(char* first, char* last, IntType value, int base = 10) {
+		return sprout::detail::unsigned_to_chars(first, last, value, base);
+	}
+	template<
+		typename IntType,
+		typename sprout::enabler_if<
+			std::is_integral<IntType>::value && sprout::is_signed<IntType>::value
+		>::type = sprout::enabler
+	>
+	inline SPROUT_CXX14_CONSTEXPR sprout::to_chars_result
+	to_chars(char* first, char* last, IntType value, int base = 10) {
+		typedef typename std::make_unsigned<IntType>::type unsigned_type;
+		if (value >= 0) {
+			return sprout::detail::unsigned_to_chars(first, last, static_cast<unsigned_type>(value), base);
+		}
+		if (first == last) {
+			sprout::to_chars_result const result = {last, std::errc::value_too_large};
+			return result;
+		}
+		sprout::to_chars_result const result = sprout::detail::unsigned_to_chars(
+			first + 1, last, static_cast<unsigned_type>(0 - static_cast<unsigned_type>(value)), base
+			);
+		if (result.ec == std::errc()) {
+			*first = '-';
+		}
+		return result;
+	}
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_CHARCONV_INT_TO_CHARS_HPP
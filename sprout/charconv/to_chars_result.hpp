@@ -0,0 +1,25 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_CHARCONV_TO_CHARS_RESULT_HPP
+#define SPROUT_CHARCONV_TO_CHARS_RESULT_HPP
+
+#include <system_error>
+#include <sprout/config.hpp>
+
+namespace sprout {
+	//
+	// to_chars_result
+	//
+	struct to_chars_result {
+	public:
+		char* ptr;
+		std::errc ec;
+	};
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_CHARCONV_TO_CHARS_RESULT_HPP
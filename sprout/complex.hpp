@@ -20,5 +20,6 @@
 #include <sprout/complex/nearest.hpp>
 #include <sprout/complex/literals.hpp>
 #include <sprout/complex/type_traits.hpp>
+#include <sprout/complex/soa.hpp>
 
 #endif	// #ifndef SPROUT_COMPLEX_HPP
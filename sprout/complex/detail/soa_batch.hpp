@@ -0,0 +1,375 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_COMPLEX_DETAIL_SOA_BATCH_HPP
+#define SPROUT_COMPLEX_DETAIL_SOA_BATCH_HPP
+
+#include <type_traits>
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/limits.hpp>
+#include <sprout/bit/ctz.hpp>
+#include <sprout/math/sqrt.hpp>
+#include <sprout/math/atan2.hpp>
+#include <sprout/math/detail/batch.hpp>
+#include <sprout/detail/simd.hpp>
+
+namespace sprout {
+	namespace detail {
+		//
+		// complex_soa_scalar
+		//
+		//	The formulas of the bulk operations; plain products and sums, without the
+		//	infinity and NaN recovery of sprout::norm.
+		//
+		struct complex_soa_scalar {
+		public:
+			template<typename T>
+			static SPROUT_CONSTEXPR T mul_re(T const& ar, T const& ai, T const& br, T const& bi) {
+				return ar * br - ai * bi;
+			}
+			template<typename T>
+			static SPROUT_CONSTEXPR T mul_im(T const& ar, T const& ai, T const& br, T const& bi) {
+				return ar * bi + ai * br;
+			}
+			template<typename T>
+			static SPROUT_CONSTEXPR T norm(T const& re, T const& im) {
+				return re * re + im * im;
+			}
+			template<typename T>
+			static SPROUT_CONSTEXPR T abs(T const& re, T const& im) {
+				return sprout::math::sqrt(norm(re, im));
+			}
+			template<typename T>
+			static SPROUT_CONSTEXPR T arg(T const& re, T const& im) {
+				return sprout::math::atan2(im, re);
+			}
+		};
+
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+		//
+		// complex_soa_sse2
+		// complex_soa_avx2
+		//
+		//	sprout::math::detail::batch_sse2 and batch_avx2 with fused multiply-add,
+		//	which is a separate multiply and add without FMA.
+		//
+		struct complex_soa_sse2
+			: public sprout::math::detail::batch_sse2
+		{
+		public:
+			// a * b + c
+			static type fmadd(type a, type b, type c) {
+#	if defined(SPROUT_DETAIL_SIMD_FMA)
+				return _mm_fmadd_pd(a, b, c);
+#	else
+				return add(mul(a, b), c);
+#	endif
+			}
+			// c - a * b
+			static type fnmadd(type a, type b, type c) {
+#	if defined(SPROUT_DETAIL_SIMD_FMA)
+				return _mm_fnmadd_pd(a, b, c);
+#	else
+				return sub(c, mul(a, b));
+#	endif
+			}
+		};
+#	if defined(SPROUT_DETAIL_SIMD_AVX2)
+		struct complex_soa_avx2
+			: public sprout::math::detail::batch_avx2
+		{
+		public:
+			static type fmadd(type a, type b, type c) {
+#		if defined(SPROUT_DETAIL_SIMD_FMA)
+				return _mm256_fmadd_pd(a, b, c);
+#		else
+				return add(mul(a, b), c);
+#		endif
+			}
+			static type fnmadd(type a, type b, type c) {
+#		if defined(SPROUT_DETAIL_SIMD_FMA)
+				return _mm256_fnmadd_pd(a, b, c);
+#		else
+				return sub(c, mul(a, b));
+#		endif
+			}
+		};
+#	endif
+
+		//
+		// complex_soa_atan2
+		//
+		//	atan2(y, x) from atan(t), t = min(|x|, |y|) / max(|x|, |y|) in [0, 1]:
+		//	t > tan(pi/8) is moved to (t - 1) / (t + 1), and the result is reflected
+		//	about pi/4, pi/2 and pi by the octant. The polynomial is the one of
+		//	sprout::math::atan. Lanes with a zero, infinite or NaN denominator are
+		//	set in special.
+		//
+		template<typename Ops>
+		inline typename Ops::type
+		complex_soa_atan2(typename Ops::type y, typename Ops::type x, typename Ops::type& special) {
+			typedef typename Ops::type type;
+			type const ax = sprout::math::detail::batch_abs<Ops>(x);
+			type const ay = sprout::math::detail::batch_abs<Ops>(y);
+			type const swap = Ops::lt(ax, ay);
+			type const mn = Ops::select(swap, ax, ay);
+			type const mx = Ops::select(swap, ay, ax);
+			special = Ops::or_(
+				Ops::or_(Ops::nlt(ax, Ops::set1(sprout::numeric_limits<double>::infinity())), Ops::nlt(ay, Ops::set1(sprout::numeric_limits<double>::infinity()))),
+				Ops::nlt(Ops::set1(0), mx)
+				);
+			type const t0 = Ops::div(mn, mx);
+			type const big = Ops::lt(Ops::set1(4.14213562373095034e-01), t0);
+			type const t = Ops::select(big, Ops::div(Ops::sub(t0, Ops::set1(1)), Ops::add(t0, Ops::set1(1))), t0);
+			type const z = Ops::mul(t, t);
+			type const w = Ops::mul(z, z);
+			type const s1 = Ops::mul(z, Ops::add(Ops::mul(Ops::add(Ops::mul(Ops::add(Ops::mul(Ops::add(Ops::mul(Ops::add(Ops::mul(
+				Ops::set1(1.62858201153657823623e-02), w),
+				Ops::set1(4.97687799461593236017e-02)), w),
+				Ops::set1(6.66107313738753120669e-02)), w),
+				Ops::set1(9.09088713343650656196e-02)), w),
+				Ops::set1(1.42857142725034663711e-01)), w),
+				Ops::set1(3.33333333333329318027e-01)
+				));
+			type const s2 = Ops::mul(w, Ops::add(Ops::mul(Ops::add(Ops::mul(Ops::add(Ops::mul(Ops::add(Ops::mul(
+				Ops::set1(-3.65315727442169155270e-02), w),
+				Ops::set1(-5.83357013379057348645e-02)), w),
+				Ops::set1(-7.69187620504482999495e-02)), w),
+				Ops::set1(-1.11111104054623557880e-01)), w),
+				Ops::set1(-1.99999999998764832476e-01)
+				));
+			type const p = Ops::sub(t, Ops::mul(t, Ops::add(s1, s2)));
+			// atan(t0) = pi/4 + atan(t)
+			type r = Ops::select(big, Ops::add(Ops::set1(7.85398163397448278999e-01), Ops::add(p, Ops::set1(3.06161699786838301793e-17))), p);
+			// |y| > |x|: pi/2 - r
+			r = Ops::select(swap, Ops::add(Ops::sub(Ops::set1(1.57079632679489655800e+00), r), Ops::set1(6.12323399573676603587e-17)), r);
+			// x < 0: pi - r
+			r = Ops::select(Ops::lt(x, Ops::set1(0)), Ops::add(Ops::sub(Ops::set1(3.14159265358979311600e+00), r), Ops::set1(1.22464679914735317720e-16)), r);
+			return Ops::or_(r, Ops::and_(y, Ops::set1(-0.0)));
+		}
+#endif
+
+		//
+		// complex_soa_cmul
+		// complex_soa_cmadd
+		// complex_soa_conj
+		// complex_soa_norm
+		// complex_soa_abs
+		// complex_soa_arg
+		//
+		//	Kernels over real and imaginary planes: vector<Ops>(i) computes Ops::width
+		//	elements from i, scalar(i) one element. The results may be written over
+		//	the operands.
+		//
+		template<typename T>
+		struct complex_soa_cmul {
+		public:
+			T const* ar;
+			T const* ai;
+			T const* br;
+			T const* bi;
+			T* rr;
+			T* ri;
+		public:
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+			template<typename Ops>
+			void vector(std::size_t i) const {
+				typename Ops::type const xr = Ops::load(ar + i);
+				typename Ops::type const xi = Ops::load(ai + i);
+				typename Ops::type const yr = Ops::load(br + i);
+				typename Ops::type const yi = Ops::load(bi + i);
+				Ops::store(rr + i, Ops::fmadd(xr, yr, Ops::xor_(Ops::mul(xi, yi), Ops::set1(-0.0))));
+				Ops::store(ri + i, Ops::fmadd(xr, yi, Ops::mul(xi, yr)));
+			}
+#endif
+			void scalar(std::size_t i) const {
+				T const re = sprout::detail::complex_soa_scalar::mul_re(ar[i], ai[i], br[i], bi[i]);
+				T const im = sprout::detail::complex_soa_scalar::mul_im(ar[i], ai[i], br[i], bi[i]);
+				rr[i] = re;
+				ri[i] = im;
+			}
+		};
+		template<typename T>
+		struct complex_soa_cmadd {
+		public:
+			T const* ar;
+			T const* ai;
+			T const* br;
+			T const* bi;
+			T const* cr;
+			T const* ci;
+			T* rr;
+			T* ri;
+		public:
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+			template<typename Ops>
+			void vector(std::size_t i) const {
+				typename Ops::type const xr = Ops::load(ar + i);
+				typename Ops::type const xi = Ops::load(ai + i);
+				typename Ops::type const yr = Ops::load(br + i);
+				typename Ops::type const yi = Ops::load(bi + i);
+				typename Ops::type const zr = Ops::load(cr + i);
+				typename Ops::type const zi = Ops::load(ci + i);
+				Ops::store(rr + i, Ops::fmadd(xr, yr, Ops::fnmadd(xi, yi, zr)));
+				Ops::store(ri + i, Ops::fmadd(xr, yi, Ops::fmadd(xi, yr, zi)));
+			}
+#endif
+			void scalar(std::size_t i) const {
+				T const re = sprout::detail::complex_soa_scalar::mul_re(ar[i], ai[i], br[i], bi[i]) + cr[i];
+				T const im = sprout::detail::complex_soa_scalar::mul_im(ar[i], ai[i], br[i], bi[i]) + ci[i];
+				rr[i] = re;
+				ri[i] = im;
+			}
+		};
+		template<typename T>
+		struct complex_soa_conj {
+		public:
+			T const* ar;
+			T const* ai;
+			T* rr;
+			T* ri;
+		public:
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+			template<typename Ops>
+			void vector(std::size_t i) const {
+				typename Ops::type const xr = Ops::load(ar + i);
+				typename Ops::type const xi = Ops::load(ai + i);
+				Ops::store(rr + i, xr);
+				Ops::store(ri + i, Ops::xor_(xi, Ops::set1(-0.0)));
+			}
+#endif
+			void scalar(std::size_t i) const {
+				rr[i] = ar[i];
+				ri[i] = -ai[i];
+			}
+		};
+		template<typename T>
+		struct complex_soa_norm {
+		public:
+			T const* ar;
+			T const* ai;
+			T* r;
+		public:
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+			template<typename Ops>
+			void vector(std::size_t i) const {
+				typename Ops::type const xr = Ops::load(ar + i);
+				typename Ops::type const xi = Ops::load(ai + i);
+				Ops::store(r + i, Ops::fmadd(xr, xr, Ops::mul(xi, xi)));
+			}
+#endif
+			void scalar(std::size_t i) const {
+				r[i] = sprout::detail::complex_soa_scalar::norm(ar[i], ai[i]);
+			}
+		};
+		template<typename T>
+		struct complex_soa_abs {
+		public:
+			T const* ar;
+			T const* ai;
+			T* r;
+		public:
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+			template<typename Ops>
+			void vector(std::size_t i) const {
+				typename Ops::type const xr = Ops::load(ar + i);
+				typename Ops::type const xi = Ops::load(ai + i);
+				Ops::store(r + i, Ops::sqrt(Ops::fmadd(xr, xr, Ops::mul(xi, xi))));
+			}
+#endif
+			void scalar(std::size_t i) const {
+				r[i] = sprout::detail::complex_soa_scalar::abs(ar[i], ai[i]);
+			}
+		};
+		template<typename T>
+		struct complex_soa_arg {
+		public:
+			T const* ar;
+			T const* ai;
+			T* r;
+		public:
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+			template<typename Ops>
+			void vector(std::size_t i) const {
+				typename Ops::type special;
+				typename Ops::type const v = sprout::detail::complex_soa_atan2<Ops>(Ops::load(ai + i), Ops::load(ar + i), special);
+				// r may be ar or ai: the special lanes are computed before the store
+				unsigned const m = Ops::movemask(special);
+				T fix[Ops::width];
+				for (unsigned k = m; k != 0; k &= k - 1) {
+					fix[sprout::ctz(k)] = sprout::detail::complex_soa_scalar::arg(ar[i + sprout::ctz(k)], ai[i + sprout::ctz(k)]);
+				}
+				Ops::store(r + i, v);
+				for (unsigned k = m; k != 0; k &= k - 1) {
+					r[i + sprout::ctz(k)] = fix[sprout::ctz(k)];
+				}
+			}
+#endif
+			void scalar(std::size_t i) const {
+				r[i] = sprout::detail::complex_soa_scalar::arg(ar[i], ai[i]);
+			}
+		};
+
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+		//
+		// complex_soa_block
+		//
+		//	Runs the vector kernel over whole blocks of Ops::width elements from i and
+		//	returns the index of the first element left.
+		//
+		template<typename Ops, typename Kernel>
+		inline std::size_t
+		complex_soa_block(Kernel const& kernel, std::size_t i, std::size_t n) {
+			for (; i + Ops::width <= n; i += Ops::width) {
+				kernel.template vector<Ops>(i);
+			}
+			return i;
+		}
+#endif
+
+		//
+		// complex_soa_run
+		//
+		//	Runtime driver of the kernels above; the vector kernels take double and
+		//	float planes.
+		//
+		template<typename Kernel>
+		inline std::size_t
+		complex_soa_run_vector(Kernel const&, std::size_t, std::false_type) {
+			return 0;
+		}
+		template<typename Kernel>
+		inline std::size_t
+		complex_soa_run_vector(Kernel const& kernel, std::size_t n, std::true_type) {
+			std::size_t i = 0;
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+#	if defined(SPROUT_DETAIL_SIMD_AVX2)
+			i = sprout::detail::complex_soa_block<sprout::detail::complex_soa_avx2>(kernel, i, n);
+#	endif
+			i = sprout::detail::complex_soa_block<sprout::detail::complex_soa_sse2>(kernel, i, n);
+#else
+			static_cast<void>(kernel);
+			static_cast<void>(n);
+#endif
+			return i;
+		}
+		template<typename T, template<typename> class Kernel>
+		inline void
+		complex_soa_run(Kernel<T> const& kernel, std::size_t n) {
+			std::size_t i = sprout::detail::complex_soa_run_vector(
+				kernel, n,
+				std::integral_constant<bool, std::is_same<T, double>::value || std::is_same<T, float>::value>()
+				);
+			for (; i < n; ++i) {
+				kernel.scalar(i);
+			}
+		}
+	}	// namespace detail
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_COMPLEX_DETAIL_SOA_BATCH_HPP
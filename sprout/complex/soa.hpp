@@ -0,0 +1,622 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_COMPLEX_SOA_HPP
+#define SPROUT_COMPLEX_SOA_HPP
+
+#include <iterator>
+#include <type_traits>
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/index_tuple/metafunction.hpp>
+#include <sprout/array/array.hpp>
+#include <sprout/iterator/iterator.hpp>
+#include <sprout/utility/swap.hpp>
+#include <sprout/complex/complex.hpp>
+#include <sprout/complex/detail/soa_batch.hpp>
+#include <sprout/detail/simd.hpp>
+
+namespace sprout {
+	//
+	// complex_soa_iterator
+	//
+	//	Presents a real and an imaginary plane as a range of sprout::complex;
+	//	dereferencing builds the complex value, so the planes are never copied.
+	//
+	template<typename T>
+	class complex_soa_iterator
+		: public sprout::iterator<
+			std::random_access_iterator_tag,
+			sprout::complex<typename std::remove_const<T>::type>,
+			std::ptrdiff_t,
+			void,
+			sprout::complex<typename std::remove_const<T>::type>
+		>
+	{
+	public:
+		typedef std::random_access_iterator_tag iterator_category;
+		typedef sprout::complex<typename std::remove_const<T>::type> value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef void pointer;
+		typedef value_type reference;
+	private:
+		T* re_;
+		T* im_;
+	public:
+		SPROUT_CONSTEXPR complex_soa_iterator()
+			: re_(), im_()
+		{}
+		complex_soa_iterator(complex_soa_iterator const&) = default;
+		SPROUT_CONSTEXPR complex_soa_iterator(T* re, T* im)
+			: re_(re), im_(im)
+		{}
+		template<typename U>
+		SPROUT_CONSTEXPR complex_soa_iterator(complex_soa_iterator<U> const& it)
+			: re_(it.real_base()), im_(it.imag_base())
+		{}
+		SPROUT_CONSTEXPR T* real_base() const {
+			return re_;
+		}
+		SPROUT_CONSTEXPR T* imag_base() const {
+			return im_;
+		}
+		SPROUT_CONSTEXPR reference operator*() const {
+			return value_type(*re_, *im_);
+		}
+		SPROUT_CXX14_CONSTEXPR complex_soa_iterator& operator++() {
+			++re_;
+			++im_;
+			return *this;
+		}
+		SPROUT_CXX14_CONSTEXPR complex_soa_iterator operator++(int) {
+			complex_soa_iterator result(*this);
+			++*this;
+			return result;
+		}
+		SPROUT_CXX14_CONSTEXPR complex_soa_iterator& operator--() {
+			--re_;
+			--im_;
+			return *this;
+		}
+		SPROUT_CXX14_CONSTEXPR complex_soa_iterator operator--(int) {
+			complex_soa_iterator temp(*this);
+			--*this;
+			return temp;
+		}
+		SPROUT_CONSTEXPR complex_soa_iterator operator+(difference_type n) const {
+			return complex_soa_iterator(re_ + n, im_ + n);
+		}
+		SPROUT_CONSTEXPR complex_soa_iterator operator-(difference_type n) const {
+			return complex_soa_iterator(re_ - n, im_ - n);
+		}
+		SPROUT_CXX14_CONSTEXPR complex_soa_iterator& operator+=(difference_type n) {
+			re_ += n;
+			im_ += n;
+			return *this;
+		}
+		SPROUT_CXX14_CONSTEXPR complex_soa_iterator& operator-=(difference_type n) {
+			re_ -= n;
+			im_ -= n;
+			return *this;
+		}
+		SPROUT_CONSTEXPR reference operator[](difference_type n) const {
+			return value_type(re_[n], im_[n]);
+		}
+		SPROUT_CONSTEXPR complex_soa_iterator next() const {
+			return complex_soa_iterator(re_ + 1, im_ + 1);
+		}
+		SPROUT_CONSTEXPR complex_soa_iterator prev() const {
+			return complex_soa_iterator(re_ - 1, im_ - 1);
+		}
+		SPROUT_CXX14_CONSTEXPR void swap(complex_soa_iterator& other) SPROUT_NOEXCEPT {
+			sprout::swap(re_, other.re_);
+			sprout::swap(im_, other.im_);
+		}
+	};
+
+	template<typename T1, typename T2>
+	inline SPROUT_CONSTEXPR bool
+	operator==(sprout::complex_soa_iterator<T1> const& lhs, sprout::complex_soa_iterator<T2> const& rhs) {
+		return lhs.real_base() == rhs.real_base();
+	}
+	template<typename T1, typename T2>
+	inline SPROUT_CONSTEXPR bool
+	operator!=(sprout::complex_soa_iterator<T1> const& lhs, sprout::complex_soa_iterator<T2> const& rhs) {
+		return !(lhs == rhs);
+	}
+	template<typename T1, typename T2>
+	inline SPROUT_CONSTEXPR bool
+	operator<(sprout::complex_soa_iterator<T1> const& lhs, sprout::complex_soa_iterator<T2> const& rhs) {
+		return lhs.real_base() < rhs.real_base();
+	}
+	template<typename T1, typename T2>
+	inline SPROUT_CONSTEXPR bool
+	operator>(sprout::complex_soa_iterator<T1> const& lhs, sprout::complex_soa_iterator<T2> const& rhs) {
+		return rhs < lhs;
+	}
+	template<typename T1, typename T2>
+	inline SPROUT_CONSTEXPR bool
+	operator<=(sprout::complex_soa_iterator<T1> const& lhs, sprout::complex_soa_iterator<T2> const& rhs) {
+		return !(rhs < lhs);
+	}
+	template<typename T1, typename T2>
+	inline SPROUT_CONSTEXPR bool
+	operator>=(sprout::complex_soa_iterator<T1> const& lhs, sprout::complex_soa_iterator<T2> const& rhs) {
+		return !(lhs < rhs);
+	}
+	template<typename T1, typename T2>
+	inline SPROUT_CONSTEXPR typename sprout::complex_soa_iterator<T1>::difference_type
+	operator-(sprout::complex_soa_iterator<T1> const& lhs, sprout::complex_soa_iterator<T2> const& rhs) {
+		return lhs.real_base() - rhs.real_base();
+	}
+	template<typename T>
+	inline SPROUT_CONSTEXPR sprout::complex_soa_iterator<T>
+	operator+(typename sprout::complex_soa_iterator<T>::difference_type n, sprout::complex_soa_iterator<T> const& it) {
+		return it + n;
+	}
+
+	//
+	// swap
+	//
+	template<typename T>
+	inline SPROUT_CXX14_CONSTEXPR void
+	swap(sprout::complex_soa_iterator<T>& lhs, sprout::complex_soa_iterator<T>& rhs) SPROUT_NOEXCEPT {
+		lhs.swap(rhs);
+	}
+
+	//
+	// iterator_next
+	// iterator_prev
+	//
+	template<typename T>
+	inline SPROUT_CONSTEXPR sprout::complex_soa_iterator<T>
+	iterator_next(sprout::complex_soa_iterator<T> const& it) {
+		return it.next();
+	}
+	template<typename T>
+	inline SPROUT_CONSTEXPR sprout::complex_soa_iterator<T>
+	iterator_prev(sprout::complex_soa_iterator<T> const& it) {
+		return it.prev();
+	}
+
+	//
+	// complex_soa
+	//
+	//	N complex values of T stored as a plane of real parts followed by a plane
+	//	of imaginary parts; an aggregate like sprout::array, initialized as
+	//	{{re...}, {im...}}. As a range it is the sequence of sprout::complex<T>.
+	//
+	template<typename T, std::size_t N>
+	class complex_soa {
+	public:
+		typedef sprout::complex<T> value_type;
+		typedef T real_type;
+		typedef value_type reference;
+		typedef value_type const_reference;
+		typedef sprout::complex_soa_iterator<T const> iterator;
+		typedef sprout::complex_soa_iterator<T const> const_iterator;
+		typedef std::size_t size_type;
+		typedef std::ptrdiff_t difference_type;
+	public:
+		SPROUT_STATIC_CONSTEXPR size_type static_size = N;
+	public:
+		real_type re[N];
+		real_type im[N];
+	public:
+		static SPROUT_CONSTEXPR size_type size() SPROUT_NOEXCEPT {
+			return static_size;
+		}
+		static SPROUT_CONSTEXPR bool empty() SPROUT_NOEXCEPT {
+			return false;
+		}
+		SPROUT_CONSTEXPR const_reference operator[](size_type i) const {
+			return value_type(re[i], im[i]);
+		}
+		SPROUT_CXX14_CONSTEXPR void set(size_type i, value_type const& x) {
+			re[i] = x.real();
+			im[i] = x.imag();
+		}
+		SPROUT_CONSTEXPR const_iterator begin() const SPROUT_NOEXCEPT {
+			return const_iterator(re, im);
+		}
+		SPROUT_CONSTEXPR const_iterator end() const SPROUT_NOEXCEPT {
+			return const_iterator(re + N, im + N);
+		}
+		SPROUT_CONSTEXPR const_iterator cbegin() const SPROUT_NOEXCEPT {
+			return begin();
+		}
+		SPROUT_CONSTEXPR const_iterator cend() const SPROUT_NOEXCEPT {
+			return end();
+		}
+		SPROUT_CXX14_CONSTEXPR real_type* real_data() SPROUT_NOEXCEPT {
+			return re;
+		}
+		SPROUT_CONSTEXPR real_type const* real_data() const SPROUT_NOEXCEPT {
+			return re;
+		}
+		SPROUT_CXX14_CONSTEXPR real_type* imag_data() SPROUT_NOEXCEPT {
+			return im;
+		}
+		SPROUT_CONSTEXPR real_type const* imag_data() const SPROUT_NOEXCEPT {
+			return im;
+		}
+	};
+	template<typename T, std::size_t N>
+	SPROUT_CONSTEXPR_OR_CONST typename sprout::complex_soa<T, N>::size_type sprout::complex_soa<T, N>::static_size;
+
+	template<typename T, std::size_t N>
+	inline SPROUT_CONSTEXPR bool
+	operator==(sprout::complex_soa<T, N> const& lhs, sprout::complex_soa<T, N> const& rhs);
+	template<typename T, std::size_t N>
+	inline SPROUT_CONSTEXPR bool
+	operator!=(sprout::complex_soa<T, N> const& lhs, sprout::complex_soa<T, N> const& rhs) {
+		return !(lhs == rhs);
+	}
+
+	//
+	// complex_soa_span
+	//
+	//	A non-owning complex_soa of runtime size: pointers to the two planes and
+	//	the element count. complex_soa_span<T const> is the read-only span.
+	//
+	template<typename T>
+	class complex_soa_span {
+	public:
+		typedef sprout::complex<typename std::remove_const<T>::type> value_type;
+		typedef T real_type;
+		typedef value_type reference;
+		typedef value_type const_reference;
+		typedef sprout::complex_soa_iterator<T> iterator;
+		typedef sprout::complex_soa_iterator<T const> const_iterator;
+		typedef std::size_t size_type;
+		typedef std::ptrdiff_t difference_type;
+	private:
+		T* re_;
+		T* im_;
+		size_type size_;
+	public:
+		SPROUT_CONSTEXPR complex_soa_span() SPROUT_NOEXCEPT
+			: re_(), im_(), size_()
+		{}
+		complex_soa_span(complex_soa_span const&) = default;
+		SPROUT_CONSTEXPR complex_soa_span(T* re, T* im, size_type n) SPROUT_NOEXCEPT
+			: re_(re), im_(im), size_(n)
+		{}
+		template<typename U, std::size_t N>
+		SPROUT_CONSTEXPR complex_soa_span(sprout::complex_soa<U, N>& x) SPROUT_NOEXCEPT
+			: re_(x.re), im_(x.im), size_(N)
+		{}
+		template<typename U, std::size_t N>
+		SPROUT_CONSTEXPR complex_soa_span(sprout::complex_soa<U, N> const& x) SPROUT_NOEXCEPT
+			: re_(x.re), im_(x.im), size_(N)
+		{}
+		template<typename U>
+		SPROUT_CONSTEXPR complex_soa_span(complex_soa_span<U> const& other) SPROUT_NOEXCEPT
+			: re_(other.real_data()), im_(other.imag_data()), size_(other.size())
+		{}
+		SPROUT_CONSTEXPR size_type size() const SPROUT_NOEXCEPT {
+			return size_;
+		}
+		SPROUT_CONSTEXPR bool empty() const SPROUT_NOEXCEPT {
+			return size_ == 0;
+		}
+		SPROUT_CONSTEXPR const_reference operator[](size_type i) const {
+			return value_type(re_[i], im_[i]);
+		}
+		SPROUT_CXX14_CONSTEXPR void set(size_type i, value_type const& x) const {
+			re_[i] = x.real();
+			im_[i] = x.imag();
+		}
+		SPROUT_CONSTEXPR iterator begin() const SPROUT_NOEXCEPT {
+			return iterator(re_, im_);
+		}
+		SPROUT_CONSTEXPR iterator end() const SPROUT_NOEXCEPT {
+			return iterator(re_ + size_, im_ + size_);
+		}
+		SPROUT_CONSTEXPR const_iterator cbegin() const SPROUT_NOEXCEPT {
+			return const_iterator(re_, im_);
+		}
+		SPROUT_CONSTEXPR const_iterator cend() const SPROUT_NOEXCEPT {
+			return const_iterator(re_ + size_, im_ + size_);
+		}
+		SPROUT_CONSTEXPR T* real_data() const SPROUT_NOEXCEPT {
+			return re_;
+		}
+		SPROUT_CONSTEXPR T* imag_data() const SPROUT_NOEXCEPT {
+			return im_;
+		}
+		SPROUT_CONSTEXPR complex_soa_span subspan(size_type offset, size_type count) const SPROUT_NOEXCEPT {
+			return complex_soa_span(re_ + offset, im_ + offset, count);
+		}
+	};
+
+	//
+	// make_complex_soa_span
+	//
+	template<typename T>
+	inline SPROUT_CONSTEXPR sprout::complex_soa_span<T>
+	make_complex_soa_span(T* re, T* im, std::size_t n) {
+		return sprout::complex_soa_span<T>(re, im, n);
+	}
+	template<typename T, std::size_t N>
+	inline SPROUT_CONSTEXPR sprout::complex_soa_span<T>
+	make_complex_soa_span(sprout::complex_soa<T, N>& x) {
+		return sprout::complex_soa_span<T>(x);
+	}
+	template<typename T, std::size_t N>
+	inline SPROUT_CONSTEXPR sprout::complex_soa_span<T const>
+	make_complex_soa_span(sprout::complex_soa<T, N> const& x) {
+		return sprout::complex_soa_span<T const>(x);
+	}
+
+	namespace detail {
+		template<typename T, std::size_t N>
+		inline SPROUT_CONSTEXPR bool
+		complex_soa_equal(sprout::complex_soa<T, N> const& lhs, sprout::complex_soa<T, N> const& rhs, std::size_t i) {
+			return i == N || (lhs.re[i] == rhs.re[i] && lhs.im[i] == rhs.im[i] && sprout::detail::complex_soa_equal(lhs, rhs, i + 1));
+		}
+		template<typename T, std::size_t N, sprout::index_t... Indexes>
+		inline SPROUT_CONSTEXPR sprout::complex_soa<T, N>
+		make_complex_soa_impl(sprout::array<sprout::complex<T>, N> const& x, sprout::index_tuple<Indexes...>) {
+			return sprout::complex_soa<T, N>{{x[Indexes].real()...}, {x[Indexes].imag()...}};
+		}
+
+		template<typename T, std::size_t N, sprout::index_t... Indexes>
+		inline SPROUT_CONSTEXPR sprout::complex_soa<T, N>
+		cmul_scalar(sprout::complex_soa<T, N> const& a, sprout::complex_soa<T, N> const& b, sprout::index_tuple<Indexes...>) {
+			return sprout::complex_soa<T, N>{
+				{sprout::detail::complex_soa_scalar::mul_re(a.re[Indexes], a.im[Indexes], b.re[Indexes], b.im[Indexes])...},
+				{sprout::detail::complex_soa_scalar::mul_im(a.re[Indexes], a.im[Indexes], b.re[Indexes], b.im[Indexes])...}
+				};
+		}
+		template<typename T, std::size_t N>
+		inline sprout::complex_soa<T, N>
+		cmul_vector(sprout::complex_soa<T, N> const& a, sprout::complex_soa<T, N> const& b) {
+			sprout::complex_soa<T, N> result;
+			sprout::detail::complex_soa_cmul<T> const kernel = {a.re, a.im, b.re, b.im, result.re, result.im};
+			sprout::detail::complex_soa_run(kernel, N);
+			return result;
+		}
+		template<typename T, std::size_t N, sprout::index_t... Indexes>
+		inline SPROUT_CONSTEXPR sprout::complex_soa<T, N>
+		cmadd_scalar(
+			sprout::complex_soa<T, N> const& a, sprout::complex_soa<T, N> const& b, sprout::complex_soa<T, N> const& c,
+			sprout::index_tuple<Indexes...>
+			)
+		{
+			return sprout::complex_soa<T, N>{
+				{(sprout::detail::complex_soa_scalar::mul_re(a.re[Indexes], a.im[Indexes], b.re[Indexes], b.im[Indexes]) + c.re[Indexes])...},
+				{(sprout::detail::complex_soa_scalar::mul_im(a.re[Indexes], a.im[Indexes], b.re[Indexes], b.im[Indexes]) + c.im[Indexes])...}
+				};
+		}
+		template<typename T, std::size_t N>
+		inline sprout::complex_soa<T, N>
+		cmadd_vector(sprout::complex_soa<T, N> const& a, sprout::complex_soa<T, N> const& b, sprout::complex_soa<T, N> const& c) {
+			sprout::complex_soa<T, N> result;
+			sprout::detail::complex_soa_cmadd<T> const kernel = {a.re, a.im, b.re, b.im, c.re, c.im, result.re, result.im};
+			sprout::detail::complex_soa_run(kernel, N);
+			return result;
+		}
+		template<typename T, std::size_t N, sprout::index_t... Indexes>
+		inline SPROUT_CONSTEXPR sprout::complex_soa<T, N>
+		conj_scalar(sprout::complex_soa<T, N> const& a, sprout::index_tuple<Indexes...>) {
+			return sprout::complex_soa<T, N>{{a.re[Indexes]...}, {-a.im[Indexes]...}};
+		}
+		template<typename T, std::size_t N>
+		inline sprout::complex_soa<T, N>
+		conj_vector(sprout::complex_soa<T, N> const& a) {
+			sprout::complex_soa<T, N> result;
+			sprout::detail::complex_soa_conj<T> const kernel = {a.re, a.im, result.re, result.im};
+			sprout::detail::complex_soa_run(kernel, N);
+			return result;
+		}
+
+		struct complex_soa_norm_op {
+		public:
+			template<typename T>
+			static SPROUT_CONSTEXPR T scalar(T const& re, T const& im) {
+				return sprout::detail::complex_soa_scalar::norm(re, im);
+			}
+			template<typename T>
+			struct kernel {
+			public:
+				typedef sprout::detail::complex_soa_norm<T> type;
+			};
+		};
+		struct complex_soa_abs_op {
+		public:
+			template<typename T>
+			static SPROUT_CONSTEXPR T scalar(T const& re, T const& im) {
+				return sprout::detail::complex_soa_scalar::abs(re, im);
+			}
+			template<typename T>
+			struct kernel {
+			public:
+				typedef sprout::detail::complex_soa_abs<T> type;
+			};
+		};
+		struct complex_soa_arg_op {
+		public:
+			template<typename T>
+			static SPROUT_CONSTEXPR T scalar(T const& re, T const& im) {
+				return sprout::detail::complex_soa_scalar::arg(re, im);
+			}
+			template<typename T>
+			struct kernel {
+			public:
+				typedef sprout::detail::complex_soa_arg<T> type;
+			};
+		};
+		template<typename Op, typename T, std::size_t N, sprout::index_t... Indexes>
+		inline SPROUT_CONSTEXPR sprout::array<T, N>
+		complex_soa_real_scalar(sprout::complex_soa<T, N> const& a, sprout::index_tuple<Indexes...>) {
+			return sprout::array<T, N>{{Op::scalar(a.re[Indexes], a.im[Indexes])...}};
+		}
+		template<typename Op, typename T, std::size_t N>
+		inline sprout::array<T, N>
+		complex_soa_real_vector(sprout::complex_soa<T, N> const& a) {
+			sprout::array<T, N> result;
+			typename Op::template kernel<T>::type const kernel = {a.re, a.im, result.data()};
+			sprout::detail::complex_soa_run(kernel, N);
+			return result;
+		}
+		template<typename Op, typename T, std::size_t N>
+		inline SPROUT_CONSTEXPR sprout::array<T, N>
+		complex_soa_real(sprout::complex_soa<T, N> const& a) {
+#if defined(SPROUT_DETAIL_HAS_IS_CONSTANT_EVALUATED)
+			return __builtin_is_constant_evaluated() ? sprout::detail::complex_soa_real_scalar<Op>(a, sprout::make_index_tuple<N>::make())
+				: sprout::detail::complex_soa_real_vector<Op>(a)
+				;
+#else
+			return sprout::detail::complex_soa_real_scalar<Op>(a, sprout::make_index_tuple<N>::make());
+#endif
+		}
+	}	// namespace detail
+
+	template<typename T, std::size_t N>
+	inline SPROUT_CONSTEXPR bool
+	operator==(sprout::complex_soa<T, N> const& lhs, sprout::complex_soa<T, N> const& rhs) {
+		return sprout::detail::complex_soa_equal(lhs, rhs, 0);
+	}
+
+	//
+	// make_complex_soa
+	//
+	//	Splits an array of sprout::complex into planes.
+	//
+	template<typename T, std::size_t N>
+	inline SPROUT_CONSTEXPR sprout::complex_soa<T, N>
+	make_complex_soa(sprout::array<sprout::complex<T>, N> const& x) {
+		return sprout::detail::make_complex_soa_impl(x, sprout::make_index_tuple<N>::make());
+	}
+
+	//
+	// cmul
+	// cmadd
+	// conj
+	// norm
+	// abs
+	// arg
+	//
+	//	Elementwise a * b, a * b + c, conj(a), norm(a), abs(a) = sqrt(norm(a)) and
+	//	arg(a). They are the scalar formulas in constant expressions and the vector
+	//	kernels of sprout/complex/detail/soa_batch.hpp at runtime; with FMA the
+	//	products are fused, and may differ from the scalar results in the last bit.
+	//	norm, abs and arg return an array of reals.
+	//
+	template<typename T, std::size_t N>
+	inline SPROUT_CONSTEXPR sprout::complex_soa<T, N>
+	cmul(sprout::complex_soa<T, N> const& a, sprout::complex_soa<T, N> const& b) {
+#if defined(SPROUT_DETAIL_HAS_IS_CONSTANT_EVALUATED)
+		return __builtin_is_constant_evaluated() ? sprout::detail::cmul_scalar(a, b, sprout::make_index_tuple<N>::make())
+			: sprout::detail::cmul_vector(a, b)
+			;
+#else
+		return sprout::detail::cmul_scalar(a, b, sprout::make_index_tuple<N>::make());
+#endif
+	}
+	template<typename T, std::size_t N>
+	inline SPROUT_CONSTEXPR sprout::complex_soa<T, N>
+	cmadd(sprout::complex_soa<T, N> const& a, sprout::complex_soa<T, N> const& b, sprout::complex_soa<T, N> const& c) {
+#if defined(SPROUT_DETAIL_HAS_IS_CONSTANT_EVALUATED)
+		return __builtin_is_constant_evaluated() ? sprout::detail::cmadd_scalar(a, b, c, sprout::make_index_tuple<N>::make())
+			: sprout::detail::cmadd_vector(a, b, c)
+			;
+#else
+		return sprout::detail::cmadd_scalar(a, b, c, sprout::make_index_tuple<N>::make());
+#endif
+	}
+	template<typename T, std::size_t N>
+	inline SPROUT_CONSTEXPR sprout::complex_soa<T, N>
+	conj(sprout::complex_soa<T, N> const& a) {
+#if defined(SPROUT_DETAIL_HAS_IS_CONSTANT_EVALUATED)
+		return __builtin_is_constant_evaluated() ? sprout::detail::conj_scalar(a, sprout::make_index_tuple<N>::make())
+			: sprout::detail::conj_vector(a)
+			;
+#else
+		return sprout::detail::conj_scalar(a, sprout::make_index_tuple<N>::make());
+#endif
+	}
+	template<typename T, std::size_t N>
+	inline SPROUT_CONSTEXPR sprout::array<T, N>
+	norm(sprout::complex_soa<T, N> const& a) {
+		return sprout::detail::complex_soa_real<sprout::detail::complex_soa_norm_op>(a);
+	}
+	template<typename T, std::size_t N>
+	inline SPROUT_CONSTEXPR sprout::array<T, N>
+	abs(sprout::complex_soa<T, N> const& a) {
+		return sprout::detail::complex_soa_real<sprout::detail::complex_soa_abs_op>(a);
+	}
+	template<typename T, std::size_t N>
+	inline SPROUT_CONSTEXPR sprout::array<T, N>
+	arg(sprout::complex_soa<T, N> const& a) {
+		return sprout::detail::complex_soa_real<sprout::detail::complex_soa_arg_op>(a);
+	}
+
+	//
+	// cmul
+	// cmadd
+	// conj
+	// norm
+	// abs
+	// arg
+	//
+	//	Runtime forms over spans; the operands have at least the size of result,
+	//	which may be one of them. norm, abs and arg write a.size() reals from
+	//	result and return the end of them.
+	//
+	template<typename T1, typename T2, typename T>
+	inline void
+	cmul(sprout::complex_soa_span<T1> const& a, sprout::complex_soa_span<T2> const& b, sprout::complex_soa_span<T> const& result) {
+		sprout::detail::complex_soa_cmul<T> const kernel = {
+			a.real_data(), a.imag_data(), b.real_data(), b.imag_data(), result.real_data(), result.imag_data()
+			};
+		sprout::detail::complex_soa_run(kernel, result.size());
+	}
+	template<typename T1, typename T2, typename T3, typename T>
+	inline void
+	cmadd(
+		sprout::complex_soa_span<T1> const& a, sprout::complex_soa_span<T2> const& b, sprout::complex_soa_span<T3> const& c,
+		sprout::complex_soa_span<T> const& result
+		)
+	{
+		sprout::detail::complex_soa_cmadd<T> const kernel = {
+			a.real_data(), a.imag_data(), b.real_data(), b.imag_data(), c.real_data(), c.imag_data(),
+			result.real_data(), result.imag_data()
+			};
+		sprout::detail::complex_soa_run(kernel, result.size());
+	}
+	template<typename T1, typename T>
+	inline void
+	conj(sprout::complex_soa_span<T1> const& a, sprout::complex_soa_span<T> const& result) {
+		sprout::detail::complex_soa_conj<T> const kernel = {a.real_data(), a.imag_data(), result.real_data(), result.imag_data()};
+		sprout::detail::complex_soa_run(kernel, result.size());
+	}
+	template<typename T1, typename T>
+	inline T*
+	norm(sprout::complex_soa_span<T1> const& a, T* result) {
+		sprout::detail::complex_soa_norm<T> const kernel = {a.real_data(), a.imag_data(), result};
+		sprout::detail::complex_soa_run(kernel, a.size());
+		return result + a.size();
+	}
+	template<typename T1, typename T>
+	inline T*
+	abs(sprout::complex_soa_span<T1> const& a, T* result) {
+		sprout::detail::complex_soa_abs<T> const kernel = {a.real_data(), a.imag_data(), result};
+		sprout::detail::complex_soa_run(kernel, a.size());
+		return result + a.size();
+	}
+	template<typename T1, typename T>
+	inline T*
+	arg(sprout::complex_soa_span<T1> const& a, T* result) {
+		sprout::detail::complex_soa_arg<T> const kernel = {a.real_data(), a.imag_data(), result};
+		sprout::detail::complex_soa_run(kernel, a.size());
+		return result + a.size();
+	}
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_COMPLEX_SOA_HPP
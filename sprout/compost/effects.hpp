@@ -25,5 +25,6 @@
 #include <sprout/compost/effects/noise_gated.hpp>
 #include <sprout/compost/effects/vocal_cancelled.hpp>
 #include <sprout/compost/effects/superposed.hpp>
+#include <sprout/compost/effects/resampled.hpp>
 
 #endif	// #ifndef SPROUT_COMPOST_EFFECTS_HPP
@@ -0,0 +1,137 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_COMPOST_EFFECTS_RESAMPLED_HPP
+#define SPROUT_COMPOST_EFFECTS_RESAMPLED_HPP
+
+#include <type_traits>
+#include <sprout/config.hpp>
+#include <sprout/utility/as_const.hpp>
+#include <sprout/container/traits.hpp>
+#include <sprout/container/functions.hpp>
+#include <sprout/compost/utility/resample_filter.hpp>
+#include <sprout/range/adaptor/transformed.hpp>
+#include <sprout/range/adaptor/counting.hpp>
+
+namespace sprout {
+	namespace compost {
+		//
+		// resampled_value
+		//
+		template<typename Filter, typename Iterator, typename Difference>
+		struct resampled_value {
+		public:
+			typedef Filter filter_type;
+			typedef typename filter_type::value_type value_type;
+			typedef typename filter_type::size_type size_type;
+			typedef Iterator iterator;
+			typedef Difference difference_type;
+		private:
+			iterator first_;
+			difference_type size_;
+		private:
+			SPROUT_CONSTEXPR value_type at(difference_type i) const {
+				return i >= 0 && i < size_ ? static_cast<value_type>(first_[i]) : value_type();
+			}
+			SPROUT_CONSTEXPR value_type
+			calc(difference_type first, size_type offset, size_type n) const {
+				return n == 1 ? at(first) * filter_type::table[offset]
+					: calc(first, offset, n / 2) + calc(first + n / 2, offset + n / 2, n - n / 2)
+					;
+			}
+			SPROUT_CONSTEXPR value_type
+			calc(difference_type base, size_type phase) const {
+				return calc(
+					base - static_cast<difference_type>(filter_type::taps / 2 - 1),
+					phase * filter_type::taps, filter_type::taps
+					);
+			}
+		public:
+			SPROUT_CONSTEXPR resampled_value(iterator const& first, difference_type size)
+				: first_(first), size_(size)
+			{}
+			SPROUT_CONSTEXPR value_type operator()(difference_type n) const {
+				return calc(
+					static_cast<difference_type>(n * filter_type::down / filter_type::up),
+					static_cast<size_type>(n * filter_type::down % filter_type::up)
+					);
+			}
+		};
+
+		namespace effects {
+			//
+			// resample_holder
+			//
+			template<typename Filter>
+			class resample_holder {
+			public:
+				typedef Filter filter_type;
+			public:
+				SPROUT_CONSTEXPR resample_holder() SPROUT_DEFAULTED_DEFAULT_CONSTRUCTOR_DECL
+				resample_holder(resample_holder const&) = default;
+			};
+
+			//
+			// resampled_forwarder
+			//
+			class resampled_forwarder {
+			public:
+				template<typename Filter>
+				SPROUT_CONSTEXPR sprout::compost::effects::resample_holder<Filter>
+				operator()(Filter const&) const {
+					return sprout::compost::effects::resample_holder<Filter>();
+				}
+			};
+
+			//
+			// resampled
+			//
+			namespace {
+				SPROUT_STATIC_CONSTEXPR sprout::compost::effects::resampled_forwarder resampled = {};
+			}	// anonymous-namespace
+
+			//
+			// operator|
+			//
+			template<typename Range, typename Filter>
+			inline SPROUT_CONSTEXPR auto
+			operator|(Range&& lhs, sprout::compost::effects::resample_holder<Filter> const&)
+			-> decltype(
+				sprout::adaptors::counting(
+					typename sprout::container_traits<typename std::remove_reference<Range>::type>::difference_type(),
+					typename sprout::container_traits<typename std::remove_reference<Range>::type>::difference_type()
+					)
+					| sprout::adaptors::transformed(
+						sprout::compost::resampled_value<
+							Filter,
+							typename sprout::container_traits<typename std::remove_reference<Range>::type>::const_iterator,
+							typename sprout::container_traits<typename std::remove_reference<Range>::type>::difference_type
+						>(sprout::begin(sprout::as_const(lhs)), sprout::size(lhs))
+						)
+				)
+			{
+				typedef typename sprout::container_traits<typename std::remove_reference<Range>::type>::difference_type difference_type;
+				return sprout::adaptors::counting(
+					difference_type(),
+					static_cast<difference_type>(Filter::output_size(sprout::size(lhs)))
+					)
+					| sprout::adaptors::transformed(
+						sprout::compost::resampled_value<
+							Filter,
+							typename sprout::container_traits<typename std::remove_reference<Range>::type>::const_iterator,
+							difference_type
+						>(sprout::begin(sprout::as_const(lhs)), sprout::size(lhs))
+						)
+					;
+			}
+		}	// namespace effects
+
+		using sprout::compost::effects::resampled;
+	}	// namespace compost
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_COMPOST_EFFECTS_RESAMPLED_HPP
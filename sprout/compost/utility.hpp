@@ -12,5 +12,9 @@
 #include <sprout/compost/utility/equal_temperament.hpp>
 #include <sprout/compost/utility/rosenberg.hpp>
 #include <sprout/compost/utility/iir_filter.hpp>
+#include <sprout/compost/utility/resample_filter.hpp>
+#include <sprout/compost/utility/resampler.hpp>
+#include <sprout/compost/utility/wavetable.hpp>
+#include <sprout/compost/utility/voice_bank.hpp>
 
 #endif	// #ifndef SPROUT_COMPOST_UTILITY_HPP
@@ -0,0 +1,159 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_COMPOST_UTILITY_RESAMPLE_FILTER_HPP
+#define SPROUT_COMPOST_UTILITY_RESAMPLE_FILTER_HPP
+
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/array/array.hpp>
+#include <sprout/array/make_array.hpp>
+#include <sprout/index_tuple/metafunction.hpp>
+#include <sprout/math/sin.hpp>
+#include <sprout/math/cos.hpp>
+#include <sprout/math/abs.hpp>
+#include <sprout/math/constants.hpp>
+
+namespace sprout {
+	namespace compost {
+		namespace detail {
+			template<typename T>
+			inline SPROUT_CONSTEXPR T
+			resample_sinc(T const& x) {
+				return x == 0 ? T(1)
+					: sprout::math::sin(sprout::math::pi<T>() * x) / (sprout::math::pi<T>() * x)
+					;
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR T
+			resample_blackman(T const& u, T const& half) {
+				return sprout::math::abs(u) >= half ? T(0)
+					: T(0.42)
+						+ T(0.5) * sprout::math::cos(sprout::math::pi<T>() * u / half)
+						+ T(0.08) * sprout::math::cos(sprout::math::two_pi<T>() * u / half)
+					;
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR T
+			resample_kernel(T const& u, T const& cutoff, T const& half) {
+				return cutoff * sprout::compost::detail::resample_sinc(cutoff * u)
+					* sprout::compost::detail::resample_blackman(u, half)
+					;
+			}
+			template<typename T, std::size_t Taps>
+			inline SPROUT_CONSTEXPR T
+			resample_coefficient(std::size_t phase, std::size_t tap, std::size_t up, std::size_t down) {
+				return sprout::compost::detail::resample_kernel(
+					static_cast<T>(static_cast<long>(tap) - static_cast<long>(Taps / 2 - 1)) - static_cast<T>(phase) / up,
+					up < down ? static_cast<T>(up) / down : T(1),
+					static_cast<T>(Taps / 2)
+					);
+			}
+
+			template<typename T, std::size_t Taps, std::size_t Up, std::size_t Down, sprout::index_t... Indexes>
+			inline SPROUT_CONSTEXPR sprout::array<T, sizeof...(Indexes)>
+			make_resample_filter_table(sprout::index_tuple<Indexes...>) {
+				return sprout::make_array<T>(
+					sprout::compost::detail::resample_coefficient<T, Taps>(Indexes / Taps, Indexes % Taps, Up, Down)...
+					);
+			}
+
+			template<std::size_t A, std::size_t B>
+			struct resample_gcd
+				: public sprout::compost::detail::resample_gcd<B, A % B>
+			{};
+			template<std::size_t A>
+			struct resample_gcd<A, 0> {
+			public:
+				SPROUT_STATIC_CONSTEXPR std::size_t value = A;
+			};
+			template<std::size_t A>
+			SPROUT_CONSTEXPR_OR_CONST std::size_t sprout::compost::detail::resample_gcd<A, 0>::value;
+		}	// namespace detail
+
+		//
+		// resample_filter
+		//
+		//	Polyphase windowed-sinc (Blackman) filter bank converting InRate to OutRate.
+		//	The conversion ratio is reduced to up/down; the bank holds one Taps-long
+		//	filter per output phase, so table has up * Taps coefficients.
+		//	Tap k of a phase applies to input sample (base - Taps / 2 + 1 + k).
+		//
+		template<typename T, std::size_t InRate, std::size_t OutRate, std::size_t Taps = 16>
+		struct resample_filter {
+			static_assert(InRate > 0 && OutRate > 0, "InRate > 0 && OutRate > 0");
+			static_assert(Taps > 0 && Taps % 2 == 0, "Taps > 0 && Taps % 2 == 0");
+		public:
+			typedef T value_type;
+			typedef std::size_t size_type;
+		public:
+			SPROUT_STATIC_CONSTEXPR size_type in_rate = InRate;
+			SPROUT_STATIC_CONSTEXPR size_type out_rate = OutRate;
+			SPROUT_STATIC_CONSTEXPR size_type taps = Taps;
+			SPROUT_STATIC_CONSTEXPR size_type up = OutRate / sprout::compost::detail::resample_gcd<InRate, OutRate>::value;
+			SPROUT_STATIC_CONSTEXPR size_type down = InRate / sprout::compost::detail::resample_gcd<InRate, OutRate>::value;
+			SPROUT_STATIC_CONSTEXPR size_type phases = up;
+		public:
+			typedef sprout::array<value_type, phases * taps> table_type;
+		public:
+			SPROUT_STATIC_CONSTEXPR table_type table
+				SPROUT_STATIC_CONSTEXPR_DATA_MEMBER_INNER((
+					sprout::compost::detail::make_resample_filter_table<value_type, Taps, up, down>(
+						sprout::make_index_tuple<phases * taps>::make()
+						)
+					))
+				;
+		public:
+			static SPROUT_CONSTEXPR size_type output_size(size_type n) {
+				return (n * up + down - 1) / down;
+			}
+			static SPROUT_CONSTEXPR value_type coefficient(size_type phase, size_type k) {
+				return table[phase * taps + k];
+			}
+		};
+		template<typename T, std::size_t InRate, std::size_t OutRate, std::size_t Taps>
+		SPROUT_CONSTEXPR_OR_CONST typename sprout::compost::resample_filter<T, InRate, OutRate, Taps>::size_type
+		sprout::compost::resample_filter<T, InRate, OutRate, Taps>::in_rate;
+		template<typename T, std::size_t InRate, std::size_t OutRate, std::size_t Taps>
+		SPROUT_CONSTEXPR_OR_CONST typename sprout::compost::resample_filter<T, InRate, OutRate, Taps>::size_type
+		sprout::compost::resample_filter<T, InRate, OutRate, Taps>::out_rate;
+		template<typename T, std::size_t InRate, std::size_t OutRate, std::size_t Taps>
+		SPROUT_CONSTEXPR_OR_CONST typename sprout::compost::resample_filter<T, InRate, OutRate, Taps>::size_type
+		sprout::compost::resample_filter<T, InRate, OutRate, Taps>::taps;
+		template<typename T, std::size_t InRate, std::size_t OutRate, std::size_t Taps>
+		SPROUT_CONSTEXPR_OR_CONST typename sprout::compost::resample_filter<T, InRate, OutRate, Taps>::size_type
+		sprout::compost::resample_filter<T, InRate, OutRate, Taps>::up;
+		template<typename T, std::size_t InRate, std::size_t OutRate, std::size_t Taps>
+		SPROUT_CONSTEXPR_OR_CONST typename sprout::compost::resample_filter<T, InRate, OutRate, Taps>::size_type
+		sprout::compost::resample_filter<T, InRate, OutRate, Taps>::down;
+		template<typename T, std::size_t InRate, std::size_t OutRate, std::size_t Taps>
+		SPROUT_CONSTEXPR_OR_CONST typename sprout::compost::resample_filter<T, InRate, OutRate, Taps>::size_type
+		sprout::compost::resample_filter<T, InRate, OutRate, Taps>::phases;
+		template<typename T, std::size_t InRate, std::size_t OutRate, std::size_t Taps>
+		SPROUT_CONSTEXPR_OR_CONST typename sprout::compost::resample_filter<T, InRate, OutRate, Taps>::table_type
+		sprout::compost::resample_filter<T, InRate, OutRate, Taps>::table
+			SPROUT_STATIC_CONSTEXPR_DATA_MEMBER_OUTER((
+				sprout::compost::detail::make_resample_filter_table<T, Taps, up, down>(
+					sprout::make_index_tuple<phases * taps>::make()
+					)
+				))
+			;
+
+#if SPROUT_USE_TEMPLATE_ALIASES
+		template<typename T, std::size_t Taps = 16>
+		using resample_filter_44100_to_48000 = sprout::compost::resample_filter<T, 44100, 48000, Taps>;
+		template<typename T, std::size_t Taps = 16>
+		using resample_filter_48000_to_44100 = sprout::compost::resample_filter<T, 48000, 44100, Taps>;
+		template<typename T, std::size_t Taps = 16>
+		using resample_filter_22050_to_44100 = sprout::compost::resample_filter<T, 22050, 44100, Taps>;
+		template<typename T, std::size_t Taps = 16>
+		using resample_filter_96000_to_48000 = sprout::compost::resample_filter<T, 96000, 48000, Taps>;
+#endif	// #if SPROUT_USE_TEMPLATE_ALIASES
+	}	// namespace compost
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_COMPOST_UTILITY_RESAMPLE_FILTER_HPP
@@ -0,0 +1,181 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_COMPOST_UTILITY_RESAMPLER_HPP
+#define SPROUT_COMPOST_UTILITY_RESAMPLER_HPP
+
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/array/array.hpp>
+#include <sprout/compost/utility/resample_filter.hpp>
+#include <sprout/detail/simd.hpp>
+
+namespace sprout {
+	namespace compost {
+		namespace detail {
+			template<typename T>
+			inline T
+			resample_inner_product(T const* a, T const* b, std::size_t n) {
+				T s0 = T(), s1 = T(), s2 = T(), s3 = T();
+				std::size_t i = 0;
+				for (; i + 4 <= n; i += 4) {
+					s0 += a[i] * b[i];
+					s1 += a[i + 1] * b[i + 1];
+					s2 += a[i + 2] * b[i + 2];
+					s3 += a[i + 3] * b[i + 3];
+				}
+				for (std::size_t r = n - i; r != 0; --r, ++i) {
+					s0 += a[i] * b[i];
+				}
+				return (s0 + s1) + (s2 + s3);
+			}
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+			inline float
+			resample_inner_product(float const* a, float const* b, std::size_t n) {
+				std::size_t i = 0;
+#	if defined(SPROUT_DETAIL_SIMD_AVX)
+				__m256 acc8 = _mm256_setzero_ps();
+				for (; i + 8 <= n; i += 8) {
+#		if defined(SPROUT_DETAIL_SIMD_FMA)
+					acc8 = _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i), acc8);
+#		else
+					acc8 = _mm256_add_ps(acc8, _mm256_mul_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+#		endif
+				}
+				__m128 acc = _mm_add_ps(_mm256_castps256_ps128(acc8), _mm256_extractf128_ps(acc8, 1));
+#	else
+				__m128 acc = _mm_setzero_ps();
+#	endif
+				for (; i + 4 <= n; i += 4) {
+					acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+				}
+				acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+				acc = _mm_add_ss(acc, _mm_shuffle_ps(acc, acc, 1));
+				float s = _mm_cvtss_f32(acc);
+				for (std::size_t r = n - i; r != 0; --r, ++i) {
+					s += a[i] * b[i];
+				}
+				return s;
+			}
+			inline double
+			resample_inner_product(double const* a, double const* b, std::size_t n) {
+				std::size_t i = 0;
+#	if defined(SPROUT_DETAIL_SIMD_AVX)
+				__m256d acc4 = _mm256_setzero_pd();
+				for (; i + 4 <= n; i += 4) {
+#		if defined(SPROUT_DETAIL_SIMD_FMA)
+					acc4 = _mm256_fmadd_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i), acc4);
+#		else
+					acc4 = _mm256_add_pd(acc4, _mm256_mul_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i)));
+#		endif
+				}
+				__m128d acc = _mm_add_pd(_mm256_castpd256_pd128(acc4), _mm256_extractf128_pd(acc4, 1));
+#	else
+				__m128d acc = _mm_setzero_pd();
+#	endif
+				for (; i + 2 <= n; i += 2) {
+					acc = _mm_add_pd(acc, _mm_mul_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+				}
+				acc = _mm_add_sd(acc, _mm_unpackhi_pd(acc, acc));
+				double s = _mm_cvtsd_f64(acc);
+				for (std::size_t r = n - i; r != 0; --r, ++i) {
+					s += a[i] * b[i];
+				}
+				return s;
+			}
+#endif
+		}	// namespace detail
+
+		//
+		// resampler
+		//
+		//	Streaming block processor over a resample_filter.
+		//	Input may be fed in blocks of any size; the delay line and the output phase
+		//	are carried across calls, so consecutive blocks produce the same samples as
+		//	one long block. Output lags input by Filter::taps / 2 samples; flush drains it.
+		//
+		template<typename Filter>
+		class resampler {
+		public:
+			typedef Filter filter_type;
+			typedef typename filter_type::value_type value_type;
+			typedef typename filter_type::size_type size_type;
+		public:
+			SPROUT_STATIC_CONSTEXPR size_type taps = filter_type::taps;
+			SPROUT_STATIC_CONSTEXPR size_type up = filter_type::up;
+			SPROUT_STATIC_CONSTEXPR size_type down = filter_type::down;
+		public:
+			static SPROUT_CONSTEXPR size_type max_output_size(size_type n) {
+				return (n * up + down - 1) / down + 1;
+			}
+		private:
+			sprout::array<value_type, taps * 2> history_;
+			size_type pos_;
+			size_type phase_;
+			size_type wait_;
+		private:
+			void push(value_type const& x) {
+				history_[pos_] = x;
+				history_[pos_ + taps] = x;
+				pos_ = pos_ + 1 != taps ? pos_ + 1 : 0;
+				--wait_;
+			}
+			value_type emit() {
+				value_type result = sprout::compost::detail::resample_inner_product(
+					history_.data() + pos_, filter_type::table.data() + phase_ * taps, taps
+					);
+				phase_ += down;
+				wait_ += phase_ / up;
+				phase_ %= up;
+				return result;
+			}
+		public:
+			resampler()
+				: history_(), pos_(0), phase_(0), wait_(taps / 2 + 1)
+			{}
+			void reset() {
+				history_ = sprout::array<value_type, taps * 2>();
+				pos_ = 0;
+				phase_ = 0;
+				wait_ = taps / 2 + 1;
+			}
+			template<typename InputIterator, typename OutputIterator>
+			OutputIterator process(InputIterator first, InputIterator last, OutputIterator result) {
+				for (; first != last; ++first) {
+					push(static_cast<value_type>(*first));
+					while (wait_ == 0) {
+						*result = emit();
+						++result;
+					}
+				}
+				return result;
+			}
+			template<typename OutputIterator>
+			OutputIterator flush(OutputIterator result) {
+				for (size_type i = 0; i != taps / 2; ++i) {
+					push(value_type());
+					while (wait_ == 0) {
+						*result = emit();
+						++result;
+					}
+				}
+				return result;
+			}
+		};
+		template<typename Filter>
+		SPROUT_CONSTEXPR_OR_CONST typename sprout::compost::resampler<Filter>::size_type
+		sprout::compost::resampler<Filter>::taps;
+		template<typename Filter>
+		SPROUT_CONSTEXPR_OR_CONST typename sprout::compost::resampler<Filter>::size_type
+		sprout::compost::resampler<Filter>::up;
+		template<typename Filter>
+		SPROUT_CONSTEXPR_OR_CONST typename sprout::compost::resampler<Filter>::size_type
+		sprout::compost::resampler<Filter>::down;
+	}	// namespace compost
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_COMPOST_UTILITY_RESAMPLER_HPP
@@ -0,0 +1,186 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_COMPOST_UTILITY_VOICE_BANK_HPP
+#define SPROUT_COMPOST_UTILITY_VOICE_BANK_HPP
+
+#include <type_traits>
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/array/array.hpp>
+#include <sprout/math/floor.hpp>
+#include <sprout/compost/utility/wavetable.hpp>
+#include <sprout/detail/simd.hpp>
+
+namespace sprout {
+	namespace compost {
+		namespace detail {
+			template<typename Table, typename Interpolation>
+			inline typename Table::value_type
+			wavetable_voice_render(
+				typename Table::value_type* out, std::size_t frames,
+				typename Table::value_type phase, typename Table::value_type increment,
+				typename Table::value_type amplitude, std::size_t level
+				)
+			{
+				for (std::size_t k = 0; k != frames; ++k) {
+					out[k] += amplitude * Interpolation::template at<Table>(level, phase);
+					phase += increment;
+					if (phase >= 1 || phase < 0) {
+						phase -= sprout::math::floor(phase);
+					}
+				}
+				return phase;
+			}
+
+			template<typename Table, typename Interpolation>
+			struct wavetable_voice_kernel {
+			public:
+				typedef typename Table::value_type value_type;
+				typedef typename Table::size_type size_type;
+			public:
+				static value_type render(
+					value_type* out, size_type frames,
+					value_type phase, value_type increment, value_type amplitude, size_type level
+					)
+				{
+					return sprout::compost::detail::wavetable_voice_render<Table, Interpolation>(
+						out, frames, phase, increment, amplitude, level
+						);
+				}
+			};
+#if defined(SPROUT_DETAIL_SIMD_AVX2)
+			template<typename Shape, std::size_t Size>
+			struct wavetable_voice_kernel<sprout::compost::wavetable<Shape, float, Size>, sprout::compost::wavetable_linear> {
+			public:
+				typedef sprout::compost::wavetable<Shape, float, Size> table_type;
+				typedef float value_type;
+				typedef std::size_t size_type;
+			public:
+				static value_type render(
+					value_type* out, size_type frames,
+					value_type phase, value_type increment, value_type amplitude, size_type level
+					)
+				{
+					float const* base = table_type::table.data() + level * Size;
+					__m256 const ramp = _mm256_set_ps(7, 6, 5, 4, 3, 2, 1, 0);
+					__m256 const inc = _mm256_set1_ps(increment);
+					__m256 const amp = _mm256_set1_ps(amplitude);
+					__m256 const size = _mm256_set1_ps(static_cast<float>(Size));
+					__m256i const mask = _mm256_set1_epi32(static_cast<int>(Size - 1));
+					__m256i const one = _mm256_set1_epi32(1);
+					size_type k = 0;
+					for (; k + 8 <= frames; k += 8) {
+						__m256 ph = _mm256_add_ps(_mm256_set1_ps(phase), _mm256_mul_ps(ramp, inc));
+						ph = _mm256_sub_ps(ph, _mm256_floor_ps(ph));
+						__m256 pos = _mm256_mul_ps(ph, size);
+						__m256 fl = _mm256_floor_ps(pos);
+						__m256 t = _mm256_sub_ps(pos, fl);
+						__m256i i0 = _mm256_and_si256(_mm256_cvttps_epi32(fl), mask);
+						__m256i i1 = _mm256_and_si256(_mm256_add_epi32(i0, one), mask);
+						__m256 a = _mm256_i32gather_ps(base, i0, 4);
+						__m256 b = _mm256_i32gather_ps(base, i1, 4);
+						__m256 v = _mm256_add_ps(a, _mm256_mul_ps(t, _mm256_sub_ps(b, a)));
+						_mm256_storeu_ps(out + k, _mm256_add_ps(_mm256_loadu_ps(out + k), _mm256_mul_ps(amp, v)));
+						phase += 8 * increment;
+						phase -= sprout::math::floor(phase);
+					}
+					return sprout::compost::detail::wavetable_voice_render<table_type, sprout::compost::wavetable_linear>(
+						out + k, frames - k, phase, increment, amplitude, level
+						);
+				}
+			};
+#endif
+		}	// namespace detail
+
+		//
+		// wavetable_voice_bank
+		//
+		//	Renders Voices wavetable oscillators into one block.
+		//	Per-voice state is kept as structure of arrays; a voice with zero amplitude
+		//	is skipped. Each voice picks its mip level from its frequency, so retuning
+		//	never aliases. Frequencies and phases are in cycles per sample and cycles.
+		//
+		template<typename Table, std::size_t Voices, typename Interpolation = sprout::compost::wavetable_linear>
+		class wavetable_voice_bank {
+		public:
+			typedef Table table_type;
+			typedef Interpolation interpolation_type;
+			typedef typename table_type::value_type value_type;
+			typedef std::size_t size_type;
+		public:
+			SPROUT_STATIC_CONSTEXPR size_type voices = Voices;
+		private:
+			sprout::array<value_type, Voices> phase_;
+			sprout::array<value_type, Voices> increment_;
+			sprout::array<value_type, Voices> amplitude_;
+			sprout::array<size_type, Voices> level_;
+		public:
+			wavetable_voice_bank()
+				: phase_(), increment_(), amplitude_(), level_()
+			{}
+			void set(size_type voice, value_type const& frequency, value_type const& amplitude, value_type const& phase = 0) {
+				set_frequency(voice, frequency);
+				amplitude_[voice] = amplitude;
+				phase_[voice] = phase - sprout::math::floor(phase);
+			}
+			void set_frequency(size_type voice, value_type const& frequency) {
+				increment_[voice] = frequency;
+				level_[voice] = table_type::level_for(frequency);
+			}
+			void set_amplitude(size_type voice, value_type const& amplitude) {
+				amplitude_[voice] = amplitude;
+			}
+			void stop(size_type voice) {
+				amplitude_[voice] = 0;
+			}
+			value_type const& phase(size_type voice) const {
+				return phase_[voice];
+			}
+			value_type const& frequency(size_type voice) const {
+				return increment_[voice];
+			}
+			value_type const& amplitude(size_type voice) const {
+				return amplitude_[voice];
+			}
+			size_type level(size_type voice) const {
+				return level_[voice];
+			}
+			//
+			// render
+			//	Overwrites out[0, frames) with the sum of all voices.
+			//
+			void render(value_type* out, size_type frames) {
+				for (size_type k = 0; k != frames; ++k) {
+					out[k] = value_type();
+				}
+				mix(out, frames);
+			}
+			//
+			// mix
+			//	Adds the sum of all voices to out[0, frames).
+			//
+			void mix(value_type* out, size_type frames) {
+				for (size_type v = 0; v != Voices; ++v) {
+					if (amplitude_[v] == 0) {
+						phase_[v] += increment_[v] * static_cast<value_type>(frames);
+						phase_[v] -= sprout::math::floor(phase_[v]);
+						continue;
+					}
+					phase_[v] = sprout::compost::detail::wavetable_voice_kernel<table_type, interpolation_type>::render(
+						out, frames, phase_[v], increment_[v], amplitude_[v], level_[v]
+						);
+				}
+			}
+		};
+		template<typename Table, std::size_t Voices, typename Interpolation>
+		SPROUT_CONSTEXPR_OR_CONST typename sprout::compost::wavetable_voice_bank<Table, Voices, Interpolation>::size_type
+		sprout::compost::wavetable_voice_bank<Table, Voices, Interpolation>::voices;
+	}	// namespace compost
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_COMPOST_UTILITY_VOICE_BANK_HPP
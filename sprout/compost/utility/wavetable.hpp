@@ -0,0 +1,219 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_COMPOST_UTILITY_WAVETABLE_HPP
+#define SPROUT_COMPOST_UTILITY_WAVETABLE_HPP
+
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/array/array.hpp>
+#include <sprout/array/make_array.hpp>
+#include <sprout/index_tuple/metafunction.hpp>
+#include <sprout/math/sin.hpp>
+#include <sprout/math/floor.hpp>
+#include <sprout/math/constants.hpp>
+
+namespace sprout {
+	namespace compost {
+		//
+		// sine_shape
+		// sawtooth_shape
+		// square_shape
+		// triangle_shape
+		//
+		//	Fourier sine-series coefficients matching sinusoidal, sawtooth_wave,
+		//	square_wave (duty 0.5) and triangle_wave at phase 0.
+		//
+		struct sine_shape {
+		public:
+			template<typename T>
+			static SPROUT_CONSTEXPR T harmonic(std::size_t h) {
+				return h == 1 ? T(1) : T(0);
+			}
+		};
+		struct sawtooth_shape {
+		public:
+			template<typename T>
+			static SPROUT_CONSTEXPR T harmonic(std::size_t h) {
+				return (h % 2 ? T(2) : T(-2)) / (sprout::math::pi<T>() * h);
+			}
+		};
+		struct square_shape {
+		public:
+			template<typename T>
+			static SPROUT_CONSTEXPR T harmonic(std::size_t h) {
+				return h % 2 ? T(4) / (sprout::math::pi<T>() * h) : T(0);
+			}
+		};
+		struct triangle_shape {
+		public:
+			template<typename T>
+			static SPROUT_CONSTEXPR T harmonic(std::size_t h) {
+				return h % 2 ? ((h / 2) % 2 ? T(-8) : T(8)) / (sprout::math::pi<T>() * sprout::math::pi<T>() * h * h) : T(0);
+			}
+		};
+
+		namespace detail {
+			template<std::size_t N, typename Dummy = void>
+			struct wavetable_log2 {
+			public:
+				SPROUT_STATIC_CONSTEXPR std::size_t value
+					SPROUT_STATIC_CONSTEXPR_DATA_MEMBER_INNER(1 + sprout::compost::detail::wavetable_log2<N / 2>::value)
+					;
+			};
+			template<std::size_t N, typename Dummy>
+			SPROUT_CONSTEXPR_OR_CONST std::size_t
+			sprout::compost::detail::wavetable_log2<N, Dummy>::value
+				SPROUT_STATIC_CONSTEXPR_DATA_MEMBER_OUTER(1 + sprout::compost::detail::wavetable_log2<N / 2>::value)
+				;
+			template<typename Dummy>
+			struct wavetable_log2<1, Dummy> {
+			public:
+				SPROUT_STATIC_CONSTEXPR std::size_t value
+					SPROUT_STATIC_CONSTEXPR_DATA_MEMBER_INNER(0)
+					;
+			};
+			template<typename Dummy>
+			SPROUT_CONSTEXPR_OR_CONST std::size_t
+			sprout::compost::detail::wavetable_log2<1, Dummy>::value
+				SPROUT_STATIC_CONSTEXPR_DATA_MEMBER_OUTER(0)
+				;
+
+			template<typename Shape, typename T, std::size_t Size>
+			inline SPROUT_CONSTEXPR T
+			wavetable_harmonic_sum(std::size_t i, std::size_t first, std::size_t n) {
+				return n == 0 ? T(0)
+					: n == 1 ? Shape::template harmonic<T>(first) == 0 ? T(0)
+						: Shape::template harmonic<T>(first)
+							* sprout::math::sin(sprout::math::two_pi<T>() * static_cast<T>(first * i % Size) / Size)
+					: sprout::compost::detail::wavetable_harmonic_sum<Shape, T, Size>(i, first, n / 2)
+						+ sprout::compost::detail::wavetable_harmonic_sum<Shape, T, Size>(i, first + n / 2, n - n / 2)
+					;
+			}
+			template<typename Shape, typename T, std::size_t Size, sprout::index_t... Indexes>
+			inline SPROUT_CONSTEXPR sprout::array<T, sizeof...(Indexes)>
+			make_wavetable(sprout::index_tuple<Indexes...>) {
+				return sprout::make_array<T>(
+					sprout::compost::detail::wavetable_harmonic_sum<Shape, T, Size>(
+						Indexes % Size, 1, (Size / 4) >> (Indexes / Size)
+						)...
+					);
+			}
+		}	// namespace detail
+
+		//
+		// wavetable
+		//
+		//	Mip-mapped band-limited single-cycle tables, generated at compile time.
+		//	Level 0 holds Size / 4 harmonics; each following level halves the
+		//	harmonic count, down to a pure fundamental. Phase is given in cycles.
+		//
+		template<typename Shape, typename T, std::size_t Size = 256>
+		struct wavetable {
+			static_assert(Size >= 4 && (Size & (Size - 1)) == 0, "Size >= 4 && Size is a power of 2");
+		public:
+			typedef Shape shape_type;
+			typedef T value_type;
+			typedef std::size_t size_type;
+		public:
+			SPROUT_STATIC_CONSTEXPR size_type size = Size;
+			SPROUT_STATIC_CONSTEXPR size_type levels = sprout::compost::detail::wavetable_log2<Size / 4>::value + 1;
+		public:
+			typedef sprout::array<value_type, levels * size> table_type;
+		public:
+			SPROUT_STATIC_CONSTEXPR table_type table
+				SPROUT_STATIC_CONSTEXPR_DATA_MEMBER_INNER((
+					sprout::compost::detail::make_wavetable<Shape, T, Size>(sprout::make_index_tuple<levels * size>::make())
+					))
+				;
+		private:
+			static SPROUT_CONSTEXPR size_type level_for_impl(value_type const& frequency, size_type level) {
+				return level + 1 == levels || ((size / 4) >> level) * frequency <= value_type(0.5) ? level
+					: level_for_impl(frequency, level + 1)
+					;
+			}
+			static SPROUT_CONSTEXPR value_type at(size_type level, size_type i) {
+				return table[level * size + (i & (size - 1))];
+			}
+			static SPROUT_CONSTEXPR value_type
+			linear_at_impl(size_type level, size_type i, value_type const& t) {
+				return at(level, i) + t * (at(level, i + 1) - at(level, i));
+			}
+			static SPROUT_CONSTEXPR value_type
+			cubic_at_impl(size_type level, size_type i, value_type const& t) {
+				return cubic_at_impl(level, t, at(level, i + size - 1), at(level, i), at(level, i + 1), at(level, i + 2));
+			}
+			static SPROUT_CONSTEXPR value_type
+			cubic_at_impl(size_type, value_type const& t, value_type const& y0, value_type const& y1, value_type const& y2, value_type const& y3) {
+				return y1 + t * ((y2 - y0) / 2
+					+ t * ((y0 - 5 * y1 / 2 + 2 * y2 - y3 / 2)
+						+ t * ((y3 - y0) / 2 + 3 * (y1 - y2) / 2)
+						)
+					);
+			}
+			static SPROUT_CONSTEXPR value_type position(value_type const& phase) {
+				return (phase - sprout::math::floor(phase)) * size;
+			}
+		public:
+			//
+			// level_for
+			//	Finest level that does not alias at frequency (cycles per sample).
+			//
+			static SPROUT_CONSTEXPR size_type level_for(value_type const& frequency) {
+				return level_for_impl(frequency < 0 ? -frequency : frequency, 0);
+			}
+			static SPROUT_CONSTEXPR value_type linear_at(size_type level, value_type const& phase) {
+				return linear_at_impl(
+					level, static_cast<size_type>(position(phase)),
+					position(phase) - static_cast<size_type>(position(phase))
+					);
+			}
+			static SPROUT_CONSTEXPR value_type cubic_at(size_type level, value_type const& phase) {
+				return cubic_at_impl(
+					level, static_cast<size_type>(position(phase)),
+					position(phase) - static_cast<size_type>(position(phase))
+					);
+			}
+		};
+		template<typename Shape, typename T, std::size_t Size>
+		SPROUT_CONSTEXPR_OR_CONST typename sprout::compost::wavetable<Shape, T, Size>::size_type
+		sprout::compost::wavetable<Shape, T, Size>::size;
+		template<typename Shape, typename T, std::size_t Size>
+		SPROUT_CONSTEXPR_OR_CONST typename sprout::compost::wavetable<Shape, T, Size>::size_type
+		sprout::compost::wavetable<Shape, T, Size>::levels;
+		template<typename Shape, typename T, std::size_t Size>
+		SPROUT_CONSTEXPR_OR_CONST typename sprout::compost::wavetable<Shape, T, Size>::table_type
+		sprout::compost::wavetable<Shape, T, Size>::table
+			SPROUT_STATIC_CONSTEXPR_DATA_MEMBER_OUTER((
+				sprout::compost::detail::make_wavetable<Shape, T, Size>(sprout::make_index_tuple<levels * size>::make())
+				))
+			;
+
+		//
+		// wavetable_linear
+		// wavetable_cubic
+		//
+		struct wavetable_linear {
+		public:
+			template<typename Table>
+			static SPROUT_CONSTEXPR typename Table::value_type
+			at(typename Table::size_type level, typename Table::value_type const& phase) {
+				return Table::linear_at(level, phase);
+			}
+		};
+		struct wavetable_cubic {
+		public:
+			template<typename Table>
+			static SPROUT_CONSTEXPR typename Table::value_type
+			at(typename Table::size_type level, typename Table::value_type const& phase) {
+				return Table::cubic_at(level, phase);
+			}
+		};
+	}	// namespace compost
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_COMPOST_UTILITY_WAVETABLE_HPP
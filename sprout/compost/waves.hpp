@@ -15,5 +15,6 @@
 #include <sprout/compost/waves/triangle_wave.hpp>
 #include <sprout/compost/waves/square_wave.hpp>
 #include <sprout/compost/waves/white_noise.hpp>
+#include <sprout/compost/waves/wavetable_wave.hpp>
 
 #endif	// #ifndef SPROUT_COMPOST_WAVES_HPP
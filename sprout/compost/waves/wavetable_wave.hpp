@@ -0,0 +1,242 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_COMPOST_WAVES_WAVETABLE_WAVE_HPP
+#define SPROUT_COMPOST_WAVES_WAVETABLE_WAVE_HPP
+
+#include <type_traits>
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/container/traits.hpp>
+#include <sprout/container/functions.hpp>
+#include <sprout/iterator/counting_iterator.hpp>
+#include <sprout/iterator/transform_iterator.hpp>
+#include <sprout/range/range_container.hpp>
+#include <sprout/range/adaptor/detail/adapted_range_default.hpp>
+#include <sprout/type_traits/lvalue_reference.hpp>
+#include <sprout/type_traits/enabler_if.hpp>
+#include <sprout/utility/forward.hpp>
+#include <sprout/utility/lvalue_forward.hpp>
+#include <sprout/compost/utility/wavetable.hpp>
+
+namespace sprout {
+	namespace compost {
+		//
+		// wavetable_value
+		//
+		template<typename Table, typename Interpolation = sprout::compost::wavetable_cubic>
+		struct wavetable_value {
+		public:
+			typedef Table table_type;
+			typedef Interpolation interpolation_type;
+			typedef typename table_type::value_type value_type;
+			typedef typename table_type::size_type size_type;
+		private:
+			value_type frequency_;
+			value_type amplitude_;
+			value_type phase_;
+			size_type level_;
+		public:
+			SPROUT_CONSTEXPR wavetable_value()
+				: frequency_(1), amplitude_(1), phase_(0), level_(table_type::level_for(1))
+			{}
+			SPROUT_CONSTEXPR wavetable_value(
+				value_type const& frequency,
+				value_type const& amplitude,
+				value_type const& phase
+				)
+				: frequency_(frequency), amplitude_(amplitude), phase_(phase)
+				, level_(table_type::level_for(frequency))
+			{}
+			SPROUT_CONSTEXPR value_type const& frequency() const {
+				return frequency_;
+			}
+			SPROUT_CONSTEXPR value_type const& amplitude() const {
+				return amplitude_;
+			}
+			SPROUT_CONSTEXPR value_type const& phase() const {
+				return phase_;
+			}
+			SPROUT_CONSTEXPR size_type level() const {
+				return level_;
+			}
+			SPROUT_CONSTEXPR value_type operator()(std::ptrdiff_t i) const {
+				return amplitude_ == 0 ? value_type(0)
+					: amplitude_ * interpolation_type::template at<table_type>(level_, frequency_ * value_type(i) + phase_)
+					;
+			}
+		};
+
+		namespace waves {
+			//
+			// wavetable_wave_range
+			//
+			template<typename Table, typename Interpolation = sprout::compost::wavetable_cubic, typename Range = void>
+			class wavetable_wave_range
+				: public sprout::adaptors::detail::adapted_range_default<
+					Range,
+					sprout::transform_iterator<
+						sprout::compost::wavetable_value<Table, Interpolation>,
+						sprout::counting_iterator<std::ptrdiff_t>
+					>
+				>
+			{
+			public:
+				typedef sprout::adaptors::detail::adapted_range_default<
+					Range,
+					sprout::transform_iterator<
+						sprout::compost::wavetable_value<Table, Interpolation>,
+						sprout::counting_iterator<std::ptrdiff_t>
+					>
+				> base_type;
+				typedef typename base_type::range_type range_type;
+				typedef typename base_type::iterator iterator;
+				typedef typename base_type::value_type value_type;
+				typedef sprout::compost::wavetable_value<Table, Interpolation> functor_type;
+			public:
+				SPROUT_CONSTEXPR wavetable_wave_range() SPROUT_DEFAULTED_DEFAULT_CONSTRUCTOR_DECL
+				wavetable_wave_range(wavetable_wave_range const&) = default;
+				explicit SPROUT_CONSTEXPR wavetable_wave_range(
+					range_type& range,
+					value_type const& frequency = 1,
+					value_type const& amplitude = 1,
+					value_type const& phase = 0
+					)
+					: base_type(
+						iterator(sprout::counting_iterator<std::ptrdiff_t>(0), functor_type(frequency, amplitude, phase)),
+						iterator(
+							sprout::counting_iterator<std::ptrdiff_t>(sprout::size(range)),
+							functor_type(frequency, amplitude, phase)
+							)
+						)
+				{}
+				SPROUT_CONSTEXPR value_type frequency() const {
+					return base_type::begin().functor().frequency();
+				}
+				SPROUT_CONSTEXPR value_type amplitude() const {
+					return base_type::begin().functor().amplitude();
+				}
+				SPROUT_CONSTEXPR value_type phase() const {
+					return base_type::begin().functor().phase();
+				}
+			};
+
+			template<typename Table, typename Interpolation>
+			class wavetable_wave_range<Table, Interpolation, void>
+				: public sprout::range::range_container<
+					sprout::transform_iterator<
+						sprout::compost::wavetable_value<Table, Interpolation>,
+						sprout::counting_iterator<std::ptrdiff_t>
+					>
+				>
+			{
+			public:
+				typedef sprout::range::range_container<
+					sprout::transform_iterator<
+						sprout::compost::wavetable_value<Table, Interpolation>,
+						sprout::counting_iterator<std::ptrdiff_t>
+					>
+				> base_type;
+				typedef typename base_type::iterator iterator;
+				typedef typename base_type::value_type value_type;
+				typedef sprout::compost::wavetable_value<Table, Interpolation> functor_type;
+			public:
+				SPROUT_CONSTEXPR wavetable_wave_range() SPROUT_DEFAULTED_DEFAULT_CONSTRUCTOR_DECL
+				wavetable_wave_range(wavetable_wave_range const&) = default;
+				explicit SPROUT_CONSTEXPR wavetable_wave_range(
+					value_type const& frequency = 1,
+					value_type const& amplitude = 1,
+					value_type const& phase = 0
+					)
+					: base_type(
+						iterator(sprout::counting_iterator<std::ptrdiff_t>(0), functor_type(frequency, amplitude, phase)),
+						iterator(sprout::counting_iterator<std::ptrdiff_t>(), functor_type(frequency, amplitude, phase))
+						)
+				{}
+				SPROUT_CONSTEXPR value_type frequency() const {
+					return base_type::begin().functor().frequency();
+				}
+				SPROUT_CONSTEXPR value_type amplitude() const {
+					return base_type::begin().functor().amplitude();
+				}
+				SPROUT_CONSTEXPR value_type phase() const {
+					return base_type::begin().functor().phase();
+				}
+			};
+
+			//
+			// wavetable_wave_forwarder
+			//
+			class wavetable_wave_forwarder {
+			public:
+				template<typename Table>
+				SPROUT_CONSTEXPR sprout::compost::waves::wavetable_wave_range<Table>
+				operator()(
+					Table const&,
+					typename Table::value_type const& frequency = 1,
+					typename Table::value_type const& amplitude = 1,
+					typename Table::value_type const& phase = 0
+					) const
+				{
+					return sprout::compost::waves::wavetable_wave_range<Table>(frequency, amplitude, phase);
+				}
+				template<
+					typename Table, typename Interpolation,
+					typename sprout::enabler_if<!std::is_arithmetic<Interpolation>::value>::type = sprout::enabler
+				>
+				SPROUT_CONSTEXPR sprout::compost::waves::wavetable_wave_range<Table, Interpolation>
+				operator()(
+					Table const&,
+					Interpolation const&,
+					typename Table::value_type const& frequency = 1,
+					typename Table::value_type const& amplitude = 1,
+					typename Table::value_type const& phase = 0
+					) const
+				{
+					return sprout::compost::waves::wavetable_wave_range<Table, Interpolation>(frequency, amplitude, phase);
+				}
+			};
+
+			//
+			// wavetable_wave
+			//
+			namespace {
+				SPROUT_STATIC_CONSTEXPR sprout::compost::waves::wavetable_wave_forwarder wavetable_wave = {};
+			}	// anonymous-namespace
+
+			//
+			// operator|
+			//
+			template<typename Range, typename Table, typename Interpolation>
+			inline SPROUT_CONSTEXPR sprout::compost::waves::wavetable_wave_range<
+				Table, Interpolation,
+				typename std::remove_reference<typename sprout::lvalue_reference<Range>::type>::type
+			>
+			operator|(Range&& lhs, sprout::compost::waves::wavetable_wave_range<Table, Interpolation> const& rhs) {
+				return sprout::compost::waves::wavetable_wave_range<
+					Table, Interpolation,
+					typename std::remove_reference<typename sprout::lvalue_reference<Range>::type>::type
+				>(
+					sprout::lvalue_forward<Range>(lhs),
+					rhs.frequency(), rhs.amplitude(), rhs.phase()
+					);
+			}
+		}	// namespace waves
+
+		using sprout::compost::waves::wavetable_wave;
+	}	// namespace compost
+
+	//
+	// container_construct_traits
+	//
+	template<typename Table, typename Interpolation, typename Range>
+	struct container_construct_traits<sprout::compost::waves::wavetable_wave_range<Table, Interpolation, Range> >
+		: public sprout::container_construct_traits<typename sprout::compost::waves::wavetable_wave_range<Table, Interpolation, Range>::base_type>
+	{};
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_COMPOST_WAVES_WAVETABLE_WAVE_HPP
@@ -56,6 +56,7 @@
 //#define SPROUT_CONFIG_DISABLE_BUILTIN_CMATH_FUNCTION
 //#define SPROUT_CONFIG_DISABLE_BUILTIN_COPYSIGN_FUNCTION
 //#define SPROUT_CONFIG_DISABLE_BUILTIN_BIT_OPERATION
+//#define SPROUT_CONFIG_DISABLE_SIMD
 
 //
 // Configuration to switch the implementation details
@@ -16,8 +16,12 @@
 #include <sprout/limits.hpp>
 #include <sprout/iterator/operation.hpp>
 #include <sprout/ctype/ascii.hpp>
+#include <sprout/type_traits/enabler_if.hpp>
 #include <sprout/detail/char_literal.hpp>
 #include <sprout/detail/char_type_of_consecutive.hpp>
+#include <sprout/detail/simd.hpp>
+#include <sprout/charconv/detail/shortest_float.hpp>
+#include <sprout/charconv/detail/decimal_to_float.hpp>
 
 namespace sprout {
 	namespace detail {
@@ -101,7 +105,7 @@ namespace sprout {
 					number,
 					num_digits,
 					num_decimals,
-					negative ? exponent + n : exponent - n
+					negative ? exponent - n : exponent + n
 					)
 				;
 		}
@@ -127,7 +131,8 @@ namespace sprout {
 						num_decimals,
 						exponent
 						)
-					: sprout::detail::str_to_float_impl_exponent_1<FloatType>(
+					: *sprout::next(str) == SPROUT_CHAR_LITERAL('+', char_type)
+					? sprout::detail::str_to_float_impl_exponent_1<FloatType>(
 						sprout::next(str, 2),
 						false,
 						number,
@@ -135,6 +140,14 @@ namespace sprout {
 						num_decimals,
 						exponent
 						)
+					: sprout::detail::str_to_float_impl_exponent_1<FloatType>(
+						sprout::next(str),
+						false,
+						number,
+						num_digits,
+						num_decimals,
+						exponent
+						)
 				: sprout::detail::str_to_float_impl_exponent_2<FloatType>(
 					str,
 					negative,
@@ -258,6 +271,77 @@ namespace sprout {
 #endif
 				;
 		}
+
+		//
+		// str_to_float_rounded
+		//
+		//	Correctly rounded float or double, with the leading whitespace and
+		//	sign of strtod. Out of range values become infinity or zero.
+		//
+		template<typename FloatType, typename Elem>
+		inline SPROUT_CXX14_CONSTEXPR FloatType
+		str_to_float_rounded(Elem const* str) {
+			while (sprout::ascii::isspace(*str)) {
+				++str;
+			}
+			bool negative = false;
+			if (*str == SPROUT_CHAR_LITERAL('-', Elem)) {
+				negative = true;
+				++str;
+			} else if (*str == SPROUT_CHAR_LITERAL('+', Elem)) {
+				++str;
+			}
+			if (*str == SPROUT_CHAR_LITERAL('-', Elem)) {
+				return FloatType();
+			}
+			// bound the scan by what can belong to a number, nan(chars) included
+			Elem const* last = str;
+			while (sprout::detail::decimal_to_float_is_digit(*last) || *last == SPROUT_CHAR_LITERAL('.', Elem)) {
+				++last;
+			}
+			while (sprout::ascii::isalnum(*last) || *last == SPROUT_CHAR_LITERAL('.', Elem)
+				|| *last == SPROUT_CHAR_LITERAL('+', Elem) || *last == SPROUT_CHAR_LITERAL('-', Elem)
+				|| *last == SPROUT_CHAR_LITERAL('_', Elem) || *last == SPROUT_CHAR_LITERAL('(', Elem)
+				|| *last == SPROUT_CHAR_LITERAL(')', Elem)
+				)
+			{
+				++last;
+			}
+			FloatType value = FloatType();
+			sprout::detail::decimal_to_float(str, last, value, true);
+			return negative ? -value : value;
+		}
+
+		//
+		// str_to_float_dispatch
+		//
+		//	float and double take str_to_float_rounded wherever it can run; the
+		//	recursive parser remains for C++11 constant evaluation and long double.
+		//
+		template<
+			typename FloatType, typename Elem,
+			typename sprout::enabler_if<sprout::detail::is_shortest_float<FloatType>::value>::type = sprout::enabler
+		>
+		inline SPROUT_CONSTEXPR FloatType
+		str_to_float_dispatch(Elem const* str) {
+#if !defined(SPROUT_CONFIG_DISABLE_CXX14_CONSTEXPR)
+			return sprout::detail::str_to_float_rounded<FloatType>(str);
+#elif defined(SPROUT_DETAIL_HAS_IS_CONSTANT_EVALUATED)
+			return __builtin_is_constant_evaluated() ? sprout::detail::str_to_float<FloatType>(str)
+				: sprout::detail::str_to_float_rounded<FloatType>(str)
+				;
+#else
+			return sprout::detail::str_to_float<FloatType>(str);
+#endif
+		}
+		template<
+			typename FloatType, typename Elem,
+			typename sprout::enabler_if<!sprout::detail::is_shortest_float<FloatType>::value>::type = sprout::enabler
+		>
+		inline SPROUT_CONSTEXPR FloatType
+		str_to_float_dispatch(Elem const* str) {
+			return sprout::detail::str_to_float<FloatType>(str);
+		}
 	}	// namespace detail
 
 	//
@@ -278,7 +362,7 @@ namespace sprout {
 		FloatType
 	>::type
 	str_to_float(Char const* str, std::nullptr_t) {
-		return sprout::detail::str_to_float<FloatType>(str);
+		return sprout::detail::str_to_float_dispatch<FloatType>(str);
 	}
 
 	template<typename FloatType, typename Char>
@@ -287,7 +371,7 @@ namespace sprout {
 		FloatType
 	>::type
 	str_to_float(Char const* str) {
-		return sprout::detail::str_to_float<FloatType>(str);
+		return sprout::detail::str_to_float_dispatch<FloatType>(str);
 	}
 }	// namespace sprout
 
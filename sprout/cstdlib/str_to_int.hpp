@@ -17,8 +17,11 @@
 #include <sprout/type_traits/is_unsigned.hpp>
 #include <sprout/iterator/operation.hpp>
 #include <sprout/ctype/ascii.hpp>
+#include <sprout/cstdint.hpp>
 #include <sprout/detail/char_literal.hpp>
 #include <sprout/detail/char_conversion.hpp>
+#include <sprout/detail/simd.hpp>
+#include <sprout/detail/eight_digits.hpp>
 #if !defined(_MSC_VER)
 #	include <cinttypes>
 #endif
@@ -31,7 +34,7 @@ namespace sprout {
 		inline SPROUT_CONSTEXPR IntType
 		str_to_int_impl_1(NullTerminatedIterator const& str, int base, IntType val, IntType x, bool negative) {
 			return x == static_cast<IntType>(-1) ? (negative ? -1 * val : val)
-				: val > (sprout::numeric_limits<IntType>::max() - x - (negative ? 1 : 0)) / base
+				: val > (sprout::numeric_limits<IntType>::max() - x) / base
 					? (negative ? sprout::numeric_limits<IntType>::min() : sprout::numeric_limits<IntType>::max())
 				: sprout::detail::str_to_int_impl_1<IntType>(
 					sprout::next(str),
@@ -129,6 +132,68 @@ namespace sprout {
 #endif
 				;
 		}
+
+		//
+		// str_to_int_decimal
+		//
+		//	Runtime base 10 conversion of char text: the digit run is measured
+		//	first and taken eight digits per step. Anything else, including runs
+		//	longer than 19 digits, is left to the general conversion.
+		//
+		template<typename IntType, typename Char>
+		inline IntType
+		str_to_int_decimal(Char const* str, int base) {
+			return sprout::detail::str_to_int<IntType>(str, base);
+		}
+		template<typename IntType>
+		inline IntType
+		str_to_int_decimal(char const* str, int base) {
+			char const* p = str;
+			while (sprout::ascii::isspace(*p)) {
+				++p;
+			}
+			bool negative = false;
+			if (*p == '-' && sprout::is_signed<IntType>::value) {
+				negative = true;
+				++p;
+			} else if (*p == '+') {
+				++p;
+			}
+			char const* last = p;
+			while (*last >= '0' && *last <= '9') {
+				++last;
+			}
+			if (sizeof(IntType) > sizeof(std::uint64_t) || last - p > 19 || !(base == 10 || (base == 0 && *p != '0'))) {
+				return sprout::detail::str_to_int<IntType>(str, base);
+			}
+			std::uint64_t val = 0;
+			for (; last - p >= 8; p += 8) {
+				val = val * 100000000 + sprout::detail::parse_eight_digits(sprout::detail::load_eight_digits(p));
+			}
+			for (; p != last; ++p) {
+				val = val * 10 + static_cast<unsigned>(*p - '0');
+			}
+			std::uint64_t const max = static_cast<std::uint64_t>(sprout::numeric_limits<IntType>::max());
+			if (negative) {
+				return val > max ? sprout::numeric_limits<IntType>::min() : static_cast<IntType>(-static_cast<IntType>(val));
+			}
+			return val > max ? sprout::numeric_limits<IntType>::max() : static_cast<IntType>(val);
+		}
+
+		//
+		// str_to_int_dispatch
+		//
+		template<typename IntType, typename Char>
+		inline SPROUT_CONSTEXPR IntType
+		str_to_int_dispatch(Char const* str, int base) {
+#if defined(SPROUT_DETAIL_HAS_IS_CONSTANT_EVALUATED)
+			return __builtin_is_constant_evaluated() ? sprout::detail::str_to_int<IntType>(str, base)
+				: sprout::detail::str_to_int_decimal<IntType>(str, base)
+				;
+#else
+			return sprout::detail::str_to_int<IntType>(str, base);
+#endif
+		}
 	}	// namespace detail
 
 	//
@@ -149,7 +214,7 @@ namespace sprout {
 		IntType
 	>::type
 	str_to_int(Char const* str, std::nullptr_t, int base = 10) {
-		return sprout::detail::str_to_int<IntType>(str, base);
+		return sprout::detail::str_to_int_dispatch<IntType>(str, base);
 	}
 
 	template<typename IntType, typename Char>
@@ -158,7 +223,7 @@ namespace sprout {
 		IntType
 	>::type
 	str_to_int(Char const* str, int base = 10) {
-		return sprout::detail::str_to_int<IntType>(str, base);
+		return sprout::detail::str_to_int_dispatch<IntType>(str, base);
 	}
 }	// namespace sprout
 
@@ -13,5 +13,6 @@
 #include <sprout/ctype/ascii.hpp>
 #include <sprout/ctype/wascii.hpp>
 #include <sprout/ctype/functor.hpp>
+#include <sprout/ctype/bulk.hpp>
 
 #endif	// #ifndef SPROUT_CTYPE_HPP
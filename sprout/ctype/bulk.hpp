@@ -0,0 +1,200 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_CTYPE_BULK_HPP
+#define SPROUT_CTYPE_BULK_HPP
+
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/type_traits/integral_constant.hpp>
+#include <sprout/container/functions.hpp>
+#include <sprout/ctype/ascii.hpp>
+#include <sprout/ctype/functor.hpp>
+#include <sprout/detail/ascii_scan.hpp>
+
+namespace sprout {
+	namespace ascii {
+		namespace detail {
+			//
+			// class_of
+			//
+			//	The table classes a sprout::ctypes classification functor tests for
+			//	char, or 0 for any other predicate.
+			//
+			template<typename Predicate>
+			struct class_of
+				: public sprout::integral_constant<std::size_t, 0>
+			{};
+
+#define SPROUT_CTYPE_BULK_CLASS_OF_DECL(NAME, CLASS) \
+			template<> \
+			struct class_of<sprout::ctypes::NAME<void> > \
+				: public sprout::integral_constant<std::size_t, (CLASS)> \
+			{}; \
+			template<> \
+			struct class_of<sprout::ctypes::NAME<char> > \
+				: public sprout::integral_constant<std::size_t, (CLASS)> \
+			{};
+
+			SPROUT_CTYPE_BULK_CLASS_OF_DECL(is_alnum, sprout::ascii::detail::alpha | sprout::ascii::detail::digit)
+			SPROUT_CTYPE_BULK_CLASS_OF_DECL(is_alpha, sprout::ascii::detail::alpha)
+			SPROUT_CTYPE_BULK_CLASS_OF_DECL(is_blank, sprout::ascii::detail::blank)
+			SPROUT_CTYPE_BULK_CLASS_OF_DECL(is_cntrl, sprout::ascii::detail::cntrl)
+			SPROUT_CTYPE_BULK_CLASS_OF_DECL(is_digit, sprout::ascii::detail::digit)
+			SPROUT_CTYPE_BULK_CLASS_OF_DECL(is_graph, sprout::ascii::detail::graph)
+			SPROUT_CTYPE_BULK_CLASS_OF_DECL(is_lower, sprout::ascii::detail::lower)
+			SPROUT_CTYPE_BULK_CLASS_OF_DECL(is_print, sprout::ascii::detail::print)
+			SPROUT_CTYPE_BULK_CLASS_OF_DECL(is_punct, sprout::ascii::detail::punct)
+			SPROUT_CTYPE_BULK_CLASS_OF_DECL(is_space, sprout::ascii::detail::space)
+			SPROUT_CTYPE_BULK_CLASS_OF_DECL(is_upper, sprout::ascii::detail::upper)
+			SPROUT_CTYPE_BULK_CLASS_OF_DECL(is_xdigit, sprout::ascii::detail::xdigit)
+
+			template<typename Elem, typename Predicate>
+			inline SPROUT_CXX14_CONSTEXPR std::size_t
+			count_if(Elem const* first, Elem const* last, Predicate pred) {
+				std::size_t result = 0;
+				for (; first != last; ++first) {
+					result += pred(*first) ? 1 : 0;
+				}
+				return result;
+			}
+			template<typename Predicate>
+			inline SPROUT_CXX14_CONSTEXPR std::size_t
+			count_if(char const* first, char const* last, Predicate pred) {
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+				if (sprout::ascii::detail::class_of<Predicate>::value != 0 && !SPROUT_DETAIL_IS_CONSTANT_EVALUATED()) {
+					return sprout::detail::ascii_count<sprout::ascii::detail::class_of<Predicate>::value>(first, last);
+				}
+#endif
+				std::size_t result = 0;
+				for (; first != last; ++first) {
+					result += pred(*first) ? 1 : 0;
+				}
+				return result;
+			}
+
+			// the first element for which pred is Result, or last
+			template<bool Result, typename Elem, typename Predicate>
+			inline SPROUT_CXX14_CONSTEXPR Elem const*
+			find_if(Elem const* first, Elem const* last, Predicate pred) {
+				for (; first != last; ++first) {
+					if (static_cast<bool>(pred(*first)) == Result) {
+						break;
+					}
+				}
+				return first;
+			}
+			template<bool Result, typename Predicate>
+			inline SPROUT_CXX14_CONSTEXPR char const*
+			find_if(char const* first, char const* last, Predicate pred) {
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+				if (sprout::ascii::detail::class_of<Predicate>::value != 0 && !SPROUT_DETAIL_IS_CONSTANT_EVALUATED()) {
+					return sprout::detail::ascii_find<sprout::ascii::detail::class_of<Predicate>::value, Result>(first, last);
+				}
+#endif
+				for (; first != last; ++first) {
+					if (static_cast<bool>(pred(*first)) == Result) {
+						break;
+					}
+				}
+				return first;
+			}
+
+			template<typename Elem>
+			inline SPROUT_CXX14_CONSTEXPR void
+			to_lower(Elem* first, Elem* last) {
+				for (; first != last; ++first) {
+					*first = sprout::ascii::tolower(*first);
+				}
+			}
+			inline SPROUT_CXX14_CONSTEXPR void
+			to_lower(char* first, char* last) {
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+				if (!SPROUT_DETAIL_IS_CONSTANT_EVALUATED()) {
+					return sprout::detail::ascii_convert_case(first, last, first, 0x41, 0x5A);
+				}
+#endif
+				for (; first != last; ++first) {
+					*first = sprout::ascii::tolower(*first);
+				}
+			}
+			template<typename Elem>
+			inline SPROUT_CXX14_CONSTEXPR void
+			to_upper(Elem* first, Elem* last) {
+				for (; first != last; ++first) {
+					*first = sprout::ascii::toupper(*first);
+				}
+			}
+			inline SPROUT_CXX14_CONSTEXPR void
+			to_upper(char* first, char* last) {
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+				if (!SPROUT_DETAIL_IS_CONSTANT_EVALUATED()) {
+					return sprout::detail::ascii_convert_case(first, last, first, 0x61, 0x7A);
+				}
+#endif
+				for (; first != last; ++first) {
+					*first = sprout::ascii::toupper(*first);
+				}
+			}
+		}	// namespace detail
+
+		//
+		// count_if
+		// all_of
+		// any_of
+		// none_of
+		//
+		//	Over a contiguous character range. For char and the sprout::ctypes
+		//	classification functors (is_space<>, is_alnum<char>, ...) the runtime path
+		//	classifies 16 or 32 bytes at a time; other predicates are called per element.
+		//
+		template<typename Range, typename Predicate>
+		inline SPROUT_CXX14_CONSTEXPR std::size_t
+		count_if(Range const& rng, Predicate pred) {
+			return sprout::ascii::detail::count_if(sprout::data(rng), sprout::data(rng) + sprout::size(rng), pred);
+		}
+		template<typename Range, typename Predicate>
+		inline SPROUT_CXX14_CONSTEXPR bool
+		all_of(Range const& rng, Predicate pred) {
+			return sprout::ascii::detail::find_if<false>(sprout::data(rng), sprout::data(rng) + sprout::size(rng), pred)
+				== sprout::data(rng) + sprout::size(rng)
+				;
+		}
+		template<typename Range, typename Predicate>
+		inline SPROUT_CXX14_CONSTEXPR bool
+		any_of(Range const& rng, Predicate pred) {
+			return sprout::ascii::detail::find_if<true>(sprout::data(rng), sprout::data(rng) + sprout::size(rng), pred)
+				!= sprout::data(rng) + sprout::size(rng)
+				;
+		}
+		template<typename Range, typename Predicate>
+		inline SPROUT_CXX14_CONSTEXPR bool
+		none_of(Range const& rng, Predicate pred) {
+			return !sprout::ascii::any_of(rng, pred);
+		}
+
+		//
+		// to_lower
+		// to_upper
+		//
+		//	Convert a contiguous character range in place, as tolower/toupper on each
+		//	element; the runtime path for char converts 16 or 32 bytes at a time.
+		//
+		template<typename Range>
+		inline SPROUT_CXX14_CONSTEXPR void
+		to_lower(Range& rng) {
+			sprout::ascii::detail::to_lower(sprout::data(rng), sprout::data(rng) + sprout::size(rng));
+		}
+		template<typename Range>
+		inline SPROUT_CXX14_CONSTEXPR void
+		to_upper(Range& rng) {
+			sprout::ascii::detail::to_upper(sprout::data(rng), sprout::data(rng) + sprout::size(rng));
+		}
+	}	// namespace ascii
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_CTYPE_BULK_HPP
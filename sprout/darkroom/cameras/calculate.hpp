@@ -8,7 +8,13 @@
 #ifndef SPROUT_DARKROOM_CAMERAS_CALCULATE_HPP
 #define SPROUT_DARKROOM_CAMERAS_CALCULATE_HPP
 
+#include <utility>
+#include <type_traits>
 #include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/index_tuple/metafunction.hpp>
+#include <sprout/array/array.hpp>
+#include <sprout/type_traits/integral_constant.hpp>
 #include <sprout/type_traits/identity.hpp>
 
 namespace sprout {
@@ -42,6 +48,73 @@ namespace sprout {
 			calculate(Camera const& camera, Unit2D const& x, Unit2D const& y, Unit2D const& width, Unit2D const& height) {
 				return camera(x, y, width, height);
 			}
+
+			namespace detail {
+				template<typename Camera, std::size_t N, typename Unit2D>
+				struct has_mem_scanline_test {
+				public:
+					template<
+						typename U = Camera,
+						typename = typename sprout::identity<decltype(std::declval<U const&>().template scanline<N>(
+							std::declval<Unit2D const&>(), std::declval<Unit2D const&>(), std::declval<Unit2D const&>(), std::declval<Unit2D const&>()
+							))>::type
+					>
+					static sprout::true_type test(int);
+					static sprout::false_type test(...);
+				};
+#if defined(_MSC_VER) && (_MSC_VER > 1900)
+				template<
+					typename Camera, std::size_t N, typename Unit2D,
+					typename Base_ = typename sprout::identity<decltype(sprout::darkroom::cameras::detail::has_mem_scanline_test<Camera, N, Unit2D>::test(0))>::type
+				>
+				struct has_mem_scanline
+					: public Base_
+				{};
+#else
+				template<typename Camera, std::size_t N, typename Unit2D>
+				struct has_mem_scanline
+					: public sprout::identity<decltype(sprout::darkroom::cameras::detail::has_mem_scanline_test<Camera, N, Unit2D>::test(0))>::type
+				{};
+#endif
+
+				template<std::size_t N, typename Camera, typename Unit2D, sprout::index_t... Indexes>
+				inline SPROUT_CONSTEXPR sprout::array<typename sprout::darkroom::cameras::calculate_result<Camera, Unit2D>::type, N>
+				calculate_scanline_impl(
+					Camera const& camera, Unit2D const& x, Unit2D const& y, Unit2D const& width, Unit2D const& height,
+					sprout::index_tuple<Indexes...>
+					)
+				{
+					return sprout::array<typename sprout::darkroom::cameras::calculate_result<Camera, Unit2D>::type, N>{{
+						sprout::darkroom::cameras::calculate(camera, static_cast<Unit2D>(x + Indexes), y, width, height)...
+						}};
+				}
+			}	// namespace detail
+
+			//
+			// calculate_scanline
+			//
+			//	The rays of the N pixels from (x, y) along the scanline y: camera.scanline<N>
+			//	where the camera has it, and one calculate per pixel otherwise.
+			//
+			template<std::size_t N, typename Camera, typename Unit2D>
+			inline SPROUT_CONSTEXPR typename std::enable_if<
+				sprout::darkroom::cameras::detail::has_mem_scanline<Camera, N, Unit2D>::value,
+				sprout::array<typename sprout::darkroom::cameras::calculate_result<Camera, Unit2D>::type, N>
+			>::type
+			calculate_scanline(Camera const& camera, Unit2D const& x, Unit2D const& y, Unit2D const& width, Unit2D const& height) {
+				return camera.template scanline<N>(x, y, width, height);
+			}
+			template<std::size_t N, typename Camera, typename Unit2D>
+			inline SPROUT_CONSTEXPR typename std::enable_if<
+				!sprout::darkroom::cameras::detail::has_mem_scanline<Camera, N, Unit2D>::value,
+				sprout::array<typename sprout::darkroom::cameras::calculate_result<Camera, Unit2D>::type, N>
+			>::type
+			calculate_scanline(Camera const& camera, Unit2D const& x, Unit2D const& y, Unit2D const& width, Unit2D const& height) {
+				return sprout::darkroom::cameras::detail::calculate_scanline_impl<N>(
+					camera, x, y, width, height,
+					sprout::make_index_tuple<N>::make()
+					);
+			}
 		}	// namespace cameras
 	}	// namespace darkroom
 }	// namespace sprout
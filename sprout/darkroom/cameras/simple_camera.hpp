@@ -9,11 +9,16 @@
 #define SPROUT_DARKROOM_CAMERAS_SIMPLE_CAMERA_HPP
 
 #include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/index_tuple/metafunction.hpp>
+#include <sprout/array/array.hpp>
 #include <sprout/tuple/tuple.hpp>
+#include <sprout/tuple/functions.hpp>
 #include <sprout/math/sin.hpp>
 #include <sprout/math/cos.hpp>
 #include <sprout/math/sqrt.hpp>
 #include <sprout/darkroom/coords/vector.hpp>
+#include <sprout/darkroom/coords/soa.hpp>
 #include <sprout/darkroom/cameras/angle_of_view.hpp>
 
 namespace sprout {
@@ -93,6 +98,34 @@ namespace sprout {
 						-(static_cast<unit_type>(y) / height - 0.5)
 						);
 				}
+				template<typename Unit2D>
+				SPROUT_CONSTEXPR position_type
+				target(Unit2D const& x, Unit2D const& y, Unit2D const& width, Unit2D const& height) const {
+					return (reference_value_ == angle_of_view_reference::long_side && width >= height)
+						|| (reference_value_ == angle_of_view_reference::short_side && width < height)
+						|| reference_value_ == angle_of_view_reference::width
+						? reference_width(x, y, width, height, static_cast<unit_type>(height) / width)
+						: reference_height(x, y, width, height, static_cast<unit_type>(width) / height)
+						;
+				}
+				template<typename Unit2D, sprout::index_t... Indexes>
+				SPROUT_CONSTEXPR sprout::array<position_type, sizeof...(Indexes)>
+				targets(
+					Unit2D const& x, Unit2D const& y, Unit2D const& width, Unit2D const& height,
+					sprout::index_tuple<Indexes...>
+					) const
+				{
+					return sprout::array<position_type, sizeof...(Indexes)>{{
+						target(static_cast<Unit2D>(x + Indexes), y, width, height)...
+						}};
+				}
+				template<std::size_t N, sprout::index_t... Indexes>
+				SPROUT_CONSTEXPR sprout::array<ray_type, N>
+				scanline_impl(sprout::darkroom::coords::vec3_soa<unit_type, N> const& dirs, sprout::index_tuple<Indexes...>) const {
+					return sprout::array<ray_type, N>{{
+						ray_type(position_, sprout::tuples::remake<position_type>(position_, dirs.x[Indexes], dirs.y[Indexes], dirs.z[Indexes]))...
+						}};
+				}
 			public:
 				explicit SPROUT_CONSTEXPR basic_simple_camera(
 					unit_type const& far_plane,
@@ -112,15 +145,44 @@ namespace sprout {
 				operator()(Unit2D const& x, Unit2D const& y, Unit2D const& width, Unit2D const& height) const {
 					return ray_type(
 						position_,
-						sprout::darkroom::coords::normalize(
-							(reference_value_ == angle_of_view_reference::long_side && width >= height)
-								|| (reference_value_ == angle_of_view_reference::short_side && width < height)
-								|| reference_value_ == angle_of_view_reference::width
-								? reference_width(x, y, width, height, static_cast<unit_type>(height) / width)
-								: reference_height(x, y, width, height, static_cast<unit_type>(width) / height)
-							)
+						sprout::darkroom::coords::normalize(target(x, y, width, height))
 						);
 				}
+				//
+				// directions
+				//
+				//	The unit directions of the N pixels from (x, y) along the scanline y,
+				//	normalized in one batch.
+				//
+				template<std::size_t N, typename Unit2D>
+				SPROUT_CONSTEXPR sprout::darkroom::coords::vec3_soa<unit_type, N>
+				directions(Unit2D const& x, Unit2D const& y, Unit2D const& width, Unit2D const& height) const {
+					return sprout::darkroom::coords::normalize(
+						sprout::darkroom::coords::make_vec3_soa(targets(x, y, width, height, sprout::make_index_tuple<N>::make()))
+						);
+				}
+				template<typename Unit2D>
+				void directions(
+					Unit2D const& x, Unit2D const& y, Unit2D const& width, Unit2D const& height,
+					sprout::darkroom::coords::vec3_soa_span<unit_type> const& result
+					) const
+				{
+					for (std::size_t i = 0; i != result.size(); ++i) {
+						result.set(i, target(static_cast<Unit2D>(x + i), y, width, height));
+					}
+					sprout::darkroom::coords::normalize(result, result);
+				}
+				//
+				// scanline
+				//
+				//	The rays of the N pixels from (x, y) as operator() gives them, with the
+				//	directions from directions<N>.
+				//
+				template<std::size_t N, typename Unit2D>
+				SPROUT_CONSTEXPR sprout::array<ray_type, N>
+				scanline(Unit2D const& x, Unit2D const& y, Unit2D const& width, Unit2D const& height) const {
+					return scanline_impl(directions<N>(x, y, width, height), sprout::make_index_tuple<N>::make());
+				}
 			};
 			//
 			// make_simple_camera
@@ -10,5 +10,6 @@
 
 #include <sprout/config.hpp>
 #include <sprout/darkroom/coords/vector.hpp>
+#include <sprout/darkroom/coords/soa.hpp>
 
 #endif	// #ifndef SPROUT_DARKROOM_COORDS_HPP
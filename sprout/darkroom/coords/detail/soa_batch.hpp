@@ -0,0 +1,237 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_DARKROOM_COORDS_DETAIL_SOA_BATCH_HPP
+#define SPROUT_DARKROOM_COORDS_DETAIL_SOA_BATCH_HPP
+
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/math/sqrt.hpp>
+#include <sprout/complex/detail/soa_batch.hpp>
+#include <sprout/detail/simd.hpp>
+
+namespace sprout {
+	namespace darkroom {
+		namespace coords {
+			namespace detail {
+				//
+				// vec3_soa_scalar
+				//
+				//	The formulas of the bulk operations. rotate_* turn (x, y, z) by the unit
+				//	quaternion w + (qx, qy, qz) as v + w * t + q x t with t = 2 (q x v),
+				//	which is q v q* without forming the products of quaternions.
+				//
+				struct vec3_soa_scalar {
+				public:
+					template<typename T>
+					static SPROUT_CONSTEXPR T dot(T const& x1, T const& y1, T const& z1, T const& x2, T const& y2, T const& z2) {
+						return x1 * x2 + y1 * y2 + z1 * z2;
+					}
+					template<typename T>
+					static SPROUT_CONSTEXPR T cross_x(T const&, T const& y1, T const& z1, T const&, T const& y2, T const& z2) {
+						return y1 * z2 - z1 * y2;
+					}
+					template<typename T>
+					static SPROUT_CONSTEXPR T cross_y(T const& x1, T const&, T const& z1, T const& x2, T const&, T const& z2) {
+						return z1 * x2 - x1 * z2;
+					}
+					template<typename T>
+					static SPROUT_CONSTEXPR T cross_z(T const& x1, T const& y1, T const&, T const& x2, T const& y2, T const&) {
+						return x1 * y2 - y1 * x2;
+					}
+					template<typename T>
+					static SPROUT_CONSTEXPR T length(T const& x, T const& y, T const& z) {
+						return sprout::math::sqrt(dot(x, y, z, x, y, z));
+					}
+				private:
+					template<typename T>
+					static SPROUT_CONSTEXPR T rotate_x_impl(T const& w, T const& qy, T const& qz, T const& x, T const& tx, T const& ty, T const& tz) {
+						return x + w * tx + (qy * tz - qz * ty);
+					}
+					template<typename T>
+					static SPROUT_CONSTEXPR T rotate_y_impl(T const& w, T const& qx, T const& qz, T const& y, T const& tx, T const& ty, T const& tz) {
+						return y + w * ty + (qz * tx - qx * tz);
+					}
+					template<typename T>
+					static SPROUT_CONSTEXPR T rotate_z_impl(T const& w, T const& qx, T const& qy, T const& z, T const& tx, T const& ty, T const& tz) {
+						return z + w * tz + (qx * ty - qy * tx);
+					}
+				public:
+					template<typename T>
+					static SPROUT_CONSTEXPR T rotate_x(T const& w, T const& qx, T const& qy, T const& qz, T const& x, T const& y, T const& z) {
+						return rotate_x_impl(
+							w, qy, qz, x,
+							2 * cross_x(qx, qy, qz, x, y, z), 2 * cross_y(qx, qy, qz, x, y, z), 2 * cross_z(qx, qy, qz, x, y, z)
+							);
+					}
+					template<typename T>
+					static SPROUT_CONSTEXPR T rotate_y(T const& w, T const& qx, T const& qy, T const& qz, T const& x, T const& y, T const& z) {
+						return rotate_y_impl(
+							w, qx, qz, y,
+							2 * cross_x(qx, qy, qz, x, y, z), 2 * cross_y(qx, qy, qz, x, y, z), 2 * cross_z(qx, qy, qz, x, y, z)
+							);
+					}
+					template<typename T>
+					static SPROUT_CONSTEXPR T rotate_z(T const& w, T const& qx, T const& qy, T const& qz, T const& x, T const& y, T const& z) {
+						return rotate_z_impl(
+							w, qx, qy, z,
+							2 * cross_x(qx, qy, qz, x, y, z), 2 * cross_y(qx, qy, qz, x, y, z), 2 * cross_z(qx, qy, qz, x, y, z)
+							);
+					}
+				};
+
+				//
+				// vec3_soa_dot
+				// vec3_soa_cross
+				// vec3_soa_normalize
+				// vec3_soa_rotate
+				//
+				//	Kernels over x, y and z planes for sprout::detail::complex_soa_run; the
+				//	results may be written over the operands.
+				//
+				template<typename T>
+				struct vec3_soa_dot {
+				public:
+					T const* x1;
+					T const* y1;
+					T const* z1;
+					T const* x2;
+					T const* y2;
+					T const* z2;
+					T* r;
+				public:
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+					template<typename Ops>
+					void vector(std::size_t i) const {
+						Ops::store(r + i, Ops::fmadd(
+							Ops::load(z1 + i), Ops::load(z2 + i),
+							Ops::fmadd(Ops::load(y1 + i), Ops::load(y2 + i), Ops::mul(Ops::load(x1 + i), Ops::load(x2 + i)))
+							));
+					}
+#endif
+					void scalar(std::size_t i) const {
+						r[i] = sprout::darkroom::coords::detail::vec3_soa_scalar::dot(x1[i], y1[i], z1[i], x2[i], y2[i], z2[i]);
+					}
+				};
+				template<typename T>
+				struct vec3_soa_cross {
+				public:
+					T const* x1;
+					T const* y1;
+					T const* z1;
+					T const* x2;
+					T const* y2;
+					T const* z2;
+					T* rx;
+					T* ry;
+					T* rz;
+				public:
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+					template<typename Ops>
+					void vector(std::size_t i) const {
+						typedef typename Ops::type type;
+						type const ax = Ops::load(x1 + i);
+						type const ay = Ops::load(y1 + i);
+						type const az = Ops::load(z1 + i);
+						type const bx = Ops::load(x2 + i);
+						type const by = Ops::load(y2 + i);
+						type const bz = Ops::load(z2 + i);
+						Ops::store(rx + i, Ops::fnmadd(az, by, Ops::mul(ay, bz)));
+						Ops::store(ry + i, Ops::fnmadd(ax, bz, Ops::mul(az, bx)));
+						Ops::store(rz + i, Ops::fnmadd(ay, bx, Ops::mul(ax, by)));
+					}
+#endif
+					void scalar(std::size_t i) const {
+						typedef sprout::darkroom::coords::detail::vec3_soa_scalar s;
+						T const x = s::cross_x(x1[i], y1[i], z1[i], x2[i], y2[i], z2[i]);
+						T const y = s::cross_y(x1[i], y1[i], z1[i], x2[i], y2[i], z2[i]);
+						T const z = s::cross_z(x1[i], y1[i], z1[i], x2[i], y2[i], z2[i]);
+						rx[i] = x;
+						ry[i] = y;
+						rz[i] = z;
+					}
+				};
+				template<typename T>
+				struct vec3_soa_normalize {
+				public:
+					T const* x;
+					T const* y;
+					T const* z;
+					T* rx;
+					T* ry;
+					T* rz;
+				public:
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+					template<typename Ops>
+					void vector(std::size_t i) const {
+						typedef typename Ops::type type;
+						type const vx = Ops::load(x + i);
+						type const vy = Ops::load(y + i);
+						type const vz = Ops::load(z + i);
+						type const len = Ops::sqrt(Ops::fmadd(vz, vz, Ops::fmadd(vy, vy, Ops::mul(vx, vx))));
+						Ops::store(rx + i, Ops::div(vx, len));
+						Ops::store(ry + i, Ops::div(vy, len));
+						Ops::store(rz + i, Ops::div(vz, len));
+					}
+#endif
+					void scalar(std::size_t i) const {
+						T const len = sprout::darkroom::coords::detail::vec3_soa_scalar::length(x[i], y[i], z[i]);
+						rx[i] = x[i] / len;
+						ry[i] = y[i] / len;
+						rz[i] = z[i] / len;
+					}
+				};
+				template<typename T>
+				struct vec3_soa_rotate {
+				public:
+					T w;
+					T qx;
+					T qy;
+					T qz;
+					T const* x;
+					T const* y;
+					T const* z;
+					T* rx;
+					T* ry;
+					T* rz;
+				public:
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+					template<typename Ops>
+					void vector(std::size_t i) const {
+						typedef typename Ops::type type;
+						type const vw = Ops::set1(w);
+						type const vqx = Ops::set1(qx);
+						type const vqy = Ops::set1(qy);
+						type const vqz = Ops::set1(qz);
+						type const two = Ops::set1(2);
+						type const vx = Ops::load(x + i);
+						type const vy = Ops::load(y + i);
+						type const vz = Ops::load(z + i);
+						type const tx = Ops::mul(two, Ops::fnmadd(vqz, vy, Ops::mul(vqy, vz)));
+						type const ty = Ops::mul(two, Ops::fnmadd(vqx, vz, Ops::mul(vqz, vx)));
+						type const tz = Ops::mul(two, Ops::fnmadd(vqy, vx, Ops::mul(vqx, vy)));
+						Ops::store(rx + i, Ops::add(Ops::fmadd(vw, tx, vx), Ops::fnmadd(vqz, ty, Ops::mul(vqy, tz))));
+						Ops::store(ry + i, Ops::add(Ops::fmadd(vw, ty, vy), Ops::fnmadd(vqx, tz, Ops::mul(vqz, tx))));
+						Ops::store(rz + i, Ops::add(Ops::fmadd(vw, tz, vz), Ops::fnmadd(vqy, tx, Ops::mul(vqx, ty))));
+					}
+#endif
+					void scalar(std::size_t i) const {
+						typedef sprout::darkroom::coords::detail::vec3_soa_scalar s;
+						T const vx = s::rotate_x(w, qx, qy, qz, x[i], y[i], z[i]);
+						T const vy = s::rotate_y(w, qx, qy, qz, x[i], y[i], z[i]);
+						T const vz = s::rotate_z(w, qx, qy, qz, x[i], y[i], z[i]);
+						rx[i] = vx;
+						ry[i] = vy;
+						rz[i] = vz;
+					}
+				};
+			}	// namespace detail
+		}	// namespace coords
+	}	// namespace darkroom
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_DARKROOM_COORDS_DETAIL_SOA_BATCH_HPP
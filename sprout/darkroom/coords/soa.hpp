@@ -0,0 +1,410 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_DARKROOM_COORDS_SOA_HPP
+#define SPROUT_DARKROOM_COORDS_SOA_HPP
+
+#include <type_traits>
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/index_tuple/metafunction.hpp>
+#include <sprout/array/array.hpp>
+#include <sprout/tuple/tuple.hpp>
+#include <sprout/math/quaternion/quaternion.hpp>
+#include <sprout/darkroom/coords/vector.hpp>
+#include <sprout/darkroom/coords/detail/soa_batch.hpp>
+#include <sprout/complex/detail/soa_batch.hpp>
+#include <sprout/detail/simd.hpp>
+
+namespace sprout {
+	namespace darkroom {
+		namespace coords {
+			//
+			// vec3_soa
+			//
+			//	N vectors of T stored as planes of x, y and z coordinates; an aggregate
+			//	initialized as {{x...}, {y...}, {z...}}. Elements are read as
+			//	sprout::tuples::tuple<T, T, T>, and set from any vector of the coords
+			//	functions.
+			//
+			template<typename T, std::size_t N>
+			class vec3_soa {
+			public:
+				typedef sprout::tuples::tuple<T, T, T> value_type;
+				typedef T unit_type;
+				typedef value_type const_reference;
+				typedef std::size_t size_type;
+			public:
+				SPROUT_STATIC_CONSTEXPR size_type static_size = N;
+			public:
+				unit_type x[N];
+				unit_type y[N];
+				unit_type z[N];
+			public:
+				static SPROUT_CONSTEXPR size_type size() SPROUT_NOEXCEPT {
+					return static_size;
+				}
+				SPROUT_CONSTEXPR const_reference operator[](size_type i) const {
+					return value_type(x[i], y[i], z[i]);
+				}
+				template<typename Vector>
+				SPROUT_CXX14_CONSTEXPR void set(size_type i, Vector const& v) {
+					x[i] = sprout::darkroom::coords::x(v);
+					y[i] = sprout::darkroom::coords::y(v);
+					z[i] = sprout::darkroom::coords::z(v);
+				}
+			};
+			template<typename T, std::size_t N>
+			SPROUT_CONSTEXPR_OR_CONST typename sprout::darkroom::coords::vec3_soa<T, N>::size_type sprout::darkroom::coords::vec3_soa<T, N>::static_size;
+
+			//
+			// vec3_soa_span
+			//
+			//	A non-owning vec3_soa of runtime size; vec3_soa_span<T const> is the
+			//	read-only span.
+			//
+			template<typename T>
+			class vec3_soa_span {
+			public:
+				typedef sprout::tuples::tuple<
+					typename std::remove_const<T>::type, typename std::remove_const<T>::type, typename std::remove_const<T>::type
+				> value_type;
+				typedef T unit_type;
+				typedef value_type const_reference;
+				typedef std::size_t size_type;
+			private:
+				T* x_;
+				T* y_;
+				T* z_;
+				size_type size_;
+			public:
+				SPROUT_CONSTEXPR vec3_soa_span() SPROUT_NOEXCEPT
+					: x_(), y_(), z_(), size_()
+				{}
+				vec3_soa_span(vec3_soa_span const&) = default;
+				SPROUT_CONSTEXPR vec3_soa_span(T* x, T* y, T* z, size_type n) SPROUT_NOEXCEPT
+					: x_(x), y_(y), z_(z), size_(n)
+				{}
+				template<typename U, std::size_t N>
+				SPROUT_CONSTEXPR vec3_soa_span(sprout::darkroom::coords::vec3_soa<U, N>& v) SPROUT_NOEXCEPT
+					: x_(v.x), y_(v.y), z_(v.z), size_(N)
+				{}
+				template<typename U, std::size_t N>
+				SPROUT_CONSTEXPR vec3_soa_span(sprout::darkroom::coords::vec3_soa<U, N> const& v) SPROUT_NOEXCEPT
+					: x_(v.x), y_(v.y), z_(v.z), size_(N)
+				{}
+				template<typename U>
+				SPROUT_CONSTEXPR vec3_soa_span(vec3_soa_span<U> const& other) SPROUT_NOEXCEPT
+					: x_(other.x_data()), y_(other.y_data()), z_(other.z_data()), size_(other.size())
+				{}
+				SPROUT_CONSTEXPR size_type size() const SPROUT_NOEXCEPT {
+					return size_;
+				}
+				SPROUT_CONSTEXPR bool empty() const SPROUT_NOEXCEPT {
+					return size_ == 0;
+				}
+				SPROUT_CONSTEXPR const_reference operator[](size_type i) const {
+					return value_type(x_[i], y_[i], z_[i]);
+				}
+				template<typename Vector>
+				SPROUT_CXX14_CONSTEXPR void set(size_type i, Vector const& v) const {
+					x_[i] = sprout::darkroom::coords::x(v);
+					y_[i] = sprout::darkroom::coords::y(v);
+					z_[i] = sprout::darkroom::coords::z(v);
+				}
+				SPROUT_CONSTEXPR T* x_data() const SPROUT_NOEXCEPT {
+					return x_;
+				}
+				SPROUT_CONSTEXPR T* y_data() const SPROUT_NOEXCEPT {
+					return y_;
+				}
+				SPROUT_CONSTEXPR T* z_data() const SPROUT_NOEXCEPT {
+					return z_;
+				}
+				SPROUT_CONSTEXPR vec3_soa_span subspan(size_type offset, size_type count) const SPROUT_NOEXCEPT {
+					return vec3_soa_span(x_ + offset, y_ + offset, z_ + offset, count);
+				}
+			};
+
+			namespace detail {
+				template<typename T, std::size_t N>
+				inline SPROUT_CONSTEXPR bool
+				vec3_soa_equal(sprout::darkroom::coords::vec3_soa<T, N> const& lhs, sprout::darkroom::coords::vec3_soa<T, N> const& rhs, std::size_t i) {
+					return i == N || (
+						lhs.x[i] == rhs.x[i] && lhs.y[i] == rhs.y[i] && lhs.z[i] == rhs.z[i]
+							&& sprout::darkroom::coords::detail::vec3_soa_equal(lhs, rhs, i + 1)
+						);
+				}
+				template<typename T, std::size_t N, typename Vector, sprout::index_t... Indexes>
+				inline SPROUT_CONSTEXPR sprout::darkroom::coords::vec3_soa<T, N>
+				make_vec3_soa_impl(sprout::array<Vector, N> const& v, sprout::index_tuple<Indexes...>) {
+					return sprout::darkroom::coords::vec3_soa<T, N>{
+						{sprout::darkroom::coords::x(v[Indexes])...},
+						{sprout::darkroom::coords::y(v[Indexes])...},
+						{sprout::darkroom::coords::z(v[Indexes])...}
+						};
+				}
+
+				template<typename T, std::size_t N, sprout::index_t... Indexes>
+				inline SPROUT_CONSTEXPR sprout::array<T, N>
+				dot_scalar(
+					sprout::darkroom::coords::vec3_soa<T, N> const& a, sprout::darkroom::coords::vec3_soa<T, N> const& b,
+					sprout::index_tuple<Indexes...>
+					)
+				{
+					return sprout::array<T, N>{{
+						sprout::darkroom::coords::detail::vec3_soa_scalar::dot(
+							a.x[Indexes], a.y[Indexes], a.z[Indexes], b.x[Indexes], b.y[Indexes], b.z[Indexes]
+							)...
+						}};
+				}
+				template<typename T, std::size_t N>
+				inline sprout::array<T, N>
+				dot_vector(sprout::darkroom::coords::vec3_soa<T, N> const& a, sprout::darkroom::coords::vec3_soa<T, N> const& b) {
+					sprout::array<T, N> result;
+					sprout::darkroom::coords::detail::vec3_soa_dot<T> const kernel = {a.x, a.y, a.z, b.x, b.y, b.z, result.data()};
+					sprout::detail::complex_soa_run(kernel, N);
+					return result;
+				}
+				template<typename T, std::size_t N, sprout::index_t... Indexes>
+				inline SPROUT_CONSTEXPR sprout::darkroom::coords::vec3_soa<T, N>
+				cross_scalar(
+					sprout::darkroom::coords::vec3_soa<T, N> const& a, sprout::darkroom::coords::vec3_soa<T, N> const& b,
+					sprout::index_tuple<Indexes...>
+					)
+				{
+					typedef sprout::darkroom::coords::detail::vec3_soa_scalar s;
+					return sprout::darkroom::coords::vec3_soa<T, N>{
+						{s::cross_x(a.x[Indexes], a.y[Indexes], a.z[Indexes], b.x[Indexes], b.y[Indexes], b.z[Indexes])...},
+						{s::cross_y(a.x[Indexes], a.y[Indexes], a.z[Indexes], b.x[Indexes], b.y[Indexes], b.z[Indexes])...},
+						{s::cross_z(a.x[Indexes], a.y[Indexes], a.z[Indexes], b.x[Indexes], b.y[Indexes], b.z[Indexes])...}
+						};
+				}
+				template<typename T, std::size_t N>
+				inline sprout::darkroom::coords::vec3_soa<T, N>
+				cross_vector(sprout::darkroom::coords::vec3_soa<T, N> const& a, sprout::darkroom::coords::vec3_soa<T, N> const& b) {
+					sprout::darkroom::coords::vec3_soa<T, N> result;
+					sprout::darkroom::coords::detail::vec3_soa_cross<T> const kernel = {
+						a.x, a.y, a.z, b.x, b.y, b.z, result.x, result.y, result.z
+						};
+					sprout::detail::complex_soa_run(kernel, N);
+					return result;
+				}
+				template<typename T, std::size_t N, sprout::index_t... Indexes>
+				inline SPROUT_CONSTEXPR sprout::array<T, N>
+				vec3_soa_length(sprout::darkroom::coords::vec3_soa<T, N> const& a, sprout::index_tuple<Indexes...>) {
+					return sprout::array<T, N>{{
+						sprout::darkroom::coords::detail::vec3_soa_scalar::length(a.x[Indexes], a.y[Indexes], a.z[Indexes])...
+						}};
+				}
+				template<typename T, std::size_t N, sprout::index_t... Indexes>
+				inline SPROUT_CONSTEXPR sprout::darkroom::coords::vec3_soa<T, N>
+				normalize_scalar_impl(
+					sprout::darkroom::coords::vec3_soa<T, N> const& a, sprout::array<T, N> const& len,
+					sprout::index_tuple<Indexes...>
+					)
+				{
+					return sprout::darkroom::coords::vec3_soa<T, N>{
+						{(a.x[Indexes] / len[Indexes])...},
+						{(a.y[Indexes] / len[Indexes])...},
+						{(a.z[Indexes] / len[Indexes])...}
+						};
+				}
+				template<typename T, std::size_t N>
+				inline SPROUT_CONSTEXPR sprout::darkroom::coords::vec3_soa<T, N>
+				normalize_scalar(sprout::darkroom::coords::vec3_soa<T, N> const& a) {
+					return sprout::darkroom::coords::detail::normalize_scalar_impl(
+						a, sprout::darkroom::coords::detail::vec3_soa_length(a, sprout::make_index_tuple<N>::make()),
+						sprout::make_index_tuple<N>::make()
+						);
+				}
+				template<typename T, std::size_t N>
+				inline sprout::darkroom::coords::vec3_soa<T, N>
+				normalize_vector(sprout::darkroom::coords::vec3_soa<T, N> const& a) {
+					sprout::darkroom::coords::vec3_soa<T, N> result;
+					sprout::darkroom::coords::detail::vec3_soa_normalize<T> const kernel = {
+						a.x, a.y, a.z, result.x, result.y, result.z
+						};
+					sprout::detail::complex_soa_run(kernel, N);
+					return result;
+				}
+				template<typename T, std::size_t N, sprout::index_t... Indexes>
+				inline SPROUT_CONSTEXPR sprout::darkroom::coords::vec3_soa<T, N>
+				rotate_scalar(
+					sprout::math::quaternion<T> const& q, sprout::darkroom::coords::vec3_soa<T, N> const& a,
+					sprout::index_tuple<Indexes...>
+					)
+				{
+					typedef sprout::darkroom::coords::detail::vec3_soa_scalar s;
+					return sprout::darkroom::coords::vec3_soa<T, N>{
+						{s::rotate_x(
+							q.R_component_1(), q.R_component_2(), q.R_component_3(), q.R_component_4(),
+							a.x[Indexes], a.y[Indexes], a.z[Indexes]
+							)...},
+						{s::rotate_y(
+							q.R_component_1(), q.R_component_2(), q.R_component_3(), q.R_component_4(),
+							a.x[Indexes], a.y[Indexes], a.z[Indexes]
+							)...},
+						{s::rotate_z(
+							q.R_component_1(), q.R_component_2(), q.R_component_3(), q.R_component_4(),
+							a.x[Indexes], a.y[Indexes], a.z[Indexes]
+							)...}
+						};
+				}
+				template<typename T, std::size_t N>
+				inline sprout::darkroom::coords::vec3_soa<T, N>
+				rotate_vector(sprout::math::quaternion<T> const& q, sprout::darkroom::coords::vec3_soa<T, N> const& a) {
+					sprout::darkroom::coords::vec3_soa<T, N> result;
+					sprout::darkroom::coords::detail::vec3_soa_rotate<T> const kernel = {
+						q.R_component_1(), q.R_component_2(), q.R_component_3(), q.R_component_4(),
+						a.x, a.y, a.z, result.x, result.y, result.z
+						};
+					sprout::detail::complex_soa_run(kernel, N);
+					return result;
+				}
+			}	// namespace detail
+
+			template<typename T, std::size_t N>
+			inline SPROUT_CONSTEXPR bool
+			operator==(sprout::darkroom::coords::vec3_soa<T, N> const& lhs, sprout::darkroom::coords::vec3_soa<T, N> const& rhs) {
+				return sprout::darkroom::coords::detail::vec3_soa_equal(lhs, rhs, 0);
+			}
+			template<typename T, std::size_t N>
+			inline SPROUT_CONSTEXPR bool
+			operator!=(sprout::darkroom::coords::vec3_soa<T, N> const& lhs, sprout::darkroom::coords::vec3_soa<T, N> const& rhs) {
+				return !(lhs == rhs);
+			}
+
+			//
+			// make_vec3_soa
+			//
+			//	Splits an array of vectors into planes.
+			//
+			template<typename Vector, std::size_t N>
+			inline SPROUT_CONSTEXPR sprout::darkroom::coords::vec3_soa<typename sprout::darkroom::access::unit<Vector>::type, N>
+			make_vec3_soa(sprout::array<Vector, N> const& v) {
+				return sprout::darkroom::coords::detail::make_vec3_soa_impl<typename sprout::darkroom::access::unit<Vector>::type>(
+					v, sprout::make_index_tuple<N>::make()
+					);
+			}
+
+			//
+			// dot
+			// cross
+			// normalize
+			// rotate
+			//
+			//	Elementwise a . b, a x b and a / length(a), and every vector of a rotated
+			//	by the unit quaternion q. They are the scalar formulas in constant
+			//	expressions and the vector kernels of
+			//	sprout/darkroom/coords/detail/soa_batch.hpp at runtime; with FMA the
+			//	products are fused, and may differ from the scalar results in the last bit.
+			//	dot returns an array of T.
+			//
+			template<typename T, std::size_t N>
+			inline SPROUT_CONSTEXPR sprout::array<T, N>
+			dot(sprout::darkroom::coords::vec3_soa<T, N> const& a, sprout::darkroom::coords::vec3_soa<T, N> const& b) {
+#if defined(SPROUT_DETAIL_HAS_IS_CONSTANT_EVALUATED)
+				return __builtin_is_constant_evaluated() ? sprout::darkroom::coords::detail::dot_scalar(a, b, sprout::make_index_tuple<N>::make())
+					: sprout::darkroom::coords::detail::dot_vector(a, b)
+					;
+#else
+				return sprout::darkroom::coords::detail::dot_scalar(a, b, sprout::make_index_tuple<N>::make());
+#endif
+			}
+			template<typename T, std::size_t N>
+			inline SPROUT_CONSTEXPR sprout::darkroom::coords::vec3_soa<T, N>
+			cross(sprout::darkroom::coords::vec3_soa<T, N> const& a, sprout::darkroom::coords::vec3_soa<T, N> const& b) {
+#if defined(SPROUT_DETAIL_HAS_IS_CONSTANT_EVALUATED)
+				return __builtin_is_constant_evaluated() ? sprout::darkroom::coords::detail::cross_scalar(a, b, sprout::make_index_tuple<N>::make())
+					: sprout::darkroom::coords::detail::cross_vector(a, b)
+					;
+#else
+				return sprout::darkroom::coords::detail::cross_scalar(a, b, sprout::make_index_tuple<N>::make());
+#endif
+			}
+			template<typename T, std::size_t N>
+			inline SPROUT_CONSTEXPR sprout::darkroom::coords::vec3_soa<T, N>
+			normalize(sprout::darkroom::coords::vec3_soa<T, N> const& a) {
+#if defined(SPROUT_DETAIL_HAS_IS_CONSTANT_EVALUATED)
+				return __builtin_is_constant_evaluated() ? sprout::darkroom::coords::detail::normalize_scalar(a)
+					: sprout::darkroom::coords::detail::normalize_vector(a)
+					;
+#else
+				return sprout::darkroom::coords::detail::normalize_scalar(a);
+#endif
+			}
+			template<typename T, std::size_t N>
+			inline SPROUT_CONSTEXPR sprout::darkroom::coords::vec3_soa<T, N>
+			rotate(sprout::math::quaternion<T> const& q, sprout::darkroom::coords::vec3_soa<T, N> const& a) {
+#if defined(SPROUT_DETAIL_HAS_IS_CONSTANT_EVALUATED)
+				return __builtin_is_constant_evaluated() ? sprout::darkroom::coords::detail::rotate_scalar(q, a, sprout::make_index_tuple<N>::make())
+					: sprout::darkroom::coords::detail::rotate_vector(q, a)
+					;
+#else
+				return sprout::darkroom::coords::detail::rotate_scalar(q, a, sprout::make_index_tuple<N>::make());
+#endif
+			}
+
+			//
+			// dot
+			// cross
+			// normalize
+			// rotate
+			//
+			//	Runtime forms over spans; the operands have at least the size of result,
+			//	which may be one of them. dot writes a.size() values from result and
+			//	returns the end of them.
+			//
+			template<typename T1, typename T2, typename T>
+			inline T*
+			dot(sprout::darkroom::coords::vec3_soa_span<T1> const& a, sprout::darkroom::coords::vec3_soa_span<T2> const& b, T* result) {
+				sprout::darkroom::coords::detail::vec3_soa_dot<T> const kernel = {
+					a.x_data(), a.y_data(), a.z_data(), b.x_data(), b.y_data(), b.z_data(), result
+					};
+				sprout::detail::complex_soa_run(kernel, a.size());
+				return result + a.size();
+			}
+			template<typename T1, typename T2, typename T>
+			inline void
+			cross(
+				sprout::darkroom::coords::vec3_soa_span<T1> const& a, sprout::darkroom::coords::vec3_soa_span<T2> const& b,
+				sprout::darkroom::coords::vec3_soa_span<T> const& result
+				)
+			{
+				sprout::darkroom::coords::detail::vec3_soa_cross<T> const kernel = {
+					a.x_data(), a.y_data(), a.z_data(), b.x_data(), b.y_data(), b.z_data(),
+					result.x_data(), result.y_data(), result.z_data()
+					};
+				sprout::detail::complex_soa_run(kernel, result.size());
+			}
+			template<typename T1, typename T>
+			inline void
+			normalize(sprout::darkroom::coords::vec3_soa_span<T1> const& a, sprout::darkroom::coords::vec3_soa_span<T> const& result) {
+				sprout::darkroom::coords::detail::vec3_soa_normalize<T> const kernel = {
+					a.x_data(), a.y_data(), a.z_data(), result.x_data(), result.y_data(), result.z_data()
+					};
+				sprout::detail::complex_soa_run(kernel, result.size());
+			}
+			template<typename T1, typename T>
+			inline void
+			rotate(
+				sprout::math::quaternion<T> const& q, sprout::darkroom::coords::vec3_soa_span<T1> const& a,
+				sprout::darkroom::coords::vec3_soa_span<T> const& result
+				)
+			{
+				sprout::darkroom::coords::detail::vec3_soa_rotate<T> const kernel = {
+					q.R_component_1(), q.R_component_2(), q.R_component_3(), q.R_component_4(),
+					a.x_data(), a.y_data(), a.z_data(), result.x_data(), result.y_data(), result.z_data()
+					};
+				sprout::detail::complex_soa_run(kernel, result.size());
+			}
+		}	// namespace coords
+	}	// namespace darkroom
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_DARKROOM_COORDS_SOA_HPP
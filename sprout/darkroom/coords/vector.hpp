@@ -163,8 +163,8 @@ namespace sprout {
 					sprout::darkroom::coords::y(lhs) * sprout::darkroom::coords::z(rhs)
 						- sprout::darkroom::coords::z(lhs) * sprout::darkroom::coords::y(rhs)
 						,
-					sprout::darkroom::coords::y(lhs) * sprout::darkroom::coords::x(rhs)
-						- sprout::darkroom::coords::x(lhs) * sprout::darkroom::coords::y(rhs)
+					sprout::darkroom::coords::z(lhs) * sprout::darkroom::coords::x(rhs)
+						- sprout::darkroom::coords::x(lhs) * sprout::darkroom::coords::z(rhs)
 						,
 					sprout::darkroom::coords::x(lhs) * sprout::darkroom::coords::y(rhs)
 						- sprout::darkroom::coords::y(lhs) * sprout::darkroom::coords::x(rhs)
@@ -8,6 +8,7 @@
 #ifndef SPROUT_DARKROOM_PIXELS_GENERATE_HPP
 #define SPROUT_DARKROOM_PIXELS_GENERATE_HPP
 
+#include <type_traits>
 #include <sprout/config.hpp>
 #include <sprout/workaround/std/cstddef.hpp>
 #include <sprout/index_tuple/metafunction.hpp>
@@ -16,6 +17,7 @@
 #include <sprout/container/functions.hpp>
 #include <sprout/container/indexes.hpp>
 #include <sprout/darkroom/colors/rgb.hpp>
+#include <sprout/darkroom/cameras/calculate.hpp>
 #include <sprout/darkroom/renderers/calculate.hpp>
 #include <sprout/darkroom/tracers/calculate.hpp>
 
@@ -30,9 +32,85 @@ namespace sprout {
 					typename Pixels,
 					typename RayTracer, typename Renderer, typename Camera,
 					typename Objects, typename Lights,
+					typename Rays,
 					sprout::index_t... XIndexes
 				>
 				inline SPROUT_CONSTEXPR typename sprout::container_traits<Pixels>::value_type
+				generate_impl_line_1(
+					RayTracer const& raytracer, Renderer const& renderer, Camera const& camera,
+					Objects const& objs, Lights const& lights,
+					std::size_t depth_max,
+					Rays const& rays,
+					sprout::index_tuple<XIndexes...>
+					)
+				{
+					typedef typename sprout::container_traits<Pixels>::value_type pixel_line_type;
+					typedef typename sprout::container_traits<pixel_line_type>::value_type pixel_type;
+					return sprout::make<pixel_line_type>(
+						sprout::darkroom::colors::rgb_f_to_rgb<pixel_type>(
+							sprout::darkroom::tracers::trace(
+								raytracer,
+								renderer, camera, objs, lights,
+								rays[XIndexes], depth_max
+								)
+							)...
+						);
+				}
+				template<typename Pixels, typename RayTracer, typename Renderer, typename Camera, typename Objects, typename Lights>
+				struct generate_traces_scanline
+					: public sprout::darkroom::tracers::has_trace<
+						RayTracer, Renderer, Camera, Objects, Lights,
+						typename sprout::darkroom::cameras::calculate_result<
+							Camera,
+							typename sprout::container_traits<typename sprout::container_traits<Pixels>::value_type>::size_type
+						>::type
+					>
+				{};
+				template<
+					typename Pixels,
+					typename RayTracer, typename Renderer, typename Camera,
+					typename Objects, typename Lights,
+					sprout::index_t... XIndexes
+				>
+				inline SPROUT_CONSTEXPR typename std::enable_if<
+					sprout::darkroom::pixels::detail::generate_traces_scanline<Pixels, RayTracer, Renderer, Camera, Objects, Lights>::value,
+					typename sprout::container_traits<Pixels>::value_type
+				>::type
+				generate_impl_line(
+					RayTracer const& raytracer, Renderer const& renderer, Camera const& camera,
+					Objects const& objs, Lights const& lights,
+					typename sprout::container_traits<
+						typename sprout::container_traits<Pixels>::value_type
+						>::size_type x,
+					typename sprout::container_traits<Pixels>::size_type y,
+					typename sprout::container_traits<
+						typename sprout::container_traits<Pixels>::value_type
+						>::size_type width,
+					typename sprout::container_traits<Pixels>::size_type height,
+					std::size_t depth_max,
+					sprout::index_tuple<XIndexes...> indexes
+					)
+				{
+					return sprout::darkroom::pixels::detail::generate_impl_line_1<Pixels>(
+						raytracer, renderer, camera, objs, lights,
+						depth_max,
+						sprout::darkroom::cameras::calculate_scanline<sizeof...(XIndexes)>(
+							camera,
+							x, y, width, height
+							),
+						indexes
+						);
+				}
+				template<
+					typename Pixels,
+					typename RayTracer, typename Renderer, typename Camera,
+					typename Objects, typename Lights,
+					sprout::index_t... XIndexes
+				>
+				inline SPROUT_CONSTEXPR typename std::enable_if<
+					!sprout::darkroom::pixels::detail::generate_traces_scanline<Pixels, RayTracer, Renderer, Camera, Objects, Lights>::value,
+					typename sprout::container_traits<Pixels>::value_type
+				>::type
 				generate_impl_line(
 					RayTracer const& raytracer, Renderer const& renderer, Camera const& camera,
 					Objects const& objs, Lights const& lights,
@@ -8,8 +8,10 @@
 #ifndef SPROUT_DARKROOM_TRACERS_CALCULATE_HPP
 #define SPROUT_DARKROOM_TRACERS_CALCULATE_HPP
 
+#include <utility>
 #include <sprout/config.hpp>
 #include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/type_traits/integral_constant.hpp>
 #include <sprout/type_traits/identity.hpp>
 #include <sprout/darkroom/renderers/calculate.hpp>
 
@@ -61,6 +63,60 @@ namespace sprout {
 			{
 				return tracer(renderer, camera, objs, lights, x, y, width, height, depth_max);
 			}
+
+			namespace detail {
+				template<typename Tracer, typename Renderer, typename Camera, typename Objects, typename Lights, typename Ray>
+				struct has_mem_trace_test {
+				public:
+					template<
+						typename U = Tracer,
+						typename = typename sprout::identity<decltype(std::declval<U const&>().trace(
+							std::declval<Renderer const&>(), std::declval<Camera const&>(), std::declval<Objects const&>(), std::declval<Lights const&>(),
+							std::declval<Ray const&>(), std::declval<std::size_t>()
+							))>::type
+					>
+					static sprout::true_type test(int);
+					static sprout::false_type test(...);
+				};
+			}	// namespace detail
+			//
+			// has_trace
+			//
+			//	Whether tracer.trace(renderer, camera, objs, lights, ray, depth_max) is
+			//	available, so that pixels::generate can trace rays computed in batches.
+			//
+#if defined(_MSC_VER) && (_MSC_VER > 1900)
+			template<
+				typename Tracer, typename Renderer, typename Camera, typename Objects, typename Lights, typename Ray,
+				typename Base_ = typename sprout::identity<
+					decltype(sprout::darkroom::tracers::detail::has_mem_trace_test<Tracer, Renderer, Camera, Objects, Lights, Ray>::test(0))
+				>::type
+			>
+			struct has_trace
+				: public Base_
+			{};
+#else
+			template<typename Tracer, typename Renderer, typename Camera, typename Objects, typename Lights, typename Ray>
+			struct has_trace
+				: public sprout::identity<
+					decltype(sprout::darkroom::tracers::detail::has_mem_trace_test<Tracer, Renderer, Camera, Objects, Lights, Ray>::test(0))
+				>::type
+			{};
+#endif
+
+			//
+			// trace
+			//
+			template<typename Tracer, typename Renderer, typename Camera, typename Objects, typename Lights, typename Ray>
+			inline SPROUT_CONSTEXPR typename Tracer::color_type
+			trace(
+				Tracer const& tracer,
+				Renderer const& renderer, Camera const& camera, Objects const& objs, Lights const& lights,
+				Ray const& ray, std::size_t depth_max = sprout::darkroom::renderers::default_depth
+				)
+			{
+				return tracer.trace(renderer, camera, objs, lights, ray, depth_max);
+			}
 		}	// namespace tracers
 	}	// namespace darkroom
 }	// namespace sprout
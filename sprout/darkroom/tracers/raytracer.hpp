@@ -53,6 +53,24 @@ namespace sprout {
 						depth_max
 						);
 				}
+				//
+				// trace
+				//
+				//	The color seen along a ray the camera has already produced.
+				//
+				template<typename Renderer, typename Camera, typename Objects, typename Lights, typename Ray>
+				SPROUT_CONSTEXPR color_type trace(
+					Renderer const& renderer, Camera const& camera, Objects const& objs, Lights const& lights,
+					Ray const& ray, std::size_t depth_max = sprout::darkroom::renderers::default_depth
+					) const
+				{
+					return sprout::darkroom::renderers::calculate<color_type>(
+						renderer,
+						camera, objs, lights,
+						ray,
+						depth_max
+						);
+				}
 			};
 			//
 			// make_raytracer
@@ -0,0 +1,282 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_DETAIL_ASCII_SCAN_HPP
+#define SPROUT_DETAIL_ASCII_SCAN_HPP
+
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/bit/ctz.hpp>
+#include <sprout/ctype/ascii.hpp>
+#include <sprout/detail/simd.hpp>
+
+namespace sprout {
+	namespace detail {
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+		//
+		// ascii_sse2
+		// ascii_avx2
+		//
+		//	The byte operations the kernels below are written in. in_range(v, lo, hi)
+		//	tests lo <= v <= hi for 0 <= lo <= hi < 0x80 by moving the range to the
+		//	bottom of the signed byte range and comparing once.
+		//
+		struct ascii_sse2 {
+		public:
+			typedef __m128i type;
+			enum { width = 16 };
+		public:
+			static type load(char const* p) {
+				return _mm_loadu_si128(reinterpret_cast<__m128i const*>(p));
+			}
+			static void store(char* p, type v) {
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+			}
+			static type zero() {
+				return _mm_setzero_si128();
+			}
+			static type set1(int c) {
+				return _mm_set1_epi8(static_cast<char>(c));
+			}
+			static type or_(type a, type b) {
+				return _mm_or_si128(a, b);
+			}
+			static type and_(type a, type b) {
+				return _mm_and_si128(a, b);
+			}
+			static type andnot(type a, type b) {
+				return _mm_andnot_si128(a, b);
+			}
+			static type xor_(type a, type b) {
+				return _mm_xor_si128(a, b);
+			}
+			static type sub(type a, type b) {
+				return _mm_sub_epi8(a, b);
+			}
+			static type eq(type v, int c) {
+				return _mm_cmpeq_epi8(v, set1(c));
+			}
+			static type in_range(type v, int lo, int hi) {
+				return _mm_cmpgt_epi8(set1(hi - lo - 127), _mm_add_epi8(v, set1(0x80 - lo)));
+			}
+			static unsigned movemask(type v) {
+				return static_cast<unsigned>(_mm_movemask_epi8(v));
+			}
+			// sum of the bytes of v
+			static std::size_t sum(type v) {
+				__m128i const s = _mm_sad_epu8(v, _mm_setzero_si128());
+				return static_cast<std::size_t>(_mm_cvtsi128_si32(s)) + static_cast<std::size_t>(_mm_cvtsi128_si32(_mm_srli_si128(s, 8)));
+			}
+		};
+#	if defined(SPROUT_DETAIL_SIMD_AVX2)
+		struct ascii_avx2 {
+		public:
+			typedef __m256i type;
+			enum { width = 32 };
+		public:
+			static type load(char const* p) {
+				return _mm256_loadu_si256(reinterpret_cast<__m256i const*>(p));
+			}
+			static void store(char* p, type v) {
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+			}
+			static type zero() {
+				return _mm256_setzero_si256();
+			}
+			static type set1(int c) {
+				return _mm256_set1_epi8(static_cast<char>(c));
+			}
+			static type or_(type a, type b) {
+				return _mm256_or_si256(a, b);
+			}
+			static type and_(type a, type b) {
+				return _mm256_and_si256(a, b);
+			}
+			static type andnot(type a, type b) {
+				return _mm256_andnot_si256(a, b);
+			}
+			static type xor_(type a, type b) {
+				return _mm256_xor_si256(a, b);
+			}
+			static type sub(type a, type b) {
+				return _mm256_sub_epi8(a, b);
+			}
+			static type eq(type v, int c) {
+				return _mm256_cmpeq_epi8(v, set1(c));
+			}
+			static type in_range(type v, int lo, int hi) {
+				return _mm256_cmpgt_epi8(set1(hi - lo - 127), _mm256_add_epi8(v, set1(0x80 - lo)));
+			}
+			static unsigned movemask(type v) {
+				return static_cast<unsigned>(_mm256_movemask_epi8(v));
+			}
+			static std::size_t sum(type v) {
+				__m256i const w = _mm256_sad_epu8(v, _mm256_setzero_si256());
+				__m128i const s = _mm_add_epi64(_mm256_castsi256_si128(w), _mm256_extracti128_si256(w, 1));
+				return static_cast<std::size_t>(_mm_cvtsi128_si32(s)) + static_cast<std::size_t>(_mm_cvtsi128_si32(_mm_srli_si128(s, 8)));
+			}
+		};
+#	endif
+
+		//
+		// ascii_class_mask
+		//
+		//	0xFF in every byte of v that belongs to one of the sprout::ascii::detail
+		//	classes in Class; bytes from 0x80 up belong to none, as in the table.
+		//
+		template<typename Ops, std::size_t Class>
+		inline typename Ops::type
+		ascii_class_mask(typename Ops::type v) {
+			typename Ops::type const folded = Ops::or_(v, Ops::set1(0x20));
+			typename Ops::type const digit = Ops::in_range(v, 0x30, 0x39);
+			typename Ops::type const alpha = Ops::in_range(folded, 0x61, 0x7A);
+			typename Ops::type m = Ops::zero();
+			if (Class & sprout::ascii::detail::alpha) {
+				m = Ops::or_(m, alpha);
+			}
+			if (Class & sprout::ascii::detail::blank) {
+				m = Ops::or_(m, Ops::or_(Ops::eq(v, 0x09), Ops::eq(v, 0x20)));
+			}
+			if (Class & sprout::ascii::detail::cntrl) {
+				m = Ops::or_(m, Ops::or_(Ops::in_range(v, 0x00, 0x1F), Ops::eq(v, 0x7F)));
+			}
+			if (Class & sprout::ascii::detail::digit) {
+				m = Ops::or_(m, digit);
+			}
+			if (Class & sprout::ascii::detail::graph) {
+				m = Ops::or_(m, Ops::in_range(v, 0x21, 0x7E));
+			}
+			if (Class & sprout::ascii::detail::lower) {
+				m = Ops::or_(m, Ops::in_range(v, 0x61, 0x7A));
+			}
+			if (Class & sprout::ascii::detail::print) {
+				m = Ops::or_(m, Ops::in_range(v, 0x20, 0x7E));
+			}
+			if (Class & sprout::ascii::detail::punct) {
+				m = Ops::or_(m, Ops::andnot(Ops::or_(alpha, digit), Ops::in_range(v, 0x21, 0x7E)));
+			}
+			if (Class & sprout::ascii::detail::space) {
+				m = Ops::or_(m, Ops::or_(Ops::in_range(v, 0x09, 0x0D), Ops::eq(v, 0x20)));
+			}
+			if (Class & sprout::ascii::detail::upper) {
+				m = Ops::or_(m, Ops::in_range(v, 0x41, 0x5A));
+			}
+			if (Class & sprout::ascii::detail::xdigit) {
+				m = Ops::or_(m, Ops::or_(digit, Ops::in_range(folded, 0x61, 0x66)));
+			}
+			return m;
+		}
+
+		//
+		// ascii_count_block
+		// ascii_find_block
+		// ascii_case_block
+		//
+		//	Process whole blocks of Ops::width bytes and advance first (and result)
+		//	past them; the caller finishes the tail.
+		//
+		template<typename Ops, std::size_t Class>
+		inline std::size_t
+		ascii_count_block(char const*& first, char const* last) {
+			std::size_t result = 0;
+			while (last - first >= Ops::width) {
+				// byte counters would wrap after 255 blocks
+				typename Ops::type counts = Ops::zero();
+				for (std::size_t i = 0; i != 255 && last - first >= Ops::width; ++i, first += Ops::width) {
+					counts = Ops::sub(counts, sprout::detail::ascii_class_mask<Ops, Class>(Ops::load(first)));
+				}
+				result += Ops::sum(counts);
+			}
+			return result;
+		}
+		// the first byte whose membership is Member, or null if no whole block has one
+		template<typename Ops, std::size_t Class, bool Member>
+		inline char const*
+		ascii_find_block(char const*& first, char const* last) {
+			for (; last - first >= Ops::width; first += Ops::width) {
+				unsigned m = Ops::movemask(sprout::detail::ascii_class_mask<Ops, Class>(Ops::load(first)));
+				if (!Member) {
+					m ^= static_cast<unsigned>((1ull << Ops::width) - 1);
+				}
+				if (m != 0) {
+					return first + sprout::ctz(m);
+				}
+			}
+			return 0;
+		}
+		// flips bit 0x20 of the bytes in [lo, hi]
+		template<typename Ops>
+		inline void
+		ascii_case_block(char const*& first, char const* last, char*& result, int lo, int hi) {
+			typename Ops::type const bit = Ops::set1(0x20);
+			for (; last - first >= Ops::width; first += Ops::width, result += Ops::width) {
+				typename Ops::type const v = Ops::load(first);
+				Ops::store(result, Ops::xor_(v, Ops::and_(Ops::in_range(v, lo, hi), bit)));
+			}
+		}
+#endif
+
+		//
+		// ascii_count
+		// ascii_find
+		// ascii_convert_case
+		//
+		//	Runtime counterparts of the scalar loops in sprout/ctype/bulk.hpp: the
+		//	number of bytes in Class, the first byte that is (Member) or is not in it,
+		//	and lo..hi converted to the other case into result (which may be first).
+		//
+		template<std::size_t Class>
+		inline std::size_t
+		ascii_count(char const* first, char const* last) {
+			std::size_t result = 0;
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+#	if defined(SPROUT_DETAIL_SIMD_AVX2)
+			result += sprout::detail::ascii_count_block<sprout::detail::ascii_avx2, Class>(first, last);
+#	endif
+			result += sprout::detail::ascii_count_block<sprout::detail::ascii_sse2, Class>(first, last);
+#endif
+			for (; first != last; ++first) {
+				result += (sprout::ascii::detail::get_value(*first) & Class) != 0;
+			}
+			return result;
+		}
+		template<std::size_t Class, bool Member>
+		inline char const*
+		ascii_find(char const* first, char const* last) {
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+#	if defined(SPROUT_DETAIL_SIMD_AVX2)
+			if (char const* found = sprout::detail::ascii_find_block<sprout::detail::ascii_avx2, Class, Member>(first, last)) {
+				return found;
+			}
+#	endif
+			if (char const* found = sprout::detail::ascii_find_block<sprout::detail::ascii_sse2, Class, Member>(first, last)) {
+				return found;
+			}
+#endif
+			for (; first != last; ++first) {
+				if (((sprout::ascii::detail::get_value(*first) & Class) != 0) == Member) {
+					break;
+				}
+			}
+			return first;
+		}
+		inline void
+		ascii_convert_case(char const* first, char const* last, char* result, int lo, int hi) {
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+#	if defined(SPROUT_DETAIL_SIMD_AVX2)
+			sprout::detail::ascii_case_block<sprout::detail::ascii_avx2>(first, last, result, lo, hi);
+#	endif
+			sprout::detail::ascii_case_block<sprout::detail::ascii_sse2>(first, last, result, lo, hi);
+#endif
+			for (; first != last; ++first, ++result) {
+				*result = *first >= lo && *first <= hi ? static_cast<char>(*first ^ 0x20) : *first;
+			}
+		}
+	}	// namespace detail
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_DETAIL_ASCII_SCAN_HPP
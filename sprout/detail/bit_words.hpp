@@ -0,0 +1,396 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_DETAIL_BIT_WORDS_HPP
+#define SPROUT_DETAIL_BIT_WORDS_HPP
+
+#include <climits>
+#include <cstdint>
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/bit/ctz.hpp>
+#include <sprout/bit/popcount.hpp>
+#include <sprout/detail/simd.hpp>
+
+namespace sprout {
+	namespace detail {
+		//
+		// bit_words_and
+		// bit_words_or
+		// bit_words_xor
+		// bit_words_andnot
+		//
+		//	The word operations of bit_words_transform; andnot is a & ~b.
+		//
+		struct bit_words_and {
+		public:
+			template<typename Ops>
+			static typename Ops::type vector(typename Ops::type a, typename Ops::type b) {
+				return Ops::and_(a, b);
+			}
+			template<typename Word>
+			static SPROUT_CONSTEXPR Word scalar(Word a, Word b) {
+				return a & b;
+			}
+		};
+		struct bit_words_or {
+		public:
+			template<typename Ops>
+			static typename Ops::type vector(typename Ops::type a, typename Ops::type b) {
+				return Ops::or_(a, b);
+			}
+			template<typename Word>
+			static SPROUT_CONSTEXPR Word scalar(Word a, Word b) {
+				return a | b;
+			}
+		};
+		struct bit_words_xor {
+		public:
+			template<typename Ops>
+			static typename Ops::type vector(typename Ops::type a, typename Ops::type b) {
+				return Ops::xor_(a, b);
+			}
+			template<typename Word>
+			static SPROUT_CONSTEXPR Word scalar(Word a, Word b) {
+				return a ^ b;
+			}
+		};
+		struct bit_words_andnot {
+		public:
+			template<typename Ops>
+			static typename Ops::type vector(typename Ops::type a, typename Ops::type b) {
+				return Ops::andnot(b, a);
+			}
+			template<typename Word>
+			static SPROUT_CONSTEXPR Word scalar(Word a, Word b) {
+				return a & ~b;
+			}
+		};
+
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+		//
+		// bit_words_sse2
+		// bit_words_avx2
+		//
+		//	The vector operations the kernels below are written in. popcount(v) leaves
+		//	the number of set bits of each 64-bit lane in that lane: SSE2 counts the
+		//	bytes with shifts and masks, AVX2 looks the nibbles up with pshufb.
+		//
+		struct bit_words_sse2 {
+		public:
+			typedef __m128i type;
+			enum { width = 16 };
+		public:
+			static type load(void const* p) {
+				return _mm_loadu_si128(static_cast<__m128i const*>(p));
+			}
+			static void store(void* p, type v) {
+				_mm_storeu_si128(static_cast<__m128i*>(p), v);
+			}
+			static type zero() {
+				return _mm_setzero_si128();
+			}
+			static type and_(type a, type b) {
+				return _mm_and_si128(a, b);
+			}
+			static type or_(type a, type b) {
+				return _mm_or_si128(a, b);
+			}
+			static type xor_(type a, type b) {
+				return _mm_xor_si128(a, b);
+			}
+			static type andnot(type a, type b) {
+				return _mm_andnot_si128(a, b);
+			}
+			static type add64(type a, type b) {
+				return _mm_add_epi64(a, b);
+			}
+			static type shl64(type v, int n) {
+				return _mm_slli_epi64(v, n);
+			}
+			static bool is_zero(type v) {
+				return _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_setzero_si128())) == 0xFFFF;
+			}
+			static type popcount(type v) {
+				__m128i const m1 = _mm_set1_epi8(0x55);
+				__m128i const m2 = _mm_set1_epi8(0x33);
+				__m128i const m4 = _mm_set1_epi8(0x0F);
+				v = _mm_sub_epi8(v, _mm_and_si128(_mm_srli_epi64(v, 1), m1));
+				v = _mm_add_epi8(_mm_and_si128(v, m2), _mm_and_si128(_mm_srli_epi64(v, 2), m2));
+				v = _mm_and_si128(_mm_add_epi8(v, _mm_srli_epi64(v, 4)), m4);
+				return _mm_sad_epu8(v, _mm_setzero_si128());
+			}
+			static std::size_t sum64(type v) {
+				std::uint64_t lanes[2];
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), v);
+				return static_cast<std::size_t>(lanes[0] + lanes[1]);
+			}
+		};
+#	if defined(SPROUT_DETAIL_SIMD_AVX2)
+		struct bit_words_avx2 {
+		public:
+			typedef __m256i type;
+			enum { width = 32 };
+		public:
+			static type load(void const* p) {
+				return _mm256_loadu_si256(static_cast<__m256i const*>(p));
+			}
+			static void store(void* p, type v) {
+				_mm256_storeu_si256(static_cast<__m256i*>(p), v);
+			}
+			static type zero() {
+				return _mm256_setzero_si256();
+			}
+			static type and_(type a, type b) {
+				return _mm256_and_si256(a, b);
+			}
+			static type or_(type a, type b) {
+				return _mm256_or_si256(a, b);
+			}
+			static type xor_(type a, type b) {
+				return _mm256_xor_si256(a, b);
+			}
+			static type andnot(type a, type b) {
+				return _mm256_andnot_si256(a, b);
+			}
+			static type add64(type a, type b) {
+				return _mm256_add_epi64(a, b);
+			}
+			static type shl64(type v, int n) {
+				return _mm256_slli_epi64(v, n);
+			}
+			static bool is_zero(type v) {
+				return _mm256_testz_si256(v, v) != 0;
+			}
+			static type popcount(type v) {
+				__m256i const table = _mm256_setr_epi8(
+					0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+					0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4
+					);
+				__m256i const m4 = _mm256_set1_epi8(0x0F);
+				__m256i const counts = _mm256_add_epi8(
+					_mm256_shuffle_epi8(table, _mm256_and_si256(v, m4)),
+					_mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(v, 4), m4))
+					);
+				return _mm256_sad_epu8(counts, _mm256_setzero_si256());
+			}
+			static std::size_t sum64(type v) {
+				__m128i const s = _mm_add_epi64(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+				return bit_words_sse2::sum64(s);
+			}
+		};
+#	endif
+
+		//
+		// bit_words_csa
+		//
+		//	Carry-save adder: high:low = a + b + c, bitwise.
+		//
+		template<typename Ops>
+		inline void
+		bit_words_csa(typename Ops::type& high, typename Ops::type& low, typename Ops::type a, typename Ops::type b, typename Ops::type c) {
+			typename Ops::type const u = Ops::xor_(a, b);
+			high = Ops::or_(Ops::and_(a, b), Ops::and_(u, c));
+			low = Ops::xor_(u, c);
+		}
+
+		//
+		// bit_words_transform_block
+		// bit_words_count_block
+		// bit_words_find_block
+		//
+		//	Process whole vectors of words from pos on and return the position past
+		//	them; the caller finishes the tail. find stops at the first vector with
+		//	a set bit.
+		//
+		template<typename Ops, typename Op, typename Word>
+		inline std::size_t
+		bit_words_transform_block(Word* result, Word const* a, Word const* b, std::size_t n, std::size_t pos) {
+			std::size_t const step = Ops::width / sizeof(Word);
+			std::size_t i = pos;
+			for (; i + step <= n; i += step) {
+				Ops::store(result + i, Op::template vector<Ops>(Ops::load(a + i), Ops::load(b + i)));
+			}
+			return i;
+		}
+		// Harley-Seal: sixteen vectors go through a tree of carry-save adders, and
+		// only the carries out of the top (sixteens) are counted per step
+		template<typename Ops, typename Word>
+		inline std::size_t
+		bit_words_count_block(Word const* w, std::size_t n, std::size_t& pos) {
+			typedef typename Ops::type type;
+			std::size_t const step = Ops::width / sizeof(Word);
+			std::size_t i = pos;
+			type total = Ops::zero();
+			type ones = Ops::zero();
+			type twos = Ops::zero();
+			type fours = Ops::zero();
+			type eights = Ops::zero();
+			type sixteens, twos_a, twos_b, fours_a, fours_b, eights_a, eights_b;
+			for (; i + 16 * step <= n; i += 16 * step) {
+				Word const* p = w + i;
+				sprout::detail::bit_words_csa<Ops>(twos_a, ones, ones, Ops::load(p), Ops::load(p + step));
+				sprout::detail::bit_words_csa<Ops>(twos_b, ones, ones, Ops::load(p + 2 * step), Ops::load(p + 3 * step));
+				sprout::detail::bit_words_csa<Ops>(fours_a, twos, twos, twos_a, twos_b);
+				sprout::detail::bit_words_csa<Ops>(twos_a, ones, ones, Ops::load(p + 4 * step), Ops::load(p + 5 * step));
+				sprout::detail::bit_words_csa<Ops>(twos_b, ones, ones, Ops::load(p + 6 * step), Ops::load(p + 7 * step));
+				sprout::detail::bit_words_csa<Ops>(fours_b, twos, twos, twos_a, twos_b);
+				sprout::detail::bit_words_csa<Ops>(eights_a, fours, fours, fours_a, fours_b);
+				sprout::detail::bit_words_csa<Ops>(twos_a, ones, ones, Ops::load(p + 8 * step), Ops::load(p + 9 * step));
+				sprout::detail::bit_words_csa<Ops>(twos_b, ones, ones, Ops::load(p + 10 * step), Ops::load(p + 11 * step));
+				sprout::detail::bit_words_csa<Ops>(fours_a, twos, twos, twos_a, twos_b);
+				sprout::detail::bit_words_csa<Ops>(twos_a, ones, ones, Ops::load(p + 12 * step), Ops::load(p + 13 * step));
+				sprout::detail::bit_words_csa<Ops>(twos_b, ones, ones, Ops::load(p + 14 * step), Ops::load(p + 15 * step));
+				sprout::detail::bit_words_csa<Ops>(fours_b, twos, twos, twos_a, twos_b);
+				sprout::detail::bit_words_csa<Ops>(eights_b, fours, fours, fours_a, fours_b);
+				sprout::detail::bit_words_csa<Ops>(sixteens, eights, eights, eights_a, eights_b);
+				total = Ops::add64(total, Ops::popcount(sixteens));
+			}
+			total = Ops::shl64(total, 4);
+			total = Ops::add64(total, Ops::shl64(Ops::popcount(eights), 3));
+			total = Ops::add64(total, Ops::shl64(Ops::popcount(fours), 2));
+			total = Ops::add64(total, Ops::shl64(Ops::popcount(twos), 1));
+			total = Ops::add64(total, Ops::popcount(ones));
+			for (; i + step <= n; i += step) {
+				total = Ops::add64(total, Ops::popcount(Ops::load(w + i)));
+			}
+			pos = i;
+			return Ops::sum64(total);
+		}
+		template<typename Ops, typename Word>
+		inline std::size_t
+		bit_words_find_block(Word const* w, std::size_t n, std::size_t pos) {
+			std::size_t const step = Ops::width / sizeof(Word);
+			std::size_t i = pos;
+			for (; i + step <= n && Ops::is_zero(Ops::load(w + i)); i += step)
+				;
+			return i;
+		}
+#endif
+
+		//
+		// bit_words_transform
+		// bit_words_count
+		// bit_words_find_next
+		//
+		//	Runtime kernels over the n words of a bitset, bit k being bit k % W of
+		//	word k / W: result = Op(a, b) word by word (result may alias a or b), the
+		//	number of set bits, and the first set bit from pos on, or n * W if none.
+		//
+		template<typename Op, typename Word>
+		inline void
+		bit_words_transform(Word* result, Word const* a, Word const* b, std::size_t n) {
+			std::size_t i = 0;
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+#	if defined(SPROUT_DETAIL_SIMD_AVX2)
+			i = sprout::detail::bit_words_transform_block<sprout::detail::bit_words_avx2, Op>(result, a, b, n, i);
+#	endif
+			i = sprout::detail::bit_words_transform_block<sprout::detail::bit_words_sse2, Op>(result, a, b, n, i);
+#endif
+			for (; i < n; ++i) {
+				result[i] = Op::scalar(a[i], b[i]);
+			}
+		}
+		template<typename Word>
+		inline std::size_t
+		bit_words_count(Word const* w, std::size_t n) {
+			std::size_t result = 0;
+			std::size_t i = 0;
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+#	if defined(SPROUT_DETAIL_SIMD_AVX2)
+			result += sprout::detail::bit_words_count_block<sprout::detail::bit_words_avx2>(w, n, i);
+#	endif
+			result += sprout::detail::bit_words_count_block<sprout::detail::bit_words_sse2>(w, n, i);
+#endif
+			for (; i < n; ++i) {
+				result += sprout::popcount(w[i]);
+			}
+			return result;
+		}
+		template<typename Word>
+		inline std::size_t
+		bit_words_find_next(Word const* w, std::size_t n, std::size_t pos) {
+			std::size_t const bits = CHAR_BIT * sizeof(Word);
+			std::size_t i = pos / bits;
+			if (i >= n) {
+				return n * bits;
+			}
+			if (Word const first = w[i] & (~static_cast<Word>(0) << (pos % bits))) {
+				return i * bits + sprout::ctz(first);
+			}
+			++i;
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+#	if defined(SPROUT_DETAIL_SIMD_AVX2)
+			i = sprout::detail::bit_words_find_block<sprout::detail::bit_words_avx2>(w, n, i);
+#	endif
+			i = sprout::detail::bit_words_find_block<sprout::detail::bit_words_sse2>(w, n, i);
+#endif
+			for (; i < n; ++i) {
+				if (w[i] != 0) {
+					return i * bits + sprout::ctz(w[i]);
+				}
+			}
+			return n * bits;
+		}
+
+		//
+		// bit_words_rank
+		// bit_words_select
+		//
+		//	rank is the number of set bits before pos (pos <= n * W); select is the
+		//	position of the set bit with rank k, or n * W if there are no more than k.
+		//	select skips 64 words at a time by their bit_words_count, then single
+		//	words, and picks the bit in the last word with pdep where BMI2 has it.
+		//
+		template<typename Word>
+		inline std::size_t
+		bit_words_rank(Word const* w, std::size_t pos) {
+			std::size_t const bits = CHAR_BIT * sizeof(Word);
+			std::size_t const i = pos / bits;
+			std::size_t const rem = pos % bits;
+			return sprout::detail::bit_words_count(w, i)
+				+ (rem != 0 ? static_cast<std::size_t>(sprout::popcount(static_cast<Word>(w[i] & ~(~static_cast<Word>(0) << rem)))) : 0)
+				;
+		}
+		template<typename Word>
+		inline std::size_t
+		bit_words_select_in_word(Word x, std::size_t k) {
+#if defined(SPROUT_DETAIL_SIMD_SSE2) && defined(__BMI2__) && defined(__x86_64__)
+			return sprout::ctz(_pdep_u64(static_cast<std::uint64_t>(1) << k, x));
+#else
+			for (; k != 0; --k) {
+				x &= x - 1;
+			}
+			return sprout::ctz(x);
+#endif
+		}
+		template<typename Word>
+		inline std::size_t
+		bit_words_select(Word const* w, std::size_t n, std::size_t k) {
+			std::size_t const bits = CHAR_BIT * sizeof(Word);
+			std::size_t const chunk = 64;
+			std::size_t i = 0;
+			for (; n - i >= chunk; i += chunk) {
+				std::size_t const c = sprout::detail::bit_words_count(w + i, chunk);
+				if (c > k) {
+					break;
+				}
+				k -= c;
+			}
+			for (; i != n; ++i) {
+				std::size_t const c = sprout::popcount(w[i]);
+				if (c > k) {
+					return i * bits + sprout::detail::bit_words_select_in_word(w[i], k);
+				}
+				k -= c;
+			}
+			return n * bits;
+		}
+	}	// namespace detail
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_DETAIL_BIT_WORDS_HPP
@@ -0,0 +1,96 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_DETAIL_CHAR_SCAN_HPP
+#define SPROUT_DETAIL_CHAR_SCAN_HPP
+
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/bit/ctz.hpp>
+#include <sprout/detail/simd.hpp>
+
+namespace sprout {
+	namespace detail {
+		//
+		// find_any_char
+		//
+		//	First element of [first, last) equal to one of set[0], ..., set[k - 1],
+		//	or last. For char and k <= 4 the runtime path compares 16 or 32 bytes
+		//	at a time.
+		//
+		template<typename Elem>
+		inline SPROUT_CXX14_CONSTEXPR Elem const*
+		find_any_char_scalar(Elem const* first, Elem const* last, Elem const* set, std::size_t k) {
+			for (; first != last; ++first) {
+				for (std::size_t i = 0; i != k; ++i) {
+					if (*first == set[i]) {
+						return first;
+					}
+				}
+			}
+			return last;
+		}
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+		inline char const*
+		find_any_char_simd(char const* first, char const* last, char const* set, std::size_t k) {
+			// unused lanes repeat the last character
+			char const c0 = set[0];
+			char const c1 = set[k > 1 ? 1 : 0];
+			char const c2 = set[k > 2 ? 2 : k - 1];
+			char const c3 = set[k - 1];
+#	if defined(SPROUT_DETAIL_SIMD_AVX2)
+			__m256i const w0 = _mm256_set1_epi8(c0);
+			__m256i const w1 = _mm256_set1_epi8(c1);
+			__m256i const w2 = _mm256_set1_epi8(c2);
+			__m256i const w3 = _mm256_set1_epi8(c3);
+			for (; last - first >= 32; first += 32) {
+				__m256i const v = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(first));
+				unsigned const m = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_or_si256(
+					_mm256_or_si256(_mm256_cmpeq_epi8(v, w0), _mm256_cmpeq_epi8(v, w1)),
+					_mm256_or_si256(_mm256_cmpeq_epi8(v, w2), _mm256_cmpeq_epi8(v, w3))
+					)));
+				if (m != 0) {
+					return first + sprout::ctz(m);
+				}
+			}
+#	endif
+			__m128i const v0 = _mm_set1_epi8(c0);
+			__m128i const v1 = _mm_set1_epi8(c1);
+			__m128i const v2 = _mm_set1_epi8(c2);
+			__m128i const v3 = _mm_set1_epi8(c3);
+			for (; last - first >= 16; first += 16) {
+				__m128i const v = _mm_loadu_si128(reinterpret_cast<__m128i const*>(first));
+				unsigned const m = static_cast<unsigned>(_mm_movemask_epi8(_mm_or_si128(
+					_mm_or_si128(_mm_cmpeq_epi8(v, v0), _mm_cmpeq_epi8(v, v1)),
+					_mm_or_si128(_mm_cmpeq_epi8(v, v2), _mm_cmpeq_epi8(v, v3))
+					)));
+				if (m != 0) {
+					return first + sprout::ctz(m);
+				}
+			}
+			return sprout::detail::find_any_char_scalar(first, last, set, k);
+		}
+#endif
+
+		template<typename Elem>
+		inline SPROUT_CXX14_CONSTEXPR Elem const*
+		find_any_char(Elem const* first, Elem const* last, Elem const* set, std::size_t k) {
+			return sprout::detail::find_any_char_scalar(first, last, set, k);
+		}
+		inline SPROUT_CXX14_CONSTEXPR char const*
+		find_any_char(char const* first, char const* last, char const* set, std::size_t k) {
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+			if (k != 0 && k <= 4 && !SPROUT_DETAIL_IS_CONSTANT_EVALUATED()) {
+				return sprout::detail::find_any_char_simd(first, last, set, k);
+			}
+#endif
+			return sprout::detail::find_any_char_scalar(first, last, set, k);
+		}
+	}	// namespace detail
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_DETAIL_CHAR_SCAN_HPP
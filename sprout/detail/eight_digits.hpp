@@ -0,0 +1,65 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_DETAIL_EIGHT_DIGITS_HPP
+#define SPROUT_DETAIL_EIGHT_DIGITS_HPP
+
+#include <cstring>
+#include <sprout/config.hpp>
+#include <sprout/cstdint.hpp>
+#include <sprout/predef/other/endian.hpp>
+
+namespace sprout {
+	namespace detail {
+		//
+		// eight digits at a time
+		//
+		//	Eight ASCII characters are packed into one 64-bit word, first
+		//	character in the low byte, and checked and converted with a few
+		//	word-wide operations instead of eight dependent multiply-adds.
+		//
+		inline SPROUT_CONSTEXPR bool
+		is_eight_digits(std::uint64_t v) {
+			return ((v & UINT64_C(0xF0F0F0F0F0F0F0F0)) | (((v + UINT64_C(0x0606060606060606)) & UINT64_C(0xF0F0F0F0F0F0F0F0)) >> 4))
+				== UINT64_C(0x3333333333333333)
+				;
+		}
+		inline SPROUT_CONSTEXPR std::uint32_t
+		parse_eight_digits_2(std::uint64_t v) {
+			return static_cast<std::uint32_t>(
+				((v & UINT64_C(0x000000FF000000FF)) * (100 + (UINT64_C(1000000) << 32))
+					+ ((v >> 16) & UINT64_C(0x000000FF000000FF)) * (1 + (UINT64_C(10000) << 32))
+					) >> 32
+				);
+		}
+		inline SPROUT_CONSTEXPR std::uint32_t
+		parse_eight_digits_1(std::uint64_t v) {
+			return sprout::detail::parse_eight_digits_2(v * 10 + (v >> 8));
+		}
+		// requires is_eight_digits(v)
+		inline SPROUT_CONSTEXPR std::uint32_t
+		parse_eight_digits(std::uint64_t v) {
+			return sprout::detail::parse_eight_digits_1(v - UINT64_C(0x3030303030303030));
+		}
+		inline std::uint64_t
+		load_eight_digits(char const* p) {
+#if SPROUT_ENDIAN_LITTLE_BYTE
+			std::uint64_t v = 0;
+			std::memcpy(&v, p, sizeof(v));
+			return v;
+#else
+			std::uint64_t v = 0;
+			for (int i = 7; i >= 0; --i) {
+				v = (v << 8) | static_cast<unsigned char>(p[i]);
+			}
+			return v;
+#endif
+		}
+	}	// namespace detail
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_DETAIL_EIGHT_DIGITS_HPP
@@ -66,7 +66,7 @@ namespace sprout {
 		inline SPROUT_CONSTEXPR int
 		float_exponent10_positive(FloatType val) {
 			typedef sprout::pair<int, FloatType> type;
-			return float_exponent10_positive_0(type(val, 0), 1).first;
+			return float_exponent10_positive_0(type(0, val), 1).first;
 		}
 		template<typename FloatType>
 		inline SPROUT_CONSTEXPR sprout::pair<int, FloatType>
@@ -100,7 +100,7 @@ namespace sprout {
 		inline SPROUT_CONSTEXPR int
 		float_exponent10_negative(FloatType val) {
 			typedef sprout::pair<int, FloatType> type;
-			return float_exponent10_negative_0(type(val, 0), 1).first;
+			return float_exponent10_negative_0(type(0, val), 1).first;
 		}
 		// !!! OLD:
 //		template<typename FloatType>
@@ -125,10 +125,10 @@ namespace sprout {
 		float_exponent10(FloatType val) {
 			return val < 0
 				? val > -1
-					? sprout::detail::float_exponent10_negative(-val)
+					? -sprout::detail::float_exponent10_negative(-val)
 					: sprout::detail::float_exponent10_positive(-val)
 				: val < 1
-					? sprout::detail::float_exponent10_negative(val)
+					? -sprout::detail::float_exponent10_negative(val)
 					: sprout::detail::float_exponent10_positive(val)
 				;
 		}
@@ -0,0 +1,74 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_DETAIL_SIMD_HPP
+#define SPROUT_DETAIL_SIMD_HPP
+
+#include <sprout/config.hpp>
+#include <sprout/predef/hardware/simd.hpp>
+
+//
+// SPROUT_DETAIL_SIMD_SSE2
+// SPROUT_DETAIL_SIMD_SSE4_1
+// SPROUT_DETAIL_SIMD_AVX
+// SPROUT_DETAIL_SIMD_AVX2
+// SPROUT_DETAIL_SIMD_FMA
+//
+//	Selects the runtime kernels; constexpr evaluation always takes the scalar code.
+//
+#if !defined(SPROUT_CONFIG_DISABLE_SIMD) && defined(SPROUT_HW_SIMD_X86_AVAILABLE)
+#	if SPROUT_HW_SIMD_X86 >= SPROUT_HW_SIMD_X86_SSE2_VERSION
+#		define SPROUT_DETAIL_SIMD_SSE2 (1)
+#	endif
+#	if SPROUT_HW_SIMD_X86 >= SPROUT_HW_SIMD_X86_SSE4_1_VERSION
+#		define SPROUT_DETAIL_SIMD_SSE4_1 (1)
+#	endif
+#	if SPROUT_HW_SIMD_X86 >= SPROUT_HW_SIMD_X86_AVX_VERSION
+#		define SPROUT_DETAIL_SIMD_AVX (1)
+#	endif
+#	if SPROUT_HW_SIMD_X86 >= SPROUT_HW_SIMD_X86_AVX2_VERSION
+#		define SPROUT_DETAIL_SIMD_AVX2 (1)
+#	endif
+#	if defined(__FMA__) && defined(SPROUT_DETAIL_SIMD_AVX)
+#		define SPROUT_DETAIL_SIMD_FMA (1)
+#	endif
+#endif
+
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+#	include <immintrin.h>
+#endif
+
+//
+// SPROUT_DETAIL_IS_CONSTANT_EVALUATED
+//
+//	Lets a C++14 constexpr function take its SIMD kernel when evaluated at runtime.
+//	Without compiler support it is conservatively true, i.e. always scalar.
+//
+#if defined(SPROUT_CONFIG_DISABLE_CXX14_CONSTEXPR)
+#	define SPROUT_DETAIL_IS_CONSTANT_EVALUATED() (false)
+#elif defined(__has_builtin)
+#	if __has_builtin(__builtin_is_constant_evaluated)
+#		define SPROUT_DETAIL_IS_CONSTANT_EVALUATED() (__builtin_is_constant_evaluated())
+#	endif
+#endif
+#if !defined(SPROUT_DETAIL_IS_CONSTANT_EVALUATED)
+#	define SPROUT_DETAIL_IS_CONSTANT_EVALUATED() (true)
+#endif
+
+//
+// SPROUT_DETAIL_HAS_IS_CONSTANT_EVALUATED
+//
+//	Defined when __builtin_is_constant_evaluated() can pick a runtime path from
+//	a C++11 constexpr function as well.
+//
+#if defined(__has_builtin)
+#	if __has_builtin(__builtin_is_constant_evaluated)
+#		define SPROUT_DETAIL_HAS_IS_CONSTANT_EVALUATED (1)
+#	endif
+#endif
+
+#endif	// #ifndef SPROUT_DETAIL_SIMD_HPP
@@ -0,0 +1,94 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_DETAIL_TWO_DIGITS_HPP
+#define SPROUT_DETAIL_TWO_DIGITS_HPP
+
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/array/array.hpp>
+#include <sprout/detail/char_literal.hpp>
+
+//
+// SPROUT_DETAIL_TWO_DIGITS_TABLE
+//
+#define SPROUT_DETAIL_TWO_DIGITS_TABLE \
+	'0', '0', '0', '1', '0', '2', '0', '3', '0', '4', '0', '5', '0', '6', '0', '7', '0', '8', '0', '9', \
+	'1', '0', '1', '1', '1', '2', '1', '3', '1', '4', '1', '5', '1', '6', '1', '7', '1', '8', '1', '9', \
+	'2', '0', '2', '1', '2', '2', '2', '3', '2', '4', '2', '5', '2', '6', '2', '7', '2', '8', '2', '9', \
+	'3', '0', '3', '1', '3', '2', '3', '3', '3', '4', '3', '5', '3', '6', '3', '7', '3', '8', '3', '9', \
+	'4', '0', '4', '1', '4', '2', '4', '3', '4', '4', '4', '5', '4', '6', '4', '7', '4', '8', '4', '9', \
+	'5', '0', '5', '1', '5', '2', '5', '3', '5', '4', '5', '5', '5', '6', '5', '7', '5', '8', '5', '9', \
+	'6', '0', '6', '1', '6', '2', '6', '3', '6', '4', '6', '5', '6', '6', '6', '7', '6', '8', '6', '9', \
+	'7', '0', '7', '1', '7', '2', '7', '3', '7', '4', '7', '5', '7', '6', '7', '7', '7', '8', '7', '9', \
+	'8', '0', '8', '1', '8', '2', '8', '3', '8', '4', '8', '5', '8', '6', '8', '7', '8', '8', '8', '9', \
+	'9', '0', '9', '1', '9', '2', '9', '3', '9', '4', '9', '5', '9', '6', '9', '7', '9', '8', '9', '9'
+
+namespace sprout {
+	namespace detail {
+		//
+		// two_digits
+		//
+		//	"00" ... "99", so that one division by 100 yields two characters.
+		//
+		template<typename Dummy = void>
+		struct two_digits {
+		public:
+			typedef sprout::array<char, 200> table_type;
+		public:
+			SPROUT_STATIC_CONSTEXPR table_type table
+				SPROUT_STATIC_CONSTEXPR_DATA_MEMBER_INNER((table_type{{SPROUT_DETAIL_TWO_DIGITS_TABLE}}))
+				;
+		};
+		template<typename Dummy>
+		SPROUT_CONSTEXPR_OR_CONST typename sprout::detail::two_digits<Dummy>::table_type
+		sprout::detail::two_digits<Dummy>::table
+			SPROUT_STATIC_CONSTEXPR_DATA_MEMBER_OUTER((table_type{{SPROUT_DETAIL_TWO_DIGITS_TABLE}}))
+			;
+
+		//
+		// decimal_digits
+		//
+		//	Number of decimal digits of val, 1 for zero.
+		//
+		template<typename UInt>
+		inline SPROUT_CXX14_CONSTEXPR int
+		decimal_digits(UInt val) {
+			int n = 1;
+			for (; val >= 10000; val /= 10000) {
+				n += 4;
+			}
+			return n + (val >= 10 ? 1 : 0) + (val >= 100 ? 1 : 0) + (val >= 1000 ? 1 : 0);
+		}
+
+		//
+		// write_decimal_digits
+		//
+		//	Writes the n low decimal digits of val, zero padded, so that they end
+		//	at last, two per division. Returns the first written position.
+		//
+		template<typename Elem, typename UInt>
+		inline SPROUT_CXX14_CONSTEXPR Elem*
+		write_decimal_digits(Elem* last, UInt val, int n) {
+			typedef sprout::detail::two_digits<> digits_type;
+			for (; n >= 2; n -= 2) {
+				std::size_t const i = static_cast<std::size_t>(val % 100) * 2;
+				val /= 100;
+				*--last = static_cast<Elem>(digits_type::table[i + 1]);
+				*--last = static_cast<Elem>(digits_type::table[i]);
+			}
+			if (n != 0) {
+				*--last = static_cast<Elem>(SPROUT_CHAR_LITERAL('0', Elem) + val % 10);
+			}
+			return last;
+		}
+	}	// namespace detail
+}	// namespace sprout
+
+#undef SPROUT_DETAIL_TWO_DIGITS_TABLE
+
+#endif	// #ifndef SPROUT_DETAIL_TWO_DIGITS_HPP
@@ -0,0 +1,14 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_FIXED_UNORDERED_MAP_HPP
+#define SPROUT_FIXED_UNORDERED_MAP_HPP
+
+#include <sprout/config.hpp>
+#include <sprout/fixed_unordered_map/fixed_unordered_map.hpp>
+
+#endif	// #ifndef SPROUT_FIXED_UNORDERED_MAP_HPP
@@ -0,0 +1,102 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_FIXED_UNORDERED_MAP_DETAIL_CONTROL_GROUP_HPP
+#define SPROUT_FIXED_UNORDERED_MAP_DETAIL_CONTROL_GROUP_HPP
+
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/cstdint.hpp>
+#include <sprout/detail/simd.hpp>
+
+namespace sprout {
+	namespace detail {
+		//
+		// control bytes
+		//
+		//	One byte per slot: empty, deleted, or the low 7 bits of the hash (full).
+		//	Empty and deleted have the sign bit set, so a full slot is >= 0.
+		//
+		typedef signed char control_byte;
+		SPROUT_STATIC_CONSTEXPR sprout::detail::control_byte control_empty = -128;
+		SPROUT_STATIC_CONSTEXPR sprout::detail::control_byte control_deleted = -2;
+		SPROUT_STATIC_CONSTEXPR std::size_t control_group_width = 16;
+
+		//
+		// control group matches
+		//
+		//	Each returns a bitmask with bit j set when control byte j of the
+		//	16-byte group qualifies. The scalar versions are used in constant
+		//	evaluation; the SSE2 versions compare the whole group at once.
+		//
+		inline SPROUT_CXX14_CONSTEXPR std::uint32_t
+		control_match_scalar(sprout::detail::control_byte const* group, sprout::detail::control_byte h2) {
+			std::uint32_t mask = 0;
+			for (std::size_t j = 0; j != sprout::detail::control_group_width; ++j) {
+				mask |= static_cast<std::uint32_t>(group[j] == h2) << j;
+			}
+			return mask;
+		}
+		inline SPROUT_CXX14_CONSTEXPR std::uint32_t
+		control_match_empty_scalar(sprout::detail::control_byte const* group) {
+			return sprout::detail::control_match_scalar(group, sprout::detail::control_empty);
+		}
+		inline SPROUT_CXX14_CONSTEXPR std::uint32_t
+		control_match_free_scalar(sprout::detail::control_byte const* group) {
+			std::uint32_t mask = 0;
+			for (std::size_t j = 0; j != sprout::detail::control_group_width; ++j) {
+				mask |= static_cast<std::uint32_t>(group[j] < -1) << j;
+			}
+			return mask;
+		}
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+		inline std::uint32_t
+		control_match_sse2(sprout::detail::control_byte const* group, sprout::detail::control_byte h2) {
+			return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(
+				_mm_set1_epi8(h2), _mm_loadu_si128(reinterpret_cast<__m128i const*>(group))
+				)));
+		}
+		inline std::uint32_t
+		control_match_free_sse2(sprout::detail::control_byte const* group) {
+			return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(
+				_mm_set1_epi8(-1), _mm_loadu_si128(reinterpret_cast<__m128i const*>(group))
+				)));
+		}
+#endif
+
+		inline SPROUT_CXX14_CONSTEXPR std::uint32_t
+		control_match(sprout::detail::control_byte const* group, sprout::detail::control_byte h2) {
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+			if (!SPROUT_DETAIL_IS_CONSTANT_EVALUATED()) {
+				return sprout::detail::control_match_sse2(group, h2);
+			}
+#endif
+			return sprout::detail::control_match_scalar(group, h2);
+		}
+		inline SPROUT_CXX14_CONSTEXPR std::uint32_t
+		control_match_empty(sprout::detail::control_byte const* group) {
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+			if (!SPROUT_DETAIL_IS_CONSTANT_EVALUATED()) {
+				return sprout::detail::control_match_sse2(group, sprout::detail::control_empty);
+			}
+#endif
+			return sprout::detail::control_match_empty_scalar(group);
+		}
+		// empty or deleted
+		inline SPROUT_CXX14_CONSTEXPR std::uint32_t
+		control_match_free(sprout::detail::control_byte const* group) {
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+			if (!SPROUT_DETAIL_IS_CONSTANT_EVALUATED()) {
+				return sprout::detail::control_match_free_sse2(group);
+			}
+#endif
+			return sprout::detail::control_match_free_scalar(group);
+		}
+	}	// namespace detail
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_FIXED_UNORDERED_MAP_DETAIL_CONTROL_GROUP_HPP
@@ -0,0 +1,404 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_FIXED_UNORDERED_MAP_FIXED_UNORDERED_MAP_HPP
+#define SPROUT_FIXED_UNORDERED_MAP_FIXED_UNORDERED_MAP_HPP
+
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/cstdint.hpp>
+#include <sprout/array/array.hpp>
+#include <sprout/utility/pair/pair.hpp>
+#include <sprout/utility/move.hpp>
+#include <sprout/utility/swap.hpp>
+#include <sprout/type_traits/enabler_if.hpp>
+#include <sprout/bit/ctz.hpp>
+#include <sprout/functional/hash.hpp>
+#include <sprout/functional/equal_to.hpp>
+#include <sprout/fixed_unordered_map/detail/control_group.hpp>
+
+namespace sprout {
+	namespace detail {
+		//
+		// fixed_unordered_map_slot_count
+		//
+		//	Smallest power-of-two number of slots, at least one group, that keeps
+		//	Capacity elements under a 7/8 load factor.
+		//
+		template<std::size_t Capacity, std::size_t Slots = sprout::detail::control_group_width>
+		struct fixed_unordered_map_slot_count
+			: public std::conditional<
+				(Slots / 8 * 7 >= Capacity),
+				std::integral_constant<std::size_t, Slots>,
+				sprout::detail::fixed_unordered_map_slot_count<Capacity, Slots * 2>
+			>::type
+		{};
+
+		//
+		// fixed_unordered_map_iterator
+		//
+		template<typename Value>
+		class fixed_unordered_map_iterator {
+			template<typename OtherValue>
+			friend class sprout::detail::fixed_unordered_map_iterator;
+		public:
+			typedef std::forward_iterator_tag iterator_category;
+			typedef typename std::remove_const<Value>::type value_type;
+			typedef std::ptrdiff_t difference_type;
+			typedef Value* pointer;
+			typedef Value& reference;
+		private:
+			sprout::detail::control_byte const* control_;
+			sprout::detail::control_byte const* last_;
+			pointer slot_;
+		private:
+			SPROUT_CXX14_CONSTEXPR void skip_free() {
+				for (; control_ != last_ && *control_ < 0; ++control_, ++slot_)
+					;
+			}
+		public:
+			SPROUT_CONSTEXPR fixed_unordered_map_iterator()
+				: control_(), last_(), slot_()
+			{}
+			SPROUT_CXX14_CONSTEXPR fixed_unordered_map_iterator(
+				sprout::detail::control_byte const* control, sprout::detail::control_byte const* last, pointer slot
+				)
+				: control_(control), last_(last), slot_(slot)
+			{
+				skip_free();
+			}
+			template<typename OtherValue, typename sprout::enabler_if<std::is_convertible<OtherValue*, Value*>::value>::type = sprout::enabler>
+			SPROUT_CONSTEXPR fixed_unordered_map_iterator(sprout::detail::fixed_unordered_map_iterator<OtherValue> const& other)
+				: control_(other.control_), last_(other.last_), slot_(other.slot_)
+			{}
+			SPROUT_CONSTEXPR pointer base() const {
+				return slot_;
+			}
+			SPROUT_CONSTEXPR reference operator*() const {
+				return *slot_;
+			}
+			SPROUT_CONSTEXPR pointer operator->() const {
+				return slot_;
+			}
+			SPROUT_CXX14_CONSTEXPR fixed_unordered_map_iterator& operator++() {
+				++control_;
+				++slot_;
+				skip_free();
+				return *this;
+			}
+			SPROUT_CXX14_CONSTEXPR fixed_unordered_map_iterator operator++(int) {
+				fixed_unordered_map_iterator result(*this);
+				++*this;
+				return result;
+			}
+			template<typename OtherValue>
+			SPROUT_CONSTEXPR bool operator==(sprout::detail::fixed_unordered_map_iterator<OtherValue> const& rhs) const {
+				return slot_ == rhs.slot_;
+			}
+			template<typename OtherValue>
+			SPROUT_CONSTEXPR bool operator!=(sprout::detail::fixed_unordered_map_iterator<OtherValue> const& rhs) const {
+				return slot_ != rhs.slot_;
+			}
+		};
+	}	// namespace detail
+
+	//
+	// fixed_unordered_map
+	//
+	//	Open-addressing hash map holding up to Capacity elements in place.
+	//	Slots and one control byte per slot live in sprout::array members; lookups
+	//	probe 16-slot groups (SSE2 at runtime, scalar in constant evaluation).
+	//	Erasing leaves a tombstone unless the group still has an empty slot, and
+	//	tombstones are purged in place when an insertion would run out of room.
+	//	Inserting beyond Capacity throws std::length_error.
+	//	Mutating members are constexpr in C++14.
+	//
+	template<
+		typename Key, typename T, std::size_t Capacity,
+		typename Hash = sprout::hash<Key>,
+		typename KeyEqual = sprout::equal_to<Key>
+	>
+	class fixed_unordered_map {
+	public:
+		typedef Key key_type;
+		typedef T mapped_type;
+		typedef sprout::pair<Key, T> value_type;
+		typedef Hash hasher;
+		typedef KeyEqual key_equal;
+		typedef std::size_t size_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef value_type& reference;
+		typedef value_type const& const_reference;
+		typedef value_type* pointer;
+		typedef value_type const* const_pointer;
+		typedef sprout::detail::fixed_unordered_map_iterator<value_type> iterator;
+		typedef sprout::detail::fixed_unordered_map_iterator<value_type const> const_iterator;
+	public:
+		SPROUT_STATIC_CONSTEXPR size_type static_capacity = Capacity;
+		SPROUT_STATIC_CONSTEXPR size_type slot_count = sprout::detail::fixed_unordered_map_slot_count<Capacity>::value;
+	private:
+		typedef sprout::detail::control_byte control_byte;
+		SPROUT_STATIC_CONSTEXPR size_type group_width = sprout::detail::control_group_width;
+		SPROUT_STATIC_CONSTEXPR size_type group_count = slot_count / group_width;
+	private:
+		sprout::array<value_type, slot_count> slots_;
+		sprout::array<control_byte, slot_count> control_;
+		size_type size_;
+		size_type growth_left_;
+	private:
+		static SPROUT_CONSTEXPR std::uint64_t hash_of(key_type const& key) {
+			return sprout::hash_detail::bytes_fold(static_cast<std::uint64_t>(hasher()(key)), UINT64_C(0x9E3779B97F4A7C15));
+		}
+		static SPROUT_CONSTEXPR control_byte h2_of(std::uint64_t h) {
+			return static_cast<control_byte>(h & 0x7F);
+		}
+		static SPROUT_CONSTEXPR size_type first_group_of(std::uint64_t h) {
+			return static_cast<size_type>(h >> 7) & (group_count - 1);
+		}
+		SPROUT_CXX14_CONSTEXPR size_type find_index(key_type const& key, std::uint64_t h) const {
+			size_type g = first_group_of(h);
+			for (size_type step = 0; step != group_count; g = (g + ++step) & (group_count - 1)) {
+				control_byte const* group = control_.data() + g * group_width;
+				for (std::uint32_t m = sprout::detail::control_match(group, h2_of(h)); m != 0; m &= m - 1) {
+					size_type const i = g * group_width + sprout::ctz(m);
+					if (key_equal()(slots_[i].first, key)) {
+						return i;
+					}
+				}
+				if (sprout::detail::control_match_empty(group) != 0) {
+					break;
+				}
+			}
+			return slot_count;
+		}
+		// first empty or deleted slot on the probe sequence
+		SPROUT_CXX14_CONSTEXPR size_type find_free(std::uint64_t h) const {
+			size_type g = first_group_of(h);
+			for (size_type step = 0; ; g = (g + ++step) & (group_count - 1)) {
+				std::uint32_t const m = sprout::detail::control_match_free(control_.data() + g * group_width);
+				if (m != 0) {
+					return g * group_width + sprout::ctz(m);
+				}
+			}
+		}
+		// rehash in place so that every tombstone becomes empty
+		SPROUT_CXX14_CONSTEXPR void drop_deleted() {
+			for (size_type i = 0; i != slot_count; ++i) {
+				control_[i] = control_[i] >= 0 ? sprout::detail::control_deleted : sprout::detail::control_empty;
+			}
+			// deleted now marks an element still waiting to be placed
+			for (size_type i = 0; i != slot_count; ++i) {
+				if (control_[i] != sprout::detail::control_deleted) {
+					continue;
+				}
+				std::uint64_t const h = hash_of(slots_[i].first);
+				size_type const target = find_free(h);
+				if (target / group_width == i / group_width) {
+					control_[i] = h2_of(h);
+				} else if (control_[target] == sprout::detail::control_empty) {
+					slots_[target] = sprout::move(slots_[i]);
+					slots_[i] = value_type();
+					control_[target] = h2_of(h);
+					control_[i] = sprout::detail::control_empty;
+				} else {
+					sprout::swap(slots_[target], slots_[i]);
+					control_[target] = h2_of(h);
+					--i;
+				}
+			}
+			growth_left_ = Capacity - size_;
+		}
+		SPROUT_CXX14_CONSTEXPR size_type prepare_insert(std::uint64_t h) {
+			if (size_ == Capacity) {
+				throw std::length_error("fixed_unordered_map<>: capacity exceeded");
+			}
+			size_type i = find_free(h);
+			if (growth_left_ == 0 && control_[i] == sprout::detail::control_empty) {
+				drop_deleted();
+				i = find_free(h);
+			}
+			growth_left_ -= control_[i] == sprout::detail::control_empty ? 1 : 0;
+			control_[i] = h2_of(h);
+			++size_;
+			return i;
+		}
+		SPROUT_CXX14_CONSTEXPR void erase_at(size_type i) {
+			size_type const g = i / group_width * group_width;
+			if (sprout::detail::control_match_empty(control_.data() + g) != 0) {
+				control_[i] = sprout::detail::control_empty;
+				++growth_left_;
+			} else {
+				control_[i] = sprout::detail::control_deleted;
+			}
+			slots_[i] = value_type();
+			--size_;
+		}
+		SPROUT_CXX14_CONSTEXPR iterator iterator_at(size_type i) {
+			return iterator(control_.data() + i, control_.data() + slot_count, slots_.data() + i);
+		}
+		SPROUT_CXX14_CONSTEXPR const_iterator iterator_at(size_type i) const {
+			return const_iterator(control_.data() + i, control_.data() + slot_count, slots_.data() + i);
+		}
+	public:
+		// construct/copy/destroy:
+		SPROUT_CXX14_CONSTEXPR fixed_unordered_map()
+			: slots_(), control_(), size_(0), growth_left_(Capacity)
+		{
+			control_.fill(sprout::detail::control_empty);
+		}
+		template<typename InputIterator>
+		SPROUT_CXX14_CONSTEXPR fixed_unordered_map(InputIterator first, InputIterator last)
+			: slots_(), control_(), size_(0), growth_left_(Capacity)
+		{
+			control_.fill(sprout::detail::control_empty);
+			insert(first, last);
+		}
+		// iterators:
+		SPROUT_CXX14_CONSTEXPR iterator begin() {
+			return iterator_at(0);
+		}
+		SPROUT_CXX14_CONSTEXPR const_iterator begin() const {
+			return iterator_at(0);
+		}
+		SPROUT_CXX14_CONSTEXPR iterator end() {
+			return iterator_at(slot_count);
+		}
+		SPROUT_CXX14_CONSTEXPR const_iterator end() const {
+			return iterator_at(slot_count);
+		}
+		SPROUT_CXX14_CONSTEXPR const_iterator cbegin() const {
+			return iterator_at(0);
+		}
+		SPROUT_CXX14_CONSTEXPR const_iterator cend() const {
+			return iterator_at(slot_count);
+		}
+		// capacity:
+		SPROUT_CONSTEXPR size_type size() const SPROUT_NOEXCEPT {
+			return size_;
+		}
+		SPROUT_CONSTEXPR bool empty() const SPROUT_NOEXCEPT {
+			return size_ == 0;
+		}
+		SPROUT_CONSTEXPR size_type max_size() const SPROUT_NOEXCEPT {
+			return Capacity;
+		}
+		SPROUT_CONSTEXPR size_type bucket_count() const SPROUT_NOEXCEPT {
+			return slot_count;
+		}
+		// modifiers:
+		SPROUT_CXX14_CONSTEXPR sprout::pair<iterator, bool> insert(value_type const& value) {
+			std::uint64_t const h = hash_of(value.first);
+			size_type i = find_index(value.first, h);
+			if (i != slot_count) {
+				return sprout::pair<iterator, bool>(iterator_at(i), false);
+			}
+			i = prepare_insert(h);
+			slots_[i] = value;
+			return sprout::pair<iterator, bool>(iterator_at(i), true);
+		}
+		template<typename InputIterator>
+		SPROUT_CXX14_CONSTEXPR void insert(InputIterator first, InputIterator last) {
+			for (; first != last; ++first) {
+				insert(*first);
+			}
+		}
+		SPROUT_CXX14_CONSTEXPR sprout::pair<iterator, bool> insert_or_assign(key_type const& key, mapped_type const& obj) {
+			std::uint64_t const h = hash_of(key);
+			size_type i = find_index(key, h);
+			if (i != slot_count) {
+				slots_[i].second = obj;
+				return sprout::pair<iterator, bool>(iterator_at(i), false);
+			}
+			i = prepare_insert(h);
+			slots_[i] = value_type(key, obj);
+			return sprout::pair<iterator, bool>(iterator_at(i), true);
+		}
+		SPROUT_CXX14_CONSTEXPR size_type erase(key_type const& key) {
+			size_type const i = find_index(key, hash_of(key));
+			if (i == slot_count) {
+				return 0;
+			}
+			erase_at(i);
+			return 1;
+		}
+		SPROUT_CXX14_CONSTEXPR iterator erase(const_iterator position) {
+			size_type const i = position.base() - slots_.data();
+			erase_at(i);
+			return iterator_at(i + 1);
+		}
+		SPROUT_CXX14_CONSTEXPR void clear() {
+			for (size_type i = 0; i != slot_count; ++i) {
+				if (control_[i] >= 0) {
+					slots_[i] = value_type();
+				}
+				control_[i] = sprout::detail::control_empty;
+			}
+			size_ = 0;
+			growth_left_ = Capacity;
+		}
+		// lookup:
+		SPROUT_CXX14_CONSTEXPR iterator find(key_type const& key) {
+			return iterator_at(find_index(key, hash_of(key)));
+		}
+		SPROUT_CXX14_CONSTEXPR const_iterator find(key_type const& key) const {
+			return iterator_at(find_index(key, hash_of(key)));
+		}
+		SPROUT_CXX14_CONSTEXPR size_type count(key_type const& key) const {
+			return find_index(key, hash_of(key)) != slot_count ? 1 : 0;
+		}
+		SPROUT_CXX14_CONSTEXPR bool contains(key_type const& key) const {
+			return find_index(key, hash_of(key)) != slot_count;
+		}
+		SPROUT_CXX14_CONSTEXPR mapped_type& at(key_type const& key) {
+			size_type const i = find_index(key, hash_of(key));
+			if (i == slot_count) {
+				throw std::out_of_range("fixed_unordered_map<>: key not found");
+			}
+			return slots_[i].second;
+		}
+		SPROUT_CXX14_CONSTEXPR mapped_type const& at(key_type const& key) const {
+			size_type const i = find_index(key, hash_of(key));
+			if (i == slot_count) {
+				throw std::out_of_range("fixed_unordered_map<>: key not found");
+			}
+			return slots_[i].second;
+		}
+		SPROUT_CXX14_CONSTEXPR mapped_type& operator[](key_type const& key) {
+			std::uint64_t const h = hash_of(key);
+			size_type i = find_index(key, h);
+			if (i == slot_count) {
+				i = prepare_insert(h);
+				slots_[i] = value_type(key, mapped_type());
+			}
+			return slots_[i].second;
+		}
+		// observers:
+		SPROUT_CONSTEXPR hasher hash_function() const {
+			return hasher();
+		}
+		SPROUT_CONSTEXPR key_equal key_eq() const {
+			return key_equal();
+		}
+	};
+	template<typename Key, typename T, std::size_t Capacity, typename Hash, typename KeyEqual>
+	SPROUT_CONSTEXPR_OR_CONST typename sprout::fixed_unordered_map<Key, T, Capacity, Hash, KeyEqual>::size_type
+	sprout::fixed_unordered_map<Key, T, Capacity, Hash, KeyEqual>::static_capacity;
+	template<typename Key, typename T, std::size_t Capacity, typename Hash, typename KeyEqual>
+	SPROUT_CONSTEXPR_OR_CONST typename sprout::fixed_unordered_map<Key, T, Capacity, Hash, KeyEqual>::size_type
+	sprout::fixed_unordered_map<Key, T, Capacity, Hash, KeyEqual>::slot_count;
+	template<typename Key, typename T, std::size_t Capacity, typename Hash, typename KeyEqual>
+	SPROUT_CONSTEXPR_OR_CONST typename sprout::fixed_unordered_map<Key, T, Capacity, Hash, KeyEqual>::size_type
+	sprout::fixed_unordered_map<Key, T, Capacity, Hash, KeyEqual>::group_width;
+	template<typename Key, typename T, std::size_t Capacity, typename Hash, typename KeyEqual>
+	SPROUT_CONSTEXPR_OR_CONST typename sprout::fixed_unordered_map<Key, T, Capacity, Hash, KeyEqual>::size_type
+	sprout::fixed_unordered_map<Key, T, Capacity, Hash, KeyEqual>::group_count;
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_FIXED_UNORDERED_MAP_FIXED_UNORDERED_MAP_HPP
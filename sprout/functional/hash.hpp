@@ -16,6 +16,7 @@
 #include <sprout/functional/hash/hash_combine.hpp>
 #include <sprout/functional/hash/hash_values.hpp>
 #include <sprout/functional/hash/hash_range.hpp>
+#include <sprout/functional/hash/hash_bytes.hpp>
 #include <sprout/functional/hash/hash_value_traits.hpp>
 
 #endif	// #ifndef SPROUT_FUNCTIONAL_HASH_HPP
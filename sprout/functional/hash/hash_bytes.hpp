@@ -0,0 +1,517 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_FUNCTIONAL_HASH_HASH_BYTES_HPP
+#define SPROUT_FUNCTIONAL_HASH_HASH_BYTES_HPP
+
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/cstdint.hpp>
+#include <sprout/array/array.hpp>
+#include <sprout/array/make_array.hpp>
+#include <sprout/index_tuple/metafunction.hpp>
+#include <sprout/container/functions.hpp>
+#include <sprout/iterator/operation.hpp>
+#include <sprout/predef/other/endian.hpp>
+#include <sprout/detail/simd.hpp>
+
+namespace sprout {
+	namespace hash_detail {
+		SPROUT_STATIC_CONSTEXPR std::uint64_t bytes_prime1 = UINT64_C(0x9E3779B185EBCA87);
+		SPROUT_STATIC_CONSTEXPR std::uint64_t bytes_prime2 = UINT64_C(0xC2B2AE3D27D4EB4F);
+		SPROUT_STATIC_CONSTEXPR std::uint64_t bytes_prime3 = UINT64_C(0x165667B19E3779F9);
+		SPROUT_STATIC_CONSTEXPR std::uint64_t bytes_prime4 = UINT64_C(0x85EBCA77C2B2AE63);
+		SPROUT_STATIC_CONSTEXPR std::uint64_t bytes_prime32 = UINT64_C(0x9E3779B1);
+
+		inline SPROUT_CONSTEXPR std::uint64_t
+		bytes_splitmix_2(std::uint64_t z) {
+			return z ^ (z >> 31);
+		}
+		inline SPROUT_CONSTEXPR std::uint64_t
+		bytes_splitmix_1(std::uint64_t z) {
+			return sprout::hash_detail::bytes_splitmix_2((z ^ (z >> 27)) * UINT64_C(0x94D049BB133111EB));
+		}
+		inline SPROUT_CONSTEXPR std::uint64_t
+		bytes_splitmix(std::uint64_t z) {
+			return sprout::hash_detail::bytes_splitmix_1((z ^ (z >> 30)) * UINT64_C(0xBF58476D1CE4E5B9));
+		}
+		template<sprout::index_t... Indexes>
+		inline SPROUT_CONSTEXPR sprout::array<std::uint64_t, sizeof...(Indexes)>
+		make_bytes_secret(sprout::index_tuple<Indexes...>) {
+			return sprout::make_array<std::uint64_t>(
+				sprout::hash_detail::bytes_splitmix((Indexes + 1) * UINT64_C(0x9E3779B97F4A7C15))...
+				);
+		}
+
+		//
+		// bytes_secret
+		//
+		//	Eight stripes of four lane keys, shared by the constexpr and runtime paths.
+		//
+		template<typename Dummy = void>
+		struct bytes_secret {
+		public:
+			typedef sprout::array<std::uint64_t, 32> table_type;
+		public:
+			SPROUT_STATIC_CONSTEXPR table_type table
+				SPROUT_STATIC_CONSTEXPR_DATA_MEMBER_INNER((sprout::hash_detail::make_bytes_secret(sprout::make_index_tuple<32>::make())))
+				;
+		};
+		template<typename Dummy>
+		SPROUT_CONSTEXPR_OR_CONST typename sprout::hash_detail::bytes_secret<Dummy>::table_type
+		sprout::hash_detail::bytes_secret<Dummy>::table
+			SPROUT_STATIC_CONSTEXPR_DATA_MEMBER_OUTER((sprout::hash_detail::make_bytes_secret(sprout::make_index_tuple<32>::make())))
+			;
+
+		inline SPROUT_CONSTEXPR std::uint64_t
+		bytes_secret_at(std::size_t i) {
+			return sprout::hash_detail::bytes_secret<>::table[i];
+		}
+
+		//
+		// 64x64 -> 128 multiply, folded to 64 bits
+		//
+		inline SPROUT_CONSTEXPR std::uint64_t
+		bytes_fold_3(std::uint64_t ll, std::uint64_t hh, std::uint64_t cross) {
+			return ((cross << 32) | (ll & UINT64_C(0xFFFFFFFF))) ^ (hh + (cross >> 32));
+		}
+		inline SPROUT_CONSTEXPR std::uint64_t
+		bytes_fold_2(std::uint64_t ll, std::uint64_t lh, std::uint64_t hl, std::uint64_t hh) {
+			return sprout::hash_detail::bytes_fold_3(
+				ll, hh + (hl >> 32),
+				(ll >> 32) + (hl & UINT64_C(0xFFFFFFFF)) + lh
+				);
+		}
+		inline SPROUT_CONSTEXPR std::uint64_t
+		bytes_fold(std::uint64_t a, std::uint64_t b) {
+			return sprout::hash_detail::bytes_fold_2(
+				(a & UINT64_C(0xFFFFFFFF)) * (b & UINT64_C(0xFFFFFFFF)),
+				(a & UINT64_C(0xFFFFFFFF)) * (b >> 32),
+				(a >> 32) * (b & UINT64_C(0xFFFFFFFF)),
+				(a >> 32) * (b >> 32)
+				);
+		}
+		inline SPROUT_CONSTEXPR std::uint64_t
+		bytes_avalanche_1(std::uint64_t h) {
+			return h ^ (h >> 32);
+		}
+		inline SPROUT_CONSTEXPR std::uint64_t
+		bytes_avalanche(std::uint64_t h) {
+			return sprout::hash_detail::bytes_avalanche_1((h ^ (h >> 37)) * UINT64_C(0x165667919E3779F9));
+		}
+		inline SPROUT_CONSTEXPR std::uint64_t
+		bytes_mulk(std::uint64_t k) {
+			return (k & UINT64_C(0xFFFFFFFF)) * (k >> 32);
+		}
+		inline SPROUT_CONSTEXPR std::uint64_t
+		bytes_scramble(std::uint64_t x, std::uint64_t s) {
+			return ((x ^ (x >> 47)) ^ s) * sprout::hash_detail::bytes_prime32;
+		}
+
+		//
+		// constexpr byte access: each element contributes sizeof(T) little-endian bytes
+		//
+		template<typename RandomAccessIterator>
+		struct bytes_unit {
+		public:
+			typedef typename std::decay<typename std::iterator_traits<RandomAccessIterator>::value_type>::type value_type;
+			typedef typename std::make_unsigned<value_type>::type type;
+			SPROUT_STATIC_CONSTEXPR std::size_t size = sizeof(value_type);
+		};
+		template<typename RandomAccessIterator>
+		inline SPROUT_CONSTEXPR std::uint64_t
+		bytes_at(RandomAccessIterator first, std::size_t i) {
+			typedef sprout::hash_detail::bytes_unit<RandomAccessIterator> unit;
+			return (static_cast<std::uint64_t>(
+				static_cast<typename unit::type>(first[i / unit::size])
+				) >> (8 * (i % unit::size))) & 0xFF;
+		}
+		template<typename RandomAccessIterator>
+		inline SPROUT_CONSTEXPR std::uint64_t
+		bytes_read32(RandomAccessIterator first, std::size_t i) {
+			return sprout::hash_detail::bytes_at(first, i)
+				| (sprout::hash_detail::bytes_at(first, i + 1) << 8)
+				| (sprout::hash_detail::bytes_at(first, i + 2) << 16)
+				| (sprout::hash_detail::bytes_at(first, i + 3) << 24)
+				;
+		}
+		template<typename RandomAccessIterator>
+		inline SPROUT_CONSTEXPR std::uint64_t
+		bytes_read64(RandomAccessIterator first, std::size_t i) {
+			return sprout::hash_detail::bytes_read32(first, i)
+				| (sprout::hash_detail::bytes_read32(first, i + 4) << 32)
+				;
+		}
+
+		// 0-16 bytes
+		inline SPROUT_CONSTEXPR std::uint64_t
+		bytes_short_mix(std::uint64_t a, std::uint64_t b, std::size_t n, std::uint64_t seed) {
+			return sprout::hash_detail::bytes_avalanche(
+				sprout::hash_detail::bytes_fold(
+					a ^ (sprout::hash_detail::bytes_secret_at(0) + seed),
+					b ^ (sprout::hash_detail::bytes_secret_at(1) - seed)
+					)
+				+ n * sprout::hash_detail::bytes_prime1
+				);
+		}
+		template<typename RandomAccessIterator>
+		inline SPROUT_CONSTEXPR std::uint64_t
+		bytes_short(RandomAccessIterator first, std::size_t n, std::uint64_t seed) {
+			return n >= 8 ? sprout::hash_detail::bytes_short_mix(
+					sprout::hash_detail::bytes_read64(first, 0), sprout::hash_detail::bytes_read64(first, n - 8), n, seed
+					)
+				: n >= 4 ? sprout::hash_detail::bytes_short_mix(
+					sprout::hash_detail::bytes_read32(first, 0), sprout::hash_detail::bytes_read32(first, n - 4), n, seed
+					)
+				: n > 0 ? sprout::hash_detail::bytes_short_mix(
+					(sprout::hash_detail::bytes_at(first, 0) << 16)
+						| (sprout::hash_detail::bytes_at(first, n >> 1) << 8)
+						| sprout::hash_detail::bytes_at(first, n - 1),
+					0, n, seed
+					)
+				: sprout::hash_detail::bytes_short_mix(0, 0, 0, seed)
+				;
+		}
+
+		// 17-128 bytes: 16-byte chunks, the last one aligned to the end
+		template<typename RandomAccessIterator>
+		inline SPROUT_CONSTEXPR std::uint64_t
+		bytes_chunk(RandomAccessIterator first, std::size_t off, std::size_t k, std::uint64_t seed) {
+			return sprout::hash_detail::bytes_fold(
+				sprout::hash_detail::bytes_read64(first, off) ^ (sprout::hash_detail::bytes_secret_at(2 * k) + seed),
+				sprout::hash_detail::bytes_read64(first, off + 8) ^ (sprout::hash_detail::bytes_secret_at(2 * k + 1) - seed)
+				);
+		}
+		template<typename RandomAccessIterator>
+		inline SPROUT_CONSTEXPR std::uint64_t
+		bytes_medium(RandomAccessIterator first, std::size_t n, std::uint64_t seed, std::size_t k, std::size_t chunks, std::uint64_t acc) {
+			return k == chunks ? sprout::hash_detail::bytes_avalanche(acc)
+				: sprout::hash_detail::bytes_medium(
+					first, n, seed, k + 1, chunks,
+					acc + sprout::hash_detail::bytes_chunk(first, k + 1 == chunks ? n - 16 : 16 * k, k, seed)
+					)
+				;
+		}
+
+		// 129- bytes: four 64-bit lanes over 32-byte stripes, scrambled every 8 stripes
+		typedef sprout::array<std::uint64_t, 4> bytes_acc;
+		inline SPROUT_CONSTEXPR sprout::hash_detail::bytes_acc
+		bytes_stripe_1(
+			sprout::hash_detail::bytes_acc const& acc,
+			std::uint64_t d0, std::uint64_t d1, std::uint64_t d2, std::uint64_t d3,
+			std::size_t row, std::uint64_t seed
+			)
+		{
+			return sprout::hash_detail::bytes_acc{{
+				acc[0] + d1 + sprout::hash_detail::bytes_mulk(d0 ^ (sprout::hash_detail::bytes_secret_at(row * 4 + 0) + seed)),
+				acc[1] + d0 + sprout::hash_detail::bytes_mulk(d1 ^ (sprout::hash_detail::bytes_secret_at(row * 4 + 1) + seed)),
+				acc[2] + d3 + sprout::hash_detail::bytes_mulk(d2 ^ (sprout::hash_detail::bytes_secret_at(row * 4 + 2) + seed)),
+				acc[3] + d2 + sprout::hash_detail::bytes_mulk(d3 ^ (sprout::hash_detail::bytes_secret_at(row * 4 + 3) + seed))
+				}};
+		}
+		template<typename RandomAccessIterator>
+		inline SPROUT_CONSTEXPR sprout::hash_detail::bytes_acc
+		bytes_stripe(
+			RandomAccessIterator first, std::size_t off,
+			sprout::hash_detail::bytes_acc const& acc, std::size_t row, std::uint64_t seed
+			)
+		{
+			return sprout::hash_detail::bytes_stripe_1(
+				acc,
+				sprout::hash_detail::bytes_read64(first, off), sprout::hash_detail::bytes_read64(first, off + 8),
+				sprout::hash_detail::bytes_read64(first, off + 16), sprout::hash_detail::bytes_read64(first, off + 24),
+				row, seed
+				);
+		}
+		inline SPROUT_CONSTEXPR sprout::hash_detail::bytes_acc
+		bytes_scramble_acc(sprout::hash_detail::bytes_acc const& acc) {
+			return sprout::hash_detail::bytes_acc{{
+				sprout::hash_detail::bytes_scramble(acc[0], sprout::hash_detail::bytes_secret_at(28)),
+				sprout::hash_detail::bytes_scramble(acc[1], sprout::hash_detail::bytes_secret_at(29)),
+				sprout::hash_detail::bytes_scramble(acc[2], sprout::hash_detail::bytes_secret_at(30)),
+				sprout::hash_detail::bytes_scramble(acc[3], sprout::hash_detail::bytes_secret_at(31))
+				}};
+		}
+		inline SPROUT_CONSTEXPR std::uint64_t
+		bytes_merge(sprout::hash_detail::bytes_acc const& acc, std::size_t n) {
+			return sprout::hash_detail::bytes_avalanche(
+				n * sprout::hash_detail::bytes_prime1
+				+ sprout::hash_detail::bytes_fold(acc[0] ^ sprout::hash_detail::bytes_secret_at(8), acc[1] ^ sprout::hash_detail::bytes_secret_at(9))
+				+ sprout::hash_detail::bytes_fold(acc[2] ^ sprout::hash_detail::bytes_secret_at(10), acc[3] ^ sprout::hash_detail::bytes_secret_at(11))
+				);
+		}
+		// stripes [first_stripe, last_stripe), halved so that the depth is log2 of the count
+		template<typename RandomAccessIterator>
+		inline SPROUT_CONSTEXPR sprout::hash_detail::bytes_acc
+		bytes_stripes(
+			RandomAccessIterator first, sprout::hash_detail::bytes_acc const& acc,
+			std::size_t first_stripe, std::size_t last_stripe, std::uint64_t seed
+			)
+		{
+			return last_stripe - first_stripe == 0 ? acc
+				: last_stripe - first_stripe == 1
+					? first_stripe % 8 == 7
+						? sprout::hash_detail::bytes_scramble_acc(sprout::hash_detail::bytes_stripe(first, 32 * first_stripe, acc, 7, seed))
+						: sprout::hash_detail::bytes_stripe(first, 32 * first_stripe, acc, first_stripe % 8, seed)
+				: sprout::hash_detail::bytes_stripes(
+					first,
+					sprout::hash_detail::bytes_stripes(
+						first, acc, first_stripe, first_stripe + (last_stripe - first_stripe) / 2, seed
+						),
+					first_stripe + (last_stripe - first_stripe) / 2, last_stripe, seed
+					)
+				;
+		}
+		// the last stripe is aligned to the end and keyed with the next row
+		template<typename RandomAccessIterator>
+		inline SPROUT_CONSTEXPR std::uint64_t
+		bytes_long(RandomAccessIterator first, std::size_t n, std::uint64_t seed, std::size_t stripes, sprout::hash_detail::bytes_acc const& acc) {
+			return sprout::hash_detail::bytes_merge(
+				sprout::hash_detail::bytes_stripe(first, n - 32, acc, stripes % 8, seed), n
+				);
+		}
+
+		template<typename RandomAccessIterator>
+		inline SPROUT_CONSTEXPR std::uint64_t
+		hash_bytes_impl(RandomAccessIterator first, std::size_t n, std::uint64_t seed) {
+			return n <= 16 ? sprout::hash_detail::bytes_short(first, n, seed)
+				: n <= 128 ? sprout::hash_detail::bytes_medium(first, n, seed, 0, (n + 15) / 16, n * sprout::hash_detail::bytes_prime1)
+				: sprout::hash_detail::bytes_long(
+					first, n, seed, (n - 1) / 32,
+					sprout::hash_detail::bytes_stripes(
+						first,
+						sprout::hash_detail::bytes_acc{{
+							sprout::hash_detail::bytes_prime1, sprout::hash_detail::bytes_prime2,
+							sprout::hash_detail::bytes_prime3, sprout::hash_detail::bytes_prime4
+							}},
+						0, (n - 1) / 32, seed
+						)
+					)
+				;
+		}
+
+		//
+		// runtime path
+		//
+		inline std::uint64_t
+		bytes_load64(unsigned char const* p) {
+#if SPROUT_ENDIAN_LITTLE_BYTE
+			std::uint64_t v;
+			std::memcpy(&v, p, sizeof(v));
+			return v;
+#else
+			return sprout::hash_detail::bytes_read64(p, 0);
+#endif
+		}
+		inline std::uint64_t
+		bytes_load32(unsigned char const* p) {
+#if SPROUT_ENDIAN_LITTLE_BYTE
+			std::uint32_t v;
+			std::memcpy(&v, p, sizeof(v));
+			return v;
+#else
+			return sprout::hash_detail::bytes_read32(p, 0);
+#endif
+		}
+		inline std::uint64_t
+		bytes_fold_runtime(std::uint64_t a, std::uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+			unsigned __int128 const r = static_cast<unsigned __int128>(a) * b;
+			return static_cast<std::uint64_t>(r) ^ static_cast<std::uint64_t>(r >> 64);
+#else
+			return sprout::hash_detail::bytes_fold(a, b);
+#endif
+		}
+		inline void
+		bytes_stripes_runtime(std::uint64_t* acc, unsigned char const* p, std::size_t first_stripe, std::size_t count, std::uint64_t seed) {
+			std::uint64_t const* secret = sprout::hash_detail::bytes_secret<>::table.data();
+#if defined(SPROUT_DETAIL_SIMD_AVX2)
+			__m256i a = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(acc));
+			__m256i const s = _mm256_set1_epi64x(static_cast<long long>(seed));
+			__m256i const prime = _mm256_set1_epi64x(static_cast<long long>(sprout::hash_detail::bytes_prime32));
+			__m256i const scramble_key = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(secret + 28));
+			for (std::size_t j = first_stripe; j != first_stripe + count; ++j) {
+				__m256i const d = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(p + 32 * j));
+				__m256i const key = _mm256_add_epi64(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(secret + (j % 8) * 4)), s);
+				__m256i const k = _mm256_xor_si256(d, key);
+				__m256i const product = _mm256_mul_epu32(k, _mm256_srli_epi64(k, 32));
+				a = _mm256_add_epi64(a, _mm256_add_epi64(product, _mm256_shuffle_epi32(d, _MM_SHUFFLE(1, 0, 3, 2))));
+				if (j % 8 == 7) {
+					__m256i const x = _mm256_xor_si256(_mm256_xor_si256(a, _mm256_srli_epi64(a, 47)), scramble_key);
+					a = _mm256_add_epi64(
+						_mm256_mul_epu32(x, prime),
+						_mm256_slli_epi64(_mm256_mul_epu32(_mm256_srli_epi64(x, 32), prime), 32)
+						);
+				}
+			}
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(acc), a);
+#elif defined(SPROUT_DETAIL_SIMD_SSE2)
+			__m128i a[2] = {
+				_mm_loadu_si128(reinterpret_cast<__m128i const*>(acc)),
+				_mm_loadu_si128(reinterpret_cast<__m128i const*>(acc + 2))
+			};
+			__m128i const s = _mm_set1_epi64x(static_cast<long long>(seed));
+			__m128i const prime = _mm_set1_epi64x(static_cast<long long>(sprout::hash_detail::bytes_prime32));
+			for (std::size_t j = first_stripe; j != first_stripe + count; ++j) {
+				for (std::size_t h = 0; h != 2; ++h) {
+					__m128i const d = _mm_loadu_si128(reinterpret_cast<__m128i const*>(p + 32 * j + 16 * h));
+					__m128i const key = _mm_add_epi64(_mm_loadu_si128(reinterpret_cast<__m128i const*>(secret + (j % 8) * 4 + 2 * h)), s);
+					__m128i const k = _mm_xor_si128(d, key);
+					__m128i const product = _mm_mul_epu32(k, _mm_srli_epi64(k, 32));
+					a[h] = _mm_add_epi64(a[h], _mm_add_epi64(product, _mm_shuffle_epi32(d, _MM_SHUFFLE(1, 0, 3, 2))));
+					if (j % 8 == 7) {
+						__m128i const x = _mm_xor_si128(
+							_mm_xor_si128(a[h], _mm_srli_epi64(a[h], 47)),
+							_mm_loadu_si128(reinterpret_cast<__m128i const*>(secret + 28 + 2 * h))
+							);
+						a[h] = _mm_add_epi64(
+							_mm_mul_epu32(x, prime),
+							_mm_slli_epi64(_mm_mul_epu32(_mm_srli_epi64(x, 32), prime), 32)
+							);
+					}
+				}
+			}
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(acc), a[0]);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(acc + 2), a[1]);
+#else
+			for (std::size_t j = first_stripe; j != first_stripe + count; ++j) {
+				std::uint64_t d[4];
+				for (std::size_t i = 0; i != 4; ++i) {
+					d[i] = sprout::hash_detail::bytes_load64(p + 32 * j + 8 * i);
+				}
+				for (std::size_t i = 0; i != 4; ++i) {
+					acc[i] += d[i ^ 1] + sprout::hash_detail::bytes_mulk(d[i] ^ (secret[(j % 8) * 4 + i] + seed));
+				}
+				if (j % 8 == 7) {
+					for (std::size_t i = 0; i != 4; ++i) {
+						acc[i] = sprout::hash_detail::bytes_scramble(acc[i], secret[28 + i]);
+					}
+				}
+			}
+#endif
+		}
+		inline std::uint64_t
+		hash_memory_impl(unsigned char const* p, std::size_t n, std::uint64_t seed) {
+			if (n <= 16) {
+				std::uint64_t a = 0;
+				std::uint64_t b = 0;
+				if (n >= 8) {
+					a = sprout::hash_detail::bytes_load64(p);
+					b = sprout::hash_detail::bytes_load64(p + n - 8);
+				} else if (n >= 4) {
+					a = sprout::hash_detail::bytes_load32(p);
+					b = sprout::hash_detail::bytes_load32(p + n - 4);
+				} else if (n > 0) {
+					a = (std::uint64_t(p[0]) << 16) | (std::uint64_t(p[n >> 1]) << 8) | p[n - 1];
+				}
+				return sprout::hash_detail::bytes_avalanche(
+					sprout::hash_detail::bytes_fold_runtime(
+						a ^ (sprout::hash_detail::bytes_secret_at(0) + seed),
+						b ^ (sprout::hash_detail::bytes_secret_at(1) - seed)
+						)
+					+ n * sprout::hash_detail::bytes_prime1
+					);
+			}
+			if (n <= 128) {
+				std::uint64_t acc = n * sprout::hash_detail::bytes_prime1;
+				std::size_t const chunks = (n + 15) / 16;
+				for (std::size_t k = 0; k != chunks; ++k) {
+					std::size_t const off = k + 1 == chunks ? n - 16 : 16 * k;
+					acc += sprout::hash_detail::bytes_fold_runtime(
+						sprout::hash_detail::bytes_load64(p + off) ^ (sprout::hash_detail::bytes_secret_at(2 * k) + seed),
+						sprout::hash_detail::bytes_load64(p + off + 8) ^ (sprout::hash_detail::bytes_secret_at(2 * k + 1) - seed)
+						);
+				}
+				return sprout::hash_detail::bytes_avalanche(acc);
+			}
+			std::uint64_t acc[4] = {
+				sprout::hash_detail::bytes_prime1, sprout::hash_detail::bytes_prime2,
+				sprout::hash_detail::bytes_prime3, sprout::hash_detail::bytes_prime4
+			};
+			std::size_t const stripes = (n - 1) / 32;
+			sprout::hash_detail::bytes_stripes_runtime(acc, p, 0, stripes, seed);
+			// the last stripe is aligned to the end and keyed with the next row
+			std::uint64_t d[4];
+			for (std::size_t i = 0; i != 4; ++i) {
+				d[i] = sprout::hash_detail::bytes_load64(p + n - 32 + 8 * i);
+			}
+			for (std::size_t i = 0; i != 4; ++i) {
+				acc[i] += d[i ^ 1] + sprout::hash_detail::bytes_mulk(d[i] ^ (sprout::hash_detail::bytes_secret_at((stripes % 8) * 4 + i) + seed));
+			}
+			return sprout::hash_detail::bytes_avalanche(
+				n * sprout::hash_detail::bytes_prime1
+				+ sprout::hash_detail::bytes_fold_runtime(acc[0] ^ sprout::hash_detail::bytes_secret_at(8), acc[1] ^ sprout::hash_detail::bytes_secret_at(9))
+				+ sprout::hash_detail::bytes_fold_runtime(acc[2] ^ sprout::hash_detail::bytes_secret_at(10), acc[3] ^ sprout::hash_detail::bytes_secret_at(11))
+				);
+		}
+	}	// namespace hash_detail
+
+	//
+	// hash_bytes
+	//
+	//	Word-at-a-time hash of the object representation of a contiguous range of
+	//	integral elements (each taken as little-endian bytes). Usable in constant
+	//	expressions; hash_memory computes the same value at runtime.
+	//
+	template<typename RandomAccessIterator>
+	inline SPROUT_CONSTEXPR std::size_t
+	hash_bytes(std::size_t seed, RandomAccessIterator first, RandomAccessIterator last) {
+		return static_cast<std::size_t>(sprout::hash_detail::hash_bytes_impl(
+			first,
+			static_cast<std::size_t>(sprout::distance(first, last)) * sprout::hash_detail::bytes_unit<RandomAccessIterator>::size,
+			seed
+			));
+	}
+	template<typename RandomAccessIterator>
+	inline SPROUT_CONSTEXPR std::size_t
+	hash_bytes(RandomAccessIterator first, RandomAccessIterator last) {
+		return sprout::hash_bytes(0, first, last);
+	}
+	template<typename ContiguousRange>
+	inline SPROUT_CONSTEXPR std::size_t
+	hash_bytes(std::size_t seed, ContiguousRange const& rng) {
+		return sprout::hash_bytes(seed, sprout::begin(rng), sprout::end(rng));
+	}
+	template<typename ContiguousRange>
+	inline SPROUT_CONSTEXPR std::size_t
+	hash_bytes(ContiguousRange const& rng) {
+		return sprout::hash_bytes(0, rng);
+	}
+
+	//
+	// hash_memory
+	//
+	//	Runtime counterpart of hash_bytes over raw memory, vectorized for long inputs.
+	//
+	inline std::size_t
+	hash_memory(void const* data, std::size_t size, std::size_t seed = 0) {
+		return static_cast<std::size_t>(
+			sprout::hash_detail::hash_memory_impl(static_cast<unsigned char const*>(data), size, seed)
+			);
+	}
+	//
+	// hash_elements
+	//
+	//	Runtime hash_bytes of size elements at data; equal to hash_bytes of the same range.
+	//
+	template<typename T>
+	inline std::size_t
+	hash_elements(T const* data, std::size_t size, std::size_t seed = 0) {
+#if SPROUT_ENDIAN_LITTLE_BYTE
+		return sprout::hash_memory(data, size * sizeof(T), seed);
+#else
+		return sizeof(T) == 1 ? sprout::hash_memory(data, size, seed)
+			: sprout::hash_bytes(seed, data, data + size)
+			;
+#endif
+	}
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_FUNCTIONAL_HASH_HASH_BYTES_HPP
@@ -12,5 +12,7 @@
 #include <sprout/integer/integer_digits.hpp>
 #include <sprout/integer/carry_to_exp2.hpp>
 #include <sprout/integer/static_pow.hpp>
+#include <sprout/integer/big_int.hpp>
+#include <sprout/integer/dynamic_big_int.hpp>
 
 #endif	// #ifndef SPROUT_INTEGER_HPP
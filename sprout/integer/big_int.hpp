@@ -0,0 +1,559 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_INTEGER_BIG_INT_HPP
+#define SPROUT_INTEGER_BIG_INT_HPP
+
+#include <limits>
+#include <iterator>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/array/array.hpp>
+#include <sprout/string/string.hpp>
+#include <sprout/math/gcd.hpp>
+#include <sprout/type_traits/enabler_if.hpp>
+#include <sprout/detail/char_literal.hpp>
+#include <sprout/detail/two_digits.hpp>
+#include <sprout/integer/detail/limbs.hpp>
+
+namespace sprout {
+	//
+	// big_int
+	//
+	//	Bits bit two's complement integer over Bits / 64 limbs; arithmetic wraps
+	//	around like the fixed width builtin types. Every operation is C++14
+	//	constexpr. Products switch from the schoolbook method to Karatsuba once
+	//	both operands are karatsuba_threshold limbs long, and division is Knuth's
+	//	Algorithm D; both work on magnitudes and truncate toward zero.
+	//
+	template<std::size_t Bits>
+	class big_int {
+		static_assert(Bits != 0 && Bits % 64 == 0, "Bits must be a positive multiple of 64");
+	public:
+		typedef sprout::detail::limb_type limb_type;
+		typedef std::size_t size_type;
+		typedef sprout::array<limb_type, Bits / 64> limbs_type;
+	public:
+		SPROUT_STATIC_CONSTEXPR size_type static_size = Bits / 64;
+		SPROUT_STATIC_CONSTEXPR size_type printed_digits = Bits * 30103 / 100000 + 2;
+	private:
+		SPROUT_STATIC_CONSTEXPR size_type mul_scratch_size = static_size < sprout::detail::karatsuba_threshold ? 1
+			: 16 * static_size + 64
+			;
+	public:
+		//
+		// from_string
+		//
+		//	Parses an optionally signed decimal number. Throws std::invalid_argument
+		//	on anything else and std::out_of_range if the value does not fit.
+		//
+		template<typename InputIterator>
+		static SPROUT_CXX14_CONSTEXPR big_int from_string(InputIterator first, InputIterator last) {
+			typedef typename std::iterator_traits<InputIterator>::value_type elem_type;
+			bool negative = false;
+			if (first != last && (*first == SPROUT_CHAR_LITERAL('-', elem_type) || *first == SPROUT_CHAR_LITERAL('+', elem_type))) {
+				negative = *first == SPROUT_CHAR_LITERAL('-', elem_type);
+				++first;
+			}
+			if (first == last) {
+				throw std::invalid_argument("big_int: no digits");
+			}
+			limb_type mag[static_size + 1] = {};
+			while (first != last) {
+				limb_type chunk = 0;
+				limb_type scale = 1;
+				for (size_type k = 0; k != sprout::detail::limbs_pow10_digits && first != last; ++k, ++first) {
+					if (*first < SPROUT_CHAR_LITERAL('0', elem_type) || *first > SPROUT_CHAR_LITERAL('9', elem_type)) {
+						throw std::invalid_argument("big_int: invalid digit");
+					}
+					chunk = chunk * 10 + static_cast<limb_type>(*first - SPROUT_CHAR_LITERAL('0', elem_type));
+					scale *= 10;
+				}
+				if (sprout::detail::limbs_mul_1(mag, mag, static_size + 1, scale) != 0
+					|| sprout::detail::limbs_add_1(mag, mag, static_size + 1, chunk) != 0
+					|| mag[static_size] != 0
+					)
+				{
+					throw std::out_of_range("big_int: out of range");
+				}
+			}
+			// the magnitude of min() is the only one with the sign bit set
+			if ((mag[static_size - 1] >> 63) != 0
+				&& (!negative || sprout::detail::limbs_normalized_size(mag, static_size - 1) != 0 || mag[static_size - 1] << 1 != 0)
+				)
+			{
+				throw std::out_of_range("big_int: out of range");
+			}
+			big_int result;
+			if (negative) {
+				sprout::detail::limbs_negate(result.limbs_.data(), mag, static_size);
+			} else {
+				sprout::detail::limbs_copy(result.limbs_.data(), mag, static_size);
+			}
+			return result;
+		}
+		template<typename Elem>
+		static SPROUT_CXX14_CONSTEXPR big_int from_string(Elem const* str) {
+			Elem const* last = str;
+			while (*last != Elem()) {
+				++last;
+			}
+			return from_string(str, last);
+		}
+	private:
+		limbs_type limbs_;
+	private:
+		SPROUT_CXX14_CONSTEXPR void fill_high(size_type first, bool negative) {
+			for (size_type i = first; i != static_size; ++i) {
+				limbs_[i] = negative ? ~limb_type(0) : limb_type(0);
+			}
+		}
+		SPROUT_CXX14_CONSTEXPR size_type magnitude(limb_type* r) const {
+			if (is_negative()) {
+				sprout::detail::limbs_negate(r, limbs_.data(), static_size);
+			} else {
+				sprout::detail::limbs_copy(r, limbs_.data(), static_size);
+			}
+			return sprout::detail::limbs_normalized_size(r, static_size);
+		}
+		SPROUT_CXX14_CONSTEXPR void assign_magnitude(limb_type const* mag, size_type n, bool negative) {
+			size_type const m = n < static_size ? n : static_size;
+			sprout::detail::limbs_copy(limbs_.data(), mag, m);
+			fill_high(m, false);
+			if (negative) {
+				sprout::detail::limbs_negate(limbs_.data(), limbs_.data(), static_size);
+			}
+		}
+	public:
+		static SPROUT_CXX14_CONSTEXPR void divmod(big_int const& u, big_int const& v, big_int* q, big_int* r) {
+			limb_type a[static_size] = {};
+			limb_type b[static_size] = {};
+			size_type const an = u.magnitude(a);
+			size_type const bn = v.magnitude(b);
+			if (bn == 0) {
+				throw std::domain_error("big_int: division by zero");
+			}
+			if (an < bn) {
+				if (q) {
+					*q = big_int();
+				}
+				if (r) {
+					*r = u;
+				}
+				return;
+			}
+			limb_type qm[static_size] = {};
+			limb_type rm[static_size] = {};
+			limb_type scratch[2 * static_size + 1] = {};
+			sprout::detail::limbs_divmod(qm, rm, a, an, b, bn, scratch);
+			if (q) {
+				q->assign_magnitude(qm, an - bn + 1, u.is_negative() != v.is_negative());
+			}
+			if (r) {
+				r->assign_magnitude(rm, bn, u.is_negative());
+			}
+		}
+	public:
+		SPROUT_CONSTEXPR big_int()
+			: limbs_{{}}
+		{}
+		big_int(big_int const&) = default;
+		template<typename IntType, typename sprout::enabler_if<std::is_integral<IntType>::value>::type = sprout::enabler>
+		SPROUT_CXX14_CONSTEXPR big_int(IntType val)
+			: limbs_{{}}
+		{
+			limbs_[0] = static_cast<limb_type>(val);
+			fill_high(1, val < IntType(0));
+		}
+		template<std::size_t OtherBits>
+		explicit SPROUT_CXX14_CONSTEXPR big_int(sprout::big_int<OtherBits> const& other)
+			: limbs_{{}}
+		{
+			size_type const m = other.static_size < static_size ? other.static_size : static_size;
+			for (size_type i = 0; i != m; ++i) {
+				limbs_[i] = other.limb(i);
+			}
+			fill_high(m, other.is_negative());
+		}
+		big_int& operator=(big_int const&) = default;
+
+		SPROUT_CONSTEXPR limb_type limb(size_type i) const {
+			return limbs_[i];
+		}
+		SPROUT_CONSTEXPR limbs_type const& limbs() const {
+			return limbs_;
+		}
+		SPROUT_CONSTEXPR bool is_negative() const {
+			return (limbs_[static_size - 1] >> 63) != 0;
+		}
+		SPROUT_CXX14_CONSTEXPR bool is_zero() const {
+			return sprout::detail::limbs_normalized_size(limbs_.data(), static_size) == 0;
+		}
+		SPROUT_CXX14_CONSTEXPR int sign() const {
+			return is_negative() ? -1 : is_zero() ? 0 : 1;
+		}
+		SPROUT_CXX14_CONSTEXPR size_type bit_length() const {
+			limb_type a[static_size] = {};
+			size_type const n = magnitude(a);
+			return n == 0 ? 0 : n * 64 - static_cast<size_type>(sprout::clz(a[n - 1]));
+		}
+
+		explicit SPROUT_CXX14_CONSTEXPR operator bool() const {
+			return !is_zero();
+		}
+		template<typename IntType, typename sprout::enabler_if<
+			std::is_integral<IntType>::value && !std::is_same<IntType, bool>::value
+		>::type = sprout::enabler>
+		explicit SPROUT_CONSTEXPR operator IntType() const {
+			return static_cast<IntType>(limbs_[0]);
+		}
+		template<typename FloatType, typename sprout::enabler_if<std::is_floating_point<FloatType>::value>::type = sprout::enabler>
+		explicit SPROUT_CXX14_CONSTEXPR operator FloatType() const {
+			limb_type a[static_size] = {};
+			FloatType result = 0;
+			for (size_type i = magnitude(a); i != 0; --i) {
+				result = result * FloatType(18446744073709551616.0) + static_cast<FloatType>(a[i - 1]);
+			}
+			return is_negative() ? -result : result;
+		}
+
+		SPROUT_CXX14_CONSTEXPR big_int& operator+=(big_int const& rhs) {
+			sprout::detail::limbs_add_n(limbs_.data(), limbs_.data(), rhs.limbs_.data(), static_size);
+			return *this;
+		}
+		SPROUT_CXX14_CONSTEXPR big_int& operator-=(big_int const& rhs) {
+			sprout::detail::limbs_sub_n(limbs_.data(), limbs_.data(), rhs.limbs_.data(), static_size);
+			return *this;
+		}
+		SPROUT_CXX14_CONSTEXPR big_int& operator*=(big_int const& rhs) {
+			limb_type a[static_size] = {};
+			limb_type b[static_size] = {};
+			size_type an = magnitude(a);
+			size_type bn = rhs.magnitude(b);
+			bool const negative = is_negative() != rhs.is_negative();
+			if (an == 0 || bn == 0) {
+				return *this = big_int();
+			}
+			limb_type r[2 * static_size] = {};
+			limb_type scratch[mul_scratch_size] = {};
+			if (an >= bn) {
+				sprout::detail::limbs_mul(r, a, an, b, bn, scratch);
+			} else {
+				sprout::detail::limbs_mul(r, b, bn, a, an, scratch);
+			}
+			assign_magnitude(r, an + bn, negative);
+			return *this;
+		}
+		SPROUT_CXX14_CONSTEXPR big_int& operator/=(big_int const& rhs) {
+			divmod(*this, rhs, this, 0);
+			return *this;
+		}
+		SPROUT_CXX14_CONSTEXPR big_int& operator%=(big_int const& rhs) {
+			divmod(*this, rhs, 0, this);
+			return *this;
+		}
+		SPROUT_CXX14_CONSTEXPR big_int& operator&=(big_int const& rhs) {
+			for (size_type i = 0; i != static_size; ++i) {
+				limbs_[i] &= rhs.limbs_[i];
+			}
+			return *this;
+		}
+		SPROUT_CXX14_CONSTEXPR big_int& operator|=(big_int const& rhs) {
+			for (size_type i = 0; i != static_size; ++i) {
+				limbs_[i] |= rhs.limbs_[i];
+			}
+			return *this;
+		}
+		SPROUT_CXX14_CONSTEXPR big_int& operator^=(big_int const& rhs) {
+			for (size_type i = 0; i != static_size; ++i) {
+				limbs_[i] ^= rhs.limbs_[i];
+			}
+			return *this;
+		}
+		SPROUT_CXX14_CONSTEXPR big_int& operator<<=(size_type n) {
+			if (n >= Bits) {
+				return *this = big_int();
+			}
+			size_type const w = n / 64;
+			for (size_type i = static_size; i != w; --i) {
+				limbs_[i - 1] = limbs_[i - 1 - w];
+			}
+			for (size_type i = 0; i != w; ++i) {
+				limbs_[i] = 0;
+			}
+			sprout::detail::limbs_lshift(limbs_.data() + w, limbs_.data() + w, static_size - w, static_cast<unsigned>(n % 64));
+			return *this;
+		}
+		//	Arithmetic shift: negative values are filled with ones.
+		SPROUT_CXX14_CONSTEXPR big_int& operator>>=(size_type n) {
+			bool const negative = is_negative();
+			if (n >= Bits) {
+				fill_high(0, negative);
+				return *this;
+			}
+			size_type const w = n / 64;
+			unsigned const s = static_cast<unsigned>(n % 64);
+			for (size_type i = 0; i != static_size - w; ++i) {
+				limbs_[i] = limbs_[i + w];
+			}
+			fill_high(static_size - w, negative);
+			sprout::detail::limbs_rshift(limbs_.data(), limbs_.data(), static_size - w, s);
+			if (negative && s != 0) {
+				limbs_[static_size - w - 1] |= ~limb_type(0) << (64 - s);
+			}
+			return *this;
+		}
+
+		SPROUT_CXX14_CONSTEXPR big_int& operator++() {
+			sprout::detail::limbs_add_1(limbs_.data(), limbs_.data(), static_size, 1);
+			return *this;
+		}
+		SPROUT_CXX14_CONSTEXPR big_int& operator--() {
+			sprout::detail::limbs_sub_1(limbs_.data(), limbs_.data(), static_size, 1);
+			return *this;
+		}
+		SPROUT_CXX14_CONSTEXPR big_int operator++(int) {
+			big_int result(*this);
+			++*this;
+			return result;
+		}
+		SPROUT_CXX14_CONSTEXPR big_int operator--(int) {
+			big_int result(*this);
+			--*this;
+			return result;
+		}
+
+		friend SPROUT_CONSTEXPR big_int operator+(big_int const& x) {
+			return x;
+		}
+		friend SPROUT_CXX14_CONSTEXPR big_int operator-(big_int const& x) {
+			big_int result;
+			sprout::detail::limbs_negate(result.limbs_.data(), x.limbs_.data(), static_size);
+			return result;
+		}
+		friend SPROUT_CXX14_CONSTEXPR big_int operator~(big_int const& x) {
+			big_int result;
+			for (size_type i = 0; i != static_size; ++i) {
+				result.limbs_[i] = ~x.limbs_[i];
+			}
+			return result;
+		}
+		friend SPROUT_CXX14_CONSTEXPR big_int operator+(big_int lhs, big_int const& rhs) {
+			return lhs += rhs;
+		}
+		friend SPROUT_CXX14_CONSTEXPR big_int operator-(big_int lhs, big_int const& rhs) {
+			return lhs -= rhs;
+		}
+		friend SPROUT_CXX14_CONSTEXPR big_int operator*(big_int lhs, big_int const& rhs) {
+			return lhs *= rhs;
+		}
+		friend SPROUT_CXX14_CONSTEXPR big_int operator/(big_int lhs, big_int const& rhs) {
+			return lhs /= rhs;
+		}
+		friend SPROUT_CXX14_CONSTEXPR big_int operator%(big_int lhs, big_int const& rhs) {
+			return lhs %= rhs;
+		}
+		friend SPROUT_CXX14_CONSTEXPR big_int operator&(big_int lhs, big_int const& rhs) {
+			return lhs &= rhs;
+		}
+		friend SPROUT_CXX14_CONSTEXPR big_int operator|(big_int lhs, big_int const& rhs) {
+			return lhs |= rhs;
+		}
+		friend SPROUT_CXX14_CONSTEXPR big_int operator^(big_int lhs, big_int const& rhs) {
+			return lhs ^= rhs;
+		}
+		friend SPROUT_CXX14_CONSTEXPR big_int operator<<(big_int lhs, size_type n) {
+			return lhs <<= n;
+		}
+		friend SPROUT_CXX14_CONSTEXPR big_int operator>>(big_int lhs, size_type n) {
+			return lhs >>= n;
+		}
+
+		friend SPROUT_CXX14_CONSTEXPR bool operator==(big_int const& lhs, big_int const& rhs) {
+			return sprout::detail::limbs_compare(lhs.limbs_.data(), rhs.limbs_.data(), static_size) == 0;
+		}
+		friend SPROUT_CXX14_CONSTEXPR bool operator!=(big_int const& lhs, big_int const& rhs) {
+			return !(lhs == rhs);
+		}
+		friend SPROUT_CXX14_CONSTEXPR bool operator<(big_int const& lhs, big_int const& rhs) {
+			return lhs.is_negative() != rhs.is_negative() ? lhs.is_negative()
+				: sprout::detail::limbs_compare(lhs.limbs_.data(), rhs.limbs_.data(), static_size) < 0
+				;
+		}
+		friend SPROUT_CXX14_CONSTEXPR bool operator>(big_int const& lhs, big_int const& rhs) {
+			return rhs < lhs;
+		}
+		friend SPROUT_CXX14_CONSTEXPR bool operator<=(big_int const& lhs, big_int const& rhs) {
+			return !(rhs < lhs);
+		}
+		friend SPROUT_CXX14_CONSTEXPR bool operator>=(big_int const& lhs, big_int const& rhs) {
+			return !(lhs < rhs);
+		}
+	};
+	template<std::size_t Bits>
+	SPROUT_CONSTEXPR_OR_CONST typename sprout::big_int<Bits>::size_type sprout::big_int<Bits>::static_size;
+	template<std::size_t Bits>
+	SPROUT_CONSTEXPR_OR_CONST typename sprout::big_int<Bits>::size_type sprout::big_int<Bits>::printed_digits;
+	template<std::size_t Bits>
+	SPROUT_CONSTEXPR_OR_CONST typename sprout::big_int<Bits>::size_type sprout::big_int<Bits>::mul_scratch_size;
+
+	//
+	// abs
+	//
+	template<std::size_t Bits>
+	inline SPROUT_CXX14_CONSTEXPR sprout::big_int<Bits>
+	abs(sprout::big_int<Bits> const& x) {
+		return x.is_negative() ? -x : x;
+	}
+
+	//
+	// to_string_of
+	// to_string
+	//
+	template<typename Elem, std::size_t Bits>
+	inline SPROUT_CXX14_CONSTEXPR sprout::basic_string<Elem, sprout::big_int<Bits>::printed_digits>
+	to_string_of(sprout::big_int<Bits> const& x) {
+		typedef sprout::big_int<Bits> type;
+		sprout::detail::limb_type mag[type::static_size] = {};
+		for (std::size_t i = 0; i != type::static_size; ++i) {
+			mag[i] = x.limb(i);
+		}
+		if (x.is_negative()) {
+			sprout::detail::limbs_negate(mag, mag, type::static_size);
+		}
+		Elem buffer[type::printed_digits] = {};
+		Elem* const last = buffer + type::printed_digits;
+		Elem* first = sprout::detail::limbs_write_decimal(last, mag, type::static_size);
+		if (x.is_negative()) {
+			*--first = SPROUT_CHAR_LITERAL('-', Elem);
+		}
+		sprout::basic_string<Elem, type::printed_digits> result{};
+		result.resize(static_cast<std::size_t>(last - first));
+		for (std::size_t i = 0; first != last; ++i, ++first) {
+			result[i] = *first;
+		}
+		return result;
+	}
+	template<std::size_t Bits>
+	inline SPROUT_CXX14_CONSTEXPR sprout::basic_string<char, sprout::big_int<Bits>::printed_digits>
+	to_string(sprout::big_int<Bits> const& x) {
+		return sprout::to_string_of<char>(x);
+	}
+
+	//
+	// operator<<
+	//
+	template<typename Elem, typename Traits, std::size_t Bits>
+	inline SPROUT_NON_CONSTEXPR std::basic_ostream<Elem, Traits>&
+	operator<<(std::basic_ostream<Elem, Traits>& lhs, sprout::big_int<Bits> const& rhs) {
+		return lhs << sprout::to_string_of<Elem>(rhs).c_str();
+	}
+
+	namespace math {
+		namespace detail {
+			//
+			// gcd_optimal_evaluator
+			//
+			//	Iterative Euclid, so that the recursion depth of the generic
+			//	evaluator does not grow with the operand size.
+			//
+			template<std::size_t Bits>
+			struct gcd_optimal_evaluator<sprout::big_int<Bits> > {
+			public:
+				SPROUT_CXX14_CONSTEXPR sprout::big_int<Bits>
+				operator()(sprout::big_int<Bits> a, sprout::big_int<Bits> b) const {
+					a = sprout::abs(a);
+					b = sprout::abs(b);
+					while (b) {
+						sprout::big_int<Bits> t = a % b;
+						a = b;
+						b = t;
+					}
+					return a;
+				}
+			};
+		}	// namespace detail
+	}	// namespace math
+}	// namespace sprout
+
+namespace std {
+#if defined(__clang__)
+#	pragma clang diagnostic push
+#	pragma clang diagnostic ignored "-Wmismatched-tags"
+#endif
+	//
+	// numeric_limits
+	//
+	template<std::size_t Bits>
+	class numeric_limits<sprout::big_int<Bits> > {
+	public:
+		SPROUT_STATIC_CONSTEXPR bool is_specialized = true;
+
+		static SPROUT_CXX14_CONSTEXPR sprout::big_int<Bits> min() SPROUT_NOEXCEPT {
+			return sprout::big_int<Bits>(1) << (Bits - 1);
+		}
+		static SPROUT_CXX14_CONSTEXPR sprout::big_int<Bits> max() SPROUT_NOEXCEPT {
+			return ~min();
+		}
+		static SPROUT_CXX14_CONSTEXPR sprout::big_int<Bits> lowest() SPROUT_NOEXCEPT {
+			return min();
+		}
+
+		SPROUT_STATIC_CONSTEXPR int digits = static_cast<int>(Bits - 1);
+		SPROUT_STATIC_CONSTEXPR int digits10 = static_cast<int>((Bits - 1) * 30103 / 100000);
+		SPROUT_STATIC_CONSTEXPR int max_digits10 = 0;
+		SPROUT_STATIC_CONSTEXPR bool is_signed = true;
+		SPROUT_STATIC_CONSTEXPR bool is_integer = true;
+		SPROUT_STATIC_CONSTEXPR bool is_exact = true;
+		SPROUT_STATIC_CONSTEXPR int radix = 2;
+		static SPROUT_CONSTEXPR sprout::big_int<Bits> epsilon() SPROUT_NOEXCEPT {
+			return sprout::big_int<Bits>();
+		}
+		static SPROUT_CONSTEXPR sprout::big_int<Bits> round_error() SPROUT_NOEXCEPT {
+			return sprout::big_int<Bits>();
+		}
+
+		SPROUT_STATIC_CONSTEXPR int min_exponent = 0;
+		SPROUT_STATIC_CONSTEXPR int min_exponent10 = 0;
+		SPROUT_STATIC_CONSTEXPR int max_exponent = 0;
+		SPROUT_STATIC_CONSTEXPR int max_exponent10 = 0;
+
+		SPROUT_STATIC_CONSTEXPR bool has_infinity = false;
+		SPROUT_STATIC_CONSTEXPR bool has_quiet_NaN = false;
+		SPROUT_STATIC_CONSTEXPR bool has_signaling_NaN = false;
+		SPROUT_STATIC_CONSTEXPR std::float_denorm_style has_denorm = std::denorm_absent;
+		SPROUT_STATIC_CONSTEXPR bool has_denorm_loss = false;
+		static SPROUT_CONSTEXPR sprout::big_int<Bits> infinity() SPROUT_NOEXCEPT {
+			return sprout::big_int<Bits>();
+		}
+		static SPROUT_CONSTEXPR sprout::big_int<Bits> quiet_NaN() SPROUT_NOEXCEPT {
+			return sprout::big_int<Bits>();
+		}
+		static SPROUT_CONSTEXPR sprout::big_int<Bits> signaling_NaN() SPROUT_NOEXCEPT {
+			return sprout::big_int<Bits>();
+		}
+		static SPROUT_CONSTEXPR sprout::big_int<Bits> denorm_min() SPROUT_NOEXCEPT {
+			return sprout::big_int<Bits>();
+		}
+
+		SPROUT_STATIC_CONSTEXPR bool is_iec559 = false;
+		SPROUT_STATIC_CONSTEXPR bool is_bounded = true;
+		SPROUT_STATIC_CONSTEXPR bool is_modulo = true;
+
+		SPROUT_STATIC_CONSTEXPR bool traps = false;
+		SPROUT_STATIC_CONSTEXPR bool tinyness_before = false;
+		SPROUT_STATIC_CONSTEXPR std::float_round_style round_style = std::round_toward_zero;
+	};
+#if defined(__clang__)
+#	pragma clang diagnostic pop
+#endif
+}	// namespace std
+
+#endif	// #ifndef SPROUT_INTEGER_BIG_INT_HPP
@@ -0,0 +1,571 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_INTEGER_DETAIL_LIMBS_HPP
+#define SPROUT_INTEGER_DETAIL_LIMBS_HPP
+
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/cstdint.hpp>
+#include <sprout/bit/clz.hpp>
+#include <sprout/detail/two_digits.hpp>
+#include <sprout/charconv/detail/umul128.hpp>
+
+//
+// Natural number kernels over little-endian arrays of 64-bit limbs, shared by
+// big_int and dynamic_big_int. Every kernel is C++14 constexpr; the 64x64 bit
+// products go through umul128, i.e. a single mul/mulx where __int128 exists.
+//
+namespace sprout {
+	namespace detail {
+		typedef std::uint64_t limb_type;
+
+		//
+		// karatsuba_threshold
+		//
+		//	Operands shorter than this many limbs are multiplied by the schoolbook method.
+		//
+		SPROUT_STATIC_CONSTEXPR std::size_t karatsuba_threshold = 24;
+
+		//
+		// limbs_normalized_size
+		//
+		inline SPROUT_CXX14_CONSTEXPR std::size_t
+		limbs_normalized_size(sprout::detail::limb_type const* a, std::size_t n) {
+			while (n != 0 && a[n - 1] == 0) {
+				--n;
+			}
+			return n;
+		}
+
+		//
+		// limbs_compare
+		//
+		inline SPROUT_CXX14_CONSTEXPR int
+		limbs_compare(sprout::detail::limb_type const* a, sprout::detail::limb_type const* b, std::size_t n) {
+			while (n != 0) {
+				--n;
+				if (a[n] != b[n]) {
+					return a[n] < b[n] ? -1 : 1;
+				}
+			}
+			return 0;
+		}
+
+		//
+		// limbs_copy
+		// limbs_fill
+		//
+		inline SPROUT_CXX14_CONSTEXPR void
+		limbs_copy(sprout::detail::limb_type* r, sprout::detail::limb_type const* a, std::size_t n) {
+			for (std::size_t i = 0; i != n; ++i) {
+				r[i] = a[i];
+			}
+		}
+		inline SPROUT_CXX14_CONSTEXPR void
+		limbs_fill(sprout::detail::limb_type* r, sprout::detail::limb_type x, std::size_t n) {
+			for (std::size_t i = 0; i != n; ++i) {
+				r[i] = x;
+			}
+		}
+
+		//
+		// limbs_add_n
+		// limbs_add_1
+		// limbs_add
+		//
+		//	r = a + b; returns the carry out. r may alias a or b.
+		//
+		inline SPROUT_CXX14_CONSTEXPR sprout::detail::limb_type
+		limbs_add_n(
+			sprout::detail::limb_type* r,
+			sprout::detail::limb_type const* a, sprout::detail::limb_type const* b, std::size_t n
+			)
+		{
+			sprout::detail::limb_type carry = 0;
+			for (std::size_t i = 0; i != n; ++i) {
+				sprout::detail::limb_type const s = a[i] + carry;
+				carry = s < carry;
+				sprout::detail::limb_type const t = s + b[i];
+				carry += t < s;
+				r[i] = t;
+			}
+			return carry;
+		}
+		inline SPROUT_CXX14_CONSTEXPR sprout::detail::limb_type
+		limbs_add_1(
+			sprout::detail::limb_type* r,
+			sprout::detail::limb_type const* a, std::size_t n, sprout::detail::limb_type b
+			)
+		{
+			for (std::size_t i = 0; i != n; ++i) {
+				sprout::detail::limb_type const t = a[i] + b;
+				b = t < b;
+				r[i] = t;
+			}
+			return b;
+		}
+		inline SPROUT_CXX14_CONSTEXPR sprout::detail::limb_type
+		limbs_add(
+			sprout::detail::limb_type* r,
+			sprout::detail::limb_type const* a, std::size_t an,
+			sprout::detail::limb_type const* b, std::size_t bn
+			)
+		{
+			return sprout::detail::limbs_add_1(r + bn, a + bn, an - bn, sprout::detail::limbs_add_n(r, a, b, bn));
+		}
+
+		//
+		// limbs_sub_n
+		// limbs_sub_1
+		// limbs_sub
+		//
+		//	r = a - b; returns the borrow out. r may alias a or b.
+		//
+		inline SPROUT_CXX14_CONSTEXPR sprout::detail::limb_type
+		limbs_sub_n(
+			sprout::detail::limb_type* r,
+			sprout::detail::limb_type const* a, sprout::detail::limb_type const* b, std::size_t n
+			)
+		{
+			sprout::detail::limb_type borrow = 0;
+			for (std::size_t i = 0; i != n; ++i) {
+				sprout::detail::limb_type const s = a[i] - borrow;
+				borrow = a[i] < borrow;
+				borrow += s < b[i];
+				r[i] = s - b[i];
+			}
+			return borrow;
+		}
+		inline SPROUT_CXX14_CONSTEXPR sprout::detail::limb_type
+		limbs_sub_1(
+			sprout::detail::limb_type* r,
+			sprout::detail::limb_type const* a, std::size_t n, sprout::detail::limb_type b
+			)
+		{
+			for (std::size_t i = 0; i != n; ++i) {
+				sprout::detail::limb_type const t = a[i] - b;
+				b = a[i] < b;
+				r[i] = t;
+			}
+			return b;
+		}
+		inline SPROUT_CXX14_CONSTEXPR sprout::detail::limb_type
+		limbs_sub(
+			sprout::detail::limb_type* r,
+			sprout::detail::limb_type const* a, std::size_t an,
+			sprout::detail::limb_type const* b, std::size_t bn
+			)
+		{
+			return sprout::detail::limbs_sub_1(r + bn, a + bn, an - bn, sprout::detail::limbs_sub_n(r, a, b, bn));
+		}
+
+		//
+		// limbs_negate
+		//
+		//	r = 2^(64n) - a.
+		//
+		inline SPROUT_CXX14_CONSTEXPR void
+		limbs_negate(sprout::detail::limb_type* r, sprout::detail::limb_type const* a, std::size_t n) {
+			sprout::detail::limb_type carry = 1;
+			for (std::size_t i = 0; i != n; ++i) {
+				sprout::detail::limb_type const t = ~a[i] + carry;
+				carry = t < carry;
+				r[i] = t;
+			}
+		}
+
+		//
+		// limbs_lshift
+		// limbs_rshift
+		//
+		//	Shift by 0 <= s < 64 bits; return the bits shifted out. r may alias a.
+		//
+		inline SPROUT_CXX14_CONSTEXPR sprout::detail::limb_type
+		limbs_lshift(sprout::detail::limb_type* r, sprout::detail::limb_type const* a, std::size_t n, unsigned s) {
+			if (s == 0) {
+				sprout::detail::limbs_copy(r, a, n);
+				return 0;
+			}
+			sprout::detail::limb_type out = 0;
+			for (std::size_t i = 0; i != n; ++i) {
+				sprout::detail::limb_type const x = a[i];
+				r[i] = (x << s) | out;
+				out = x >> (64 - s);
+			}
+			return out;
+		}
+		inline SPROUT_CXX14_CONSTEXPR sprout::detail::limb_type
+		limbs_rshift(sprout::detail::limb_type* r, sprout::detail::limb_type const* a, std::size_t n, unsigned s) {
+			if (s == 0) {
+				sprout::detail::limbs_copy(r, a, n);
+				return 0;
+			}
+			sprout::detail::limb_type out = 0;
+			for (std::size_t i = n; i != 0; --i) {
+				sprout::detail::limb_type const x = a[i - 1];
+				r[i - 1] = (x >> s) | out;
+				out = x << (64 - s);
+			}
+			return out;
+		}
+
+		//
+		// limbs_mul_1
+		// limbs_addmul_1
+		// limbs_submul_1
+		//
+		//	r = a * b, r += a * b and r -= a * b; return the high limb carried or borrowed out.
+		//
+		inline SPROUT_CXX14_CONSTEXPR sprout::detail::limb_type
+		limbs_mul_1(
+			sprout::detail::limb_type* r,
+			sprout::detail::limb_type const* a, std::size_t n, sprout::detail::limb_type b
+			)
+		{
+			sprout::detail::limb_type carry = 0;
+			for (std::size_t i = 0; i != n; ++i) {
+				sprout::detail::uint128_parts const p = sprout::detail::umul128(a[i], b);
+				sprout::detail::limb_type const lo = p.lo + carry;
+				carry = p.hi + (lo < carry);
+				r[i] = lo;
+			}
+			return carry;
+		}
+		inline SPROUT_CXX14_CONSTEXPR sprout::detail::limb_type
+		limbs_addmul_1(
+			sprout::detail::limb_type* r,
+			sprout::detail::limb_type const* a, std::size_t n, sprout::detail::limb_type b
+			)
+		{
+			sprout::detail::limb_type carry = 0;
+			for (std::size_t i = 0; i != n; ++i) {
+				sprout::detail::uint128_parts const p = sprout::detail::umul128(a[i], b);
+				sprout::detail::limb_type lo = p.lo + carry;
+				sprout::detail::limb_type hi = p.hi + (lo < carry);
+				lo += r[i];
+				hi += lo < r[i];
+				r[i] = lo;
+				carry = hi;
+			}
+			return carry;
+		}
+		inline SPROUT_CXX14_CONSTEXPR sprout::detail::limb_type
+		limbs_submul_1(
+			sprout::detail::limb_type* r,
+			sprout::detail::limb_type const* a, std::size_t n, sprout::detail::limb_type b
+			)
+		{
+			sprout::detail::limb_type borrow = 0;
+			for (std::size_t i = 0; i != n; ++i) {
+				sprout::detail::uint128_parts const p = sprout::detail::umul128(a[i], b);
+				sprout::detail::limb_type const lo = p.lo + borrow;
+				sprout::detail::limb_type const hi = p.hi + (lo < borrow);
+				sprout::detail::limb_type const x = r[i];
+				r[i] = x - lo;
+				borrow = hi + (x < lo);
+			}
+			return borrow;
+		}
+
+		//
+		// limbs_mul_basecase
+		//
+		//	r[0, an + bn) = a * b, schoolbook. r must not overlap a or b.
+		//
+		inline SPROUT_CXX14_CONSTEXPR void
+		limbs_mul_basecase(
+			sprout::detail::limb_type* r,
+			sprout::detail::limb_type const* a, std::size_t an,
+			sprout::detail::limb_type const* b, std::size_t bn
+			)
+		{
+			r[an] = sprout::detail::limbs_mul_1(r, a, an, b[0]);
+			for (std::size_t j = 1; j != bn; ++j) {
+				r[an + j] = sprout::detail::limbs_addmul_1(r + j, a, an, b[j]);
+			}
+		}
+
+		//
+		// limbs_karatsuba_scratch_size
+		//
+		inline SPROUT_CONSTEXPR std::size_t
+		limbs_karatsuba_scratch_size(std::size_t n) {
+			return 6 * n + 64;
+		}
+
+		//
+		// limbs_mul_karatsuba
+		//
+		//	r[0, 2n) = a * b for two n limb operands, splitting into a low half of
+		//	m = ceil(n/2) limbs and a high half of h = floor(n/2) limbs:
+		//		a * b = z2 B^2m + (z0 + z2 + (a0 - a1)(b1 - b0)) B^m + z0
+		//	scratch holds limbs_karatsuba_scratch_size(n) limbs.
+		//
+		inline SPROUT_CXX14_CONSTEXPR void
+		limbs_mul_karatsuba(
+			sprout::detail::limb_type* r,
+			sprout::detail::limb_type const* a, sprout::detail::limb_type const* b, std::size_t n,
+			sprout::detail::limb_type* scratch
+			)
+		{
+			if (n < sprout::detail::karatsuba_threshold) {
+				sprout::detail::limbs_mul_basecase(r, a, n, b, n);
+				return;
+			}
+			std::size_t const h = n / 2;
+			std::size_t const m = n - h;
+			// z0 and z2
+			sprout::detail::limbs_mul_karatsuba(r, a, b, m, scratch);
+			sprout::detail::limbs_mul_karatsuba(r + 2 * m, a + m, b + m, h, scratch);
+			// |a0 - a1| and |b1 - b0|
+			sprout::detail::limb_type* const da = scratch;
+			sprout::detail::limb_type* const db = scratch + m;
+			bool negative = false;
+			da[m - 1] = 0;
+			sprout::detail::limbs_copy(da, a + m, h);
+			if (sprout::detail::limbs_compare(a, da, m) >= 0) {
+				sprout::detail::limbs_sub(da, a, m, a + m, h);
+			} else {
+				sprout::detail::limbs_sub(da, da, m, a, m);
+				negative = !negative;
+			}
+			db[m - 1] = 0;
+			sprout::detail::limbs_copy(db, b + m, h);
+			if (sprout::detail::limbs_compare(db, b, m) >= 0) {
+				sprout::detail::limbs_sub(db, db, m, b, m);
+			} else {
+				sprout::detail::limbs_sub(db, b, m, b + m, h);
+				negative = !negative;
+			}
+			sprout::detail::limb_type* const d = scratch + 2 * m;
+			sprout::detail::limbs_mul_karatsuba(d, da, db, m, scratch + 4 * m);
+			// z1 = z0 + z2 +- d, then r += z1 B^m
+			sprout::detail::limb_type* const z1 = scratch + 4 * m;
+			z1[2 * m] = sprout::detail::limbs_add(z1, r, 2 * m, r + 2 * m, 2 * h);
+			if (negative) {
+				z1[2 * m] -= sprout::detail::limbs_sub_n(z1, z1, d, 2 * m);
+			} else {
+				z1[2 * m] += sprout::detail::limbs_add_n(z1, z1, d, 2 * m);
+			}
+			sprout::detail::limbs_add(r + m, r + m, 2 * n - m, z1, 2 * m + 1);
+		}
+
+		//
+		// limbs_mul_scratch_size
+		//
+		inline SPROUT_CONSTEXPR std::size_t
+		limbs_mul_scratch_size(std::size_t bn) {
+			return 16 * bn + 64;
+		}
+
+		//
+		// limbs_mul
+		//
+		//	r[0, an + bn) = a * b for an >= bn > 0. Once bn reaches the Karatsuba
+		//	threshold a is cut into bn limb pieces, each multiplied by b as a square
+		//	product. scratch holds limbs_mul_scratch_size(bn) limbs.
+		//
+		inline SPROUT_CXX14_CONSTEXPR void
+		limbs_mul(
+			sprout::detail::limb_type* r,
+			sprout::detail::limb_type const* a, std::size_t an,
+			sprout::detail::limb_type const* b, std::size_t bn,
+			sprout::detail::limb_type* scratch
+			)
+		{
+			if (bn < sprout::detail::karatsuba_threshold) {
+				sprout::detail::limbs_mul_basecase(r, a, an, b, bn);
+				return;
+			}
+			if (an == bn) {
+				sprout::detail::limbs_mul_karatsuba(r, a, b, bn, scratch);
+				return;
+			}
+			sprout::detail::limbs_fill(r, 0, an + bn);
+			sprout::detail::limb_type* const piece = scratch;
+			std::size_t i = 0;
+			for (; an - i >= bn; i += bn) {
+				sprout::detail::limbs_mul_karatsuba(piece, a + i, b, bn, scratch + 2 * bn);
+				sprout::detail::limbs_add(r + i, r + i, an + bn - i, piece, 2 * bn);
+			}
+			if (i != an) {
+				std::size_t const rest = an - i;
+				sprout::detail::limbs_mul(piece, b, bn, a + i, rest, scratch + 2 * bn);
+				sprout::detail::limbs_add(r + i, r + i, an + bn - i, piece, rest + bn);
+			}
+		}
+
+		//
+		// udiv128
+		//
+		//	(hi B + lo) / d and its remainder for hi < d.
+		//
+		inline SPROUT_CXX14_CONSTEXPR sprout::detail::limb_type
+		udiv128(
+			sprout::detail::limb_type hi, sprout::detail::limb_type lo, sprout::detail::limb_type d,
+			sprout::detail::limb_type& rem
+			)
+		{
+#if defined(__SIZEOF_INT128__)
+			unsigned __int128 const n = (static_cast<unsigned __int128>(hi) << 64) | lo;
+			rem = static_cast<sprout::detail::limb_type>(n % d);
+			return static_cast<sprout::detail::limb_type>(n / d);
+#else
+			// Hacker's Delight divlu: two 32 bit digit steps of Knuth D
+			unsigned const s = static_cast<unsigned>(sprout::clz(d));
+			d <<= s;
+			sprout::detail::limb_type const d1 = d >> 32;
+			sprout::detail::limb_type const d0 = d & UINT64_C(0xFFFFFFFF);
+			sprout::detail::limb_type const n32 = s == 0 ? hi : (hi << s) | (lo >> (64 - s));
+			sprout::detail::limb_type const n10 = lo << s;
+			sprout::detail::limb_type const n1 = n10 >> 32;
+			sprout::detail::limb_type const n0 = n10 & UINT64_C(0xFFFFFFFF);
+			sprout::detail::limb_type q1 = n32 / d1;
+			sprout::detail::limb_type r1 = n32 - q1 * d1;
+			while (q1 >> 32 != 0 || q1 * d0 > ((r1 << 32) | n1)) {
+				--q1;
+				r1 += d1;
+				if (r1 >> 32 != 0) {
+					break;
+				}
+			}
+			sprout::detail::limb_type const n21 = (n32 << 32) + n1 - q1 * d;
+			sprout::detail::limb_type q0 = n21 / d1;
+			sprout::detail::limb_type r0 = n21 - q0 * d1;
+			while (q0 >> 32 != 0 || q0 * d0 > ((r0 << 32) | n0)) {
+				--q0;
+				r0 += d1;
+				if (r0 >> 32 != 0) {
+					break;
+				}
+			}
+			rem = ((n21 << 32) + n0 - q0 * d) >> s;
+			return (q1 << 32) | q0;
+#endif
+		}
+
+		//
+		// limbs_divmod_1
+		//
+		//	q = a / d; returns a % d. q may alias a.
+		//
+		inline SPROUT_CXX14_CONSTEXPR sprout::detail::limb_type
+		limbs_divmod_1(
+			sprout::detail::limb_type* q,
+			sprout::detail::limb_type const* a, std::size_t n, sprout::detail::limb_type d
+			)
+		{
+			sprout::detail::limb_type rem = 0;
+			for (std::size_t i = n; i != 0; --i) {
+				q[i - 1] = sprout::detail::udiv128(rem, a[i - 1], d, rem);
+			}
+			return rem;
+		}
+
+		//
+		// limbs_divmod_scratch_size
+		//
+		inline SPROUT_CONSTEXPR std::size_t
+		limbs_divmod_scratch_size(std::size_t un, std::size_t vn) {
+			return un + 1 + vn;
+		}
+
+		//
+		// limbs_divmod
+		//
+		//	Knuth's Algorithm D. For un >= vn > 0 and v[vn - 1] != 0, q[0, un - vn + 1)
+		//	= u / v and r[0, vn) = u % v. scratch holds limbs_divmod_scratch_size(un, vn)
+		//	limbs; q and r must not overlap u or v.
+		//
+		inline SPROUT_CXX14_CONSTEXPR void
+		limbs_divmod(
+			sprout::detail::limb_type* q, sprout::detail::limb_type* r,
+			sprout::detail::limb_type const* u, std::size_t un,
+			sprout::detail::limb_type const* v, std::size_t vn,
+			sprout::detail::limb_type* scratch
+			)
+		{
+			if (vn == 1) {
+				r[0] = sprout::detail::limbs_divmod_1(q, u, un, v[0]);
+				return;
+			}
+			// normalize so that the top bit of the divisor is set
+			unsigned const s = static_cast<unsigned>(sprout::clz(v[vn - 1]));
+			sprout::detail::limb_type* const un_ = scratch;
+			sprout::detail::limb_type* const vn_ = scratch + un + 1;
+			sprout::detail::limbs_lshift(vn_, v, vn, s);
+			un_[un] = sprout::detail::limbs_lshift(un_, u, un, s);
+			sprout::detail::limb_type const d1 = vn_[vn - 1];
+			sprout::detail::limb_type const d0 = vn_[vn - 2];
+			for (std::size_t j = un - vn + 1; j != 0; ) {
+				--j;
+				sprout::detail::limb_type const u2 = un_[j + vn];
+				sprout::detail::limb_type const u1 = un_[j + vn - 1];
+				sprout::detail::limb_type const u0 = un_[j + vn - 2];
+				// estimate the quotient digit from the top two limbs, then refine it with the third
+				sprout::detail::limb_type qhat = 0;
+				sprout::detail::limb_type rhat = 0;
+				bool rhat_overflow = false;
+				if (u2 >= d1) {
+					qhat = ~sprout::detail::limb_type(0);
+					rhat = u1 + d1;
+					rhat_overflow = rhat < d1;
+				} else {
+					qhat = sprout::detail::udiv128(u2, u1, d1, rhat);
+				}
+				while (!rhat_overflow) {
+					sprout::detail::uint128_parts const p = sprout::detail::umul128(qhat, d0);
+					if (p.hi < rhat || (p.hi == rhat && p.lo <= u0)) {
+						break;
+					}
+					--qhat;
+					rhat += d1;
+					rhat_overflow = rhat < d1;
+				}
+				// multiply and subtract; add back when qhat was still one too large
+				sprout::detail::limb_type const borrow = sprout::detail::limbs_submul_1(un_ + j, vn_, vn, qhat);
+				un_[j + vn] = u2 - borrow;
+				if (u2 < borrow) {
+					--qhat;
+					un_[j + vn] += sprout::detail::limbs_add_n(un_ + j, un_ + j, vn_, vn);
+				}
+				q[j] = qhat;
+			}
+			sprout::detail::limbs_rshift(r, un_, vn, s);
+		}
+
+		//
+		// limbs_pow10
+		//
+		//	10^19, the largest power of ten in a limb, splits decimal conversion into 19 digit chunks.
+		//
+		SPROUT_STATIC_CONSTEXPR sprout::detail::limb_type limbs_pow10 = UINT64_C(10000000000000000000);
+		SPROUT_STATIC_CONSTEXPR std::size_t limbs_pow10_digits = 19;
+
+		//
+		// limbs_write_decimal
+		//
+		//	Writes the decimal digits of a, destroying it, so that they end at last.
+		//	Returns the first written position.
+		//
+		template<typename Elem>
+		inline SPROUT_CXX14_CONSTEXPR Elem*
+		limbs_write_decimal(Elem* last, sprout::detail::limb_type* a, std::size_t n) {
+			n = sprout::detail::limbs_normalized_size(a, n);
+			while (n > 1 || (n == 1 && a[0] >= sprout::detail::limbs_pow10)) {
+				sprout::detail::limb_type const rem = sprout::detail::limbs_divmod_1(a, a, n, sprout::detail::limbs_pow10);
+				last = sprout::detail::write_decimal_digits(last, rem, static_cast<int>(sprout::detail::limbs_pow10_digits));
+				n = sprout::detail::limbs_normalized_size(a, n);
+			}
+			sprout::detail::limb_type const top = n != 0 ? a[0] : 0;
+			return sprout::detail::write_decimal_digits(last, top, sprout::detail::decimal_digits(top));
+		}
+	}	// namespace detail
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_INTEGER_DETAIL_LIMBS_HPP
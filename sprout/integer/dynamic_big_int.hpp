@@ -0,0 +1,502 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_INTEGER_DYNAMIC_BIG_INT_HPP
+#define SPROUT_INTEGER_DYNAMIC_BIG_INT_HPP
+
+#include <limits>
+#include <vector>
+#include <iterator>
+#include <ostream>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/string/dynamic_string.hpp>
+#include <sprout/math/gcd.hpp>
+#include <sprout/type_traits/enabler_if.hpp>
+#include <sprout/detail/char_literal.hpp>
+#include <sprout/integer/detail/limbs.hpp>
+#include <sprout/integer/big_int.hpp>
+
+namespace sprout {
+	//
+	// dynamic_big_int
+	//
+	//	Arbitrary precision integer for runtime use: a sign and a magnitude in a
+	//	std::vector of 64-bit limbs without leading zero limbs, so zero is the
+	//	empty vector. Uses the limb kernels of big_int; the magnitudes grow as
+	//	needed and nothing wraps around. Shifts act on the magnitude.
+	//
+	class dynamic_big_int {
+	public:
+		typedef sprout::detail::limb_type limb_type;
+		typedef std::size_t size_type;
+		typedef std::vector<limb_type> limbs_type;
+	public:
+		//
+		// from_string
+		//
+		//	Parses an optionally signed decimal number. Throws std::invalid_argument
+		//	on anything else.
+		//
+		template<typename InputIterator>
+		static dynamic_big_int from_string(InputIterator first, InputIterator last) {
+			typedef typename std::iterator_traits<InputIterator>::value_type elem_type;
+			bool negative = false;
+			if (first != last && (*first == SPROUT_CHAR_LITERAL('-', elem_type) || *first == SPROUT_CHAR_LITERAL('+', elem_type))) {
+				negative = *first == SPROUT_CHAR_LITERAL('-', elem_type);
+				++first;
+			}
+			if (first == last) {
+				throw std::invalid_argument("dynamic_big_int: no digits");
+			}
+			dynamic_big_int result;
+			while (first != last) {
+				limb_type chunk = 0;
+				limb_type scale = 1;
+				for (size_type k = 0; k != sprout::detail::limbs_pow10_digits && first != last; ++k, ++first) {
+					if (*first < SPROUT_CHAR_LITERAL('0', elem_type) || *first > SPROUT_CHAR_LITERAL('9', elem_type)) {
+						throw std::invalid_argument("dynamic_big_int: invalid digit");
+					}
+					chunk = chunk * 10 + static_cast<limb_type>(*first - SPROUT_CHAR_LITERAL('0', elem_type));
+					scale *= 10;
+				}
+				limbs_type& mag = result.mag_;
+				limb_type const high = sprout::detail::limbs_mul_1(mag.data(), mag.data(), mag.size(), scale);
+				limb_type const carry = sprout::detail::limbs_add_1(mag.data(), mag.data(), mag.size(), chunk);
+				if (high != 0 || carry != 0) {
+					mag.push_back(high + carry);
+				}
+			}
+			result.negative_ = negative && !result.mag_.empty();
+			return result;
+		}
+		template<typename Elem>
+		static dynamic_big_int from_string(Elem const* str) {
+			Elem const* last = str;
+			while (*last != Elem()) {
+				++last;
+			}
+			return from_string(str, last);
+		}
+		static void divmod(dynamic_big_int const& u, dynamic_big_int const& v, dynamic_big_int* q, dynamic_big_int* r) {
+			if (v.mag_.empty()) {
+				throw std::domain_error("dynamic_big_int: division by zero");
+			}
+			size_type const an = u.mag_.size();
+			size_type const bn = v.mag_.size();
+			if (compare_magnitude(u.mag_, v.mag_) < 0) {
+				if (r) {
+					*r = u;
+				}
+				if (q) {
+					*q = dynamic_big_int();
+				}
+				return;
+			}
+			bool const q_negative = u.negative_ != v.negative_;
+			bool const r_negative = u.negative_;
+			limbs_type qm(an - bn + 1);
+			limbs_type rm(bn);
+			limbs_type scratch(sprout::detail::limbs_divmod_scratch_size(an, bn));
+			sprout::detail::limbs_divmod(qm.data(), rm.data(), u.mag_.data(), an, v.mag_.data(), bn, scratch.data());
+			if (q) {
+				q->mag_.swap(qm);
+				q->normalize(q_negative);
+			}
+			if (r) {
+				r->mag_.swap(rm);
+				r->normalize(r_negative);
+			}
+		}
+	private:
+		static int compare_magnitude(limbs_type const& a, limbs_type const& b) {
+			return a.size() != b.size() ? (a.size() < b.size() ? -1 : 1)
+				: sprout::detail::limbs_compare(a.data(), b.data(), a.size())
+				;
+		}
+	private:
+		limbs_type mag_;
+		bool negative_;
+	private:
+		void normalize(bool negative) {
+			mag_.resize(sprout::detail::limbs_normalized_size(mag_.data(), mag_.size()));
+			negative_ = negative && !mag_.empty();
+		}
+		// *this += (rhs_negative ? -1 : 1) * rhs, for rhs not aliasing mag_
+		void add_signed(limbs_type const& rhs, bool rhs_negative) {
+			if (negative_ == rhs_negative) {
+				size_type const n = mag_.size() < rhs.size() ? rhs.size() : mag_.size();
+				mag_.resize(n + 1);
+				mag_[n] = sprout::detail::limbs_add(mag_.data(), mag_.data(), n, rhs.data(), rhs.size());
+				normalize(negative_);
+			} else if (compare_magnitude(mag_, rhs) >= 0) {
+				sprout::detail::limbs_sub(mag_.data(), mag_.data(), mag_.size(), rhs.data(), rhs.size());
+				normalize(negative_);
+			} else {
+				limbs_type result(rhs);
+				sprout::detail::limbs_sub(result.data(), result.data(), result.size(), mag_.data(), mag_.size());
+				mag_.swap(result);
+				normalize(rhs_negative);
+			}
+		}
+	public:
+		dynamic_big_int()
+			: mag_(), negative_(false)
+		{}
+		dynamic_big_int(dynamic_big_int const&) = default;
+		dynamic_big_int(dynamic_big_int&& other) SPROUT_NOEXCEPT
+			: mag_(std::move(other.mag_)), negative_(other.negative_)
+		{
+			other.negative_ = false;
+		}
+		template<typename IntType, typename sprout::enabler_if<std::is_integral<IntType>::value>::type = sprout::enabler>
+		dynamic_big_int(IntType val)
+			: mag_(), negative_(val < IntType(0))
+		{
+			typedef typename std::make_unsigned<IntType>::type unsigned_type;
+			unsigned_type const u = negative_ ? static_cast<unsigned_type>(0 - static_cast<unsigned_type>(val)) : static_cast<unsigned_type>(val);
+			if (u != 0) {
+				mag_.push_back(static_cast<limb_type>(u));
+			}
+		}
+		template<std::size_t Bits>
+		explicit dynamic_big_int(sprout::big_int<Bits> const& other)
+			: mag_(Bits / 64), negative_(other.is_negative())
+		{
+			for (size_type i = 0; i != mag_.size(); ++i) {
+				mag_[i] = other.limb(i);
+			}
+			if (negative_) {
+				sprout::detail::limbs_negate(mag_.data(), mag_.data(), mag_.size());
+			}
+			normalize(negative_);
+		}
+		dynamic_big_int& operator=(dynamic_big_int const&) = default;
+		dynamic_big_int& operator=(dynamic_big_int&& other) SPROUT_NOEXCEPT {
+			mag_ = std::move(other.mag_);
+			negative_ = other.negative_;
+			other.negative_ = false;
+			return *this;
+		}
+		void swap(dynamic_big_int& other) SPROUT_NOEXCEPT {
+			mag_.swap(other.mag_);
+			std::swap(negative_, other.negative_);
+		}
+
+		limbs_type const& magnitude() const SPROUT_NOEXCEPT {
+			return mag_;
+		}
+		bool is_negative() const SPROUT_NOEXCEPT {
+			return negative_;
+		}
+		bool is_zero() const SPROUT_NOEXCEPT {
+			return mag_.empty();
+		}
+		int sign() const SPROUT_NOEXCEPT {
+			return negative_ ? -1 : mag_.empty() ? 0 : 1;
+		}
+		size_type bit_length() const SPROUT_NOEXCEPT {
+			return mag_.empty() ? 0 : mag_.size() * 64 - static_cast<size_type>(sprout::clz(mag_.back()));
+		}
+
+		explicit operator bool() const SPROUT_NOEXCEPT {
+			return !mag_.empty();
+		}
+		template<typename IntType, typename sprout::enabler_if<
+			std::is_integral<IntType>::value && !std::is_same<IntType, bool>::value
+		>::type = sprout::enabler>
+		explicit operator IntType() const SPROUT_NOEXCEPT {
+			limb_type const low = mag_.empty() ? 0 : mag_[0];
+			return static_cast<IntType>(negative_ ? 0 - low : low);
+		}
+		template<typename FloatType, typename sprout::enabler_if<std::is_floating_point<FloatType>::value>::type = sprout::enabler>
+		explicit operator FloatType() const SPROUT_NOEXCEPT {
+			FloatType result = 0;
+			for (size_type i = mag_.size(); i != 0; --i) {
+				result = result * FloatType(18446744073709551616.0) + static_cast<FloatType>(mag_[i - 1]);
+			}
+			return negative_ ? -result : result;
+		}
+
+		dynamic_big_int& operator+=(dynamic_big_int const& rhs) {
+			if (&rhs == this) {
+				return *this <<= 1;
+			}
+			add_signed(rhs.mag_, rhs.negative_);
+			return *this;
+		}
+		dynamic_big_int& operator-=(dynamic_big_int const& rhs) {
+			if (&rhs == this) {
+				return *this = dynamic_big_int();
+			}
+			add_signed(rhs.mag_, !rhs.negative_);
+			return *this;
+		}
+		dynamic_big_int& operator*=(dynamic_big_int const& rhs) {
+			if (mag_.empty() || rhs.mag_.empty()) {
+				return *this = dynamic_big_int();
+			}
+			limbs_type const& a = mag_.size() >= rhs.mag_.size() ? mag_ : rhs.mag_;
+			limbs_type const& b = mag_.size() >= rhs.mag_.size() ? rhs.mag_ : mag_;
+			limbs_type result(a.size() + b.size());
+			if (b.size() < sprout::detail::karatsuba_threshold) {
+				sprout::detail::limbs_mul_basecase(result.data(), a.data(), a.size(), b.data(), b.size());
+			} else {
+				limbs_type scratch(sprout::detail::limbs_mul_scratch_size(b.size()));
+				sprout::detail::limbs_mul(result.data(), a.data(), a.size(), b.data(), b.size(), scratch.data());
+			}
+			mag_.swap(result);
+			normalize(negative_ != rhs.negative_);
+			return *this;
+		}
+		dynamic_big_int& operator/=(dynamic_big_int const& rhs) {
+			divmod(*this, rhs, this, 0);
+			return *this;
+		}
+		dynamic_big_int& operator%=(dynamic_big_int const& rhs) {
+			divmod(*this, rhs, 0, this);
+			return *this;
+		}
+		dynamic_big_int& operator<<=(size_type n) {
+			if (mag_.empty()) {
+				return *this;
+			}
+			size_type const w = n / 64;
+			mag_.insert(mag_.begin(), w, limb_type(0));
+			limb_type const out = sprout::detail::limbs_lshift(mag_.data() + w, mag_.data() + w, mag_.size() - w, static_cast<unsigned>(n % 64));
+			if (out != 0) {
+				mag_.push_back(out);
+			}
+			return *this;
+		}
+		dynamic_big_int& operator>>=(size_type n) {
+			size_type const w = n / 64;
+			if (w >= mag_.size()) {
+				return *this = dynamic_big_int();
+			}
+			mag_.erase(mag_.begin(), mag_.begin() + w);
+			sprout::detail::limbs_rshift(mag_.data(), mag_.data(), mag_.size(), static_cast<unsigned>(n % 64));
+			normalize(negative_);
+			return *this;
+		}
+
+		dynamic_big_int& operator++() {
+			return *this += dynamic_big_int(1);
+		}
+		dynamic_big_int& operator--() {
+			return *this -= dynamic_big_int(1);
+		}
+		dynamic_big_int operator++(int) {
+			dynamic_big_int result(*this);
+			++*this;
+			return result;
+		}
+		dynamic_big_int operator--(int) {
+			dynamic_big_int result(*this);
+			--*this;
+			return result;
+		}
+
+		friend dynamic_big_int operator+(dynamic_big_int const& x) {
+			return x;
+		}
+		friend dynamic_big_int operator-(dynamic_big_int x) {
+			x.negative_ = !x.negative_ && !x.mag_.empty();
+			return x;
+		}
+		friend dynamic_big_int operator+(dynamic_big_int lhs, dynamic_big_int const& rhs) {
+			return std::move(lhs += rhs);
+		}
+		friend dynamic_big_int operator-(dynamic_big_int lhs, dynamic_big_int const& rhs) {
+			return std::move(lhs -= rhs);
+		}
+		friend dynamic_big_int operator*(dynamic_big_int lhs, dynamic_big_int const& rhs) {
+			return std::move(lhs *= rhs);
+		}
+		friend dynamic_big_int operator/(dynamic_big_int lhs, dynamic_big_int const& rhs) {
+			return std::move(lhs /= rhs);
+		}
+		friend dynamic_big_int operator%(dynamic_big_int lhs, dynamic_big_int const& rhs) {
+			return std::move(lhs %= rhs);
+		}
+		friend dynamic_big_int operator<<(dynamic_big_int lhs, size_type n) {
+			return std::move(lhs <<= n);
+		}
+		friend dynamic_big_int operator>>(dynamic_big_int lhs, size_type n) {
+			return std::move(lhs >>= n);
+		}
+
+		friend bool operator==(dynamic_big_int const& lhs, dynamic_big_int const& rhs) {
+			return lhs.negative_ == rhs.negative_ && lhs.mag_ == rhs.mag_;
+		}
+		friend bool operator!=(dynamic_big_int const& lhs, dynamic_big_int const& rhs) {
+			return !(lhs == rhs);
+		}
+		friend bool operator<(dynamic_big_int const& lhs, dynamic_big_int const& rhs) {
+			return lhs.negative_ != rhs.negative_ ? lhs.negative_
+				: lhs.negative_ ? compare_magnitude(rhs.mag_, lhs.mag_) < 0
+				: compare_magnitude(lhs.mag_, rhs.mag_) < 0
+				;
+		}
+		friend bool operator>(dynamic_big_int const& lhs, dynamic_big_int const& rhs) {
+			return rhs < lhs;
+		}
+		friend bool operator<=(dynamic_big_int const& lhs, dynamic_big_int const& rhs) {
+			return !(rhs < lhs);
+		}
+		friend bool operator>=(dynamic_big_int const& lhs, dynamic_big_int const& rhs) {
+			return !(lhs < rhs);
+		}
+	};
+
+	//
+	// swap
+	//
+	inline void
+	swap(sprout::dynamic_big_int& lhs, sprout::dynamic_big_int& rhs) SPROUT_NOEXCEPT {
+		lhs.swap(rhs);
+	}
+
+	//
+	// abs
+	//
+	inline sprout::dynamic_big_int
+	abs(sprout::dynamic_big_int const& x) {
+		return x.is_negative() ? -x : x;
+	}
+
+	//
+	// to_string_of
+	// to_string
+	//
+	template<typename Elem>
+	inline sprout::basic_dynamic_string<Elem>
+	to_string_of(sprout::dynamic_big_int const& x) {
+		sprout::dynamic_big_int::limbs_type mag(x.magnitude());
+		std::vector<Elem> buffer(mag.size() * 20 + 2);
+		Elem* const last = buffer.data() + buffer.size();
+		Elem* first = sprout::detail::limbs_write_decimal(last, mag.data(), mag.size());
+		if (x.is_negative()) {
+			*--first = SPROUT_CHAR_LITERAL('-', Elem);
+		}
+		return sprout::basic_dynamic_string<Elem>(first, static_cast<std::size_t>(last - first));
+	}
+	inline sprout::dynamic_string
+	to_string(sprout::dynamic_big_int const& x) {
+		return sprout::to_string_of<char>(x);
+	}
+
+	//
+	// operator<<
+	//
+	template<typename Elem, typename Traits>
+	inline SPROUT_NON_CONSTEXPR std::basic_ostream<Elem, Traits>&
+	operator<<(std::basic_ostream<Elem, Traits>& lhs, sprout::dynamic_big_int const& rhs) {
+		return lhs << sprout::to_string_of<Elem>(rhs).c_str();
+	}
+
+	namespace math {
+		namespace detail {
+			//
+			// gcd_optimal_evaluator
+			//
+			template<>
+			struct gcd_optimal_evaluator<sprout::dynamic_big_int> {
+			public:
+				sprout::dynamic_big_int
+				operator()(sprout::dynamic_big_int a, sprout::dynamic_big_int b) const {
+					a = sprout::abs(a);
+					b = sprout::abs(b);
+					while (b) {
+						sprout::dynamic_big_int t = a % b;
+						a.swap(b);
+						b.swap(t);
+					}
+					return a;
+				}
+			};
+		}	// namespace detail
+	}	// namespace math
+}	// namespace sprout
+
+namespace std {
+#if defined(__clang__)
+#	pragma clang diagnostic push
+#	pragma clang diagnostic ignored "-Wmismatched-tags"
+#endif
+	//
+	// numeric_limits
+	//
+	template<>
+	class numeric_limits<sprout::dynamic_big_int> {
+	public:
+		SPROUT_STATIC_CONSTEXPR bool is_specialized = true;
+
+		static sprout::dynamic_big_int min() SPROUT_NOEXCEPT {
+			return sprout::dynamic_big_int();
+		}
+		static sprout::dynamic_big_int max() SPROUT_NOEXCEPT {
+			return sprout::dynamic_big_int();
+		}
+		static sprout::dynamic_big_int lowest() SPROUT_NOEXCEPT {
+			return sprout::dynamic_big_int();
+		}
+
+		SPROUT_STATIC_CONSTEXPR int digits = 0;
+		SPROUT_STATIC_CONSTEXPR int digits10 = 0;
+		SPROUT_STATIC_CONSTEXPR int max_digits10 = 0;
+		SPROUT_STATIC_CONSTEXPR bool is_signed = true;
+		SPROUT_STATIC_CONSTEXPR bool is_integer = true;
+		SPROUT_STATIC_CONSTEXPR bool is_exact = true;
+		SPROUT_STATIC_CONSTEXPR int radix = 2;
+		static sprout::dynamic_big_int epsilon() SPROUT_NOEXCEPT {
+			return sprout::dynamic_big_int();
+		}
+		static sprout::dynamic_big_int round_error() SPROUT_NOEXCEPT {
+			return sprout::dynamic_big_int();
+		}
+
+		SPROUT_STATIC_CONSTEXPR int min_exponent = 0;
+		SPROUT_STATIC_CONSTEXPR int min_exponent10 = 0;
+		SPROUT_STATIC_CONSTEXPR int max_exponent = 0;
+		SPROUT_STATIC_CONSTEXPR int max_exponent10 = 0;
+
+		SPROUT_STATIC_CONSTEXPR bool has_infinity = false;
+		SPROUT_STATIC_CONSTEXPR bool has_quiet_NaN = false;
+		SPROUT_STATIC_CONSTEXPR bool has_signaling_NaN = false;
+		SPROUT_STATIC_CONSTEXPR std::float_denorm_style has_denorm = std::denorm_absent;
+		SPROUT_STATIC_CONSTEXPR bool has_denorm_loss = false;
+		static sprout::dynamic_big_int infinity() SPROUT_NOEXCEPT {
+			return sprout::dynamic_big_int();
+		}
+		static sprout::dynamic_big_int quiet_NaN() SPROUT_NOEXCEPT {
+			return sprout::dynamic_big_int();
+		}
+		static sprout::dynamic_big_int signaling_NaN() SPROUT_NOEXCEPT {
+			return sprout::dynamic_big_int();
+		}
+		static sprout::dynamic_big_int denorm_min() SPROUT_NOEXCEPT {
+			return sprout::dynamic_big_int();
+		}
+
+		SPROUT_STATIC_CONSTEXPR bool is_iec559 = false;
+		SPROUT_STATIC_CONSTEXPR bool is_bounded = false;
+		SPROUT_STATIC_CONSTEXPR bool is_modulo = false;
+
+		SPROUT_STATIC_CONSTEXPR bool traps = false;
+		SPROUT_STATIC_CONSTEXPR bool tinyness_before = false;
+		SPROUT_STATIC_CONSTEXPR std::float_round_style round_style = std::round_toward_zero;
+	};
+#if defined(__clang__)
+#	pragma clang diagnostic pop
+#endif
+}	// namespace std
+
+#endif	// #ifndef SPROUT_INTEGER_DYNAMIC_BIG_INT_HPP
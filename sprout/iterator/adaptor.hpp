@@ -35,5 +35,6 @@
 #include <sprout/iterator/bytes_iterator.hpp>
 #include <sprout/iterator/remake_iterator.hpp>
 #include <sprout/iterator/next_iterator.hpp>
+#include <sprout/iterator/split_iterator.hpp>
 
 #endif	// #ifndef SPROUT_ITERATOR_ADAPTOR_HPP
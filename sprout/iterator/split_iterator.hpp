@@ -0,0 +1,161 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_ITERATOR_SPLIT_ITERATOR_HPP
+#define SPROUT_ITERATOR_SPLIT_ITERATOR_HPP
+
+#include <iterator>
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/iterator/iterator.hpp>
+#include <sprout/utility/string_view/string_view.hpp>
+#include <sprout/utility/swap.hpp>
+
+namespace sprout {
+	//
+	// split_result
+	//
+	//	What a splitter finds in [first, last): the token [first, last) and
+	//	where the following one starts. A null first means there is no token,
+	//	a null next that this one is the last.
+	//
+	template<typename Elem>
+	struct split_result {
+	public:
+		Elem const* first;
+		Elem const* last;
+		Elem const* next;
+	};
+
+	//
+	// split_iterator
+	//
+	//	Forward iterator over the basic_string_view slices that Splitter cuts a
+	//	character range into; nothing is copied. Splitter provides char_type and
+	//	split_result<char_type> operator()(char_type const*, char_type const*).
+	//
+	template<typename Splitter>
+	class split_iterator
+		: public sprout::iterator<
+			std::forward_iterator_tag,
+			sprout::basic_string_view<typename Splitter::char_type>,
+			std::ptrdiff_t,
+			sprout::basic_string_view<typename Splitter::char_type>*,
+			sprout::basic_string_view<typename Splitter::char_type>
+		>
+	{
+	public:
+		typedef Splitter splitter_type;
+		typedef typename Splitter::char_type char_type;
+		typedef std::forward_iterator_tag iterator_category;
+		typedef sprout::basic_string_view<char_type> value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef value_type* pointer;
+		typedef value_type reference;
+	private:
+		Splitter splitter_;
+		char_type const* first_;
+		char_type const* token_last_;
+		char_type const* next_;
+		char_type const* last_;
+	private:
+		SPROUT_CXX14_CONSTEXPR void assign(sprout::split_result<char_type> const& r) {
+			first_ = r.first;
+			token_last_ = r.first ? r.last : 0;
+			next_ = r.first ? r.next : 0;
+		}
+	public:
+		SPROUT_CONSTEXPR split_iterator()
+			: splitter_(), first_(), token_last_(), next_(), last_()
+		{}
+		split_iterator(split_iterator const&) = default;
+		// an empty range has no tokens
+		SPROUT_CXX14_CONSTEXPR split_iterator(Splitter const& splitter, char_type const* first, char_type const* last)
+			: splitter_(splitter), first_(), token_last_(), next_(), last_(last)
+		{
+			if (first != last) {
+				assign(splitter_(first, last));
+			}
+		}
+		SPROUT_CONSTEXPR Splitter const& splitter() const {
+			return splitter_;
+		}
+		SPROUT_CONSTEXPR char_type const* base() const {
+			return first_;
+		}
+		SPROUT_CONSTEXPR reference operator*() const {
+			return value_type(first_, static_cast<typename value_type::size_type>(token_last_ - first_));
+		}
+
+		SPROUT_CXX14_CONSTEXPR split_iterator& operator++() {
+			if (next_) {
+				assign(splitter_(next_, last_));
+			} else {
+				first_ = token_last_ = 0;
+			}
+			return *this;
+		}
+		SPROUT_CXX14_CONSTEXPR split_iterator operator++(int) {
+			split_iterator result(*this);
+			++*this;
+			return result;
+		}
+		SPROUT_CXX14_CONSTEXPR split_iterator next() const {
+			split_iterator result(*this);
+			++result;
+			return result;
+		}
+		SPROUT_CXX14_CONSTEXPR void swap(split_iterator& other) {
+			sprout::swap(splitter_, other.splitter_);
+			sprout::swap(first_, other.first_);
+			sprout::swap(token_last_, other.token_last_);
+			sprout::swap(next_, other.next_);
+			sprout::swap(last_, other.last_);
+		}
+	};
+
+	// tokens start at distinct positions; the end iterator has none
+	template<typename Splitter>
+	inline SPROUT_CONSTEXPR bool
+	operator==(sprout::split_iterator<Splitter> const& lhs, sprout::split_iterator<Splitter> const& rhs) {
+		return lhs.base() == rhs.base();
+	}
+	template<typename Splitter>
+	inline SPROUT_CONSTEXPR bool
+	operator!=(sprout::split_iterator<Splitter> const& lhs, sprout::split_iterator<Splitter> const& rhs) {
+		return !(lhs == rhs);
+	}
+
+	//
+	// make_split_iterator
+	//
+	template<typename Splitter>
+	inline SPROUT_CXX14_CONSTEXPR sprout::split_iterator<Splitter>
+	make_split_iterator(Splitter const& splitter, typename Splitter::char_type const* first, typename Splitter::char_type const* last) {
+		return sprout::split_iterator<Splitter>(splitter, first, last);
+	}
+
+	//
+	// swap
+	//
+	template<typename Splitter>
+	inline SPROUT_CXX14_CONSTEXPR void
+	swap(sprout::split_iterator<Splitter>& lhs, sprout::split_iterator<Splitter>& rhs) {
+		lhs.swap(rhs);
+	}
+
+	//
+	// iterator_next
+	//
+	template<typename Splitter>
+	inline SPROUT_CXX14_CONSTEXPR sprout::split_iterator<Splitter>
+	iterator_next(sprout::split_iterator<Splitter> const& it) {
+		return it.next();
+	}
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_ITERATOR_SPLIT_ITERATOR_HPP
@@ -12,5 +12,7 @@
 #include <sprout/math/functions.hpp>
 #include <sprout/math/constants.hpp>
 #include <sprout/math/constant_variables.hpp>
+#include <sprout/math/batch.hpp>
+#include <sprout/math/simd.hpp>
 
 #endif	// #ifndef SPROUT_MATH_HPP
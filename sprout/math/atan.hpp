@@ -10,13 +10,10 @@
 
 #include <type_traits>
 #include <sprout/config.hpp>
-#include <sprout/workaround/std/cstddef.hpp>
 #include <sprout/limits.hpp>
-#include <sprout/detail/pow.hpp>
 #include <sprout/math/detail/config.hpp>
 #include <sprout/math/detail/float_compute.hpp>
 #include <sprout/math/constants.hpp>
-#include <sprout/math/factorial.hpp>
 #include <sprout/math/isnan.hpp>
 #include <sprout/type_traits/enabler_if.hpp>
 
@@ -38,26 +35,61 @@ namespace sprout {
 			}
 #endif
 
+			//
+			// atan(x) for x > 0: x is moved next to one of 0, 1/2, 1, 3/2 or infinity,
+			//	atan(x) = atan(c) + atan(t), t = (x - c) / (1 + c * x),
+			// with atan(c) in two parts and atan(t) by a minimax polynomial in t^2.
+			//
 			template<typename T>
 			inline SPROUT_CONSTEXPR T
-			atan_impl_1(T x, std::size_t n, std::size_t last) {
-				return last - n == 1
-					? (n % 2 ? -1 : 1) * sprout::detail::pow_n(x, 2 * n + 1) / (2 * n + 1)
-					: sprout::math::detail::atan_impl_1(x, n, n + (last - n) / 2)
-						+ sprout::math::detail::atan_impl_1(x, n + (last - n) / 2, last)
+			atan_hi(int id) {
+				return id == 0 ? T(4.63647609000806093515e-01)
+					: id == 1 ? T(7.85398163397448278999e-01)
+					: id == 2 ? T(9.82793723247329054082e-01)
+					: T(1.57079632679489655800e+00)
 					;
 			}
 			template<typename T>
 			inline SPROUT_CONSTEXPR T
+			atan_lo(int id) {
+				return id == 0 ? T(2.26987774529616870924e-17)
+					: id == 1 ? T(3.06161699786838301793e-17)
+					: id == 2 ? T(1.39033110312309984516e-17)
+					: T(6.12323399573676603587e-17)
+					;
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR T
+			atan_impl_2(T t, int id, T z, T w) {
+				return id < 0 ? t - t * (
+						z * (3.33333333333329318027e-01 + w * (1.42857142725034663711e-01 + w * (9.09088713343650656196e-02
+							+ w * (6.66107313738753120669e-02 + w * (4.97687799461593236017e-02 + w * 1.62858201153657823623e-02)))))
+						+ w * (-1.99999999998764832476e-01 + w * (-1.11111104054623557880e-01
+							+ w * (-7.69187620504482999495e-02 + w * (-5.83357013379057348645e-02 + w * -3.65315727442169155270e-02))))
+						)
+					: sprout::math::detail::atan_hi<T>(id) - ((t * (
+						z * (3.33333333333329318027e-01 + w * (1.42857142725034663711e-01 + w * (9.09088713343650656196e-02
+							+ w * (6.66107313738753120669e-02 + w * (4.97687799461593236017e-02 + w * 1.62858201153657823623e-02)))))
+						+ w * (-1.99999999998764832476e-01 + w * (-1.11111104054623557880e-01
+							+ w * (-7.69187620504482999495e-02 + w * (-5.83357013379057348645e-02 + w * -3.65315727442169155270e-02))))
+						) - sprout::math::detail::atan_lo<T>(id)) - t)
+					;
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR T
+			atan_impl_1(T t, int id) {
+				return sprout::math::detail::atan_impl_2(t, id, t * t, t * t * t * t);
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR T
 			atan_impl(T x) {
-				return x > sprout::math::root_two<T>() + 1
-						? sprout::math::half_pi<T>() - sprout::math::detail::atan_impl_1(1 / x, 0, sprout::math::factorial_limit<T>() + 1)
-					: x > sprout::math::root_two<T>() - 1
-						? sprout::math::quarter_pi<T>() + sprout::math::detail::atan_impl_1((x - 1) / (x + 1), 0, sprout::math::factorial_limit<T>() + 1)
-					: x + sprout::math::detail::atan_impl_1(x, 1, sprout::math::factorial_limit<T>() + 1)
+				return x < T(0.4375) ? sprout::math::detail::atan_impl_1(x, -1)
+					: x < T(0.6875) ? sprout::math::detail::atan_impl_1((2 * x - 1) / (2 + x), 0)
+					: x < T(1.1875) ? sprout::math::detail::atan_impl_1((x - 1) / (x + 1), 1)
+					: x < T(2.4375) ? sprout::math::detail::atan_impl_1((x - T(1.5)) / (1 + T(1.5) * x), 2)
+					: sprout::math::detail::atan_impl_1(-1 / x, 3)
 					;
 			}
-
 		}	// namespace detail
 		//
 		// atan
@@ -0,0 +1,99 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_MATH_BATCH_HPP
+#define SPROUT_MATH_BATCH_HPP
+
+#include <sprout/config.hpp>
+#include <sprout/math/detail/batch.hpp>
+#include <sprout/detail/simd.hpp>
+
+namespace sprout {
+	namespace math {
+		namespace detail {
+			template<typename Kernel, typename InputIterator, typename OutputIterator>
+			inline SPROUT_CXX14_CONSTEXPR OutputIterator
+			batch(InputIterator first, InputIterator last, OutputIterator result) {
+				for (; first != last; ++first, ++result) {
+					*result = Kernel::scalar(*first);
+				}
+				return result;
+			}
+			template<typename Kernel, typename T>
+			inline SPROUT_CXX14_CONSTEXPR T*
+			batch_pointer(T const* first, T const* last, T* result) {
+				if (!SPROUT_DETAIL_IS_CONSTANT_EVALUATED()) {
+					return sprout::math::detail::batch_apply<Kernel>(first, last, result);
+				}
+				for (; first != last; ++first, ++result) {
+					*result = Kernel::scalar(*first);
+				}
+				return result;
+			}
+			template<typename Kernel>
+			inline SPROUT_CXX14_CONSTEXPR double*
+			batch(double const* first, double const* last, double* result) {
+				return sprout::math::detail::batch_pointer<Kernel>(first, last, result);
+			}
+			template<typename Kernel>
+			inline SPROUT_CXX14_CONSTEXPR double*
+			batch(double* first, double* last, double* result) {
+				return sprout::math::detail::batch_pointer<Kernel>(first, last, result);
+			}
+			template<typename Kernel>
+			inline SPROUT_CXX14_CONSTEXPR float*
+			batch(float const* first, float const* last, float* result) {
+				return sprout::math::detail::batch_pointer<Kernel>(first, last, result);
+			}
+			template<typename Kernel>
+			inline SPROUT_CXX14_CONSTEXPR float*
+			batch(float* first, float* last, float* result) {
+				return sprout::math::detail::batch_pointer<Kernel>(first, last, result);
+			}
+		}	// namespace detail
+
+		//
+		// sin
+		// cos
+		// exp
+		// log
+		// sqrt
+		//
+		//	result[i] = f(first[i]) over [first, last), as sprout::math::f on each
+		//	element; result may be first. For double and float pointers the runtime
+		//	path evaluates 2 or 4 elements at a time (within 4 ulp, see
+		//	sprout/math/detail/batch.hpp); other iterators call f per element.
+		//
+		template<typename InputIterator, typename OutputIterator>
+		inline SPROUT_CXX14_CONSTEXPR OutputIterator
+		sin(InputIterator first, InputIterator last, OutputIterator result) {
+			return sprout::math::detail::batch<sprout::math::detail::batch_sin>(first, last, result);
+		}
+		template<typename InputIterator, typename OutputIterator>
+		inline SPROUT_CXX14_CONSTEXPR OutputIterator
+		cos(InputIterator first, InputIterator last, OutputIterator result) {
+			return sprout::math::detail::batch<sprout::math::detail::batch_cos>(first, last, result);
+		}
+		template<typename InputIterator, typename OutputIterator>
+		inline SPROUT_CXX14_CONSTEXPR OutputIterator
+		exp(InputIterator first, InputIterator last, OutputIterator result) {
+			return sprout::math::detail::batch<sprout::math::detail::batch_exp>(first, last, result);
+		}
+		template<typename InputIterator, typename OutputIterator>
+		inline SPROUT_CXX14_CONSTEXPR OutputIterator
+		log(InputIterator first, InputIterator last, OutputIterator result) {
+			return sprout::math::detail::batch<sprout::math::detail::batch_log>(first, last, result);
+		}
+		template<typename InputIterator, typename OutputIterator>
+		inline SPROUT_CXX14_CONSTEXPR OutputIterator
+		sqrt(InputIterator first, InputIterator last, OutputIterator result) {
+			return sprout::math::detail::batch<sprout::math::detail::batch_sqrt>(first, last, result);
+		}
+	}	// namespace math
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_MATH_BATCH_HPP
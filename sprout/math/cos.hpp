@@ -10,18 +10,13 @@
 
 #include <type_traits>
 #include <sprout/config.hpp>
-#include <sprout/workaround/std/cstddef.hpp>
 #include <sprout/limits.hpp>
-#include <sprout/detail/pow.hpp>
 #include <sprout/math/detail/config.hpp>
 #include <sprout/math/detail/float_compute.hpp>
-//#include <sprout/math/detail/cosp.hpp>
-//#include <sprout/math/detail/sinp.hpp>
-#include <sprout/math/constants.hpp>
+#include <sprout/math/detail/rem_pio2.hpp>
+#include <sprout/math/detail/cosp.hpp>
+#include <sprout/math/detail/sinp.hpp>
 #include <sprout/math/isnan.hpp>
-//#include <sprout/math/fabs.hpp>
-#include <sprout/math/factorial.hpp>
-#include <sprout/math/fmod.hpp>
 #include <sprout/type_traits/enabler_if.hpp>
 
 namespace sprout {
@@ -44,47 +39,18 @@ namespace sprout {
 
 			template<typename T>
 			inline SPROUT_CONSTEXPR T
-			cos_impl_1(T x2, std::size_t n, std::size_t last) {
-				return last - n == 1
-					? (n % 2 ? -1 : 1) * sprout::detail::pow_n(x2, n) / sprout::math::unchecked_factorial<T>(2 * n)
-					: sprout::math::detail::cos_impl_1(x2, n, n + (last - n) / 2)
-						+ sprout::math::detail::cos_impl_1(x2, n + (last - n) / 2, last)
+			cos_impl_1(sprout::math::detail::rem_pio2_result<T> const& r) {
+				return r.n == 0 ? sprout::math::detail::cosp(r.hi, r.lo)
+					: r.n == 1 ? -sprout::math::detail::sinp(r.hi, r.lo)
+					: r.n == 2 ? -sprout::math::detail::cosp(r.hi, r.lo)
+					: sprout::math::detail::sinp(r.hi, r.lo)
 					;
 			}
 			template<typename T>
 			inline SPROUT_CONSTEXPR T
 			cos_impl(T x) {
-				return T(1) + sprout::math::detail::cos_impl_1(
-					sprout::detail::pow2(sprout::math::fmod(x, sprout::math::two_pi<T>())),
-					1, sprout::math::factorial_limit<T>() / 2 + 1
-					);
+				return sprout::math::detail::cos_impl_1(sprout::math::detail::rem_pio2(x));
 			}
-
-			// !!! OLD:
-//			template<typename T>
-//			inline SPROUT_CONSTEXPR T
-//			cos_impl_2(T x) {
-//				return x <= sprout::math::quarter_pi<T>() ? -sprout::math::detail::cosp(x)
-//					: x <= sprout::math::half_pi<T>() ? -sprout::math::detail::sinp(sprout::math::half_pi<T>() - x)
-//					: x <= sprout::math::three_quarters_pi<T>() ? sprout::math::detail::sinp(x - sprout::math::half_pi<T>())
-//					: sprout::math::detail::cosp(sprout::math::pi<T>() - x)
-//					;
-//			}
-//			template<typename T>
-//			inline SPROUT_CONSTEXPR T
-//			cos_impl_1(T x) {
-//				return x > sprout::math::pi<T>() ? sprout::math::detail::cos_impl_2(x - sprout::math::pi<T>())
-//					: x <= sprout::math::quarter_pi<T>() ? sprout::math::detail::cosp(x)
-//					: x <= sprout::math::half_pi<T>() ? sprout::math::detail::sinp(sprout::math::half_pi<T>() - x)
-//					: x <= sprout::math::three_quarters_pi<T>() ? -sprout::math::detail::sinp(x - sprout::math::half_pi<T>())
-//					: -sprout::math::detail::cosp(sprout::math::pi<T>() - x)
-//					;
-//			}
-//			template<typename T>
-//			inline SPROUT_CONSTEXPR T
-//			cos_impl(T x) {
-//				return sprout::math::detail::cos_impl_1(sprout::math::fmod(sprout::math::fabs(x), sprout::math::two_pi<T>()));
-//			}
 		}	// namespace detail
 		//
 		// cos
@@ -0,0 +1,493 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_MATH_DETAIL_BATCH_HPP
+#define SPROUT_MATH_DETAIL_BATCH_HPP
+
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/limits.hpp>
+#include <sprout/bit/ctz.hpp>
+#include <sprout/math/sin.hpp>
+#include <sprout/math/cos.hpp>
+#include <sprout/math/exp.hpp>
+#include <sprout/math/log.hpp>
+#include <sprout/math/sqrt.hpp>
+#include <sprout/detail/simd.hpp>
+
+namespace sprout {
+	namespace math {
+		namespace detail {
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+			//
+			// batch_sse2
+			// batch_avx2
+			//
+			//	The double lane operations the kernels below are written in; float data
+			//	is widened to double on load and narrowed on store. odd(i) and shift2(i)
+			//	take the integer n held in the low bits of each lane of i, as left by
+			//	sprout::math::detail::batch_round, and give a lane mask of n & 1 and n & 2
+			//	moved to the sign bit.
+			//
+			struct batch_sse2 {
+			public:
+				typedef __m128d type;
+				typedef __m128i itype;
+				enum { width = 2 };
+			public:
+				static type load(double const* p) {
+					return _mm_loadu_pd(p);
+				}
+				static type load(float const* p) {
+					return _mm_cvtps_pd(_mm_castpd_ps(_mm_load_sd(reinterpret_cast<double const*>(p))));
+				}
+				static void store(double* p, type v) {
+					_mm_storeu_pd(p, v);
+				}
+				static void store(float* p, type v) {
+					_mm_store_sd(reinterpret_cast<double*>(p), _mm_castps_pd(_mm_cvtpd_ps(v)));
+				}
+				static type set1(double x) {
+					return _mm_set1_pd(x);
+				}
+				static type add(type a, type b) {
+					return _mm_add_pd(a, b);
+				}
+				static type sub(type a, type b) {
+					return _mm_sub_pd(a, b);
+				}
+				static type mul(type a, type b) {
+					return _mm_mul_pd(a, b);
+				}
+				static type div(type a, type b) {
+					return _mm_div_pd(a, b);
+				}
+				static type sqrt(type a) {
+					return _mm_sqrt_pd(a);
+				}
+				static type and_(type a, type b) {
+					return _mm_and_pd(a, b);
+				}
+				static type andnot(type a, type b) {
+					return _mm_andnot_pd(a, b);
+				}
+				static type or_(type a, type b) {
+					return _mm_or_pd(a, b);
+				}
+				static type xor_(type a, type b) {
+					return _mm_xor_pd(a, b);
+				}
+				static type lt(type a, type b) {
+					return _mm_cmplt_pd(a, b);
+				}
+				// !(a < b), true for NaN
+				static type nlt(type a, type b) {
+					return _mm_cmpnlt_pd(a, b);
+				}
+				static type select(type mask, type a, type b) {
+					return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b));
+				}
+				static unsigned movemask(type v) {
+					return static_cast<unsigned>(_mm_movemask_pd(v));
+				}
+				static itype bits(type v) {
+					return _mm_castpd_si128(v);
+				}
+				static type from_bits(itype v) {
+					return _mm_castsi128_pd(v);
+				}
+				static itype iset1(long long x) {
+					return _mm_set1_epi64x(x);
+				}
+				static itype iadd(itype a, itype b) {
+					return _mm_add_epi64(a, b);
+				}
+				static itype iand(itype a, itype b) {
+					return _mm_and_si128(a, b);
+				}
+				static itype ior(itype a, itype b) {
+					return _mm_or_si128(a, b);
+				}
+				static itype shl(itype a, int n) {
+					return _mm_slli_epi64(a, n);
+				}
+				static itype shr(itype a, int n) {
+					return _mm_srli_epi64(a, n);
+				}
+				static type odd(itype n) {
+					// no 64-bit arithmetic shift: spread the high halves
+					return _mm_castsi128_pd(_mm_shuffle_epi32(_mm_srai_epi32(_mm_slli_epi64(n, 63), 31), _MM_SHUFFLE(3, 3, 1, 1)));
+				}
+				static type shift2(itype n) {
+					return _mm_castsi128_pd(_mm_slli_epi64(_mm_srli_epi64(_mm_slli_epi64(n, 62), 63), 63));
+				}
+			};
+#	if defined(SPROUT_DETAIL_SIMD_AVX2)
+			struct batch_avx2 {
+			public:
+				typedef __m256d type;
+				typedef __m256i itype;
+				enum { width = 4 };
+			public:
+				static type load(double const* p) {
+					return _mm256_loadu_pd(p);
+				}
+				static type load(float const* p) {
+					return _mm256_cvtps_pd(_mm_loadu_ps(p));
+				}
+				static void store(double* p, type v) {
+					_mm256_storeu_pd(p, v);
+				}
+				static void store(float* p, type v) {
+					_mm_storeu_ps(p, _mm256_cvtpd_ps(v));
+				}
+				static type set1(double x) {
+					return _mm256_set1_pd(x);
+				}
+				static type add(type a, type b) {
+					return _mm256_add_pd(a, b);
+				}
+				static type sub(type a, type b) {
+					return _mm256_sub_pd(a, b);
+				}
+				static type mul(type a, type b) {
+					return _mm256_mul_pd(a, b);
+				}
+				static type div(type a, type b) {
+					return _mm256_div_pd(a, b);
+				}
+				static type sqrt(type a) {
+					return _mm256_sqrt_pd(a);
+				}
+				static type and_(type a, type b) {
+					return _mm256_and_pd(a, b);
+				}
+				static type andnot(type a, type b) {
+					return _mm256_andnot_pd(a, b);
+				}
+				static type or_(type a, type b) {
+					return _mm256_or_pd(a, b);
+				}
+				static type xor_(type a, type b) {
+					return _mm256_xor_pd(a, b);
+				}
+				static type lt(type a, type b) {
+					return _mm256_cmp_pd(a, b, _CMP_LT_OQ);
+				}
+				static type nlt(type a, type b) {
+					return _mm256_cmp_pd(a, b, _CMP_NLT_UQ);
+				}
+				static type select(type mask, type a, type b) {
+					return _mm256_blendv_pd(b, a, mask);
+				}
+				static unsigned movemask(type v) {
+					return static_cast<unsigned>(_mm256_movemask_pd(v));
+				}
+				static itype bits(type v) {
+					return _mm256_castpd_si256(v);
+				}
+				static type from_bits(itype v) {
+					return _mm256_castsi256_pd(v);
+				}
+				static itype iset1(long long x) {
+					return _mm256_set1_epi64x(x);
+				}
+				static itype iadd(itype a, itype b) {
+					return _mm256_add_epi64(a, b);
+				}
+				static itype iand(itype a, itype b) {
+					return _mm256_and_si256(a, b);
+				}
+				static itype ior(itype a, itype b) {
+					return _mm256_or_si256(a, b);
+				}
+				static itype shl(itype a, int n) {
+					return _mm256_slli_epi64(a, n);
+				}
+				static itype shr(itype a, int n) {
+					return _mm256_srli_epi64(a, n);
+				}
+				static type odd(itype n) {
+					return _mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_and_si256(n, _mm256_set1_epi64x(1)), _mm256_set1_epi64x(1)));
+				}
+				static type shift2(itype n) {
+					return _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_srli_epi64(_mm256_slli_epi64(n, 62), 63), 63));
+				}
+			};
+#	endif
+
+			//
+			// batch_round
+			//
+			//	Rounds |x| < 2^51 to the nearest integer by adding and subtracting
+			//	1.5 * 2^52; the sum (returned in n) holds the integer in its low bits.
+			//
+			template<typename Ops>
+			inline typename Ops::type
+			batch_round(typename Ops::type x, typename Ops::type& n) {
+				n = Ops::add(x, Ops::set1(6755399441055744.0));
+				return Ops::sub(n, Ops::set1(6755399441055744.0));
+			}
+			template<typename Ops>
+			inline typename Ops::type
+			batch_abs(typename Ops::type x) {
+				return Ops::andnot(Ops::set1(-0.0), x);
+			}
+
+			//
+			// batch_sin
+			// batch_cos
+			// batch_exp
+			// batch_log
+			// batch_sqrt
+			//
+			//	apply(x, special) is the vector kernel; the lanes set in special are
+			//	recomputed by scalar(x). The polynomials are those of the scalar code in
+			//	sprout/math; the vector kernels skip the Payne-Hanek reduction (|x| >= 2^20 * pi/2),
+			//	subnormal and overflowing results, and non-finite input.
+			//
+			template<typename Ops>
+			inline typename Ops::type
+			batch_sincos(typename Ops::type x, typename Ops::type& special, int offset) {
+				typedef typename Ops::type type;
+				special = Ops::nlt(sprout::math::detail::batch_abs<Ops>(x), Ops::set1(1647099.0));
+				type n;
+				type const fn = sprout::math::detail::batch_round<Ops>(Ops::mul(x, Ops::set1(6.36619772367581382433e-01)), n);
+				// Cody-Waite: x - fn * pi/2 as hi + lo
+				type const a = Ops::sub(x, Ops::mul(fn, Ops::set1(1.57079632673412561417e+00)));
+				type const w = Ops::mul(fn, Ops::set1(6.07710050630396597660e-11));
+				type const hi = Ops::sub(a, w);
+				type const lo = Ops::sub(Ops::sub(Ops::sub(a, hi), w), Ops::mul(fn, Ops::set1(2.02226624871116645580e-21)));
+				type const x2 = Ops::mul(hi, hi);
+				type const x3 = Ops::mul(x2, hi);
+				// sprout::math::detail::sinp(hi, lo)
+				type const sr = Ops::add(Ops::mul(Ops::add(Ops::mul(Ops::add(Ops::mul(Ops::add(Ops::mul(
+					Ops::set1(1.58962301576546568060e-10), x2),
+					Ops::set1(-2.50507477628578072866e-8)), x2),
+					Ops::set1(2.75573136213857245213e-6)), x2),
+					Ops::set1(-1.98412698295895385996e-4)), x2),
+					Ops::set1(8.33333333332211858878e-3)
+					);
+				type const s = Ops::sub(hi, Ops::add(
+					Ops::sub(Ops::mul(x2, Ops::sub(Ops::mul(Ops::set1(0.5), lo), Ops::mul(x3, sr))), lo),
+					Ops::mul(x3, Ops::set1(1.66666666666666307295e-1))
+					));
+				// sprout::math::detail::cosp(hi, lo)
+				type const cr = Ops::add(Ops::mul(Ops::add(Ops::mul(Ops::add(Ops::mul(Ops::add(Ops::mul(Ops::add(Ops::mul(
+					Ops::set1(-1.13585365213876817300e-11), x2),
+					Ops::set1(2.08757008419747316778e-9)), x2),
+					Ops::set1(-2.75573141792967388112e-7)), x2),
+					Ops::set1(2.48015872888517045348e-5)), x2),
+					Ops::set1(-1.38888888888730564116e-3)), x2),
+					Ops::set1(4.16666666666665929218e-2)
+					);
+				type const hx2 = Ops::mul(Ops::set1(0.5), x2);
+				type const cw = Ops::sub(Ops::set1(1), hx2);
+				type const c = Ops::add(cw, Ops::add(
+					Ops::sub(Ops::sub(Ops::set1(1), cw), hx2),
+					Ops::sub(Ops::mul(Ops::mul(x2, x2), cr), Ops::mul(hi, lo))
+					));
+				// quadrant n + offset: odd takes the other kernel, 2 and 3 negate
+				typename Ops::itype const q = Ops::iadd(Ops::bits(n), Ops::iset1(offset));
+				return Ops::xor_(Ops::select(Ops::odd(q), c, s), Ops::shift2(q));
+			}
+#endif
+			struct batch_sin {
+			public:
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+				template<typename Ops>
+				static typename Ops::type apply(typename Ops::type x, typename Ops::type& special) {
+					return sprout::math::detail::batch_sincos<Ops>(x, special, 0);
+				}
+#endif
+				template<typename T>
+				static SPROUT_CONSTEXPR T scalar(T x) {
+					return sprout::math::sin(x);
+				}
+			};
+			struct batch_cos {
+			public:
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+				template<typename Ops>
+				static typename Ops::type apply(typename Ops::type x, typename Ops::type& special) {
+					return sprout::math::detail::batch_sincos<Ops>(x, special, 1);
+				}
+#endif
+				template<typename T>
+				static SPROUT_CONSTEXPR T scalar(T x) {
+					return sprout::math::cos(x);
+				}
+			};
+			struct batch_exp {
+			public:
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+				template<typename Ops>
+				static typename Ops::type apply(typename Ops::type x, typename Ops::type& special) {
+					typedef typename Ops::type type;
+					// results stay normal, so 2^k can be built from its bits
+					special = Ops::nlt(sprout::math::detail::batch_abs<Ops>(x), Ops::set1(708.0));
+					type n;
+					type const k = sprout::math::detail::batch_round<Ops>(Ops::mul(x, Ops::set1(1.44269504088896338700e+00)), n);
+					type const hi = Ops::sub(x, Ops::mul(k, Ops::set1(6.93147180369123816490e-01)));
+					type const lo = Ops::mul(k, Ops::set1(1.90821492927058770002e-10));
+					type const r = Ops::sub(hi, lo);
+					type const r2 = Ops::mul(r, r);
+					type const c = Ops::sub(r, Ops::mul(r2, Ops::add(Ops::mul(Ops::add(Ops::mul(Ops::add(Ops::mul(Ops::add(Ops::mul(
+						Ops::set1(4.13813679705723846039e-08), r2),
+						Ops::set1(-1.65339022054652515390e-06)), r2),
+						Ops::set1(6.61375632143793436117e-05)), r2),
+						Ops::set1(-2.77777777770155933842e-03)), r2),
+						Ops::set1(1.66666666666666019037e-01)
+						)));
+					type const y = Ops::sub(Ops::set1(1), Ops::sub(
+						Ops::sub(lo, Ops::div(Ops::mul(r, c), Ops::sub(Ops::set1(2), c))),
+						hi
+						));
+					return Ops::mul(y, Ops::from_bits(Ops::shl(Ops::iadd(Ops::bits(n), Ops::iset1(1023)), 52)));
+				}
+#endif
+				template<typename T>
+				static SPROUT_CONSTEXPR T scalar(T x) {
+					return sprout::math::exp(x);
+				}
+			};
+			struct batch_log {
+			public:
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+				template<typename Ops>
+				static typename Ops::type apply(typename Ops::type x, typename Ops::type& special) {
+					typedef typename Ops::type type;
+					typedef typename Ops::itype itype;
+					// x <= 0, subnormal, infinity or NaN
+					special = Ops::or_(
+						Ops::nlt(x, Ops::set1(sprout::numeric_limits<double>::infinity())),
+						Ops::lt(x, Ops::set1(2.22507385850720138309e-308))
+						);
+					// x = 2^e * m, 1 <= m < 2, with e converted through the bits of 2^52 + e
+					itype const bits = Ops::bits(x);
+					type const e = Ops::sub(
+						Ops::from_bits(Ops::ior(Ops::shr(bits, 52), Ops::iset1(0x4330000000000000LL))),
+						Ops::set1(4503599627371519.0)
+						);
+					type const m = Ops::from_bits(Ops::ior(Ops::iand(bits, Ops::iset1(0x000FFFFFFFFFFFFFLL)), Ops::iset1(0x3FF0000000000000LL)));
+					type const big = Ops::lt(Ops::set1(1.41421356237309504880e+00), m);
+					type const f = Ops::sub(Ops::select(big, Ops::mul(m, Ops::set1(0.5)), m), Ops::set1(1));
+					type const k = Ops::add(e, Ops::and_(big, Ops::set1(1)));
+					type const s = Ops::div(f, Ops::add(Ops::set1(2), f));
+					type const z = Ops::mul(s, s);
+					type const w = Ops::mul(z, z);
+					type const t1 = Ops::mul(w, Ops::add(Ops::mul(w, Ops::add(Ops::mul(w,
+						Ops::set1(1.531383769920937332e-01)),
+						Ops::set1(2.222219843214978396e-01))),
+						Ops::set1(3.999999999940941908e-01)
+						));
+					type const t2 = Ops::mul(z, Ops::add(Ops::mul(w, Ops::add(Ops::mul(w, Ops::add(Ops::mul(w,
+						Ops::set1(1.479819860511658591e-01)),
+						Ops::set1(1.818357216161805012e-01))),
+						Ops::set1(2.857142874366239149e-01))),
+						Ops::set1(6.666666666666735130e-01)
+						));
+					type const hfsq = Ops::mul(Ops::mul(Ops::set1(0.5), f), f);
+					return Ops::sub(
+						Ops::mul(k, Ops::set1(6.93147180369123816490e-01)),
+						Ops::sub(
+							Ops::sub(hfsq, Ops::add(Ops::mul(s, Ops::add(hfsq, Ops::add(t2, t1))), Ops::mul(k, Ops::set1(1.90821492927058770002e-10)))),
+							f
+							)
+						);
+				}
+#endif
+				template<typename T>
+				static SPROUT_CONSTEXPR T scalar(T x) {
+					return sprout::math::log(x);
+				}
+			};
+			struct batch_sqrt {
+			public:
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+				template<typename Ops>
+				static typename Ops::type apply(typename Ops::type x, typename Ops::type& special) {
+					special = Ops::set1(0);
+					return Ops::sqrt(x);
+				}
+#endif
+				template<typename T>
+				static SPROUT_CONSTEXPR T scalar(T x) {
+					return sprout::math::sqrt(x);
+				}
+			};
+
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+			//
+			// batch_block
+			//
+			//	Processes whole blocks of Ops::width elements and advances first and
+			//	result past them; the caller finishes the tail.
+			//
+			template<typename Ops, typename Kernel, typename T>
+			inline void
+			batch_block(T const*& first, T const* last, T*& result) {
+				for (; last - first >= Ops::width; first += Ops::width, result += Ops::width) {
+					typename Ops::type special;
+					typename Ops::type const v = Kernel::template apply<Ops>(Ops::load(first), special);
+					// result may be first: the special lanes are computed before the store
+					unsigned const m = Ops::movemask(special);
+					T fix[Ops::width];
+					for (unsigned k = m; k != 0; k &= k - 1) {
+						fix[sprout::ctz(k)] = Kernel::scalar(first[sprout::ctz(k)]);
+					}
+					Ops::store(result, v);
+					for (unsigned k = m; k != 0; k &= k - 1) {
+						result[sprout::ctz(k)] = fix[sprout::ctz(k)];
+					}
+				}
+			}
+#endif
+
+			//
+			// batch_apply
+			//
+			//	Runtime counterpart of the scalar loops in sprout/math/batch.hpp; the
+			//	vector kernels take double and float arrays. result may be first.
+			//
+			template<typename Kernel, typename T>
+			inline T*
+			batch_apply(T const* first, T const* last, T* result) {
+				for (; first != last; ++first, ++result) {
+					*result = Kernel::scalar(*first);
+				}
+				return result;
+			}
+			template<typename Kernel, typename T>
+			inline T*
+			batch_apply_vector(T const* first, T const* last, T* result) {
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+#	if defined(SPROUT_DETAIL_SIMD_AVX2)
+				sprout::math::detail::batch_block<sprout::math::detail::batch_avx2, Kernel>(first, last, result);
+#	endif
+				sprout::math::detail::batch_block<sprout::math::detail::batch_sse2, Kernel>(first, last, result);
+#endif
+				for (; first != last; ++first, ++result) {
+					*result = Kernel::scalar(*first);
+				}
+				return result;
+			}
+			template<typename Kernel>
+			inline double*
+			batch_apply(double const* first, double const* last, double* result) {
+				return sprout::math::detail::batch_apply_vector<Kernel>(first, last, result);
+			}
+			template<typename Kernel>
+			inline float*
+			batch_apply(float const* first, float const* last, float* result) {
+				return sprout::math::detail::batch_apply_vector<Kernel>(first, last, result);
+			}
+		}	// namespace detail
+	}	// namespace math
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_MATH_DETAIL_BATCH_HPP
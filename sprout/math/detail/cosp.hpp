@@ -32,6 +32,33 @@ namespace sprout {
 			cosp(T x) {
 				return sprout::math::detail::cosp_impl(x * x);
 			}
+
+			//
+			// cos(x + y) for |x + y| <= pi/4, y the tail of an argument reduction;
+			// 1 - x^2/2 is summed with its rounding error
+			//
+			template<typename T>
+			inline SPROUT_CONSTEXPR T
+			cosp_r(T x2) {
+				return (((((
+					-1.13585365213876817300e-11) * x2
+					+ 2.08757008419747316778e-9) * x2
+					- 2.75573141792967388112e-7) * x2
+					+ 2.48015872888517045348e-5) * x2
+					- 1.38888888888730564116e-3) * x2
+					+ 4.16666666666665929218e-2
+					;
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR T
+			cosp_impl(T x, T y, T x2, T hx2, T w) {
+				return w + (((T(1) - w) - hx2) + (x2 * x2 * sprout::math::detail::cosp_r(x2) - x * y));
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR T
+			cosp(T x, T y) {
+				return sprout::math::detail::cosp_impl(x, y, x * x, T(0.5) * (x * x), T(1) - T(0.5) * (x * x));
+			}
 		}	// namespace detail
 	}	// namespace math
 }	// namespace sprout
@@ -0,0 +1,98 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_MATH_DETAIL_EXPONENT2_HPP
+#define SPROUT_MATH_DETAIL_EXPONENT2_HPP
+
+#include <sprout/config.hpp>
+#include <sprout/limits.hpp>
+#include <sprout/detail/pow.hpp>
+
+namespace sprout {
+	namespace math {
+		namespace detail {
+			//
+			// normalized2
+			//
+			//	x = significand * 2^exponent with 1 <= significand < 2.
+			//
+			template<typename T>
+			struct normalized2 {
+			public:
+				T significand;
+				int exponent;
+			public:
+				SPROUT_CONSTEXPR normalized2(T significand_, int exponent_)
+					: significand(significand_), exponent(exponent_)
+				{}
+			};
+
+			//
+			// normalize2
+			// exponent2
+			//
+			//	For finite x > 0, without going through log, so that the elementary
+			//	functions can use them. The powers 2^s, s = 1, 2, 4, ..., are squared on
+			//	the way up and divided or multiplied out of x on the way back, largest
+			//	first; subnormals are scaled into the normal range beforehand.
+			//
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::normalized2<T>
+			normalize2_down(sprout::math::detail::normalized2<T> const& r, int s, T p) {
+				return !(r.significand < p) ? sprout::math::detail::normalized2<T>(r.significand / p, r.exponent + s)
+					: r.significand * p < 1 ? sprout::math::detail::normalized2<T>(r.significand * p, r.exponent - s)
+					: r
+					;
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::normalized2<T>
+			normalize2_up(T x, int s, T p) {
+				return s > sprout::numeric_limits<T>::max_exponent / 4
+					? sprout::math::detail::normalize2_down(sprout::math::detail::normalized2<T>(x, 0), s, p)
+					: sprout::math::detail::normalize2_down(sprout::math::detail::normalize2_up(x, s * 2, p * p), s, p)
+					;
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::normalized2<T>
+			normalize2_impl(sprout::math::detail::normalized2<T> const& r, int bias) {
+				return r.significand < 1 ? sprout::math::detail::normalized2<T>(r.significand * 2, r.exponent - 1 - bias)
+					: sprout::math::detail::normalized2<T>(r.significand, r.exponent - bias)
+					;
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::normalized2<T>
+			normalize2(T x) {
+				return x < sprout::numeric_limits<T>::min()
+					? sprout::math::detail::normalize2_impl(
+						sprout::math::detail::normalize2_up(x * sprout::detail::pow_n(T(2), sprout::numeric_limits<T>::digits), 1, T(2)),
+						sprout::numeric_limits<T>::digits
+						)
+					: sprout::math::detail::normalize2_impl(sprout::math::detail::normalize2_up(x, 1, T(2)), 0)
+					;
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR int
+			exponent2(T x) {
+				return sprout::math::detail::normalize2(x).exponent;
+			}
+
+			//
+			// scale2
+			//
+			//	x * 2^e in two steps, so that neither power of two overflows and a
+			//	subnormal result is rounded once.
+			//
+			template<typename T>
+			inline SPROUT_CONSTEXPR T
+			scale2(T x, int e) {
+				return x * sprout::detail::pow_n(T(2), e / 2) * sprout::detail::pow_n(T(2), e - e / 2);
+			}
+		}	// namespace detail
+	}	// namespace math
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_MATH_DETAIL_EXPONENT2_HPP
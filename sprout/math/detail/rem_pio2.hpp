@@ -0,0 +1,276 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_MATH_DETAIL_REM_PIO2_HPP
+#define SPROUT_MATH_DETAIL_REM_PIO2_HPP
+
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/cstdint.hpp>
+#include <sprout/detail/pow.hpp>
+#include <sprout/math/constants.hpp>
+#include <sprout/math/fmod.hpp>
+#include <sprout/math/detail/exponent2.hpp>
+#include <sprout/math/detail/two_sum.hpp>
+#include <sprout/utility/pair/pair.hpp>
+
+namespace sprout {
+	namespace math {
+		namespace detail {
+			//
+			// rem_pio2_result
+			//
+			//	x = n * pi/2 + (hi + lo) with |hi + lo| <= pi/4 (slightly more for huge x),
+			//	n taken modulo 4.
+			//
+			template<typename T>
+			struct rem_pio2_result {
+			public:
+				int n;
+				T hi;
+				T lo;
+			public:
+				SPROUT_CONSTEXPR rem_pio2_result(int n_, T hi_, T lo_)
+					: n(n_), hi(hi_), lo(lo_)
+				{}
+			};
+
+			//
+			// Cody-Waite: pi/2 in three 33-bit parts and a tail, so that fn * part is
+			// exact for fn < 2^20.
+			//
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::rem_pio2_result<T>
+			rem_pio2_medium_3(int n, sprout::math::detail::double_word<T> const& r) {
+				return sprout::math::detail::rem_pio2_result<T>(n, r.hi, r.lo);
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::rem_pio2_result<T>
+			rem_pio2_medium_2(int n, sprout::math::detail::double_word<T> const& r, T tail) {
+				return sprout::math::detail::rem_pio2_medium_3(n, sprout::math::detail::two_sum(r.hi, r.lo + tail));
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::rem_pio2_result<T>
+			rem_pio2_medium(T x, T fn) {
+				return sprout::math::detail::rem_pio2_medium_2(
+					static_cast<int>(static_cast<std::int64_t>(fn) & 3),
+					sprout::math::detail::two_sum(x - fn * T(1.57079632673412561417e+00), -(fn * T(6.07710050630396597660e-11))),
+					-(fn * T(2.02226624871116645580e-21)) - fn * T(8.47842766036889956997e-32)
+					);
+			}
+
+			//
+			// Payne-Hanek: 2/pi in 24-bit digits, enough for any double.
+			//
+			SPROUT_STATIC_CONSTEXPR std::size_t two_over_pi_size = 80;
+			SPROUT_STATIC_CONSTEXPR std::int_least32_t two_over_pi[sprout::math::detail::two_over_pi_size] = {
+				0xA2F983, 0x6E4E44, 0x1529FC, 0x2757D1, 0xF534DD, 0xC0DB62, 0x95993C, 0x439041,
+				0xFE5163, 0xABDEBB, 0xC561B7, 0x246E3A, 0x424DD2, 0xE00649, 0x2EEA09, 0xD1921C,
+				0xFE1DEB, 0x1CB129, 0xA73EE8, 0x8235F5, 0x2EBB44, 0x84E99C, 0x7026B4, 0x5F7E41,
+				0x3991D6, 0x398353, 0x39F49C, 0x845F8B, 0xBDF928, 0x3B1FF8, 0x97FFDE, 0x05980F,
+				0xEF2F11, 0x8B5A0A, 0x6D1F6D, 0x367ECF, 0x27CB09, 0xB74F46, 0x3F669E, 0x5FEA2D,
+				0x7527BA, 0xC7EBE5, 0xF17B3D, 0x0739F7, 0x8A5292, 0xEA6BFB, 0x5FB11F, 0x8D5D08,
+				0x560330, 0x46FC7B, 0x6BABF0, 0xCFBC20, 0x9AF436, 0x1DA9E3, 0x91615E, 0xE61B08,
+				0x659985, 0x5F14A0, 0x68408D, 0xFFD880, 0x4D7327, 0x310606, 0x1556CA, 0x73A8C9,
+				0x60E27B, 0xC08C6B, 0x47C419, 0xC367CD, 0xDCE809, 0x2A8359, 0xC4768B, 0x961CA6,
+				0xDDAF44, 0xD15719, 0x053EA5, 0xFF0705, 0x3F7E33, 0xE832C2, 0xDE4F98, 0x327DBB
+			};
+			// 24-bit digits of the fraction kept below the binary point
+			SPROUT_STATIC_CONSTEXPR int rem_pio2_digits = 9;
+
+			// x = (x0 + x1 / 2^24 + x2 / 2^48) * 2^e0; digit s of x * 2/pi weighs 2^(e0 - 24s)
+			inline SPROUT_CONSTEXPR std::int64_t
+			two_over_pi_at(int i) {
+				return i >= 0 && i < static_cast<int>(sprout::math::detail::two_over_pi_size)
+					? sprout::math::detail::two_over_pi[i]
+					: 0
+					;
+			}
+			inline SPROUT_CONSTEXPR std::int64_t
+			rem_pio2_term(std::int64_t x0, std::int64_t x1, std::int64_t x2, int s) {
+				return x0 * sprout::math::detail::two_over_pi_at(s - 1)
+					+ x1 * sprout::math::detail::two_over_pi_at(s - 2)
+					+ x2 * sprout::math::detail::two_over_pi_at(s - 3)
+					;
+			}
+			inline SPROUT_CONSTEXPR std::int64_t
+			rem_pio2_carry(std::int64_t x0, std::int64_t x1, std::int64_t x2, int s, int last) {
+				return s > last ? 0
+					: (sprout::math::detail::rem_pio2_term(x0, x1, x2, s) + sprout::math::detail::rem_pio2_carry(x0, x1, x2, s + 1, last)) >> 24
+					;
+			}
+			// digit 0 holds everything carried out of digit 1
+			inline SPROUT_CONSTEXPR std::int64_t
+			rem_pio2_digit(std::int64_t x0, std::int64_t x1, std::int64_t x2, int s, int last) {
+				return s < 0 || s > last ? 0
+					: s == 0 ? sprout::math::detail::rem_pio2_carry(x0, x1, x2, 1, last)
+					: (sprout::math::detail::rem_pio2_term(x0, x1, x2, s) + sprout::math::detail::rem_pio2_carry(x0, x1, x2, s + 1, last)) & 0xFFFFFF
+					;
+			}
+
+			//
+			// The digits of the product from the one holding the binary point: point is
+			// that digit's index, shift the bit position of 2^0 in it. Digit t of the
+			// fraction weighs 2^(-shift - 24t); complement gives those of 1 - fraction.
+			//
+			template<typename T>
+			class rem_pio2_digits_of {
+			public:
+				std::int64_t x0;
+				std::int64_t x1;
+				std::int64_t x2;
+				int point;
+				int shift;
+				bool complement;
+			public:
+				SPROUT_CONSTEXPR rem_pio2_digits_of(std::int64_t x0_, std::int64_t x1_, std::int64_t x2_, int point_, int shift_, bool complement_)
+					: x0(x0_), x1(x1_), x2(x2_), point(point_), shift(shift_), complement(complement_)
+				{}
+				SPROUT_CONSTEXPR std::int64_t digit(int s) const {
+					return sprout::math::detail::rem_pio2_digit(x0, x1, x2, s, point + sprout::math::detail::rem_pio2_digits);
+				}
+				SPROUT_CONSTEXPR int integer() const {
+					return static_cast<int>(((digit(point) >> shift) + (digit(point - 1) << (24 - shift))) & 3);
+				}
+				SPROUT_CONSTEXPR std::int64_t fraction_mask(int t) const {
+					return t == 0 ? (std::int64_t(1) << shift) - 1 : 0xFFFFFF;
+				}
+				SPROUT_CONSTEXPR std::int64_t fraction(int t) const {
+					return t > sprout::math::detail::rem_pio2_digits ? 0
+						: complement ? fraction_mask(t) - (digit(point + t) & fraction_mask(t))
+						: digit(point + t) & fraction_mask(t)
+						;
+				}
+				SPROUT_CONSTEXPR T weight(int t) const {
+					return sprout::detail::pow_n(T(2), -(shift + 24 * t));
+				}
+				SPROUT_CONSTEXPR T approximate() const {
+					return T(fraction(0)) * weight(0) + T(fraction(1)) * weight(1) + T(fraction(2)) * weight(2);
+				}
+				SPROUT_CONSTEXPR int leading(int t) const {
+					return t >= sprout::math::detail::rem_pio2_digits || fraction(t) != 0 ? t
+						: leading(t + 1)
+						;
+				}
+				// two digits starting at t, exactly
+				SPROUT_CONSTEXPR T pair_at(int t) const {
+					return (T(fraction(t)) * T(16777216) + T(fraction(t + 1))) * weight(t + 1);
+				}
+			};
+
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::rem_pio2_result<T>
+			rem_pio2_large_4(int n, bool negative, sprout::math::detail::double_word<T> const& r) {
+				return negative ? sprout::math::detail::rem_pio2_result<T>(n, -r.hi, -r.lo)
+					: sprout::math::detail::rem_pio2_result<T>(n, r.hi, r.lo)
+					;
+			}
+			// (hi + lo) * pi/2
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::double_word<T>
+			mul_pio2(sprout::math::detail::double_word<T> const& f, sprout::math::detail::double_word<T> const& p) {
+				return sprout::math::detail::fast_two_sum(
+					p.hi,
+					p.lo + f.hi * T(6.12323399573676603587e-17) + f.lo * T(1.57079632679489655800e+00)
+					);
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::rem_pio2_result<T>
+			rem_pio2_large_3(int n, bool negative, sprout::math::detail::double_word<T> const& f, T c) {
+				return sprout::math::detail::rem_pio2_large_4(
+					n, negative,
+					sprout::math::detail::mul_pio2(
+						sprout::math::detail::double_word<T>(f.hi, f.lo + c),
+						sprout::math::detail::two_product(f.hi, T(1.57079632679489655800e+00))
+						)
+					);
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::rem_pio2_result<T>
+			rem_pio2_large_2(sprout::math::detail::rem_pio2_digits_of<T> const& d, int t) {
+				return sprout::math::detail::rem_pio2_large_3(
+					(d.integer() + (d.complement ? 1 : 0)) & 3, d.complement,
+					sprout::math::detail::fast_two_sum(d.pair_at(t), d.pair_at(t + 2)),
+					d.pair_at(t + 4)
+					);
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::rem_pio2_result<T>
+			rem_pio2_large_1(sprout::math::detail::rem_pio2_digits_of<T> const& d) {
+				return d.approximate() < T(0.5) ? sprout::math::detail::rem_pio2_large_2(d, d.leading(0))
+					: sprout::math::detail::rem_pio2_large_2(
+						sprout::math::detail::rem_pio2_digits_of<T>(d.x0, d.x1, d.x2, d.point, d.shift, true),
+						sprout::math::detail::rem_pio2_digits_of<T>(d.x0, d.x1, d.x2, d.point, d.shift, true).leading(0)
+						)
+					;
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::rem_pio2_result<T>
+			rem_pio2_large_0(std::int64_t x0, T z1, int e0, int point) {
+				return sprout::math::detail::rem_pio2_large_1(sprout::math::detail::rem_pio2_digits_of<T>(
+					x0,
+					static_cast<std::int64_t>(z1),
+					static_cast<std::int64_t>((z1 - static_cast<T>(static_cast<std::int64_t>(z1))) * T(16777216)),
+					point, 24 * point - e0, false
+					));
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::rem_pio2_result<T>
+			rem_pio2_large(T z, int e0) {
+				return sprout::math::detail::rem_pio2_large_0(
+					static_cast<std::int64_t>(z),
+					(z - static_cast<T>(static_cast<std::int64_t>(z))) * T(16777216),
+					e0,
+					e0 <= 0 ? 0 : (e0 + 23) / 24
+					);
+			}
+
+			//
+			// rem_pio2
+			//
+			//	Reduces finite x: nothing to do up to pi/4, Cody-Waite below 2^20 * pi/2,
+			//	Payne-Hanek above. Beyond the 2/pi table (only formats wider than double
+			//	get there) it falls back to fmod by 2pi.
+			//
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::rem_pio2_result<T>
+			rem_pio2_positive(T x);
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::rem_pio2_result<T>
+			rem_pio2_huge(T x, int e) {
+				return e / 24 + sprout::math::detail::rem_pio2_digits + 3 < static_cast<int>(sprout::math::detail::two_over_pi_size)
+					? sprout::math::detail::rem_pio2_large(sprout::math::detail::scale2(x, 23 - e), e - 23)
+					: sprout::math::detail::rem_pio2_positive(sprout::math::fmod(x, sprout::math::two_pi<T>()))
+					;
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::rem_pio2_result<T>
+			rem_pio2_positive(T x) {
+				return x <= sprout::math::quarter_pi<T>() ? sprout::math::detail::rem_pio2_result<T>(0, x, T(0))
+					: x < T(1647099) ? sprout::math::detail::rem_pio2_medium(
+						x, static_cast<T>(static_cast<std::int64_t>(x * T(6.36619772367581382433e-01) + T(0.5)))
+						)
+					: sprout::math::detail::rem_pio2_huge(x, sprout::math::detail::exponent2(x))
+					;
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::rem_pio2_result<T>
+			rem_pio2_negate(sprout::math::detail::rem_pio2_result<T> const& r) {
+				return sprout::math::detail::rem_pio2_result<T>(-r.n & 3, -r.hi, -r.lo);
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::rem_pio2_result<T>
+			rem_pio2(T x) {
+				return x < 0 ? sprout::math::detail::rem_pio2_negate(sprout::math::detail::rem_pio2_positive(-x))
+					: sprout::math::detail::rem_pio2_positive(x)
+					;
+			}
+		}	// namespace detail
+	}	// namespace math
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_MATH_DETAIL_REM_PIO2_HPP
@@ -30,6 +30,31 @@ namespace sprout {
 			sinp(T x) {
 				return sprout::math::detail::sinp_impl(x, x * x);
 			}
+
+			//
+			// sin(x + y) for |x + y| <= pi/4, y the tail of an argument reduction
+			//
+			template<typename T>
+			inline SPROUT_CONSTEXPR T
+			sinp_r(T x2) {
+				return ((((
+					1.58962301576546568060e-10) * x2
+					- 2.50507477628578072866e-8) * x2
+					+ 2.75573136213857245213e-6) * x2
+					- 1.98412698295895385996e-4) * x2
+					+ 8.33333333332211858878e-3
+					;
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR T
+			sinp_impl(T x, T y, T x2, T x3) {
+				return x - ((x2 * (T(0.5) * y - x3 * sprout::math::detail::sinp_r(x2)) - y) + x3 * T(1.66666666666666307295e-1));
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR T
+			sinp(T x, T y) {
+				return sprout::math::detail::sinp_impl(x, y, x * x, x * x * x);
+			}
 		}	// namespace detail
 	}	// namespace math
 }	// namespace sprout
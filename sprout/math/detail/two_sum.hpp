@@ -0,0 +1,105 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_MATH_DETAIL_TWO_SUM_HPP
+#define SPROUT_MATH_DETAIL_TWO_SUM_HPP
+
+#include <sprout/config.hpp>
+#include <sprout/limits.hpp>
+#include <sprout/detail/pow.hpp>
+#include <sprout/utility/pair/pair.hpp>
+
+namespace sprout {
+	namespace math {
+		namespace detail {
+			//
+			// double_word
+			//
+			//	An unevaluated sum hi + lo with |lo| <= ulp(hi) / 2. Not sprout::pair,
+			//	whose forwarding constructor costs several times more steps to build in
+			//	a constant expression.
+			//
+			template<typename T>
+			struct double_word {
+			public:
+				T hi;
+				T lo;
+			public:
+				SPROUT_CONSTEXPR double_word(T hi_, T lo_)
+					: hi(hi_), lo(lo_)
+				{}
+			};
+
+			//
+			// two_sum
+			// fast_two_sum
+			// two_product
+			//
+			//	Error-free transformations: hi the rounded result and hi + lo the exact
+			//	one. fast_two_sum requires |a| >= |b|.
+			//
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::double_word<T>
+			two_sum_impl(T a, T b, T s, T bb) {
+				return sprout::math::detail::double_word<T>(s, (a - (s - bb)) + (b - bb));
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::double_word<T>
+			two_sum_impl(T a, T b, T s) {
+				return sprout::math::detail::two_sum_impl(a, b, s, s - a);
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::double_word<T>
+			two_sum(T a, T b) {
+				return sprout::math::detail::two_sum_impl(a, b, a + b);
+			}
+
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::double_word<T>
+			fast_two_sum_impl(T a, T b, T s) {
+				return sprout::math::detail::double_word<T>(s, b - (s - a));
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::double_word<T>
+			fast_two_sum(T a, T b) {
+				return sprout::math::detail::fast_two_sum_impl(a, b, a + b);
+			}
+
+			// Dekker's split into two halves of digits / 2 bits
+			template<typename T>
+			inline SPROUT_CONSTEXPR T
+			split_factor() {
+				return sprout::detail::pow_n(T(2), (sprout::numeric_limits<T>::digits + 1) / 2) + 1;
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::double_word<T>
+			split_impl(T a, T c) {
+				return sprout::math::detail::double_word<T>(c - (c - a), a - (c - (c - a)));
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::double_word<T>
+			split(T a) {
+				return sprout::math::detail::split_impl(a, sprout::math::detail::split_factor<T>() * a);
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::double_word<T>
+			two_product_impl(sprout::math::detail::double_word<T> const& a, sprout::math::detail::double_word<T> const& b, T p) {
+				return sprout::math::detail::double_word<T>(
+					p,
+					((a.hi * b.hi - p) + a.hi * b.lo + a.lo * b.hi) + a.lo * b.lo
+					);
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::double_word<T>
+			two_product(T a, T b) {
+				return sprout::math::detail::two_product_impl(sprout::math::detail::split(a), sprout::math::detail::split(b), a * b);
+			}
+		}	// namespace detail
+	}	// namespace math
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_MATH_DETAIL_TWO_SUM_HPP
@@ -10,13 +10,11 @@
 
 #include <type_traits>
 #include <sprout/config.hpp>
-#include <sprout/workaround/std/cstddef.hpp>
 #include <sprout/limits.hpp>
-#include <sprout/detail/pow.hpp>
 #include <sprout/math/detail/config.hpp>
 #include <sprout/math/detail/float_compute.hpp>
+#include <sprout/math/detail/exponent2.hpp>
 #include <sprout/math/isnan.hpp>
-#include <sprout/math/factorial.hpp>
 #include <sprout/type_traits/enabler_if.hpp>
 
 namespace sprout {
@@ -37,21 +35,56 @@ namespace sprout {
 			}
 #endif
 
+			//
+			// exp(x + tail) as 2^k * exp(r), r = x + tail - k * ln2 with ln2 in two parts
+			// so that k * ln2_hi is exact; exp(r) by the rational form of a minimax
+			// polynomial in r^2.
+			//
 			template<typename T>
 			inline SPROUT_CONSTEXPR T
-			exp_impl_1(T x, std::size_t n, std::size_t last) {
-				return last - n == 1
-					? sprout::detail::pow_n(x, n) / sprout::math::unchecked_factorial<T>(n)
-					: sprout::math::detail::exp_impl_1(x, n, n + (last - n) / 2)
-						+ sprout::math::detail::exp_impl_1(x, n + (last - n) / 2, last)
+			exp_impl_3(T hi, T lo, T r, T c, int k) {
+				return sprout::math::detail::scale2(T(1) - ((lo - (r * c) / (T(2) - c)) - hi), k);
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR T
+			exp_impl_2(T hi, T lo, T r, int k) {
+				return sprout::math::detail::exp_impl_3(
+					hi, lo, r,
+					r - r * r * ((((
+						4.13813679705723846039e-08 * (r * r)
+						- 1.65339022054652515390e-06) * (r * r)
+						+ 6.61375632143793436117e-05) * (r * r)
+						- 2.77777777770155933842e-03) * (r * r)
+						+ 1.66666666666666019037e-01
+						),
+					k
+					);
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR T
+			exp_impl_1(T x, T tail, T k) {
+				return sprout::math::detail::exp_impl_2(
+					x - k * T(6.93147180369123816490e-01),
+					k * T(1.90821492927058770002e-10) - tail,
+					(x - k * T(6.93147180369123816490e-01)) - (k * T(1.90821492927058770002e-10) - tail),
+					static_cast<int>(k)
+					);
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR T
+			exp_impl(T x, T tail) {
+				return x > T(sprout::numeric_limits<T>::max_exponent) ? sprout::numeric_limits<T>::infinity()
+					: x < T(sprout::numeric_limits<T>::min_exponent - sprout::numeric_limits<T>::digits) ? T(0)
+					: sprout::math::detail::exp_impl_1(
+						x, tail,
+						static_cast<T>(static_cast<int>(x * T(1.44269504088896338700e+00) + (x < 0 ? T(-0.5) : T(0.5))))
+						)
 					;
 			}
 			template<typename T>
 			inline SPROUT_CONSTEXPR T
 			exp_impl(T x) {
-				return !(x > -1) ? T(1) / (T(1) + sprout::math::detail::exp_impl_1(-x, 1, sprout::math::factorial_limit<T>() / 2 + 1))
-					: T(1) + sprout::math::detail::exp_impl_1(x, 1, sprout::math::factorial_limit<T>() / 2 + 1)
-					;
+				return sprout::math::detail::exp_impl(x, T(0));
 			}
 		}	// namespace detail
 		//
@@ -10,15 +10,13 @@
 
 #include <type_traits>
 #include <sprout/config.hpp>
-#include <sprout/workaround/std/cstddef.hpp>
 #include <sprout/limits.hpp>
-#include <sprout/detail/pow.hpp>
 #include <sprout/math/detail/config.hpp>
 #include <sprout/math/detail/float_compute.hpp>
+#include <sprout/math/detail/exponent2.hpp>
+#include <sprout/math/detail/two_sum.hpp>
 #include <sprout/math/constants.hpp>
 #include <sprout/math/isnan.hpp>
-#include <sprout/math/factorial.hpp>
-#include <sprout/math/sqrt.hpp>
 #include <sprout/type_traits/enabler_if.hpp>
 
 namespace sprout {
@@ -39,30 +37,131 @@ namespace sprout {
 			}
 #endif
 
+			//
+			// x = 2^k * (1 + f) with sqrt(1/2) <= 1 + f < sqrt(2); log(1 + f) = 2 atanh(s),
+			// s = f / (2 + f), with a minimax polynomial R in s^2:
+			//	log(x) = k * ln2 + f - f^2/2 + s * (f^2/2 + R(s^2))
+			// ln2 is split so that k * ln2_hi is exact.
+			//
 			template<typename T>
 			inline SPROUT_CONSTEXPR T
-			log_impl_2(T x, std::size_t n, std::size_t last) {
-				return last - n == 1
-					? (n % 2 ? 1 : -1) * sprout::detail::pow_n(x, n) / n
-					: sprout::math::detail::log_impl_2(x, n, n + (last - n) / 2)
-						+ sprout::math::detail::log_impl_2(x, n + (last - n) / 2, last)
+			log_r(T z) {
+				return z * (6.666666666666735130e-01 + z * z * (2.857142874366239149e-01 + z * z * (1.818357216161805012e-01 + z * z * 1.479819860511658591e-01)))
+					+ z * z * (3.999999999940941908e-01 + z * z * (2.222219843214978396e-01 + z * z * 1.531383769920937332e-01))
 					;
 			}
 			template<typename T>
 			inline SPROUT_CONSTEXPR T
-			log_impl_1(T x) {
-				return !(x > sprout::math::root_two<T>())
-					? sprout::math::detail::log_impl_2(x - T(1), 1, sprout::math::factorial_limit<T>() + 1)
-					: T(2) * sprout::math::detail::log_impl_1(sprout::math::sqrt(x))
+			log_impl_2(T f, T k, T s, T hfsq) {
+				return k * T(6.93147180369123816490e-01)
+					- ((hfsq - (s * (hfsq + sprout::math::detail::log_r(s * s)) + k * T(1.90821492927058770002e-10))) - f)
 					;
 			}
 			template<typename T>
 			inline SPROUT_CONSTEXPR T
+			log_impl_1(T f, T k) {
+				return sprout::math::detail::log_impl_2(f, k, f / (T(2) + f), T(0.5) * f * f);
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR T
+			log_impl_0(T m, int k) {
+				return m > sprout::math::root_two<T>() ? sprout::math::detail::log_impl_1(m / 2 - 1, T(k + 1))
+					: sprout::math::detail::log_impl_1(m - 1, T(k))
+					;
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR T
+			log_impl(sprout::math::detail::normalized2<T> const& x) {
+				return sprout::math::detail::log_impl_0(x.significand, x.exponent);
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR T
 			log_impl(T x) {
-				return x < 1 ? -sprout::math::detail::log_impl_1(T(1) / x)
-					: sprout::math::detail::log_impl_1(x)
+				return sprout::math::detail::log_impl(sprout::math::detail::normalize2(x));
+			}
+
+			//
+			// log_pair
+			//
+			//	log(x) as an unevaluated sum hi + lo, good to about 2^-62 relative: the
+			//	terms of the formula above are added without rounding the leading ones,
+			//	and s and f^2 carry their rounding errors (sl, f2.lo).
+			//
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::double_word<T>
+			log_pair_6(sprout::math::detail::double_word<T> const& c, T rest) {
+				return sprout::math::detail::fast_two_sum(c.hi, c.lo + rest);
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::double_word<T>
+			log_pair_5(T k, sprout::math::detail::double_word<T> const& b, T rest) {
+				return sprout::math::detail::log_pair_6(
+					sprout::math::detail::two_sum(k * T(6.93147180369123816490e-01), b.hi),
+					b.lo + rest
+					);
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::double_word<T>
+			log_pair_4(T k, sprout::math::detail::double_word<T> const& a, sprout::math::detail::double_word<T> const& t, T rest) {
+				return sprout::math::detail::log_pair_5(
+					k,
+					sprout::math::detail::two_sum(a.hi, t.hi),
+					a.lo + (t.lo + rest)
+					);
+			}
+			// f - f^2/2 + s * w + k * ln2_lo, w = f^2/2 + R(s^2)
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::double_word<T>
+			log_pair_3(T f, T k, T s, T sl, sprout::math::detail::double_word<T> const& f2, sprout::math::detail::double_word<T> const& w) {
+				return sprout::math::detail::log_pair_4(
+					k,
+					sprout::math::detail::two_sum(f, -f2.hi / 2),
+					sprout::math::detail::two_product(s, w.hi),
+					((s * w.lo + sl * w.hi) + (s - 1) * f2.lo / 2) + k * T(1.90821492927058770002e-10)
+					);
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::double_word<T>
+			log_pair_2(T f, T k, T s, T sl, sprout::math::detail::double_word<T> const& f2) {
+				return sprout::math::detail::log_pair_3(
+					f, k, s, sl, f2,
+					sprout::math::detail::two_sum(f2.hi / 2, sprout::math::detail::log_r(s * s))
+					);
+			}
+			// s = f / (2 + f) and its rounding error sl
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::double_word<T>
+			log_pair_1(T f, T k, T s, sprout::math::detail::double_word<T> const& d, sprout::math::detail::double_word<T> const& sd) {
+				return sprout::math::detail::log_pair_2(
+					f, k, s,
+					(((f - sd.hi) - sd.lo) - s * d.lo) / d.hi,
+					sprout::math::detail::two_product(f, f)
+					);
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::double_word<T>
+			log_pair_0(T f, T k, sprout::math::detail::double_word<T> const& d) {
+				return sprout::math::detail::log_pair_1(f, k, f / d.hi, d, sprout::math::detail::two_product(f / d.hi, d.hi));
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::double_word<T>
+			log_pair(sprout::math::detail::normalized2<T> const& x) {
+				return x.significand > sprout::math::root_two<T>()
+					? sprout::math::detail::log_pair_0(
+						x.significand / 2 - 1, T(x.exponent + 1),
+						sprout::math::detail::two_sum(T(2), x.significand / 2 - 1)
+						)
+					: sprout::math::detail::log_pair_0(
+						x.significand - 1, T(x.exponent),
+						sprout::math::detail::two_sum(T(2), x.significand - 1)
+						)
 					;
 			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR sprout::math::detail::double_word<T>
+			log_pair(T x) {
+				return sprout::math::detail::log_pair(sprout::math::detail::normalize2(x));
+			}
 		}	// namespace detail
 		//
 		// log
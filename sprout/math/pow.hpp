@@ -12,6 +12,7 @@
 #include <sprout/config.hpp>
 #include <sprout/limits.hpp>
 #include <sprout/math/detail/config.hpp>
+#include <sprout/math/detail/two_sum.hpp>
 #include <sprout/math/constants.hpp>
 #include <sprout/math/isnan.hpp>
 #include <sprout/math/copysign.hpp>
@@ -41,13 +42,37 @@ namespace sprout {
 			}
 #endif
 
+			//
+			// exp(y * log(x)) for x > 0, with log(x) and the product kept as hi + lo
+			// so that the rounding of log(x) is not multiplied by y
+			//
+			template<typename T>
+			inline SPROUT_CONSTEXPR T
+			pow_positive_2(sprout::math::detail::double_word<T> const& p) {
+				return sprout::math::detail::exp_impl(p.hi, p.lo);
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR T
+			pow_positive_1(T y, sprout::math::detail::double_word<T> const& l, T p) {
+				return !(p < T(2048) && p > T(-2048)) ? sprout::math::detail::exp_impl(p)
+					: sprout::math::detail::pow_positive_2(sprout::math::detail::fast_two_sum(
+						sprout::math::detail::two_product(y, l.hi).hi,
+						sprout::math::detail::two_product(y, l.hi).lo + y * l.lo
+						))
+					;
+			}
+			template<typename T>
+			inline SPROUT_CONSTEXPR T
+			pow_positive(T x, T y) {
+				return sprout::math::detail::pow_positive_1(y, sprout::math::detail::log_pair(x), y * sprout::math::detail::log_pair(x).hi);
+			}
 			template<typename T>
 			inline SPROUT_CONSTEXPR T
 			pow_impl(T x, T y) {
 				return x < 0
-						? is_odd(y) ? -sprout::math::exp(y * sprout::math::log(-x))
-						: sprout::math::exp(y * sprout::math::log(-x))
-					: sprout::math::exp(y * sprout::math::log(x))
+						? sprout::math::is_odd(y) ? -sprout::math::detail::pow_positive(-x, y)
+						: sprout::math::detail::pow_positive(-x, y)
+					: sprout::math::detail::pow_positive(x, y)
 					;
 			}
 		}	// namespace detail
@@ -20,5 +20,6 @@
 #include <sprout/math/quaternion/container.hpp>
 #include <sprout/math/quaternion/literals.hpp>
 #include <sprout/math/quaternion/type_traits.hpp>
+#include <sprout/math/quaternion/soa.hpp>
 
 #endif	// #ifndef SPROUT_MATH_QUATERNION_HPP
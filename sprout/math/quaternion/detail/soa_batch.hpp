@@ -0,0 +1,146 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_MATH_QUATERNION_DETAIL_SOA_BATCH_HPP
+#define SPROUT_MATH_QUATERNION_DETAIL_SOA_BATCH_HPP
+
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/math/sqrt.hpp>
+#include <sprout/complex/detail/soa_batch.hpp>
+#include <sprout/detail/simd.hpp>
+
+namespace sprout {
+	namespace math {
+		namespace detail {
+			//
+			// quat_soa_scalar
+			//
+			//	The Hamilton product and the norm of the bulk operations, component by
+			//	component: (a, b, c, d) is a + bi + cj + dk.
+			//
+			struct quat_soa_scalar {
+			public:
+				template<typename T>
+				static SPROUT_CONSTEXPR T mul_r(T const& a1, T const& b1, T const& c1, T const& d1, T const& a2, T const& b2, T const& c2, T const& d2) {
+					return a1 * a2 - b1 * b2 - c1 * c2 - d1 * d2;
+				}
+				template<typename T>
+				static SPROUT_CONSTEXPR T mul_i(T const& a1, T const& b1, T const& c1, T const& d1, T const& a2, T const& b2, T const& c2, T const& d2) {
+					return a1 * b2 + b1 * a2 + c1 * d2 - d1 * c2;
+				}
+				template<typename T>
+				static SPROUT_CONSTEXPR T mul_j(T const& a1, T const& b1, T const& c1, T const& d1, T const& a2, T const& b2, T const& c2, T const& d2) {
+					return a1 * c2 - b1 * d2 + c1 * a2 + d1 * b2;
+				}
+				template<typename T>
+				static SPROUT_CONSTEXPR T mul_k(T const& a1, T const& b1, T const& c1, T const& d1, T const& a2, T const& b2, T const& c2, T const& d2) {
+					return a1 * d2 + b1 * c2 - c1 * b2 + d1 * a2;
+				}
+				template<typename T>
+				static SPROUT_CONSTEXPR T norm(T const& a, T const& b, T const& c, T const& d) {
+					return a * a + b * b + c * c + d * d;
+				}
+				template<typename T>
+				static SPROUT_CONSTEXPR T abs(T const& a, T const& b, T const& c, T const& d) {
+					return sprout::math::sqrt(norm(a, b, c, d));
+				}
+			};
+
+			//
+			// quat_soa_mul
+			// quat_soa_normalize
+			//
+			//	Kernels over the four component planes for sprout::detail::complex_soa_run;
+			//	the results may be written over the operands.
+			//
+			template<typename T>
+			struct quat_soa_mul {
+			public:
+				T const* a1;
+				T const* b1;
+				T const* c1;
+				T const* d1;
+				T const* a2;
+				T const* b2;
+				T const* c2;
+				T const* d2;
+				T* ra;
+				T* rb;
+				T* rc;
+				T* rd;
+			public:
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+				template<typename Ops>
+				void vector(std::size_t i) const {
+					typedef typename Ops::type type;
+					type const xa = Ops::load(a1 + i);
+					type const xb = Ops::load(b1 + i);
+					type const xc = Ops::load(c1 + i);
+					type const xd = Ops::load(d1 + i);
+					type const ya = Ops::load(a2 + i);
+					type const yb = Ops::load(b2 + i);
+					type const yc = Ops::load(c2 + i);
+					type const yd = Ops::load(d2 + i);
+					Ops::store(ra + i, Ops::fnmadd(xd, yd, Ops::fnmadd(xc, yc, Ops::fnmadd(xb, yb, Ops::mul(xa, ya)))));
+					Ops::store(rb + i, Ops::fnmadd(xd, yc, Ops::fmadd(xc, yd, Ops::fmadd(xb, ya, Ops::mul(xa, yb)))));
+					Ops::store(rc + i, Ops::fmadd(xd, yb, Ops::fmadd(xc, ya, Ops::fnmadd(xb, yd, Ops::mul(xa, yc)))));
+					Ops::store(rd + i, Ops::fmadd(xd, ya, Ops::fnmadd(xc, yb, Ops::fmadd(xb, yc, Ops::mul(xa, yd)))));
+				}
+#endif
+				void scalar(std::size_t i) const {
+					typedef sprout::math::detail::quat_soa_scalar s;
+					T const r = s::mul_r(a1[i], b1[i], c1[i], d1[i], a2[i], b2[i], c2[i], d2[i]);
+					T const x = s::mul_i(a1[i], b1[i], c1[i], d1[i], a2[i], b2[i], c2[i], d2[i]);
+					T const y = s::mul_j(a1[i], b1[i], c1[i], d1[i], a2[i], b2[i], c2[i], d2[i]);
+					T const z = s::mul_k(a1[i], b1[i], c1[i], d1[i], a2[i], b2[i], c2[i], d2[i]);
+					ra[i] = r;
+					rb[i] = x;
+					rc[i] = y;
+					rd[i] = z;
+				}
+			};
+			template<typename T>
+			struct quat_soa_normalize {
+			public:
+				T const* a;
+				T const* b;
+				T const* c;
+				T const* d;
+				T* ra;
+				T* rb;
+				T* rc;
+				T* rd;
+			public:
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+				template<typename Ops>
+				void vector(std::size_t i) const {
+					typedef typename Ops::type type;
+					type const xa = Ops::load(a + i);
+					type const xb = Ops::load(b + i);
+					type const xc = Ops::load(c + i);
+					type const xd = Ops::load(d + i);
+					type const len = Ops::sqrt(Ops::fmadd(xd, xd, Ops::fmadd(xc, xc, Ops::fmadd(xb, xb, Ops::mul(xa, xa)))));
+					Ops::store(ra + i, Ops::div(xa, len));
+					Ops::store(rb + i, Ops::div(xb, len));
+					Ops::store(rc + i, Ops::div(xc, len));
+					Ops::store(rd + i, Ops::div(xd, len));
+				}
+#endif
+				void scalar(std::size_t i) const {
+					T const len = sprout::math::detail::quat_soa_scalar::abs(a[i], b[i], c[i], d[i]);
+					ra[i] = a[i] / len;
+					rb[i] = b[i] / len;
+					rc[i] = c[i] / len;
+					rd[i] = d[i] / len;
+				}
+			};
+		}	// namespace detail
+	}	// namespace math
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_MATH_QUATERNION_DETAIL_SOA_BATCH_HPP
@@ -370,7 +370,7 @@ namespace sprout {
 				type const& requested_c = static_cast<type>(0), \
 				type const& requested_d = static_cast<type>(0) \
 				) \
-				: elems_{{requested_a, requested_a, requested_c, requested_d}} \
+				: elems_{{requested_a, requested_b, requested_c, requested_d}} \
 			{} \
 			explicit SPROUT_CONSTEXPR quaternion( \
 				sprout::complex<type> const& z0, \
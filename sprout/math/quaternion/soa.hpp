@@ -0,0 +1,283 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_MATH_QUATERNION_SOA_HPP
+#define SPROUT_MATH_QUATERNION_SOA_HPP
+
+#include <type_traits>
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/index_tuple/metafunction.hpp>
+#include <sprout/array/array.hpp>
+#include <sprout/math/quaternion/quaternion.hpp>
+#include <sprout/math/quaternion/detail/soa_batch.hpp>
+#include <sprout/complex/detail/soa_batch.hpp>
+#include <sprout/detail/simd.hpp>
+
+namespace sprout {
+	namespace math {
+		//
+		// quat_soa
+		//
+		//	N quaternions a + bi + cj + dk of T stored as four planes a, b, c and d;
+		//	an aggregate initialized as {{a...}, {b...}, {c...}, {d...}}.
+		//
+		template<typename T, std::size_t N>
+		class quat_soa {
+		public:
+			typedef sprout::math::quaternion<T> value_type;
+			typedef T component_type;
+			typedef value_type const_reference;
+			typedef std::size_t size_type;
+		public:
+			SPROUT_STATIC_CONSTEXPR size_type static_size = N;
+		public:
+			component_type a[N];
+			component_type b[N];
+			component_type c[N];
+			component_type d[N];
+		public:
+			static SPROUT_CONSTEXPR size_type size() SPROUT_NOEXCEPT {
+				return static_size;
+			}
+			SPROUT_CONSTEXPR const_reference operator[](size_type i) const {
+				return value_type(a[i], b[i], c[i], d[i]);
+			}
+			SPROUT_CXX14_CONSTEXPR void set(size_type i, value_type const& q) {
+				a[i] = q.R_component_1();
+				b[i] = q.R_component_2();
+				c[i] = q.R_component_3();
+				d[i] = q.R_component_4();
+			}
+		};
+		template<typename T, std::size_t N>
+		SPROUT_CONSTEXPR_OR_CONST typename sprout::math::quat_soa<T, N>::size_type sprout::math::quat_soa<T, N>::static_size;
+
+		//
+		// quat_soa_span
+		//
+		//	A non-owning quat_soa of runtime size; quat_soa_span<T const> is the
+		//	read-only span.
+		//
+		template<typename T>
+		class quat_soa_span {
+		public:
+			typedef sprout::math::quaternion<typename std::remove_const<T>::type> value_type;
+			typedef T component_type;
+			typedef value_type const_reference;
+			typedef std::size_t size_type;
+		private:
+			T* a_;
+			T* b_;
+			T* c_;
+			T* d_;
+			size_type size_;
+		public:
+			SPROUT_CONSTEXPR quat_soa_span() SPROUT_NOEXCEPT
+				: a_(), b_(), c_(), d_(), size_()
+			{}
+			quat_soa_span(quat_soa_span const&) = default;
+			SPROUT_CONSTEXPR quat_soa_span(T* a, T* b, T* c, T* d, size_type n) SPROUT_NOEXCEPT
+				: a_(a), b_(b), c_(c), d_(d), size_(n)
+			{}
+			template<typename U, std::size_t N>
+			SPROUT_CONSTEXPR quat_soa_span(sprout::math::quat_soa<U, N>& x) SPROUT_NOEXCEPT
+				: a_(x.a), b_(x.b), c_(x.c), d_(x.d), size_(N)
+			{}
+			template<typename U, std::size_t N>
+			SPROUT_CONSTEXPR quat_soa_span(sprout::math::quat_soa<U, N> const& x) SPROUT_NOEXCEPT
+				: a_(x.a), b_(x.b), c_(x.c), d_(x.d), size_(N)
+			{}
+			template<typename U>
+			SPROUT_CONSTEXPR quat_soa_span(quat_soa_span<U> const& other) SPROUT_NOEXCEPT
+				: a_(other.a_data()), b_(other.b_data()), c_(other.c_data()), d_(other.d_data()), size_(other.size())
+			{}
+			SPROUT_CONSTEXPR size_type size() const SPROUT_NOEXCEPT {
+				return size_;
+			}
+			SPROUT_CONSTEXPR bool empty() const SPROUT_NOEXCEPT {
+				return size_ == 0;
+			}
+			SPROUT_CONSTEXPR const_reference operator[](size_type i) const {
+				return value_type(a_[i], b_[i], c_[i], d_[i]);
+			}
+			SPROUT_CXX14_CONSTEXPR void set(size_type i, value_type const& q) const {
+				a_[i] = q.R_component_1();
+				b_[i] = q.R_component_2();
+				c_[i] = q.R_component_3();
+				d_[i] = q.R_component_4();
+			}
+			SPROUT_CONSTEXPR T* a_data() const SPROUT_NOEXCEPT {
+				return a_;
+			}
+			SPROUT_CONSTEXPR T* b_data() const SPROUT_NOEXCEPT {
+				return b_;
+			}
+			SPROUT_CONSTEXPR T* c_data() const SPROUT_NOEXCEPT {
+				return c_;
+			}
+			SPROUT_CONSTEXPR T* d_data() const SPROUT_NOEXCEPT {
+				return d_;
+			}
+			SPROUT_CONSTEXPR quat_soa_span subspan(size_type offset, size_type count) const SPROUT_NOEXCEPT {
+				return quat_soa_span(a_ + offset, b_ + offset, c_ + offset, d_ + offset, count);
+			}
+		};
+
+		namespace detail {
+			template<typename T, std::size_t N>
+			inline SPROUT_CONSTEXPR bool
+			quat_soa_equal(sprout::math::quat_soa<T, N> const& lhs, sprout::math::quat_soa<T, N> const& rhs, std::size_t i) {
+				return i == N || (
+					lhs.a[i] == rhs.a[i] && lhs.b[i] == rhs.b[i] && lhs.c[i] == rhs.c[i] && lhs.d[i] == rhs.d[i]
+						&& sprout::math::detail::quat_soa_equal(lhs, rhs, i + 1)
+					);
+			}
+			template<typename T, std::size_t N, sprout::index_t... Indexes>
+			inline SPROUT_CONSTEXPR sprout::math::quat_soa<T, N>
+			make_quat_soa_impl(sprout::array<sprout::math::quaternion<T>, N> const& x, sprout::index_tuple<Indexes...>) {
+				return sprout::math::quat_soa<T, N>{
+					{x[Indexes].R_component_1()...}, {x[Indexes].R_component_2()...},
+					{x[Indexes].R_component_3()...}, {x[Indexes].R_component_4()...}
+					};
+			}
+
+			template<typename T, std::size_t N, sprout::index_t... Indexes>
+			inline SPROUT_CONSTEXPR sprout::math::quat_soa<T, N>
+			qmul_scalar(sprout::math::quat_soa<T, N> const& x, sprout::math::quat_soa<T, N> const& y, sprout::index_tuple<Indexes...>) {
+				typedef sprout::math::detail::quat_soa_scalar s;
+				return sprout::math::quat_soa<T, N>{
+					{s::mul_r(x.a[Indexes], x.b[Indexes], x.c[Indexes], x.d[Indexes], y.a[Indexes], y.b[Indexes], y.c[Indexes], y.d[Indexes])...},
+					{s::mul_i(x.a[Indexes], x.b[Indexes], x.c[Indexes], x.d[Indexes], y.a[Indexes], y.b[Indexes], y.c[Indexes], y.d[Indexes])...},
+					{s::mul_j(x.a[Indexes], x.b[Indexes], x.c[Indexes], x.d[Indexes], y.a[Indexes], y.b[Indexes], y.c[Indexes], y.d[Indexes])...},
+					{s::mul_k(x.a[Indexes], x.b[Indexes], x.c[Indexes], x.d[Indexes], y.a[Indexes], y.b[Indexes], y.c[Indexes], y.d[Indexes])...}
+					};
+			}
+			template<typename T, std::size_t N>
+			inline sprout::math::quat_soa<T, N>
+			qmul_vector(sprout::math::quat_soa<T, N> const& x, sprout::math::quat_soa<T, N> const& y) {
+				sprout::math::quat_soa<T, N> result;
+				sprout::math::detail::quat_soa_mul<T> const kernel = {
+					x.a, x.b, x.c, x.d, y.a, y.b, y.c, y.d, result.a, result.b, result.c, result.d
+					};
+				sprout::detail::complex_soa_run(kernel, N);
+				return result;
+			}
+			template<typename T, std::size_t N, sprout::index_t... Indexes>
+			inline SPROUT_CONSTEXPR sprout::array<T, N>
+			quat_soa_abs(sprout::math::quat_soa<T, N> const& x, sprout::index_tuple<Indexes...>) {
+				return sprout::array<T, N>{{sprout::math::detail::quat_soa_scalar::abs(x.a[Indexes], x.b[Indexes], x.c[Indexes], x.d[Indexes])...}};
+			}
+			template<typename T, std::size_t N, sprout::index_t... Indexes>
+			inline SPROUT_CONSTEXPR sprout::math::quat_soa<T, N>
+			normalize_scalar_impl(sprout::math::quat_soa<T, N> const& x, sprout::array<T, N> const& len, sprout::index_tuple<Indexes...>) {
+				return sprout::math::quat_soa<T, N>{
+					{(x.a[Indexes] / len[Indexes])...}, {(x.b[Indexes] / len[Indexes])...},
+					{(x.c[Indexes] / len[Indexes])...}, {(x.d[Indexes] / len[Indexes])...}
+					};
+			}
+			template<typename T, std::size_t N>
+			inline SPROUT_CONSTEXPR sprout::math::quat_soa<T, N>
+			normalize_scalar(sprout::math::quat_soa<T, N> const& x) {
+				return sprout::math::detail::normalize_scalar_impl(
+					x, sprout::math::detail::quat_soa_abs(x, sprout::make_index_tuple<N>::make()),
+					sprout::make_index_tuple<N>::make()
+					);
+			}
+			template<typename T, std::size_t N>
+			inline sprout::math::quat_soa<T, N>
+			normalize_vector(sprout::math::quat_soa<T, N> const& x) {
+				sprout::math::quat_soa<T, N> result;
+				sprout::math::detail::quat_soa_normalize<T> const kernel = {
+					x.a, x.b, x.c, x.d, result.a, result.b, result.c, result.d
+					};
+				sprout::detail::complex_soa_run(kernel, N);
+				return result;
+			}
+		}	// namespace detail
+
+		template<typename T, std::size_t N>
+		inline SPROUT_CONSTEXPR bool
+		operator==(sprout::math::quat_soa<T, N> const& lhs, sprout::math::quat_soa<T, N> const& rhs) {
+			return sprout::math::detail::quat_soa_equal(lhs, rhs, 0);
+		}
+		template<typename T, std::size_t N>
+		inline SPROUT_CONSTEXPR bool
+		operator!=(sprout::math::quat_soa<T, N> const& lhs, sprout::math::quat_soa<T, N> const& rhs) {
+			return !(lhs == rhs);
+		}
+
+		//
+		// make_quat_soa
+		//
+		template<typename T, std::size_t N>
+		inline SPROUT_CONSTEXPR sprout::math::quat_soa<T, N>
+		make_quat_soa(sprout::array<sprout::math::quaternion<T>, N> const& x) {
+			return sprout::math::detail::make_quat_soa_impl(x, sprout::make_index_tuple<N>::make());
+		}
+
+		//
+		// qmul
+		// normalize
+		//
+		//	Elementwise Hamilton product x * y and x / abs(x). They are the scalar
+		//	formulas in constant expressions and the vector kernels of
+		//	sprout/math/quaternion/detail/soa_batch.hpp at runtime; with FMA the
+		//	products are fused, and may differ from the scalar results in the last bit.
+		//
+		template<typename T, std::size_t N>
+		inline SPROUT_CONSTEXPR sprout::math::quat_soa<T, N>
+		qmul(sprout::math::quat_soa<T, N> const& x, sprout::math::quat_soa<T, N> const& y) {
+#if defined(SPROUT_DETAIL_HAS_IS_CONSTANT_EVALUATED)
+			return __builtin_is_constant_evaluated() ? sprout::math::detail::qmul_scalar(x, y, sprout::make_index_tuple<N>::make())
+				: sprout::math::detail::qmul_vector(x, y)
+				;
+#else
+			return sprout::math::detail::qmul_scalar(x, y, sprout::make_index_tuple<N>::make());
+#endif
+		}
+		template<typename T, std::size_t N>
+		inline SPROUT_CONSTEXPR sprout::math::quat_soa<T, N>
+		normalize(sprout::math::quat_soa<T, N> const& x) {
+#if defined(SPROUT_DETAIL_HAS_IS_CONSTANT_EVALUATED)
+			return __builtin_is_constant_evaluated() ? sprout::math::detail::normalize_scalar(x)
+				: sprout::math::detail::normalize_vector(x)
+				;
+#else
+			return sprout::math::detail::normalize_scalar(x);
+#endif
+		}
+
+		//
+		// qmul
+		// normalize
+		//
+		//	Runtime forms over spans; the operands have at least the size of result,
+		//	which may be one of them.
+		//
+		template<typename T1, typename T2, typename T>
+		inline void
+		qmul(sprout::math::quat_soa_span<T1> const& x, sprout::math::quat_soa_span<T2> const& y, sprout::math::quat_soa_span<T> const& result) {
+			sprout::math::detail::quat_soa_mul<T> const kernel = {
+				x.a_data(), x.b_data(), x.c_data(), x.d_data(), y.a_data(), y.b_data(), y.c_data(), y.d_data(),
+				result.a_data(), result.b_data(), result.c_data(), result.d_data()
+				};
+			sprout::detail::complex_soa_run(kernel, result.size());
+		}
+		template<typename T1, typename T>
+		inline void
+		normalize(sprout::math::quat_soa_span<T1> const& x, sprout::math::quat_soa_span<T> const& result) {
+			sprout::math::detail::quat_soa_normalize<T> const kernel = {
+				x.a_data(), x.b_data(), x.c_data(), x.d_data(),
+				result.a_data(), result.b_data(), result.c_data(), result.d_data()
+				};
+			sprout::detail::complex_soa_run(kernel, result.size());
+		}
+	}	// namespace math
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_MATH_QUATERNION_SOA_HPP
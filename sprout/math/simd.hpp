@@ -0,0 +1,267 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_MATH_SIMD_HPP
+#define SPROUT_MATH_SIMD_HPP
+
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/index_tuple/metafunction.hpp>
+#include <sprout/math/detail/batch.hpp>
+#include <sprout/detail/simd.hpp>
+
+namespace sprout {
+	namespace math {
+		//
+		// simd
+		//
+		//	A pack of N values of T with elementwise arithmetic; an aggregate like
+		//	sprout::array. sin, cos, exp, log and sqrt of a pack are the scalar
+		//	sprout::math functions in constant expressions and the vector kernels of
+		//	sprout/math/batch.hpp at runtime.
+		//
+		template<typename T, std::size_t N>
+		class simd {
+		public:
+			typedef T value_type;
+			typedef T& reference;
+			typedef T const& const_reference;
+			typedef std::size_t size_type;
+			typedef T* pointer;
+			typedef T const* const_pointer;
+		public:
+			SPROUT_STATIC_CONSTEXPR size_type static_size = N;
+		public:
+			value_type elems[N];
+		public:
+			static SPROUT_CONSTEXPR size_type size() SPROUT_NOEXCEPT {
+				return static_size;
+			}
+			SPROUT_CXX14_CONSTEXPR reference operator[](size_type i) {
+				return elems[i];
+			}
+			SPROUT_CONSTEXPR const_reference operator[](size_type i) const {
+				return elems[i];
+			}
+			SPROUT_CXX14_CONSTEXPR pointer data() SPROUT_NOEXCEPT {
+				return elems;
+			}
+			SPROUT_CONSTEXPR const_pointer data() const SPROUT_NOEXCEPT {
+				return elems;
+			}
+		};
+		template<typename T, std::size_t N>
+		SPROUT_CONSTEXPR_OR_CONST typename sprout::math::simd<T, N>::size_type sprout::math::simd<T, N>::static_size;
+
+		namespace detail {
+			template<typename T, std::size_t N, sprout::index_t... Indexes>
+			inline SPROUT_CONSTEXPR sprout::math::simd<T, N>
+			broadcast_impl(T const& x, sprout::index_tuple<Indexes...>) {
+				return sprout::math::simd<T, N>{{(static_cast<void>(Indexes), x)...}};
+			}
+
+			struct simd_plus {
+			public:
+				template<typename T>
+				static SPROUT_CONSTEXPR T apply(T const& a, T const& b) {
+					return a + b;
+				}
+			};
+			struct simd_minus {
+			public:
+				template<typename T>
+				static SPROUT_CONSTEXPR T apply(T const& a, T const& b) {
+					return a - b;
+				}
+			};
+			struct simd_multiplies {
+			public:
+				template<typename T>
+				static SPROUT_CONSTEXPR T apply(T const& a, T const& b) {
+					return a * b;
+				}
+			};
+			struct simd_divides {
+			public:
+				template<typename T>
+				static SPROUT_CONSTEXPR T apply(T const& a, T const& b) {
+					return a / b;
+				}
+			};
+			template<typename Op, typename T, std::size_t N, sprout::index_t... Indexes>
+			inline SPROUT_CONSTEXPR sprout::math::simd<T, N>
+			simd_binary(sprout::math::simd<T, N> const& a, sprout::math::simd<T, N> const& b, sprout::index_tuple<Indexes...>) {
+				return sprout::math::simd<T, N>{{Op::apply(a.elems[Indexes], b.elems[Indexes])...}};
+			}
+			template<typename T, std::size_t N, sprout::index_t... Indexes>
+			inline SPROUT_CONSTEXPR sprout::math::simd<T, N>
+			simd_negate(sprout::math::simd<T, N> const& a, sprout::index_tuple<Indexes...>) {
+				return sprout::math::simd<T, N>{{-a.elems[Indexes]...}};
+			}
+			template<typename T, std::size_t N>
+			inline SPROUT_CONSTEXPR bool
+			simd_equal(sprout::math::simd<T, N> const& a, sprout::math::simd<T, N> const& b, std::size_t i) {
+				return i == N || (a.elems[i] == b.elems[i] && sprout::math::detail::simd_equal(a, b, i + 1));
+			}
+
+			template<typename Kernel, typename T, std::size_t N, sprout::index_t... Indexes>
+			inline SPROUT_CONSTEXPR sprout::math::simd<T, N>
+			simd_scalar(sprout::math::simd<T, N> const& x, sprout::index_tuple<Indexes...>) {
+				return sprout::math::simd<T, N>{{Kernel::scalar(x.elems[Indexes])...}};
+			}
+			template<typename Kernel, typename T, std::size_t N>
+			inline sprout::math::simd<T, N>
+			simd_vector(sprout::math::simd<T, N> const& x) {
+				sprout::math::simd<T, N> result;
+				sprout::math::detail::batch_apply<Kernel>(x.elems, x.elems + N, result.elems);
+				return result;
+			}
+			template<typename Kernel, typename T, std::size_t N>
+			inline SPROUT_CONSTEXPR sprout::math::simd<T, N>
+			simd_apply(sprout::math::simd<T, N> const& x) {
+#if defined(SPROUT_DETAIL_HAS_IS_CONSTANT_EVALUATED)
+				return __builtin_is_constant_evaluated() ? sprout::math::detail::simd_scalar<Kernel>(x, sprout::make_index_tuple<N>::make())
+					: sprout::math::detail::simd_vector<Kernel>(x)
+					;
+#else
+				return sprout::math::detail::simd_scalar<Kernel>(x, sprout::make_index_tuple<N>::make());
+#endif
+			}
+		}	// namespace detail
+
+		//
+		// broadcast
+		//
+		template<std::size_t N, typename T>
+		inline SPROUT_CONSTEXPR sprout::math::simd<T, N>
+		broadcast(T const& x) {
+			return sprout::math::detail::broadcast_impl<T, N>(x, sprout::make_index_tuple<N>::make());
+		}
+
+		//
+		// operator+
+		// operator-
+		// operator*
+		// operator/
+		//
+		template<typename T, std::size_t N>
+		inline SPROUT_CONSTEXPR sprout::math::simd<T, N>
+		operator+(sprout::math::simd<T, N> const& a, sprout::math::simd<T, N> const& b) {
+			return sprout::math::detail::simd_binary<sprout::math::detail::simd_plus>(a, b, sprout::make_index_tuple<N>::make());
+		}
+		template<typename T, std::size_t N>
+		inline SPROUT_CONSTEXPR sprout::math::simd<T, N>
+		operator-(sprout::math::simd<T, N> const& a, sprout::math::simd<T, N> const& b) {
+			return sprout::math::detail::simd_binary<sprout::math::detail::simd_minus>(a, b, sprout::make_index_tuple<N>::make());
+		}
+		template<typename T, std::size_t N>
+		inline SPROUT_CONSTEXPR sprout::math::simd<T, N>
+		operator*(sprout::math::simd<T, N> const& a, sprout::math::simd<T, N> const& b) {
+			return sprout::math::detail::simd_binary<sprout::math::detail::simd_multiplies>(a, b, sprout::make_index_tuple<N>::make());
+		}
+		template<typename T, std::size_t N>
+		inline SPROUT_CONSTEXPR sprout::math::simd<T, N>
+		operator/(sprout::math::simd<T, N> const& a, sprout::math::simd<T, N> const& b) {
+			return sprout::math::detail::simd_binary<sprout::math::detail::simd_divides>(a, b, sprout::make_index_tuple<N>::make());
+		}
+		template<typename T, std::size_t N>
+		inline SPROUT_CONSTEXPR sprout::math::simd<T, N>
+		operator+(sprout::math::simd<T, N> const& a, T const& b) {
+			return a + sprout::math::broadcast<N>(b);
+		}
+		template<typename T, std::size_t N>
+		inline SPROUT_CONSTEXPR sprout::math::simd<T, N>
+		operator-(sprout::math::simd<T, N> const& a, T const& b) {
+			return a - sprout::math::broadcast<N>(b);
+		}
+		template<typename T, std::size_t N>
+		inline SPROUT_CONSTEXPR sprout::math::simd<T, N>
+		operator*(sprout::math::simd<T, N> const& a, T const& b) {
+			return a * sprout::math::broadcast<N>(b);
+		}
+		template<typename T, std::size_t N>
+		inline SPROUT_CONSTEXPR sprout::math::simd<T, N>
+		operator/(sprout::math::simd<T, N> const& a, T const& b) {
+			return a / sprout::math::broadcast<N>(b);
+		}
+		template<typename T, std::size_t N>
+		inline SPROUT_CONSTEXPR sprout::math::simd<T, N>
+		operator+(T const& a, sprout::math::simd<T, N> const& b) {
+			return sprout::math::broadcast<N>(a) + b;
+		}
+		template<typename T, std::size_t N>
+		inline SPROUT_CONSTEXPR sprout::math::simd<T, N>
+		operator-(T const& a, sprout::math::simd<T, N> const& b) {
+			return sprout::math::broadcast<N>(a) - b;
+		}
+		template<typename T, std::size_t N>
+		inline SPROUT_CONSTEXPR sprout::math::simd<T, N>
+		operator*(T const& a, sprout::math::simd<T, N> const& b) {
+			return sprout::math::broadcast<N>(a) * b;
+		}
+		template<typename T, std::size_t N>
+		inline SPROUT_CONSTEXPR sprout::math::simd<T, N>
+		operator/(T const& a, sprout::math::simd<T, N> const& b) {
+			return sprout::math::broadcast<N>(a) / b;
+		}
+		template<typename T, std::size_t N>
+		inline SPROUT_CONSTEXPR sprout::math::simd<T, N>
+		operator-(sprout::math::simd<T, N> const& a) {
+			return sprout::math::detail::simd_negate(a, sprout::make_index_tuple<N>::make());
+		}
+
+		//
+		// operator==
+		// operator!=
+		//
+		template<typename T, std::size_t N>
+		inline SPROUT_CONSTEXPR bool
+		operator==(sprout::math::simd<T, N> const& a, sprout::math::simd<T, N> const& b) {
+			return sprout::math::detail::simd_equal(a, b, 0);
+		}
+		template<typename T, std::size_t N>
+		inline SPROUT_CONSTEXPR bool
+		operator!=(sprout::math::simd<T, N> const& a, sprout::math::simd<T, N> const& b) {
+			return !(a == b);
+		}
+
+		//
+		// sin
+		// cos
+		// exp
+		// log
+		// sqrt
+		//
+		template<typename T, std::size_t N>
+		inline SPROUT_CONSTEXPR sprout::math::simd<T, N>
+		sin(sprout::math::simd<T, N> const& x) {
+			return sprout::math::detail::simd_apply<sprout::math::detail::batch_sin>(x);
+		}
+		template<typename T, std::size_t N>
+		inline SPROUT_CONSTEXPR sprout::math::simd<T, N>
+		cos(sprout::math::simd<T, N> const& x) {
+			return sprout::math::detail::simd_apply<sprout::math::detail::batch_cos>(x);
+		}
+		template<typename T, std::size_t N>
+		inline SPROUT_CONSTEXPR sprout::math::simd<T, N>
+		exp(sprout::math::simd<T, N> const& x) {
+			return sprout::math::detail::simd_apply<sprout::math::detail::batch_exp>(x);
+		}
+		template<typename T, std::size_t N>
+		inline SPROUT_CONSTEXPR sprout::math::simd<T, N>
+		log(sprout::math::simd<T, N> const& x) {
+			return sprout::math::detail::simd_apply<sprout::math::detail::batch_log>(x);
+		}
+		template<typename T, std::size_t N>
+		inline SPROUT_CONSTEXPR sprout::math::simd<T, N>
+		sqrt(sprout::math::simd<T, N> const& x) {
+			return sprout::math::detail::simd_apply<sprout::math::detail::batch_sqrt>(x);
+		}
+	}	// namespace math
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_MATH_SIMD_HPP
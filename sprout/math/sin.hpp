@@ -13,9 +13,10 @@
 #include <sprout/limits.hpp>
 #include <sprout/math/detail/config.hpp>
 #include <sprout/math/detail/float_compute.hpp>
-#include <sprout/math/constants.hpp>
+#include <sprout/math/detail/rem_pio2.hpp>
+#include <sprout/math/detail/cosp.hpp>
+#include <sprout/math/detail/sinp.hpp>
 #include <sprout/math/isnan.hpp>
-#include <sprout/math/cos.hpp>
 #include <sprout/type_traits/enabler_if.hpp>
 
 namespace sprout {
@@ -36,10 +37,19 @@ namespace sprout {
 			}
 #endif
 
+			template<typename T>
+			inline SPROUT_CONSTEXPR T
+			sin_impl_1(sprout::math::detail::rem_pio2_result<T> const& r) {
+				return r.n == 0 ? sprout::math::detail::sinp(r.hi, r.lo)
+					: r.n == 1 ? sprout::math::detail::cosp(r.hi, r.lo)
+					: r.n == 2 ? -sprout::math::detail::sinp(r.hi, r.lo)
+					: -sprout::math::detail::cosp(r.hi, r.lo)
+					;
+			}
 			template<typename T>
 			inline SPROUT_CONSTEXPR T
 			sin_impl(T x) {
-				return -sprout::math::cos(x + sprout::math::half_pi<T>());
+				return sprout::math::detail::sin_impl_1(sprout::math::detail::rem_pio2(x));
 			}
 		}	// namespace detail
 		//
@@ -0,0 +1,188 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_NUMERIC_STFT_PARALLEL_HPP
+#define SPROUT_NUMERIC_STFT_PARALLEL_HPP
+
+#include <iterator>
+#include <vector>
+#include <thread>
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/array/array.hpp>
+#include <sprout/complex.hpp>
+#include <sprout/numeric/fft/cxx14/fft.hpp>
+#include <sprout/numeric/fft/cxx14/ifft.hpp>
+#include <sprout/numeric/stft/window.hpp>
+#include <sprout/numeric/stft/stft.hpp>
+
+namespace sprout {
+	namespace detail {
+		template<typename Function>
+		inline void
+		stft_parallel_for(std::size_t n, unsigned threads, Function f) {
+			if (threads == 0) {
+				threads = std::thread::hardware_concurrency();
+			}
+			if (threads <= 1 || n <= 1) {
+				f(std::size_t(0), n);
+				return;
+			}
+			if (threads > n) {
+				threads = static_cast<unsigned>(n);
+			}
+			std::vector<std::thread> workers;
+			workers.reserve(threads - 1);
+			std::size_t const chunk = (n + threads - 1) / threads;
+			for (unsigned t = 1; t != threads; ++t) {
+				std::size_t const first = t * chunk < n ? t * chunk : n;
+				std::size_t const last = first + chunk < n ? first + chunk : n;
+				workers.push_back(std::thread(f, first, last));
+			}
+			f(std::size_t(0), chunk < n ? chunk : n);
+			for (std::size_t t = 0; t != workers.size(); ++t) {
+				workers[t].join();
+			}
+		}
+
+		template<typename T, std::size_t N, typename Window, typename RandomAccessIterator, typename FrameIterator>
+		struct stft_batch_analyze {
+		public:
+			RandomAccessIterator first;
+			std::ptrdiff_t size;
+			std::size_t hop;
+			FrameIterator frames;
+		public:
+			void operator()(std::size_t first_frame, std::size_t last_frame) const {
+				for (std::size_t j = first_frame; j != last_frame; ++j) {
+					sprout::array<sprout::complex<T>, N>& frame = frames[j];
+					std::ptrdiff_t const origin = static_cast<std::ptrdiff_t>(j * hop) - static_cast<std::ptrdiff_t>(N - hop);
+					for (std::size_t n = 0; n != N; ++n) {
+						std::ptrdiff_t const i = origin + static_cast<std::ptrdiff_t>(n);
+						frame[n] = sprout::complex<T>(
+							i >= 0 && i < size
+								? static_cast<T>(first[i]) * sprout::window_table<Window, T, N>::table[n]
+								: T()
+							);
+					}
+					sprout::fft(frame.begin(), frame.end());
+				}
+			}
+		};
+
+		template<typename T, std::size_t N, typename Window, typename FrameIterator>
+		struct stft_batch_inverse {
+		public:
+			FrameIterator frames;
+			T* signals;
+		public:
+			void operator()(std::size_t first_frame, std::size_t last_frame) const {
+				sprout::array<sprout::complex<T>, N> frame;
+				for (std::size_t j = first_frame; j != last_frame; ++j) {
+					frame = frames[j];
+					sprout::ifft(frame.begin(), frame.end());
+					for (std::size_t n = 0; n != N; ++n) {
+						signals[j * N + n] = sprout::real(frame[n]) * sprout::window_table<Window, T, N>::table[n];
+					}
+				}
+			}
+		};
+
+		template<typename T, std::size_t N, typename RandomAccessIterator>
+		struct stft_batch_overlap_add {
+		public:
+			T const* signals;
+			std::size_t frames;
+			std::size_t hop;
+			std::size_t lead;
+			T const* norm;
+			RandomAccessIterator result;
+		public:
+			void operator()(std::size_t first, std::size_t last) const {
+				for (std::size_t s = first; s != last; ++s) {
+					// padded time t lies at offset t % hop + k * hop of frame t / hop - k
+					std::size_t const t = s + lead;
+					std::size_t const j0 = t / hop;
+					T y = T();
+					for (std::size_t k = 0; k != N / hop && k <= j0; ++k) {
+						if (j0 - k < frames) {
+							y += signals[(j0 - k) * N + t % hop + k * hop];
+						}
+					}
+					result[s] = y * norm[t % hop];
+				}
+			}
+		};
+	}	// namespace detail
+
+	//
+	// stft_frame_count
+	//
+	//	Number of frames that touch any of size input samples.
+	//
+	inline std::size_t
+	stft_frame_count(std::size_t size, std::size_t n, std::size_t hop) {
+		return (size + hop - 1) / hop + n / hop - 1;
+	}
+
+	//
+	// parallel_stft
+	//
+	//	Offline analysis of [first, last) into stft_frame_count() frames, split
+	//	across threads (0 = hardware concurrency). Frame layout matches stft_analyzer
+	//	fed with the signal zero-padded to a multiple of hop, then N - hop zeros.
+	//
+	template<typename T, std::size_t N, typename Window, typename RandomAccessIterator, typename FrameIterator>
+	inline FrameIterator
+	parallel_stft(RandomAccessIterator first, RandomAccessIterator last, std::size_t hop, FrameIterator result, unsigned threads = 0) {
+		hop = sprout::detail::stft_checked_hop(N, hop);
+		std::ptrdiff_t const size = std::distance(first, last);
+		std::size_t const frames = sprout::stft_frame_count(static_cast<std::size_t>(size), N, hop);
+		sprout::detail::stft_batch_analyze<T, N, Window, RandomAccessIterator, FrameIterator> f = {first, size, hop, result};
+		sprout::detail::stft_parallel_for(frames, threads, f);
+		return result + frames;
+	}
+	template<typename T, std::size_t N, typename RandomAccessIterator, typename FrameIterator>
+	inline FrameIterator
+	parallel_stft(RandomAccessIterator first, RandomAccessIterator last, std::size_t hop, FrameIterator result, unsigned threads = 0) {
+		return sprout::parallel_stft<T, N, sprout::hann_window>(first, last, hop, result, threads);
+	}
+
+	//
+	// parallel_istft
+	//
+	//	Offline inverse of parallel_stft: writes (frames - N / hop + 1) * hop samples,
+	//	aligned with the original signal.
+	//
+	template<typename T, std::size_t N, typename Window, typename FrameIterator, typename RandomAccessIterator>
+	inline RandomAccessIterator
+	parallel_istft(FrameIterator first, FrameIterator last, std::size_t hop, RandomAccessIterator result, unsigned threads = 0) {
+		hop = sprout::detail::stft_checked_hop(N, hop);
+		std::size_t const frames = static_cast<std::size_t>(std::distance(first, last));
+		if (frames < N / hop) {
+			return result;
+		}
+		std::vector<T> signals(frames * N);
+		sprout::detail::stft_batch_inverse<T, N, Window, FrameIterator> inv = {first, signals.data()};
+		sprout::detail::stft_parallel_for(frames, threads, inv);
+		sprout::array<T, N> norm;
+		sprout::detail::stft_inverse_norm(norm, sprout::window_table<Window, T, N>::table, hop);
+		std::size_t const size = (frames - N / hop + 1) * hop;
+		sprout::detail::stft_batch_overlap_add<T, N, RandomAccessIterator> ola = {
+			signals.data(), frames, hop, N - hop, norm.data(), result
+		};
+		sprout::detail::stft_parallel_for(size, threads, ola);
+		return result + size;
+	}
+	template<typename T, std::size_t N, typename FrameIterator, typename RandomAccessIterator>
+	inline RandomAccessIterator
+	parallel_istft(FrameIterator first, FrameIterator last, std::size_t hop, RandomAccessIterator result, unsigned threads = 0) {
+		return sprout::parallel_istft<T, N, sprout::hann_window>(first, last, hop, result, threads);
+	}
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_NUMERIC_STFT_PARALLEL_HPP
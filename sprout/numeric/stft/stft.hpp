@@ -0,0 +1,171 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_NUMERIC_STFT_STFT_HPP
+#define SPROUT_NUMERIC_STFT_STFT_HPP
+
+#include <stdexcept>
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/array/array.hpp>
+#include <sprout/complex.hpp>
+#include <sprout/numeric/fft/cxx14/fft.hpp>
+#include <sprout/numeric/fft/cxx14/ifft.hpp>
+#include <sprout/numeric/stft/window.hpp>
+
+namespace sprout {
+	namespace detail {
+		inline std::size_t
+		stft_checked_hop(std::size_t size, std::size_t hop) {
+			return hop == 0 || size % hop != 0 ? throw std::invalid_argument("stft: hop must divide the frame size")
+				: hop
+				;
+		}
+		template<typename T, std::size_t N, typename Window, typename OutputIterator>
+		inline OutputIterator
+		stft_analyze(T const* samples, OutputIterator result) {
+			for (std::size_t n = 0; n != N; ++n) {
+				*result = sprout::complex<T>(samples[n] * sprout::window_table<Window, T, N>::table[n]);
+				++result;
+			}
+			return result;
+		}
+		template<typename T, std::size_t N>
+		inline void
+		stft_inverse_norm(sprout::array<T, N>& norm, sprout::array<T, N> const& window, std::size_t hop) {
+			for (std::size_t i = 0; i != hop; ++i) {
+				T s = T();
+				for (std::size_t n = i; n < N; n += hop) {
+					s += window[n] * window[n];
+				}
+				norm[i] = s > T() ? T(1) / s : T();
+			}
+		}
+	}	// namespace detail
+
+	//
+	// stft_analyzer
+	//
+	//	Streaming short-time Fourier transform.
+	//	Every hop input samples a frame of the last N samples is windowed and
+	//	transformed. The history starts zero-filled, so frame j covers input
+	//	[j * hop - (N - hop), (j + 1) * hop). All storage is held in the object.
+	//
+	template<typename T, std::size_t N, typename Window = sprout::hann_window>
+	class stft_analyzer {
+		static_assert(N >= 4 && (N & (N - 1)) == 0, "N >= 4 && N is a power of 2");
+	public:
+		typedef T value_type;
+		typedef sprout::complex<T> complex_type;
+		typedef sprout::array<complex_type, N> frame_type;
+		typedef std::size_t size_type;
+		typedef Window window_type;
+	public:
+		SPROUT_STATIC_CONSTEXPR size_type static_size = N;
+	private:
+		sprout::array<value_type, N * 2> history_;
+		frame_type frame_;
+		size_type hop_;
+		size_type pos_;
+		size_type count_;
+	public:
+		explicit stft_analyzer(size_type hop = N / 4)
+			: history_(), frame_(), hop_(sprout::detail::stft_checked_hop(N, hop)), pos_(0), count_(0)
+		{}
+		size_type hop() const {
+			return hop_;
+		}
+		void reset() {
+			history_ = sprout::array<value_type, N * 2>();
+			pos_ = 0;
+			count_ = 0;
+		}
+		//
+		// process
+		//	Calls f(frame) with each completed spectrum; f may modify the frame.
+		//
+		template<typename InputIterator, typename Function>
+		Function process(InputIterator first, InputIterator last, Function f) {
+			for (; first != last; ++first) {
+				value_type const x = static_cast<value_type>(*first);
+				history_[pos_] = x;
+				history_[pos_ + N] = x;
+				pos_ = pos_ + 1 != N ? pos_ + 1 : 0;
+				if (++count_ == hop_) {
+					count_ = 0;
+					sprout::detail::stft_analyze<T, N, Window>(history_.data() + pos_, frame_.begin());
+					sprout::fft(frame_.begin(), frame_.end());
+					f(frame_);
+				}
+			}
+			return f;
+		}
+	};
+	template<typename T, std::size_t N, typename Window>
+	SPROUT_CONSTEXPR_OR_CONST typename sprout::stft_analyzer<T, N, Window>::size_type
+	sprout::stft_analyzer<T, N, Window>::static_size;
+
+	//
+	// stft_synthesizer
+	//
+	//	Streaming inverse transform with weighted overlap-add.
+	//	Each frame yields hop output samples. Paired with stft_analyzer using the
+	//	same window and hop, the output is the input delayed by N - hop samples.
+	//
+	template<typename T, std::size_t N, typename Window = sprout::hann_window>
+	class stft_synthesizer {
+		static_assert(N >= 4 && (N & (N - 1)) == 0, "N >= 4 && N is a power of 2");
+	public:
+		typedef T value_type;
+		typedef sprout::complex<T> complex_type;
+		typedef sprout::array<complex_type, N> frame_type;
+		typedef std::size_t size_type;
+		typedef Window window_type;
+	public:
+		SPROUT_STATIC_CONSTEXPR size_type static_size = N;
+	private:
+		sprout::array<value_type, N> accum_;
+		sprout::array<value_type, N> norm_;
+		frame_type frame_;
+		size_type hop_;
+		size_type pos_;
+	public:
+		explicit stft_synthesizer(size_type hop = N / 4)
+			: accum_(), norm_(), frame_(), hop_(sprout::detail::stft_checked_hop(N, hop)), pos_(0)
+		{
+			sprout::detail::stft_inverse_norm(norm_, sprout::window_table<Window, T, N>::table, hop_);
+		}
+		size_type hop() const {
+			return hop_;
+		}
+		void reset() {
+			accum_ = sprout::array<value_type, N>();
+			pos_ = 0;
+		}
+		template<typename OutputIterator>
+		OutputIterator process(frame_type const& spectrum, OutputIterator result) {
+			frame_ = spectrum;
+			sprout::ifft(frame_.begin(), frame_.end());
+			for (size_type n = 0; n != N; ++n) {
+				accum_[(pos_ + n) & (N - 1)] += sprout::real(frame_[n]) * sprout::window_table<Window, T, N>::table[n];
+			}
+			for (size_type i = 0; i != hop_; ++i) {
+				value_type& y = accum_[(pos_ + i) & (N - 1)];
+				*result = y * norm_[i];
+				++result;
+				y = value_type();
+			}
+			pos_ = (pos_ + hop_) & (N - 1);
+			return result;
+		}
+	};
+	template<typename T, std::size_t N, typename Window>
+	SPROUT_CONSTEXPR_OR_CONST typename sprout::stft_synthesizer<T, N, Window>::size_type
+	sprout::stft_synthesizer<T, N, Window>::static_size;
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_NUMERIC_STFT_STFT_HPP
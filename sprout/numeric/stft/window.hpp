@@ -0,0 +1,96 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_NUMERIC_STFT_WINDOW_HPP
+#define SPROUT_NUMERIC_STFT_WINDOW_HPP
+
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/array/array.hpp>
+#include <sprout/array/make_array.hpp>
+#include <sprout/index_tuple/metafunction.hpp>
+#include <sprout/math/cos.hpp>
+#include <sprout/math/constants.hpp>
+
+namespace sprout {
+	//
+	// rectangular_window
+	// hann_window
+	// hamming_window
+	// blackman_window
+	//
+	//	Periodic (DFT-even) forms, so that shifted copies overlap-add to a constant.
+	//
+	struct rectangular_window {
+	public:
+		template<typename T>
+		static SPROUT_CONSTEXPR T value(std::size_t, std::size_t) {
+			return T(1);
+		}
+	};
+	struct hann_window {
+	public:
+		template<typename T>
+		static SPROUT_CONSTEXPR T value(std::size_t n, std::size_t size) {
+			return T(0.5) - T(0.5) * sprout::math::cos(sprout::math::two_pi<T>() * n / size);
+		}
+	};
+	struct hamming_window {
+	public:
+		template<typename T>
+		static SPROUT_CONSTEXPR T value(std::size_t n, std::size_t size) {
+			return T(0.54) - T(0.46) * sprout::math::cos(sprout::math::two_pi<T>() * n / size);
+		}
+	};
+	struct blackman_window {
+	public:
+		template<typename T>
+		static SPROUT_CONSTEXPR T value(std::size_t n, std::size_t size) {
+			return T(0.42)
+				- T(0.5) * sprout::math::cos(sprout::math::two_pi<T>() * n / size)
+				+ T(0.08) * sprout::math::cos(2 * sprout::math::two_pi<T>() * n / size)
+				;
+		}
+	};
+
+	namespace detail {
+		template<typename Window, typename T, sprout::index_t... Indexes>
+		inline SPROUT_CONSTEXPR sprout::array<T, sizeof...(Indexes)>
+		make_window(sprout::index_tuple<Indexes...>) {
+			return sprout::make_array<T>(Window::template value<T>(Indexes, sizeof...(Indexes))...);
+		}
+	}	// namespace detail
+
+	//
+	// make_window
+	//
+	template<typename Window, typename T, std::size_t N>
+	inline SPROUT_CONSTEXPR sprout::array<T, N>
+	make_window() {
+		return sprout::detail::make_window<Window, T>(sprout::make_index_tuple<N>::make());
+	}
+
+	//
+	// window_table
+	//
+	template<typename Window, typename T, std::size_t N>
+	struct window_table {
+	public:
+		typedef sprout::array<T, N> table_type;
+	public:
+		SPROUT_STATIC_CONSTEXPR table_type table
+			SPROUT_STATIC_CONSTEXPR_DATA_MEMBER_INNER((sprout::make_window<Window, T, N>()))
+			;
+	};
+	template<typename Window, typename T, std::size_t N>
+	SPROUT_CONSTEXPR_OR_CONST typename sprout::window_table<Window, T, N>::table_type
+	sprout::window_table<Window, T, N>::table
+		SPROUT_STATIC_CONSTEXPR_DATA_MEMBER_OUTER((sprout::make_window<Window, T, N>()))
+		;
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_NUMERIC_STFT_WINDOW_HPP
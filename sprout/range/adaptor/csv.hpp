@@ -0,0 +1,143 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_RANGE_ADAPTOR_CSV_HPP
+#define SPROUT_RANGE_ADAPTOR_CSV_HPP
+
+#include <type_traits>
+#include <sprout/config.hpp>
+#include <sprout/iterator/split_iterator.hpp>
+#include <sprout/range/adaptor/split.hpp>
+#include <sprout/detail/char_scan.hpp>
+
+namespace sprout {
+	namespace adaptors {
+		//
+		// csv_record_separator
+		//
+		//	Splits CSV text into records like line_separator, except that line
+		//	breaks inside quoted fields belong to the field.
+		//
+		template<typename Elem>
+		class csv_record_separator {
+		public:
+			typedef Elem char_type;
+		private:
+			Elem special_[2];
+		public:
+			SPROUT_CONSTEXPR csv_record_separator()
+				: special_{Elem('\n'), Elem('\"')}
+			{}
+			explicit SPROUT_CONSTEXPR csv_record_separator(Elem quote)
+				: special_{Elem('\n'), quote}
+			{}
+			SPROUT_CXX14_CONSTEXPR sprout::split_result<Elem> operator()(Elem const* first, Elem const* last) const {
+				Elem const* p = first;
+				for (;;) {
+					Elem const* const found = sprout::detail::find_any_char(p, last, special_, 2);
+					if (found != last && *found == special_[1]) {
+						// skip to the closing quote; a doubled quote reopens
+						Elem const* const close = sprout::detail::find_any_char(found + 1, last, special_ + 1, 1);
+						p = close != last ? close + 1 : last;
+						continue;
+					}
+					Elem const* const end = found != first && found[-1] == Elem('\r') ? found - 1 : found;
+					sprout::split_result<Elem> const result = {first, end, found != last && found + 1 != last ? found + 1 : 0};
+					return result;
+				}
+			}
+		};
+
+		//
+		// csv_field_separator
+		//
+		//	Splits one CSV record into fields. A quoted field yields what is
+		//	between its quotes, with doubled quotes left as they are; anything
+		//	between the closing quote and the next delimiter is ignored.
+		//
+		template<typename Elem>
+		class csv_field_separator {
+		public:
+			typedef Elem char_type;
+		private:
+			Elem delim_;
+			Elem quote_;
+		public:
+			SPROUT_CONSTEXPR csv_field_separator()
+				: delim_(Elem(',')), quote_(Elem('\"'))
+			{}
+			explicit SPROUT_CONSTEXPR csv_field_separator(Elem delim, Elem quote = Elem('\"'))
+				: delim_(delim), quote_(quote)
+			{}
+			SPROUT_CXX14_CONSTEXPR sprout::split_result<Elem> operator()(Elem const* first, Elem const* last) const {
+				if (first == last || *first != quote_) {
+					Elem const* const found = sprout::detail::find_any_char(first, last, &delim_, 1);
+					sprout::split_result<Elem> const result = {first, found, found != last ? found + 1 : 0};
+					return result;
+				}
+				Elem const* close = first + 1;
+				for (;;) {
+					close = sprout::detail::find_any_char(close, last, &quote_, 1);
+					if (close == last || close + 1 == last || close[1] != quote_) {
+						break;
+					}
+					close += 2;
+				}
+				Elem const* const found = close != last ? sprout::detail::find_any_char(close + 1, last, &delim_, 1) : last;
+				sprout::split_result<Elem> const result = {first + 1, close, found != last ? found + 1 : 0};
+				return result;
+			}
+		};
+
+		//
+		// csv_records_forwarder
+		//
+		class csv_records_forwarder {
+		public:
+			template<typename Elem>
+			SPROUT_CONSTEXPR sprout::adaptors::split_holder<sprout::adaptors::csv_record_separator<Elem> >
+			operator()(Elem quote) const {
+				return sprout::adaptors::split_holder<sprout::adaptors::csv_record_separator<Elem> >(
+					sprout::adaptors::csv_record_separator<Elem>(quote)
+					);
+			}
+			SPROUT_CONSTEXPR sprout::adaptors::split_holder<sprout::adaptors::csv_record_separator<char> >
+			operator()() const {
+				return sprout::adaptors::split_holder<sprout::adaptors::csv_record_separator<char> >();
+			}
+		};
+
+		//
+		// csv_fields_forwarder
+		//
+		class csv_fields_forwarder {
+		public:
+			template<typename Elem>
+			SPROUT_CONSTEXPR sprout::adaptors::split_holder<sprout::adaptors::csv_field_separator<Elem> >
+			operator()(Elem delim, Elem quote = Elem('\"')) const {
+				return sprout::adaptors::split_holder<sprout::adaptors::csv_field_separator<Elem> >(
+					sprout::adaptors::csv_field_separator<Elem>(delim, quote)
+					);
+			}
+			SPROUT_CONSTEXPR sprout::adaptors::split_holder<sprout::adaptors::csv_field_separator<char> >
+			operator()() const {
+				return sprout::adaptors::split_holder<sprout::adaptors::csv_field_separator<char> >();
+			}
+		};
+
+		//
+		// csv_records
+		// csv_fields
+		//
+		namespace {
+			SPROUT_STATIC_CONSTEXPR sprout::adaptors::csv_records_forwarder csv_records = {};
+			SPROUT_STATIC_CONSTEXPR sprout::adaptors::csv_fields_forwarder csv_fields = {};
+		}	// anonymous-namespace
+	}	// namespace adaptors
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_RANGE_ADAPTOR_CSV_HPP
@@ -0,0 +1,85 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_RANGE_ADAPTOR_LINES_HPP
+#define SPROUT_RANGE_ADAPTOR_LINES_HPP
+
+#include <type_traits>
+#include <sprout/config.hpp>
+#include <sprout/container/traits.hpp>
+#include <sprout/iterator/split_iterator.hpp>
+#include <sprout/range/adaptor/split.hpp>
+#include <sprout/type_traits/lvalue_reference.hpp>
+#include <sprout/utility/lvalue_forward.hpp>
+#include <sprout/detail/char_scan.hpp>
+
+namespace sprout {
+	namespace adaptors {
+		//
+		// line_separator
+		//
+		//	Splits after every '\n' and drops a '\r' before it. A final line
+		//	needs no terminator, and a terminator at the very end does not start
+		//	an empty line.
+		//
+		template<typename Elem>
+		class line_separator {
+		public:
+			typedef Elem char_type;
+		public:
+			SPROUT_CXX14_CONSTEXPR sprout::split_result<Elem> operator()(Elem const* first, Elem const* last) const {
+				Elem const newline = Elem('\n');
+				Elem const* const found = sprout::detail::find_any_char(first, last, &newline, 1);
+				Elem const* const end = found != first && found[-1] == Elem('\r') ? found - 1 : found;
+				sprout::split_result<Elem> const result = {first, end, found != last && found + 1 != last ? found + 1 : 0};
+				return result;
+			}
+		};
+
+		//
+		// lines_forwarder
+		//
+		class lines_forwarder {
+		public:
+			template<typename Elem = char>
+			SPROUT_CONSTEXPR sprout::adaptors::split_holder<sprout::adaptors::line_separator<Elem> >
+			operator()() const {
+				return sprout::adaptors::split_holder<sprout::adaptors::line_separator<Elem> >();
+			}
+		};
+
+		//
+		// lines
+		//
+		namespace {
+			SPROUT_STATIC_CONSTEXPR sprout::adaptors::lines_forwarder lines = {};
+		}	// anonymous-namespace
+
+		//
+		// operator|
+		//
+		template<typename Range>
+		inline SPROUT_CXX14_CONSTEXPR sprout::adaptors::split_range<
+			sprout::adaptors::line_separator<typename std::remove_const<typename sprout::container_traits<
+				typename std::remove_reference<typename sprout::lvalue_reference<Range>::type>::type
+			>::value_type>::type>,
+			typename std::remove_reference<typename sprout::lvalue_reference<Range>::type>::type
+		>
+		operator|(Range&& lhs, sprout::adaptors::lines_forwarder const&) {
+			typedef typename std::remove_reference<typename sprout::lvalue_reference<Range>::type>::type range_type;
+			typedef sprout::adaptors::line_separator<
+				typename std::remove_const<typename sprout::container_traits<range_type>::value_type>::type
+			> splitter_type;
+			return sprout::adaptors::split_range<splitter_type, range_type>(
+				sprout::lvalue_forward<Range>(lhs),
+				splitter_type()
+				);
+		}
+	}	// namespace adaptors
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_RANGE_ADAPTOR_LINES_HPP
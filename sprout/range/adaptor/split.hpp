@@ -0,0 +1,195 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_RANGE_ADAPTOR_SPLIT_HPP
+#define SPROUT_RANGE_ADAPTOR_SPLIT_HPP
+
+#include <stdexcept>
+#include <type_traits>
+#include <sprout/config.hpp>
+#include <sprout/container/traits.hpp>
+#include <sprout/container/functions.hpp>
+#include <sprout/iterator/split_iterator.hpp>
+#include <sprout/range/range_container.hpp>
+#include <sprout/utility/string_view/string_view.hpp>
+#include <sprout/type_traits/lvalue_reference.hpp>
+#include <sprout/utility/lvalue_forward.hpp>
+#include <sprout/detail/char_scan.hpp>
+
+namespace sprout {
+	namespace adaptors {
+		//
+		// char_separator
+		//
+		//	Splits at every occurrence of one character. Empty tokens are kept,
+		//	including a trailing one; an empty range has no tokens.
+		//
+		template<typename Elem>
+		class char_separator {
+		public:
+			typedef Elem char_type;
+		private:
+			Elem delim_;
+		public:
+			SPROUT_CONSTEXPR char_separator()
+				: delim_()
+			{}
+			explicit SPROUT_CONSTEXPR char_separator(Elem delim)
+				: delim_(delim)
+			{}
+			SPROUT_CXX14_CONSTEXPR sprout::split_result<Elem> operator()(Elem const* first, Elem const* last) const {
+				Elem const* const found = sprout::detail::find_any_char(first, last, &delim_, 1);
+				sprout::split_result<Elem> const result = {first, found, found != last ? found + 1 : 0};
+				return result;
+			}
+		};
+
+		//
+		// string_separator
+		//
+		//	As char_separator, at every occurrence of a non-empty string.
+		//
+		template<typename Elem>
+		class string_separator {
+		public:
+			typedef Elem char_type;
+		private:
+			sprout::basic_string_view<Elem> delim_;
+		public:
+			SPROUT_CONSTEXPR string_separator()
+				: delim_()
+			{}
+			explicit SPROUT_CXX14_CONSTEXPR string_separator(sprout::basic_string_view<Elem> const& delim)
+				: delim_(delim)
+			{
+				if (delim.empty()) {
+					throw std::invalid_argument("string_separator: empty delimiter");
+				}
+			}
+			SPROUT_CXX14_CONSTEXPR sprout::split_result<Elem> operator()(Elem const* first, Elem const* last) const {
+				std::size_t const n = delim_.size();
+				for (Elem const* p = first; static_cast<std::size_t>(last - p) >= n; ++p) {
+					p = sprout::detail::find_any_char(p, last - (n - 1), delim_.data(), 1);
+					if (p == last - (n - 1)) {
+						break;
+					}
+					if (delim_.compare(0, n, p, n) == 0) {
+						sprout::split_result<Elem> const result = {first, p, p + n};
+						return result;
+					}
+				}
+				sprout::split_result<Elem> const result = {first, last, 0};
+				return result;
+			}
+		};
+
+		//
+		// split_range
+		//
+		template<typename Splitter, typename Range>
+		class split_range
+			: public sprout::range::range_container<sprout::split_iterator<Splitter> >
+		{
+		public:
+			typedef Splitter splitter_type;
+			typedef Range range_type;
+			typedef sprout::range::range_container<sprout::split_iterator<Splitter> > base_type;
+			typedef typename base_type::iterator iterator;
+		public:
+			SPROUT_CONSTEXPR split_range() SPROUT_DEFAULTED_DEFAULT_CONSTRUCTOR_DECL
+			split_range(split_range const&) = default;
+			SPROUT_CXX14_CONSTEXPR split_range(range_type& range, Splitter const& splitter)
+				: base_type(
+					iterator(splitter, sprout::data(range), sprout::data(range) + sprout::size(range)),
+					iterator()
+					)
+			{}
+		};
+
+		//
+		// split_holder
+		//
+		template<typename Splitter>
+		class split_holder {
+		public:
+			typedef Splitter splitter_type;
+		private:
+			Splitter splitter_;
+		public:
+			SPROUT_CONSTEXPR split_holder()
+				: splitter_()
+			{}
+			explicit SPROUT_CONSTEXPR split_holder(Splitter const& splitter)
+				: splitter_(splitter)
+			{}
+			SPROUT_CONSTEXPR Splitter const& splitter() const {
+				return splitter_;
+			}
+		};
+
+		//
+		// split_forwarder
+		//
+		class split_forwarder {
+		public:
+			template<typename Elem>
+			SPROUT_CONSTEXPR typename std::enable_if<
+				std::is_integral<Elem>::value,
+				sprout::adaptors::split_holder<sprout::adaptors::char_separator<Elem> >
+			>::type
+			operator()(Elem delim) const {
+				return sprout::adaptors::split_holder<sprout::adaptors::char_separator<Elem> >(
+					sprout::adaptors::char_separator<Elem>(delim)
+					);
+			}
+			template<typename Elem>
+			SPROUT_CXX14_CONSTEXPR sprout::adaptors::split_holder<sprout::adaptors::string_separator<Elem> >
+			operator()(Elem const* delim) const {
+				return sprout::adaptors::split_holder<sprout::adaptors::string_separator<Elem> >(
+					sprout::adaptors::string_separator<Elem>(sprout::basic_string_view<Elem>(delim))
+					);
+			}
+			template<typename Elem, typename Traits>
+			SPROUT_CXX14_CONSTEXPR sprout::adaptors::split_holder<sprout::adaptors::string_separator<Elem> >
+			operator()(sprout::basic_string_view<Elem, Traits> const& delim) const {
+				return sprout::adaptors::split_holder<sprout::adaptors::string_separator<Elem> >(
+					sprout::adaptors::string_separator<Elem>(sprout::basic_string_view<Elem>(delim.data(), delim.size()))
+					);
+			}
+		};
+
+		//
+		// split
+		//
+		//	Lazily splits a contiguous character range (a string or a string view)
+		//	into basic_string_view slices of it.
+		//
+		namespace {
+			SPROUT_STATIC_CONSTEXPR sprout::adaptors::split_forwarder split = {};
+		}	// anonymous-namespace
+
+		//
+		// operator|
+		//
+		template<typename Range, typename Splitter>
+		inline SPROUT_CXX14_CONSTEXPR sprout::adaptors::split_range<
+			Splitter,
+			typename std::remove_reference<typename sprout::lvalue_reference<Range>::type>::type
+		>
+		operator|(Range&& lhs, sprout::adaptors::split_holder<Splitter> const& rhs) {
+			return sprout::adaptors::split_range<
+				Splitter,
+				typename std::remove_reference<typename sprout::lvalue_reference<Range>::type>::type
+			>(
+				sprout::lvalue_forward<Range>(lhs),
+				rhs.splitter()
+				);
+		}
+	}	// namespace adaptors
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_RANGE_ADAPTOR_SPLIT_HPP
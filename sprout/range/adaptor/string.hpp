@@ -11,5 +11,9 @@
 #include <sprout/config.hpp>
 #include <sprout/range/adaptor/to_lower.hpp>
 #include <sprout/range/adaptor/to_upper.hpp>
+#include <sprout/range/adaptor/split.hpp>
+#include <sprout/range/adaptor/tokenized.hpp>
+#include <sprout/range/adaptor/lines.hpp>
+#include <sprout/range/adaptor/csv.hpp>
 
 #endif	// #ifndef SPROUT_RANGE_ADAPTOR_STRING_HPP
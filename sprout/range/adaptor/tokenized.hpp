@@ -0,0 +1,92 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_RANGE_ADAPTOR_TOKENIZED_HPP
+#define SPROUT_RANGE_ADAPTOR_TOKENIZED_HPP
+
+#include <sprout/config.hpp>
+#include <sprout/iterator/split_iterator.hpp>
+#include <sprout/range/adaptor/split.hpp>
+#include <sprout/utility/string_view/string_view.hpp>
+#include <sprout/detail/char_scan.hpp>
+
+namespace sprout {
+	namespace adaptors {
+		//
+		// charset_separator
+		//
+		//	Tokens are the maximal runs of characters not in the set, so
+		//	separators never produce empty tokens. The set is referenced, not
+		//	copied.
+		//
+		template<typename Elem>
+		class charset_separator {
+		public:
+			typedef Elem char_type;
+		private:
+			sprout::basic_string_view<Elem> set_;
+		private:
+			SPROUT_CXX14_CONSTEXPR bool in_set(Elem c) const {
+				for (std::size_t i = 0; i != set_.size(); ++i) {
+					if (set_[i] == c) {
+						return true;
+					}
+				}
+				return false;
+			}
+		public:
+			SPROUT_CONSTEXPR charset_separator()
+				: set_()
+			{}
+			explicit SPROUT_CONSTEXPR charset_separator(sprout::basic_string_view<Elem> const& set)
+				: set_(set)
+			{}
+			SPROUT_CXX14_CONSTEXPR sprout::split_result<Elem> operator()(Elem const* first, Elem const* last) const {
+				while (first != last && in_set(*first)) {
+					++first;
+				}
+				if (first == last) {
+					sprout::split_result<Elem> const result = {0, 0, 0};
+					return result;
+				}
+				Elem const* const found = sprout::detail::find_any_char(first, last, set_.data(), set_.size());
+				sprout::split_result<Elem> const result = {first, found, found != last ? found + 1 : 0};
+				return result;
+			}
+		};
+
+		//
+		// tokenized_forwarder
+		//
+		class tokenized_forwarder {
+		public:
+			template<typename Elem>
+			SPROUT_CONSTEXPR sprout::adaptors::split_holder<sprout::adaptors::charset_separator<Elem> >
+			operator()(Elem const* set) const {
+				return sprout::adaptors::split_holder<sprout::adaptors::charset_separator<Elem> >(
+					sprout::adaptors::charset_separator<Elem>(sprout::basic_string_view<Elem>(set))
+					);
+			}
+			template<typename Elem, typename Traits>
+			SPROUT_CONSTEXPR sprout::adaptors::split_holder<sprout::adaptors::charset_separator<Elem> >
+			operator()(sprout::basic_string_view<Elem, Traits> const& set) const {
+				return sprout::adaptors::split_holder<sprout::adaptors::charset_separator<Elem> >(
+					sprout::adaptors::charset_separator<Elem>(sprout::basic_string_view<Elem>(set.data(), set.size()))
+					);
+			}
+		};
+
+		//
+		// tokenized
+		//
+		namespace {
+			SPROUT_STATIC_CONSTEXPR sprout::adaptors::tokenized_forwarder tokenized = {};
+		}	// anonymous-namespace
+	}	// namespace adaptors
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_RANGE_ADAPTOR_TOKENIZED_HPP
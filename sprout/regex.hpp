@@ -0,0 +1,14 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_REGEX_HPP
+#define SPROUT_REGEX_HPP
+
+#include <sprout/config.hpp>
+#include <sprout/regex/regex.hpp>
+
+#endif	// #ifndef SPROUT_REGEX_HPP
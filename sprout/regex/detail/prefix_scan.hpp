@@ -0,0 +1,79 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_REGEX_DETAIL_PREFIX_SCAN_HPP
+#define SPROUT_REGEX_DETAIL_PREFIX_SCAN_HPP
+
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/cstdint.hpp>
+#include <sprout/bit/ctz.hpp>
+#include <sprout/detail/simd.hpp>
+
+namespace sprout {
+	namespace detail {
+		//
+		// prefix_scan
+		//
+		//	First position >= pos at which [prefix, prefix + k) occurs in
+		//	[first, first + n), or n. k must be at least 1.
+		//
+		inline SPROUT_CXX14_CONSTEXPR bool
+		prefix_equal(char const* s, char const* prefix, std::size_t k) {
+			for (std::size_t i = 0; i != k; ++i) {
+				if (s[i] != prefix[i]) {
+					return false;
+				}
+			}
+			return true;
+		}
+		inline SPROUT_CXX14_CONSTEXPR std::size_t
+		prefix_scan_scalar(char const* first, std::size_t n, std::size_t pos, char const* prefix, std::size_t k) {
+			for (; n - pos >= k; ++pos) {
+				if (first[pos] == prefix[0] && sprout::detail::prefix_equal(first + pos + 1, prefix + 1, k - 1)) {
+					return pos;
+				}
+			}
+			return n;
+		}
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+		// compares the first and the last byte of the prefix at 16 positions at once
+		inline std::size_t
+		prefix_scan_sse2(char const* first, std::size_t n, std::size_t pos, char const* prefix, std::size_t k) {
+			__m128i const head = _mm_set1_epi8(prefix[0]);
+			__m128i const tail = _mm_set1_epi8(prefix[k - 1]);
+			for (; n - pos >= k - 1 + 16; pos += 16) {
+				__m128i const a = _mm_loadu_si128(reinterpret_cast<__m128i const*>(first + pos));
+				__m128i const b = _mm_loadu_si128(reinterpret_cast<__m128i const*>(first + pos + k - 1));
+				unsigned m = static_cast<unsigned>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, head), _mm_cmpeq_epi8(b, tail))));
+				for (; m != 0; m &= m - 1) {
+					std::size_t const i = pos + sprout::ctz(m);
+					if (sprout::detail::prefix_equal(first + i + 1, prefix + 1, k - 1)) {
+						return i;
+					}
+				}
+			}
+			return sprout::detail::prefix_scan_scalar(first, n, pos, prefix, k);
+		}
+#endif
+
+		inline SPROUT_CXX14_CONSTEXPR std::size_t
+		prefix_scan(char const* first, std::size_t n, std::size_t pos, char const* prefix, std::size_t k) {
+			if (pos > n) {
+				return n;
+			}
+#if defined(SPROUT_DETAIL_SIMD_SSE2)
+			if (!SPROUT_DETAIL_IS_CONSTANT_EVALUATED()) {
+				return sprout::detail::prefix_scan_sse2(first, n, pos, prefix, k);
+			}
+#endif
+			return sprout::detail::prefix_scan_scalar(first, n, pos, prefix, k);
+		}
+	}	// namespace detail
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_REGEX_DETAIL_PREFIX_SCAN_HPP
@@ -0,0 +1,485 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_REGEX_DETAIL_REGEX_NFA_HPP
+#define SPROUT_REGEX_DETAIL_REGEX_NFA_HPP
+
+#include <stdexcept>
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/cstdint.hpp>
+
+namespace sprout {
+	namespace detail {
+		//
+		// regex_bit_set
+		//
+		//	256 bits: a set of bytes, or a set of NFA states during subset construction.
+		//
+		class regex_bit_set {
+		private:
+			std::uint64_t words_[4];
+		public:
+			SPROUT_CONSTEXPR regex_bit_set()
+				: words_()
+			{}
+			SPROUT_CONSTEXPR bool test(std::size_t i) const {
+				return ((words_[i / 64] >> (i % 64)) & 1) != 0;
+			}
+			SPROUT_CXX14_CONSTEXPR void set(std::size_t i) {
+				words_[i / 64] |= std::uint64_t(1) << (i % 64);
+			}
+			// [first, last]
+			SPROUT_CXX14_CONSTEXPR void set(std::size_t first, std::size_t last) {
+				for (; first <= last; ++first) {
+					set(first);
+				}
+			}
+			SPROUT_CXX14_CONSTEXPR void flip() {
+				for (std::size_t i = 0; i != 4; ++i) {
+					words_[i] = ~words_[i];
+				}
+			}
+			SPROUT_CXX14_CONSTEXPR regex_bit_set& operator|=(regex_bit_set const& rhs) {
+				for (std::size_t i = 0; i != 4; ++i) {
+					words_[i] |= rhs.words_[i];
+				}
+				return *this;
+			}
+			friend SPROUT_CONSTEXPR bool operator==(regex_bit_set const& lhs, regex_bit_set const& rhs) {
+				return lhs.words_[0] == rhs.words_[0] && lhs.words_[1] == rhs.words_[1]
+					&& lhs.words_[2] == rhs.words_[2] && lhs.words_[3] == rhs.words_[3]
+					;
+			}
+		};
+
+		//
+		// regex_nfa_state
+		//
+		//	A bytes state consumes one byte of its set and goes to out0; epsilon
+		//	goes to out0 and split to out0 and out1 without consuming anything.
+		//
+		enum regex_nfa_kind {
+			regex_nfa_epsilon,
+			regex_nfa_split,
+			regex_nfa_bytes,
+			regex_nfa_accept
+		};
+		struct regex_nfa_state {
+		public:
+			sprout::detail::regex_nfa_kind kind;
+			std::size_t out0;
+			std::size_t out1;
+			sprout::detail::regex_bit_set bytes;
+		public:
+			SPROUT_CONSTEXPR regex_nfa_state()
+				: kind(sprout::detail::regex_nfa_epsilon), out0(), out1(), bytes()
+			{}
+		};
+
+		// the last bit of a state set is left free to tag unanchored DFA states
+		SPROUT_STATIC_CONSTEXPR std::size_t regex_nfa_capacity = 255;
+		SPROUT_STATIC_CONSTEXPR std::size_t regex_nfa_null = 255;
+		SPROUT_STATIC_CONSTEXPR std::size_t regex_nesting_limit = 32;
+		SPROUT_STATIC_CONSTEXPR std::size_t regex_repeat_limit = 127;
+
+		//
+		// regex_nfa
+		//
+		//	Thompson construction by recursive descent over the pattern:
+		//
+		//		alternation   := concatenation ('|' concatenation)*
+		//		concatenation := repetition*
+		//		repetition    := atom ('*' | '+' | '?' | '{' m [',' [n]] '}')?
+		//		atom          := '(' alternation ')' | '[' class ']' | '.' | '\' escape | byte
+		//
+		//	A counted repetition is expanded by parsing its atom again for every copy.
+		//
+		class regex_nfa {
+		private:
+			struct fragment {
+			public:
+				std::size_t first;
+				std::size_t last;
+			};
+		private:
+			sprout::detail::regex_nfa_state states_[sprout::detail::regex_nfa_capacity];
+			std::size_t size_;
+			std::size_t start_;
+			std::size_t accept_;
+			char const* pattern_;
+			std::size_t length_;
+			std::size_t pos_;
+		private:
+			static SPROUT_CONSTEXPR bool is_alnum(char c) {
+				return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+			}
+			static SPROUT_CONSTEXPR int hex_value(char c) {
+				return c >= '0' && c <= '9' ? c - '0'
+					: c >= 'a' && c <= 'f' ? c - 'a' + 10
+					: c >= 'A' && c <= 'F' ? c - 'A' + 10
+					: -1
+					;
+			}
+			SPROUT_CONSTEXPR bool at(char c) const {
+				return pos_ != length_ && pattern_[pos_] == c;
+			}
+			SPROUT_CXX14_CONSTEXPR std::size_t
+			add(sprout::detail::regex_nfa_kind kind, std::size_t out0, std::size_t out1) {
+				if (size_ == sprout::detail::regex_nfa_capacity) {
+					throw std::length_error("regex: pattern too large");
+				}
+				states_[size_].kind = kind;
+				states_[size_].out0 = out0;
+				states_[size_].out1 = out1;
+				return size_++;
+			}
+			// fills the one dangling out of a fragment's last state
+			SPROUT_CXX14_CONSTEXPR void link(std::size_t from, std::size_t to) {
+				if (states_[from].kind == sprout::detail::regex_nfa_split) {
+					states_[from].out1 = to;
+				} else {
+					states_[from].out0 = to;
+				}
+			}
+			SPROUT_CXX14_CONSTEXPR fragment empty() {
+				std::size_t const e = add(sprout::detail::regex_nfa_epsilon, sprout::detail::regex_nfa_null, sprout::detail::regex_nfa_null);
+				fragment const result = {e, e};
+				return result;
+			}
+			SPROUT_CXX14_CONSTEXPR fragment bytes(sprout::detail::regex_bit_set const& set) {
+				std::size_t const s = add(sprout::detail::regex_nfa_bytes, sprout::detail::regex_nfa_null, sprout::detail::regex_nfa_null);
+				states_[s].bytes = set;
+				fragment const result = {s, s};
+				return result;
+			}
+			SPROUT_CXX14_CONSTEXPR fragment concatenate(fragment const& lhs, fragment const& rhs) {
+				link(lhs.last, rhs.first);
+				fragment const result = {lhs.first, rhs.last};
+				return result;
+			}
+			SPROUT_CXX14_CONSTEXPR fragment alternate(fragment const& lhs, fragment const& rhs) {
+				std::size_t const s = add(sprout::detail::regex_nfa_split, lhs.first, rhs.first);
+				std::size_t const e = add(sprout::detail::regex_nfa_epsilon, sprout::detail::regex_nfa_null, sprout::detail::regex_nfa_null);
+				link(lhs.last, e);
+				link(rhs.last, e);
+				fragment const result = {s, e};
+				return result;
+			}
+			SPROUT_CXX14_CONSTEXPR fragment star(fragment const& f) {
+				std::size_t const s = add(sprout::detail::regex_nfa_split, f.first, sprout::detail::regex_nfa_null);
+				link(f.last, s);
+				fragment const result = {s, s};
+				return result;
+			}
+			SPROUT_CXX14_CONSTEXPR fragment plus(fragment const& f) {
+				std::size_t const s = add(sprout::detail::regex_nfa_split, f.first, sprout::detail::regex_nfa_null);
+				link(f.last, s);
+				fragment const result = {f.first, s};
+				return result;
+			}
+			SPROUT_CXX14_CONSTEXPR fragment question(fragment const& f) {
+				std::size_t const e = add(sprout::detail::regex_nfa_epsilon, sprout::detail::regex_nfa_null, sprout::detail::regex_nfa_null);
+				std::size_t const s = add(sprout::detail::regex_nfa_split, f.first, e);
+				link(f.last, e);
+				fragment const result = {s, e};
+				return result;
+			}
+			SPROUT_CXX14_CONSTEXPR fragment reparse_atom(std::size_t atom, std::size_t depth) {
+				std::size_t const pos = pos_;
+				pos_ = atom;
+				fragment const result = parse_atom(depth);
+				pos_ = pos;
+				return result;
+			}
+			// f{m,n}; n == regex_nfa_null means unbounded
+			SPROUT_CXX14_CONSTEXPR fragment
+			repeat(fragment const& f, std::size_t atom, std::size_t depth, std::size_t m, std::size_t n) {
+				fragment result = empty();
+				for (std::size_t i = 0; i != m; ++i) {
+					result = concatenate(result, i == 0 ? f : reparse_atom(atom, depth));
+				}
+				if (n == sprout::detail::regex_nfa_null) {
+					return concatenate(result, star(m == 0 ? f : reparse_atom(atom, depth)));
+				}
+				for (std::size_t i = m; i != n; ++i) {
+					result = concatenate(result, question(i == 0 ? f : reparse_atom(atom, depth)));
+				}
+				return result;
+			}
+			SPROUT_CXX14_CONSTEXPR std::size_t parse_count() {
+				std::size_t n = 0;
+				if (pos_ == length_ || pattern_[pos_] < '0' || pattern_[pos_] > '9') {
+					throw std::invalid_argument("regex: bad repetition count");
+				}
+				for (; pos_ != length_ && pattern_[pos_] >= '0' && pattern_[pos_] <= '9'; ++pos_) {
+					n = n * 10 + (pattern_[pos_] - '0');
+					if (n > sprout::detail::regex_repeat_limit) {
+						throw std::invalid_argument("regex: repetition count too large");
+					}
+				}
+				return n;
+			}
+			// \d \w \s and their complements; false for anything else
+			static SPROUT_CXX14_CONSTEXPR bool
+			shorthand(char c, sprout::detail::regex_bit_set& set) {
+				sprout::detail::regex_bit_set s;
+				switch (c) {
+				case 'd': case 'D':
+					s.set('0', '9');
+					break;
+				case 'w': case 'W':
+					s.set('0', '9');
+					s.set('a', 'z');
+					s.set('A', 'Z');
+					s.set('_');
+					break;
+				case 's': case 'S':
+					s.set('\t', '\r');
+					s.set(' ');
+					break;
+				default:
+					return false;
+				}
+				if (c == 'D' || c == 'W' || c == 'S') {
+					s.flip();
+				}
+				set |= s;
+				return true;
+			}
+			// after '\'; adds a shorthand class to set and returns -1, or returns the escaped byte
+			SPROUT_CXX14_CONSTEXPR int parse_escape(sprout::detail::regex_bit_set& set) {
+				if (pos_ == length_) {
+					throw std::invalid_argument("regex: trailing '\\'");
+				}
+				char const c = pattern_[pos_++];
+				if (shorthand(c, set)) {
+					return -1;
+				}
+				switch (c) {
+				case 'n':
+					return '\n';
+				case 'r':
+					return '\r';
+				case 't':
+					return '\t';
+				case 'f':
+					return '\f';
+				case 'v':
+					return '\v';
+				case '0':
+					return 0;
+				case 'x':
+					if (length_ - pos_ < 2 || hex_value(pattern_[pos_]) < 0 || hex_value(pattern_[pos_ + 1]) < 0) {
+						throw std::invalid_argument("regex: bad '\\x' escape");
+					}
+					pos_ += 2;
+					return hex_value(pattern_[pos_ - 2]) * 16 + hex_value(pattern_[pos_ - 1]);
+				}
+				if (is_alnum(c)) {
+					throw std::invalid_argument("regex: unknown escape");
+				}
+				return static_cast<unsigned char>(c);
+			}
+			SPROUT_CXX14_CONSTEXPR int parse_class_byte(sprout::detail::regex_bit_set& set) {
+				char const c = pattern_[pos_++];
+				return c == '\\' ? parse_escape(set) : static_cast<unsigned char>(c);
+			}
+			// after '['
+			SPROUT_CXX14_CONSTEXPR sprout::detail::regex_bit_set parse_class() {
+				sprout::detail::regex_bit_set set;
+				bool const negate = at('^');
+				if (negate) {
+					++pos_;
+				}
+				for (bool first = true; ; first = false) {
+					if (pos_ == length_) {
+						throw std::invalid_argument("regex: missing ']'");
+					}
+					if (pattern_[pos_] == ']' && !first) {
+						++pos_;
+						break;
+					}
+					int const lo = parse_class_byte(set);
+					if (lo < 0) {
+						continue;
+					}
+					if (length_ - pos_ >= 2 && pattern_[pos_] == '-' && pattern_[pos_ + 1] != ']') {
+						++pos_;
+						int const hi = parse_class_byte(set);
+						if (hi < lo) {
+							throw std::invalid_argument("regex: bad class range");
+						}
+						set.set(lo, hi);
+					} else {
+						set.set(lo);
+					}
+				}
+				if (negate) {
+					set.flip();
+				}
+				return set;
+			}
+			SPROUT_CXX14_CONSTEXPR fragment parse_atom(std::size_t depth) {
+				char const c = pattern_[pos_++];
+				sprout::detail::regex_bit_set set;
+				switch (c) {
+				case '(':
+					{
+						if (depth == sprout::detail::regex_nesting_limit) {
+							throw std::invalid_argument("regex: nesting too deep");
+						}
+						fragment const result = parse_alternation(depth + 1);
+						if (!at(')')) {
+							throw std::invalid_argument("regex: missing ')'");
+						}
+						++pos_;
+						return result;
+					}
+				case '[':
+					return bytes(parse_class());
+				case '.':
+					set.set('\n');
+					set.flip();
+					return bytes(set);
+				case '\\':
+					{
+						int const b = parse_escape(set);
+						if (b >= 0) {
+							set.set(b);
+						}
+						return bytes(set);
+					}
+				case '*': case '+': case '?': case '{':
+					throw std::invalid_argument("regex: nothing to repeat");
+				case '^': case '$':
+					throw std::invalid_argument("regex: anchors are not supported");
+				}
+				set.set(static_cast<unsigned char>(c));
+				return bytes(set);
+			}
+			SPROUT_CXX14_CONSTEXPR fragment parse_repetition(std::size_t depth) {
+				std::size_t const atom = pos_;
+				fragment const f = parse_atom(depth);
+				if (pos_ == length_) {
+					return f;
+				}
+				fragment result = f;
+				switch (pattern_[pos_++]) {
+				case '*':
+					result = star(f);
+					break;
+				case '+':
+					result = plus(f);
+					break;
+				case '?':
+					result = question(f);
+					break;
+				case '{':
+					{
+						std::size_t const m = parse_count();
+						std::size_t n = m;
+						if (at(',')) {
+							++pos_;
+							n = at('}') ? sprout::detail::regex_nfa_null : parse_count();
+						}
+						if (!at('}') || n < m) {
+							throw std::invalid_argument("regex: bad repetition");
+						}
+						++pos_;
+						result = repeat(f, atom, depth, m, n);
+					}
+					break;
+				default:
+					--pos_;
+					return f;
+				}
+				if (at('*') || at('+') || at('?') || at('{')) {
+					throw std::invalid_argument("regex: nothing to repeat");
+				}
+				return result;
+			}
+			SPROUT_CXX14_CONSTEXPR fragment parse_concatenation(std::size_t depth) {
+				fragment result = empty();
+				while (pos_ != length_ && pattern_[pos_] != '|' && pattern_[pos_] != ')') {
+					result = concatenate(result, parse_repetition(depth));
+				}
+				return result;
+			}
+			SPROUT_CXX14_CONSTEXPR fragment parse_alternation(std::size_t depth) {
+				fragment result = parse_concatenation(depth);
+				while (at('|')) {
+					++pos_;
+					result = alternate(result, parse_concatenation(depth));
+				}
+				return result;
+			}
+		public:
+			SPROUT_CXX14_CONSTEXPR regex_nfa(char const* pattern, std::size_t length)
+				: states_(), size_(), start_(), accept_(), pattern_(pattern), length_(length), pos_()
+			{
+				fragment const f = parse_alternation(0);
+				if (pos_ != length_) {
+					throw std::invalid_argument("regex: unmatched ')'");
+				}
+				accept_ = add(sprout::detail::regex_nfa_accept, sprout::detail::regex_nfa_null, sprout::detail::regex_nfa_null);
+				link(f.last, accept_);
+				start_ = f.first;
+			}
+			SPROUT_CONSTEXPR std::size_t size() const {
+				return size_;
+			}
+			SPROUT_CONSTEXPR std::size_t start() const {
+				return start_;
+			}
+			SPROUT_CONSTEXPR std::size_t accept() const {
+				return accept_;
+			}
+			SPROUT_CONSTEXPR sprout::detail::regex_nfa_state const& operator[](std::size_t i) const {
+				return states_[i];
+			}
+			// the states reachable from seeds without consuming input, keeping only bytes and accept states
+			SPROUT_CXX14_CONSTEXPR sprout::detail::regex_bit_set
+			closure(sprout::detail::regex_bit_set const& seeds) const {
+				std::size_t stack[sprout::detail::regex_nfa_capacity] = {};
+				std::size_t top = 0;
+				sprout::detail::regex_bit_set visited;
+				sprout::detail::regex_bit_set result;
+				for (std::size_t i = 0; i != size_; ++i) {
+					if (seeds.test(i)) {
+						visited.set(i);
+						stack[top++] = i;
+					}
+				}
+				while (top != 0) {
+					sprout::detail::regex_nfa_state const& s = states_[stack[--top]];
+					switch (s.kind) {
+					case sprout::detail::regex_nfa_bytes:
+					case sprout::detail::regex_nfa_accept:
+						result.set(stack[top]);
+						break;
+					case sprout::detail::regex_nfa_split:
+						if (!visited.test(s.out1)) {
+							visited.set(s.out1);
+							stack[top++] = s.out1;
+						}
+						// fall through
+					case sprout::detail::regex_nfa_epsilon:
+						if (!visited.test(s.out0)) {
+							visited.set(s.out0);
+							stack[top++] = s.out0;
+						}
+						break;
+					}
+				}
+				return result;
+			}
+		};
+	}	// namespace detail
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_REGEX_DETAIL_REGEX_NFA_HPP
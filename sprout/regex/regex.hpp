@@ -0,0 +1,349 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_REGEX_REGEX_HPP
+#define SPROUT_REGEX_REGEX_HPP
+
+#include <stdexcept>
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/cstdint.hpp>
+#include <sprout/array/array.hpp>
+#include <sprout/utility/pair/pair.hpp>
+#include <sprout/utility/string_view/string_view.hpp>
+#include <sprout/utility/string_view/alias.hpp>
+#include <sprout/string/npos.hpp>
+#include <sprout/regex/detail/regex_nfa.hpp>
+#include <sprout/regex/detail/prefix_scan.hpp>
+
+namespace sprout {
+	//
+	// regex
+	//
+	//	A pattern compiled to a DFA over bytes: Thompson NFA construction, then
+	//	subset construction, both C++14 constexpr.
+	//
+	//	Bytes are first partitioned into classes that no pattern byte set tells
+	//	apart, and the transition table is a flat array of states * classes with
+	//	each entry premultiplied by the class count, so a step is one load.
+	//	State 0 is dead and accepting states are numbered last.
+	//
+	//	The table also carries unanchored states for search: the set of threads
+	//	in flight, with the NFA start added back before every byte. The one with
+	//	nothing in flight bounds where the leftmost match can begin, and a
+	//	literal prefix shared by every match is scanned for with SIMD from there.
+	//
+	//	Syntax: literals, ., [...], [^...], \d \w \s \D \W \S, escapes,
+	//	(...), |, *, +, ?, {m}, {m,}, {m,n}. No anchors, no captures.
+	//
+	template<std::size_t MaxStates = 128, std::size_t MaxClasses = 32>
+	class regex {
+		static_assert(MaxStates >= 2, "MaxStates >= 2");
+		static_assert(MaxClasses >= 1 && MaxClasses <= 256, "1 <= MaxClasses <= 256");
+		static_assert(MaxStates * MaxClasses <= 65536, "MaxStates * MaxClasses <= 65536");
+	public:
+		typedef std::size_t size_type;
+		typedef std::uint16_t state_type;
+		typedef sprout::array<std::uint8_t, 256> class_table_type;
+		typedef sprout::array<state_type, MaxStates * MaxClasses> transition_table_type;
+		typedef sprout::pair<size_type, size_type> position_type;
+	public:
+		SPROUT_STATIC_CONSTEXPR size_type npos = sprout::npos_t::get<size_type>::value;
+		SPROUT_STATIC_CONSTEXPR size_type max_states = MaxStates;
+		SPROUT_STATIC_CONSTEXPR size_type max_classes = MaxClasses;
+		SPROUT_STATIC_CONSTEXPR size_type max_prefix = 16;
+	private:
+		class_table_type classes_;
+		transition_table_type transitions_;
+		size_type class_count_;
+		size_type state_count_;
+		size_type start_;
+		size_type search_start_;
+		size_type accept_begin_;
+		sprout::array<char, max_prefix> prefix_;
+		size_type prefix_size_;
+	private:
+		static SPROUT_CXX14_CONSTEXPR size_type
+		intern(sprout::array<sprout::detail::regex_bit_set, MaxStates>& sets, size_type& count, sprout::detail::regex_bit_set const& set) {
+			for (size_type i = 0; i != count; ++i) {
+				if (sets[i] == set) {
+					return i;
+				}
+			}
+			if (count == MaxStates) {
+				throw std::length_error("regex: too many DFA states");
+			}
+			sets[count] = set;
+			return count++;
+		}
+		SPROUT_CXX14_CONSTEXPR void build_classes(sprout::detail::regex_nfa const& nfa) {
+			class_count_ = 1;
+			for (size_type i = 0; i != nfa.size(); ++i) {
+				if (nfa[i].kind != sprout::detail::regex_nfa_bytes) {
+					continue;
+				}
+				// split every class into its bytes inside and outside the set
+				sprout::array<size_type, 512> split{{}};
+				size_type count = 0;
+				for (size_type b = 0; b != 256; ++b) {
+					size_type const key = classes_[b] * 2 + (nfa[i].bytes.test(b) ? 1 : 0);
+					if (split[key] == 0) {
+						split[key] = ++count;
+					}
+					classes_[b] = static_cast<std::uint8_t>(split[key] - 1);
+				}
+				class_count_ = count;
+			}
+			if (class_count_ > MaxClasses) {
+				throw std::length_error("regex: too many byte classes");
+			}
+		}
+		SPROUT_CXX14_CONSTEXPR void build(sprout::detail::regex_nfa const& nfa) {
+			build_classes(nfa);
+			sprout::array<std::uint8_t, MaxClasses> representative{{}};
+			for (size_type b = 256; b != 0; --b) {
+				representative[classes_[b - 1]] = static_cast<std::uint8_t>(b - 1);
+			}
+			// subset construction; sets[0] is the empty (dead) set
+			sprout::array<sprout::detail::regex_bit_set, MaxStates> sets{};
+			sprout::array<bool, MaxStates> accepting{{}};
+			sprout::array<state_type, MaxStates * MaxClasses> next{{}};
+			size_type count = 1;
+			sprout::detail::regex_bit_set seed;
+			seed.set(nfa.start());
+			sprout::detail::regex_bit_set const initial = nfa.closure(seed);
+			sprout::detail::regex_bit_set searching;
+			searching.set(sprout::detail::regex_nfa_capacity);
+			size_type const start = intern(sets, count, initial);
+			size_type const search_start = intern(sets, count, searching);
+			for (size_type i = 1; i != count; ++i) {
+				bool const unanchored = sets[i].test(sprout::detail::regex_nfa_capacity);
+				sprout::detail::regex_bit_set current = sets[i];
+				if (unanchored) {
+					current |= initial;
+				}
+				accepting[i] = current.test(nfa.accept());
+				for (size_type c = 0; c != class_count_; ++c) {
+					sprout::detail::regex_bit_set moved;
+					for (size_type j = 0; j != nfa.size(); ++j) {
+						if (current.test(j) && nfa[j].kind == sprout::detail::regex_nfa_bytes && nfa[j].bytes.test(representative[c])) {
+							moved.set(nfa[j].out0);
+						}
+					}
+					sprout::detail::regex_bit_set target = nfa.closure(moved);
+					if (unanchored) {
+						target.set(sprout::detail::regex_nfa_capacity);
+					}
+					next[i * MaxClasses + c] = static_cast<state_type>(intern(sets, count, target));
+				}
+			}
+			// literal prefix: follow the only live transition while it is on a single byte
+			for (size_type s = start; prefix_size_ != max_prefix && !accepting[s]; ) {
+				size_type live = class_count_;
+				for (size_type c = 0; c != class_count_; ++c) {
+					if (next[s * MaxClasses + c] != 0) {
+						live = live == class_count_ ? c : class_count_ + 1;
+					}
+				}
+				if (live >= class_count_) {
+					break;
+				}
+				size_type bytes = 0;
+				for (size_type b = 0; b != 256; ++b) {
+					bytes += classes_[b] == live ? 1 : 0;
+				}
+				if (bytes != 1) {
+					break;
+				}
+				prefix_[prefix_size_++] = static_cast<char>(representative[live]);
+				s = next[s * MaxClasses + live];
+			}
+			// renumber: dead, then the rest, then the accepting states
+			sprout::array<size_type, MaxStates> order{{}};
+			size_type n = 1;
+			for (size_type i = 1; i != count; ++i) {
+				if (!accepting[i]) {
+					order[i] = n++;
+				}
+			}
+			accept_begin_ = n * class_count_;
+			for (size_type i = 1; i != count; ++i) {
+				if (accepting[i]) {
+					order[i] = n++;
+				}
+			}
+			for (size_type i = 0; i != count; ++i) {
+				for (size_type c = 0; c != class_count_; ++c) {
+					transitions_[order[i] * class_count_ + c] = static_cast<state_type>(order[next[i * MaxClasses + c]] * class_count_);
+				}
+			}
+			state_count_ = count;
+			start_ = order[start] * class_count_;
+			search_start_ = order[search_start] * class_count_;
+		}
+		SPROUT_CXX14_CONSTEXPR size_type step(size_type s, char c) const {
+			return transitions_[s + classes_[static_cast<unsigned char>(c)]];
+		}
+		// length of the longest match at pos, or npos
+		SPROUT_CXX14_CONSTEXPR size_type longest(char const* first, size_type n, size_type pos) const {
+			size_type s = start_;
+			size_type result = s >= accept_begin_ ? 0 : npos;
+			for (size_type i = pos; i != n; ) {
+				s = step(s, first[i++]);
+				if (s == 0) {
+					break;
+				}
+				if (s >= accept_begin_) {
+					result = i - pos;
+				}
+			}
+			return result;
+		}
+		// end of the match that ends first, or npos; no match begins before from
+		SPROUT_CXX14_CONSTEXPR size_type earliest(char const* first, size_type n, size_type& from) const {
+			from = 0;
+			if (search_start_ >= accept_begin_) {
+				return 0;
+			}
+			for (size_type i = 0; ; ) {
+				if (prefix_size_ != 0) {
+					i = sprout::detail::prefix_scan(first, n, i, prefix_.data(), prefix_size_);
+				}
+				from = i;
+				size_type s = search_start_;
+				while (i != n) {
+					s = step(s, first[i++]);
+					if (s >= accept_begin_) {
+						return i;
+					}
+					if (s == search_start_) {
+						// nothing in flight
+						if (prefix_size_ != 0) {
+							break;
+						}
+						from = i;
+					}
+				}
+				if (i == n) {
+					return npos;
+				}
+			}
+		}
+		SPROUT_CXX14_CONSTEXPR bool match_impl(char const* first, size_type n) const {
+			size_type s = start_;
+			for (size_type i = 0; i != n; ++i) {
+				s = step(s, first[i]);
+				if (s == 0) {
+					return false;
+				}
+			}
+			return s >= accept_begin_;
+		}
+		SPROUT_CXX14_CONSTEXPR position_type find_impl(char const* first, size_type n) const {
+			size_type from = 0;
+			size_type const end = earliest(first, n, from);
+			if (end == npos) {
+				return position_type(npos, 0);
+			}
+			// the leftmost match starts no later than the earliest end
+			for (size_type i = from; i <= end; ++i) {
+				if (prefix_size_ != 0) {
+					i = sprout::detail::prefix_scan(first, n, i, prefix_.data(), prefix_size_);
+				}
+				size_type const length = longest(first, n, i);
+				if (length != npos) {
+					return position_type(i, length);
+				}
+			}
+			return position_type(npos, 0);
+		}
+	public:
+		SPROUT_CXX14_CONSTEXPR regex(char const* pattern, size_type length)
+			: classes_(), transitions_(), class_count_(), state_count_(), start_(), search_start_(), accept_begin_()
+			, prefix_(), prefix_size_()
+		{
+			build(sprout::detail::regex_nfa(pattern, length));
+		}
+		template<typename Traits>
+		SPROUT_CXX14_CONSTEXPR explicit regex(sprout::basic_string_view<char, Traits> const& pattern)
+			: classes_(), transitions_(), class_count_(), state_count_(), start_(), search_start_(), accept_begin_()
+			, prefix_(), prefix_size_()
+		{
+			build(sprout::detail::regex_nfa(pattern.data(), pattern.size()));
+		}
+		SPROUT_CXX14_CONSTEXPR explicit regex(char const* pattern)
+			: classes_(), transitions_(), class_count_(), state_count_(), start_(), search_start_(), accept_begin_()
+			, prefix_(), prefix_size_()
+		{
+			build(sprout::detail::regex_nfa(pattern, sprout::basic_string_view<char>(pattern).size()));
+		}
+		// whole-string match
+		template<typename Traits>
+		SPROUT_CXX14_CONSTEXPR bool match(sprout::basic_string_view<char, Traits> const& s) const {
+			return match_impl(s.data(), s.size());
+		}
+		SPROUT_CXX14_CONSTEXPR bool match(char const* s) const {
+			return match(sprout::basic_string_view<char>(s));
+		}
+		// some substring matches
+		template<typename Traits>
+		SPROUT_CXX14_CONSTEXPR bool search(sprout::basic_string_view<char, Traits> const& s) const {
+			size_type from = 0;
+			return earliest(s.data(), s.size(), from) != npos;
+		}
+		SPROUT_CXX14_CONSTEXPR bool search(char const* s) const {
+			return search(sprout::basic_string_view<char>(s));
+		}
+		// position and length of the leftmost-longest match; position is npos if none
+		template<typename Traits>
+		SPROUT_CXX14_CONSTEXPR position_type find(sprout::basic_string_view<char, Traits> const& s) const {
+			return find_impl(s.data(), s.size());
+		}
+		SPROUT_CXX14_CONSTEXPR position_type find(char const* s) const {
+			return find(sprout::basic_string_view<char>(s));
+		}
+		// observers
+		SPROUT_CONSTEXPR size_type state_count() const SPROUT_NOEXCEPT {
+			return state_count_;
+		}
+		SPROUT_CONSTEXPR size_type class_count() const SPROUT_NOEXCEPT {
+			return class_count_;
+		}
+		SPROUT_CONSTEXPR class_table_type const& class_table() const SPROUT_NOEXCEPT {
+			return classes_;
+		}
+		SPROUT_CONSTEXPR transition_table_type const& transition_table() const SPROUT_NOEXCEPT {
+			return transitions_;
+		}
+		SPROUT_CONSTEXPR sprout::basic_string_view<char> literal_prefix() const SPROUT_NOEXCEPT {
+			return sprout::basic_string_view<char>(prefix_.data(), prefix_size_);
+		}
+	};
+	template<std::size_t MaxStates, std::size_t MaxClasses>
+	SPROUT_CONSTEXPR_OR_CONST typename sprout::regex<MaxStates, MaxClasses>::size_type
+	sprout::regex<MaxStates, MaxClasses>::npos;
+	template<std::size_t MaxStates, std::size_t MaxClasses>
+	SPROUT_CONSTEXPR_OR_CONST typename sprout::regex<MaxStates, MaxClasses>::size_type
+	sprout::regex<MaxStates, MaxClasses>::max_states;
+	template<std::size_t MaxStates, std::size_t MaxClasses>
+	SPROUT_CONSTEXPR_OR_CONST typename sprout::regex<MaxStates, MaxClasses>::size_type
+	sprout::regex<MaxStates, MaxClasses>::max_classes;
+	template<std::size_t MaxStates, std::size_t MaxClasses>
+	SPROUT_CONSTEXPR_OR_CONST typename sprout::regex<MaxStates, MaxClasses>::size_type
+	sprout::regex<MaxStates, MaxClasses>::max_prefix;
+
+	//
+	// make_regex
+	//
+	template<std::size_t MaxStates = 128, std::size_t MaxClasses = 32, std::size_t N>
+	inline SPROUT_CXX14_CONSTEXPR sprout::regex<MaxStates, MaxClasses>
+	make_regex(char const (&pattern)[N]) {
+		return sprout::regex<MaxStates, MaxClasses>(pattern, N - 1);
+	}
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_REGEX_REGEX_HPP
@@ -0,0 +1,15 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_STATIC_MAP_HPP
+#define SPROUT_STATIC_MAP_HPP
+
+#include <sprout/config.hpp>
+#include <sprout/static_map/static_map.hpp>
+#include <sprout/static_map/static_set.hpp>
+
+#endif	// #ifndef SPROUT_STATIC_MAP_HPP
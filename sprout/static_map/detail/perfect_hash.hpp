@@ -0,0 +1,159 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_STATIC_MAP_DETAIL_PERFECT_HASH_HPP
+#define SPROUT_STATIC_MAP_DETAIL_PERFECT_HASH_HPP
+
+#include <stdexcept>
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/cstdint.hpp>
+#include <sprout/array/array.hpp>
+
+namespace sprout {
+	namespace detail {
+		inline SPROUT_CONSTEXPR std::uint64_t
+		perfect_hash_mix_2(std::uint64_t z) {
+			return z ^ (z >> 31);
+		}
+		inline SPROUT_CONSTEXPR std::uint64_t
+		perfect_hash_mix_1(std::uint64_t z) {
+			return sprout::detail::perfect_hash_mix_2((z ^ (z >> 27)) * UINT64_C(0x94D049BB133111EB));
+		}
+		inline SPROUT_CONSTEXPR std::uint64_t
+		perfect_hash_mix(std::uint64_t z) {
+			return sprout::detail::perfect_hash_mix_1((z ^ (z >> 30)) * UINT64_C(0xBF58476D1CE4E5B9));
+		}
+
+		//
+		// perfect_hash_layout
+		//
+		//	Hash-and-displace (CHD-style) minimal perfect hash of N keys: keys are
+		//	split into about N / 4 buckets, and each bucket stores a displacement d
+		//	so that slot = mix(h ^ d * phi) % N is collision-free over all keys.
+		//	A lookup is two mixes, one displacement load and one key compare.
+		//
+		template<std::size_t N>
+		class perfect_hash_layout {
+		public:
+			typedef std::size_t size_type;
+		public:
+			SPROUT_STATIC_CONSTEXPR size_type static_size = N;
+			SPROUT_STATIC_CONSTEXPR size_type bucket_count = N / 4 + 1;
+			SPROUT_STATIC_CONSTEXPR size_type max_trials = 64;
+		private:
+			std::uint64_t seed_;
+			sprout::array<std::uint32_t, bucket_count> displacement_;
+		private:
+			static SPROUT_CONSTEXPR size_type
+			bucket_of(std::uint64_t h, std::uint64_t seed) {
+				return static_cast<size_type>(sprout::detail::perfect_hash_mix(h ^ seed) % bucket_count);
+			}
+			static SPROUT_CONSTEXPR size_type
+			slot_of(std::uint64_t h, std::uint64_t seed, std::uint32_t d) {
+				return static_cast<size_type>(
+					sprout::detail::perfect_hash_mix(h ^ ~seed ^ (d * UINT64_C(0x9E3779B97F4A7C15))) % (N != 0 ? N : 1)
+					);
+			}
+			// returns false when the seed has to change
+			SPROUT_CXX14_CONSTEXPR bool
+			try_build(sprout::array<std::uint64_t, N> const& hashes, sprout::array<size_type, N>& slots) {
+				sprout::array<size_type, bucket_count> sizes{{}};
+				sprout::array<size_type, bucket_count + 1> starts{{}};
+				sprout::array<size_type, N> members{{}};
+				sprout::array<bool, N> taken{{}};
+				size_type largest = 0;
+				for (size_type i = 0; i != N; ++i) {
+					size_type const s = ++sizes[bucket_of(hashes[i], seed_)];
+					largest = s > largest ? s : largest;
+				}
+				for (size_type b = 0; b != bucket_count; ++b) {
+					starts[b + 1] = starts[b] + sizes[b];
+				}
+				{
+					sprout::array<size_type, bucket_count> fill{{}};
+					for (size_type i = 0; i != N; ++i) {
+						size_type const b = bucket_of(hashes[i], seed_);
+						members[starts[b] + fill[b]++] = i;
+					}
+				}
+				// largest buckets first
+				for (size_type s = largest; s != 0; --s) {
+					for (size_type b = 0; b != bucket_count; ++b) {
+						if (sizes[b] != s) {
+							continue;
+						}
+						std::uint32_t d = 0;
+						for (; ; ++d) {
+							if (d == 4 * N + 1024) {
+								return false;
+							}
+							bool ok = true;
+							for (size_type k = starts[b]; ok && k != starts[b + 1]; ++k) {
+								size_type const p = slot_of(hashes[members[k]], seed_, d);
+								ok = !taken[p];
+								for (size_type l = starts[b]; ok && l != k; ++l) {
+									if (hashes[members[l]] == hashes[members[k]]) {
+										throw std::invalid_argument("perfect_hash: duplicate keys or equal hash values");
+									}
+									ok = slot_of(hashes[members[l]], seed_, d) != p;
+								}
+							}
+							if (ok) {
+								break;
+							}
+						}
+						displacement_[b] = d;
+						for (size_type k = starts[b]; k != starts[b + 1]; ++k) {
+							size_type const p = slot_of(hashes[members[k]], seed_, d);
+							taken[p] = true;
+							slots[members[k]] = p;
+						}
+					}
+				}
+				return true;
+			}
+		public:
+			SPROUT_CONSTEXPR perfect_hash_layout()
+				: seed_(0), displacement_{{}}
+			{}
+			//
+			// build
+			//	slots[i] receives the slot of the key whose hash is hashes[i].
+			//
+			SPROUT_CXX14_CONSTEXPR void
+			build(sprout::array<std::uint64_t, N> const& hashes, sprout::array<size_type, N>& slots) {
+				for (size_type trial = 0; trial != max_trials; ++trial) {
+					seed_ = sprout::detail::perfect_hash_mix(trial + 1);
+					displacement_ = sprout::array<std::uint32_t, bucket_count>{{}};
+					if (try_build(hashes, slots)) {
+						return;
+					}
+				}
+				throw std::invalid_argument("perfect_hash: construction failed");
+			}
+			SPROUT_CONSTEXPR size_type
+			operator()(std::uint64_t h) const {
+				return slot_of(h, seed_, displacement_[bucket_of(h, seed_)]);
+			}
+			SPROUT_CONSTEXPR std::uint64_t seed() const {
+				return seed_;
+			}
+		};
+		template<std::size_t N>
+		SPROUT_CONSTEXPR_OR_CONST typename sprout::detail::perfect_hash_layout<N>::size_type
+		sprout::detail::perfect_hash_layout<N>::static_size;
+		template<std::size_t N>
+		SPROUT_CONSTEXPR_OR_CONST typename sprout::detail::perfect_hash_layout<N>::size_type
+		sprout::detail::perfect_hash_layout<N>::bucket_count;
+		template<std::size_t N>
+		SPROUT_CONSTEXPR_OR_CONST typename sprout::detail::perfect_hash_layout<N>::size_type
+		sprout::detail::perfect_hash_layout<N>::max_trials;
+	}	// namespace detail
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_STATIC_MAP_DETAIL_PERFECT_HASH_HPP
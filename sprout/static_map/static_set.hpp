@@ -0,0 +1,149 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_STATIC_MAP_STATIC_SET_HPP
+#define SPROUT_STATIC_MAP_STATIC_SET_HPP
+
+#include <stdexcept>
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/cstdint.hpp>
+#include <sprout/array/array.hpp>
+#include <sprout/utility/forward.hpp>
+#include <sprout/functional/hash.hpp>
+#include <sprout/functional/equal_to.hpp>
+#include <sprout/static_map/detail/perfect_hash.hpp>
+
+namespace sprout {
+	//
+	// static_set
+	//
+	//	Immutable set of exactly N keys; see static_map.
+	//
+	template<
+		typename Key, std::size_t N,
+		typename Hash = sprout::hash<Key>,
+		typename KeyEqual = sprout::equal_to<Key>
+	>
+	class static_set {
+		static_assert(N > 0, "N > 0");
+	public:
+		typedef Key key_type;
+		typedef Key value_type;
+		typedef Hash hasher;
+		typedef KeyEqual key_equal;
+		typedef sprout::array<value_type, N> container_type;
+		typedef typename container_type::size_type size_type;
+		typedef typename container_type::difference_type difference_type;
+		typedef typename container_type::const_reference reference;
+		typedef typename container_type::const_reference const_reference;
+		typedef typename container_type::const_iterator iterator;
+		typedef typename container_type::const_iterator const_iterator;
+	public:
+		SPROUT_STATIC_CONSTEXPR size_type static_size = N;
+	private:
+		container_type slots_;
+		sprout::detail::perfect_hash_layout<N> layout_;
+	private:
+		SPROUT_CONSTEXPR size_type index_of(key_type const& key) const {
+			return layout_(static_cast<std::uint64_t>(hasher()(key)));
+		}
+		SPROUT_CONSTEXPR const_iterator find_at(key_type const& key, size_type i) const {
+			return key_equal()(slots_[i], key) ? slots_.begin() + i : slots_.end();
+		}
+		SPROUT_CXX14_CONSTEXPR void build(container_type const& keys) {
+			sprout::array<std::uint64_t, N> hashes{{}};
+			sprout::array<size_type, N> slots{{}};
+			for (size_type i = 0; i != N; ++i) {
+				hashes[i] = static_cast<std::uint64_t>(hasher()(keys[i]));
+			}
+			layout_.build(hashes, slots);
+			for (size_type i = 0; i != N; ++i) {
+				slots_[slots[i]] = keys[i];
+			}
+		}
+	public:
+		SPROUT_CXX14_CONSTEXPR explicit static_set(container_type const& keys)
+			: slots_(), layout_()
+		{
+			build(keys);
+		}
+		template<typename InputIterator>
+		SPROUT_CXX14_CONSTEXPR static_set(InputIterator first, InputIterator last)
+			: slots_(), layout_()
+		{
+			container_type keys{};
+			size_type n = 0;
+			for (; first != last; ++first, ++n) {
+				if (n == N) {
+					throw std::length_error("static_set: too many keys");
+				}
+				keys[n] = *first;
+			}
+			if (n != N) {
+				throw std::length_error("static_set: too few keys");
+			}
+			build(keys);
+		}
+		// iterators (slot order)
+		SPROUT_CONSTEXPR const_iterator begin() const SPROUT_NOEXCEPT {
+			return slots_.begin();
+		}
+		SPROUT_CONSTEXPR const_iterator end() const SPROUT_NOEXCEPT {
+			return slots_.end();
+		}
+		SPROUT_CONSTEXPR const_iterator cbegin() const SPROUT_NOEXCEPT {
+			return slots_.begin();
+		}
+		SPROUT_CONSTEXPR const_iterator cend() const SPROUT_NOEXCEPT {
+			return slots_.end();
+		}
+		// capacity
+		SPROUT_CONSTEXPR size_type size() const SPROUT_NOEXCEPT {
+			return N;
+		}
+		SPROUT_CONSTEXPR size_type max_size() const SPROUT_NOEXCEPT {
+			return N;
+		}
+		SPROUT_CONSTEXPR bool empty() const SPROUT_NOEXCEPT {
+			return false;
+		}
+		// lookup
+		SPROUT_CONSTEXPR const_iterator find(key_type const& key) const {
+			return find_at(key, index_of(key));
+		}
+		SPROUT_CONSTEXPR size_type count(key_type const& key) const {
+			return find(key) != end() ? 1 : 0;
+		}
+		SPROUT_CONSTEXPR bool contains(key_type const& key) const {
+			return find(key) != end();
+		}
+		// observers
+		SPROUT_CONSTEXPR hasher hash_function() const {
+			return hasher();
+		}
+		SPROUT_CONSTEXPR key_equal key_eq() const {
+			return key_equal();
+		}
+	};
+	template<typename Key, std::size_t N, typename Hash, typename KeyEqual>
+	SPROUT_CONSTEXPR_OR_CONST typename sprout::static_set<Key, N, Hash, KeyEqual>::size_type
+	sprout::static_set<Key, N, Hash, KeyEqual>::static_size;
+
+	//
+	// make_static_set
+	//
+	template<typename Key, typename... Args>
+	inline SPROUT_CXX14_CONSTEXPR sprout::static_set<Key, sizeof...(Args)>
+	make_static_set(Args&&... args) {
+		return sprout::static_set<Key, sizeof...(Args)>(
+			sprout::array<Key, sizeof...(Args)>{{Key(SPROUT_FORWARD(Args, args))...}}
+			);
+	}
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_STATIC_MAP_STATIC_SET_HPP
@@ -25,5 +25,7 @@
 #include <sprout/string/alias.hpp>
 #include <sprout/string/shrink.hpp>
 #include <sprout/string/stretch.hpp>
+#include <sprout/string/dynamic_string.hpp>
+#include <sprout/string/string_builder.hpp>
 
 #endif	// #ifndef SPROUT_STRING_HPP
@@ -0,0 +1,482 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_STRING_DYNAMIC_STRING_HPP
+#define SPROUT_STRING_DYNAMIC_STRING_HPP
+
+#include <memory>
+#include <ostream>
+#include <iterator>
+#include <stdexcept>
+#include <functional>
+#include <type_traits>
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/string/npos.hpp>
+#include <sprout/string/char_traits.hpp>
+#include <sprout/string/string.hpp>
+#include <sprout/utility/string_view/string_view.hpp>
+#include <sprout/functional/hash/hash_bytes.hpp>
+#include <sprout/type_traits/enabler_if.hpp>
+
+namespace sprout {
+	template<typename T, typename Traits>
+	class basic_string_builder;
+
+	//
+	// basic_dynamic_string
+	//
+	//	Growable runtime string. Contents of up to local_capacity elements are
+	//	stored inside the object; longer ones move to the heap, doubling the
+	//	capacity on growth. Always null-terminated. Interoperates with
+	//	basic_string and basic_string_view through constructors, append,
+	//	comparison and an implicit conversion to basic_string_view.
+	//
+	template<typename T, typename Traits = sprout::char_traits<T> >
+	class basic_dynamic_string {
+		friend class sprout::basic_string_builder<T, Traits>;
+	public:
+		typedef T value_type;
+		typedef Traits traits_type;
+		typedef std::size_t size_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef T& reference;
+		typedef T const& const_reference;
+		typedef T* pointer;
+		typedef T const* const_pointer;
+		typedef T* iterator;
+		typedef T const* const_iterator;
+		typedef std::reverse_iterator<iterator> reverse_iterator;
+		typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+		typedef sprout::basic_string_view<T, Traits> view_type;
+	public:
+		SPROUT_STATIC_CONSTEXPR size_type npos = sprout::npos_t::get<size_type>::value;
+		SPROUT_STATIC_CONSTEXPR size_type local_capacity = (16 / sizeof(T) > 1 ? 16 / sizeof(T) : 2) - 1;
+	private:
+		pointer data_;
+		size_type size_;
+		union {
+			size_type capacity_;
+			value_type local_[local_capacity + 1];
+		};
+	private:
+		bool is_local() const SPROUT_NOEXCEPT {
+			return data_ == local_;
+		}
+		static pointer allocate(size_type n) {
+			return std::allocator<value_type>().allocate(n + 1);
+		}
+		void deallocate() SPROUT_NOEXCEPT {
+			if (!is_local()) {
+				std::allocator<value_type>().deallocate(data_, capacity_ + 1);
+			}
+		}
+		void set_size(size_type n) SPROUT_NOEXCEPT {
+			size_ = n;
+			traits_type::assign(data_[n], value_type());
+		}
+		void grow(size_type n) {
+			size_type const current = capacity();
+			size_type const cap = n < current * 2 ? current * 2 : n;
+			pointer p = allocate(cap);
+			traits_type::copy(p, data_, size_ + 1);
+			deallocate();
+			data_ = p;
+			capacity_ = cap;
+		}
+		// appends n elements left for the caller to fill
+		pointer extend(size_type n) {
+			if (size_ + n > capacity()) {
+				grow(size_ + n);
+			}
+			pointer p = data_ + size_;
+			set_size(size_ + n);
+			return p;
+		}
+		void steal(basic_dynamic_string& other) SPROUT_NOEXCEPT {
+			if (other.is_local()) {
+				data_ = local_;
+				traits_type::copy(local_, other.local_, other.size_ + 1);
+			} else {
+				data_ = other.data_;
+				capacity_ = other.capacity_;
+				other.data_ = other.local_;
+			}
+			size_ = other.size_;
+			other.set_size(0);
+		}
+	public:
+		// construct/copy/destroy:
+		basic_dynamic_string() SPROUT_NOEXCEPT
+			: data_(local_), size_(0)
+		{
+			traits_type::assign(local_[0], value_type());
+		}
+		basic_dynamic_string(const_pointer s, size_type n)
+			: data_(local_), size_(0)
+		{
+			traits_type::copy(extend(n), s, n);
+		}
+		basic_dynamic_string(const_pointer s)
+			: data_(local_), size_(0)
+		{
+			size_type const n = traits_type::length(s);
+			traits_type::copy(extend(n), s, n);
+		}
+		basic_dynamic_string(size_type n, value_type c)
+			: data_(local_), size_(0)
+		{
+			traits_type::assign(extend(n), n, c);
+		}
+		template<typename InputIterator, typename sprout::enabler_if<!std::is_integral<InputIterator>::value>::type = sprout::enabler>
+		basic_dynamic_string(InputIterator first, InputIterator last)
+			: data_(local_), size_(0)
+		{
+			traits_type::assign(local_[0], value_type());
+			for (; first != last; ++first) {
+				push_back(*first);
+			}
+		}
+		template<std::size_t N>
+		basic_dynamic_string(sprout::basic_string<T, N, Traits> const& s)
+			: data_(local_), size_(0)
+		{
+			traits_type::copy(extend(s.size()), s.data(), s.size());
+		}
+		basic_dynamic_string(view_type const& s)
+			: data_(local_), size_(0)
+		{
+			traits_type::copy(extend(s.size()), s.data(), s.size());
+		}
+		basic_dynamic_string(basic_dynamic_string const& other)
+			: data_(local_), size_(0)
+		{
+			traits_type::copy(extend(other.size_), other.data_, other.size_);
+		}
+		basic_dynamic_string(basic_dynamic_string&& other) SPROUT_NOEXCEPT
+			: data_(local_), size_(0)
+		{
+			steal(other);
+		}
+		~basic_dynamic_string() {
+			deallocate();
+		}
+		basic_dynamic_string& operator=(basic_dynamic_string const& rhs) {
+			if (this != &rhs) {
+				assign(rhs.data_, rhs.size_);
+			}
+			return *this;
+		}
+		basic_dynamic_string& operator=(basic_dynamic_string&& rhs) SPROUT_NOEXCEPT {
+			if (this != &rhs) {
+				deallocate();
+				data_ = local_;
+				steal(rhs);
+			}
+			return *this;
+		}
+		basic_dynamic_string& operator=(const_pointer s) {
+			return assign(s, traits_type::length(s));
+		}
+		basic_dynamic_string& operator=(view_type const& s) {
+			return assign(s.data(), s.size());
+		}
+		basic_dynamic_string& assign(const_pointer s, size_type n) {
+			if (n > capacity()) {
+				grow(n);
+			}
+			traits_type::move(data_, s, n);
+			set_size(n);
+			return *this;
+		}
+		// iterators:
+		iterator begin() SPROUT_NOEXCEPT {
+			return data_;
+		}
+		const_iterator begin() const SPROUT_NOEXCEPT {
+			return data_;
+		}
+		iterator end() SPROUT_NOEXCEPT {
+			return data_ + size_;
+		}
+		const_iterator end() const SPROUT_NOEXCEPT {
+			return data_ + size_;
+		}
+		reverse_iterator rbegin() SPROUT_NOEXCEPT {
+			return reverse_iterator(end());
+		}
+		const_reverse_iterator rbegin() const SPROUT_NOEXCEPT {
+			return const_reverse_iterator(end());
+		}
+		reverse_iterator rend() SPROUT_NOEXCEPT {
+			return reverse_iterator(begin());
+		}
+		const_reverse_iterator rend() const SPROUT_NOEXCEPT {
+			return const_reverse_iterator(begin());
+		}
+		const_iterator cbegin() const SPROUT_NOEXCEPT {
+			return data_;
+		}
+		const_iterator cend() const SPROUT_NOEXCEPT {
+			return data_ + size_;
+		}
+		// capacity:
+		size_type size() const SPROUT_NOEXCEPT {
+			return size_;
+		}
+		size_type length() const SPROUT_NOEXCEPT {
+			return size_;
+		}
+		size_type max_size() const SPROUT_NOEXCEPT {
+			return std::allocator<value_type>().max_size() - 1;
+		}
+		size_type capacity() const SPROUT_NOEXCEPT {
+			return is_local() ? local_capacity : capacity_;
+		}
+		bool empty() const SPROUT_NOEXCEPT {
+			return size_ == 0;
+		}
+		void reserve(size_type n) {
+			if (n > capacity()) {
+				grow(n);
+			}
+		}
+		void resize(size_type n, value_type c = value_type()) {
+			if (n > size_) {
+				traits_type::assign(extend(n - size_), n - size_, c);
+			} else {
+				set_size(n);
+			}
+		}
+		void clear() SPROUT_NOEXCEPT {
+			set_size(0);
+		}
+		// element access:
+		reference operator[](size_type i) {
+			return data_[i];
+		}
+		const_reference operator[](size_type i) const {
+			return data_[i];
+		}
+		reference at(size_type i) {
+			return i < size_ ? data_[i]
+				: (throw std::out_of_range("basic_dynamic_string<>: index out of range"), data_[i])
+				;
+		}
+		const_reference at(size_type i) const {
+			return i < size_ ? data_[i]
+				: (throw std::out_of_range("basic_dynamic_string<>: index out of range"), data_[i])
+				;
+		}
+		reference front() {
+			return data_[0];
+		}
+		const_reference front() const {
+			return data_[0];
+		}
+		reference back() {
+			return data_[size_ - 1];
+		}
+		const_reference back() const {
+			return data_[size_ - 1];
+		}
+		// modifiers:
+		basic_dynamic_string& append(const_pointer s, size_type n) {
+			if (size_ + n > capacity()) {
+				// s may point into this string; grow as extend() would
+				basic_dynamic_string tmp;
+				tmp.reserve(size_ + n < capacity() * 2 ? capacity() * 2 : size_ + n);
+				traits_type::copy(tmp.extend(size_), data_, size_);
+				traits_type::copy(tmp.extend(n), s, n);
+				swap(tmp);
+			} else {
+				traits_type::move(extend(n), s, n);
+			}
+			return *this;
+		}
+		basic_dynamic_string& append(const_pointer s) {
+			return append(s, traits_type::length(s));
+		}
+		basic_dynamic_string& append(size_type n, value_type c) {
+			traits_type::assign(extend(n), n, c);
+			return *this;
+		}
+		basic_dynamic_string& append(view_type const& s) {
+			return append(s.data(), s.size());
+		}
+		template<std::size_t N>
+		basic_dynamic_string& append(sprout::basic_string<T, N, Traits> const& s) {
+			return append(s.data(), s.size());
+		}
+		basic_dynamic_string& append(basic_dynamic_string const& s) {
+			return append(s.data_, s.size_);
+		}
+		template<typename U>
+		basic_dynamic_string& operator+=(U const& s) {
+			return append(s);
+		}
+		basic_dynamic_string& operator+=(value_type c) {
+			push_back(c);
+			return *this;
+		}
+		void push_back(value_type c) {
+			traits_type::assign(*extend(1), c);
+		}
+		void pop_back() SPROUT_NOEXCEPT {
+			set_size(size_ - 1);
+		}
+		void swap(basic_dynamic_string& other) SPROUT_NOEXCEPT {
+			basic_dynamic_string tmp(static_cast<basic_dynamic_string&&>(other));
+			other = static_cast<basic_dynamic_string&&>(*this);
+			*this = static_cast<basic_dynamic_string&&>(tmp);
+		}
+		// string operations:
+		const_pointer c_str() const SPROUT_NOEXCEPT {
+			return data_;
+		}
+		const_pointer data() const SPROUT_NOEXCEPT {
+			return data_;
+		}
+		pointer data() SPROUT_NOEXCEPT {
+			return data_;
+		}
+		view_type view() const SPROUT_NOEXCEPT {
+			return view_type(data_, size_);
+		}
+		operator view_type() const SPROUT_NOEXCEPT {
+			return view();
+		}
+		int compare(view_type const& s) const {
+			return view().compare(s);
+		}
+	};
+	template<typename T, typename Traits>
+	SPROUT_CONSTEXPR_OR_CONST typename sprout::basic_dynamic_string<T, Traits>::size_type
+	sprout::basic_dynamic_string<T, Traits>::npos;
+	template<typename T, typename Traits>
+	SPROUT_CONSTEXPR_OR_CONST typename sprout::basic_dynamic_string<T, Traits>::size_type
+	sprout::basic_dynamic_string<T, Traits>::local_capacity;
+
+	//
+	// swap
+	//
+	template<typename T, typename Traits>
+	inline void
+	swap(sprout::basic_dynamic_string<T, Traits>& lhs, sprout::basic_dynamic_string<T, Traits>& rhs) SPROUT_NOEXCEPT {
+		lhs.swap(rhs);
+	}
+
+	//
+	// operator==
+	// operator!=
+	// operator<
+	// operator>
+	// operator<=
+	// operator>=
+	//
+	//	Either side may be a basic_string_view or a null-terminated pointer.
+	//
+#define SPROUT_STRING_DYNAMIC_STRING_COMPARISON(OP) \
+	template<typename T, typename Traits> \
+	inline bool \
+	operator OP(sprout::basic_dynamic_string<T, Traits> const& lhs, sprout::basic_dynamic_string<T, Traits> const& rhs) { \
+		return lhs.compare(rhs.view()) OP 0; \
+	} \
+	template<typename T, typename Traits> \
+	inline bool \
+	operator OP(sprout::basic_dynamic_string<T, Traits> const& lhs, sprout::basic_string_view<T, Traits> const& rhs) { \
+		return lhs.compare(rhs) OP 0; \
+	} \
+	template<typename T, typename Traits> \
+	inline bool \
+	operator OP(sprout::basic_string_view<T, Traits> const& lhs, sprout::basic_dynamic_string<T, Traits> const& rhs) { \
+		return lhs.compare(rhs.view()) OP 0; \
+	} \
+	template<typename T, typename Traits> \
+	inline bool \
+	operator OP(sprout::basic_dynamic_string<T, Traits> const& lhs, T const* rhs) { \
+		return lhs.compare(sprout::basic_string_view<T, Traits>(rhs)) OP 0; \
+	} \
+	template<typename T, typename Traits> \
+	inline bool \
+	operator OP(T const* lhs, sprout::basic_dynamic_string<T, Traits> const& rhs) { \
+		return sprout::basic_string_view<T, Traits>(lhs).compare(rhs.view()) OP 0; \
+	}
+	SPROUT_STRING_DYNAMIC_STRING_COMPARISON(==)
+	SPROUT_STRING_DYNAMIC_STRING_COMPARISON(!=)
+	SPROUT_STRING_DYNAMIC_STRING_COMPARISON(<)
+	SPROUT_STRING_DYNAMIC_STRING_COMPARISON(>)
+	SPROUT_STRING_DYNAMIC_STRING_COMPARISON(<=)
+	SPROUT_STRING_DYNAMIC_STRING_COMPARISON(>=)
+#undef SPROUT_STRING_DYNAMIC_STRING_COMPARISON
+
+	//
+	// operator+
+	//
+	template<typename T, typename Traits, typename U>
+	inline sprout::basic_dynamic_string<T, Traits>
+	operator+(sprout::basic_dynamic_string<T, Traits> lhs, U const& rhs) {
+		lhs += rhs;
+		return lhs;
+	}
+
+	//
+	// operator<<
+	//
+	template<typename T, typename Traits, typename StreamTraits>
+	inline std::basic_ostream<T, StreamTraits>&
+	operator<<(std::basic_ostream<T, StreamTraits>& lhs, sprout::basic_dynamic_string<T, Traits> const& rhs) {
+		return lhs << rhs.c_str();
+	}
+
+	//
+	// hash_value
+	//
+	template<typename T, typename Traits>
+	inline std::size_t
+	hash_value(sprout::basic_dynamic_string<T, Traits> const& v) {
+		return sprout::hash_elements(v.data(), v.size());
+	}
+
+	//
+	// dynamic_string
+	// dynamic_wstring
+	// dynamic_u16string
+	// dynamic_u32string
+	//
+	typedef sprout::basic_dynamic_string<char> dynamic_string;
+	typedef sprout::basic_dynamic_string<wchar_t> dynamic_wstring;
+#if SPROUT_USE_UNICODE_LITERALS
+	typedef sprout::basic_dynamic_string<char16_t> dynamic_u16string;
+	typedef sprout::basic_dynamic_string<char32_t> dynamic_u32string;
+#endif
+}	// namespace sprout
+
+namespace std {
+#if defined(__clang__)
+#	pragma clang diagnostic push
+#	pragma clang diagnostic ignored "-Wmismatched-tags"
+#endif
+	//
+	// hash
+	//
+	template<typename T, typename Traits>
+	struct hash<sprout::basic_dynamic_string<T, Traits> > {
+	public:
+		typedef sprout::basic_dynamic_string<T, Traits> argument_type;
+		typedef std::size_t result_type;
+	public:
+		std::size_t operator()(sprout::basic_dynamic_string<T, Traits> const& v) const {
+			return sprout::hash_elements(v.data(), v.size());
+		}
+	};
+#if defined(__clang__)
+#	pragma clang diagnostic pop
+#endif
+}	// namespace std
+
+#endif	// #ifndef SPROUT_STRING_DYNAMIC_STRING_HPP
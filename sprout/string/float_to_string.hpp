@@ -16,15 +16,19 @@
 #include <sprout/string/string.hpp>
 #include <sprout/type_traits/integral_constant.hpp>
 #include <sprout/type_traits/enabler_if.hpp>
+#include <sprout/type_traits/float_promote.hpp>
 #include <sprout/math/isinf.hpp>
 #include <sprout/math/isnan.hpp>
 #include <sprout/math/signbit.hpp>
 #include <sprout/math/floor.hpp>
+#include <sprout/math/round.hpp>
 #include <sprout/tpp/algorithm/max_element.hpp>
+#include <sprout/utility/pair/pair.hpp>
 #include <sprout/detail/char_literal.hpp>
 #include <sprout/detail/char_conversion.hpp>
 #include <sprout/detail/math/int.hpp>
 #include <sprout/detail/math/float.hpp>
+#include <sprout/charconv/detail/shortest_float.hpp>
 #include HDR_ALGORITHM_MIN_MAX_SSCRISK_CEL_OR_SPROUT
 
 namespace sprout {
@@ -126,18 +130,66 @@ namespace sprout {
 	{};
 
 	namespace detail {
+		//
+		// float_exp_mantissa
+		//
+		//	The leading digit and the decimal places of |val| as one rounded integer,
+		//	with the exponent carried up when the rounding reaches the next power of ten.
+		//
+		inline SPROUT_CONSTEXPR sprout::pair<long long, int>
+		float_exp_mantissa_impl(long long mantissa, int exponent10) {
+			typedef sprout::pair<long long, int> type;
+			return mantissa >= sprout::detail::int_pow<long long>(static_cast<int>(sprout::detail::decimal_places_length) + 1)
+				? type(mantissa / 10, exponent10 + 1)
+				: type(mantissa, exponent10)
+				;
+		}
+		template<typename FloatType>
+		inline SPROUT_CONSTEXPR FloatType
+		float_exp_scale(FloatType val, int exponent10) {
+			// 10^-exponent10 overflows for subnormals, so scale those up in two steps
+			return exponent10 >= 0 ? val / sprout::detail::float_pow10<FloatType>(exponent10)
+				: -exponent10 > sprout::numeric_limits<FloatType>::max_exponent10
+					? val * sprout::detail::float_pow10<FloatType>(-exponent10 / 2)
+						* sprout::detail::float_pow10<FloatType>(-exponent10 - -exponent10 / 2)
+				: val * sprout::detail::float_pow10<FloatType>(-exponent10)
+				;
+		}
+		template<typename FloatType>
+		inline SPROUT_CONSTEXPR sprout::pair<long long, int>
+		float_exp_mantissa(FloatType val, int exponent10) {
+			return sprout::detail::float_exp_mantissa_impl(
+				static_cast<long long>(sprout::math::round(
+					sprout::detail::float_exp_scale(val, exponent10 - static_cast<int>(sprout::detail::decimal_places_length))
+					)),
+				exponent10
+				);
+		}
+		template<
+			typename FloatType,
+			typename sprout::enabler_if<std::is_floating_point<FloatType>::value>::type = sprout::enabler
+		>
+		inline SPROUT_CONSTEXPR sprout::pair<long long, int>
+		float_exp_mantissa(FloatType val) {
+			// float_exponent10 does not terminate for zero; float is scaled in double
+			return sprout::detail::float_exp_mantissa(
+				static_cast<typename sprout::float_promote<FloatType, double>::type>(val < 0 ? -val : val),
+				val != 0 ? sprout::detail::float_exponent10(val) : 0
+				);
+		}
+
 		template<typename Elem, typename FloatType, sprout::index_t... Indexes>
 		inline SPROUT_CONSTEXPR sprout::basic_string<Elem, sprout::printed_float_exp_digits<FloatType>::value>
-		float_to_string_exp(FloatType val, bool negative, int exponent10, int e10_digits, sprout::index_tuple<Indexes...>) {
+		float_to_string_exp(long long mantissa, bool negative, int exponent10, int e10_digits, sprout::index_tuple<Indexes...>) {
 			typedef sprout::detail::string_construct_access<Elem, sprout::printed_float_exp_digits<FloatType>::value> access_type;
 			return negative
 				? access_type::raw_construct(
 					static_cast<std::size_t>(5 + sprout::detail::decimal_places_length + e10_digits),
 					SPROUT_CHAR_LITERAL('-', Elem),
-					(Indexes == 0 ? sprout::detail::int_to_char<Elem>(sprout::detail::float_digit_at(val, 0))
+					(Indexes == 0 ? sprout::detail::int_to_char<Elem>(sprout::detail::int_digit_at(mantissa, sprout::detail::decimal_places_length))
 						: Indexes == 1 ? SPROUT_CHAR_LITERAL('.', Elem)
 						: Indexes < 2 + sprout::detail::decimal_places_length
-							? sprout::detail::int_to_char<Elem>(sprout::detail::float_digit_at(val, 1 - Indexes))
+							? sprout::detail::int_to_char<Elem>(sprout::detail::int_digit_at(mantissa, 1 + sprout::detail::decimal_places_length - Indexes))
 						: Indexes == 2 + sprout::detail::decimal_places_length ? SPROUT_CHAR_LITERAL('e', Elem)
 						: Indexes == 3 + sprout::detail::decimal_places_length ? (exponent10 < 0 ? SPROUT_CHAR_LITERAL('-', Elem) : SPROUT_CHAR_LITERAL('+', Elem))
 						: Indexes < 4 + sprout::detail::decimal_places_length + e10_digits
@@ -147,10 +199,10 @@ namespace sprout {
 					)
 				: access_type::raw_construct(
 					static_cast<std::size_t>(4 + sprout::detail::decimal_places_length + e10_digits),
-					(Indexes == 0 ? sprout::detail::int_to_char<Elem>(sprout::detail::float_digit_at(val, 0))
+					(Indexes == 0 ? sprout::detail::int_to_char<Elem>(sprout::detail::int_digit_at(mantissa, sprout::detail::decimal_places_length))
 						: Indexes == 1 ? SPROUT_CHAR_LITERAL('.', Elem)
 						: Indexes < 2 + sprout::detail::decimal_places_length
-							? sprout::detail::int_to_char<Elem>(sprout::detail::float_digit_at(val, 1 - Indexes))
+							? sprout::detail::int_to_char<Elem>(sprout::detail::int_digit_at(mantissa, 1 + sprout::detail::decimal_places_length - Indexes))
 						: Indexes == 2 + sprout::detail::decimal_places_length ? SPROUT_CHAR_LITERAL('e', Elem)
 						: Indexes == 3 + sprout::detail::decimal_places_length ? (exponent10 < 0 ? SPROUT_CHAR_LITERAL('-', Elem) : SPROUT_CHAR_LITERAL('+', Elem))
 						: Indexes < 4 + sprout::detail::decimal_places_length + e10_digits
@@ -160,6 +212,15 @@ namespace sprout {
 					)
 				;
 		}
+		template<typename Elem, typename FloatType>
+		inline SPROUT_CONSTEXPR sprout::basic_string<Elem, sprout::printed_float_exp_digits<FloatType>::value>
+		float_to_string_exp(sprout::pair<long long, int> const& m, bool negative) {
+			return sprout::detail::float_to_string_exp<Elem, FloatType>(
+				m.first, negative, m.second,
+				NS_SSCRISK_CEL_OR_SPROUT::max(sprout::detail::int_digits(m.second), 2),
+				sprout::make_index_tuple<sprout::printed_float_exp_digits<FloatType>::value - 1>::make()
+				);
+		}
 	}	// namespace detail
 
 	//
@@ -178,19 +239,44 @@ namespace sprout {
 			: sprout::math::isnan(val) ? sprout::math::signbit(val)
 				? access_type::raw_construct(4, SPROUT_CHAR_LITERAL('-', Elem), SPROUT_CHAR_LITERAL('n', Elem), SPROUT_CHAR_LITERAL('a', Elem), SPROUT_CHAR_LITERAL('n', Elem))
 				: access_type::raw_construct(3, SPROUT_CHAR_LITERAL('n', Elem), SPROUT_CHAR_LITERAL('a', Elem), SPROUT_CHAR_LITERAL('n', Elem))
-			: sprout::detail::float_to_string_exp<Elem>(
-				sprout::detail::float_round_at(
-					(val < 0 ? -val : val) / sprout::detail::float_pow10<FloatType>(sprout::detail::float_exponent10(val)),
-					sprout::detail::decimal_places_length
-					),
-				sprout::math::signbit(val),
-				sprout::detail::float_exponent10(val),
-				NS_SSCRISK_CEL_OR_SPROUT::max(sprout::detail::int_digits(sprout::detail::float_exponent10(val)), 2),
-				sprout::make_index_tuple<sprout::printed_float_exp_digits<FloatType>::value - 1>::make()
+			: sprout::detail::float_to_string_exp<Elem, FloatType>(
+				sprout::detail::float_exp_mantissa(val),
+				sprout::math::signbit(val)
 				)
 			;
 	}
 
+	//
+	// printed_float_shortest_digits
+	//
+	template<typename FloatType>
+	struct printed_float_shortest_digits
+		: public sprout::integral_constant<
+			std::size_t,
+			4 + sprout::numeric_limits<FloatType>::max_digits10 + sprout::detail::printed_float_exponent10_digits<FloatType>::value
+		>
+	{};
+
+	//
+	// float_to_string_shortest
+	//
+	//	The fewest digits that read back as the same value, in the shorter of
+	//	the float_to_string and float_to_string_exp forms; see sprout::to_chars.
+	//
+	template<
+		typename Elem, typename FloatType,
+		typename sprout::enabler_if<sprout::detail::is_shortest_float<FloatType>::value>::type = sprout::enabler
+	>
+	inline SPROUT_CXX14_CONSTEXPR sprout::basic_string<Elem, sprout::printed_float_shortest_digits<FloatType>::value>
+	float_to_string_shortest(FloatType val) {
+		typedef typename sprout::detail::shortest_float_traits<FloatType>::carrier_type carrier_type;
+		sprout::detail::shortest_float_format<carrier_type> const f = sprout::detail::shortest_float_prepare(val);
+		sprout::basic_string<Elem, sprout::printed_float_shortest_digits<FloatType>::value> result{};
+		result.resize(f.length);
+		sprout::detail::shortest_float_write(result.data(), f);
+		return result;
+	}
+
 	//
 	// to_string_of
 	//
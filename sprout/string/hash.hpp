@@ -13,6 +13,7 @@
 #include <sprout/workaround/std/cstddef.hpp>
 #include <sprout/string/string.hpp>
 #include <sprout/functional/hash.hpp>
+#include <sprout/functional/hash/hash_bytes.hpp>
 
 namespace sprout {
 	//
@@ -21,7 +22,7 @@ namespace sprout {
 	template<typename T, std::size_t N, typename Traits>
 	inline SPROUT_CONSTEXPR std::size_t
 	hash_value(sprout::basic_string<T, N, Traits> const& v) {
-		return sprout::hash_range(v);
+		return sprout::hash_bytes(v);
 	}
 }	// namespace sprout
 
@@ -36,7 +37,12 @@ namespace std {
 	template<typename T, std::size_t N, typename Traits>
 	struct hash<sprout::basic_string<T, N, Traits> >
 		: public sprout::hash<sprout::basic_string<T, N, Traits> >
-	{};
+	{
+	public:
+		std::size_t operator()(sprout::basic_string<T, N, Traits> const& v) const {
+			return sprout::hash_elements(v.data(), v.size());
+		}
+	};
 #if defined(__clang__)
 #	pragma clang diagnostic pop
 #endif
@@ -21,6 +21,8 @@
 #include <sprout/detail/char_literal.hpp>
 #include <sprout/detail/char_conversion.hpp>
 #include <sprout/detail/math/int.hpp>
+#include <sprout/detail/simd.hpp>
+#include <sprout/detail/two_digits.hpp>
 
 namespace sprout {
 	//
@@ -46,13 +48,13 @@ namespace sprout {
 			return val < 0 ? access_type::raw_construct(
 					static_cast<std::size_t>(digits + 1),
 					SPROUT_CHAR_LITERAL('-', Elem),
-					(Indexes < digits ? sprout::detail::int_to_char<Elem>(sprout::detail::int_digit_at<Base>(val, digits - 1 - Indexes))
+					(Indexes < digits ? sprout::detail::int_to_char<Elem>(sprout::detail::int_digit_at<Base>(val, digits - 1 - Indexes), Base)
 						: Elem()
 						)...
 					)
 				: access_type::raw_construct(
 					static_cast<std::size_t>(digits),
-					(Indexes < digits ? sprout::detail::int_to_char<Elem>(sprout::detail::int_digit_at<Base>(val, digits - 1 - Indexes))
+					(Indexes < digits ? sprout::detail::int_to_char<Elem>(sprout::detail::int_digit_at<Base>(val, digits - 1 - Indexes), Base)
 						: Elem()
 						)...
 					)
@@ -68,11 +70,76 @@ namespace sprout {
 			typedef sprout::detail::string_construct_access<Elem, sprout::printed_integer_digits<IntType, Base>::value> access_type;
 			return access_type::raw_construct(
 				static_cast<std::size_t>(digits),
-				(Indexes < digits ? sprout::detail::int_to_char<Elem>(sprout::detail::int_digit_at<Base>(val, digits - 1 - Indexes))
+				(Indexes < digits ? sprout::detail::int_to_char<Elem>(sprout::detail::int_digit_at<Base>(val, digits - 1 - Indexes), Base)
 					: Elem()
 					)...
 				);
 		}
+		template<typename Elem, int Base, typename IntType>
+		inline SPROUT_CONSTEXPR sprout::basic_string<Elem, sprout::printed_integer_digits<IntType, Base>::value>
+		int_to_string_by_digit(IntType val) {
+			return sprout::detail::int_to_string<Elem, Base>(
+				val,
+				sprout::detail::int_digits<Base>(val),
+				sprout::make_index_tuple<sprout::integer_digits<IntType, Base>::value>::make()
+				);
+		}
+
+		//
+		// int_to_string_two_digits
+		//
+		//	Base 10 without a division per character: the digits come in pairs
+		//	from the two_digits table.
+		//
+		template<
+			typename Elem, typename IntType,
+			typename sprout::enabler_if<sprout::is_signed<IntType>::value>::type = sprout::enabler
+		>
+		inline SPROUT_CXX14_CONSTEXPR sprout::basic_string<Elem, sprout::printed_integer_digits<IntType, 10>::value>
+		int_to_string_two_digits(IntType val) {
+			typedef typename std::make_unsigned<IntType>::type unsigned_type;
+			unsigned_type const u = val < 0 ? static_cast<unsigned_type>(0 - static_cast<unsigned_type>(val)) : static_cast<unsigned_type>(val);
+			std::size_t const sign = val < 0 ? 1 : 0;
+			int const digits = sprout::detail::decimal_digits(u);
+			sprout::basic_string<Elem, sprout::printed_integer_digits<IntType, 10>::value> result{};
+			result.resize(sign + digits);
+			if (sign) {
+				result[0] = SPROUT_CHAR_LITERAL('-', Elem);
+			}
+			sprout::detail::write_decimal_digits(result.data() + sign + digits, u, digits);
+			return result;
+		}
+		template<
+			typename Elem, typename IntType,
+			typename sprout::enabler_if<sprout::is_unsigned<IntType>::value>::type = sprout::enabler
+		>
+		inline SPROUT_CXX14_CONSTEXPR sprout::basic_string<Elem, sprout::printed_integer_digits<IntType, 10>::value>
+		int_to_string_two_digits(IntType val) {
+			int const digits = sprout::detail::decimal_digits(val);
+			sprout::basic_string<Elem, sprout::printed_integer_digits<IntType, 10>::value> result{};
+			result.resize(digits);
+			sprout::detail::write_decimal_digits(result.data() + digits, val, digits);
+			return result;
+		}
+
+		template<typename Elem, int Base, typename IntType>
+		inline SPROUT_CONSTEXPR sprout::basic_string<Elem, sprout::printed_integer_digits<IntType, Base>::value>
+		int_to_string_dispatch(IntType val, sprout::false_type) {
+			return sprout::detail::int_to_string_by_digit<Elem, Base>(val);
+		}
+		template<typename Elem, int Base, typename IntType>
+		inline SPROUT_CONSTEXPR sprout::basic_string<Elem, sprout::printed_integer_digits<IntType, Base>::value>
+		int_to_string_dispatch(IntType val, sprout::true_type) {
+#if !defined(SPROUT_CONFIG_DISABLE_CXX14_CONSTEXPR)
+			return sprout::detail::int_to_string_two_digits<Elem>(val);
+#elif defined(SPROUT_DETAIL_HAS_IS_CONSTANT_EVALUATED)
+			return __builtin_is_constant_evaluated() ? sprout::detail::int_to_string_by_digit<Elem, Base>(val)
+				: sprout::detail::int_to_string_two_digits<Elem>(val)
+				;
+#else
+			return sprout::detail::int_to_string_by_digit<Elem, Base>(val);
+#endif
+		}
 	}	// namespace detail
 
 	//
@@ -84,10 +151,9 @@ namespace sprout {
 	>
 	inline SPROUT_CONSTEXPR sprout::basic_string<Elem, sprout::printed_integer_digits<IntType, Base>::value>
 	int_to_string(IntType val) {
-		return sprout::detail::int_to_string<Elem, Base>(
+		return sprout::detail::int_to_string_dispatch<Elem, Base>(
 			val,
-			sprout::detail::int_digits<Base>(val),
-			sprout::make_index_tuple<sprout::integer_digits<IntType, Base>::value>::make()
+			sprout::bool_constant<Base == 10 && !std::is_same<IntType, bool>::value>()
 			);
 	}
 
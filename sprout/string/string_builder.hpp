@@ -0,0 +1,252 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_STRING_STRING_BUILDER_HPP
+#define SPROUT_STRING_STRING_BUILDER_HPP
+
+#include <type_traits>
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/string/char_traits.hpp>
+#include <sprout/string/string.hpp>
+#include <sprout/string/dynamic_string.hpp>
+#include <sprout/string/float_to_string.hpp>
+#include <sprout/utility/string_view/string_view.hpp>
+#include <sprout/utility/pair/pair.hpp>
+#include <sprout/type_traits/enabler_if.hpp>
+#include <sprout/type_traits/is_signed.hpp>
+#include <sprout/type_traits/is_unsigned.hpp>
+#include <sprout/math/isinf.hpp>
+#include <sprout/math/isnan.hpp>
+#include <sprout/math/signbit.hpp>
+#include <sprout/math/floor.hpp>
+#include <sprout/detail/char_literal.hpp>
+#include <sprout/detail/char_conversion.hpp>
+#include <sprout/detail/math/int.hpp>
+#include <sprout/detail/math/float.hpp>
+
+namespace sprout {
+	//
+	// basic_string_builder
+	//
+	//	Appends text and numbers to one basic_dynamic_string. Numbers are
+	//	formatted straight into the string's storage with the digit generators
+	//	of int_to_string and float_to_string, producing the same text as those
+	//	functions without building a fixed-capacity temporary.
+	//
+	template<typename T, typename Traits = sprout::char_traits<T> >
+	class basic_string_builder {
+	public:
+		typedef T value_type;
+		typedef Traits traits_type;
+		typedef sprout::basic_dynamic_string<T, Traits> string_type;
+		typedef typename string_type::size_type size_type;
+		typedef typename string_type::pointer pointer;
+		typedef sprout::basic_string_view<T, Traits> view_type;
+	private:
+		string_type str_;
+	private:
+		template<int Base, typename IntType>
+		void write_digits(pointer last, IntType val, int digits) {
+			for (int i = 0; i != digits; ++i, val /= Base) {
+				*--last = sprout::detail::int_to_char<T>(sprout::detail::int_digit_at<Base>(val, 0), Base);
+			}
+		}
+		// returns false when val was inf or nan
+		template<typename FloatType>
+		bool append_special(FloatType val) {
+			if (sprout::math::isinf(val)) {
+				return append_word(sprout::math::signbit(val), SPROUT_CHAR_LITERAL('i', T), SPROUT_CHAR_LITERAL('n', T), SPROUT_CHAR_LITERAL('f', T));
+			}
+			if (sprout::math::isnan(val)) {
+				return append_word(sprout::math::signbit(val), SPROUT_CHAR_LITERAL('n', T), SPROUT_CHAR_LITERAL('a', T), SPROUT_CHAR_LITERAL('n', T));
+			}
+			return true;
+		}
+		bool append_word(bool negative, value_type c0, value_type c1, value_type c2) {
+			pointer p = str_.extend(negative ? 4 : 3);
+			if (negative) {
+				*p++ = SPROUT_CHAR_LITERAL('-', T);
+			}
+			p[0] = c0;
+			p[1] = c1;
+			p[2] = c2;
+			return false;
+		}
+	public:
+		basic_string_builder()
+			: str_()
+		{}
+		explicit basic_string_builder(size_type n)
+			: str_()
+		{
+			str_.reserve(n);
+		}
+		void reserve(size_type n) {
+			str_.reserve(n);
+		}
+		size_type size() const SPROUT_NOEXCEPT {
+			return str_.size();
+		}
+		size_type capacity() const SPROUT_NOEXCEPT {
+			return str_.capacity();
+		}
+		bool empty() const SPROUT_NOEXCEPT {
+			return str_.empty();
+		}
+		void clear() SPROUT_NOEXCEPT {
+			str_.clear();
+		}
+		view_type view() const SPROUT_NOEXCEPT {
+			return str_.view();
+		}
+		string_type const& str() const SPROUT_NOEXCEPT {
+			return str_;
+		}
+		// moves the result out and leaves the builder empty
+		string_type release() {
+			return string_type(static_cast<string_type&&>(str_));
+		}
+		// text:
+		basic_string_builder& append(value_type c) {
+			str_.push_back(c);
+			return *this;
+		}
+		basic_string_builder& append(size_type n, value_type c) {
+			str_.append(n, c);
+			return *this;
+		}
+		basic_string_builder& append(value_type const* s) {
+			str_.append(s);
+			return *this;
+		}
+		basic_string_builder& append(value_type const* s, size_type n) {
+			str_.append(s, n);
+			return *this;
+		}
+		basic_string_builder& append(view_type const& s) {
+			str_.append(s);
+			return *this;
+		}
+		template<std::size_t N>
+		basic_string_builder& append(sprout::basic_string<T, N, Traits> const& s) {
+			str_.append(s);
+			return *this;
+		}
+		basic_string_builder& append(string_type const& s) {
+			str_.append(s);
+			return *this;
+		}
+		// integers, as int_to_string<T, Base>:
+		template<
+			int Base = 10, typename IntType,
+			typename sprout::enabler_if<sprout::is_signed<IntType>::value>::type = sprout::enabler
+		>
+		basic_string_builder& append_int(IntType val) {
+			int const digits = sprout::detail::int_digits<Base>(val);
+			if (val < 0) {
+				pointer p = str_.extend(digits + 1);
+				*p = SPROUT_CHAR_LITERAL('-', T);
+				write_digits<Base>(p + 1 + digits, val, digits);
+			} else {
+				write_digits<Base>(str_.extend(digits) + digits, val, digits);
+			}
+			return *this;
+		}
+		template<
+			int Base = 10, typename IntType,
+			typename sprout::enabler_if<sprout::is_unsigned<IntType>::value>::type = sprout::enabler
+		>
+		basic_string_builder& append_int(IntType val) {
+			int const digits = sprout::detail::int_digits<Base>(val);
+			write_digits<Base>(str_.extend(digits) + digits, val, digits);
+			return *this;
+		}
+		// floating point, as float_to_string<T>:
+		template<typename FloatType, typename sprout::enabler_if<std::is_floating_point<FloatType>::value>::type = sprout::enabler>
+		basic_string_builder& append_float(FloatType val) {
+			if (!append_special(val)) {
+				return *this;
+			}
+			int const places = static_cast<int>(sprout::detail::decimal_places_length);
+			FloatType const v = sprout::detail::float_round_at(val < 0 ? -val : val, places);
+			int const digits = sprout::detail::float_digits_checked(val);
+			int const frac = static_cast<int>((v - sprout::math::floor(v)) * sprout::detail::int_pow<int>(places));
+			bool const negative = sprout::math::signbit(val);
+			pointer p = str_.extend((negative ? 1 : 0) + digits + 1 + places);
+			if (negative) {
+				*p++ = SPROUT_CHAR_LITERAL('-', T);
+			}
+			for (int i = 0; i != digits; ++i) {
+				*p++ = sprout::detail::int_to_char<T>(sprout::detail::float_digit_at(v, digits - 1 - i));
+			}
+			*p++ = SPROUT_CHAR_LITERAL('.', T);
+			for (int i = 0; i != places; ++i) {
+				*p++ = sprout::detail::int_to_char<T>(sprout::detail::int_digit_at(frac, places - 1 - i));
+			}
+			return *this;
+		}
+		// floating point, in the format of float_to_string_exp<T>:
+		template<typename FloatType, typename sprout::enabler_if<std::is_floating_point<FloatType>::value>::type = sprout::enabler>
+		basic_string_builder& append_float_exp(FloatType val) {
+			if (!append_special(val)) {
+				return *this;
+			}
+			int const places = static_cast<int>(sprout::detail::decimal_places_length);
+			sprout::pair<long long, int> const m = sprout::detail::float_exp_mantissa(val);
+			long long const mantissa = m.first;
+			int const e10 = m.second;
+			int const e10_digits = sprout::detail::int_digits(e10) > 2 ? sprout::detail::int_digits(e10) : 2;
+			bool const negative = sprout::math::signbit(val);
+			pointer p = str_.extend((negative ? 1 : 0) + 4 + places + e10_digits);
+			if (negative) {
+				*p++ = SPROUT_CHAR_LITERAL('-', T);
+			}
+			*p++ = sprout::detail::int_to_char<T>(sprout::detail::int_digit_at(mantissa, places));
+			*p++ = SPROUT_CHAR_LITERAL('.', T);
+			for (int i = 0; i != places; ++i) {
+				*p++ = sprout::detail::int_to_char<T>(sprout::detail::int_digit_at(mantissa, places - 1 - i));
+			}
+			*p++ = SPROUT_CHAR_LITERAL('e', T);
+			*p++ = e10 < 0 ? SPROUT_CHAR_LITERAL('-', T) : SPROUT_CHAR_LITERAL('+', T);
+			for (int i = 0; i != e10_digits; ++i) {
+				*p++ = sprout::detail::int_to_char<T>(sprout::detail::int_digit_at(e10, e10_digits - 1 - i));
+			}
+			return *this;
+		}
+		template<typename IntType, typename sprout::enabler_if<std::is_integral<IntType>::value>::type = sprout::enabler>
+		basic_string_builder& append(IntType val) {
+			return append_int(val);
+		}
+		template<typename FloatType, typename sprout::enabler_if<std::is_floating_point<FloatType>::value>::type = sprout::enabler>
+		basic_string_builder& append(FloatType val) {
+			return append_float(val);
+		}
+		template<typename U>
+		basic_string_builder& operator<<(U const& val) {
+			return append(val);
+		}
+		basic_string_builder& operator<<(value_type const* s) {
+			return append(s);
+		}
+	};
+
+	//
+	// string_builder
+	// wstring_builder
+	// u16string_builder
+	// u32string_builder
+	//
+	typedef sprout::basic_string_builder<char> string_builder;
+	typedef sprout::basic_string_builder<wchar_t> wstring_builder;
+#if SPROUT_USE_UNICODE_LITERALS
+	typedef sprout::basic_string_builder<char16_t> u16string_builder;
+	typedef sprout::basic_string_builder<char32_t> u32string_builder;
+#endif
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_STRING_STRING_BUILDER_HPP
@@ -38,7 +38,7 @@ namespace sprout {
 	>
 	inline SPROUT_CONSTEXPR FloatType
 	string_to_float(sprout::basic_string<Elem, N, Traits> const& str, std::size_t* idx) {
-		return !idx ? sprout::detail::str_to_float<FloatType>(str.begin())
+		return !idx ? sprout::detail::str_to_float_dispatch<FloatType>(str.c_str())
 			: sprout::detail::string_to_float_dynamic<FloatType>(str, idx)
 			;
 	}
@@ -48,7 +48,7 @@ namespace sprout {
 	>
 	inline SPROUT_CONSTEXPR FloatType
 	string_to_float(sprout::basic_string<Elem, N, Traits> const& str) {
-		return sprout::detail::str_to_float<FloatType>(str.begin());
+		return sprout::detail::str_to_float_dispatch<FloatType>(str.c_str());
 	}
 
 	//
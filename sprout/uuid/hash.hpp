@@ -13,15 +13,18 @@
 #include <sprout/workaround/std/cstddef.hpp>
 #include <sprout/uuid/uuid.hpp>
 #include <sprout/functional/hash.hpp>
+#include <sprout/functional/hash/hash_bytes.hpp>
 
 namespace sprout {
-	//
-	// hash_value
-	//
-	inline SPROUT_CONSTEXPR std::size_t
-	hash_value(sprout::uuids::uuid const& v) {
-		return sprout::hash_range(v);
-	}
+	namespace uuids {
+		//
+		// hash_value
+		//
+		inline SPROUT_CONSTEXPR std::size_t
+		hash_value(sprout::uuids::uuid const& v) {
+			return sprout::hash_bytes(v);
+		}
+	}	// namespace uuids
 }	// namespace sprout
 
 namespace std {
@@ -35,7 +38,12 @@ namespace std {
 	template<>
 	struct hash<sprout::uuids::uuid>
 		: public sprout::hash<sprout::uuids::uuid>
-	{};
+	{
+	public:
+		std::size_t operator()(sprout::uuids::uuid const& v) const {
+			return sprout::hash_memory(&v[0], v.size());
+		}
+	};
 #if defined(__clang__)
 #	pragma clang diagnostic pop
 #endif
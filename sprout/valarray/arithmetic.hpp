@@ -11,105 +11,84 @@
 #include <sprout/config.hpp>
 #include <sprout/workaround/std/cstddef.hpp>
 #include <sprout/valarray/valarray.hpp>
-#include <sprout/algorithm/fixed/transform.hpp>
+#include <sprout/valarray/expression.hpp>
 #include <sprout/functional/plus.hpp>
 #include <sprout/functional/minus.hpp>
 #include <sprout/functional/multiplies.hpp>
 #include <sprout/functional/divides.hpp>
 #include <sprout/functional/modulus.hpp>
-#include <sprout/functional/bind2nd.hpp>
-#include <sprout/functional/bind1st.hpp>
+#include <sprout/functional/negate.hpp>
+#include <sprout/functional/posite.hpp>
 
 namespace sprout {
+	//
+	//	The operands are valarrays, subset arrays (slice_array, ...) or other
+	//	expressions, and at most one scalar; the result is an expression (see
+	//	sprout/valarray/expression.hpp), so that a * b + c is computed in a single
+	//	pass when it is assigned to a valarray.
+	//
 	//
 	// operator+
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	operator+(sprout::valarray<T, N> const& lhs, sprout::valarray<T, N> const& rhs) {
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), rhs.begin(), lhs, sprout::plus<>());
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	operator+(sprout::valarray<T, N> const& lhs, T const& rhs) {
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), lhs, sprout::bind2nd(sprout::plus<>(), rhs));
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	operator+(T const& lhs, sprout::valarray<T, N> const& rhs) {
-		return sprout::fixed::transform(rhs.begin(), rhs.end(), rhs, sprout::bind1st(sprout::plus<>(), lhs));
+	template<typename L, typename R>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_binary<sprout::plus<>, L, R>::type
+	operator+(L const& lhs, R const& rhs) {
+		return sprout::detail::valarray_binary<sprout::plus<>, L, R>::make(lhs, rhs);
 	}
 	//
 	// operator-
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	operator-(sprout::valarray<T, N> const& lhs, sprout::valarray<T, N> const& rhs) {
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), rhs.begin(), lhs, sprout::minus<>());
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	operator-(sprout::valarray<T, N> const& lhs, T const& rhs) {
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), lhs, sprout::bind2nd(sprout::minus<>(), rhs));
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	operator-(T const& lhs, sprout::valarray<T, N> const& rhs) {
-		return sprout::fixed::transform(rhs.begin(), rhs.end(), rhs, sprout::bind1st(sprout::minus<>(), lhs));
+	template<typename L, typename R>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_binary<sprout::minus<>, L, R>::type
+	operator-(L const& lhs, R const& rhs) {
+		return sprout::detail::valarray_binary<sprout::minus<>, L, R>::make(lhs, rhs);
 	}
 	//
 	// operator*
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	operator*(sprout::valarray<T, N> const& lhs, sprout::valarray<T, N> const& rhs) {
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), rhs.begin(), lhs, sprout::multiplies<>());
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	operator*(sprout::valarray<T, N> const& lhs, T const& rhs) {
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), lhs, sprout::bind2nd(sprout::multiplies<>(), rhs));
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	operator*(T const& lhs, sprout::valarray<T, N> const& rhs) {
-		return sprout::fixed::transform(rhs.begin(), rhs.end(), rhs, sprout::bind1st(sprout::multiplies<>(), lhs));
+	template<typename L, typename R>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_binary<sprout::multiplies<>, L, R>::type
+	operator*(L const& lhs, R const& rhs) {
+		return sprout::detail::valarray_binary<sprout::multiplies<>, L, R>::make(lhs, rhs);
 	}
 	//
 	// operator/
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	operator/(sprout::valarray<T, N> const& lhs, sprout::valarray<T, N> const& rhs) {
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), rhs.begin(), lhs, sprout::divides<>());
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	operator/(sprout::valarray<T, N> const& lhs, T const& rhs) {
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), lhs, sprout::bind2nd(sprout::divides<>(), rhs));
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	operator/(T const& lhs, sprout::valarray<T, N> const& rhs) {
-		return sprout::fixed::transform(rhs.begin(), rhs.end(), rhs, sprout::bind1st(sprout::divides<>(), lhs));
+	template<typename L, typename R>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_binary<sprout::divides<>, L, R>::type
+	operator/(L const& lhs, R const& rhs) {
+		return sprout::detail::valarray_binary<sprout::divides<>, L, R>::make(lhs, rhs);
 	}
 	//
 	// operator%
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	operator%(sprout::valarray<T, N> const& lhs, sprout::valarray<T, N> const& rhs) {
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), rhs.begin(), lhs, sprout::modulus<>());
+	template<typename L, typename R>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_binary<sprout::modulus<>, L, R>::type
+	operator%(L const& lhs, R const& rhs) {
+		return sprout::detail::valarray_binary<sprout::modulus<>, L, R>::make(lhs, rhs);
 	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	operator%(sprout::valarray<T, N> const& lhs, T const& rhs) {
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), lhs, sprout::bind2nd(sprout::modulus<>(), rhs));
+
+	//
+	// operator+
+	// operator-
+	//
+	//	Of expressions; those of valarray are members.
+	//
+	template<typename X>
+	inline SPROUT_CONSTEXPR typename std::enable_if<
+		sprout::is_valarray_expression<X>::value,
+		typename sprout::detail::valarray_unary<sprout::posite<>, X>::type
+	>::type
+	operator+(X const& x) {
+		return sprout::detail::valarray_unary<sprout::posite<>, X>::make(x);
 	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	operator%(T const& lhs, sprout::valarray<T, N> const& rhs) {
-		return sprout::fixed::transform(rhs.begin(), rhs.end(), rhs, sprout::bind1st(sprout::modulus<>(), lhs));
+	template<typename X>
+	inline SPROUT_CONSTEXPR typename std::enable_if<
+		sprout::is_valarray_expression<X>::value,
+		typename sprout::detail::valarray_unary<sprout::negate<>, X>::type
+	>::type
+	operator-(X const& x) {
+		return sprout::detail::valarray_unary<sprout::negate<>, X>::make(x);
 	}
 }	// namespace sprout
 
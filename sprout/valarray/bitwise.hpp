@@ -11,105 +11,68 @@
 #include <sprout/config.hpp>
 #include <sprout/workaround/std/cstddef.hpp>
 #include <sprout/valarray/valarray.hpp>
-#include <sprout/algorithm/fixed/transform.hpp>
+#include <sprout/valarray/expression.hpp>
 #include <sprout/functional/bit_and.hpp>
 #include <sprout/functional/bit_or.hpp>
 #include <sprout/functional/bit_xor.hpp>
 #include <sprout/functional/shift_left.hpp>
 #include <sprout/functional/shift_right.hpp>
-#include <sprout/functional/bind2nd.hpp>
-#include <sprout/functional/bind1st.hpp>
+#include <sprout/functional/bit_not.hpp>
 
 namespace sprout {
 	//
 	// operator&
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	operator&(sprout::valarray<T, N> const& lhs, sprout::valarray<T, N> const& rhs) {
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), rhs.begin(), lhs, sprout::bit_and<>());
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	operator&(sprout::valarray<T, N> const& lhs, T const& rhs) {
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), lhs, sprout::bind2nd(sprout::bit_and<>(), rhs));
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	operator&(T const& lhs, sprout::valarray<T, N> const& rhs) {
-		return sprout::fixed::transform(rhs.begin(), rhs.end(), rhs, sprout::bind1st(sprout::bit_and<>(), lhs));
+	template<typename L, typename R>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_binary<sprout::bit_and<>, L, R>::type
+	operator&(L const& lhs, R const& rhs) {
+		return sprout::detail::valarray_binary<sprout::bit_and<>, L, R>::make(lhs, rhs);
 	}
 	//
 	// operator|
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	operator|(sprout::valarray<T, N> const& lhs, sprout::valarray<T, N> const& rhs) {
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), rhs.begin(), lhs, sprout::bit_or<>());
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	operator|(sprout::valarray<T, N> const& lhs, T const& rhs) {
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), lhs, sprout::bind2nd(sprout::bit_or<>(), rhs));
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	operator|(T const& lhs, sprout::valarray<T, N> const& rhs) {
-		return sprout::fixed::transform(rhs.begin(), rhs.end(), rhs, sprout::bind1st(sprout::bit_or<>(), lhs));
+	template<typename L, typename R>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_binary<sprout::bit_or<>, L, R>::type
+	operator|(L const& lhs, R const& rhs) {
+		return sprout::detail::valarray_binary<sprout::bit_or<>, L, R>::make(lhs, rhs);
 	}
 	//
 	// operator^
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	operator^(sprout::valarray<T, N> const& lhs, sprout::valarray<T, N> const& rhs) {
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), rhs.begin(), lhs, sprout::bit_xor<>());
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	operator^(sprout::valarray<T, N> const& lhs, T const& rhs) {
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), lhs, sprout::bind2nd(sprout::bit_xor<>(), rhs));
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	operator^(T const& lhs, sprout::valarray<T, N> const& rhs) {
-		return sprout::fixed::transform(rhs.begin(), rhs.end(), rhs, sprout::bind1st(sprout::bit_xor<>(), lhs));
+	template<typename L, typename R>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_binary<sprout::bit_xor<>, L, R>::type
+	operator^(L const& lhs, R const& rhs) {
+		return sprout::detail::valarray_binary<sprout::bit_xor<>, L, R>::make(lhs, rhs);
 	}
 	//
 	// operator<<
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	operator<<(sprout::valarray<T, N> const& lhs, sprout::valarray<T, N> const& rhs) {
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), rhs.begin(), lhs, sprout::shift_left<>());
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	operator<<(sprout::valarray<T, N> const& lhs, T const& rhs) {
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), lhs, sprout::bind2nd(sprout::shift_left<>(), rhs));
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	operator<<(T const& lhs, sprout::valarray<T, N> const& rhs) {
-		return sprout::fixed::transform(rhs.begin(), rhs.end(), rhs, sprout::bind1st(sprout::shift_left<>(), lhs));
+	template<typename L, typename R>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_binary<sprout::shift_left<>, L, R>::type
+	operator<<(L const& lhs, R const& rhs) {
+		return sprout::detail::valarray_binary<sprout::shift_left<>, L, R>::make(lhs, rhs);
 	}
 	//
 	// operator>>
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	operator>>(sprout::valarray<T, N> const& lhs, sprout::valarray<T, N> const& rhs) {
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), rhs.begin(), lhs, sprout::shift_right<>());
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	operator>>(sprout::valarray<T, N> const& lhs, T const& rhs) {
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), lhs, sprout::bind2nd(sprout::shift_right<>(), rhs));
+	template<typename L, typename R>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_binary<sprout::shift_right<>, L, R>::type
+	operator>>(L const& lhs, R const& rhs) {
+		return sprout::detail::valarray_binary<sprout::shift_right<>, L, R>::make(lhs, rhs);
 	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	operator>>(T const& lhs, sprout::valarray<T, N> const& rhs) {
-		return sprout::fixed::transform(rhs.begin(), rhs.end(), rhs, sprout::bind1st(sprout::shift_right<>(), lhs));
+
+	//
+	// operator~
+	//
+	//	Of expressions; that of valarray is a member.
+	//
+	template<typename X>
+	inline SPROUT_CONSTEXPR typename std::enable_if<
+		sprout::is_valarray_expression<X>::value,
+		typename sprout::detail::valarray_unary<sprout::bit_not<>, X>::type
+	>::type
+	operator~(X const& x) {
+		return sprout::detail::valarray_unary<sprout::bit_not<>, X>::make(x);
 	}
 }	// namespace sprout
 
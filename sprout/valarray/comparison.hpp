@@ -11,143 +11,74 @@
 #include <sprout/config.hpp>
 #include <sprout/workaround/std/cstddef.hpp>
 #include <sprout/valarray/valarray.hpp>
-#include <sprout/algorithm/fixed/transform.hpp>
+#include <sprout/valarray/expression.hpp>
 #include <sprout/functional/equal_to.hpp>
 #include <sprout/functional/not_equal_to.hpp>
-#include <sprout/functional/greater.hpp>
 #include <sprout/functional/less.hpp>
-#include <sprout/functional/greater_equal.hpp>
+#include <sprout/functional/greater.hpp>
 #include <sprout/functional/less_equal.hpp>
-#include <sprout/functional/bind2nd.hpp>
-#include <sprout/functional/bind1st.hpp>
-#include <sprout/sized_pit/sized_pit.hpp>
+#include <sprout/functional/greater_equal.hpp>
 
 namespace sprout {
 	//
 	// operator==
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<bool, N>
-	operator==(sprout::valarray<T, N> const& lhs, sprout::valarray<T, N> const& rhs) {
-		typedef sprout::sized_pit<sprout::valarray<bool, N> > sized_pit_type;
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), rhs.begin(), sized_pit_type(lhs.size()), sprout::equal_to<>());
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<bool, N>
-	operator==(sprout::valarray<T, N> const& lhs, T const& rhs) {
-		typedef sprout::sized_pit<sprout::valarray<bool, N> > sized_pit_type;
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), sized_pit_type(lhs.size()), sprout::bind2nd(sprout::equal_to<>(), rhs));
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<bool, N>
-	operator==(T const& lhs, sprout::valarray<T, N> const& rhs) {
-		typedef sprout::sized_pit<sprout::valarray<bool, N> > sized_pit_type;
-		return sprout::fixed::transform(rhs.begin(), rhs.end(), sized_pit_type(rhs.size()), sprout::bind1st(sprout::equal_to<>(), lhs));
+	template<typename L, typename R>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_result<
+		typename sprout::detail::valarray_binary<sprout::equal_to<>, L, R, bool>::type
+	>::type
+	operator==(L const& lhs, R const& rhs) {
+		return sprout::detail::valarray_evaluate(sprout::detail::valarray_binary<sprout::equal_to<>, L, R, bool>::make(lhs, rhs));
 	}
 	//
 	// operator!=
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<bool, N>
-	operator!=(sprout::valarray<T, N> const& lhs, sprout::valarray<T, N> const& rhs) {
-		typedef sprout::sized_pit<sprout::valarray<bool, N> > sized_pit_type;
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), rhs.begin(), sized_pit_type(lhs.size()), sprout::not_equal_to<>());
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<bool, N>
-	operator!=(sprout::valarray<T, N> const& lhs, T const& rhs) {
-		typedef sprout::sized_pit<sprout::valarray<bool, N> > sized_pit_type;
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), sized_pit_type(lhs.size()), sprout::bind2nd(sprout::not_equal_to<>(), rhs));
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<bool, N>
-	operator!=(T const& lhs, sprout::valarray<T, N> const& rhs) {
-		typedef sprout::sized_pit<sprout::valarray<bool, N> > sized_pit_type;
-		return sprout::fixed::transform(rhs.begin(), rhs.end(), sized_pit_type(rhs.size()), sprout::bind1st(sprout::not_equal_to<>(), lhs));
+	template<typename L, typename R>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_result<
+		typename sprout::detail::valarray_binary<sprout::not_equal_to<>, L, R, bool>::type
+	>::type
+	operator!=(L const& lhs, R const& rhs) {
+		return sprout::detail::valarray_evaluate(sprout::detail::valarray_binary<sprout::not_equal_to<>, L, R, bool>::make(lhs, rhs));
 	}
 	//
 	// operator<
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<bool, N>
-	operator<(sprout::valarray<T, N> const& lhs, sprout::valarray<T, N> const& rhs) {
-		typedef sprout::sized_pit<sprout::valarray<bool, N> > sized_pit_type;
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), rhs.begin(), sized_pit_type(lhs.size()), sprout::less<>());
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<bool, N>
-	operator<(sprout::valarray<T, N> const& lhs, T const& rhs) {
-		typedef sprout::sized_pit<sprout::valarray<bool, N> > sized_pit_type;
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), sized_pit_type(lhs.size()), sprout::bind2nd(sprout::less<>(), rhs));
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<bool, N>
-	operator<(T const& lhs, sprout::valarray<T, N> const& rhs) {
-		typedef sprout::sized_pit<sprout::valarray<bool, N> > sized_pit_type;
-		return sprout::fixed::transform(rhs.begin(), rhs.end(), sized_pit_type(rhs.size()), sprout::bind1st(sprout::less<>(), lhs));
+	template<typename L, typename R>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_result<
+		typename sprout::detail::valarray_binary<sprout::less<>, L, R, bool>::type
+	>::type
+	operator<(L const& lhs, R const& rhs) {
+		return sprout::detail::valarray_evaluate(sprout::detail::valarray_binary<sprout::less<>, L, R, bool>::make(lhs, rhs));
 	}
 	//
 	// operator>
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<bool, N>
-	operator>(sprout::valarray<T, N> const& lhs, sprout::valarray<T, N> const& rhs) {
-		typedef sprout::sized_pit<sprout::valarray<bool, N> > sized_pit_type;
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), rhs.begin(), sized_pit_type(lhs.size()), sprout::greater<>());
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<bool, N>
-	operator>(sprout::valarray<T, N> const& lhs, T const& rhs) {
-		typedef sprout::sized_pit<sprout::valarray<bool, N> > sized_pit_type;
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), sized_pit_type(lhs.size()), sprout::bind2nd(sprout::greater<>(), rhs));
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<bool, N>
-	operator>(T const& lhs, sprout::valarray<T, N> const& rhs) {
-		typedef sprout::sized_pit<sprout::valarray<bool, N> > sized_pit_type;
-		return sprout::fixed::transform(rhs.begin(), rhs.end(), sized_pit_type(rhs.size()), sprout::bind1st(sprout::greater<>(), lhs));
+	template<typename L, typename R>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_result<
+		typename sprout::detail::valarray_binary<sprout::greater<>, L, R, bool>::type
+	>::type
+	operator>(L const& lhs, R const& rhs) {
+		return sprout::detail::valarray_evaluate(sprout::detail::valarray_binary<sprout::greater<>, L, R, bool>::make(lhs, rhs));
 	}
 	//
 	// operator<=
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<bool, N>
-	operator<=(sprout::valarray<T, N> const& lhs, sprout::valarray<T, N> const& rhs) {
-		typedef sprout::sized_pit<sprout::valarray<bool, N> > sized_pit_type;
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), rhs.begin(), sized_pit_type(lhs.size()), sprout::less_equal<>());
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<bool, N>
-	operator<=(sprout::valarray<T, N> const& lhs, T const& rhs) {
-		typedef sprout::sized_pit<sprout::valarray<bool, N> > sized_pit_type;
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), sized_pit_type(lhs.size()), sprout::bind2nd(sprout::less_equal<>(), rhs));
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<bool, N>
-	operator<=(T const& lhs, sprout::valarray<T, N> const& rhs) {
-		typedef sprout::sized_pit<sprout::valarray<bool, N> > sized_pit_type;
-		return sprout::fixed::transform(rhs.begin(), rhs.end(), sized_pit_type(rhs.size()), sprout::bind1st(sprout::less_equal<>(), lhs));
+	template<typename L, typename R>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_result<
+		typename sprout::detail::valarray_binary<sprout::less_equal<>, L, R, bool>::type
+	>::type
+	operator<=(L const& lhs, R const& rhs) {
+		return sprout::detail::valarray_evaluate(sprout::detail::valarray_binary<sprout::less_equal<>, L, R, bool>::make(lhs, rhs));
 	}
 	//
 	// operator>=
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<bool, N>
-	operator>=(sprout::valarray<T, N> const& lhs, sprout::valarray<T, N> const& rhs) {
-		typedef sprout::sized_pit<sprout::valarray<bool, N> > sized_pit_type;
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), rhs.begin(), sized_pit_type(lhs.size()), sprout::greater_equal<>());
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<bool, N>
-	operator>=(sprout::valarray<T, N> const& lhs, T const& rhs) {
-		typedef sprout::sized_pit<sprout::valarray<bool, N> > sized_pit_type;
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), sized_pit_type(lhs.size()), sprout::bind2nd(sprout::greater_equal<>(), rhs));
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<bool, N>
-	operator>=(T const& lhs, sprout::valarray<T, N> const& rhs) {
-		typedef sprout::sized_pit<sprout::valarray<bool, N> > sized_pit_type;
-		return sprout::fixed::transform(rhs.begin(), rhs.end(), sized_pit_type(rhs.size()), sprout::bind1st(sprout::greater_equal<>(), lhs));
+	template<typename L, typename R>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_result<
+		typename sprout::detail::valarray_binary<sprout::greater_equal<>, L, R, bool>::type
+	>::type
+	operator>=(L const& lhs, R const& rhs) {
+		return sprout::detail::valarray_evaluate(sprout::detail::valarray_binary<sprout::greater_equal<>, L, R, bool>::make(lhs, rhs));
 	}
 }	// namespace sprout
 
@@ -12,7 +12,7 @@
 #include <sprout/config.hpp>
 #include <sprout/workaround/std/cstddef.hpp>
 #include <sprout/valarray/valarray.hpp>
-#include <sprout/algorithm/fixed/transform.hpp>
+#include <sprout/valarray/expression.hpp>
 #include <sprout/math/exp.hpp>
 #include <sprout/math/exp10.hpp>
 #include <sprout/math/exp2.hpp>
@@ -194,66 +194,66 @@ namespace sprout {
 	//
 	// exp
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	exp(sprout::valarray<T, N> const& x) {
-		return sprout::fixed::transform(x.begin(), x.end(), x, sprout::detail::exp_f());
+	template<typename X>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_unary<sprout::detail::exp_f, X>::type
+	exp(X const& x) {
+		return sprout::detail::valarray_unary<sprout::detail::exp_f, X>::make(x);
 	}
 	//
 	// exp10
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	exp10(sprout::valarray<T, N> const& x) {
-		return sprout::fixed::transform(x.begin(), x.end(), x, sprout::detail::exp10_f());
+	template<typename X>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_unary<sprout::detail::exp10_f, X>::type
+	exp10(X const& x) {
+		return sprout::detail::valarray_unary<sprout::detail::exp10_f, X>::make(x);
 	}
 	//
 	// exp2
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	exp2(sprout::valarray<T, N> const& x) {
-		return sprout::fixed::transform(x.begin(), x.end(), x, sprout::detail::exp2_f());
+	template<typename X>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_unary<sprout::detail::exp2_f, X>::type
+	exp2(X const& x) {
+		return sprout::detail::valarray_unary<sprout::detail::exp2_f, X>::make(x);
 	}
 	//
 	// expm1
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	expm1(sprout::valarray<T, N> const& x) {
-		return sprout::fixed::transform(x.begin(), x.end(), x, sprout::detail::expm1_f());
+	template<typename X>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_unary<sprout::detail::expm1_f, X>::type
+	expm1(X const& x) {
+		return sprout::detail::valarray_unary<sprout::detail::expm1_f, X>::make(x);
 	}
 	//
 	// log
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	log(sprout::valarray<T, N> const& x) {
-		return sprout::fixed::transform(x.begin(), x.end(), x, sprout::detail::log_f());
+	template<typename X>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_unary<sprout::detail::log_f, X>::type
+	log(X const& x) {
+		return sprout::detail::valarray_unary<sprout::detail::log_f, X>::make(x);
 	}
 	//
 	// log10
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	log10(sprout::valarray<T, N> const& x) {
-		return sprout::fixed::transform(x.begin(), x.end(), x, sprout::detail::log10_f());
+	template<typename X>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_unary<sprout::detail::log10_f, X>::type
+	log10(X const& x) {
+		return sprout::detail::valarray_unary<sprout::detail::log10_f, X>::make(x);
 	}
 	//
 	// log1p
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	log1p(sprout::valarray<T, N> const& x) {
-		return sprout::fixed::transform(x.begin(), x.end(), x, sprout::detail::log1p_f());
+	template<typename X>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_unary<sprout::detail::log1p_f, X>::type
+	log1p(X const& x) {
+		return sprout::detail::valarray_unary<sprout::detail::log1p_f, X>::make(x);
 	}
 	//
 	// log2
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	log2(sprout::valarray<T, N> const& x) {
-		return sprout::fixed::transform(x.begin(), x.end(), x, sprout::detail::log2_f());
+	template<typename X>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_unary<sprout::detail::log2_f, X>::type
+	log2(X const& x) {
+		return sprout::detail::valarray_unary<sprout::detail::log2_f, X>::make(x);
 	}
 }	// namespace sprout
 
@@ -0,0 +1,440 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_VALARRAY_EXPRESSION_HPP
+#define SPROUT_VALARRAY_EXPRESSION_HPP
+
+#include <type_traits>
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/type_traits/integral_constant.hpp>
+#include <sprout/valarray/valarray_fwd.hpp>
+
+namespace sprout {
+	//
+	// valarray_scalar
+	// valarray_reference
+	//
+	//	The leaves of an expression: a scalar repeated over every index, and a
+	//	valarray held by reference. The subset arrays (slice_array, ...) are
+	//	references already and are held as they are.
+	//
+	template<typename T>
+	class valarray_scalar {
+	public:
+		typedef T value_type;
+		typedef std::size_t size_type;
+	public:
+		SPROUT_STATIC_CONSTEXPR size_type static_size = 0;
+	private:
+		value_type value_;
+	public:
+		explicit SPROUT_CONSTEXPR valarray_scalar(value_type const& value)
+			: value_(value)
+		{}
+		SPROUT_CONSTEXPR size_type size() const SPROUT_NOEXCEPT {
+			return 0;
+		}
+		SPROUT_CONSTEXPR value_type const& operator[](size_type) const {
+			return value_;
+		}
+	};
+	template<typename T>
+	SPROUT_CONSTEXPR_OR_CONST typename sprout::valarray_scalar<T>::size_type sprout::valarray_scalar<T>::static_size;
+
+	template<typename T, std::size_t N>
+	class valarray_reference {
+	public:
+		typedef T value_type;
+		typedef std::size_t size_type;
+	public:
+		SPROUT_STATIC_CONSTEXPR size_type static_size = N;
+	private:
+		sprout::valarray<T, N> const& arr_;
+	public:
+		explicit SPROUT_CONSTEXPR valarray_reference(sprout::valarray<T, N> const& arr)
+			: arr_(arr)
+		{}
+		SPROUT_CONSTEXPR size_type size() const SPROUT_NOEXCEPT {
+			return arr_.size();
+		}
+		SPROUT_CONSTEXPR value_type const& operator[](size_type i) const {
+			return arr_[i];
+		}
+	};
+	template<typename T, std::size_t N>
+	SPROUT_CONSTEXPR_OR_CONST typename sprout::valarray_reference<T, N>::size_type sprout::valarray_reference<T, N>::static_size;
+
+	//
+	// valarray_unary_expr
+	// valarray_binary_expr
+	//
+	//	Element i is F applied to element i of the operands, converted to T; the
+	//	size is that of the operand that is not a scalar. Nothing is computed until
+	//	a valarray is constructed or assigned from the expression, which then takes
+	//	one pass over the elements, or until one of the members that a valarray has
+	//	(sum, min, max, apply) is called; eval() returns the valarray. An expression
+	//	refers to the valarrays it was built from and must not outlive them.
+	//
+	template<typename T, typename F, typename E>
+	class valarray_unary_expr {
+	public:
+		typedef T value_type;
+		typedef std::size_t size_type;
+	public:
+		SPROUT_STATIC_CONSTEXPR size_type static_size = E::static_size;
+	private:
+		E operand_;
+	public:
+		explicit SPROUT_CONSTEXPR valarray_unary_expr(E const& operand)
+			: operand_(operand)
+		{}
+		SPROUT_CONSTEXPR size_type size() const SPROUT_NOEXCEPT {
+			return operand_.size();
+		}
+		SPROUT_CONSTEXPR value_type operator[](size_type i) const {
+			return F()(operand_[i]);
+		}
+		SPROUT_CONSTEXPR E const& operand() const SPROUT_NOEXCEPT {
+			return operand_;
+		}
+		SPROUT_CONSTEXPR sprout::valarray<value_type, static_size> eval() const {
+			return sprout::valarray<value_type, static_size>(*this);
+		}
+		SPROUT_CONSTEXPR value_type sum() const {
+			return eval().sum();
+		}
+		SPROUT_CONSTEXPR value_type min() const {
+			return eval().min();
+		}
+		SPROUT_CONSTEXPR value_type max() const {
+			return eval().max();
+		}
+		SPROUT_CONSTEXPR sprout::valarray<value_type, static_size> apply(value_type func(value_type)) const {
+			return eval().apply(func);
+		}
+		SPROUT_CONSTEXPR sprout::valarray<value_type, static_size> apply(value_type func(value_type const&)) const {
+			return eval().apply(func);
+		}
+		template<typename G>
+		SPROUT_CONSTEXPR sprout::valarray<value_type, static_size> apply(G func) const {
+			return eval().apply(func);
+		}
+	};
+	template<typename T, typename F, typename E>
+	SPROUT_CONSTEXPR_OR_CONST typename sprout::valarray_unary_expr<T, F, E>::size_type sprout::valarray_unary_expr<T, F, E>::static_size;
+
+	template<typename T, typename F, typename L, typename R>
+	class valarray_binary_expr {
+	public:
+		typedef T value_type;
+		typedef std::size_t size_type;
+	public:
+		SPROUT_STATIC_CONSTEXPR size_type static_size = L::static_size != 0 ? L::static_size : R::static_size;
+	private:
+		L lhs_;
+		R rhs_;
+	public:
+		SPROUT_CONSTEXPR valarray_binary_expr(L const& lhs, R const& rhs)
+			: lhs_(lhs), rhs_(rhs)
+		{}
+		SPROUT_CONSTEXPR size_type size() const SPROUT_NOEXCEPT {
+			return L::static_size != 0 ? lhs_.size() : rhs_.size();
+		}
+		SPROUT_CONSTEXPR value_type operator[](size_type i) const {
+			return F()(lhs_[i], rhs_[i]);
+		}
+		SPROUT_CONSTEXPR L const& lhs() const SPROUT_NOEXCEPT {
+			return lhs_;
+		}
+		SPROUT_CONSTEXPR R const& rhs() const SPROUT_NOEXCEPT {
+			return rhs_;
+		}
+		SPROUT_CONSTEXPR sprout::valarray<value_type, static_size> eval() const {
+			return sprout::valarray<value_type, static_size>(*this);
+		}
+		SPROUT_CONSTEXPR value_type sum() const {
+			return eval().sum();
+		}
+		SPROUT_CONSTEXPR value_type min() const {
+			return eval().min();
+		}
+		SPROUT_CONSTEXPR value_type max() const {
+			return eval().max();
+		}
+		SPROUT_CONSTEXPR sprout::valarray<value_type, static_size> apply(value_type func(value_type)) const {
+			return eval().apply(func);
+		}
+		SPROUT_CONSTEXPR sprout::valarray<value_type, static_size> apply(value_type func(value_type const&)) const {
+			return eval().apply(func);
+		}
+		template<typename G>
+		SPROUT_CONSTEXPR sprout::valarray<value_type, static_size> apply(G func) const {
+			return eval().apply(func);
+		}
+	};
+	template<typename T, typename F, typename L, typename R>
+	SPROUT_CONSTEXPR_OR_CONST typename sprout::valarray_binary_expr<T, F, L, R>::size_type sprout::valarray_binary_expr<T, F, L, R>::static_size;
+
+	//
+	// is_valarray_expression
+	//
+	template<typename T>
+	struct is_valarray_expression
+		: public sprout::false_type
+	{};
+	template<typename T>
+	struct is_valarray_expression<T const>
+		: public sprout::is_valarray_expression<T>
+	{};
+	template<typename T, typename F, typename E>
+	struct is_valarray_expression<sprout::valarray_unary_expr<T, F, E> >
+		: public sprout::true_type
+	{};
+	template<typename T, typename F, typename L, typename R>
+	struct is_valarray_expression<sprout::valarray_binary_expr<T, F, L, R> >
+		: public sprout::true_type
+	{};
+
+	namespace detail {
+		//
+		// valarray_operand
+		//
+		//	type is how an argument of the valarray operators is held in an
+		//	expression; there is none for anything else, so the operators drop out
+		//	of overload resolution.
+		//
+		template<typename X, typename = void>
+		struct valarray_operand {};
+		template<typename T, std::size_t N>
+		struct valarray_operand<sprout::valarray<T, N> > {
+		public:
+			typedef sprout::valarray_reference<T, N> type;
+			static SPROUT_CONSTEXPR type make(sprout::valarray<T, N> const& x) {
+				return type(x);
+			}
+		};
+		template<typename X>
+		struct valarray_operand_as_is {
+		public:
+			typedef X type;
+			static SPROUT_CONSTEXPR type const& make(X const& x) {
+				return x;
+			}
+		};
+		template<typename T, std::size_t N>
+		struct valarray_operand<sprout::slice_array<T, N> >
+			: public sprout::detail::valarray_operand_as_is<sprout::slice_array<T, N> >
+		{};
+		template<typename T, std::size_t N, std::size_t M>
+		struct valarray_operand<sprout::gslice_array<T, N, M> >
+			: public sprout::detail::valarray_operand_as_is<sprout::gslice_array<T, N, M> >
+		{};
+		template<typename T, std::size_t N, std::size_t M>
+		struct valarray_operand<sprout::mask_array<T, N, M> >
+			: public sprout::detail::valarray_operand_as_is<sprout::mask_array<T, N, M> >
+		{};
+		template<typename T, std::size_t N, std::size_t M>
+		struct valarray_operand<sprout::indirect_array<T, N, M> >
+			: public sprout::detail::valarray_operand_as_is<sprout::indirect_array<T, N, M> >
+		{};
+		template<typename X>
+		struct valarray_operand<X, typename std::enable_if<sprout::is_valarray_expression<X>::value>::type>
+			: public sprout::detail::valarray_operand_as_is<X>
+		{};
+
+		template<typename X, typename = void>
+		struct is_valarray_operand
+			: public sprout::false_type
+		{};
+		template<typename X>
+		struct is_valarray_operand<X, typename std::enable_if<sizeof(typename sprout::detail::valarray_operand<X>::type) != 0>::type>
+			: public sprout::true_type
+		{};
+
+		//
+		// valarray_unary
+		// valarray_binary
+		//
+		//	The expression F(x) or F(lhs, rhs) of elements of Result (by default the
+		//	element type of the operands). One of lhs and rhs may be a scalar, which
+		//	is converted to the element type of the other.
+		//
+		template<typename F, typename X, typename Result = void, typename = void>
+		struct valarray_unary {};
+		template<typename F, typename X, typename Result>
+		struct valarray_unary<
+			F, X, Result,
+			typename std::enable_if<sprout::detail::is_valarray_operand<X>::value>::type
+		> {
+		private:
+			typedef sprout::detail::valarray_operand<X> operand;
+			typedef typename operand::type::value_type element_type;
+		public:
+			typedef sprout::valarray_unary_expr<
+				typename std::conditional<std::is_void<Result>::value, element_type, Result>::type,
+				F, typename operand::type
+			> type;
+		public:
+			static SPROUT_CONSTEXPR type make(X const& x) {
+				return type(operand::make(x));
+			}
+		};
+
+		template<typename F, typename L, typename R, typename Result = void, typename = void>
+		struct valarray_binary {};
+		template<typename F, typename L, typename R, typename Result>
+		struct valarray_binary<
+			F, L, R, Result,
+			typename std::enable_if<
+				sprout::detail::is_valarray_operand<L>::value && sprout::detail::is_valarray_operand<R>::value
+			>::type
+		> {
+		private:
+			typedef sprout::detail::valarray_operand<L> lhs_operand;
+			typedef sprout::detail::valarray_operand<R> rhs_operand;
+			typedef typename lhs_operand::type::value_type element_type;
+		public:
+			typedef sprout::valarray_binary_expr<
+				typename std::conditional<std::is_void<Result>::value, element_type, Result>::type,
+				F, typename lhs_operand::type, typename rhs_operand::type
+			> type;
+		public:
+			static SPROUT_CONSTEXPR type make(L const& lhs, R const& rhs) {
+				return type(lhs_operand::make(lhs), rhs_operand::make(rhs));
+			}
+		};
+		template<typename F, typename L, typename R, typename Result>
+		struct valarray_binary<
+			F, L, R, Result,
+			typename std::enable_if<
+				sprout::detail::is_valarray_operand<L>::value && !sprout::detail::is_valarray_operand<R>::value
+					&& std::is_convertible<R, typename sprout::detail::valarray_operand<L>::type::value_type>::value
+			>::type
+		> {
+		private:
+			typedef sprout::detail::valarray_operand<L> lhs_operand;
+			typedef typename lhs_operand::type::value_type element_type;
+		public:
+			typedef sprout::valarray_binary_expr<
+				typename std::conditional<std::is_void<Result>::value, element_type, Result>::type,
+				F, typename lhs_operand::type, sprout::valarray_scalar<element_type>
+			> type;
+		public:
+			static SPROUT_CONSTEXPR type make(L const& lhs, R const& rhs) {
+				return type(lhs_operand::make(lhs), sprout::valarray_scalar<element_type>(rhs));
+			}
+		};
+		template<typename F, typename L, typename R, typename Result>
+		struct valarray_binary<
+			F, L, R, Result,
+			typename std::enable_if<
+				!sprout::detail::is_valarray_operand<L>::value && sprout::detail::is_valarray_operand<R>::value
+					&& std::is_convertible<L, typename sprout::detail::valarray_operand<R>::type::value_type>::value
+			>::type
+		> {
+		private:
+			typedef sprout::detail::valarray_operand<R> rhs_operand;
+			typedef typename rhs_operand::type::value_type element_type;
+		public:
+			typedef sprout::valarray_binary_expr<
+				typename std::conditional<std::is_void<Result>::value, element_type, Result>::type,
+				F, sprout::valarray_scalar<element_type>, typename rhs_operand::type
+			> type;
+		public:
+			static SPROUT_CONSTEXPR type make(L const& lhs, R const& rhs) {
+				return type(sprout::valarray_scalar<element_type>(lhs), rhs_operand::make(rhs));
+			}
+		};
+
+		//
+		// valarray_result
+		// valarray_evaluate
+		//
+		//	The valarray an expression converts to, for the operators that return
+		//	valarray<bool, N> rather than an expression.
+		//
+		template<typename Expression>
+		struct valarray_result {
+		public:
+			typedef sprout::valarray<typename Expression::value_type, Expression::static_size> type;
+		};
+		template<typename Expression>
+		inline SPROUT_CONSTEXPR typename sprout::detail::valarray_result<Expression>::type
+		valarray_evaluate(Expression const& x) {
+			return typename sprout::detail::valarray_result<Expression>::type(x);
+		}
+
+		//
+		// valarray_alias
+		// valarray_aliases
+		//
+		//	Whether a subset array in x refers to arr, in which case assigning x to
+		//	arr element by element could read elements already overwritten.
+		//
+		template<typename X>
+		struct valarray_alias {
+		public:
+			template<typename T, std::size_t N>
+			static SPROUT_CONSTEXPR bool call(X const&, sprout::valarray<T, N> const&) {
+				return false;
+			}
+		};
+		template<typename X, typename T, std::size_t N>
+		struct valarray_subset_alias {
+		public:
+			template<typename U, std::size_t M>
+			static SPROUT_CONSTEXPR bool call(X const&, sprout::valarray<U, M> const&) {
+				return false;
+			}
+			static SPROUT_CONSTEXPR bool call(X const& x, sprout::valarray<T, N> const& arr) {
+				return x.refers_to(arr);
+			}
+		};
+		template<typename T, std::size_t N>
+		struct valarray_alias<sprout::slice_array<T, N> >
+			: public sprout::detail::valarray_subset_alias<sprout::slice_array<T, N>, T, N>
+		{};
+		template<typename T, std::size_t N, std::size_t M>
+		struct valarray_alias<sprout::gslice_array<T, N, M> >
+			: public sprout::detail::valarray_subset_alias<sprout::gslice_array<T, N, M>, T, N>
+		{};
+		template<typename T, std::size_t N, std::size_t M>
+		struct valarray_alias<sprout::mask_array<T, N, M> >
+			: public sprout::detail::valarray_subset_alias<sprout::mask_array<T, N, M>, T, N>
+		{};
+		template<typename T, std::size_t N, std::size_t M>
+		struct valarray_alias<sprout::indirect_array<T, N, M> >
+			: public sprout::detail::valarray_subset_alias<sprout::indirect_array<T, N, M>, T, N>
+		{};
+		template<typename U, typename F, typename E>
+		struct valarray_alias<sprout::valarray_unary_expr<U, F, E> > {
+		public:
+			template<typename T, std::size_t N>
+			static SPROUT_CONSTEXPR bool call(sprout::valarray_unary_expr<U, F, E> const& x, sprout::valarray<T, N> const& arr) {
+				return sprout::detail::valarray_alias<E>::call(x.operand(), arr);
+			}
+		};
+		template<typename U, typename F, typename L, typename R>
+		struct valarray_alias<sprout::valarray_binary_expr<U, F, L, R> > {
+		public:
+			template<typename T, std::size_t N>
+			static SPROUT_CONSTEXPR bool call(sprout::valarray_binary_expr<U, F, L, R> const& x, sprout::valarray<T, N> const& arr) {
+				return sprout::detail::valarray_alias<L>::call(x.lhs(), arr)
+					|| sprout::detail::valarray_alias<R>::call(x.rhs(), arr)
+					;
+			}
+		};
+		template<typename Expression, typename T, std::size_t N>
+		inline SPROUT_CONSTEXPR bool
+		valarray_aliases(Expression const& x, sprout::valarray<T, N> const& arr) {
+			return sprout::detail::valarray_alias<Expression>::call(x, arr);
+		}
+	}	// namespace detail
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_VALARRAY_EXPRESSION_HPP
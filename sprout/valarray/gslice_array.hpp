@@ -8,9 +8,11 @@
 #ifndef SPROUT_VALARRAY_GSLICE_ARRAY_HPP
 #define SPROUT_VALARRAY_GSLICE_ARRAY_HPP
 
+#include <type_traits>
 #include <sprout/config.hpp>
 #include <sprout/workaround/std/cstddef.hpp>
 #include <sprout/utility/swap.hpp>
+#include <sprout/memory/addressof.hpp>
 #include <sprout/iterator/next.hpp>
 #include <sprout/iterator/index_iterator.hpp>
 #include <sprout/iterator/reverse_iterator.hpp>
@@ -21,6 +23,7 @@
 #include <sprout/range/adaptor/copied.hpp>
 #include <sprout/range/adaptor/reversed.hpp>
 #include <sprout/valarray/valarray_fwd.hpp>
+#include <sprout/valarray/expression.hpp>
 
 namespace sprout {
 	//
@@ -126,6 +129,12 @@ namespace sprout {
 		operator=(sprout::valarray<T, N2> const& ar) const {
 			sprout::copy(ar.begin(), ar.end(), begin());
 		}
+		// an expression is evaluated first, so it may read the elements assigned
+		template<typename Expression>
+		SPROUT_CXX14_CONSTEXPR typename std::enable_if<sprout::is_valarray_expression<Expression>::value>::type
+		operator=(Expression const& ar) const {
+			*this = sprout::valarray<T, Expression::static_size>(ar);
+		}
 		SPROUT_CXX14_CONSTEXPR void
 		operator=(T const& value) const {
 			sprout::fill(begin(), end(), value);
@@ -138,6 +147,11 @@ namespace sprout {
 				*it2 += *it;
 			}
 		}
+		template<typename Expression>
+		SPROUT_CXX14_CONSTEXPR typename std::enable_if<sprout::is_valarray_expression<Expression>::value>::type
+		operator+=(Expression const& xs) const {
+			*this += sprout::valarray<T, Expression::static_size>(xs);
+		}
 		template<std::size_t N2>
 		SPROUT_CXX14_CONSTEXPR void
 		operator-=(sprout::valarray<T, N2> const& xs) const {
@@ -146,6 +160,11 @@ namespace sprout {
 				*it2 -= *it;
 			}
 		}
+		template<typename Expression>
+		SPROUT_CXX14_CONSTEXPR typename std::enable_if<sprout::is_valarray_expression<Expression>::value>::type
+		operator-=(Expression const& xs) const {
+			*this -= sprout::valarray<T, Expression::static_size>(xs);
+		}
 		template<std::size_t N2>
 		SPROUT_CXX14_CONSTEXPR void
 		operator*=(sprout::valarray<T, N2> const& xs) const {
@@ -154,6 +173,11 @@ namespace sprout {
 				*it2 *= *it;
 			}
 		}
+		template<typename Expression>
+		SPROUT_CXX14_CONSTEXPR typename std::enable_if<sprout::is_valarray_expression<Expression>::value>::type
+		operator*=(Expression const& xs) const {
+			*this *= sprout::valarray<T, Expression::static_size>(xs);
+		}
 		template<std::size_t N2>
 		SPROUT_CXX14_CONSTEXPR void
 		operator/=(sprout::valarray<T, N2> const& xs) const {
@@ -162,6 +186,11 @@ namespace sprout {
 				*it2 /= *it;
 			}
 		}
+		template<typename Expression>
+		SPROUT_CXX14_CONSTEXPR typename std::enable_if<sprout::is_valarray_expression<Expression>::value>::type
+		operator/=(Expression const& xs) const {
+			*this /= sprout::valarray<T, Expression::static_size>(xs);
+		}
 		template<std::size_t N2>
 		SPROUT_CXX14_CONSTEXPR void
 		operator%=(sprout::valarray<T, N2> const& xs) const {
@@ -170,6 +199,11 @@ namespace sprout {
 				*it2 %= *it;
 			}
 		}
+		template<typename Expression>
+		SPROUT_CXX14_CONSTEXPR typename std::enable_if<sprout::is_valarray_expression<Expression>::value>::type
+		operator%=(Expression const& xs) const {
+			*this %= sprout::valarray<T, Expression::static_size>(xs);
+		}
 		template<std::size_t N2>
 		SPROUT_CXX14_CONSTEXPR void
 		operator&=(sprout::valarray<T, N2> const& xs) const {
@@ -178,6 +212,11 @@ namespace sprout {
 				*it2 &= *it;
 			}
 		}
+		template<typename Expression>
+		SPROUT_CXX14_CONSTEXPR typename std::enable_if<sprout::is_valarray_expression<Expression>::value>::type
+		operator&=(Expression const& xs) const {
+			*this &= sprout::valarray<T, Expression::static_size>(xs);
+		}
 		template<std::size_t N2>
 		SPROUT_CXX14_CONSTEXPR void
 		operator|=(sprout::valarray<T, N2> const& xs) const {
@@ -186,6 +225,11 @@ namespace sprout {
 				*it2 |= *it;
 			}
 		}
+		template<typename Expression>
+		SPROUT_CXX14_CONSTEXPR typename std::enable_if<sprout::is_valarray_expression<Expression>::value>::type
+		operator|=(Expression const& xs) const {
+			*this |= sprout::valarray<T, Expression::static_size>(xs);
+		}
 		template<std::size_t N2>
 		SPROUT_CXX14_CONSTEXPR void
 		operator^=(sprout::valarray<T, N2> const& xs) const {
@@ -194,6 +238,11 @@ namespace sprout {
 				*it2 ^= *it;
 			}
 		}
+		template<typename Expression>
+		SPROUT_CXX14_CONSTEXPR typename std::enable_if<sprout::is_valarray_expression<Expression>::value>::type
+		operator^=(Expression const& xs) const {
+			*this ^= sprout::valarray<T, Expression::static_size>(xs);
+		}
 		template<std::size_t N2>
 		SPROUT_CXX14_CONSTEXPR void
 		operator<<=(sprout::valarray<T, N2> const& xs) const {
@@ -202,6 +251,11 @@ namespace sprout {
 				*it2 <<= *it;
 			}
 		}
+		template<typename Expression>
+		SPROUT_CXX14_CONSTEXPR typename std::enable_if<sprout::is_valarray_expression<Expression>::value>::type
+		operator<<=(Expression const& xs) const {
+			*this <<= sprout::valarray<T, Expression::static_size>(xs);
+		}
 		template<std::size_t N2>
 		SPROUT_CXX14_CONSTEXPR void
 		operator>>=(sprout::valarray<T, N2> const& xs) const {
@@ -210,6 +264,11 @@ namespace sprout {
 				*it2 >>= *it;
 			}
 		}
+		template<typename Expression>
+		SPROUT_CXX14_CONSTEXPR typename std::enable_if<sprout::is_valarray_expression<Expression>::value>::type
+		operator>>=(Expression const& xs) const {
+			*this >>= sprout::valarray<T, Expression::static_size>(xs);
+		}
 
 		SPROUT_CXX14_CONSTEXPR void
 		swap(gslice_array& other) SPROUT_NOEXCEPT {
@@ -218,6 +277,10 @@ namespace sprout {
 			sprout::swap(size_, other.size_);
 			sprout::swap(stride_, other.stride_);
 		}
+		SPROUT_CONSTEXPR bool
+		refers_to(valarray_type const& arr) const SPROUT_NOEXCEPT {
+			return sprout::addressof(*arr_) == sprout::addressof(arr);
+		}
 
 		// iterators:
 		SPROUT_CONSTEXPR iterator
@@ -12,7 +12,7 @@
 #include <sprout/config.hpp>
 #include <sprout/workaround/std/cstddef.hpp>
 #include <sprout/valarray/valarray.hpp>
-#include <sprout/algorithm/fixed/transform.hpp>
+#include <sprout/valarray/expression.hpp>
 #include <sprout/math/acosh.hpp>
 #include <sprout/math/asinh.hpp>
 #include <sprout/math/atanh.hpp>
@@ -152,50 +152,50 @@ namespace sprout {
 	//
 	// acosh
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	acosh(sprout::valarray<T, N> const& x) {
-		return sprout::fixed::transform(x.begin(), x.end(), x, sprout::detail::acosh_f());
+	template<typename X>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_unary<sprout::detail::acosh_f, X>::type
+	acosh(X const& x) {
+		return sprout::detail::valarray_unary<sprout::detail::acosh_f, X>::make(x);
 	}
 	//
 	// asinh
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	asinh(sprout::valarray<T, N> const& x) {
-		return sprout::fixed::transform(x.begin(), x.end(), x, sprout::detail::asinh_f());
+	template<typename X>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_unary<sprout::detail::asinh_f, X>::type
+	asinh(X const& x) {
+		return sprout::detail::valarray_unary<sprout::detail::asinh_f, X>::make(x);
 	}
 	//
 	// atanh
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	atanh(sprout::valarray<T, N> const& x) {
-		return sprout::fixed::transform(x.begin(), x.end(), x, sprout::detail::atanh_f());
+	template<typename X>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_unary<sprout::detail::atanh_f, X>::type
+	atanh(X const& x) {
+		return sprout::detail::valarray_unary<sprout::detail::atanh_f, X>::make(x);
 	}
 	//
 	// cosh
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	cosh(sprout::valarray<T, N> const& x) {
-		return sprout::fixed::transform(x.begin(), x.end(), x, sprout::detail::cosh_f());
+	template<typename X>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_unary<sprout::detail::cosh_f, X>::type
+	cosh(X const& x) {
+		return sprout::detail::valarray_unary<sprout::detail::cosh_f, X>::make(x);
 	}
 	//
 	// sinh
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	sinh(sprout::valarray<T, N> const& x) {
-		return sprout::fixed::transform(x.begin(), x.end(), x, sprout::detail::sinh_f());
+	template<typename X>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_unary<sprout::detail::sinh_f, X>::type
+	sinh(X const& x) {
+		return sprout::detail::valarray_unary<sprout::detail::sinh_f, X>::make(x);
 	}
 	//
 	// tanh
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	tanh(sprout::valarray<T, N> const& x) {
-		return sprout::fixed::transform(x.begin(), x.end(), x, sprout::detail::tanh_f());
+	template<typename X>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_unary<sprout::detail::tanh_f, X>::type
+	tanh(X const& x) {
+		return sprout::detail::valarray_unary<sprout::detail::tanh_f, X>::make(x);
 	}
 }	// namespace sprout
 
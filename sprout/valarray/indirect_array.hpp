@@ -8,14 +8,17 @@
 #ifndef SPROUT_VALARRAY_INDIRECT_ARRAY_HPP
 #define SPROUT_VALARRAY_INDIRECT_ARRAY_HPP
 
+#include <type_traits>
 #include <sprout/config.hpp>
 #include <sprout/workaround/std/cstddef.hpp>
 #include <sprout/utility/swap.hpp>
+#include <sprout/memory/addressof.hpp>
 #include <sprout/iterator/index_iterator.hpp>
 #include <sprout/iterator/reverse_iterator.hpp>
 #include <sprout/algorithm/cxx14/copy.hpp>
 #include <sprout/algorithm/cxx14/fill.hpp>
 #include <sprout/valarray/valarray_fwd.hpp>
+#include <sprout/valarray/expression.hpp>
 
 namespace sprout {
 	//
@@ -62,6 +65,12 @@ namespace sprout {
 		operator=(sprout::valarray<T, N2> const& ar) const {
 			sprout::copy(ar.begin(), ar.end(), begin());
 		}
+		// an expression is evaluated first, so it may read the elements assigned
+		template<typename Expression>
+		SPROUT_CXX14_CONSTEXPR typename std::enable_if<sprout::is_valarray_expression<Expression>::value>::type
+		operator=(Expression const& ar) const {
+			*this = sprout::valarray<T, Expression::static_size>(ar);
+		}
 		SPROUT_CXX14_CONSTEXPR void
 		operator=(T const& value) const {
 			sprout::fill(begin(), end(), value);
@@ -74,6 +83,11 @@ namespace sprout {
 				*it2 += *it;
 			}
 		}
+		template<typename Expression>
+		SPROUT_CXX14_CONSTEXPR typename std::enable_if<sprout::is_valarray_expression<Expression>::value>::type
+		operator+=(Expression const& xs) const {
+			*this += sprout::valarray<T, Expression::static_size>(xs);
+		}
 		template<std::size_t N2>
 		SPROUT_CXX14_CONSTEXPR void
 		operator-=(sprout::valarray<T, N2> const& xs) const {
@@ -82,6 +96,11 @@ namespace sprout {
 				*it2 -= *it;
 			}
 		}
+		template<typename Expression>
+		SPROUT_CXX14_CONSTEXPR typename std::enable_if<sprout::is_valarray_expression<Expression>::value>::type
+		operator-=(Expression const& xs) const {
+			*this -= sprout::valarray<T, Expression::static_size>(xs);
+		}
 		template<std::size_t N2>
 		SPROUT_CXX14_CONSTEXPR void
 		operator*=(sprout::valarray<T, N2> const& xs) const {
@@ -90,6 +109,11 @@ namespace sprout {
 				*it2 *= *it;
 			}
 		}
+		template<typename Expression>
+		SPROUT_CXX14_CONSTEXPR typename std::enable_if<sprout::is_valarray_expression<Expression>::value>::type
+		operator*=(Expression const& xs) const {
+			*this *= sprout::valarray<T, Expression::static_size>(xs);
+		}
 		template<std::size_t N2>
 		SPROUT_CXX14_CONSTEXPR void
 		operator/=(sprout::valarray<T, N2> const& xs) const {
@@ -98,6 +122,11 @@ namespace sprout {
 				*it2 /= *it;
 			}
 		}
+		template<typename Expression>
+		SPROUT_CXX14_CONSTEXPR typename std::enable_if<sprout::is_valarray_expression<Expression>::value>::type
+		operator/=(Expression const& xs) const {
+			*this /= sprout::valarray<T, Expression::static_size>(xs);
+		}
 		template<std::size_t N2>
 		SPROUT_CXX14_CONSTEXPR void
 		operator%=(sprout::valarray<T, N2> const& xs) const {
@@ -106,6 +135,11 @@ namespace sprout {
 				*it2 %= *it;
 			}
 		}
+		template<typename Expression>
+		SPROUT_CXX14_CONSTEXPR typename std::enable_if<sprout::is_valarray_expression<Expression>::value>::type
+		operator%=(Expression const& xs) const {
+			*this %= sprout::valarray<T, Expression::static_size>(xs);
+		}
 		template<std::size_t N2>
 		SPROUT_CXX14_CONSTEXPR void
 		operator&=(sprout::valarray<T, N2> const& xs) const {
@@ -114,6 +148,11 @@ namespace sprout {
 				*it2 &= *it;
 			}
 		}
+		template<typename Expression>
+		SPROUT_CXX14_CONSTEXPR typename std::enable_if<sprout::is_valarray_expression<Expression>::value>::type
+		operator&=(Expression const& xs) const {
+			*this &= sprout::valarray<T, Expression::static_size>(xs);
+		}
 		template<std::size_t N2>
 		SPROUT_CXX14_CONSTEXPR void
 		operator|=(sprout::valarray<T, N2> const& xs) const {
@@ -122,6 +161,11 @@ namespace sprout {
 				*it2 |= *it;
 			}
 		}
+		template<typename Expression>
+		SPROUT_CXX14_CONSTEXPR typename std::enable_if<sprout::is_valarray_expression<Expression>::value>::type
+		operator|=(Expression const& xs) const {
+			*this |= sprout::valarray<T, Expression::static_size>(xs);
+		}
 		template<std::size_t N2>
 		SPROUT_CXX14_CONSTEXPR void
 		operator^=(sprout::valarray<T, N2> const& xs) const {
@@ -130,6 +174,11 @@ namespace sprout {
 				*it2 ^= *it;
 			}
 		}
+		template<typename Expression>
+		SPROUT_CXX14_CONSTEXPR typename std::enable_if<sprout::is_valarray_expression<Expression>::value>::type
+		operator^=(Expression const& xs) const {
+			*this ^= sprout::valarray<T, Expression::static_size>(xs);
+		}
 		template<std::size_t N2>
 		SPROUT_CXX14_CONSTEXPR void
 		operator<<=(sprout::valarray<T, N2> const& xs) const {
@@ -138,6 +187,11 @@ namespace sprout {
 				*it2 <<= *it;
 			}
 		}
+		template<typename Expression>
+		SPROUT_CXX14_CONSTEXPR typename std::enable_if<sprout::is_valarray_expression<Expression>::value>::type
+		operator<<=(Expression const& xs) const {
+			*this <<= sprout::valarray<T, Expression::static_size>(xs);
+		}
 		template<std::size_t N2>
 		SPROUT_CXX14_CONSTEXPR void
 		operator>>=(sprout::valarray<T, N2> const& xs) const {
@@ -146,12 +200,21 @@ namespace sprout {
 				*it2 >>= *it;
 			}
 		}
+		template<typename Expression>
+		SPROUT_CXX14_CONSTEXPR typename std::enable_if<sprout::is_valarray_expression<Expression>::value>::type
+		operator>>=(Expression const& xs) const {
+			*this >>= sprout::valarray<T, Expression::static_size>(xs);
+		}
 
 		SPROUT_CXX14_CONSTEXPR void
 		swap(indirect_array& other) SPROUT_NOEXCEPT {
 			sprout::swap(arr_, other.arr_);
 			sprout::swap(indexes_, other.indexes_);
 		}
+		SPROUT_CONSTEXPR bool
+		refers_to(valarray_type const& arr) const SPROUT_NOEXCEPT {
+			return sprout::addressof(*arr_) == sprout::addressof(arr);
+		}
 
 		// iterators:
 		SPROUT_CONSTEXPR iterator
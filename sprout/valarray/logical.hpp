@@ -11,55 +11,47 @@
 #include <sprout/config.hpp>
 #include <sprout/workaround/std/cstddef.hpp>
 #include <sprout/valarray/valarray.hpp>
-#include <sprout/algorithm/fixed/transform.hpp>
+#include <sprout/valarray/expression.hpp>
 #include <sprout/functional/logical_and.hpp>
 #include <sprout/functional/logical_or.hpp>
-#include <sprout/functional/bind2nd.hpp>
-#include <sprout/functional/bind1st.hpp>
-#include <sprout/sized_pit/sized_pit.hpp>
+#include <sprout/functional/logical_not.hpp>
 
 namespace sprout {
 	//
 	// operator&&
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<bool, N>
-	operator&&(sprout::valarray<T, N> const& lhs, sprout::valarray<T, N> const& rhs) {
-		typedef sprout::sized_pit<sprout::valarray<bool, N> > sized_pit_type;
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), rhs.begin(), sized_pit_type(lhs.size()), sprout::logical_and<>());
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<bool, N>
-	operator&&(sprout::valarray<T, N> const& lhs, T const& rhs) {
-		typedef sprout::sized_pit<sprout::valarray<bool, N> > sized_pit_type;
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), sized_pit_type(lhs.size()), sprout::bind2nd(sprout::logical_and<>(), rhs));
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<bool, N>
-	operator&&(T const& lhs, sprout::valarray<T, N> const& rhs) {
-		typedef sprout::sized_pit<sprout::valarray<bool, N> > sized_pit_type;
-		return sprout::fixed::transform(rhs.begin(), rhs.end(), sized_pit_type(rhs.size()), sprout::bind1st(sprout::logical_and<>(), lhs));
+	template<typename L, typename R>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_result<
+		typename sprout::detail::valarray_binary<sprout::logical_and<>, L, R, bool>::type
+	>::type
+	operator&&(L const& lhs, R const& rhs) {
+		return sprout::detail::valarray_evaluate(sprout::detail::valarray_binary<sprout::logical_and<>, L, R, bool>::make(lhs, rhs));
 	}
 	//
 	// operator||
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<bool, N>
-	operator||(sprout::valarray<T, N> const& lhs, sprout::valarray<T, N> const& rhs) {
-		typedef sprout::sized_pit<sprout::valarray<bool, N> > sized_pit_type;
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), rhs.begin(), sized_pit_type(lhs.size()), sprout::logical_or<>());
+	template<typename L, typename R>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_result<
+		typename sprout::detail::valarray_binary<sprout::logical_or<>, L, R, bool>::type
+	>::type
+	operator||(L const& lhs, R const& rhs) {
+		return sprout::detail::valarray_evaluate(sprout::detail::valarray_binary<sprout::logical_or<>, L, R, bool>::make(lhs, rhs));
 	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<bool, N>
-	operator||(sprout::valarray<T, N> const& lhs, T const& rhs) {
-		typedef sprout::sized_pit<sprout::valarray<bool, N> > sized_pit_type;
-		return sprout::fixed::transform(lhs.begin(), lhs.end(), sized_pit_type(lhs.size()), sprout::bind2nd(sprout::logical_or<>(), rhs));
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<bool, N>
-	operator||(T const& lhs, sprout::valarray<T, N> const& rhs) {
-		typedef sprout::sized_pit<sprout::valarray<bool, N> > sized_pit_type;
-		return sprout::fixed::transform(rhs.begin(), rhs.end(), sized_pit_type(rhs.size()), sprout::bind1st(sprout::logical_or<>(), lhs));
+
+	//
+	// operator!
+	//
+	//	Of expressions; that of valarray is a member.
+	//
+	template<typename X>
+	inline SPROUT_CONSTEXPR typename std::enable_if<
+		sprout::is_valarray_expression<X>::value,
+		typename sprout::detail::valarray_result<
+			typename sprout::detail::valarray_unary<sprout::logical_not<>, X, bool>::type
+		>::type
+	>::type
+	operator!(X const& x) {
+		return sprout::detail::valarray_evaluate(sprout::detail::valarray_unary<sprout::logical_not<>, X, bool>::make(x));
 	}
 }	// namespace sprout
 
@@ -12,7 +12,7 @@
 #include <sprout/config.hpp>
 #include <sprout/workaround/std/cstddef.hpp>
 #include <sprout/valarray/valarray.hpp>
-#include <sprout/algorithm/fixed/transform.hpp>
+#include <sprout/valarray/expression.hpp>
 #include <sprout/math/cbrt.hpp>
 #include <sprout/math/abs.hpp>
 #include <sprout/math/hypot.hpp>
@@ -154,80 +154,50 @@ namespace sprout {
 	//
 	// cbrt
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	cbrt(sprout::valarray<T, N> const& x) {
-		return sprout::fixed::transform(x.begin(), x.end(), x, sprout::detail::cbrt_f());
+	template<typename X>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_unary<sprout::detail::cbrt_f, X>::type
+	cbrt(X const& x) {
+		return sprout::detail::valarray_unary<sprout::detail::cbrt_f, X>::make(x);
 	}
 	//
 	// abs
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	abs(sprout::valarray<T, N> const& x) {
-		return sprout::fixed::transform(x.begin(), x.end(), x, sprout::detail::abs_f());
+	template<typename X>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_unary<sprout::detail::abs_f, X>::type
+	abs(X const& x) {
+		return sprout::detail::valarray_unary<sprout::detail::abs_f, X>::make(x);
 	}
 	//
 	// hypot
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	hypot(sprout::valarray<T, N> const& x, sprout::valarray<T, N> const& y) {
-		return sprout::fixed::transform(x.begin(), x.end(), y.end(), x, sprout::detail::hypot_f());
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	hypot(sprout::valarray<T, N> const& x, T const& y) {
-		return sprout::fixed::transform(x.begin(), x.end(), x, sprout::bind2nd(sprout::detail::hypot_f(), y));
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	hypot(T const& x, sprout::valarray<T, N> const& y) {
-		return sprout::fixed::transform(y.begin(), y.end(), y, sprout::bind1st(sprout::detail::hypot_f(), x));
+	template<typename L, typename R>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_binary<sprout::detail::hypot_f, L, R>::type
+	hypot(L const& x, R const& y) {
+		return sprout::detail::valarray_binary<sprout::detail::hypot_f, L, R>::make(x, y);
 	}
 	//
 	// pow
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	pow(sprout::valarray<T, N> const& x, sprout::valarray<T, N> const& y) {
-		return sprout::fixed::transform(x.begin(), x.end(), y.end(), x, sprout::detail::pow_f());
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	pow(sprout::valarray<T, N> const& x, T const& y) {
-		return sprout::fixed::transform(x.begin(), x.end(), x, sprout::bind2nd(sprout::detail::pow_f(), y));
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	pow(T const& x, sprout::valarray<T, N> const& y) {
-		return sprout::fixed::transform(y.begin(), y.end(), y, sprout::bind1st(sprout::detail::pow_f(), x));
+	template<typename L, typename R>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_binary<sprout::detail::pow_f, L, R>::type
+	pow(L const& x, R const& y) {
+		return sprout::detail::valarray_binary<sprout::detail::pow_f, L, R>::make(x, y);
 	}
 	//
 	// sqrt
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	sqrt(sprout::valarray<T, N> const& x) {
-		return sprout::fixed::transform(x.begin(), x.end(), x, sprout::detail::sqrt_f());
+	template<typename X>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_unary<sprout::detail::sqrt_f, X>::type
+	sqrt(X const& x) {
+		return sprout::detail::valarray_unary<sprout::detail::sqrt_f, X>::make(x);
 	}
 	//
 	// log_a
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	log_a(sprout::valarray<T, N> const& x, sprout::valarray<T, N> const& y) {
-		return sprout::fixed::transform(x.begin(), x.end(), y.end(), x, sprout::detail::log_a_f());
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	log_a(sprout::valarray<T, N> const& x, T const& y) {
-		return sprout::fixed::transform(x.begin(), x.end(), x, sprout::bind2nd(sprout::detail::log_a_f(), y));
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	log_a(T const& x, sprout::valarray<T, N> const& y) {
-		return sprout::fixed::transform(y.begin(), y.end(), y, sprout::bind1st(sprout::detail::log_a_f(), x));
+	template<typename L, typename R>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_binary<sprout::detail::log_a_f, L, R>::type
+	log_a(L const& x, R const& y) {
+		return sprout::detail::valarray_binary<sprout::detail::log_a_f, L, R>::make(x, y);
 	}
 }	// namespace sprout
 
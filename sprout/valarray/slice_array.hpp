@@ -8,14 +8,17 @@
 #ifndef SPROUT_VALARRAY_SLICE_ARRAY_HPP
 #define SPROUT_VALARRAY_SLICE_ARRAY_HPP
 
+#include <type_traits>
 #include <sprout/config.hpp>
 #include <sprout/workaround/std/cstddef.hpp>
 #include <sprout/utility/swap.hpp>
+#include <sprout/memory/addressof.hpp>
 #include <sprout/iterator/index_iterator.hpp>
 #include <sprout/iterator/reverse_iterator.hpp>
 #include <sprout/algorithm/cxx14/copy.hpp>
 #include <sprout/algorithm/cxx14/fill.hpp>
 #include <sprout/valarray/valarray_fwd.hpp>
+#include <sprout/valarray/expression.hpp>
 
 namespace sprout {
 	//
@@ -85,6 +88,12 @@ namespace sprout {
 		operator=(sprout::valarray<T, N2> const& ar) const {
 			sprout::copy(ar.begin(), ar.end(), begin());
 		}
+		// an expression is evaluated first, so it may read the elements assigned
+		template<typename Expression>
+		SPROUT_CXX14_CONSTEXPR typename std::enable_if<sprout::is_valarray_expression<Expression>::value>::type
+		operator=(Expression const& ar) const {
+			*this = sprout::valarray<T, Expression::static_size>(ar);
+		}
 		SPROUT_CXX14_CONSTEXPR void
 		operator=(T const& value) const {
 			sprout::fill(begin(), end(), value);
@@ -97,6 +106,11 @@ namespace sprout {
 				*it2 += *it;
 			}
 		}
+		template<typename Expression>
+		SPROUT_CXX14_CONSTEXPR typename std::enable_if<sprout::is_valarray_expression<Expression>::value>::type
+		operator+=(Expression const& xs) const {
+			*this += sprout::valarray<T, Expression::static_size>(xs);
+		}
 		template<std::size_t N2>
 		SPROUT_CXX14_CONSTEXPR void
 		operator-=(sprout::valarray<T, N2> const& xs) const {
@@ -105,6 +119,11 @@ namespace sprout {
 				*it2 -= *it;
 			}
 		}
+		template<typename Expression>
+		SPROUT_CXX14_CONSTEXPR typename std::enable_if<sprout::is_valarray_expression<Expression>::value>::type
+		operator-=(Expression const& xs) const {
+			*this -= sprout::valarray<T, Expression::static_size>(xs);
+		}
 		template<std::size_t N2>
 		SPROUT_CXX14_CONSTEXPR void
 		operator*=(sprout::valarray<T, N2> const& xs) const {
@@ -113,6 +132,11 @@ namespace sprout {
 				*it2 *= *it;
 			}
 		}
+		template<typename Expression>
+		SPROUT_CXX14_CONSTEXPR typename std::enable_if<sprout::is_valarray_expression<Expression>::value>::type
+		operator*=(Expression const& xs) const {
+			*this *= sprout::valarray<T, Expression::static_size>(xs);
+		}
 		template<std::size_t N2>
 		SPROUT_CXX14_CONSTEXPR void
 		operator/=(sprout::valarray<T, N2> const& xs) const {
@@ -121,6 +145,11 @@ namespace sprout {
 				*it2 /= *it;
 			}
 		}
+		template<typename Expression>
+		SPROUT_CXX14_CONSTEXPR typename std::enable_if<sprout::is_valarray_expression<Expression>::value>::type
+		operator/=(Expression const& xs) const {
+			*this /= sprout::valarray<T, Expression::static_size>(xs);
+		}
 		template<std::size_t N2>
 		SPROUT_CXX14_CONSTEXPR void
 		operator%=(sprout::valarray<T, N2> const& xs) const {
@@ -129,6 +158,11 @@ namespace sprout {
 				*it2 %= *it;
 			}
 		}
+		template<typename Expression>
+		SPROUT_CXX14_CONSTEXPR typename std::enable_if<sprout::is_valarray_expression<Expression>::value>::type
+		operator%=(Expression const& xs) const {
+			*this %= sprout::valarray<T, Expression::static_size>(xs);
+		}
 		template<std::size_t N2>
 		SPROUT_CXX14_CONSTEXPR void
 		operator&=(sprout::valarray<T, N2> const& xs) const {
@@ -137,6 +171,11 @@ namespace sprout {
 				*it2 &= *it;
 			}
 		}
+		template<typename Expression>
+		SPROUT_CXX14_CONSTEXPR typename std::enable_if<sprout::is_valarray_expression<Expression>::value>::type
+		operator&=(Expression const& xs) const {
+			*this &= sprout::valarray<T, Expression::static_size>(xs);
+		}
 		template<std::size_t N2>
 		SPROUT_CXX14_CONSTEXPR void
 		operator|=(sprout::valarray<T, N2> const& xs) const {
@@ -145,6 +184,11 @@ namespace sprout {
 				*it2 |= *it;
 			}
 		}
+		template<typename Expression>
+		SPROUT_CXX14_CONSTEXPR typename std::enable_if<sprout::is_valarray_expression<Expression>::value>::type
+		operator|=(Expression const& xs) const {
+			*this |= sprout::valarray<T, Expression::static_size>(xs);
+		}
 		template<std::size_t N2>
 		SPROUT_CXX14_CONSTEXPR void
 		operator^=(sprout::valarray<T, N2> const& xs) const {
@@ -153,6 +197,11 @@ namespace sprout {
 				*it2 ^= *it;
 			}
 		}
+		template<typename Expression>
+		SPROUT_CXX14_CONSTEXPR typename std::enable_if<sprout::is_valarray_expression<Expression>::value>::type
+		operator^=(Expression const& xs) const {
+			*this ^= sprout::valarray<T, Expression::static_size>(xs);
+		}
 		template<std::size_t N2>
 		SPROUT_CXX14_CONSTEXPR void
 		operator<<=(sprout::valarray<T, N2> const& xs) const {
@@ -161,6 +210,11 @@ namespace sprout {
 				*it2 <<= *it;
 			}
 		}
+		template<typename Expression>
+		SPROUT_CXX14_CONSTEXPR typename std::enable_if<sprout::is_valarray_expression<Expression>::value>::type
+		operator<<=(Expression const& xs) const {
+			*this <<= sprout::valarray<T, Expression::static_size>(xs);
+		}
 		template<std::size_t N2>
 		SPROUT_CXX14_CONSTEXPR void
 		operator>>=(sprout::valarray<T, N2> const& xs) const {
@@ -169,12 +223,21 @@ namespace sprout {
 				*it2 >>= *it;
 			}
 		}
+		template<typename Expression>
+		SPROUT_CXX14_CONSTEXPR typename std::enable_if<sprout::is_valarray_expression<Expression>::value>::type
+		operator>>=(Expression const& xs) const {
+			*this >>= sprout::valarray<T, Expression::static_size>(xs);
+		}
 
 		SPROUT_CXX14_CONSTEXPR void
 		swap(slice_array& other) SPROUT_NOEXCEPT {
 			sprout::swap(arr_, other.arr_);
 			sprout::swap(slice_, other.slice_);
 		}
+		SPROUT_CONSTEXPR bool
+		refers_to(valarray_type const& arr) const SPROUT_NOEXCEPT {
+			return sprout::addressof(*arr_) == sprout::addressof(arr);
+		}
 
 		// iterators:
 		SPROUT_CONSTEXPR iterator
@@ -5,13 +5,13 @@
   Distributed under the Boost Software License, Version 1.0. (See accompanying
   file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 =============================================================================*/
-#ifndef SPROUT_VALARRAY_BITWISE_HPP
-#define SPROUT_VALARRAY_BITWISE_HPP
+#ifndef SPROUT_VALARRAY_TRIGONOMETRIC_HPP
+#define SPROUT_VALARRAY_TRIGONOMETRIC_HPP
 
 #include <utility>
 #include <sprout/workaround/std/cstddef.hpp>
 #include <sprout/valarray/valarray.hpp>
-#include <sprout/algorithm/fixed/transform.hpp>
+#include <sprout/valarray/expression.hpp>
 #include <sprout/math/acos.hpp>
 #include <sprout/math/asin.hpp>
 #include <sprout/math/atan.hpp>
@@ -56,7 +56,7 @@ namespace sprout_math_detail {
 	call_atan2(T&& x, U&& y)
 	SPROUT_NOEXCEPT_IF_EXPR(atan2(std::declval<T>(), std::declval<U>()))
 	{
-		return atan2(SPROUT_FORWARD(T, x), SPROUT_FORWARD(U, u));
+		return atan2(SPROUT_FORWARD(T, x), SPROUT_FORWARD(U, y));
 	}
 	template<typename T>
 	inline SPROUT_CONSTEXPR decltype(cos(std::declval<T>()))
@@ -172,69 +172,59 @@ namespace sprout {
 	//
 	// acos
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	acos(sprout::valarray<T, N> const& x) {
-		return sprout::fixed::transform(x.begin(), x.end(), x, sprout::detail::acos_f());
+	template<typename X>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_unary<sprout::detail::acos_f, X>::type
+	acos(X const& x) {
+		return sprout::detail::valarray_unary<sprout::detail::acos_f, X>::make(x);
 	}
 	//
 	// asin
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	asin(sprout::valarray<T, N> const& x) {
-		return sprout::fixed::transform(x.begin(), x.end(), x, sprout::detail::asin_f());
+	template<typename X>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_unary<sprout::detail::asin_f, X>::type
+	asin(X const& x) {
+		return sprout::detail::valarray_unary<sprout::detail::asin_f, X>::make(x);
 	}
 	//
 	// atan
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	atan(sprout::valarray<T, N> const& x) {
-		return sprout::fixed::transform(x.begin(), x.end(), x, sprout::detail::atan_f());
+	template<typename X>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_unary<sprout::detail::atan_f, X>::type
+	atan(X const& x) {
+		return sprout::detail::valarray_unary<sprout::detail::atan_f, X>::make(x);
 	}
 	//
 	// atan2
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	atan2(sprout::valarray<T, N> const& x, sprout::valarray<T, N> const& y) {
-		return sprout::fixed::transform(x.begin(), x.end(), y.end(), x, sprout::detail::atan2_f());
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	atan2(sprout::valarray<T, N> const& lhs, T const& y) {
-		return sprout::fixed::transform(x.begin(), x.end(), x, sprout::bind2nd(sprout::detail::atan2_f()()), y));
-	}
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	atan2(T const& x, sprout::valarray<T, N> const& y) {
-		return sprout::fixed::transform(y.begin(), y.end(), y, sprout::bind1st(sprout::detail::atan2_f()()), x));
+	template<typename L, typename R>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_binary<sprout::detail::atan2_f, L, R>::type
+	atan2(L const& x, R const& y) {
+		return sprout::detail::valarray_binary<sprout::detail::atan2_f, L, R>::make(x, y);
 	}
 	//
 	// cos
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	cos(sprout::valarray<T, N> const& x) {
-		return sprout::fixed::transform(x.begin(), x.end(), x, sprout::detail::cos_f());
+	template<typename X>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_unary<sprout::detail::cos_f, X>::type
+	cos(X const& x) {
+		return sprout::detail::valarray_unary<sprout::detail::cos_f, X>::make(x);
 	}
 	//
 	// sin
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	sin(sprout::valarray<T, N> const& x) {
-		return sprout::fixed::transform(x.begin(), x.end(), x, sprout::detail::sin_f());
+	template<typename X>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_unary<sprout::detail::sin_f, X>::type
+	sin(X const& x) {
+		return sprout::detail::valarray_unary<sprout::detail::sin_f, X>::make(x);
 	}
 	//
 	// tan
 	//
-	template<typename T, std::size_t N>
-	inline SPROUT_CONSTEXPR sprout::valarray<T, N>
-	tan(sprout::valarray<T, N> const& x) {
-		return sprout::fixed::transform(x.begin(), x.end(), x, sprout::detail::tan_f());
+	template<typename X>
+	inline SPROUT_CONSTEXPR typename sprout::detail::valarray_unary<sprout::detail::tan_f, X>::type
+	tan(X const& x) {
+		return sprout::detail::valarray_unary<sprout::detail::tan_f, X>::make(x);
 	}
 }	// namespace sprout
 
-#endif	// #ifndef SPROUT_VALARRAY_BITWISE_HPP
+#endif	// #ifndef SPROUT_VALARRAY_TRIGONOMETRIC_HPP
@@ -53,6 +53,7 @@
 #include <sprout/valarray/gslice_array.hpp>
 #include <sprout/valarray/mask_array.hpp>
 #include <sprout/valarray/indirect_array.hpp>
+#include <sprout/valarray/expression.hpp>
 #include <sprout/sized_pit/sized_pit.hpp>
 
 namespace sprout {
@@ -224,17 +225,27 @@ namespace sprout {
 				x.begin(), x.size()
 				)
 		{}
+		template<
+			typename Expression,
+			typename Enable = typename std::enable_if<sprout::is_valarray_expression<Expression>::value>::type
+		>
+		SPROUT_CONSTEXPR valarray(Expression const& x)
+			: impl_(
+				sprout::make_index_tuple<N>::make(),
+				x, x.size()
+				)
+		{}
 		// assignment:
 		SPROUT_CXX14_CONSTEXPR valarray&
 		operator=(valarray const& rhs) {
-			impl_.array_ = rhs.array_;
-			impl_.size_ = rhs.size_;
+			impl_.array_ = rhs.impl_.array_;
+			impl_.size_ = rhs.impl_.size_;
 			return *this;
 		}
 		SPROUT_CXX14_CONSTEXPR valarray&
 		operator=(valarray&& rhs) SPROUT_NOEXCEPT {
-			impl_.array_ = sprout::move(rhs.array_);
-			impl_.size_ = sprout::move(rhs.size_);
+			impl_.array_ = sprout::move(rhs.impl_.array_);
+			impl_.size_ = sprout::move(rhs.impl_.size_);
 			return *this;
 		}
 		SPROUT_CXX14_CONSTEXPR valarray&
@@ -280,6 +291,23 @@ namespace sprout {
 			impl_.size_ = rhs.size();
 			return *this;
 		}
+		// one pass over the elements, or into a temporary if a subset array in rhs refers to *this
+		template<typename Expression>
+		SPROUT_CXX14_CONSTEXPR typename std::enable_if<
+			sprout::is_valarray_expression<Expression>::value,
+			valarray&
+		>::type
+		operator=(Expression const& rhs) {
+			if (sprout::detail::valarray_aliases(rhs, *this)) {
+				return *this = valarray(rhs);
+			}
+			lengthcheck(rhs.size());
+			for (size_type i = 0, n = rhs.size(); i != n; ++i) {
+				impl_.array_[i] = rhs[i];
+			}
+			impl_.size_ = rhs.size();
+			return *this;
+		}
 		// element access:
 		SPROUT_CONSTEXPR value_type const&
 		operator[](std::size_t i) const {
@@ -14,6 +14,7 @@
 #include <sprout/weed/attr_cnv.hpp>
 #include <sprout/weed/context.hpp>
 #include <sprout/weed/parse.hpp>
+#include <sprout/weed/packrat_parse.hpp>
 #include <sprout/weed/unused.hpp>
 #include <sprout/weed/limited.hpp>
 #include <sprout/weed/eval_result.hpp>
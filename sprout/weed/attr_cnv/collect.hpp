@@ -0,0 +1,53 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_WEED_ATTR_CNV_COLLECT_HPP
+#define SPROUT_WEED_ATTR_CNV_COLLECT_HPP
+
+#include <type_traits>
+#include <sprout/config.hpp>
+#include <sprout/container/functions.hpp>
+#include <sprout/weed/unused.hpp>
+#include <sprout/weed/traits/type/is_container.hpp>
+#include <sprout/weed/traits/type/is_unused.hpp>
+
+namespace sprout {
+	namespace weed {
+		namespace attr_cnv {
+			//
+			// collect
+			//
+			//	Appends one element attribute to a growable container in place.
+			//
+			// collect(container<V>, container<V, K>)
+			template<typename Container, typename T>
+			inline typename std::enable_if<
+				sprout::weed::traits::is_container<T>::value
+			>::type
+			collect(Container& cont, T const& t) {
+				cont.insert(cont.end(), sprout::begin(t), sprout::end(t));
+			}
+			// collect(container<V>, V)
+			template<typename Container, typename T>
+			inline typename std::enable_if<
+				!sprout::weed::traits::is_container<T>::value
+				&& !sprout::weed::traits::is_unused<T>::value
+			>::type
+			collect(Container& cont, T const& t) {
+				cont.push_back(t);
+			}
+			// collect(unused, unused)
+			template<typename Container, typename T>
+			inline typename std::enable_if<
+				sprout::weed::traits::is_unused<T>::value
+			>::type
+			collect(Container&, T const&) {}
+		}	// namespace attr_cnv
+	}	// namespace weed
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_WEED_ATTR_CNV_COLLECT_HPP
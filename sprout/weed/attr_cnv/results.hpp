@@ -15,5 +15,6 @@
 #include <sprout/weed/attr_cnv/results/modulus.hpp>
 #include <sprout/weed/attr_cnv/results/bitwise_or.hpp>
 #include <sprout/weed/attr_cnv/results/mem_ptr.hpp>
+#include <sprout/weed/attr_cnv/results/collect.hpp>
 
 #endif	// #ifndef SPROUT_WEED_ATTR_CNV_RESULTS_HPP
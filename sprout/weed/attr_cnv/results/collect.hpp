@@ -0,0 +1,71 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_WEED_ATTR_CNV_RESULTS_COLLECT_HPP
+#define SPROUT_WEED_ATTR_CNV_RESULTS_COLLECT_HPP
+
+#include <string>
+#include <vector>
+#include <type_traits>
+#include <sprout/config.hpp>
+#include <sprout/container/traits.hpp>
+#include <sprout/type_traits/identity.hpp>
+#include <sprout/weed/unused.hpp>
+#include <sprout/weed/traits/type/is_char_type.hpp>
+#include <sprout/weed/traits/type/is_container.hpp>
+#include <sprout/weed/traits/type/is_unused.hpp>
+
+namespace sprout {
+	namespace weed {
+		namespace attr_cnv {
+			namespace results {
+				//
+				// collect
+				//
+				template<typename T, typename = void>
+				struct collect;
+				// collect(container<V, K>) -> growable<V>
+				template<typename T>
+				struct collect<
+					T,
+					typename std::enable_if<
+						sprout::weed::traits::is_container<T>::value
+					>::type
+				>
+					: public sprout::weed::attr_cnv::results::collect<typename sprout::container_traits<T>::value_type>
+				{};
+				// collect(V) -> growable<V>
+				template<typename T>
+				struct collect<
+					T,
+					typename std::enable_if<
+						!sprout::weed::traits::is_container<T>::value
+						&& !sprout::weed::traits::is_unused<T>::value
+					>::type
+				>
+					: public std::conditional<
+						sprout::weed::traits::is_char_type<T>::value,
+						std::basic_string<T>,
+						std::vector<T>
+					>
+				{};
+				// collect(unused) -> unused
+				template<typename T>
+				struct collect<
+					T,
+					typename std::enable_if<
+						sprout::weed::traits::is_unused<T>::value
+					>::type
+				>
+					: public sprout::identity<sprout::weed::unused>
+				{};
+			}	// namespace results
+		}	// namespace attr_cnv
+	}	// namespace weed
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_WEED_ATTR_CNV_RESULTS_COLLECT_HPP
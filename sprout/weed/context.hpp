@@ -10,5 +10,6 @@
 
 #include <sprout/config.hpp>
 #include <sprout/weed/context/parse_context.hpp>
+#include <sprout/weed/context/memo_table.hpp>
 
 #endif	// #ifndef SPROUT_WEED_CONTEXT_HPP
@@ -0,0 +1,209 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_WEED_CONTEXT_MEMO_TABLE_HPP
+#define SPROUT_WEED_CONTEXT_MEMO_TABLE_HPP
+
+#include <new>
+#include <vector>
+#include <iterator>
+#include <type_traits>
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/utility/noncopyable.hpp>
+#include <sprout/iterator/type_traits/is_iterator_of.hpp>
+#include <sprout/weed/context/parse_context_fwd.hpp>
+
+namespace sprout {
+	namespace weed {
+		namespace detail {
+			template<typename T>
+			struct memo_tag {
+			public:
+				static char const value;
+			};
+			template<typename T>
+			char const sprout::weed::detail::memo_tag<T>::value = 0;
+		}	// namespace detail
+
+		//
+		// memo_table
+		//
+		//	Per-parse packrat memo, keyed by (rule type, rule id, input offset).
+		//	Results are placement-constructed in a bump arena that is released as a
+		//	whole; reset() keeps the first block for the next parse.
+		//	Iterator must be random access, so that the offset lookup is constant time.
+		//
+		template<typename Iterator>
+		class memo_table
+			: private sprout::noncopyable
+		{
+			static_assert(sprout::is_random_access_iterator<Iterator>::value, "memo_table: Iterator must be a random access iterator");
+		public:
+			typedef Iterator iterator;
+			typedef std::size_t size_type;
+			typedef typename std::iterator_traits<Iterator>::difference_type difference_type;
+		private:
+			struct entry {
+			public:
+				void const* tag;
+				size_type id;
+				difference_type offset;
+				void const* value;
+				entry* next;
+			};
+			struct cleanup {
+			public:
+				void (*destroy)(void*);
+				void* value;
+				cleanup* next;
+			};
+			template<typename T>
+			static void destroy(void* p) {
+				static_cast<T*>(p)->~T();
+			}
+		private:
+			Iterator origin_;
+			std::vector<unsigned char*> blocks_;
+			std::vector<unsigned char*> large_;
+			size_type block_size_;
+			size_type used_;
+			std::vector<entry*> buckets_;
+			size_type size_;
+			cleanup* cleanups_;
+		private:
+			static size_type hash(void const* tag, size_type id, difference_type offset) {
+				size_type h = reinterpret_cast<size_type>(tag) >> 3;
+				h ^= id + 0x9e3779b9 + (h << 6) + (h >> 2);
+				h ^= static_cast<size_type>(offset) + 0x9e3779b9 + (h << 6) + (h >> 2);
+				return h;
+			}
+			void* allocate(size_type size, size_type align) {
+				if (size > block_size_) {
+					large_.push_back(new unsigned char[size]);
+					return large_.back();
+				}
+				used_ = (used_ + align - 1) & ~(align - 1);
+				if (blocks_.empty() || used_ + size > block_size_) {
+					blocks_.push_back(new unsigned char[block_size_]);
+					used_ = 0;
+				}
+				void* p = blocks_.back() + used_;
+				used_ += size;
+				return p;
+			}
+			template<typename T>
+			T* construct(T const& value) {
+				T* p = ::new(allocate(sizeof(T), std::alignment_of<T>::value)) T(value);
+				if (!std::is_trivially_destructible<T>::value) {
+					cleanup* c = ::new(allocate(sizeof(cleanup), std::alignment_of<cleanup>::value)) cleanup();
+					c->destroy = &memo_table::template destroy<T>;
+					c->value = p;
+					c->next = cleanups_;
+					cleanups_ = c;
+				}
+				return p;
+			}
+			void rehash() {
+				std::vector<entry*> buckets(buckets_.empty() ? 64 : buckets_.size() * 2);
+				for (size_type i = 0; i != buckets_.size(); ++i) {
+					for (entry* e = buckets_[i]; e; ) {
+						entry* next = e->next;
+						size_type const b = hash(e->tag, e->id, e->offset) & (buckets.size() - 1);
+						e->next = buckets[b];
+						buckets[b] = e;
+						e = next;
+					}
+				}
+				buckets_.swap(buckets);
+			}
+			void release() {
+				for (cleanup* c = cleanups_; c; c = c->next) {
+					c->destroy(c->value);
+				}
+				cleanups_ = 0;
+			}
+		public:
+			explicit memo_table(Iterator origin, size_type block_size = 16384)
+				: origin_(origin), blocks_(), large_(), block_size_(block_size), used_(0), buckets_(), size_(0), cleanups_(0)
+			{}
+			~memo_table() {
+				release();
+				for (size_type i = 0; i != blocks_.size(); ++i) {
+					delete[] blocks_[i];
+				}
+				for (size_type i = 0; i != large_.size(); ++i) {
+					delete[] large_[i];
+				}
+			}
+			Iterator origin() const {
+				return origin_;
+			}
+			size_type size() const {
+				return size_;
+			}
+			bool empty() const {
+				return size_ == 0;
+			}
+			//
+			// arena_size
+			//	Bytes reserved in arena blocks (oversized results are not counted).
+			//
+			size_type arena_size() const {
+				return blocks_.size() * block_size_;
+			}
+			void reset(Iterator origin) {
+				release();
+				for (size_type i = 1; i < blocks_.size(); ++i) {
+					delete[] blocks_[i];
+				}
+				blocks_.resize(blocks_.empty() ? 0 : 1);
+				for (size_type i = 0; i != large_.size(); ++i) {
+					delete[] large_[i];
+				}
+				large_.clear();
+				used_ = 0;
+				buckets_.clear();
+				size_ = 0;
+				origin_ = origin;
+			}
+			template<typename Tag, typename T>
+			T const* find(size_type id, Iterator position) const {
+				if (buckets_.empty()) {
+					return 0;
+				}
+				void const* tag = &sprout::weed::detail::memo_tag<Tag>::value;
+				difference_type const offset = std::distance(origin_, position);
+				for (entry* e = buckets_[hash(tag, id, offset) & (buckets_.size() - 1)]; e; e = e->next) {
+					if (e->tag == tag && e->id == id && e->offset == offset) {
+						return static_cast<T const*>(e->value);
+					}
+				}
+				return 0;
+			}
+			template<typename Tag, typename T>
+			T const& insert(size_type id, Iterator position, T const& value) {
+				if (size_ >= buckets_.size()) {
+					rehash();
+				}
+				T const* p = construct(value);
+				entry* e = construct(entry());
+				e->tag = &sprout::weed::detail::memo_tag<Tag>::value;
+				e->id = id;
+				e->offset = std::distance(origin_, position);
+				e->value = p;
+				size_type const b = hash(e->tag, id, e->offset) & (buckets_.size() - 1);
+				e->next = buckets_[b];
+				buckets_[b] = e;
+				++size_;
+				return *p;
+			}
+		};
+	}	// namespace weed
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_WEED_CONTEXT_MEMO_TABLE_HPP
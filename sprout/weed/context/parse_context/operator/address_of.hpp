@@ -17,6 +17,7 @@
 #include <sprout/weed/expr/eval.hpp>
 #include <sprout/weed/traits/expr/tag_of.hpp>
 #include <sprout/weed/traits/parser/attribute_of.hpp>
+#include <sprout/weed/detail/collect_into_checkpoint.hpp>
 #include <sprout/weed/context/parse_context_fwd.hpp>
 
 namespace sprout {
@@ -37,20 +38,30 @@ namespace sprout {
 		> {
 		private:
 			typedef sprout::weed::parse_context<Iterator> context_type;
+			typedef sprout::weed::detail::collect_into_checkpoint<Expr> checkpoint_type;
 		public:
 			typedef sprout::weed::unused attribute_type;
 			typedef sprout::weed::eval_result<context_type, Iterator, attribute_type> result_type;
-		public:
-			SPROUT_CONSTEXPR result_type operator()(
+		private:
+			SPROUT_CONSTEXPR result_type call(
 				Expr const& expr,
-				context_type const& ctx
+				context_type const& ctx,
+				checkpoint_type const& cp
 				) const
 			{
 				return sprout::weed::eval(sprout::tuples::get<0>(expr.args()), ctx).success()
-					? result_type(true, ctx.begin(), attribute_type(), ctx)
+					? cp.restore(result_type(true, ctx.begin(), attribute_type(), ctx))
 					: result_type(false, ctx.begin(), attribute_type(), ctx)
 					;
 			}
+		public:
+			SPROUT_CONSTEXPR result_type operator()(
+				Expr const& expr,
+				context_type const& ctx
+				) const
+			{
+				return call(expr, ctx, checkpoint_type(expr));
+			}
 		};
 	}	// namespace weed
 }	// namespace sprout
@@ -18,6 +18,7 @@
 #include <sprout/weed/attr_cnv/bitwise_or.hpp>
 #include <sprout/weed/traits/expr/tag_of.hpp>
 #include <sprout/weed/traits/parser/attribute_of.hpp>
+#include <sprout/weed/detail/collect_into_checkpoint.hpp>
 #include <sprout/weed/context/parse_context_fwd.hpp>
 
 namespace sprout {
@@ -42,6 +43,7 @@ namespace sprout {
 			typedef typename sprout::tuples::tuple_element<1, typename Expr::args_type>::type expr2_type;
 			typedef typename sprout::weed::traits::attribute_of<expr1_type, Iterator, context_type>::type attr1_type;
 			typedef typename sprout::weed::traits::attribute_of<expr2_type, Iterator, context_type>::type attr2_type;
+			typedef sprout::weed::detail::collect_into_checkpoint<Expr> checkpoint_type;
 		public:
 			typedef typename sprout::weed::attr_cnv::results::bitwise_or<
 				typename sprout::weed::traits::attribute_of<expr1_type, Iterator, context_type>::type,
@@ -66,10 +68,18 @@ namespace sprout {
 					: result_type(false, ctx.begin(), attribute_type(), ctx)
 					;
 			}
+			SPROUT_CONSTEXPR result_type call_2(
+				typename Expr::args_type const& args,
+				context_type const& ctx
+				) const
+			{
+				return call_2(args, ctx, sprout::weed::eval(sprout::tuples::get<1>(args), ctx));
+			}
 			template<typename Result1>
 			SPROUT_CONSTEXPR result_type call_1(
 				typename Expr::args_type const& args,
 				context_type const& ctx,
+				checkpoint_type const& cp,
 				Result1 const& res
 				) const
 			{
@@ -80,15 +90,16 @@ namespace sprout {
 						sprout::weed::attr_cnv::bitwise_or<attr1_type, attr2_type>(res.attr()),
 						context_type(ctx, res.current())
 						)
-					: call_2(args, ctx, sprout::weed::eval(sprout::tuples::get<1>(args), ctx))
+					: call_2(args, cp.restore(ctx))
 					;
 			}
 			SPROUT_CONSTEXPR result_type call(
 				typename Expr::args_type const& args,
-				context_type const& ctx
+				context_type const& ctx,
+				checkpoint_type const& cp
 				) const
 			{
-				return call_1(args, ctx, sprout::weed::eval(sprout::tuples::get<0>(args), ctx));
+				return call_1(args, ctx, cp, sprout::weed::eval(sprout::tuples::get<0>(args), ctx));
 			}
 		public:
 			SPROUT_CONSTEXPR result_type operator()(
@@ -96,7 +107,7 @@ namespace sprout {
 				context_type const& ctx
 				) const
 			{
-				return call(expr.args(), ctx);
+				return call(expr.args(), ctx, checkpoint_type(expr));
 			}
 		};
 	}	// namespace weed
@@ -16,6 +16,7 @@
 #include <sprout/weed/expr/eval.hpp>
 #include <sprout/weed/traits/expr/tag_of.hpp>
 #include <sprout/weed/traits/parser/attribute_of.hpp>
+#include <sprout/weed/detail/collect_into_checkpoint.hpp>
 #include <sprout/weed/context/parse_context_fwd.hpp>
 
 namespace sprout {
@@ -38,6 +39,7 @@ namespace sprout {
 			typedef sprout::weed::parse_context<Iterator> context_type;
 			typedef typename sprout::tuples::tuple_element<0, typename Expr::args_type>::type expr1_type;
 			typedef typename sprout::tuples::tuple_element<1, typename Expr::args_type>::type expr2_type;
+			typedef sprout::weed::detail::collect_into_checkpoint<Expr> checkpoint_type;
 		public:
 			typedef typename sprout::weed::traits::attribute_of<expr1_type, Iterator, context_type>::type attribute_type;
 			typedef sprout::weed::eval_result<context_type, Iterator, attribute_type> result_type;
@@ -46,20 +48,22 @@ namespace sprout {
 			SPROUT_CONSTEXPR result_type call_1(
 				typename Expr::args_type const& args,
 				context_type const& ctx,
+				checkpoint_type const& cp,
 				Result1 const& res
 				) const
 			{
 				return res.success() && !sprout::weed::eval(sprout::tuples::get<1>(args), ctx).success()
 					? res
-					: result_type(false, ctx.begin(), attribute_type(), ctx)
+					: cp.restore(result_type(false, ctx.begin(), attribute_type(), ctx))
 					;
 			}
 			SPROUT_CONSTEXPR result_type call(
 				typename Expr::args_type const& args,
-				context_type const& ctx
+				context_type const& ctx,
+				checkpoint_type const& cp
 				) const
 			{
-				return call_1(args, ctx, sprout::weed::eval(sprout::tuples::get<0>(args), ctx));
+				return call_1(args, ctx, cp, sprout::weed::eval(sprout::tuples::get<0>(args), ctx));
 			}
 		public:
 			SPROUT_CONSTEXPR result_type operator()(
@@ -67,7 +71,7 @@ namespace sprout {
 				context_type const& ctx
 				) const
 			{
-				return call(expr.args(), ctx);
+				return call(expr.args(), ctx, checkpoint_type(expr));
 			}
 		};
 	}	// namespace weed
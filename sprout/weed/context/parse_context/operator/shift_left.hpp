@@ -18,6 +18,7 @@
 #include <sprout/weed/attr_cnv/shift_left.hpp>
 #include <sprout/weed/traits/expr/tag_of.hpp>
 #include <sprout/weed/traits/parser/attribute_of.hpp>
+#include <sprout/weed/detail/collect_into_checkpoint.hpp>
 #include <sprout/weed/context/parse_context_fwd.hpp>
 
 namespace sprout {
@@ -40,6 +41,7 @@ namespace sprout {
 			typedef sprout::weed::parse_context<Iterator> context_type;
 			typedef typename sprout::tuples::tuple_element<0, typename Expr::args_type>::type expr1_type;
 			typedef typename sprout::tuples::tuple_element<1, typename Expr::args_type>::type expr2_type;
+			typedef sprout::weed::detail::collect_into_checkpoint<Expr> checkpoint_type;
 		public:
 			typedef typename sprout::weed::attr_cnv::results::shift_left<
 				typename sprout::weed::traits::attribute_of<expr1_type, Iterator, context_type>::type,
@@ -51,6 +53,7 @@ namespace sprout {
 			SPROUT_CONSTEXPR result_type call_2(
 				typename Expr::args_type const&,
 				context_type const& ctx,
+				checkpoint_type const& cp,
 				Attr1 const& attr,
 				Result2 const& res
 				) const
@@ -62,13 +65,14 @@ namespace sprout {
 						sprout::weed::attr_cnv::shift_left(attr, res.attr()),
 						context_type(ctx, res.current())
 						)
-					: result_type(false, ctx.begin(), attribute_type(), ctx)
+					: cp.restore(result_type(false, ctx.begin(), attribute_type(), ctx))
 					;
 			}
 			template<typename Result1>
 			SPROUT_CONSTEXPR result_type call_1(
 				typename Expr::args_type const& args,
 				context_type const& ctx,
+				checkpoint_type const& cp,
 				Result1 const& res
 				) const
 			{
@@ -76,6 +80,7 @@ namespace sprout {
 					? call_2(
 						args,
 						ctx,
+						cp,
 						res.attr(),
 						sprout::weed::eval(sprout::tuples::get<1>(args), context_type(ctx, res.current()))
 						)
@@ -84,10 +89,11 @@ namespace sprout {
 			}
 			SPROUT_CONSTEXPR result_type call(
 				typename Expr::args_type const& args,
-				context_type const& ctx
+				context_type const& ctx,
+				checkpoint_type const& cp
 				) const
 			{
-				return call_1(args, ctx, sprout::weed::eval(sprout::tuples::get<0>(args), ctx));
+				return call_1(args, ctx, cp, sprout::weed::eval(sprout::tuples::get<0>(args), ctx));
 			}
 		public:
 			SPROUT_CONSTEXPR result_type operator()(
@@ -95,7 +101,7 @@ namespace sprout {
 				context_type const& ctx
 				) const
 			{
-				return call(expr.args(), ctx);
+				return call(expr.args(), ctx, checkpoint_type(expr));
 			}
 		};
 	}	// namespace weed
@@ -11,6 +11,7 @@
 #include <type_traits>
 #include <sprout/config.hpp>
 #include <sprout/tuple/tuple.hpp>
+#include <sprout/utility/forward.hpp>
 #include <sprout/weed/eval_result.hpp>
 #include <sprout/weed/expr/tag.hpp>
 #include <sprout/weed/traits/type/is_char_type.hpp>
@@ -58,11 +59,11 @@ namespace sprout {
 		private:
 			template<typename Result>
 			SPROUT_CONSTEXPR result_type call(
-				Result const& res,
+				Result&& res,
 				context_type const& ctx
 				) const
 			{
-				return result_type(res, context_type(ctx, res.current()));
+				return result_type(sprout::forward<Result>(res), context_type(ctx, res.current()));
 			}
 		public:
 			SPROUT_CONSTEXPR result_type operator()(
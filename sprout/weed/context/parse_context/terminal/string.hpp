@@ -8,6 +8,7 @@
 #ifndef SPROUT_WEED_CONTEXT_PARSE_CONTEXT_TERMINAL_STRING_HPP
 #define SPROUT_WEED_CONTEXT_PARSE_CONTEXT_TERMINAL_STRING_HPP
 
+#include <iterator>
 #include <type_traits>
 #include <sprout/config.hpp>
 #include <sprout/container/begin.hpp>
@@ -54,7 +55,8 @@ namespace sprout {
 				context_type const& ctx
 				) const
 			{
-				return sprout::distance(ctx.begin(), ctx.end()) >= sprout::size(arg)
+				return sprout::distance(ctx.begin(), ctx.end())
+					>= static_cast<typename std::iterator_traits<Iterator>::difference_type>(sprout::size(arg))
 					&& sprout::equal(sprout::begin(arg), sprout::end(arg), ctx.begin())
 					? result_type(
 						true,
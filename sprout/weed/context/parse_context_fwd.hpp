@@ -12,6 +12,9 @@
 
 namespace sprout {
 	namespace weed {
+		template<typename Iterator>
+		class memo_table;
+
 		//
 		// parse_context
 		//
@@ -23,14 +26,22 @@ namespace sprout {
 		private:
 			Iterator first_;
 			Iterator last_;
+			sprout::weed::memo_table<Iterator>* memo_;
 		public:
 			SPROUT_CONSTEXPR parse_context(Iterator first, Iterator last)
 				: first_(first)
 				, last_(last)
+				, memo_(0)
+			{}
+			SPROUT_CONSTEXPR parse_context(Iterator first, Iterator last, sprout::weed::memo_table<Iterator>& memo)
+				: first_(first)
+				, last_(last)
+				, memo_(&memo)
 			{}
 			SPROUT_CONSTEXPR parse_context(parse_context const& other, Iterator current)
 				: first_(current)
 				, last_(other.last_)
+				, memo_(other.memo_)
 			{}
 			SPROUT_CONSTEXPR Iterator begin() const {
 				return first_;
@@ -41,6 +52,9 @@ namespace sprout {
 			SPROUT_CONSTEXPR bool empty() const {
 				return first_ == last_;
 			}
+			SPROUT_CONSTEXPR sprout::weed::memo_table<Iterator>* memo() const {
+				return memo_;
+			}
 		};
 	}	// namespace weed
 }	// namespace sprout
@@ -0,0 +1,241 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_WEED_DETAIL_COLLECT_INTO_CHECKPOINT_HPP
+#define SPROUT_WEED_DETAIL_COLLECT_INTO_CHECKPOINT_HPP
+
+#include <type_traits>
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/array/array.hpp>
+#include <sprout/tuple/tuple.hpp>
+#include <sprout/iterator/next.hpp>
+#include <sprout/type_traits/integral_constant.hpp>
+#include <sprout/type_traits/has_xxx.hpp>
+#include <sprout/weed/expr/expr_fwd.hpp>
+#include <sprout/weed/expr/tag.hpp>
+
+namespace sprout {
+	namespace weed {
+		template<typename Parser, typename Container>
+		struct collect_into_p;
+
+		namespace detail {
+			//
+			// has_collect_into_subject
+			//
+			//	Directives expose the parser they wrap as expr_type and expr().
+			//
+			SPROUT_HAS_XXX_TYPE_DEF(has_collect_into_subject, expr_type);
+
+			template<typename Expr>
+			struct collect_into_count;
+
+			//
+			// collect_into_subject_count
+			//
+			template<typename T, typename = void>
+			struct collect_into_subject_count
+				: public sprout::integral_constant<std::size_t, 0>
+			{};
+			template<typename T>
+			struct collect_into_subject_count<T, typename std::enable_if<sprout::weed::detail::has_collect_into_subject<T>::value>::type>
+				: public sprout::weed::detail::collect_into_count<typename T::expr_type>
+			{};
+
+			//
+			// collect_into_count
+			//
+			//	The number of collect_into terminals in the operator tree of Expr,
+			//	including those inside directives.
+			//
+			template<typename Expr>
+			struct collect_into_count
+				: public sprout::integral_constant<std::size_t, 0>
+			{};
+			template<typename T>
+			struct collect_into_count<sprout::weed::expr<sprout::weed::tag::terminal, T> >
+				: public sprout::weed::detail::collect_into_subject_count<T>
+			{};
+			template<typename Parser, typename Container>
+			struct collect_into_count<sprout::weed::expr<sprout::weed::tag::terminal, sprout::weed::collect_into_p<Parser, Container> > >
+				: public sprout::integral_constant<
+					std::size_t,
+					1 + sprout::weed::detail::collect_into_subject_count<sprout::weed::collect_into_p<Parser, Container> >::value
+				>
+			{};
+			template<typename Tag, typename Head, typename... Tail>
+			struct collect_into_count<sprout::weed::expr<Tag, Head, Tail...> >
+				: public sprout::integral_constant<
+					std::size_t,
+					sprout::weed::detail::collect_into_count<Head>::value
+						+ sprout::weed::detail::collect_into_count<sprout::weed::expr<Tag, Tail...> >::value
+				>
+			{};
+
+			//
+			// collect_into_mark
+			//
+			struct collect_into_mark {
+			public:
+				void* cont;
+				std::size_t size;
+				void (*truncate)(void*, std::size_t);
+			};
+
+			template<typename Container>
+			inline void
+			collect_into_truncate(void* p, std::size_t size) {
+				Container& cont = *static_cast<Container*>(p);
+				if (cont.size() > size) {
+					cont.erase(sprout::next(cont.begin(), size), cont.end());
+				}
+			}
+
+			template<typename T>
+			inline sprout::weed::detail::collect_into_mark*
+			collect_into_subject_marks(
+				T const& t, sprout::weed::detail::collect_into_mark* out,
+				typename std::enable_if<sprout::weed::detail::has_collect_into_subject<T>::value>::type* = 0
+				);
+			template<typename T>
+			inline sprout::weed::detail::collect_into_mark*
+			collect_into_subject_marks(
+				T const&, sprout::weed::detail::collect_into_mark* out,
+				typename std::enable_if<!sprout::weed::detail::has_collect_into_subject<T>::value>::type* = 0
+				);
+			template<typename Parser, typename Container>
+			inline sprout::weed::detail::collect_into_mark*
+			collect_into_marks(
+				sprout::weed::expr<sprout::weed::tag::terminal, sprout::weed::collect_into_p<Parser, Container> > const& expr,
+				sprout::weed::detail::collect_into_mark* out
+				);
+			template<typename T>
+			inline sprout::weed::detail::collect_into_mark*
+			collect_into_marks(sprout::weed::expr<sprout::weed::tag::terminal, T> const& expr, sprout::weed::detail::collect_into_mark* out);
+			template<typename Tag, typename... Args>
+			inline sprout::weed::detail::collect_into_mark*
+			collect_into_marks(sprout::weed::expr<Tag, Args...> const& expr, sprout::weed::detail::collect_into_mark* out);
+
+			template<std::size_t I, std::size_t N>
+			struct collect_into_marks_args {
+			public:
+				template<typename Args>
+				static sprout::weed::detail::collect_into_mark*
+				call(Args const& args, sprout::weed::detail::collect_into_mark* out) {
+					return sprout::weed::detail::collect_into_marks_args<I + 1, N>::call(
+						args,
+						sprout::weed::detail::collect_into_marks(sprout::tuples::get<I>(args), out)
+						);
+				}
+			};
+			template<std::size_t N>
+			struct collect_into_marks_args<N, N> {
+			public:
+				template<typename Args>
+				static sprout::weed::detail::collect_into_mark*
+				call(Args const&, sprout::weed::detail::collect_into_mark* out) {
+					return out;
+				}
+			};
+
+			//
+			// collect_into_subject_marks
+			//
+			template<typename T>
+			inline sprout::weed::detail::collect_into_mark*
+			collect_into_subject_marks(
+				T const& t, sprout::weed::detail::collect_into_mark* out,
+				typename std::enable_if<sprout::weed::detail::has_collect_into_subject<T>::value>::type*
+				)
+			{
+				return sprout::weed::detail::collect_into_marks(t.expr(), out);
+			}
+			template<typename T>
+			inline sprout::weed::detail::collect_into_mark*
+			collect_into_subject_marks(
+				T const&, sprout::weed::detail::collect_into_mark* out,
+				typename std::enable_if<!sprout::weed::detail::has_collect_into_subject<T>::value>::type*
+				)
+			{
+				return out;
+			}
+
+			//
+			// collect_into_marks
+			//
+			//	Records the container and its size of each collect_into terminal in expr.
+			//
+			template<typename Parser, typename Container>
+			inline sprout::weed::detail::collect_into_mark*
+			collect_into_marks(
+				sprout::weed::expr<sprout::weed::tag::terminal, sprout::weed::collect_into_p<Parser, Container> > const& expr,
+				sprout::weed::detail::collect_into_mark* out
+				)
+			{
+				sprout::weed::collect_into_p<Parser, Container> const& p = sprout::tuples::get<0>(expr.args());
+				Container& cont = p.container();
+				out->cont = &cont;
+				out->size = cont.size();
+				out->truncate = &sprout::weed::detail::collect_into_truncate<Container>;
+				return sprout::weed::detail::collect_into_subject_marks(p, out + 1);
+			}
+			template<typename T>
+			inline sprout::weed::detail::collect_into_mark*
+			collect_into_marks(sprout::weed::expr<sprout::weed::tag::terminal, T> const& expr, sprout::weed::detail::collect_into_mark* out) {
+				return sprout::weed::detail::collect_into_subject_marks(sprout::tuples::get<0>(expr.args()), out);
+			}
+			template<typename Tag, typename... Args>
+			inline sprout::weed::detail::collect_into_mark*
+			collect_into_marks(sprout::weed::expr<Tag, Args...> const& expr, sprout::weed::detail::collect_into_mark* out) {
+				return sprout::weed::detail::collect_into_marks_args<0, sizeof...(Args)>::call(expr.args(), out);
+			}
+
+			//
+			// collect_into_checkpoint
+			//
+			//	Taken before an operator evaluates its operands, so that the operator
+			//	can undo what collect_into appended when it fails after an operand
+			//	succeeded. Without collect_into in the tree it holds nothing, and restore
+			//	stays constexpr.
+			//
+			template<typename Expr, typename = void>
+			class collect_into_checkpoint {
+			public:
+				explicit SPROUT_CONSTEXPR collect_into_checkpoint(Expr const&) {}
+				template<typename Result>
+				SPROUT_CONSTEXPR Result restore(Result const& res) const {
+					return res;
+				}
+			};
+			template<typename Expr>
+			class collect_into_checkpoint<
+				Expr,
+				typename std::enable_if<(sprout::weed::detail::collect_into_count<Expr>::value > 0)>::type
+			> {
+			private:
+				sprout::array<sprout::weed::detail::collect_into_mark, sprout::weed::detail::collect_into_count<Expr>::value> marks_;
+			public:
+				explicit collect_into_checkpoint(Expr const& expr)
+					: marks_()
+				{
+					sprout::weed::detail::collect_into_marks(expr, marks_.data());
+				}
+				template<typename Result>
+				Result restore(Result const& res) const {
+					for (std::size_t i = marks_.size(); i != 0; --i) {
+						sprout::weed::detail::collect_into_mark const& mark = marks_[i - 1];
+						mark.truncate(mark.cont, mark.size);
+					}
+					return res;
+				}
+			};
+		}	// namespace detail
+	}	// namespace weed
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_WEED_DETAIL_COLLECT_INTO_CHECKPOINT_HPP
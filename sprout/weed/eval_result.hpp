@@ -9,6 +9,7 @@
 #define SPROUT_WEED_EVAL_RESULT_HPP
 
 #include <sprout/config.hpp>
+#include <sprout/utility/move.hpp>
 #include <sprout/weed/parser_result.hpp>
 
 namespace sprout {
@@ -41,6 +42,13 @@ namespace sprout {
 				: presult_(presult)
 				, ctx_(ctx)
 			{}
+			SPROUT_CONSTEXPR eval_result(
+				presult_type&& presult,
+				Context const& ctx
+				)
+				: presult_(sprout::move(presult))
+				, ctx_(ctx)
+			{}
 			SPROUT_CONSTEXPR presult_type const& presult() const {
 				return presult_;
 			}
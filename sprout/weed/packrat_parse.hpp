@@ -0,0 +1,79 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_WEED_PACKRAT_PARSE_HPP
+#define SPROUT_WEED_PACKRAT_PARSE_HPP
+
+#include <sprout/config.hpp>
+#include <sprout/container/functions.hpp>
+#include <sprout/container/traits.hpp>
+#include <sprout/weed/expr/make_terminal_or_expr.hpp>
+#include <sprout/weed/expr/eval.hpp>
+#include <sprout/weed/context/parse_context.hpp>
+#include <sprout/weed/context/memo_table.hpp>
+#include <sprout/weed/traits/expr/terminal_or_expr_of.hpp>
+
+namespace sprout {
+	namespace weed {
+		//
+		// packrat_parse
+		//
+		//	Runtime parse with a memo table attached to the context; every memo[]
+		//	sub-parser is evaluated at most once per input position. The overloads
+		//	taking a memo_table reset and reuse its arena. Iterator must be random
+		//	access.
+		//
+		template<typename Iterator, typename Parser>
+		inline typename sprout::weed::parse_context<
+			Iterator
+		>::template eval<
+			typename sprout::weed::traits::terminal_or_expr_of<Parser>::type
+		>::result_type::presult_type
+		packrat_parse(Iterator first, Iterator last, Parser const& parser, sprout::weed::memo_table<Iterator>& memo) {
+			memo.reset(first);
+			return sprout::weed::eval(
+				sprout::weed::make_terminal_or_expr(parser),
+				sprout::weed::parse_context<Iterator>(first, last, memo)
+				).presult()
+				;
+		}
+		template<typename Iterator, typename Parser>
+		inline typename sprout::weed::parse_context<
+			Iterator
+		>::template eval<
+			typename sprout::weed::traits::terminal_or_expr_of<Parser>::type
+		>::result_type::presult_type
+		packrat_parse(Iterator first, Iterator last, Parser const& parser) {
+			sprout::weed::memo_table<Iterator> memo(first);
+			return sprout::weed::packrat_parse(first, last, parser, memo);
+		}
+		template<typename Range, typename Parser>
+		inline typename sprout::weed::parse_context<
+			typename sprout::container_traits<Range>::const_iterator
+		>::template eval<
+			typename sprout::weed::traits::terminal_or_expr_of<Parser>::type
+		>::result_type::presult_type
+		packrat_parse(Range const& range, Parser const& parser) {
+			return sprout::weed::packrat_parse(sprout::begin(range), sprout::end(range), parser);
+		}
+		template<typename Range, typename Parser>
+		inline typename sprout::weed::parse_context<
+			typename sprout::container_traits<Range>::const_iterator
+		>::template eval<
+			typename sprout::weed::traits::terminal_or_expr_of<Parser>::type
+		>::result_type::presult_type
+		packrat_parse(
+			Range const& range, Parser const& parser,
+			sprout::weed::memo_table<typename sprout::container_traits<Range>::const_iterator>& memo
+			)
+		{
+			return sprout::weed::packrat_parse(sprout::begin(range), sprout::end(range), parser, memo);
+		}
+	}	// namespace weed
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_WEED_PACKRAT_PARSE_HPP
@@ -13,5 +13,7 @@
 #include <sprout/weed/parser/directive/repeat.hpp>
 #include <sprout/weed/parser/directive/as_array.hpp>
 #include <sprout/weed/parser/directive/as_tuple.hpp>
+#include <sprout/weed/parser/directive/memo.hpp>
+#include <sprout/weed/parser/directive/collect.hpp>
 
 #endif	// #ifndef SPROUT_WEED_PARSER_DIRECTIVE_HPP
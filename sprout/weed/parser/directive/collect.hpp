@@ -0,0 +1,239 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_WEED_PARSER_DIRECTIVE_COLLECT_HPP
+#define SPROUT_WEED_PARSER_DIRECTIVE_COLLECT_HPP
+
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/iterator/next.hpp>
+#include <sprout/type_traits/identity.hpp>
+#include <sprout/utility/move.hpp>
+#include <sprout/weed/unused.hpp>
+#include <sprout/weed/parser_result.hpp>
+#include <sprout/weed/expr/make_terminal_or_expr.hpp>
+#include <sprout/weed/expr/eval.hpp>
+#include <sprout/weed/parser/parser_base.hpp>
+#include <sprout/weed/attr_cnv/results/collect.hpp>
+#include <sprout/weed/attr_cnv/collect.hpp>
+#include <sprout/weed/detail/collect_into_checkpoint.hpp>
+#include <sprout/weed/traits/expr/terminal_or_expr_of.hpp>
+#include <sprout/weed/traits/parser/attribute_of.hpp>
+
+namespace sprout {
+	namespace weed {
+		namespace detail {
+			//
+			// collect_loop
+			//
+			//	Iterative (not recursive) repetition, so input length is not bounded by
+			//	the stack depth. Stops on the first failure or on an empty match.
+			//
+			template<typename Iterator, typename Expr, typename Context, typename Container>
+			inline Iterator
+			collect_loop(Expr const& expr, Context const& ctx, Container& cont, std::size_t& count) {
+				typedef typename Context::template eval<Expr>::result_type result_type;
+				Context current = ctx;
+				for (count = 0; ; ) {
+					result_type const res = sprout::weed::eval(expr, current);
+					if (!res.success()) {
+						break;
+					}
+					sprout::weed::attr_cnv::collect(cont, res.attr());
+					++count;
+					if (res.current() == current.begin()) {
+						break;
+					}
+					current = res.ctx();
+				}
+				return current.begin();
+			}
+		}	// namespace detail
+
+		//
+		// collect_p
+		//
+		//	Runtime repetition of at least min_count matches into a growable
+		//	container (std::basic_string for characters, std::vector otherwise).
+		//	Unlike *p, there is no compile-time limit.
+		//
+		template<typename Parser>
+		struct collect_p
+			: public sprout::weed::parser_base
+		{
+		public:
+			template<typename Context, typename Iterator>
+			struct attribute
+				: public sprout::weed::attr_cnv::results::collect<
+					typename sprout::weed::traits::attribute_of<Parser, Iterator, Context>::type
+				>
+			{};
+			template<typename Context, typename Iterator>
+			struct result
+				: public sprout::identity<sprout::weed::parser_result<Iterator, typename attribute<Context, Iterator>::type> >
+			{};
+		public:
+			typedef typename sprout::weed::traits::terminal_or_expr_of<Parser>::type expr_type;
+		private:
+			expr_type expr_;
+			std::size_t min_count_;
+		public:
+			SPROUT_CONSTEXPR collect_p() SPROUT_DEFAULTED_DEFAULT_CONSTRUCTOR_DECL
+			explicit SPROUT_CONSTEXPR collect_p(Parser const& p, std::size_t min_count = 0)
+				: expr_(sprout::weed::make_terminal_or_expr(p))
+				, min_count_(min_count)
+			{}
+			expr_type const& expr() const {
+				return expr_;
+			}
+			template<typename Context, typename Iterator>
+			typename result<Context, Iterator>::type operator()(
+				Iterator first, Iterator,
+				Context const& ctx
+				) const
+			{
+				typedef typename result<Context, Iterator>::type result_type;
+				typedef typename attribute<Context, Iterator>::type attribute_type;
+				sprout::weed::detail::collect_into_checkpoint<expr_type> const checkpoint(expr_);
+				attribute_type attr = attribute_type();
+				std::size_t count = 0;
+				Iterator const current = sprout::weed::detail::collect_loop<Iterator>(expr_, ctx, attr, count);
+				return count >= min_count_
+					? result_type(true, current, sprout::move(attr))
+					: checkpoint.restore(result_type(false, first, attribute_type()))
+					;
+			}
+		};
+
+		//
+		// collect_into_p
+		//
+		//	Appends straight into a caller-owned container (which may use an arena
+		//	allocator); the attribute is unused, so enclosing parsers never copy the
+		//	collected elements. Elements appended by a failing collect_into_p are
+		//	removed again, and so are those of a successful one when an enclosing
+		//	>>, |, -, ! or & fails or backtracks over it (the container is truncated
+		//	to its size before that operator ran). This holds inside directives too,
+		//	and memo[] does not memoize a subtree containing collect_into.
+		//
+		template<typename Parser, typename Container>
+		struct collect_into_p
+			: public sprout::weed::parser_base
+		{
+		public:
+			template<typename Context, typename Iterator>
+			struct attribute
+				: public sprout::identity<sprout::weed::unused>
+			{};
+			template<typename Context, typename Iterator>
+			struct result
+				: public sprout::identity<sprout::weed::parser_result<Iterator, typename attribute<Context, Iterator>::type> >
+			{};
+		public:
+			typedef typename sprout::weed::traits::terminal_or_expr_of<Parser>::type expr_type;
+		private:
+			expr_type expr_;
+			Container* cont_;
+			std::size_t min_count_;
+		public:
+			collect_into_p(Parser const& p, Container& cont, std::size_t min_count = 0)
+				: expr_(sprout::weed::make_terminal_or_expr(p))
+				, cont_(&cont)
+				, min_count_(min_count)
+			{}
+			expr_type const& expr() const {
+				return expr_;
+			}
+			template<typename Context, typename Iterator>
+			typename result<Context, Iterator>::type operator()(
+				Iterator first, Iterator,
+				Context const& ctx
+				) const
+			{
+				typedef typename result<Context, Iterator>::type result_type;
+				typedef typename attribute<Context, Iterator>::type attribute_type;
+				sprout::weed::detail::collect_into_checkpoint<expr_type> const checkpoint(expr_);
+				std::size_t const size = cont_->size();
+				std::size_t count = 0;
+				Iterator const current = sprout::weed::detail::collect_loop<Iterator>(expr_, ctx, *cont_, count);
+				if (count < min_count_) {
+					cont_->erase(sprout::next(cont_->begin(), size), cont_->end());
+					return checkpoint.restore(result_type(false, first, attribute_type()));
+				}
+				return result_type(true, current, attribute_type());
+			}
+			Container& container() const {
+				return *cont_;
+			}
+		};
+
+		//
+		// collect_g
+		//
+		struct collect_g {
+		private:
+			std::size_t min_count_;
+		public:
+			explicit SPROUT_CONSTEXPR collect_g(std::size_t min_count)
+				: min_count_(min_count)
+			{}
+			template<typename Parser>
+			SPROUT_CONSTEXPR sprout::weed::collect_p<Parser> operator[](Parser const& p) const {
+				return sprout::weed::collect_p<Parser>(p, min_count_);
+			}
+		};
+
+		//
+		// collect_d
+		//
+		struct collect_d {
+		public:
+			template<typename Parser>
+			SPROUT_CONSTEXPR sprout::weed::collect_p<Parser> operator[](Parser const& p) const {
+				return sprout::weed::collect_p<Parser>(p);
+			}
+			SPROUT_CONSTEXPR sprout::weed::collect_g operator()(std::size_t min_count) const {
+				return sprout::weed::collect_g(min_count);
+			}
+		};
+
+		//
+		// collect_into_g
+		//
+		template<typename Container>
+		struct collect_into_g {
+		private:
+			Container* cont_;
+			std::size_t min_count_;
+		public:
+			collect_into_g(Container& cont, std::size_t min_count)
+				: cont_(&cont)
+				, min_count_(min_count)
+			{}
+			template<typename Parser>
+			sprout::weed::collect_into_p<Parser, Container> operator[](Parser const& p) const {
+				return sprout::weed::collect_into_p<Parser, Container>(p, *cont_, min_count_);
+			}
+		};
+
+		//
+		// collect
+		//
+		SPROUT_CONSTEXPR sprout::weed::collect_d collect = sprout::weed::collect_d();
+
+		//
+		// collect_into
+		//
+		template<typename Container>
+		inline sprout::weed::collect_into_g<Container>
+		collect_into(Container& cont, std::size_t min_count = 0) {
+			return sprout::weed::collect_into_g<Container>(cont, min_count);
+		}
+	}	// namespace weed
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_WEED_PARSER_DIRECTIVE_COLLECT_HPP
@@ -0,0 +1,133 @@
+/*=============================================================================
+  Copyright (c) 2011-2019 Bolero MURAKAMI
+  https://github.com/bolero-MURAKAMI/Sprout
+
+  Distributed under the Boost Software License, Version 1.0. (See accompanying
+  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+=============================================================================*/
+#ifndef SPROUT_WEED_PARSER_DIRECTIVE_MEMO_HPP
+#define SPROUT_WEED_PARSER_DIRECTIVE_MEMO_HPP
+
+#include <sprout/config.hpp>
+#include <sprout/workaround/std/cstddef.hpp>
+#include <sprout/type_traits/identity.hpp>
+#include <sprout/weed/parser_result.hpp>
+#include <sprout/weed/expr/make_terminal_or_expr.hpp>
+#include <sprout/weed/expr/eval.hpp>
+#include <sprout/weed/parser/parser_base.hpp>
+#include <sprout/weed/context/memo_table.hpp>
+#include <sprout/weed/detail/collect_into_checkpoint.hpp>
+#include <sprout/weed/traits/expr/terminal_or_expr_of.hpp>
+#include <sprout/weed/traits/parser/attribute_of.hpp>
+
+namespace sprout {
+	namespace weed {
+		//
+		// memo_p
+		//
+		//	Without a memo_table in the context this is a plain pass-through, so
+		//	grammars stay usable in constant expressions. A subtree containing
+		//	collect_into is never memoized, since a replayed entry would skip its
+		//	appends.
+		//
+		template<typename Parser>
+		struct memo_p
+			: public sprout::weed::parser_base
+		{
+		public:
+			template<typename Context, typename Iterator>
+			struct attribute
+				: public sprout::identity<typename sprout::weed::traits::attribute_of<Parser, Iterator, Context>::type>
+			{};
+			template<typename Context, typename Iterator>
+			struct result
+				: public sprout::identity<sprout::weed::parser_result<Iterator, typename attribute<Context, Iterator>::type> >
+			{};
+		public:
+			typedef typename sprout::weed::traits::terminal_or_expr_of<Parser>::type expr_type;
+		private:
+			expr_type expr_;
+			std::size_t id_;
+		private:
+			template<typename Context, typename Iterator, typename Result>
+			SPROUT_CONSTEXPR typename result<Context, Iterator>::type call(
+				Iterator first,
+				Result const& res
+				) const
+			{
+				typedef typename result<Context, Iterator>::type result_type;
+				typedef typename attribute<Context, Iterator>::type attribute_type;
+				return res.success()
+					? result_type(true, res.current(), res.attr())
+					: result_type(false, first, attribute_type())
+					;
+			}
+			template<typename Context, typename Iterator>
+			typename result<Context, Iterator>::type memoized(
+				Iterator first,
+				Context const& ctx
+				) const
+			{
+				typedef typename result<Context, Iterator>::type result_type;
+				if (result_type const* found = ctx.memo()->template find<memo_p, result_type>(id_, first)) {
+					return *found;
+				}
+				return ctx.memo()->template insert<memo_p>(id_, first, call<Context>(first, sprout::weed::eval(expr_, ctx)));
+			}
+		public:
+			SPROUT_CONSTEXPR memo_p() SPROUT_DEFAULTED_DEFAULT_CONSTRUCTOR_DECL
+			explicit SPROUT_CONSTEXPR memo_p(
+				Parser const& p,
+				std::size_t id = 0
+				)
+				: expr_(sprout::weed::make_terminal_or_expr(p))
+				, id_(id)
+			{}
+			SPROUT_CONSTEXPR std::size_t id() const {
+				return id_;
+			}
+			SPROUT_CONSTEXPR expr_type const& expr() const {
+				return expr_;
+			}
+			template<typename Context, typename Iterator>
+			SPROUT_CONSTEXPR typename result<Context, Iterator>::type operator()(
+				Iterator first, Iterator,
+				Context const& ctx
+				) const
+			{
+				return ctx.memo() && !(sprout::weed::detail::collect_into_count<expr_type>::value > 0)
+					? memoized(first, ctx)
+					: call<Context>(first, sprout::weed::eval(expr_, ctx))
+					;
+			}
+		};
+		//
+		// memo_d
+		//
+		//	memo[p] and memo(id)[p]. Occurrences of the same parser type with the
+		//	same id share memo entries, so give a repeated rule the same id and
+		//	unrelated rules of the same type different ones.
+		//
+		struct memo_d {
+		private:
+			std::size_t id_;
+		public:
+			explicit SPROUT_CONSTEXPR memo_d(std::size_t id = 0)
+				: id_(id)
+			{}
+			SPROUT_CONSTEXPR sprout::weed::memo_d operator()(std::size_t id) const {
+				return sprout::weed::memo_d(id);
+			}
+			template<typename Parser>
+			SPROUT_CONSTEXPR sprout::weed::memo_p<Parser> operator[](Parser const& p) const {
+				return sprout::weed::memo_p<Parser>(p, id_);
+			}
+		};
+		//
+		// memo
+		//
+		SPROUT_CONSTEXPR sprout::weed::memo_d memo = sprout::weed::memo_d();
+	}	// namespace weed
+}	// namespace sprout
+
+#endif	// #ifndef SPROUT_WEED_PARSER_DIRECTIVE_MEMO_HPP
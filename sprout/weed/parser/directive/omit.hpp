@@ -37,7 +37,7 @@ namespace sprout {
 			struct result
 				: public sprout::identity<sprout::weed::parser_result<Iterator, typename attribute<Context, Iterator>::type> >
 			{};
-		private:
+		public:
 			typedef typename sprout::weed::traits::terminal_or_expr_of<Parser>::type expr_type;
 		private:
 			expr_type expr_;
@@ -62,6 +62,9 @@ namespace sprout {
 				)
 				: expr_(sprout::weed::make_terminal_or_expr(p))
 			{}
+			SPROUT_CONSTEXPR expr_type const& expr() const {
+				return expr_;
+			}
 			template<typename Context, typename Iterator>
 			SPROUT_CONSTEXPR typename result<Context, Iterator>::type operator()(
 				Iterator first, Iterator,
@@ -41,7 +41,7 @@ namespace sprout {
 			struct result
 				: public sprout::identity<sprout::weed::parser_result<Iterator, typename attribute<Context, Iterator>::type> >
 			{};
-		private:
+		public:
 			typedef typename sprout::weed::traits::terminal_or_expr_of<Parser>::type expr_type;
 		private:
 			expr_type expr_;
@@ -58,6 +58,9 @@ namespace sprout {
 			SPROUT_CONSTEXPR sprout::weed::limited::category limited_category() const {
 				return limited_category_;
 			}
+			SPROUT_CONSTEXPR expr_type const& expr() const {
+				return expr_;
+			}
 			template<typename Context, typename Iterator>
 			SPROUT_CONSTEXPR typename result<Context, Iterator>::type operator()(
 				Iterator, Iterator,
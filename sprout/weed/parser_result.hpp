@@ -9,6 +9,7 @@
 #define SPROUT_WEED_PARSER_RESULT_HPP
 
 #include <sprout/config.hpp>
+#include <sprout/utility/move.hpp>
 
 namespace sprout {
 	namespace weed {
@@ -32,6 +33,15 @@ namespace sprout {
 				, current_(current)
 				, attr_(attr)
 			{}
+			SPROUT_CONSTEXPR parser_result(
+				bool success,
+				Iterator current,
+				Attribute&& attr
+				)
+				: success_(success)
+				, current_(current)
+				, attr_(sprout::move(attr))
+			{}
 			SPROUT_CONSTEXPR bool success() const {
 				return success_;
 			}
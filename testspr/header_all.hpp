@@ -21,6 +21,7 @@
 #include <sprout/bitset.hpp>
 #include <sprout/brainfuck.hpp>
 #include <sprout/cctype.hpp>
+#include <sprout/charconv.hpp>
 #include <sprout/checksum.hpp>
 #include <sprout/cinttypes.hpp>
 #include <sprout/cmath.hpp>
@@ -40,6 +41,7 @@
 #include <sprout/cwctype.hpp>
 #include <sprout/darkroom.hpp>
 #include <sprout/endian_traits.hpp>
+#include <sprout/fixed_unordered_map.hpp>
 #include <sprout/forward_clist.hpp>
 #include <sprout/functional.hpp>
 #include <sprout/generator.hpp>
@@ -72,9 +74,11 @@
 #include <sprout/range/numeric/dft.hpp>
 #include <sprout/range/numeric/fft.hpp>
 #include <sprout/rational.hpp>
+#include <sprout/regex.hpp>
 #include <sprout/sized_pit.hpp>
 #include <sprout/stateful.hpp>
 #include <sprout/static_assert.hpp>
+#include <sprout/static_map.hpp>
 #include <sprout/static_warning.hpp>
 #include <sprout/string.hpp>
 #include <sprout/sub_array.hpp>
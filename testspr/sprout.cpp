@@ -15,7 +15,18 @@
 
 #include "../libs/array/test/array.cpp"
 #include "../libs/string/test/string.cpp"
+#include "../libs/string/test/dynamic_string.cpp"
 #include "../libs/bitset/test/bitset.cpp"
+#include "../libs/bitset/test/dynamic_bitset.cpp"
+#include "../libs/bitset/test/roaring_bitmap.cpp"
+#include "../libs/charconv/test/from_chars.cpp"
+#include "../libs/charconv/test/to_chars.cpp"
+#include "../libs/complex/test/soa.cpp"
+#include "../libs/compost/test/resampler.cpp"
+#include "../libs/compost/test/wavetable.cpp"
+#include "../libs/darkroom/test/soa.cpp"
+#include "../libs/brainfuck/test/bytecode.cpp"
+#include "../libs/brainfuck/test/x86_64.cpp"
 #include "../libs/tuple/test/tuple.cpp"
 #include "../libs/optional/test/optional.cpp"
 #include "../libs/variant/test/variant.cpp"
@@ -24,6 +35,20 @@
 #include "../libs/utility/string_view/test/string_view.cpp"
 #include "../libs/cstring/test/cstring.cpp"
 #include "../libs/net/test/endian.cpp"
+#include "../libs/numeric/test/stft.cpp"
+#include "../libs/static_map/test/static_map.cpp"
+#include "../libs/fixed_unordered_map/test/fixed_unordered_map.cpp"
+#include "../libs/functional/test/hash_bytes.cpp"
+#include "../libs/integer/test/big_int.cpp"
+#include "../libs/regex/test/regex.cpp"
+#include "../libs/range/test/split.cpp"
+#include "../libs/ctype/test/bulk.cpp"
+#include "../libs/math/test/elementary.cpp"
+#include "../libs/math/test/batch.cpp"
+#include "../libs/math/test/quaternion_soa.cpp"
+#include "../libs/valarray/test/expression.cpp"
+#include "../libs/weed/test/collect.cpp"
+#include "../libs/weed/test/packrat.cpp"
 
 #ifdef TESTSPR_CPP_INCLUDE_DISABLE_TESTSPR_SPROUT_HPP
 #	undef TESTSPR_CPP_INCLUDE
@@ -33,7 +58,18 @@ namespace testspr {
 	static void sprout_test() {
 		testspr::array_test();
 		testspr::string_test();
+		testspr::dynamic_string_test();
 		testspr::bitset_test();
+		testspr::dynamic_bitset_test();
+		testspr::roaring_bitmap_test();
+		testspr::from_chars_test();
+		testspr::to_chars_test();
+		testspr::complex_soa_test();
+		testspr::resampler_test();
+		testspr::wavetable_test();
+		testspr::vec3_soa_test();
+		testspr::bytecode_test();
+		testspr::x86_64_test();
 		testspr::tuple_test();
 		testspr::optional_test();
 		testspr::variant_test();
@@ -42,6 +78,20 @@ namespace testspr {
 		testspr::string_view_test();
 		testspr::cstring_test();
 		testspr::endian_test();
+		testspr::stft_test();
+		testspr::static_map_test();
+		testspr::fixed_unordered_map_test();
+		testspr::hash_bytes_test();
+		testspr::big_int_test();
+		testspr::regex_test();
+		testspr::split_test();
+		testspr::bulk_test();
+		testspr::elementary_test();
+		testspr::batch_test();
+		testspr::quat_soa_test();
+		testspr::expression_test();
+		testspr::collect_test();
+		testspr::packrat_test();
 	}
 }	// namespace testspr
 